@@ -19,6 +19,7 @@
 #include "Modules/Buffer/byte_buffer.hpp"
 #include "Modules/CMA/CMA.hpp"
 #include "Modules/CMA/cma_alloc_limit_guard.hpp"
+#include "Modules/CMA/cma_arena_scope.hpp"
 #include "Modules/CMA/cma_internal.hpp"
 #include "Modules/CPP_class/bitset.hpp"
 #include "Modules/CPP_class/cancellation.hpp"
@@ -87,10 +88,13 @@
 #include "Modules/Game/game_event_scheduler.hpp"
 #include "Modules/Game/game_event_scheduler_telemetry.hpp"
 #include "Modules/Game/game_experience_table.hpp"
+#include "Modules/Game/game_flow_field.hpp"
 #include "Modules/Game/game_hooks.hpp"
 #include "Modules/Game/game_inventory.hpp"
 #include "Modules/Game/game_item.hpp"
 #include "Modules/Game/game_map3d.hpp"
+#include "Modules/Game/game_path_batch.hpp"
+#include "Modules/Game/game_path_hierarchy.hpp"
 #include "Modules/Game/game_pathfinding.hpp"
 #include "Modules/Game/game_price_definition.hpp"
 #include "Modules/Game/game_progress_tracker.hpp"
@@ -124,12 +128,15 @@
 #include "Modules/HTML/html_parser.hpp"
 #include "Modules/JSon/document.hpp"
 #include "Modules/JSon/json.hpp"
+#include "Modules/JSon/json_arena.hpp"
+#include "Modules/JSon/json_cursor.hpp"
 #include "Modules/JSon/json_dom_bridge.hpp"
 #include "Modules/JSon/json_schema.hpp"
 #include "Modules/JSon/json_schema_evolution.hpp"
 #include "Modules/JSon/json_stream_events.hpp"
 #include "Modules/JSon/json_stream_reader.hpp"
 #include "Modules/JSon/json_stream_writer.hpp"
+#include "Modules/JSon/json_structural_index.hpp"
 #include "Modules/Logger/logger.hpp"
 #include "Modules/Logger/logger_internal.hpp"
 #include "Modules/Math/ft_cubic_spline.hpp"
@@ -149,6 +156,7 @@
 #include "Modules/Math/vector4.hpp"
 #include "Modules/Networking/http2_client.hpp"
 #include "Modules/Networking/http_client.hpp"
+#include "Modules/Networking/http_parser.hpp"
 #include "Modules/Networking/http_server.hpp"
 #include "Modules/Networking/networking.hpp"
 #include "Modules/Networking/networking_quic_experimental.hpp"
@@ -197,12 +205,15 @@
 #include "Modules/Template/function.hpp"
 #include "Modules/Template/future.hpp"
 #include "Modules/Template/graph.hpp"
+#include "Modules/Template/graph_search.hpp"
+#include "Modules/Template/indexed_heap.hpp"
 #include "Modules/Template/invoke.hpp"
 #include "Modules/Template/iterator.hpp"
 #include "Modules/Template/map.hpp"
 #include "Modules/Template/math.hpp"
 #include "Modules/Template/matrix.hpp"
 #include "Modules/Template/move.hpp"
+#include "Modules/Template/move_only_function.hpp"
 #include "Modules/Template/optional.hpp"
 #include "Modules/Template/pair.hpp"
 #include "Modules/Template/pool.hpp"
@@ -228,13 +239,16 @@
 #include "Modules/Threading/lock_guard.hpp"
 #include "Modules/Threading/task_scheduler.hpp"
 #include "Modules/Threading/task_scheduler_tracing.hpp"
+#include "Modules/Threading/task_slab.hpp"
 #include "Modules/Threading/thread.hpp"
 #include "Modules/Threading/unique_lock.hpp"
+#include "Modules/Threading/work_stealing_queue.hpp"
 #include "Modules/Time/time.hpp"
 #include "Modules/Time/time_fps.hpp"
 #include "Modules/Time/time_timer.hpp"
 #include "Modules/Voxel/voxel.hpp"
 #include "Modules/Voxel/voxel_mesh.hpp"
+#include "Modules/Voxel/voxel_pipeline.hpp"
 #include "Modules/XML/xml.hpp"
 #include "Modules/XML/xml_document.hpp"
 #include "Modules/XML/xml_dom_bridge.hpp"
@@ -15,6 +15,8 @@ typedef ft_size_t    (*cma_backend_get_allocation_size_function)(
 typedef ft_bool (*cma_backend_owns_allocation_function)(
             const void *memory_pointer, void *user_data);
 
+struct cma_arena;
+
 struct cma_backend_hooks
 {
     cma_backend_allocate_function allocate;
@@ -52,10 +54,32 @@ int32_t     cma_set_thread_safety(ft_bool enable);
 int32_t     cma_enable_thread_safety(void);
 int32_t     cma_disable_thread_safety(void);
 ft_bool cma_is_thread_safe_enabled(void);
+int32_t     cma_set_thread_cache_enabled(ft_bool enable);
+ft_bool     cma_is_thread_cache_enabled(void);
+int32_t     cma_flush_thread_cache(void);
+int32_t     cma_arena_create(ft_size_t capacity, cma_arena **out_arena)
+                __attribute__ ((warn_unused_result));
+int32_t     cma_arena_destroy(cma_arena *arena);
+void        *cma_arena_alloc(cma_arena *arena, ft_size_t size)
+                __attribute__ ((warn_unused_result, hot));
+void        *cma_arena_aligned_alloc(cma_arena *arena, ft_size_t alignment,
+                ft_size_t size) __attribute__ ((warn_unused_result, hot));
+ft_size_t   cma_arena_mark(const cma_arena *arena)
+                __attribute__ ((warn_unused_result));
+int32_t     cma_arena_rewind(cma_arena *arena, ft_size_t mark);
+int32_t     cma_arena_reset(cma_arena *arena);
+ft_size_t   cma_arena_capacity(const cma_arena *arena)
+                __attribute__ ((warn_unused_result));
+cma_arena   *cma_arena_exchange_thread_scope(cma_arena *arena);
+cma_arena   *cma_arena_thread_scope(void) __attribute__ ((warn_unused_result));
 int32_t     cma_get_stats(ft_size_t *allocation_count, ft_size_t *free_count);
 int32_t     cma_get_extended_stats(ft_size_t *allocation_count,
                 ft_size_t *free_count, ft_size_t *current_bytes,
-                ft_size_t *peak_bytes);
+                ft_size_t *peak_bytes,
+                ft_size_t *huge_allocation_count = nullptr,
+                ft_size_t *huge_mapped_bytes = nullptr);
+int32_t     cma_set_huge_threshold(ft_size_t threshold);
+ft_size_t   cma_get_huge_threshold(void) __attribute__ ((warn_unused_result));
 
 #ifdef LIBFT_TEST_BUILD
 struct cma_leak_entry
@@ -81,32 +81,22 @@ static ft_bool block_supports_aligned_request(Block *block, ft_size_t aligned_si
 static Block   *find_aligned_free_block(ft_size_t aligned_size, ft_size_t alignment,
             ft_size_t *padding)
 {
-    Page    *current_page;
-    Block   *current_block;
+    Block       *block;
+    ft_size_t   search_size;
+    ft_size_t   local_padding;
 
-    current_page = page_list;
-    while (current_page)
-    {
-        current_block = current_page->blocks;
-        while (current_block)
-        {
-            cma_validate_block(current_block, "cma_aligned_alloc search", nullptr);
-            if (cma_block_is_free(current_block))
-            {
-                ft_size_t   local_padding;
-
-                if (block_supports_aligned_request(current_block, aligned_size,
-                        alignment, &local_padding) == FT_TRUE)
-                {
-                    *padding = local_padding;
-                    return (current_block);
-                }
-            }
-            current_block = current_block->next;
-        }
-        current_page = current_page->next;
-    }
-    return (nullptr);
+    if (aligned_size > FT_SYSTEM_SIZE_MAX - alignment)
+        return (nullptr);
+    search_size = aligned_size + alignment;
+    block = find_free_block(search_size);
+    if (block == nullptr)
+        return (nullptr);
+    cma_validate_block(block, "cma_aligned_alloc search", nullptr);
+    if (block_supports_aligned_request(block, aligned_size, alignment,
+            &local_padding) == FT_FALSE)
+        return (nullptr);
+    *padding = local_padding;
+    return (block);
 }
 
 static void    *aligned_alloc_offswitch(ft_size_t alignment, ft_size_t request_size,
@@ -191,6 +181,9 @@ void    *cma_aligned_alloc(ft_size_t alignment, ft_size_t size)
         backend_limit_check_size = alignment;
     if (g_cma_alloc_limit != 0 && backend_limit_check_size > g_cma_alloc_limit)
         return (nullptr);
+    void *scoped_pointer = cma_arena_scope_allocate(alignment, request_size);
+    if (scoped_pointer != nullptr)
+        return (scoped_pointer);
     if (cma_backend_is_enabled())
         return (cma_backend_aligned_allocate(alignment,
                 backend_aligned_size, nullptr));
@@ -27,6 +27,11 @@ int32_t cma_checked_block_size(const void *memory_pointer, ft_size_t *block_size
     *block_size = 0;
     if (memory_pointer == nullptr)
         return (FT_ERR_INVALID_ARGUMENT);
+    if (cma_arena_scope_owns_pointer(memory_pointer) == FT_TRUE)
+    {
+        *block_size = cma_arena_scope_block_size(memory_pointer);
+        return (FT_ERR_SUCCESS);
+    }
     if (cma_backend_is_enabled() && cma_backend_owns_pointer(memory_pointer))
         return (cma_backend_checked_block_size(memory_pointer, block_size));
     ft_bool lock_acquired = FT_FALSE;
@@ -1,23 +1,28 @@
+#include "CMA.hpp"
 #include "cma_internal.hpp"
 #include "../Basic/basic.hpp"
 #include "../Basic/limits.hpp"
 
 #include "../Errno/errno.hpp"
+#include <atomic>
 #include <cstdlib>
 
 #define CMA_ARENA_ALLOCATION_MAGIC 0xA4E4A4E4U
+#define CMA_ARENA_CACHED_MAGIC 0xC4C4A4E4U
 #define CMA_SMALL_ARENA_CAPACITY 8388608
 #define CMA_SMALL_ARENA_MAX_ALLOCATION 256
 
 struct cma_arena_allocation_header
 {
-    uint32_t    magic;
-    ft_size_t   size;
+    std::atomic<uint32_t>   magic;
+    ft_size_t               size;
 };
 
 static cma_arena g_cma_small_arena = {nullptr, 0, 0, FT_FALSE,
     FT_CLASS_STATE_UNINITIALISED};
 static ft_size_t g_cma_small_arena_live_count = 0;
+static std::atomic<uint8_t *> g_cma_small_arena_buffer(nullptr);
+static thread_local cma_arena *g_cma_scoped_arena = nullptr;
 
 static ft_size_t cma_arena_align(ft_size_t value, ft_size_t alignment)
 {
@@ -79,7 +84,7 @@ static int32_t cma_arena_initialize(cma_arena *arena, ft_size_t capacity)
     return (FT_ERR_SUCCESS);
 }
 
-static int32_t cma_arena_reset(cma_arena *arena)
+int32_t cma_arena_reset(cma_arena *arena)
 {
     if (cma_arena_is_initialised(arena) == FT_FALSE)
         return (FT_ERR_NOT_INITIALISED);
@@ -118,7 +123,7 @@ static ft_bool cma_arena_owns_allocation(const void *memory_pointer,
     header = cma_arena_header_from_pointer(memory_pointer);
     if (reinterpret_cast<uint8_t *>(header) < arena->buffer)
         return (FT_FALSE);
-    if (header->magic != CMA_ARENA_ALLOCATION_MAGIC)
+    if (header->magic.load(std::memory_order_relaxed) != CMA_ARENA_ALLOCATION_MAGIC)
         return (FT_FALSE);
     return (FT_TRUE);
 }
@@ -174,7 +179,7 @@ static void *cma_arena_allocate_aligned(ft_size_t alignment, ft_size_t size,
         return (nullptr);
     header = reinterpret_cast<cma_arena_allocation_header *>(
             arena->buffer + header_offset);
-    header->magic = CMA_ARENA_ALLOCATION_MAGIC;
+    header->magic.store(CMA_ARENA_ALLOCATION_MAGIC, std::memory_order_relaxed);
     header->size = size;
     arena->offset = required_offset;
     return (arena->buffer + payload_offset);
@@ -185,12 +190,12 @@ static void *cma_arena_allocate(ft_size_t size, void *user_data)
     return (cma_arena_allocate_aligned(16, size, user_data));
 }
 
-static void *cma_arena_alloc(cma_arena *arena, ft_size_t size)
+void *cma_arena_alloc(cma_arena *arena, ft_size_t size)
 {
     return (cma_arena_allocate(size, arena));
 }
 
-static void *cma_arena_aligned_alloc(cma_arena *arena, ft_size_t alignment,
+void *cma_arena_aligned_alloc(cma_arena *arena, ft_size_t alignment,
         ft_size_t size)
 {
     return (cma_arena_allocate_aligned(alignment, size, arena));
@@ -204,8 +209,8 @@ static void cma_arena_deallocate(void *memory_pointer, void *user_data)
     header = cma_arena_header_from_pointer(memory_pointer);
     if (header == nullptr)
         return ;
-    if (header->magic == CMA_ARENA_ALLOCATION_MAGIC)
-        header->magic = 0;
+    if (header->magic.load(std::memory_order_relaxed) == CMA_ARENA_ALLOCATION_MAGIC)
+        header->magic.store(0, std::memory_order_relaxed);
     return ;
 }
 
@@ -269,10 +274,13 @@ static ft_bool cma_small_arena_has_live_allocations(void)
         ft_size_t payload_size;
         ft_size_t payload_offset;
         ft_size_t allocation_end_offset;
+        uint32_t header_magic;
 
         header = reinterpret_cast<const cma_arena_allocation_header *>(
                 buffer_pointer + scan_offset);
-        if (header->magic == CMA_ARENA_ALLOCATION_MAGIC)
+        header_magic = header->magic.load(std::memory_order_relaxed);
+        if (header_magic == CMA_ARENA_ALLOCATION_MAGIC
+            || header_magic == CMA_ARENA_CACHED_MAGIC)
         {
             payload_size = header->size;
             payload_offset = scan_offset + sizeof(cma_arena_allocation_header);
@@ -299,6 +307,7 @@ void cma_small_arena_reset_for_tests(void)
     }
     if (g_cma_small_arena_live_count != 0)
         return ;
+    g_cma_small_arena_buffer.store(nullptr, std::memory_order_release);
     std::free(g_cma_small_arena.buffer);
     g_cma_small_arena.buffer = nullptr;
     g_cma_small_arena.capacity = 0;
@@ -320,6 +329,8 @@ static ft_bool cma_small_arena_prepare_locked(void)
     if (error_code != FT_ERR_SUCCESS)
         return (FT_FALSE);
     g_cma_small_arena_live_count = 0;
+    g_cma_small_arena_buffer.store(g_cma_small_arena.buffer,
+        std::memory_order_release);
     return (FT_TRUE);
 }
 
@@ -439,3 +450,202 @@ void *cma_small_arena_reallocate_locked(void *memory_pointer, ft_size_t size)
         return (nullptr);
     return (new_pointer);
 }
+
+void *cma_small_arena_allocate_cached_locked(ft_size_t size)
+{
+    void *memory_pointer;
+
+    memory_pointer = cma_small_arena_allocate_locked(size);
+    if (memory_pointer == nullptr)
+        return (nullptr);
+    cma_arena_header_from_pointer(memory_pointer)->magic.store(
+        CMA_ARENA_CACHED_MAGIC, std::memory_order_relaxed);
+    return (memory_pointer);
+}
+
+void cma_small_arena_release_cached_locked(void *memory_pointer)
+{
+    cma_arena_allocation_header *header;
+
+    header = cma_arena_header_from_pointer(memory_pointer);
+    if (header == nullptr
+        || header->magic.load(std::memory_order_relaxed) != CMA_ARENA_CACHED_MAGIC)
+        return ;
+    header->magic.store(0, std::memory_order_relaxed);
+    if (g_cma_small_arena_live_count > 0)
+        g_cma_small_arena_live_count--;
+    if (g_cma_small_arena_live_count == 0)
+        (void)cma_arena_reset(&g_cma_small_arena);
+    return ;
+}
+
+ft_size_t cma_small_arena_claim_cached(void *memory_pointer)
+{
+    cma_arena_allocation_header *header;
+
+    header = cma_arena_header_from_pointer(memory_pointer);
+    header->magic.store(CMA_ARENA_ALLOCATION_MAGIC, std::memory_order_relaxed);
+    return (header->size);
+}
+
+// Runs without the allocator lock, so it only reads the published buffer
+// address and flips the header magic with a compare-and-swap.
+ft_size_t cma_small_arena_return_to_cache(void *memory_pointer)
+{
+    cma_arena_allocation_header *header;
+    const uint8_t *buffer;
+    const uint8_t *byte_pointer;
+    uint32_t expected_magic;
+
+    buffer = g_cma_small_arena_buffer.load(std::memory_order_acquire);
+    byte_pointer = static_cast<const uint8_t *>(memory_pointer);
+    if (buffer == nullptr
+        || byte_pointer < buffer + sizeof(cma_arena_allocation_header)
+        || byte_pointer >= buffer + CMA_SMALL_ARENA_CAPACITY)
+        return (0);
+    header = cma_arena_header_from_pointer(memory_pointer);
+    expected_magic = CMA_ARENA_ALLOCATION_MAGIC;
+    if (header->magic.compare_exchange_strong(expected_magic,
+            CMA_ARENA_CACHED_MAGIC, std::memory_order_acq_rel,
+            std::memory_order_relaxed) == false)
+        return (0);
+    return (header->size);
+}
+
+int32_t cma_arena_create(ft_size_t capacity, cma_arena **out_arena)
+{
+    cma_arena *arena;
+    int32_t error_code;
+
+    if (out_arena == nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    *out_arena = nullptr;
+    if (capacity == 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+    arena = static_cast<cma_arena *>(std::malloc(sizeof(cma_arena)));
+    if (arena == nullptr)
+        return (FT_ERR_NO_MEMORY);
+    cma_arena_zero(arena);
+    error_code = cma_arena_initialize(arena, align16(capacity));
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        std::free(arena);
+        return (error_code);
+    }
+    *out_arena = arena;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t cma_arena_destroy(cma_arena *arena)
+{
+    if (arena == nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (g_cma_scoped_arena == arena)
+        return (FT_ERR_INVALID_STATE);
+    if (arena->owns_buffer == FT_TRUE)
+        std::free(arena->buffer);
+    cma_arena_zero(arena);
+    arena->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    std::free(arena);
+    return (FT_ERR_SUCCESS);
+}
+
+ft_size_t cma_arena_mark(const cma_arena *arena)
+{
+    if (cma_arena_is_initialised(arena) == FT_FALSE)
+        return (0);
+    return (arena->offset);
+}
+
+int32_t cma_arena_rewind(cma_arena *arena, ft_size_t mark)
+{
+    if (cma_arena_is_initialised(arena) == FT_FALSE)
+        return (FT_ERR_NOT_INITIALISED);
+    if (mark > arena->offset)
+        return (FT_ERR_INVALID_ARGUMENT);
+    arena->offset = mark;
+    return (FT_ERR_SUCCESS);
+}
+
+ft_size_t cma_arena_capacity(const cma_arena *arena)
+{
+    if (cma_arena_is_initialised(arena) == FT_FALSE)
+        return (0);
+    return (arena->capacity);
+}
+
+cma_arena *cma_arena_exchange_thread_scope(cma_arena *arena)
+{
+    cma_arena *previous_arena;
+
+    previous_arena = g_cma_scoped_arena;
+    g_cma_scoped_arena = arena;
+    return (previous_arena);
+}
+
+cma_arena *cma_arena_thread_scope(void)
+{
+    return (g_cma_scoped_arena);
+}
+
+ft_bool cma_arena_scope_owns_pointer(const void *memory_pointer)
+{
+    const uint8_t *byte_pointer;
+
+    if (g_cma_scoped_arena == nullptr)
+        return (FT_FALSE);
+    if (cma_arena_owns_allocation(memory_pointer, g_cma_scoped_arena)
+        == FT_FALSE)
+        return (FT_FALSE);
+    byte_pointer = static_cast<const uint8_t *>(memory_pointer);
+    if (byte_pointer >= g_cma_scoped_arena->buffer + g_cma_scoped_arena->offset)
+        return (FT_FALSE);
+    return (FT_TRUE);
+}
+
+void *cma_arena_scope_allocate(ft_size_t alignment, ft_size_t size)
+{
+    if (g_cma_scoped_arena == nullptr)
+        return (nullptr);
+    return (cma_arena_allocate_aligned(alignment, size, g_cma_scoped_arena));
+}
+
+ft_size_t cma_arena_scope_block_size(const void *memory_pointer)
+{
+    if (cma_arena_scope_owns_pointer(memory_pointer) == FT_FALSE)
+        return (0);
+    return (cma_arena_header_from_pointer(memory_pointer)->size);
+}
+
+void *cma_arena_scope_reallocate(void *memory_pointer, ft_size_t size)
+{
+    cma_arena_allocation_header *header;
+    uint8_t *payload;
+    void *new_pointer;
+    ft_size_t copy_size;
+
+    if (cma_arena_scope_owns_pointer(memory_pointer) == FT_FALSE)
+        return (nullptr);
+    if (size == 0)
+        size = 1;
+    header = cma_arena_header_from_pointer(memory_pointer);
+    payload = static_cast<uint8_t *>(memory_pointer);
+    if (payload + header->size
+            == g_cma_scoped_arena->buffer + g_cma_scoped_arena->offset
+        && size <= g_cma_scoped_arena->capacity
+            - static_cast<ft_size_t>(payload - g_cma_scoped_arena->buffer))
+    {
+        header->size = size;
+        g_cma_scoped_arena->offset = static_cast<ft_size_t>(
+                payload - g_cma_scoped_arena->buffer) + size;
+        return (memory_pointer);
+    }
+    new_pointer = cma_arena_alloc(g_cma_scoped_arena, size);
+    if (new_pointer == nullptr)
+        return (nullptr);
+    copy_size = header->size;
+    if (copy_size > size)
+        copy_size = size;
+    ft_memcpy(new_pointer, memory_pointer, copy_size);
+    return (new_pointer);
+}
@@ -0,0 +1,38 @@
+#include "cma_arena_scope.hpp"
+#include "../Basic/class_nullptr.hpp"
+
+ft_arena_scope::ft_arena_scope(cma_arena *arena) noexcept
+    : _arena(arena), _previous_arena(ft_nullptr), _active(FT_FALSE)
+{
+    if (arena == ft_nullptr)
+        return ;
+    this->_previous_arena = cma_arena_exchange_thread_scope(arena);
+    this->_active = FT_TRUE;
+    return ;
+}
+
+ft_arena_scope::~ft_arena_scope()
+{
+    this->release();
+    return ;
+}
+
+void ft_arena_scope::release() noexcept
+{
+    if (this->_active == FT_FALSE)
+        return ;
+    (void)cma_arena_exchange_thread_scope(this->_previous_arena);
+    this->_previous_arena = ft_nullptr;
+    this->_active = FT_FALSE;
+    return ;
+}
+
+ft_bool ft_arena_scope::is_active() const noexcept
+{
+    return (this->_active);
+}
+
+cma_arena *ft_arena_scope::arena() const noexcept
+{
+    return (this->_arena);
+}
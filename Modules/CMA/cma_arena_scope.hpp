@@ -0,0 +1,27 @@
+#ifndef CMA_ARENA_SCOPE_HPP
+# define CMA_ARENA_SCOPE_HPP
+
+#include "CMA.hpp"
+
+class ft_arena_scope
+{
+    private:
+        cma_arena   *_arena;
+        cma_arena   *_previous_arena;
+        ft_bool     _active;
+
+    public:
+        explicit ft_arena_scope(cma_arena *arena) noexcept;
+        ~ft_arena_scope();
+
+        ft_arena_scope(const ft_arena_scope &) = delete;
+        ft_arena_scope &operator=(const ft_arena_scope &) = delete;
+        ft_arena_scope(ft_arena_scope &&) = delete;
+        ft_arena_scope &operator=(ft_arena_scope &&) = delete;
+
+        void        release() noexcept;
+        ft_bool     is_active() const noexcept;
+        cma_arena   *arena() const noexcept;
+};
+
+#endif
@@ -0,0 +1,148 @@
+#include <cstdint>
+#include <cstdlib>
+#include "cma_internal.hpp"
+#include "../Errno/errno.hpp"
+
+struct cma_block_index_slot
+{
+    uintptr_t   key;
+    Block       *block;
+};
+
+static cma_block_index_slot *g_cma_block_index_slots = nullptr;
+static ft_size_t    g_cma_block_index_capacity = 0;
+static ft_size_t    g_cma_block_index_count = 0;
+static uint32_t     g_cma_block_index_shift = 64;
+
+static ft_size_t cma_block_index_slot_for_key(uintptr_t key)
+{
+    uint64_t hash_value;
+
+    hash_value = (key >> 4) * 0x9E3779B97F4A7C15ULL;
+    return (hash_value >> g_cma_block_index_shift);
+}
+
+static void cma_block_index_place(cma_block_index_slot *slots,
+        ft_size_t capacity, uintptr_t key, Block *block)
+{
+    ft_size_t slot_index;
+
+    slot_index = cma_block_index_slot_for_key(key);
+    while (slots[slot_index].key != 0)
+        slot_index = (slot_index + 1) & (capacity - 1);
+    slots[slot_index].key = key;
+    slots[slot_index].block = block;
+    return ;
+}
+
+static int32_t cma_block_index_grow(void)
+{
+    cma_block_index_slot *new_slots;
+    cma_block_index_slot *old_slots;
+    ft_size_t new_capacity;
+    ft_size_t old_capacity;
+    ft_size_t slot_index;
+    uint32_t new_shift;
+
+    old_slots = g_cma_block_index_slots;
+    old_capacity = g_cma_block_index_capacity;
+    if (old_capacity == 0)
+        new_capacity = CMA_BLOCK_INDEX_MINIMUM_CAPACITY;
+    else
+        new_capacity = old_capacity * 2;
+    new_slots = static_cast<cma_block_index_slot *>(std::calloc(new_capacity,
+            sizeof(cma_block_index_slot)));
+    if (new_slots == nullptr)
+        return (FT_ERR_NO_MEMORY);
+    new_shift = static_cast<uint32_t>(64 - __builtin_ctzll(new_capacity));
+    g_cma_block_index_slots = new_slots;
+    g_cma_block_index_capacity = new_capacity;
+    g_cma_block_index_shift = new_shift;
+    slot_index = 0;
+    while (slot_index < old_capacity)
+    {
+        if (old_slots[slot_index].key != 0)
+            cma_block_index_place(new_slots, new_capacity,
+                old_slots[slot_index].key, old_slots[slot_index].block);
+        slot_index++;
+    }
+    std::free(old_slots);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t cma_block_index_insert(Block *block)
+{
+    int32_t error_code;
+
+    if (block == nullptr || block->payload == nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if ((g_cma_block_index_count + 1) * 2 > g_cma_block_index_capacity)
+    {
+        error_code = cma_block_index_grow();
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+    }
+    cma_block_index_place(g_cma_block_index_slots, g_cma_block_index_capacity,
+        reinterpret_cast<uintptr_t>(block->payload), block);
+    g_cma_block_index_count++;
+    return (FT_ERR_SUCCESS);
+}
+
+void cma_block_index_remove(Block *block)
+{
+    uintptr_t key;
+    ft_size_t slot_index;
+    ft_size_t next_index;
+    ft_size_t mask;
+
+    if (block == nullptr || block->payload == nullptr
+        || g_cma_block_index_capacity == 0)
+        return ;
+    key = reinterpret_cast<uintptr_t>(block->payload);
+    mask = g_cma_block_index_capacity - 1;
+    slot_index = cma_block_index_slot_for_key(key);
+    while (g_cma_block_index_slots[slot_index].key != key)
+    {
+        if (g_cma_block_index_slots[slot_index].key == 0)
+            return ;
+        slot_index = (slot_index + 1) & mask;
+    }
+    next_index = (slot_index + 1) & mask;
+    while (g_cma_block_index_slots[next_index].key != 0)
+    {
+        ft_size_t home_index;
+
+        home_index = cma_block_index_slot_for_key(
+                g_cma_block_index_slots[next_index].key);
+        if (((next_index - home_index) & mask) >= ((next_index - slot_index) & mask))
+        {
+            g_cma_block_index_slots[slot_index] = g_cma_block_index_slots[next_index];
+            slot_index = next_index;
+        }
+        next_index = (next_index + 1) & mask;
+    }
+    g_cma_block_index_slots[slot_index].key = 0;
+    g_cma_block_index_slots[slot_index].block = nullptr;
+    g_cma_block_index_count--;
+    return ;
+}
+
+Block *cma_block_index_find(const void *payload)
+{
+    uintptr_t key;
+    ft_size_t slot_index;
+    ft_size_t mask;
+
+    if (payload == nullptr || g_cma_block_index_capacity == 0)
+        return (nullptr);
+    key = reinterpret_cast<uintptr_t>(payload);
+    mask = g_cma_block_index_capacity - 1;
+    slot_index = cma_block_index_slot_for_key(key);
+    while (g_cma_block_index_slots[slot_index].key != 0)
+    {
+        if (g_cma_block_index_slots[slot_index].key == key)
+            return (g_cma_block_index_slots[slot_index].block);
+        slot_index = (slot_index + 1) & mask;
+    }
+    return (nullptr);
+}
@@ -38,6 +38,12 @@ void cma_bzero_and_free(void* memory_pointer)
         cma_record_allocation_log("cma_bzero_and_free %p", memory_pointer);
         return ;
     }
+    if (cma_arena_scope_owns_pointer(memory_pointer) == FT_TRUE)
+    {
+        cma_secure_bzero(memory_pointer,
+            cma_arena_scope_block_size(memory_pointer));
+        return ;
+    }
     if (cma_backend_is_enabled() && cma_backend_owns_pointer(memory_pointer))
     {
         ft_size_t allocation_size = 0;
@@ -24,11 +24,18 @@ void cma_free(void* memory_pointer)
     }
     if (!memory_pointer)
         return ;
+    if (cma_arena_scope_owns_pointer(memory_pointer) == FT_TRUE)
+        return ;
     if (cma_backend_is_enabled() && cma_backend_owns_pointer(memory_pointer))
     {
         cma_backend_deallocate(memory_pointer);
         return ;
     }
+    if (cma_thread_cache_deallocate(memory_pointer) == FT_TRUE)
+    {
+        cma_record_allocation_log("cma_free %p", memory_pointer);
+        return ;
+    }
     if (cma_lock_allocator(&lock_acquired) != FT_ERR_SUCCESS)
         return ;
     if (cma_small_arena_owns_pointer_locked(memory_pointer) == FT_TRUE)
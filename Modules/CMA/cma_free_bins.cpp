@@ -0,0 +1,174 @@
+#include <cstdint>
+#include "cma_internal.hpp"
+#include "../Basic/limits.hpp"
+#include "../System_utils/system_utils.hpp"
+
+static Block    *g_cma_free_bins[CMA_ALLOC_SIZE_TYPE_COUNT][CMA_BIN_COUNT] = {};
+static uint64_t g_cma_free_bin_first_level_map[CMA_ALLOC_SIZE_TYPE_COUNT] = {};
+static uint32_t g_cma_free_bin_second_level_map[CMA_ALLOC_SIZE_TYPE_COUNT]
+    [CMA_BIN_FIRST_LEVEL_COUNT] = {};
+
+static uint32_t cma_free_bins_most_significant_bit(ft_size_t value)
+{
+    return (static_cast<uint32_t>(63 - __builtin_clzll(value)));
+}
+
+static void cma_free_bins_map_size(ft_size_t size, uint32_t *first_level,
+        uint32_t *second_level)
+{
+    uint32_t most_significant_bit;
+
+    if (size < CMA_BIN_SECOND_LEVEL_COUNT)
+    {
+        *first_level = 0;
+        *second_level = static_cast<uint32_t>(size);
+        return ;
+    }
+    most_significant_bit = cma_free_bins_most_significant_bit(size);
+    *first_level = most_significant_bit;
+    *second_level = static_cast<uint32_t>(
+            (size >> (most_significant_bit - CMA_BIN_SECOND_LEVEL_SHIFT))
+            & (CMA_BIN_SECOND_LEVEL_COUNT - 1));
+    return ;
+}
+
+static ft_size_t cma_free_bins_round_search_size(ft_size_t size)
+{
+    uint32_t most_significant_bit;
+    ft_size_t round_amount;
+
+    if (size < CMA_BIN_SECOND_LEVEL_COUNT)
+        return (size);
+    most_significant_bit = cma_free_bins_most_significant_bit(size);
+    round_amount = (static_cast<ft_size_t>(1)
+            << (most_significant_bit - CMA_BIN_SECOND_LEVEL_SHIFT)) - 1;
+    if (size > FT_SYSTEM_SIZE_MAX - round_amount)
+        return (size);
+    return (size + round_amount);
+}
+
+static int8_t cma_free_bins_block_type(const Block *block)
+{
+    int8_t alloc_size_type;
+
+    if (block->page == nullptr)
+        return (0);
+    alloc_size_type = block->page->alloc_size_type;
+    if (alloc_size_type < 0 || alloc_size_type >= CMA_ALLOC_SIZE_TYPE_COUNT)
+        return (0);
+    return (alloc_size_type);
+}
+
+void cma_free_bins_insert(Block *block)
+{
+    uint32_t first_level;
+    uint32_t second_level;
+    uint32_t bin_index;
+    int8_t alloc_size_type;
+    Block *head;
+
+    if (block == nullptr || block->binned == FT_TRUE)
+        return ;
+    cma_free_bins_map_size(block->size, &first_level, &second_level);
+    bin_index = first_level * CMA_BIN_SECOND_LEVEL_COUNT + second_level;
+    alloc_size_type = cma_free_bins_block_type(block);
+    head = g_cma_free_bins[alloc_size_type][bin_index];
+    block->bin_prev = nullptr;
+    block->bin_next = head;
+    if (head != nullptr)
+        head->bin_prev = block;
+    g_cma_free_bins[alloc_size_type][bin_index] = block;
+    g_cma_free_bin_first_level_map[alloc_size_type]
+        |= (static_cast<uint64_t>(1) << first_level);
+    g_cma_free_bin_second_level_map[alloc_size_type][first_level]
+        |= (static_cast<uint32_t>(1) << second_level);
+    block->bin_index = static_cast<uint16_t>(bin_index);
+    block->binned = FT_TRUE;
+    return ;
+}
+
+void cma_free_bins_remove(Block *block)
+{
+    uint32_t bin_index;
+    uint32_t first_level;
+    uint32_t second_level;
+    int8_t alloc_size_type;
+
+    if (block == nullptr || block->binned == FT_FALSE)
+        return ;
+    bin_index = block->bin_index;
+    alloc_size_type = cma_free_bins_block_type(block);
+    if (block->bin_prev != nullptr)
+        block->bin_prev->bin_next = block->bin_next;
+    else
+    {
+        if (g_cma_free_bins[alloc_size_type][bin_index] != block)
+            su_sigabrt();
+        g_cma_free_bins[alloc_size_type][bin_index] = block->bin_next;
+    }
+    if (block->bin_next != nullptr)
+        block->bin_next->bin_prev = block->bin_prev;
+    if (g_cma_free_bins[alloc_size_type][bin_index] == nullptr)
+    {
+        first_level = bin_index / CMA_BIN_SECOND_LEVEL_COUNT;
+        second_level = bin_index % CMA_BIN_SECOND_LEVEL_COUNT;
+        g_cma_free_bin_second_level_map[alloc_size_type][first_level]
+            &= ~(static_cast<uint32_t>(1) << second_level);
+        if (g_cma_free_bin_second_level_map[alloc_size_type][first_level] == 0)
+            g_cma_free_bin_first_level_map[alloc_size_type]
+                &= ~(static_cast<uint64_t>(1) << first_level);
+    }
+    block->bin_next = nullptr;
+    block->bin_prev = nullptr;
+    block->bin_index = 0;
+    block->binned = FT_FALSE;
+    return ;
+}
+
+static Block *cma_free_bins_find_guaranteed(ft_size_t size,
+        int8_t alloc_size_type)
+{
+    uint32_t first_level;
+    uint32_t second_level;
+    uint32_t second_level_map;
+    uint64_t first_level_map;
+
+    cma_free_bins_map_size(cma_free_bins_round_search_size(size),
+        &first_level, &second_level);
+    second_level_map = g_cma_free_bin_second_level_map[alloc_size_type]
+        [first_level] & (~static_cast<uint32_t>(0) << second_level);
+    if (second_level_map == 0)
+    {
+        if (first_level + 1 >= CMA_BIN_FIRST_LEVEL_COUNT)
+            return (nullptr);
+        first_level_map = g_cma_free_bin_first_level_map[alloc_size_type]
+            & (~static_cast<uint64_t>(0) << (first_level + 1));
+        if (first_level_map == 0)
+            return (nullptr);
+        first_level = static_cast<uint32_t>(__builtin_ctzll(first_level_map));
+        second_level_map = g_cma_free_bin_second_level_map[alloc_size_type]
+            [first_level];
+    }
+    second_level = static_cast<uint32_t>(__builtin_ctz(second_level_map));
+    return (g_cma_free_bins[alloc_size_type]
+        [first_level * CMA_BIN_SECOND_LEVEL_COUNT + second_level]);
+}
+
+Block *cma_free_bins_find(ft_size_t size, int8_t alloc_size_type)
+{
+    uint32_t first_level;
+    uint32_t second_level;
+    Block *block;
+
+    if (alloc_size_type < 0 || alloc_size_type >= CMA_ALLOC_SIZE_TYPE_COUNT)
+        return (nullptr);
+    block = cma_free_bins_find_guaranteed(size, alloc_size_type);
+    if (block != nullptr)
+        return (block);
+    cma_free_bins_map_size(size, &first_level, &second_level);
+    block = g_cma_free_bins[alloc_size_type]
+        [first_level * CMA_BIN_SECOND_LEVEL_COUNT + second_level];
+    if (block != nullptr && block->size >= size)
+        return (block);
+    return (nullptr);
+}
@@ -14,6 +14,8 @@ int32_t cma_checked_free(void* memory_pointer)
     }
     if (!memory_pointer)
         return (FT_ERR_SUCCESS);
+    if (cma_arena_scope_owns_pointer(memory_pointer) == FT_TRUE)
+        return (FT_ERR_SUCCESS);
     ft_bool lock_acquired = FT_FALSE;
     int32_t lock_error = cma_lock_allocator(&lock_acquired);
 
@@ -7,4 +7,7 @@ ft_size_t    g_cma_allocation_count = 0;
 ft_size_t    g_cma_free_count = 0;
 ft_size_t    g_cma_current_bytes = 0;
 ft_size_t    g_cma_peak_bytes = 0;
+std::atomic<bool>    g_cma_thread_cache_enabled(true);
+ft_size_t    g_cma_huge_allocation_count = 0;
+ft_size_t    g_cma_huge_mapped_bytes = 0;
 int64_t    g_cma_metadata_access_depth = 0;
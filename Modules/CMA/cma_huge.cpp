@@ -0,0 +1,166 @@
+#include <cstdlib>
+#include <cstring>
+#include "CMA.hpp"
+#include "cma_internal.hpp"
+#include "../Compatebility/compatebility_cma_platform.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno.hpp"
+#include "../System_utils/system_utils.hpp"
+
+static ft_size_t g_cma_huge_threshold = CMA_HUGE_DEFAULT_THRESHOLD;
+static ft_size_t g_cma_huge_os_page_size = 0;
+
+static ft_size_t cma_huge_mapping_size(ft_size_t size)
+{
+    ft_size_t remainder;
+
+    if (g_cma_huge_os_page_size == 0
+        && cmp_cma_get_page_size(&g_cma_huge_os_page_size) != FT_ERR_SUCCESS)
+        return (0);
+    remainder = size % g_cma_huge_os_page_size;
+    if (remainder == 0)
+        return (size);
+    if (size > FT_SYSTEM_SIZE_MAX - (g_cma_huge_os_page_size - remainder))
+        return (0);
+    return (size + (g_cma_huge_os_page_size - remainder));
+}
+
+ft_bool cma_huge_size_is_eligible(ft_size_t size)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    (void)size;
+    return (FT_FALSE);
+#else
+    if (g_cma_huge_threshold == 0 || size < g_cma_huge_threshold)
+        return (FT_FALSE);
+    return (FT_TRUE);
+#endif
+}
+
+Page *cma_huge_create_page(ft_size_t size)
+{
+    ft_size_t mapping_size;
+    void *memory_pointer;
+    Page *page;
+
+    mapping_size = cma_huge_mapping_size(size);
+    if (mapping_size == 0)
+        return (nullptr);
+    memory_pointer = cmp_cma_memory_map_read_write(mapping_size);
+    if (memory_pointer == nullptr)
+        return (nullptr);
+    page = static_cast<Page *>(std::malloc(sizeof(Page)));
+    if (page == nullptr)
+    {
+        (void)cmp_cma_memory_unmap(memory_pointer, mapping_size);
+        return (nullptr);
+    }
+    std::memset(page, 0, sizeof(Page));
+    page->heap = FT_TRUE;
+    page->mapped = FT_TRUE;
+    page->alloc_size_type = 2;
+    page->start = memory_pointer;
+    page->size = mapping_size;
+    page->blocks = cma_metadata_allocate_block();
+    if (page->blocks == nullptr)
+    {
+        (void)cmp_cma_memory_unmap(memory_pointer, mapping_size);
+        std::free(page);
+        return (nullptr);
+    }
+    page->blocks->size = size;
+    page->blocks->payload = static_cast<unsigned char *>(memory_pointer);
+    page->blocks->page = page;
+    if (cma_block_index_insert(page->blocks) != FT_ERR_SUCCESS)
+    {
+        cma_metadata_release_block(page->blocks);
+        (void)cmp_cma_memory_unmap(memory_pointer, mapping_size);
+        std::free(page);
+        return (nullptr);
+    }
+    cma_debug_initialize_block(page->blocks);
+    cma_mark_block_free(page->blocks);
+    page->blocks->next = nullptr;
+    page->blocks->prev = nullptr;
+    page->next = page_list;
+    if (page_list != nullptr)
+        page_list->prev = page;
+    page_list = page;
+    g_cma_huge_allocation_count++;
+    g_cma_huge_mapped_bytes += mapping_size;
+    return (page);
+}
+
+void cma_huge_release_page(Page *page)
+{
+    if (page == nullptr || page->mapped == FT_FALSE)
+        return ;
+    if (g_cma_huge_allocation_count > 0)
+        g_cma_huge_allocation_count--;
+    if (g_cma_huge_mapped_bytes >= page->size)
+        g_cma_huge_mapped_bytes -= page->size;
+    else
+        g_cma_huge_mapped_bytes = 0;
+    (void)cmp_cma_memory_unmap(page->start, page->size);
+    page->start = nullptr;
+    page->size = 0;
+    return ;
+}
+
+ft_bool cma_huge_resize_block(Block *block, ft_size_t size)
+{
+    Page *page;
+    ft_size_t mapping_size;
+    void *new_start;
+
+    if (block == nullptr || block->page == nullptr
+        || block->page->mapped == FT_FALSE
+        || block->page->blocks != block
+        || block->next != nullptr || block->prev != nullptr)
+        return (FT_FALSE);
+    page = block->page;
+    mapping_size = cma_huge_mapping_size(size);
+    if (mapping_size == 0)
+        return (FT_FALSE);
+    if (mapping_size != page->size)
+    {
+        if (cmp_cma_memory_remap(page->start, page->size, mapping_size,
+                &new_start) != FT_ERR_SUCCESS)
+        {
+            if (mapping_size > page->size)
+                return (FT_FALSE);
+            mapping_size = page->size;
+            new_start = page->start;
+        }
+        if (new_start != page->start)
+        {
+            cma_block_index_remove(block);
+            block->payload = static_cast<unsigned char *>(new_start);
+            page->start = new_start;
+            if (cma_block_index_insert(block) != FT_ERR_SUCCESS)
+                su_sigabrt();
+        }
+        g_cma_huge_mapped_bytes -= page->size;
+        g_cma_huge_mapped_bytes += mapping_size;
+        page->size = mapping_size;
+    }
+    block->size = size;
+    return (FT_TRUE);
+}
+
+int32_t cma_set_huge_threshold(ft_size_t threshold)
+{
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = cma_lock_allocator(&lock_acquired);
+
+    if (lock_error != FT_ERR_SUCCESS)
+        return (lock_error);
+    g_cma_huge_threshold = threshold;
+    cma_unlock_allocator(lock_acquired);
+    return (FT_ERR_SUCCESS);
+}
+
+ft_size_t cma_get_huge_threshold(void)
+{
+    return (g_cma_huge_threshold);
+}
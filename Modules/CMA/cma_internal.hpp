@@ -8,6 +8,7 @@
 #include "../Basic/basic.hpp"
 
 #include "../Compatebility/compatebility_stack_trace.hpp"
+#include <atomic>
 #include <cstdint>
 #include <stdint.h>
 
@@ -27,6 +28,17 @@
 #define SMALL_ALLOC (BASE_SIZE * 1)
 #define MEDIUM_ALLOC (BASE_SIZE * 10)
 
+#define CMA_ALLOC_SIZE_TYPE_COUNT 3
+#define CMA_BIN_FIRST_LEVEL_COUNT 64
+#define CMA_BIN_SECOND_LEVEL_SHIFT 2
+#define CMA_BIN_SECOND_LEVEL_COUNT (1 << CMA_BIN_SECOND_LEVEL_SHIFT)
+#define CMA_BIN_COUNT (CMA_BIN_FIRST_LEVEL_COUNT * CMA_BIN_SECOND_LEVEL_COUNT)
+#define CMA_BLOCK_INDEX_MINIMUM_CAPACITY 1024
+#define CMA_HUGE_DEFAULT_THRESHOLD 1048576
+#define CMA_THREAD_CACHE_CLASS_COUNT (CMA_SMALL_ARENA_MAX_ALLOCATION / 16)
+#define CMA_THREAD_CACHE_CAPACITY 32
+#define CMA_THREAD_CACHE_BATCH_SIZE 16
+
 #ifndef DEBUG
 # define DEBUG 0
 #endif
@@ -46,8 +58,12 @@ extern ft_size_t    g_cma_allocation_count;
 extern ft_size_t    g_cma_free_count;
 extern ft_size_t    g_cma_current_bytes;
 extern ft_size_t    g_cma_peak_bytes;
+extern std::atomic<bool>    g_cma_thread_cache_enabled;
+extern ft_size_t    g_cma_huge_allocation_count;
+extern ft_size_t    g_cma_huge_mapped_bytes;
 extern int64_t    g_cma_metadata_access_depth;
 
+struct Page;
 
 struct Block
 {
@@ -63,6 +79,11 @@ struct Block
     Block               *next;
     Block               *prev;
     unsigned char       *payload;
+    Page                *page;
+    Block               *bin_next;
+    Block               *bin_prev;
+    uint16_t            bin_index;
+    ft_bool             binned;
 #if DEBUG
     unsigned char       *debug_base_pointer;
     ft_size_t           debug_user_size;
@@ -77,6 +98,7 @@ struct Page
     Page                *prev;
     Block               *blocks;
     ft_bool                heap;
+    ft_bool                mapped;
     int8_t              alloc_size_type;
 } __attribute__ ((aligned(16)));
 
@@ -96,9 +118,21 @@ Page    *create_page(ft_size_t size);
 Block    *find_free_block(ft_size_t size);
 Block    *merge_block(Block *block);
 Page    *find_page_of_block(Block *block);
+ft_bool cma_huge_size_is_eligible(ft_size_t size);
+Page    *cma_huge_create_page(ft_size_t size);
+void    cma_huge_release_page(Page *page);
+ft_bool cma_huge_resize_block(Block *block, ft_size_t size);
 void    free_page_if_empty(Page *page);
 void    cma_validate_block(Block *block, const char *context, void *user_pointer);
 Block    *cma_find_block_for_pointer(const void *memory_pointer);
+void    cma_free_bins_insert(Block *block);
+void    cma_free_bins_remove(Block *block);
+Block    *cma_free_bins_find(ft_size_t size, int8_t alloc_size_type)
+            __attribute__ ((warn_unused_result, hot));
+int32_t cma_block_index_insert(Block *block) __attribute__ ((warn_unused_result));
+void    cma_block_index_remove(Block *block);
+Block    *cma_block_index_find(const void *payload)
+            __attribute__ ((warn_unused_result, hot));
 int32_t cma_lock_allocator(ft_bool *lock_acquired);
 int32_t cma_unlock_allocator(ft_bool lock_acquired);
 int32_t cma_enable_thread_safety(void);
@@ -138,6 +172,28 @@ int32_t cma_small_arena_deallocate_locked(void *memory_pointer)
 void    *cma_small_arena_reallocate_locked(void *memory_pointer,
             ft_size_t size) __attribute__ ((warn_unused_result, hot));
 void    cma_small_arena_reset_for_tests(void);
+void    *cma_small_arena_allocate_cached_locked(ft_size_t size)
+            __attribute__ ((warn_unused_result));
+void    cma_small_arena_release_cached_locked(void *memory_pointer);
+ft_size_t cma_small_arena_claim_cached(void *memory_pointer)
+            __attribute__ ((hot));
+ft_size_t cma_small_arena_return_to_cache(void *memory_pointer)
+            __attribute__ ((warn_unused_result, hot));
+ft_bool cma_arena_scope_owns_pointer(const void *memory_pointer)
+            __attribute__ ((warn_unused_result, hot));
+void    *cma_arena_scope_allocate(ft_size_t alignment, ft_size_t size)
+            __attribute__ ((warn_unused_result, hot));
+ft_size_t cma_arena_scope_block_size(const void *memory_pointer)
+            __attribute__ ((warn_unused_result));
+void    *cma_arena_scope_reallocate(void *memory_pointer, ft_size_t size)
+            __attribute__ ((warn_unused_result));
+void    *cma_thread_cache_allocate(ft_size_t size)
+            __attribute__ ((warn_unused_result, hot));
+ft_bool cma_thread_cache_deallocate(void *memory_pointer)
+            __attribute__ ((warn_unused_result, hot));
+void    cma_thread_cache_collect_stats_locked(ft_size_t *allocation_count,
+            ft_size_t *free_count, ft_size_t *current_bytes,
+            ft_size_t *peak_bytes);
 #ifndef CMA_ENABLE_METADATA_PROTECTION
 # define CMA_ENABLE_METADATA_PROTECTION 1
 #endif
@@ -256,6 +312,8 @@ inline __attribute__((always_inline, hot)) void cma_mark_block_allocated(Block *
 {
     if (!block)
         return ;
+    if (block->binned == FT_TRUE)
+        cma_free_bins_remove(block);
     block->free = FT_FALSE;
     block->magic = MAGIC_NUMBER_ALLOCATED;
     return ;
@@ -30,6 +30,9 @@ void* cma_malloc(ft_size_t size)
         size = 1;
     if (g_cma_alloc_limit != 0 && size > g_cma_alloc_limit)
         return (nullptr);
+    result = cma_arena_scope_allocate(16, size);
+    if (result != nullptr)
+        return (result);
     if (cma_backend_is_enabled())
         return (cma_backend_allocate(size, nullptr));
     if (OFFSWITCH == 1)
@@ -46,6 +49,13 @@ void* cma_malloc(ft_size_t size)
             static_cast<unsigned long long>(size), result);
         return (result);
     }
+    result = cma_thread_cache_allocate(size);
+    if (result != nullptr)
+    {
+        cma_record_allocation_log("cma_malloc %llu -> %p",
+            static_cast<unsigned long long>(size), result);
+        return (result);
+    }
     if (cma_lock_allocator(&lock_acquired) != FT_ERR_SUCCESS)
         return (nullptr);
     result = cma_small_arena_allocate_locked(size);
@@ -20,6 +20,7 @@ static cma_metadata_chunk    *g_cma_metadata_chunks = nullptr;
 static Block    *g_cma_metadata_free_list = nullptr;
 static ft_size_t    g_cma_metadata_stride = 0;
 static ft_size_t    g_cma_metadata_page_size = 0;
+static ft_size_t    g_cma_metadata_mapped_size = 0;
 
 static ft_bool cma_metadata_add_chunk(void);
 #if CMA_ENABLE_METADATA_PROTECTION
@@ -66,7 +67,10 @@ static ft_bool cma_metadata_add_chunk(void)
     chunk_stride_count = page_size / stride;
     if (chunk_stride_count == 0)
         chunk_stride_count = 1;
+    if (g_cma_metadata_mapped_size / stride > chunk_stride_count)
+        chunk_stride_count = g_cma_metadata_mapped_size / stride;
     chunk_size = chunk_stride_count * stride;
+    chunk_size = ((chunk_size + page_size - 1) / page_size) * page_size;
     chunk = static_cast<cma_metadata_chunk *>(std::malloc(sizeof(cma_metadata_chunk)));
     if (chunk == nullptr)
         return (FT_FALSE);
@@ -81,6 +85,7 @@ static ft_bool cma_metadata_add_chunk(void)
     chunk->used = 0;
     chunk->next = g_cma_metadata_chunks;
     g_cma_metadata_chunks = chunk;
+    g_cma_metadata_mapped_size += chunk_size;
     if (g_cma_metadata_access_depth == 0)
     {
         chunk->protected_state = FT_FALSE;
@@ -248,27 +253,18 @@ Block    *cma_metadata_allocate_block(void)
     }
     stride = cma_metadata_compute_stride();
     chunk = g_cma_metadata_chunks;
-    while (chunk)
+    if (chunk->used + stride > chunk->size)
     {
-        if (chunk->used + stride <= chunk->size)
-        {
-            block = reinterpret_cast<Block *>(chunk->memory + chunk->used);
-            chunk->used += stride;
-            std::memset(block, 0, sizeof(Block));
-            return (block);
-        }
-        if (chunk->next == nullptr)
-        {
-            if (!cma_metadata_add_chunk())
-            {
-                return (nullptr);
-            }
-            chunk = g_cma_metadata_chunks;
-            continue ;
-        }
-        chunk = chunk->next;
+        if (!cma_metadata_add_chunk())
+            return (nullptr);
+        chunk = g_cma_metadata_chunks;
+        if (chunk->used + stride > chunk->size)
+            return (nullptr);
     }
-    return (nullptr);
+    block = reinterpret_cast<Block *>(chunk->memory + chunk->used);
+    chunk->used += stride;
+    std::memset(block, 0, sizeof(Block));
+    return (block);
 }
 
 void    cma_metadata_release_block(Block *block)
@@ -313,5 +309,6 @@ void    cma_metadata_reset(void)
     g_cma_metadata_free_list = nullptr;
     g_cma_metadata_stride = 0;
     g_cma_metadata_page_size = 0;
+    g_cma_metadata_mapped_size = 0;
     return ;
 }
@@ -19,6 +19,12 @@ static ft_bool reallocate_block(void *memory_pointer, ft_size_t aligned_size, ft
     if (!block)
         return (FT_FALSE);
     cma_validate_block(block, "cma_realloc resize", memory_pointer);
+    if (block->page != nullptr && block->page->mapped == FT_TRUE
+        && cma_huge_resize_block(block, aligned_size) == FT_TRUE)
+    {
+        cma_debug_prepare_allocation(block, user_size);
+        return (FT_TRUE);
+    }
     if (block->size >= aligned_size)
     {
         split_block(block, aligned_size);
@@ -29,14 +35,21 @@ static ft_bool reallocate_block(void *memory_pointer, ft_size_t aligned_size, ft
     if (block->next && cma_block_is_free(block->next) &&
         (block->size + block->next->size) >= aligned_size)
     {
-        cma_validate_block(block->next, "cma_realloc neighbor", nullptr);
-        block->size += block->next->size;
-        block->next = block->next->next;
+        Block *absorbed_block = block->next;
+
+        cma_validate_block(absorbed_block, "cma_realloc neighbor", nullptr);
+        cma_free_bins_remove(absorbed_block);
+        cma_block_index_remove(absorbed_block);
+        block->size += absorbed_block->size;
+        block->next = absorbed_block->next;
         if (block->next)
         {
             cma_validate_block(block->next, "cma_realloc relink", nullptr);
             block->next->prev = block;
         }
+        absorbed_block->next = nullptr;
+        absorbed_block->prev = nullptr;
+        cma_metadata_release_block(absorbed_block);
         split_block(block, aligned_size);
         cma_validate_block(block, "cma_realloc split after merge", memory_pointer);
         cma_debug_prepare_allocation(block, user_size);
@@ -114,6 +127,26 @@ void *cma_realloc(void* memory_pointer, ft_size_t new_size)
         return (nullptr);
     if (g_cma_alloc_limit != 0 && new_size > g_cma_alloc_limit)
         return (nullptr);
+    if (memory_pointer != nullptr
+        && cma_arena_scope_owns_pointer(memory_pointer) == FT_TRUE)
+    {
+        if (new_size == 0)
+            return (nullptr);
+        void *scoped_pointer = cma_arena_scope_reallocate(memory_pointer,
+                new_size);
+
+        if (scoped_pointer != nullptr)
+            return (scoped_pointer);
+        ft_size_t copy_size = cma_arena_scope_block_size(memory_pointer);
+        void *heap_pointer = cma_malloc(new_size);
+
+        if (heap_pointer == nullptr)
+            return (nullptr);
+        if (copy_size > new_size)
+            copy_size = new_size;
+        ft_memcpy(heap_pointer, memory_pointer, copy_size);
+        return (heap_pointer);
+    }
     if (cma_backend_is_enabled())
     {
         if (!memory_pointer || cma_backend_owns_pointer(memory_pointer))
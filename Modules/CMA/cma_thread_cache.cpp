@@ -0,0 +1,345 @@
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <pthread.h>
+#include "CMA.hpp"
+#include "cma_internal.hpp"
+#include "../Errno/errno.hpp"
+
+struct cma_thread_cache
+{
+    void                    *entries[CMA_THREAD_CACHE_CLASS_COUNT]
+                                [CMA_THREAD_CACHE_CAPACITY];
+    uint32_t                counts[CMA_THREAD_CACHE_CLASS_COUNT];
+    std::atomic<ft_size_t>  allocation_count;
+    std::atomic<ft_size_t>  free_count;
+    std::atomic<int64_t>    byte_delta;
+    cma_thread_cache        *next;
+    cma_thread_cache        *prev;
+};
+
+static cma_thread_cache *g_cma_thread_cache_list = nullptr;
+static pthread_key_t g_cma_thread_cache_key;
+static pthread_once_t g_cma_thread_cache_key_once = PTHREAD_ONCE_INIT;
+static ft_bool g_cma_thread_cache_key_ready = FT_FALSE;
+static thread_local cma_thread_cache *g_cma_thread_cache = nullptr;
+
+static uint32_t cma_thread_cache_class_index(ft_size_t block_size)
+{
+    return (static_cast<uint32_t>((block_size >> 4) - 1));
+}
+
+static void cma_thread_cache_link_locked(cma_thread_cache *cache)
+{
+    cache->prev = nullptr;
+    cache->next = g_cma_thread_cache_list;
+    if (g_cma_thread_cache_list != nullptr)
+        g_cma_thread_cache_list->prev = cache;
+    g_cma_thread_cache_list = cache;
+    return ;
+}
+
+static void cma_thread_cache_unlink_locked(cma_thread_cache *cache)
+{
+    if (cache->prev != nullptr)
+        cache->prev->next = cache->next;
+    else
+        g_cma_thread_cache_list = cache->next;
+    if (cache->next != nullptr)
+        cache->next->prev = cache->prev;
+    cache->next = nullptr;
+    cache->prev = nullptr;
+    return ;
+}
+
+static void cma_thread_cache_apply_byte_delta(ft_size_t *current_bytes,
+        int64_t byte_delta)
+{
+    ft_size_t released_bytes;
+
+    if (byte_delta >= 0)
+    {
+        *current_bytes += static_cast<ft_size_t>(byte_delta);
+        return ;
+    }
+    released_bytes = static_cast<ft_size_t>(-byte_delta);
+    if (*current_bytes >= released_bytes)
+        *current_bytes -= released_bytes;
+    else
+        *current_bytes = 0;
+    return ;
+}
+
+static void cma_thread_cache_fold_stats_locked(cma_thread_cache *cache)
+{
+    g_cma_allocation_count += cache->allocation_count.load(
+            std::memory_order_relaxed);
+    cache->allocation_count.store(0, std::memory_order_relaxed);
+    g_cma_free_count += cache->free_count.load(std::memory_order_relaxed);
+    cache->free_count.store(0, std::memory_order_relaxed);
+    cma_thread_cache_apply_byte_delta(&g_cma_current_bytes,
+        cache->byte_delta.load(std::memory_order_relaxed));
+    cache->byte_delta.store(0, std::memory_order_relaxed);
+    if (g_cma_current_bytes > g_cma_peak_bytes)
+        g_cma_peak_bytes = g_cma_current_bytes;
+    return ;
+}
+
+static void cma_thread_cache_release_oldest_locked(cma_thread_cache *cache,
+        uint32_t class_index, uint32_t release_count)
+{
+    uint32_t entry_index;
+    uint32_t remaining_count;
+
+    if (release_count > cache->counts[class_index])
+        release_count = cache->counts[class_index];
+    entry_index = 0;
+    while (entry_index < release_count)
+    {
+        cma_small_arena_release_cached_locked(
+            cache->entries[class_index][entry_index]);
+        entry_index++;
+    }
+    remaining_count = cache->counts[class_index] - release_count;
+    if (remaining_count != 0)
+        std::memmove(&cache->entries[class_index][0],
+            &cache->entries[class_index][release_count],
+            remaining_count * sizeof(void *));
+    cache->counts[class_index] = remaining_count;
+    return ;
+}
+
+static void cma_thread_cache_flush_locked(cma_thread_cache *cache)
+{
+    uint32_t class_index;
+
+    class_index = 0;
+    while (class_index < CMA_THREAD_CACHE_CLASS_COUNT)
+    {
+        cma_thread_cache_release_oldest_locked(cache, class_index,
+            cache->counts[class_index]);
+        class_index++;
+    }
+    cma_thread_cache_fold_stats_locked(cache);
+    return ;
+}
+
+static void cma_thread_cache_destroy(void *value)
+{
+    cma_thread_cache *cache;
+    ft_bool lock_acquired;
+
+    cache = static_cast<cma_thread_cache *>(value);
+    if (cache == nullptr)
+        return ;
+    lock_acquired = FT_FALSE;
+    if (cma_lock_allocator(&lock_acquired) != FT_ERR_SUCCESS)
+        return ;
+    cma_thread_cache_flush_locked(cache);
+    cma_thread_cache_unlink_locked(cache);
+    cma_unlock_allocator(lock_acquired);
+    if (g_cma_thread_cache == cache)
+        g_cma_thread_cache = nullptr;
+    cache->~cma_thread_cache();
+    std::free(cache);
+    return ;
+}
+
+static void cma_thread_cache_create_key(void)
+{
+    if (pthread_key_create(&g_cma_thread_cache_key,
+            cma_thread_cache_destroy) == 0)
+        g_cma_thread_cache_key_ready = FT_TRUE;
+    return ;
+}
+
+static cma_thread_cache *cma_thread_cache_current(void)
+{
+    cma_thread_cache *cache;
+    void *memory;
+    ft_bool lock_acquired;
+
+    if (g_cma_thread_cache != nullptr)
+        return (g_cma_thread_cache);
+    if (pthread_once(&g_cma_thread_cache_key_once,
+            cma_thread_cache_create_key) != 0
+        || g_cma_thread_cache_key_ready == FT_FALSE)
+        return (nullptr);
+    memory = std::calloc(1, sizeof(cma_thread_cache));
+    if (memory == nullptr)
+        return (nullptr);
+    cache = new (memory) cma_thread_cache();
+    lock_acquired = FT_FALSE;
+    if (cma_lock_allocator(&lock_acquired) != FT_ERR_SUCCESS)
+    {
+        cache->~cma_thread_cache();
+        std::free(memory);
+        return (nullptr);
+    }
+    cma_thread_cache_link_locked(cache);
+    cma_unlock_allocator(lock_acquired);
+    if (pthread_setspecific(g_cma_thread_cache_key, cache) != 0)
+    {
+        cma_thread_cache_destroy(cache);
+        return (nullptr);
+    }
+    g_cma_thread_cache = cache;
+    return (cache);
+}
+
+static int32_t cma_thread_cache_refill(cma_thread_cache *cache,
+        uint32_t class_index)
+{
+    ft_bool lock_acquired;
+    ft_size_t class_size;
+    void *memory_pointer;
+
+    lock_acquired = FT_FALSE;
+    if (cma_lock_allocator(&lock_acquired) != FT_ERR_SUCCESS)
+        return (FT_ERR_INVALID_STATE);
+    class_size = (static_cast<ft_size_t>(class_index) + 1) * 16;
+    while (cache->counts[class_index] < CMA_THREAD_CACHE_BATCH_SIZE)
+    {
+        memory_pointer = cma_small_arena_allocate_cached_locked(class_size);
+        if (memory_pointer == nullptr)
+            break ;
+        cache->entries[class_index][cache->counts[class_index]] = memory_pointer;
+        cache->counts[class_index]++;
+    }
+    cma_thread_cache_fold_stats_locked(cache);
+    cma_unlock_allocator(lock_acquired);
+    if (cache->counts[class_index] == 0)
+        return (FT_ERR_NO_MEMORY);
+    return (FT_ERR_SUCCESS);
+}
+
+void *cma_thread_cache_allocate(ft_size_t size)
+{
+    cma_thread_cache *cache;
+    uint32_t class_index;
+    void *memory_pointer;
+    ft_size_t block_size;
+
+    if (g_cma_thread_cache_enabled.load(std::memory_order_relaxed) == false
+        || size > CMA_SMALL_ARENA_MAX_ALLOCATION)
+        return (nullptr);
+    if (size == 0)
+        size = 1;
+    cache = cma_thread_cache_current();
+    if (cache == nullptr)
+        return (nullptr);
+    class_index = cma_thread_cache_class_index(align16(size));
+    if (cache->counts[class_index] == 0
+        && cma_thread_cache_refill(cache, class_index) != FT_ERR_SUCCESS)
+        return (nullptr);
+    cache->counts[class_index]--;
+    memory_pointer = cache->entries[class_index][cache->counts[class_index]];
+    block_size = cma_small_arena_claim_cached(memory_pointer);
+    cache->allocation_count.store(cache->allocation_count.load(
+            std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    cache->byte_delta.store(cache->byte_delta.load(std::memory_order_relaxed)
+        + static_cast<int64_t>(block_size), std::memory_order_relaxed);
+    return (memory_pointer);
+}
+
+ft_bool cma_thread_cache_deallocate(void *memory_pointer)
+{
+    cma_thread_cache *cache;
+    uint32_t class_index;
+    ft_size_t block_size;
+    ft_bool lock_acquired;
+
+    if (g_cma_thread_cache_enabled.load(std::memory_order_relaxed) == false)
+        return (FT_FALSE);
+    cache = cma_thread_cache_current();
+    if (cache == nullptr)
+        return (FT_FALSE);
+    block_size = cma_small_arena_return_to_cache(memory_pointer);
+    if (block_size == 0)
+        return (FT_FALSE);
+    class_index = cma_thread_cache_class_index(block_size);
+    if (class_index >= CMA_THREAD_CACHE_CLASS_COUNT)
+    {
+        (void)cma_small_arena_claim_cached(memory_pointer);
+        return (FT_FALSE);
+    }
+    if (cache->counts[class_index] == CMA_THREAD_CACHE_CAPACITY)
+    {
+        lock_acquired = FT_FALSE;
+        if (cma_lock_allocator(&lock_acquired) != FT_ERR_SUCCESS)
+        {
+            (void)cma_small_arena_claim_cached(memory_pointer);
+            return (FT_FALSE);
+        }
+        cma_thread_cache_release_oldest_locked(cache, class_index,
+            CMA_THREAD_CACHE_BATCH_SIZE);
+        cma_thread_cache_fold_stats_locked(cache);
+        cma_unlock_allocator(lock_acquired);
+    }
+    cache->entries[class_index][cache->counts[class_index]] = memory_pointer;
+    cache->counts[class_index]++;
+    cache->free_count.store(cache->free_count.load(std::memory_order_relaxed)
+        + 1, std::memory_order_relaxed);
+    cache->byte_delta.store(cache->byte_delta.load(std::memory_order_relaxed)
+        - static_cast<int64_t>(block_size), std::memory_order_relaxed);
+    return (FT_TRUE);
+}
+
+void cma_thread_cache_collect_stats_locked(ft_size_t *allocation_count,
+        ft_size_t *free_count, ft_size_t *current_bytes,
+        ft_size_t *peak_bytes)
+{
+    const cma_thread_cache *cache;
+
+    cache = g_cma_thread_cache_list;
+    while (cache != nullptr)
+    {
+        *allocation_count += cache->allocation_count.load(
+                std::memory_order_relaxed);
+        *free_count += cache->free_count.load(std::memory_order_relaxed);
+        cma_thread_cache_apply_byte_delta(current_bytes,
+            cache->byte_delta.load(std::memory_order_relaxed));
+        cache = cache->next;
+    }
+    if (*current_bytes > *peak_bytes)
+        *peak_bytes = *current_bytes;
+    return ;
+}
+
+int32_t cma_flush_thread_cache(void)
+{
+    ft_bool lock_acquired;
+    int32_t lock_error;
+
+    if (g_cma_thread_cache == nullptr)
+        return (FT_ERR_SUCCESS);
+    lock_acquired = FT_FALSE;
+    lock_error = cma_lock_allocator(&lock_acquired);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (lock_error);
+    cma_thread_cache_flush_locked(g_cma_thread_cache);
+    cma_unlock_allocator(lock_acquired);
+    return (FT_ERR_SUCCESS);
+}
+
+// Other threads may be using their caches without the allocator lock, so
+// disabling only flushes the caller's cache. Blocks cached by other threads
+// stay reserved until those threads call cma_flush_thread_cache or exit.
+int32_t cma_set_thread_cache_enabled(ft_bool enable)
+{
+    if (enable == FT_TRUE)
+    {
+        g_cma_thread_cache_enabled.store(true, std::memory_order_relaxed);
+        return (FT_ERR_SUCCESS);
+    }
+    g_cma_thread_cache_enabled.store(false, std::memory_order_relaxed);
+    return (cma_flush_thread_cache());
+}
+
+ft_bool cma_is_thread_cache_enabled(void)
+{
+    if (g_cma_thread_cache_enabled.load(std::memory_order_relaxed) == true)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
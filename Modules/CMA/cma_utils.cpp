@@ -226,6 +226,17 @@ Block* split_block(Block* block, ft_size_t size)
     }
     new_block->size = remaining_size;
     new_block->payload = block->payload + size;
+    new_block->page = block->page;
+    if (cma_block_index_insert(new_block) != FT_ERR_SUCCESS)
+    {
+        cma_metadata_release_block(new_block);
+        if (cma_block_is_free(block))
+            cma_mark_block_free(block);
+        else
+            cma_mark_block_allocated(block);
+        goto split_block_cleanup;
+    }
+    cma_free_bins_remove(block);
     cma_debug_initialize_block(new_block);
     cma_mark_block_free(new_block);
     new_block->next = block->next;
@@ -238,9 +249,13 @@ Block* split_block(Block* block, ft_size_t size)
     block->next = new_block;
     block->size = size;
     if (cma_block_is_free(block))
+    {
         cma_mark_block_free(block);
+        cma_free_bins_insert(block);
+    }
     else
         cma_mark_block_allocated(block);
+    cma_free_bins_insert(new_block);
     cma_debug_initialize_block(block);
     result_block = block;
 split_block_cleanup:
@@ -254,6 +269,8 @@ Page *create_page(ft_size_t size)
     ft_size_t page_size = determine_page_size(size);
     ft_bool use_heap = FT_TRUE;
 
+    if (cma_huge_size_is_eligible(size) == FT_TRUE)
+        return (cma_huge_create_page(size));
     if (page_list == nullptr && page_size <= PAGE_SIZE)
     {
         page_size = PAGE_SIZE;
@@ -300,12 +317,22 @@ Page *create_page(ft_size_t size)
     }
     page->blocks->size = page_size;
     page->blocks->payload = static_cast<unsigned char *>(memory_pointer);
+    page->blocks->page = page;
+    if (cma_block_index_insert(page->blocks) != FT_ERR_SUCCESS)
+    {
+        cma_metadata_release_block(page->blocks);
+        if (use_heap)
+            std::free(memory_pointer);
+        std::free(page);
+        return (nullptr);
+    }
     cma_debug_initialize_block(page->blocks);
     cma_mark_block_free(page->blocks);
     page->blocks->next = nullptr;
     page->blocks->prev = nullptr;
     cma_validate_block(page->blocks, "create_page", nullptr);
     determine_page_use(page);
+    cma_free_bins_insert(page->blocks);
     if (!page_list)
     {
         page_list = page;
@@ -321,53 +348,42 @@ Page *create_page(ft_size_t size)
 
 Block *find_free_block(ft_size_t size)
 {
-    Page* cur_page = page_list;
-    int8_t alloc_size_type = determine_which_block_to_use(size);
-    while (cur_page)
-    {
-        if (cur_page->alloc_size_type != alloc_size_type)
-        {
-            cur_page = cur_page->next;
-            continue ;
-        }
-        Block* cur_block = cur_page->blocks;
-        while (cur_block)
-        {
-            cma_validate_block(cur_block, "find_free_block", nullptr);
-            if (cma_block_is_free(cur_block) && cur_block->size >= size)
-                return (cur_block);
-            verify_traversal_link(cur_block, cur_block->next,
-                "find_free_block corrupted traversal link");
-            cur_block = cur_block->next;
-        }
-        cur_page = cur_page->next;
-    }
-    return (nullptr);
+    Block   *block;
+
+    block = cma_free_bins_find(size, determine_which_block_to_use(size));
+    if (block == nullptr)
+        return (nullptr);
+    cma_validate_block(block, "find_free_block", nullptr);
+    if (!cma_block_is_free(block) || block->size < size)
+        report_corrupted_block(block, "find_free_block corrupted bin", nullptr);
+    verify_traversal_link(block->prev, block,
+        "find_free_block corrupted traversal link");
+    verify_traversal_link(block, block->next,
+        "find_free_block corrupted traversal link");
+    return (block);
 }
 
 Block    *cma_find_block_for_pointer(const void *memory_pointer)
 {
-    Page    *current_page;
+    const unsigned char *payload;
+    Block               *block;
 
     if (memory_pointer == nullptr)
         return (nullptr);
-    current_page = page_list;
-    while (current_page)
-    {
-        Block    *current_block;
-
-        current_block = current_page->blocks;
-        while (current_block)
-        {
-            if (cma_block_user_pointer(current_block) == memory_pointer)
-                return (current_block);
-            verify_traversal_link(current_block, current_block->next,
-                "cma_find_block_for_pointer corrupted traversal link");
-            current_block = current_block->next;
-        }
-        current_page = current_page->next;
-    }
-    return (nullptr);
+    payload = static_cast<const unsigned char *>(memory_pointer);
+    if (reinterpret_cast<uintptr_t>(payload) < cma_debug_guard_size())
+        return (nullptr);
+    payload -= cma_debug_guard_size();
+    block = cma_block_index_find(payload);
+    if (block == nullptr)
+        return (nullptr);
+    if (cma_block_user_pointer(block) != memory_pointer)
+        return (nullptr);
+    verify_traversal_link(block->prev, block,
+        "cma_find_block_for_pointer corrupted traversal link");
+    verify_traversal_link(block, block->next,
+        "cma_find_block_for_pointer corrupted traversal link");
+    return (block);
 }
 
 Block *merge_block(Block *block)
@@ -383,6 +399,9 @@ Block *merge_block(Block *block)
     {
         cma_validate_block(previous_block, "merge_block prev", nullptr);
         verify_backward_link(current, previous_block);
+        cma_free_bins_remove(previous_block);
+        cma_free_bins_remove(current);
+        cma_block_index_remove(current);
 #ifdef DEBUG
 #endif
         previous_block->size += current->size;
@@ -406,6 +425,9 @@ Block *merge_block(Block *block)
     {
         cma_validate_block(next_block, "merge_block next", nullptr);
         verify_forward_link(current, next_block);
+        cma_free_bins_remove(current);
+        cma_free_bins_remove(next_block);
+        cma_block_index_remove(next_block);
 #ifdef DEBUG
 #endif
         current->size += next_block->size;
@@ -424,6 +446,7 @@ Block *merge_block(Block *block)
         next_block = current->next;
     }
     cma_mark_block_free(current);
+    cma_free_bins_insert(current);
 #ifdef DEBUG
 #endif
     return (current);
@@ -431,21 +454,9 @@ Block *merge_block(Block *block)
 
 Page *find_page_of_block(Block *block)
 {
-    Page *page = page_list;
-    while (page)
-    {
-        unsigned char    *start;
-        unsigned char    *end;
-        unsigned char    *payload;
-
-        start = static_cast<unsigned char *>(page->start);
-        end = start + page->size;
-        payload = block->payload;
-        if (payload >= start && payload < end)
-            return (page);
-        page = page->next;
-    }
-    return (nullptr);
+    if (block == nullptr)
+        return (nullptr);
+    return (block->page);
 }
 
 void free_page_if_empty(Page *page)
@@ -462,7 +473,12 @@ void free_page_if_empty(Page *page)
             page->next->prev = page->prev;
         if (page_list == page)
             page_list = page->next;
-        std::free(page->start);
+        cma_free_bins_remove(page->blocks);
+        cma_block_index_remove(page->blocks);
+        if (page->mapped == FT_TRUE)
+            cma_huge_release_page(page);
+        else
+            std::free(page->start);
         cma_metadata_release_block(page->blocks);
         std::free(page);
         return ;
@@ -473,21 +489,37 @@ void free_page_if_empty(Page *page)
 int32_t cma_get_extended_stats(ft_size_t *allocation_count,
         ft_size_t *free_count,
         ft_size_t *current_bytes,
-        ft_size_t *peak_bytes)
+        ft_size_t *peak_bytes,
+        ft_size_t *huge_allocation_count,
+        ft_size_t *huge_mapped_bytes)
 {
     ft_bool lock_acquired = FT_FALSE;
     int32_t lock_error = cma_lock_allocator(&lock_acquired);
+    ft_size_t total_allocation_count;
+    ft_size_t total_free_count;
+    ft_size_t total_current_bytes;
+    ft_size_t total_peak_bytes;
 
     if (lock_error != FT_ERR_SUCCESS)
         return (lock_error);
+    total_allocation_count = g_cma_allocation_count;
+    total_free_count = g_cma_free_count;
+    total_current_bytes = g_cma_current_bytes;
+    total_peak_bytes = g_cma_peak_bytes;
+    cma_thread_cache_collect_stats_locked(&total_allocation_count,
+        &total_free_count, &total_current_bytes, &total_peak_bytes);
     if (allocation_count != nullptr)
-        *allocation_count = g_cma_allocation_count;
+        *allocation_count = total_allocation_count;
     if (free_count != nullptr)
-        *free_count = g_cma_free_count;
+        *free_count = total_free_count;
     if (current_bytes != nullptr)
-        *current_bytes = g_cma_current_bytes;
+        *current_bytes = total_current_bytes;
     if (peak_bytes != nullptr)
-        *peak_bytes = g_cma_peak_bytes;
+        *peak_bytes = total_peak_bytes;
+    if (huge_allocation_count != nullptr)
+        *huge_allocation_count = g_cma_huge_allocation_count;
+    if (huge_mapped_bytes != nullptr)
+        *huge_mapped_bytes = g_cma_huge_mapped_bytes;
     cma_unlock_allocator(lock_acquired);
     return (FT_ERR_SUCCESS);
 }
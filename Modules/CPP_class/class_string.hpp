@@ -62,6 +62,7 @@ class ft_string
         ft_bool        operator==(const char *string) const noexcept;
         ft_bool        operator!=(const ft_string &other) const noexcept;
         ft_bool        operator!=(const char *string) const noexcept;
+        ft_bool        operator<(const ft_string &other) const noexcept;
         char        operator[](ft_size_t index) const noexcept;
         operator const char*() const noexcept;
 
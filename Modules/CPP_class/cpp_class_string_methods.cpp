@@ -1056,6 +1056,30 @@ ft_bool ft_string::operator!=(const char *string) const noexcept
     return (!((*this) == string));
 }
 
+ft_bool ft_string::operator<(const ft_string &other) const noexcept
+{
+    ft_size_t index;
+    unsigned char left_character;
+    unsigned char right_character;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_string::operator<(const ft_string &)");
+    errno_abort_if_uninitialised_or_destroyed(other._initialised_state, "ft_string::operator<(const ft_string &) source");
+    index = 0;
+    while (index < this->_length && index < other._length)
+    {
+        left_character = static_cast<unsigned char>(this->_data[index]);
+        right_character = static_cast<unsigned char>(other._data[index]);
+        if (left_character != right_character)
+        {
+            this->set_error(FT_ERR_SUCCESS);
+            return (left_character < right_character);
+        }
+        index++;
+    }
+    this->set_error(FT_ERR_SUCCESS);
+    return (this->_length < other._length);
+}
+
 char ft_string::operator[](ft_size_t index) const noexcept
 {
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_string::operator[]");
@@ -64,6 +64,17 @@ int32_t cmp_cma_memory_unmap(void *memory_pointer, ft_size_t mapping_size)
     return (FT_ERR_SUCCESS);
 }
 
+int32_t cmp_cma_memory_remap(void *memory_pointer, ft_size_t old_size,
+    ft_size_t new_size, void **new_pointer_out)
+{
+    (void)memory_pointer;
+    (void)old_size;
+    (void)new_size;
+    if (new_pointer_out != ft_nullptr)
+        *new_pointer_out = ft_nullptr;
+    return (FT_ERR_INVALID_OPERATION);
+}
+
 #else
 
 #include <sys/mman.h>
@@ -123,4 +134,34 @@ int32_t cmp_cma_memory_unmap(void *memory_pointer, ft_size_t mapping_size)
     return (FT_ERR_SUCCESS);
 }
 
+int32_t cmp_cma_memory_remap(void *memory_pointer, ft_size_t old_size,
+    ft_size_t new_size, void **new_pointer_out)
+{
+    if (new_pointer_out == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    *new_pointer_out = ft_nullptr;
+    if (memory_pointer == ft_nullptr || old_size == 0 || new_size == 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+#if defined(__linux__)
+    void *remapped_pointer;
+
+    remapped_pointer = mremap(memory_pointer, old_size, new_size,
+            MREMAP_MAYMOVE);
+    if (remapped_pointer == MAP_FAILED)
+        return (FT_ERR_NO_MEMORY);
+    *new_pointer_out = remapped_pointer;
+    return (FT_ERR_SUCCESS);
+#else
+    if (new_size < old_size)
+    {
+        if (munmap(static_cast<char *>(memory_pointer) + new_size,
+                old_size - new_size) != 0)
+            return (FT_ERR_INVALID_STATE);
+        *new_pointer_out = memory_pointer;
+        return (FT_ERR_SUCCESS);
+    }
+    return (FT_ERR_INVALID_OPERATION);
+#endif
+}
+
 #endif
@@ -14,5 +14,7 @@ int32_t cmp_cma_memory_protect_none(void *memory_pointer, ft_size_t mapping_size
 int32_t cmp_cma_memory_protect_read_write(void *memory_pointer,
     ft_size_t mapping_size);
 int32_t cmp_cma_memory_unmap(void *memory_pointer, ft_size_t mapping_size);
+int32_t cmp_cma_memory_remap(void *memory_pointer, ft_size_t old_size,
+    ft_size_t new_size, void **new_pointer_out);
 
 #endif
@@ -0,0 +1,437 @@
+#include "game_flow_field.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../PThread/pthread_internal.hpp"
+#include <cstdint>
+#include <new>
+
+#define GAME_FLOW_FIELD_GOAL 6
+#define GAME_FLOW_FIELD_NO_STEP 7
+
+thread_local int32_t game_flow_field::_last_error = FT_ERR_SUCCESS;
+
+static void game_flow_field_visit(const uint8_t *cells, uint32_t *distances,
+    uint8_t *directions, uint32_t *queue, ft_size_t *tail, ft_size_t neighbor,
+    uint32_t distance, uint8_t direction) noexcept
+{
+    if (cells[neighbor] != 0 || distances[neighbor] != GAME_FLOW_FIELD_UNREACHABLE)
+        return ;
+    distances[neighbor] = distance;
+    directions[neighbor] = direction;
+    queue[*tail] = static_cast<uint32_t>(neighbor);
+    (*tail)++;
+    return ;
+}
+
+game_flow_field::game_flow_field() noexcept
+    : _cells(ft_nullptr), _distances(ft_nullptr), _directions(ft_nullptr),
+      _queue(ft_nullptr), _capacity(0), _dimensions(), _goal(), _reachable_count(0),
+      _built(FT_FALSE), _mutex(ft_nullptr), _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+game_flow_field::~game_flow_field() noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return ;
+    (void)this->destroy();
+    return ;
+}
+
+int32_t game_flow_field::set_error(int32_t error_code) noexcept
+{
+    game_flow_field::_last_error = error_code;
+    return (error_code);
+}
+
+int32_t game_flow_field::lock_internal(ft_bool *lock_acquired) const noexcept
+{
+    int32_t lock_error;
+
+    if (lock_acquired != ft_nullptr)
+        *lock_acquired = FT_FALSE;
+    lock_error = pt_recursive_mutex_lock_if_not_null(this->_mutex);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (lock_error);
+    if (lock_acquired != ft_nullptr)
+        *lock_acquired = FT_TRUE;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_flow_field::unlock_internal(ft_bool lock_acquired) const noexcept
+{
+    if (lock_acquired == FT_FALSE)
+        return (FT_ERR_SUCCESS);
+    (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+    return (FT_ERR_SUCCESS);
+}
+
+void game_flow_field::release() noexcept
+{
+    cma_free(this->_cells);
+    cma_free(this->_distances);
+    cma_free(this->_directions);
+    cma_free(this->_queue);
+    this->_cells = ft_nullptr;
+    this->_distances = ft_nullptr;
+    this->_directions = ft_nullptr;
+    this->_queue = ft_nullptr;
+    this->_capacity = 0;
+    this->_reachable_count = 0;
+    this->_built = FT_FALSE;
+    return ;
+}
+
+int32_t game_flow_field::initialize() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "game_flow_field::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    this->release();
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_flow_field::destroy() noexcept
+{
+    int32_t disable_error;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    this->release();
+    disable_error = this->disable_thread_safety();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    this->set_error(disable_error);
+    return (disable_error);
+}
+
+int32_t game_flow_field::enable_thread_safety() noexcept
+{
+    pt_recursive_mutex *mutex_pointer;
+    int32_t initialize_error;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_flow_field::enable_thread_safety");
+    if (this->_mutex != ft_nullptr)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    mutex_pointer = new (std::nothrow) pt_recursive_mutex();
+    if (mutex_pointer == ft_nullptr)
+    {
+        this->set_error(FT_ERR_NO_MEMORY);
+        return (FT_ERR_NO_MEMORY);
+    }
+    initialize_error = mutex_pointer->initialize();
+    if (initialize_error != FT_ERR_SUCCESS)
+    {
+        delete mutex_pointer;
+        this->set_error(initialize_error);
+        return (initialize_error);
+    }
+    this->_mutex = mutex_pointer;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_flow_field::disable_thread_safety() noexcept
+{
+    pt_recursive_mutex *old_mutex;
+    int32_t destroy_error;
+
+    if (this->_mutex == ft_nullptr)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    old_mutex = this->_mutex;
+    this->_mutex = ft_nullptr;
+    destroy_error = old_mutex->destroy();
+    delete old_mutex;
+    this->set_error(destroy_error);
+    return (destroy_error);
+}
+
+ft_bool game_flow_field::is_thread_safe() const noexcept
+{
+    return (this->_mutex != ft_nullptr);
+}
+
+int32_t game_flow_field::reserve(ft_size_t cell_count) noexcept
+{
+    if (cell_count <= this->_capacity)
+        return (FT_ERR_SUCCESS);
+    this->release();
+    this->_cells = static_cast<uint8_t *>(cma_malloc(cell_count));
+    this->_distances = static_cast<uint32_t *>(cma_malloc(cell_count * sizeof(uint32_t)));
+    this->_directions = static_cast<uint8_t *>(cma_malloc(cell_count));
+    this->_queue = static_cast<uint32_t *>(cma_malloc(cell_count * sizeof(uint32_t)));
+    if (this->_cells == ft_nullptr || this->_distances == ft_nullptr
+        || this->_directions == ft_nullptr || this->_queue == ft_nullptr)
+    {
+        this->release();
+        return (FT_ERR_NO_MEMORY);
+    }
+    this->_capacity = cell_count;
+    return (FT_ERR_SUCCESS);
+}
+
+void game_flow_field::flood(ft_size_t goal_cell) noexcept
+{
+    ft_size_t stride[3];
+    ft_size_t coordinates[3];
+    ft_size_t head;
+    ft_size_t tail;
+    ft_size_t cell;
+    uint32_t distance;
+    uint8_t axis;
+
+    stride[0] = 1;
+    stride[1] = this->_dimensions[0];
+    stride[2] = this->_dimensions[0] * this->_dimensions[1];
+    cell = stride[2] * this->_dimensions[2];
+    ft_memset(this->_distances, 0xFF, cell * sizeof(uint32_t));
+    ft_memset(this->_directions, GAME_FLOW_FIELD_NO_STEP, cell);
+    this->_distances[goal_cell] = 0;
+    this->_directions[goal_cell] = GAME_FLOW_FIELD_GOAL;
+    this->_queue[0] = static_cast<uint32_t>(goal_cell);
+    head = 0;
+    tail = 1;
+    while (head < tail)
+    {
+        cell = this->_queue[head];
+        head++;
+        distance = this->_distances[cell] + 1;
+        coordinates[0] = cell % stride[1];
+        coordinates[1] = (cell / stride[1]) % this->_dimensions[1];
+        coordinates[2] = cell / stride[2];
+        axis = 0;
+        while (axis < 3)
+        {
+            // A neighbour reached through +axis steps back along -axis.
+            if (coordinates[axis] + 1 < this->_dimensions[axis])
+                game_flow_field_visit(this->_cells, this->_distances, this->_directions,
+                    this->_queue, &tail, cell + stride[axis], distance,
+                    static_cast<uint8_t>(axis * 2 + 1));
+            if (coordinates[axis] > 0)
+                game_flow_field_visit(this->_cells, this->_distances, this->_directions,
+                    this->_queue, &tail, cell - stride[axis], distance,
+                    static_cast<uint8_t>(axis * 2));
+            axis++;
+        }
+    }
+    this->_reachable_count = tail;
+    return ;
+}
+
+int32_t game_flow_field::build(const game_map3d &grid, ft_size_t goal_x, ft_size_t goal_y,
+    ft_size_t goal_z) noexcept
+{
+    ft_bool lock_acquired;
+    ft_bool grid_lock_acquired;
+    ft_size_t goal_cell;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_flow_field::build");
+    grid_lock_acquired = FT_FALSE;
+    error_code = grid.lock(&grid_lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        grid.unlock(grid_lock_acquired);
+        return (this->set_error(error_code));
+    }
+    this->_built = FT_FALSE;
+    this->_dimensions[0] = grid.get_width();
+    this->_dimensions[1] = grid.get_height();
+    this->_dimensions[2] = grid.get_depth();
+    if (goal_x >= this->_dimensions[0] || goal_y >= this->_dimensions[1]
+        || goal_z >= this->_dimensions[2])
+        error_code = FT_ERR_GAME_INVALID_MOVE;
+    else if (this->_dimensions[0] > UINT32_MAX / this->_dimensions[1]
+        || this->_dimensions[0] * this->_dimensions[1] > UINT32_MAX / this->_dimensions[2])
+        error_code = FT_ERR_OUT_OF_RANGE;
+    else
+        error_code = this->reserve(this->_dimensions[0] * this->_dimensions[1]
+                * this->_dimensions[2]);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = grid.copy_obstacles(this->_cells);
+    grid.unlock(grid_lock_acquired);
+    goal_cell = (goal_z * this->_dimensions[1] + goal_y) * this->_dimensions[0] + goal_x;
+    if (error_code == FT_ERR_SUCCESS && this->_cells[goal_cell] != 0)
+        error_code = FT_ERR_GAME_INVALID_MOVE;
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        this->flood(goal_cell);
+        this->_goal[0] = goal_x;
+        this->_goal[1] = goal_y;
+        this->_goal[2] = goal_z;
+        this->_built = FT_TRUE;
+    }
+    (void)this->unlock_internal(lock_acquired);
+    return (this->set_error(error_code));
+}
+
+int32_t game_flow_field::cell_of(ft_size_t x, ft_size_t y, ft_size_t z,
+    ft_size_t *cell) const noexcept
+{
+    if (this->_built == FT_FALSE)
+        return (FT_ERR_INVALID_STATE);
+    if (x >= this->_dimensions[0] || y >= this->_dimensions[1] || z >= this->_dimensions[2])
+        return (FT_ERR_GAME_INVALID_MOVE);
+    *cell = (z * this->_dimensions[1] + y) * this->_dimensions[0] + x;
+    if (this->_distances[*cell] == GAME_FLOW_FIELD_UNREACHABLE)
+        return (FT_ERR_GAME_INVALID_MOVE);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_flow_field::next_step(ft_size_t x, ft_size_t y, ft_size_t z, ft_size_t *next_x,
+    ft_size_t *next_y, ft_size_t *next_z) const noexcept
+{
+    ft_bool lock_acquired;
+    ft_size_t coordinates[3];
+    ft_size_t cell;
+    uint8_t direction;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_flow_field::next_step");
+    if (next_x == ft_nullptr || next_y == ft_nullptr || next_z == ft_nullptr)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    error_code = this->cell_of(x, y, z, &cell);
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        coordinates[0] = x;
+        coordinates[1] = y;
+        coordinates[2] = z;
+        direction = this->_directions[cell];
+        if (direction != GAME_FLOW_FIELD_GOAL)
+        {
+            if ((direction & 1) == 0)
+                coordinates[direction / 2]++;
+            else
+                coordinates[direction / 2]--;
+        }
+        *next_x = coordinates[0];
+        *next_y = coordinates[1];
+        *next_z = coordinates[2];
+    }
+    (void)this->unlock_internal(lock_acquired);
+    return (this->set_error(error_code));
+}
+
+uint32_t game_flow_field::get_distance(ft_size_t x, ft_size_t y, ft_size_t z) const noexcept
+{
+    ft_bool lock_acquired;
+    ft_size_t cell;
+    uint32_t distance;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_flow_field::get_distance");
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->set_error(error_code);
+        return (GAME_FLOW_FIELD_UNREACHABLE);
+    }
+    distance = GAME_FLOW_FIELD_UNREACHABLE;
+    error_code = this->cell_of(x, y, z, &cell);
+    if (error_code == FT_ERR_SUCCESS)
+        distance = this->_distances[cell];
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(error_code);
+    return (distance);
+}
+
+int32_t game_flow_field::extract_path(ft_size_t x, ft_size_t y, ft_size_t z,
+    ft_vector<game_path_step> &out_path) const noexcept
+{
+    ft_bool lock_acquired;
+    ft_size_t coordinates[3];
+    ft_size_t cell;
+    ft_size_t stride[3];
+    uint8_t direction;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_flow_field::extract_path");
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    out_path.clear();
+    error_code = this->cell_of(x, y, z, &cell);
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        coordinates[0] = x;
+        coordinates[1] = y;
+        coordinates[2] = z;
+        stride[0] = 1;
+        stride[1] = this->_dimensions[0];
+        stride[2] = this->_dimensions[0] * this->_dimensions[1];
+        while (FT_TRUE)
+        {
+            game_path_step step;
+
+            (void)step.initialize();
+            (void)step.set_coordinates(coordinates[0], coordinates[1], coordinates[2]);
+            out_path.push_back(step);
+            direction = this->_directions[cell];
+            if (direction == GAME_FLOW_FIELD_GOAL)
+                break ;
+            if ((direction & 1) == 0)
+            {
+                coordinates[direction / 2]++;
+                cell += stride[direction / 2];
+            }
+            else
+            {
+                coordinates[direction / 2]--;
+                cell -= stride[direction / 2];
+            }
+        }
+    }
+    (void)this->unlock_internal(lock_acquired);
+    return (this->set_error(error_code));
+}
+
+ft_bool game_flow_field::is_built() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_flow_field::is_built");
+    return (this->_built);
+}
+
+ft_size_t game_flow_field::get_reachable_count() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_flow_field::get_reachable_count");
+    return (this->_reachable_count);
+}
+
+int32_t game_flow_field::get_error() const noexcept
+{
+    return (game_flow_field::_last_error);
+}
+
+const char *game_flow_field::get_error_str() const noexcept
+{
+    return (ft_strerror(game_flow_field::_last_error));
+}
@@ -0,0 +1,72 @@
+#ifndef GAME_FLOW_FIELD_HPP
+# define GAME_FLOW_FIELD_HPP
+
+#include "game_pathfinding.hpp"
+#include "game_map3d.hpp"
+#include "../Template/vector.hpp"
+#include "../Errno/errno.hpp"
+#include "../Basic/basic.hpp"
+#include "../PThread/recursive_mutex.hpp"
+#include <stdint.h>
+
+#define GAME_FLOW_FIELD_UNREACHABLE UINT32_MAX
+
+class game_flow_field
+{
+    #ifdef LIBFT_TEST_BUILD
+        public:
+    #else
+        private:
+    #endif
+        uint8_t             *_cells;
+        uint32_t            *_distances;
+        uint8_t             *_directions;
+        uint32_t            *_queue;
+        ft_size_t           _capacity;
+        ft_size_t           _dimensions[3];
+        ft_size_t           _goal[3];
+        ft_size_t           _reachable_count;
+        ft_bool             _built;
+        pt_recursive_mutex  *_mutex;
+        uint8_t             _initialised_state;
+        static thread_local int32_t _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        int32_t     lock_internal(ft_bool *lock_acquired) const noexcept;
+        int32_t     unlock_internal(ft_bool lock_acquired) const noexcept;
+
+        void        release() noexcept;
+        int32_t     reserve(ft_size_t cell_count) noexcept;
+        void        flood(ft_size_t goal_cell) noexcept;
+        int32_t     cell_of(ft_size_t x, ft_size_t y, ft_size_t z,
+                        ft_size_t *cell) const noexcept;
+
+    public:
+        game_flow_field() noexcept;
+        game_flow_field(const game_flow_field &other) = delete;
+        game_flow_field(game_flow_field &&other) = delete;
+        ~game_flow_field() noexcept;
+        game_flow_field &operator=(const game_flow_field &other) = delete;
+        game_flow_field &operator=(game_flow_field &&other) = delete;
+
+        int32_t     initialize() noexcept;
+        int32_t     destroy() noexcept;
+        int32_t     enable_thread_safety() noexcept;
+        int32_t     disable_thread_safety() noexcept;
+        ft_bool     is_thread_safe() const noexcept;
+
+        int32_t     build(const game_map3d &grid, ft_size_t goal_x, ft_size_t goal_y,
+                        ft_size_t goal_z) noexcept;
+        int32_t     next_step(ft_size_t x, ft_size_t y, ft_size_t z, ft_size_t *next_x,
+                        ft_size_t *next_y, ft_size_t *next_z) const noexcept;
+        uint32_t    get_distance(ft_size_t x, ft_size_t y, ft_size_t z) const noexcept;
+        int32_t     extract_path(ft_size_t x, ft_size_t y, ft_size_t z,
+                        ft_vector<game_path_step> &out_path) const noexcept;
+
+        ft_bool     is_built() const noexcept;
+        ft_size_t   get_reachable_count() const noexcept;
+        int32_t     get_error() const noexcept;
+        const char  *get_error_str() const noexcept;
+};
+
+#endif
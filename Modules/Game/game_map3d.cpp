@@ -345,6 +345,43 @@ ft_bool game_map3d::is_obstacle(ft_size_t x, ft_size_t y, ft_size_t z) const
     return (FT_FALSE);
 }
 
+int32_t game_map3d::copy_obstacles(uint8_t *cells) const noexcept
+{
+    ft_bool lock_acquired;
+    int32_t lock_error;
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_map3d::copy_obstacles");
+    if (cells == ft_nullptr)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    lock_acquired = FT_FALSE;
+    lock_error = this->lock_internal(&lock_acquired);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (this->set_error(lock_error));
+    z = 0;
+    while (this->_data != ft_nullptr && z < this->_depth)
+    {
+        y = 0;
+        while (y < this->_height)
+        {
+            x = 0;
+            while (x < this->_width)
+            {
+                *cells = (this->_data[z][y][x] != 0);
+                cells++;
+                x++;
+            }
+            y++;
+        }
+        z++;
+    }
+    (void)this->unlock_internal(lock_acquired);
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
 void game_map3d::toggle_obstacle(ft_size_t x, ft_size_t y, ft_size_t z,
     game_pathfinding *listener)
 {
@@ -58,6 +58,7 @@ class game_map3d
         int32_t     get(ft_size_t x, ft_size_t y, ft_size_t z) const;
         void    set(ft_size_t x, ft_size_t y, ft_size_t z, int32_t value);
         ft_bool    is_obstacle(ft_size_t x, ft_size_t y, ft_size_t z) const;
+        int32_t     copy_obstacles(uint8_t *cells) const noexcept;
         void    toggle_obstacle(ft_size_t x, ft_size_t y, ft_size_t z,
                     game_pathfinding *listener = ft_nullptr);
         ft_size_t  get_width() const;
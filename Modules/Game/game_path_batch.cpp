@@ -0,0 +1,383 @@
+#include "game_path_batch.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../PThread/pthread_internal.hpp"
+#include "../PThread/pthread.hpp"
+#include <cstdint>
+#include <new>
+
+#define GAME_PATH_LANE_PENDING 0
+#define GAME_PATH_LANE_STARTED 1
+#define GAME_PATH_LANE_REVOKED 2
+
+thread_local int32_t game_path_batch::_last_error = FT_ERR_SUCCESS;
+
+game_path_batch::game_path_batch() noexcept
+    : _cells(ft_nullptr), _cell_capacity(0), _dimensions(), _lanes(ft_nullptr),
+      _lane_count(0), _requests(ft_nullptr), _request_count(0), _next_request(0),
+      _mutex(ft_nullptr),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+game_path_batch::~game_path_batch() noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return ;
+    (void)this->destroy();
+    return ;
+}
+
+int32_t game_path_batch::set_error(int32_t error_code) noexcept
+{
+    game_path_batch::_last_error = error_code;
+    return (error_code);
+}
+
+int32_t game_path_batch::lock_internal(ft_bool *lock_acquired) const noexcept
+{
+    int32_t lock_error;
+
+    if (lock_acquired != ft_nullptr)
+        *lock_acquired = FT_FALSE;
+    lock_error = pt_recursive_mutex_lock_if_not_null(this->_mutex);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (lock_error);
+    if (lock_acquired != ft_nullptr)
+        *lock_acquired = FT_TRUE;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_batch::unlock_internal(ft_bool lock_acquired) const noexcept
+{
+    if (lock_acquired == FT_FALSE)
+        return (FT_ERR_SUCCESS);
+    (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+    return (FT_ERR_SUCCESS);
+}
+
+void game_path_batch::release() noexcept
+{
+    ft_size_t lane;
+
+    lane = 0;
+    while (lane < this->_lane_count)
+    {
+        game_path_scratch_destroy(&this->_lanes[lane]);
+        lane++;
+    }
+    cma_free(this->_lanes);
+    cma_free(this->_cells);
+    this->_lanes = ft_nullptr;
+    this->_lane_count = 0;
+    this->_cells = ft_nullptr;
+    this->_cell_capacity = 0;
+    this->_requests = ft_nullptr;
+    this->_request_count = 0;
+    return ;
+}
+
+int32_t game_path_batch::initialize() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "game_path_batch::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    this->release();
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_batch::destroy() noexcept
+{
+    int32_t disable_error;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    this->release();
+    disable_error = this->disable_thread_safety();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    this->set_error(disable_error);
+    return (disable_error);
+}
+
+int32_t game_path_batch::enable_thread_safety() noexcept
+{
+    pt_recursive_mutex *mutex_pointer;
+    int32_t initialize_error;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_batch::enable_thread_safety");
+    if (this->_mutex != ft_nullptr)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    mutex_pointer = new (std::nothrow) pt_recursive_mutex();
+    if (mutex_pointer == ft_nullptr)
+    {
+        this->set_error(FT_ERR_NO_MEMORY);
+        return (FT_ERR_NO_MEMORY);
+    }
+    initialize_error = mutex_pointer->initialize();
+    if (initialize_error != FT_ERR_SUCCESS)
+    {
+        delete mutex_pointer;
+        this->set_error(initialize_error);
+        return (initialize_error);
+    }
+    this->_mutex = mutex_pointer;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_batch::disable_thread_safety() noexcept
+{
+    pt_recursive_mutex *old_mutex;
+    int32_t destroy_error;
+
+    if (this->_mutex == ft_nullptr)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    old_mutex = this->_mutex;
+    this->_mutex = ft_nullptr;
+    destroy_error = old_mutex->destroy();
+    delete old_mutex;
+    this->set_error(destroy_error);
+    return (destroy_error);
+}
+
+ft_bool game_path_batch::is_thread_safe() const noexcept
+{
+    return (this->_mutex != ft_nullptr);
+}
+
+int32_t game_path_batch::reserve_lanes(ft_size_t lane_count) noexcept
+{
+    game_path_scratch *resized_lanes;
+
+    if (lane_count <= this->_lane_count)
+        return (FT_ERR_SUCCESS);
+    resized_lanes = static_cast<game_path_scratch *>(cma_realloc(this->_lanes,
+                lane_count * sizeof(game_path_scratch)));
+    if (resized_lanes == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    this->_lanes = resized_lanes;
+    while (this->_lane_count < lane_count)
+    {
+        game_path_scratch_init(&this->_lanes[this->_lane_count]);
+        this->_lane_count++;
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_batch::snapshot(const game_map3d &grid) noexcept
+{
+    ft_bool grid_lock_acquired;
+    ft_size_t cell_count;
+    uint8_t *resized_cells;
+    int32_t error_code;
+
+    grid_lock_acquired = FT_FALSE;
+    error_code = grid.lock(&grid_lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    this->_dimensions[0] = grid.get_width();
+    this->_dimensions[1] = grid.get_height();
+    this->_dimensions[2] = grid.get_depth();
+    cell_count = this->_dimensions[0] * this->_dimensions[1] * this->_dimensions[2];
+    if (cell_count > this->_cell_capacity)
+    {
+        resized_cells = static_cast<uint8_t *>(cma_realloc(this->_cells, cell_count));
+        if (resized_cells == ft_nullptr)
+            error_code = FT_ERR_NO_MEMORY;
+        else
+        {
+            this->_cells = resized_cells;
+            this->_cell_capacity = cell_count;
+        }
+    }
+    if (error_code == FT_ERR_SUCCESS && cell_count > 0)
+        error_code = grid.copy_obstacles(this->_cells);
+    grid.unlock(grid_lock_acquired);
+    return (error_code);
+}
+
+void game_path_batch::run_lane(ft_size_t lane) noexcept
+{
+    game_path_request *request;
+    ft_size_t index;
+
+    index = this->_next_request.fetch_add(1, std::memory_order_relaxed);
+    while (index < this->_request_count)
+    {
+        request = &this->_requests[index];
+        if (request->out_path == ft_nullptr)
+            request->result = FT_ERR_INVALID_ARGUMENT;
+        else
+            request->result = game_path_astar_cells(this->_cells, this->_dimensions,
+                    &this->_lanes[lane], request->start_x, request->start_y,
+                    request->start_z, request->goal_x, request->goal_y, request->goal_z,
+                    *request->out_path);
+        index = this->_next_request.fetch_add(1, std::memory_order_relaxed);
+    }
+    return ;
+}
+
+game_path_batch::lane_claims *game_path_batch::create_claims(ft_size_t lane_count) noexcept
+{
+    lane_claims *claims;
+    ft_size_t lane;
+
+    claims = static_cast<lane_claims *>(cma_malloc(sizeof(lane_claims)
+                + lane_count * sizeof(std::atomic<uint8_t>)));
+    if (claims == ft_nullptr)
+        return (ft_nullptr);
+    new (&claims->references) std::atomic<uint32_t>(1);
+    new (&claims->running) std::atomic<uint32_t>(0);
+    claims->states = reinterpret_cast<std::atomic<uint8_t> *>(claims + 1);
+    lane = 0;
+    while (lane < lane_count)
+    {
+        new (&claims->states[lane]) std::atomic<uint8_t>(GAME_PATH_LANE_PENDING);
+        lane++;
+    }
+    return (claims);
+}
+
+void game_path_batch::release_claims(lane_claims *claims) noexcept
+{
+    if (claims->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        cma_free(claims);
+    return ;
+}
+
+void game_path_batch::finish_claimed_lane(lane_claims *claims) noexcept
+{
+    if (claims->running.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        (void)pt_thread_wake_one_uint32(&claims->running);
+    return ;
+}
+
+void game_path_batch::run_claimed_lane(lane_claims *claims, ft_size_t lane) noexcept
+{
+    uint8_t expected;
+
+    expected = GAME_PATH_LANE_PENDING;
+    if (claims->states[lane].compare_exchange_strong(expected, GAME_PATH_LANE_STARTED,
+            std::memory_order_acq_rel))
+    {
+        this->run_lane(lane);
+        game_path_batch::finish_claimed_lane(claims);
+    }
+    game_path_batch::release_claims(claims);
+    return ;
+}
+
+int32_t game_path_batch::run(const game_map3d &grid, ft_thread_pool &pool,
+    game_path_request *requests, ft_size_t request_count, ft_size_t lane_count) noexcept
+{
+    ft_bool lock_acquired;
+    lane_claims *claims;
+    ft_size_t lane;
+    uint32_t running;
+    uint8_t expected;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_batch::run");
+    if (requests == ft_nullptr && request_count != 0)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    if (lane_count == 0)
+        lane_count = 1;
+    if (lane_count > request_count)
+        lane_count = request_count;
+    error_code = this->snapshot(grid);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = this->reserve_lanes(lane_count);
+    if (error_code != FT_ERR_SUCCESS || request_count == 0)
+    {
+        (void)this->unlock_internal(lock_acquired);
+        return (this->set_error(error_code));
+    }
+    this->_requests = requests;
+    this->_request_count = request_count;
+    this->_next_request.store(0, std::memory_order_relaxed);
+    // Lanes pull requests from a shared counter, so a lane that never starts
+    // only costs parallelism; the calling thread always runs lane zero. Once
+    // it runs dry, lanes still queued (possibly behind this very call on a
+    // pool worker) are revoked and only lanes that started are awaited. The
+    // claims block is reference counted because revoked tasks still run later.
+    claims = ft_nullptr;
+    if (lane_count > 1)
+        claims = game_path_batch::create_claims(lane_count);
+    lane = 1;
+    while (claims != ft_nullptr && lane < lane_count)
+    {
+        claims->references.fetch_add(1, std::memory_order_relaxed);
+        claims->running.fetch_add(1, std::memory_order_relaxed);
+        pool.submit([this, claims, lane]() { this->run_claimed_lane(claims, lane); });
+        if (pool.get_error() != FT_ERR_SUCCESS)
+        {
+            claims->states[lane].store(GAME_PATH_LANE_REVOKED, std::memory_order_relaxed);
+            claims->running.fetch_sub(1, std::memory_order_relaxed);
+            claims->references.fetch_sub(1, std::memory_order_relaxed);
+        }
+        lane++;
+    }
+    this->run_lane(0);
+    lane = 1;
+    while (claims != ft_nullptr && lane < lane_count)
+    {
+        expected = GAME_PATH_LANE_PENDING;
+        if (claims->states[lane].compare_exchange_strong(expected,
+                GAME_PATH_LANE_REVOKED, std::memory_order_acq_rel))
+            game_path_batch::finish_claimed_lane(claims);
+        lane++;
+    }
+    if (claims != ft_nullptr)
+    {
+        running = claims->running.load(std::memory_order_acquire);
+        while (running != 0)
+        {
+            (void)pt_thread_wait_uint32(&claims->running, running);
+            running = claims->running.load(std::memory_order_acquire);
+        }
+        game_path_batch::release_claims(claims);
+    }
+    this->_requests = ft_nullptr;
+    this->_request_count = 0;
+    (void)this->unlock_internal(lock_acquired);
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+ft_size_t game_path_batch::get_lane_count() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_batch::get_lane_count");
+    return (this->_lane_count);
+}
+
+int32_t game_path_batch::get_error() const noexcept
+{
+    return (game_path_batch::_last_error);
+}
+
+const char *game_path_batch::get_error_str() const noexcept
+{
+    return (ft_strerror(game_path_batch::_last_error));
+}
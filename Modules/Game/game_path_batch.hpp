@@ -0,0 +1,88 @@
+#ifndef GAME_PATH_BATCH_HPP
+# define GAME_PATH_BATCH_HPP
+
+#include "game_pathfinding.hpp"
+#include "game_map3d.hpp"
+#include "../Template/vector.hpp"
+#include "../Threading/thread_pool.hpp"
+#include "../Errno/errno.hpp"
+#include "../Basic/basic.hpp"
+#include "../PThread/recursive_mutex.hpp"
+#include <stdint.h>
+#include <atomic>
+
+typedef struct game_path_request
+{
+    ft_size_t                   start_x;
+    ft_size_t                   start_y;
+    ft_size_t                   start_z;
+    ft_size_t                   goal_x;
+    ft_size_t                   goal_y;
+    ft_size_t                   goal_z;
+    ft_vector<game_path_step>   *out_path;
+    int32_t                     result;
+} game_path_request;
+
+class game_path_batch
+{
+    #ifdef LIBFT_TEST_BUILD
+        public:
+    #else
+        private:
+    #endif
+        struct lane_claims
+        {
+            std::atomic<uint32_t>   references;
+            std::atomic<uint32_t>   running;
+            std::atomic<uint8_t>    *states;
+        };
+
+        uint8_t                 *_cells;
+        ft_size_t               _cell_capacity;
+        ft_size_t               _dimensions[3];
+        game_path_scratch       *_lanes;
+        ft_size_t               _lane_count;
+        game_path_request       *_requests;
+        ft_size_t               _request_count;
+        std::atomic<ft_size_t>  _next_request;
+        pt_recursive_mutex      *_mutex;
+        uint8_t                 _initialised_state;
+        static thread_local int32_t _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        static lane_claims *create_claims(ft_size_t lane_count) noexcept;
+        static void release_claims(lane_claims *claims) noexcept;
+        static void finish_claimed_lane(lane_claims *claims) noexcept;
+        int32_t     lock_internal(ft_bool *lock_acquired) const noexcept;
+        int32_t     unlock_internal(ft_bool lock_acquired) const noexcept;
+
+        void        release() noexcept;
+        int32_t     reserve_lanes(ft_size_t lane_count) noexcept;
+        int32_t     snapshot(const game_map3d &grid) noexcept;
+        void        run_lane(ft_size_t lane) noexcept;
+        void        run_claimed_lane(lane_claims *claims, ft_size_t lane) noexcept;
+
+    public:
+        game_path_batch() noexcept;
+        game_path_batch(const game_path_batch &other) = delete;
+        game_path_batch(game_path_batch &&other) = delete;
+        ~game_path_batch() noexcept;
+        game_path_batch &operator=(const game_path_batch &other) = delete;
+        game_path_batch &operator=(game_path_batch &&other) = delete;
+
+        int32_t     initialize() noexcept;
+        int32_t     destroy() noexcept;
+        int32_t     enable_thread_safety() noexcept;
+        int32_t     disable_thread_safety() noexcept;
+        ft_bool     is_thread_safe() const noexcept;
+
+        int32_t     run(const game_map3d &grid, ft_thread_pool &pool,
+                        game_path_request *requests, ft_size_t request_count,
+                        ft_size_t lane_count) noexcept;
+
+        ft_size_t   get_lane_count() const noexcept;
+        int32_t     get_error() const noexcept;
+        const char  *get_error_str() const noexcept;
+};
+
+#endif
@@ -0,0 +1,1501 @@
+#include "game_path_hierarchy.hpp"
+#include "game_pathfinding_internal.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../PThread/pthread_internal.hpp"
+#include <cstdint>
+#include <new>
+
+#define GAME_PATH_HIERARCHY_FACE_BLOCKED UINT32_MAX
+#define GAME_PATH_HIERARCHY_FACE_OPEN (UINT32_MAX - 1)
+#define GAME_PATH_HIERARCHY_UNREACHABLE UINT32_MAX
+#define GAME_PATH_HIERARCHY_BLOCKED (UINT32_MAX - 1)
+#define GAME_PATH_HIERARCHY_MINIMUM_CAPACITY 16
+
+thread_local int32_t game_path_hierarchy::_last_error = FT_ERR_SUCCESS;
+
+static int32_t game_path_hierarchy_grow(uint32_t **array, uint32_t *capacity,
+    uint32_t required) noexcept
+{
+    uint32_t *resized_array;
+    uint32_t new_capacity;
+
+    if (required <= *capacity)
+        return (FT_ERR_SUCCESS);
+    new_capacity = *capacity * 2;
+    if (new_capacity < GAME_PATH_HIERARCHY_MINIMUM_CAPACITY)
+        new_capacity = GAME_PATH_HIERARCHY_MINIMUM_CAPACITY;
+    if (new_capacity < required)
+        new_capacity = required;
+    resized_array = static_cast<uint32_t *>(cma_realloc(*array,
+                new_capacity * sizeof(uint32_t)));
+    if (resized_array == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    *array = resized_array;
+    *capacity = new_capacity;
+    return (FT_ERR_SUCCESS);
+}
+
+static uint32_t game_path_hierarchy_estimate(const uint32_t position[3],
+    const uint32_t goal[3]) noexcept
+{
+    uint32_t estimate;
+    uint8_t axis;
+
+    estimate = 0;
+    axis = 0;
+    while (axis < 3)
+    {
+        if (position[axis] > goal[axis])
+            estimate += position[axis] - goal[axis];
+        else
+            estimate += goal[axis] - position[axis];
+        axis++;
+    }
+    return (estimate);
+}
+
+static int32_t game_path_hierarchy_relax(game_path_scratch *scratch, uint32_t *parent,
+    uint32_t node, uint32_t from, uint32_t cost, const uint32_t position[3],
+    const uint32_t goal[3]) noexcept
+{
+    uint32_t open_stamp;
+
+    open_stamp = scratch->generation * 2;
+    if (scratch->visit_stamp[node] == open_stamp + 1)
+        return (FT_ERR_SUCCESS);
+    if (scratch->visit_stamp[node] == open_stamp && scratch->visit_cost[node] <= cost)
+        return (FT_ERR_SUCCESS);
+    scratch->visit_stamp[node] = open_stamp;
+    scratch->visit_cost[node] = cost;
+    parent[node] = from;
+    return (game_path_heap_push(scratch, ((static_cast<uint64_t>(cost)
+                + game_path_hierarchy_estimate(position, goal)) << 32)
+            | (UINT32_MAX - cost), node));
+}
+
+int32_t game_path_hierarchy::set_error(int32_t error_code) noexcept
+{
+    game_path_hierarchy::_last_error = error_code;
+    return (error_code);
+}
+
+int32_t game_path_hierarchy::lock_internal(ft_bool *lock_acquired) const noexcept
+{
+    int32_t lock_error;
+
+    if (lock_acquired != ft_nullptr)
+        *lock_acquired = FT_FALSE;
+    lock_error = pt_recursive_mutex_lock_if_not_null(this->_mutex);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (lock_error);
+    if (lock_acquired != ft_nullptr)
+        *lock_acquired = FT_TRUE;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_hierarchy::unlock_internal(ft_bool lock_acquired) const noexcept
+{
+    if (lock_acquired == FT_FALSE)
+        return (FT_ERR_SUCCESS);
+    (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+    return (FT_ERR_SUCCESS);
+}
+
+game_path_hierarchy::game_path_hierarchy() noexcept
+    : _nodes(ft_nullptr), _node_count(0), _node_capacity(0), _free_nodes(ft_nullptr),
+      _free_count(0), _alive_count(0), _occupancy(ft_nullptr), _clusters(ft_nullptr), _cluster_count(0),
+      _dirty_count(0), _cluster_size(0), _dimensions(), _cluster_counts(),
+      _cluster_strides(), _face_marks(ft_nullptr), _face_epoch(0),
+      _face_labels(ft_nullptr), _face_stack(ft_nullptr), _face_sizes(ft_nullptr),
+      _cluster_cells(ft_nullptr), _cluster_queue(ft_nullptr), _cluster_costs(ft_nullptr),
+      _cluster_lower(), _cluster_extent(),
+      _edge_costs(ft_nullptr), _edge_capacity(0), _route(ft_nullptr), _route_capacity(0),
+      _abstract_parent(ft_nullptr), _abstract_capacity(0), _segment(ft_nullptr),
+      _segment_capacity(0), _abstract_scratch(), _cache(), _cache_tick(0), _cache_hits(0), _cache_misses(0),
+      _mutex(ft_nullptr), _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    uint32_t index;
+
+    game_path_scratch_init(&this->_abstract_scratch);
+    index = 0;
+    while (index < GAME_PATH_HIERARCHY_CACHE_SIZE)
+    {
+        this->_cache[index].nodes = ft_nullptr;
+        this->_cache[index].node_count = 0;
+        this->_cache[index].node_capacity = 0;
+        this->_cache[index].cells = ft_nullptr;
+        this->_cache[index].cell_count = 0;
+        this->_cache[index].cell_capacity = 0;
+        this->_cache[index].last_used = 0;
+        this->_cache[index].valid = FT_FALSE;
+        index++;
+    }
+    return ;
+}
+
+game_path_hierarchy::~game_path_hierarchy() noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return ;
+    (void)this->destroy();
+    return ;
+}
+
+void game_path_hierarchy::release() noexcept
+{
+    uint32_t index;
+
+    index = 0;
+    while (index < this->_cluster_count)
+    {
+        cma_free(this->_clusters[index].nodes);
+        cma_free(this->_clusters[index].positions);
+        cma_free(this->_clusters[index].distances);
+        index++;
+    }
+    index = 0;
+    while (index < GAME_PATH_HIERARCHY_CACHE_SIZE)
+    {
+        cma_free(this->_cache[index].nodes);
+        this->_cache[index].nodes = ft_nullptr;
+        this->_cache[index].node_count = 0;
+        this->_cache[index].node_capacity = 0;
+        cma_free(this->_cache[index].cells);
+        this->_cache[index].cells = ft_nullptr;
+        this->_cache[index].cell_count = 0;
+        this->_cache[index].cell_capacity = 0;
+        this->_cache[index].valid = FT_FALSE;
+        index++;
+    }
+    cma_free(this->_clusters);
+    cma_free(this->_occupancy);
+    cma_free(this->_nodes);
+    cma_free(this->_free_nodes);
+    cma_free(this->_face_marks);
+    cma_free(this->_face_labels);
+    cma_free(this->_face_stack);
+    cma_free(this->_face_sizes);
+    cma_free(this->_cluster_cells);
+    cma_free(this->_cluster_queue);
+    cma_free(this->_cluster_costs);
+    cma_free(this->_edge_costs);
+    cma_free(this->_route);
+    cma_free(this->_abstract_parent);
+    cma_free(this->_segment);
+    this->_clusters = ft_nullptr;
+    this->_occupancy = ft_nullptr;
+    this->_nodes = ft_nullptr;
+    this->_free_nodes = ft_nullptr;
+    this->_face_marks = ft_nullptr;
+    this->_face_labels = ft_nullptr;
+    this->_face_stack = ft_nullptr;
+    this->_face_sizes = ft_nullptr;
+    this->_cluster_cells = ft_nullptr;
+    this->_cluster_queue = ft_nullptr;
+    this->_cluster_costs = ft_nullptr;
+    this->_edge_costs = ft_nullptr;
+    this->_route = ft_nullptr;
+    this->_abstract_parent = ft_nullptr;
+    this->_segment = ft_nullptr;
+    this->_cluster_count = 0;
+    this->_node_count = 0;
+    this->_node_capacity = 0;
+    this->_free_count = 0;
+    this->_alive_count = 0;
+    this->_dirty_count = 0;
+    this->_cluster_size = 0;
+    this->_face_epoch = 0;
+    this->_edge_capacity = 0;
+    this->_route_capacity = 0;
+    this->_abstract_capacity = 0;
+    this->_segment_capacity = 0;
+    return ;
+}
+
+int32_t game_path_hierarchy::initialize() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "game_path_hierarchy::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    this->release();
+    this->_cache_tick = 0;
+    this->_cache_hits = 0;
+    this->_cache_misses = 0;
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_hierarchy::destroy() noexcept
+{
+    int32_t disable_error;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    this->release();
+    game_path_scratch_destroy(&this->_abstract_scratch);
+    disable_error = this->disable_thread_safety();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    this->set_error(disable_error);
+    return (disable_error);
+}
+
+int32_t game_path_hierarchy::enable_thread_safety() noexcept
+{
+    pt_recursive_mutex *mutex_pointer;
+    int32_t initialize_error;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::enable_thread_safety");
+    if (this->_mutex != ft_nullptr)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    mutex_pointer = new (std::nothrow) pt_recursive_mutex();
+    if (mutex_pointer == ft_nullptr)
+    {
+        this->set_error(FT_ERR_NO_MEMORY);
+        return (FT_ERR_NO_MEMORY);
+    }
+    initialize_error = mutex_pointer->initialize();
+    if (initialize_error != FT_ERR_SUCCESS)
+    {
+        delete mutex_pointer;
+        this->set_error(initialize_error);
+        return (initialize_error);
+    }
+    this->_mutex = mutex_pointer;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_hierarchy::disable_thread_safety() noexcept
+{
+    pt_recursive_mutex *old_mutex;
+    int32_t destroy_error;
+
+    if (this->_mutex == ft_nullptr)
+    {
+        this->set_error(FT_ERR_SUCCESS);
+        return (FT_ERR_SUCCESS);
+    }
+    old_mutex = this->_mutex;
+    this->_mutex = ft_nullptr;
+    destroy_error = old_mutex->destroy();
+    delete old_mutex;
+    this->set_error(destroy_error);
+    return (destroy_error);
+}
+
+ft_bool game_path_hierarchy::is_thread_safe() const noexcept
+{
+    return (this->_mutex != ft_nullptr);
+}
+
+void game_path_hierarchy::cluster_box(uint32_t cluster, ft_size_t lower[3],
+    ft_size_t upper[3]) const noexcept
+{
+    ft_size_t remainder;
+    uint8_t axis;
+
+    remainder = cluster;
+    axis = 0;
+    while (axis < 3)
+    {
+        lower[axis] = (remainder % this->_cluster_counts[axis]) * this->_cluster_size;
+        remainder /= this->_cluster_counts[axis];
+        upper[axis] = lower[axis] + this->_cluster_size;
+        if (upper[axis] > this->_dimensions[axis])
+            upper[axis] = this->_dimensions[axis];
+        axis++;
+    }
+    return ;
+}
+
+uint32_t game_path_hierarchy::cluster_of(ft_size_t x, ft_size_t y, ft_size_t z) const noexcept
+{
+    return (static_cast<uint32_t>(((z / this->_cluster_size) * this->_cluster_counts[1]
+                + y / this->_cluster_size) * this->_cluster_counts[0]
+            + x / this->_cluster_size));
+}
+
+int32_t game_path_hierarchy::add_node(ft_size_t cell, uint32_t cluster, uint32_t face,
+    uint32_t *node_id) noexcept
+{
+    game_path_hierarchy_cluster *owner;
+    game_path_hierarchy_node *resized_nodes;
+    uint32_t new_capacity;
+    uint32_t free_capacity;
+    uint32_t identifier;
+    int32_t error_code;
+
+    owner = &this->_clusters[cluster];
+    error_code = game_path_hierarchy_grow(&owner->nodes, &owner->node_capacity,
+            owner->node_count + 1);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = game_path_hierarchy_grow(&owner->positions, &owner->position_capacity,
+                owner->node_count * 3 + 3);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (this->_free_count > 0)
+    {
+        this->_free_count--;
+        identifier = this->_free_nodes[this->_free_count];
+    }
+    else
+    {
+        if (this->_node_count == this->_node_capacity)
+        {
+            new_capacity = this->_node_capacity * 2;
+            if (new_capacity < GAME_PATH_HIERARCHY_MINIMUM_CAPACITY)
+                new_capacity = GAME_PATH_HIERARCHY_MINIMUM_CAPACITY;
+            resized_nodes = static_cast<game_path_hierarchy_node *>(cma_realloc(
+                        this->_nodes, new_capacity * sizeof(game_path_hierarchy_node)));
+            if (resized_nodes == ft_nullptr)
+                return (FT_ERR_NO_MEMORY);
+            this->_nodes = resized_nodes;
+            free_capacity = this->_node_capacity;
+            error_code = game_path_hierarchy_grow(&this->_free_nodes, &free_capacity,
+                    new_capacity);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            this->_node_capacity = new_capacity;
+        }
+        identifier = this->_node_count;
+        this->_node_count++;
+    }
+    this->_nodes[identifier].cell = cell;
+    this->_nodes[identifier].position[0] = cell % this->_dimensions[0];
+    this->_nodes[identifier].position[1] = (cell / this->_dimensions[0]) % this->_dimensions[1];
+    this->_nodes[identifier].position[2] = cell / (this->_dimensions[0] * this->_dimensions[1]);
+    owner->positions[owner->node_count * 3] = static_cast<uint32_t>(
+            this->_nodes[identifier].position[0]);
+    owner->positions[owner->node_count * 3 + 1] = static_cast<uint32_t>(
+            this->_nodes[identifier].position[1]);
+    owner->positions[owner->node_count * 3 + 2] = static_cast<uint32_t>(
+            this->_nodes[identifier].position[2]);
+    this->_nodes[identifier].cluster = cluster;
+    this->_nodes[identifier].face = face;
+    this->_nodes[identifier].partner = identifier;
+    this->_nodes[identifier].slot = owner->node_count;
+    this->_nodes[identifier].alive = FT_TRUE;
+    owner->nodes[owner->node_count] = identifier;
+    owner->node_count++;
+    this->_alive_count++;
+    *node_id = identifier;
+    return (FT_ERR_SUCCESS);
+}
+
+void game_path_hierarchy::remove_face_nodes(uint32_t cluster, uint32_t face) noexcept
+{
+    game_path_hierarchy_cluster *owner;
+    uint32_t identifier;
+    uint32_t index;
+
+    owner = &this->_clusters[cluster];
+    index = 0;
+    while (index < owner->node_count)
+    {
+        identifier = owner->nodes[index];
+        if (this->_nodes[identifier].face != face)
+        {
+            index++;
+            continue ;
+        }
+        this->_nodes[identifier].alive = FT_FALSE;
+        this->_free_nodes[this->_free_count] = identifier;
+        this->_free_count++;
+        this->_alive_count--;
+        owner->node_count--;
+        if (index < owner->node_count)
+        {
+            owner->nodes[index] = owner->nodes[owner->node_count];
+            owner->positions[index * 3] = owner->positions[owner->node_count * 3];
+            owner->positions[index * 3 + 1] = owner->positions[owner->node_count * 3 + 1];
+            owner->positions[index * 3 + 2] = owner->positions[owner->node_count * 3 + 2];
+            this->_nodes[owner->nodes[index]].slot = index;
+        }
+    }
+    return ;
+}
+
+int32_t game_path_hierarchy::rebuild_face(uint32_t owner, uint8_t axis) noexcept
+{
+    ft_size_t lower[3];
+    ft_size_t upper[3];
+    ft_size_t coordinates[3];
+    ft_size_t stride[3];
+    ft_size_t width;
+    ft_size_t height;
+    ft_size_t cell;
+    uint32_t face;
+    uint32_t other;
+    uint32_t component_count;
+    uint32_t stack_count;
+    uint32_t index;
+    uint32_t current;
+    uint32_t first_node;
+    uint32_t second_node;
+    uint8_t first_axis;
+    uint8_t second_axis;
+    int32_t error_code;
+
+    face = owner * 3 + axis;
+    other = owner + static_cast<uint32_t>(this->_cluster_strides[axis]);
+    this->remove_face_nodes(owner, face);
+    this->remove_face_nodes(other, face);
+    this->cluster_box(owner, lower, upper);
+    first_axis = (axis == 0) ? 1 : 0;
+    second_axis = (axis == 2) ? 1 : 2;
+    width = upper[first_axis] - lower[first_axis];
+    height = upper[second_axis] - lower[second_axis];
+    stride[0] = 1;
+    stride[1] = this->_dimensions[0];
+    stride[2] = this->_dimensions[0] * this->_dimensions[1];
+    coordinates[axis] = upper[axis] - 1;
+    index = 0;
+    while (index < width * height)
+    {
+        coordinates[first_axis] = lower[first_axis] + index % width;
+        coordinates[second_axis] = lower[second_axis] + index / width;
+        cell = coordinates[0] + coordinates[1] * stride[1] + coordinates[2] * stride[2];
+        this->_face_labels[index] = GAME_PATH_HIERARCHY_FACE_BLOCKED;
+        if (this->_occupancy[cell] == 0 && this->_occupancy[cell + stride[axis]] == 0)
+            this->_face_labels[index] = GAME_PATH_HIERARCHY_FACE_OPEN;
+        index++;
+    }
+    component_count = 0;
+    index = 0;
+    while (index < width * height)
+    {
+        if (this->_face_labels[index] != GAME_PATH_HIERARCHY_FACE_OPEN)
+        {
+            index++;
+            continue ;
+        }
+        this->_face_sizes[component_count] = 0;
+        this->_face_labels[index] = component_count;
+        this->_face_stack[0] = index;
+        stack_count = 1;
+        while (stack_count > 0)
+        {
+            stack_count--;
+            current = this->_face_stack[stack_count];
+            this->_face_sizes[component_count]++;
+            if (current % width + 1 < width
+                && this->_face_labels[current + 1] == GAME_PATH_HIERARCHY_FACE_OPEN)
+            {
+                this->_face_labels[current + 1] = component_count;
+                this->_face_stack[stack_count++] = current + 1;
+            }
+            if (current % width > 0
+                && this->_face_labels[current - 1] == GAME_PATH_HIERARCHY_FACE_OPEN)
+            {
+                this->_face_labels[current - 1] = component_count;
+                this->_face_stack[stack_count++] = current - 1;
+            }
+            if (current + width < width * height
+                && this->_face_labels[current + width] == GAME_PATH_HIERARCHY_FACE_OPEN)
+            {
+                this->_face_labels[current + width] = component_count;
+                this->_face_stack[stack_count++] = static_cast<uint32_t>(current + width);
+            }
+            if (current >= width
+                && this->_face_labels[current - width] == GAME_PATH_HIERARCHY_FACE_OPEN)
+            {
+                this->_face_labels[current - width] = component_count;
+                this->_face_stack[stack_count++] = static_cast<uint32_t>(current - width);
+            }
+        }
+        component_count++;
+        index++;
+    }
+    index = 0;
+    while (index < component_count)
+        this->_face_stack[index++] = 0;
+    index = 0;
+    while (index < width * height)
+    {
+        current = this->_face_labels[index];
+        if (current >= component_count)
+        {
+            index++;
+            continue ;
+        }
+        if (this->_face_stack[current] == this->_face_sizes[current] / 2)
+        {
+            coordinates[first_axis] = lower[first_axis] + index % width;
+            coordinates[second_axis] = lower[second_axis] + index / width;
+            cell = coordinates[0] + coordinates[1] * stride[1] + coordinates[2] * stride[2];
+            error_code = this->add_node(cell, owner, face, &first_node);
+            if (error_code == FT_ERR_SUCCESS)
+                error_code = this->add_node(cell + stride[axis], other, face, &second_node);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            this->_nodes[first_node].partner = second_node;
+            this->_nodes[second_node].partner = first_node;
+        }
+        this->_face_stack[current]++;
+        index++;
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+void game_path_hierarchy::refresh_occupancy(const game_map3d &grid, uint32_t cluster) noexcept
+{
+    ft_size_t lower[3];
+    ft_size_t upper[3];
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+    ft_size_t cell;
+
+    this->cluster_box(cluster, lower, upper);
+    z = lower[2];
+    while (z < upper[2])
+    {
+        y = lower[1];
+        while (y < upper[1])
+        {
+            cell = (z * this->_dimensions[1] + y) * this->_dimensions[0] + lower[0];
+            x = lower[0];
+            while (x < upper[0])
+            {
+                this->_occupancy[cell] = (grid.get(x, y, z) != 0);
+                cell++;
+                x++;
+            }
+            y++;
+        }
+        z++;
+    }
+    return ;
+}
+
+void game_path_hierarchy::load_cluster(uint32_t cluster) noexcept
+{
+    ft_size_t upper[3];
+    ft_size_t volume;
+    ft_size_t y;
+    ft_size_t z;
+    ft_size_t index;
+
+    this->cluster_box(cluster, this->_cluster_lower, upper);
+    this->_cluster_extent[0] = upper[0] - this->_cluster_lower[0] + 2;
+    this->_cluster_extent[1] = upper[1] - this->_cluster_lower[1] + 2;
+    this->_cluster_extent[2] = upper[2] - this->_cluster_lower[2] + 2;
+    volume = this->_cluster_extent[0] * this->_cluster_extent[1] * this->_cluster_extent[2];
+    ft_memset(this->_cluster_cells, 1, volume);
+    z = this->_cluster_lower[2];
+    while (z < upper[2])
+    {
+        y = this->_cluster_lower[1];
+        while (y < upper[1])
+        {
+            index = ((z - this->_cluster_lower[2] + 1) * this->_cluster_extent[1]
+                    + (y - this->_cluster_lower[1] + 1)) * this->_cluster_extent[0] + 1;
+            ft_memcpy(this->_cluster_cells + index, this->_occupancy
+                + (z * this->_dimensions[1] + y) * this->_dimensions[0]
+                + this->_cluster_lower[0], this->_cluster_extent[0] - 2);
+            y++;
+        }
+        z++;
+    }
+    return ;
+}
+
+ft_size_t game_path_hierarchy::snapshot_index(ft_size_t cell) const noexcept
+{
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+
+    x = cell % this->_dimensions[0];
+    cell /= this->_dimensions[0];
+    y = cell % this->_dimensions[1];
+    z = cell / this->_dimensions[1];
+    return ((x - this->_cluster_lower[0] + 1)
+        + ((z - this->_cluster_lower[2] + 1) * this->_cluster_extent[1]
+            + (y - this->_cluster_lower[1] + 1)) * this->_cluster_extent[0]);
+}
+
+void game_path_hierarchy::flood_snapshot(ft_size_t source, ft_size_t stop) noexcept
+{
+    ft_size_t offset[6];
+    ft_size_t volume;
+    ft_size_t local;
+    ft_size_t neighbor;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t cost;
+    uint32_t unvisited;
+    uint8_t direction;
+
+    offset[0] = 1;
+    offset[1] = static_cast<ft_size_t>(0) - 1;
+    offset[2] = this->_cluster_extent[0];
+    offset[3] = static_cast<ft_size_t>(0) - offset[2];
+    offset[4] = this->_cluster_extent[0] * this->_cluster_extent[1];
+    offset[5] = static_cast<ft_size_t>(0) - offset[4];
+    volume = offset[4] * this->_cluster_extent[2];
+    local = 0;
+    while (local < volume)
+    {
+        if (this->_cluster_cells[local] != 0)
+            this->_cluster_costs[local] = GAME_PATH_HIERARCHY_BLOCKED;
+        else
+            this->_cluster_costs[local] = GAME_PATH_HIERARCHY_UNREACHABLE;
+        local++;
+    }
+    // The snapshot carries a blocked border, so neighbours need no bounds checks,
+    // and the relax step is written without branches because obstacles are random.
+    this->_cluster_costs[source] = 0;
+    this->_cluster_queue[0] = static_cast<uint32_t>(source);
+    head = 0;
+    tail = 1;
+    while (head < tail)
+    {
+        local = this->_cluster_queue[head++];
+        if (local == stop)
+            break ;
+        cost = this->_cluster_costs[local] + 1;
+        direction = 0;
+        while (direction < 6)
+        {
+            neighbor = local + offset[direction];
+            unvisited = (this->_cluster_costs[neighbor] == GAME_PATH_HIERARCHY_UNREACHABLE);
+            this->_cluster_costs[neighbor] = unvisited ? cost : this->_cluster_costs[neighbor];
+            this->_cluster_queue[tail] = static_cast<uint32_t>(neighbor);
+            tail += unvisited;
+            direction++;
+        }
+    }
+    return ;
+}
+
+void game_path_hierarchy::flood_cluster(uint32_t cluster, ft_size_t cell,
+    uint32_t *costs) noexcept
+{
+    game_path_hierarchy_cluster *owner;
+    uint32_t index;
+
+    this->flood_snapshot(this->snapshot_index(cell), FT_SYSTEM_SIZE_MAX);
+    owner = &this->_clusters[cluster];
+    index = 0;
+    while (index < owner->node_count)
+    {
+        costs[index] = this->_cluster_costs[this->snapshot_index(
+                this->_nodes[owner->nodes[index]].cell)];
+        index++;
+    }
+    return ;
+}
+
+int32_t game_path_hierarchy::rebuild_distances(uint32_t cluster) noexcept
+{
+    game_path_hierarchy_cluster *owner;
+    uint32_t index;
+
+    owner = &this->_clusters[cluster];
+    cma_free(owner->distances);
+    owner->distances = ft_nullptr;
+    if (owner->node_count == 0)
+        return (FT_ERR_SUCCESS);
+    owner->distances = static_cast<uint32_t *>(cma_malloc(
+                static_cast<ft_size_t>(owner->node_count) * owner->node_count
+                * sizeof(uint32_t)));
+    if (owner->distances == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    this->load_cluster(cluster);
+    index = 0;
+    while (index < owner->node_count)
+    {
+        this->flood_cluster(cluster, this->_nodes[owner->nodes[index]].cell,
+            owner->distances + static_cast<ft_size_t>(index) * owner->node_count);
+        index++;
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_hierarchy::repair(const game_map3d &grid) noexcept
+{
+    ft_size_t lower[3];
+    ft_size_t upper[3];
+    ft_size_t position[3];
+    uint32_t cluster;
+    uint32_t neighbor;
+    uint8_t axis;
+    int32_t error_code;
+
+    if (this->_dirty_count == 0)
+        return (FT_ERR_SUCCESS);
+    cluster = 0;
+    while (cluster < this->_cluster_count)
+        this->_clusters[cluster++].affected = FT_FALSE;
+    cluster = 0;
+    while (cluster < this->_cluster_count)
+    {
+        if (this->_clusters[cluster].dirty)
+        {
+            this->_clusters[cluster].affected = FT_TRUE;
+            this->cluster_box(cluster, lower, upper);
+            axis = 0;
+            while (axis < 3)
+            {
+                position[axis] = lower[axis] / this->_cluster_size;
+                if (position[axis] + 1 < this->_cluster_counts[axis])
+                    this->_clusters[cluster + this->_cluster_strides[axis]].affected = FT_TRUE;
+                if (position[axis] > 0)
+                    this->_clusters[cluster - this->_cluster_strides[axis]].affected = FT_TRUE;
+                axis++;
+            }
+        }
+        cluster++;
+    }
+    this->cache_invalidate_affected();
+    cluster = 0;
+    while (cluster < this->_cluster_count)
+    {
+        if (this->_clusters[cluster].dirty)
+            this->refresh_occupancy(grid, cluster);
+        cluster++;
+    }
+    this->_face_epoch++;
+    if (this->_face_epoch == 0)
+    {
+        ft_bzero(this->_face_marks, static_cast<ft_size_t>(this->_cluster_count) * 3
+            * sizeof(uint32_t));
+        this->_face_epoch = 1;
+    }
+    cluster = 0;
+    while (cluster < this->_cluster_count)
+    {
+        if (this->_clusters[cluster].dirty == FT_FALSE)
+        {
+            cluster++;
+            continue ;
+        }
+        this->cluster_box(cluster, lower, upper);
+        axis = 0;
+        while (axis < 3)
+        {
+            position[axis] = lower[axis] / this->_cluster_size;
+            if (position[axis] + 1 < this->_cluster_counts[axis]
+                && this->_face_marks[cluster * 3 + axis] != this->_face_epoch)
+            {
+                this->_face_marks[cluster * 3 + axis] = this->_face_epoch;
+                error_code = this->rebuild_face(cluster, axis);
+                if (error_code != FT_ERR_SUCCESS)
+                    return (error_code);
+            }
+            if (position[axis] > 0)
+            {
+                neighbor = cluster - static_cast<uint32_t>(this->_cluster_strides[axis]);
+                if (this->_face_marks[neighbor * 3 + axis] != this->_face_epoch)
+                {
+                    this->_face_marks[neighbor * 3 + axis] = this->_face_epoch;
+                    error_code = this->rebuild_face(neighbor, axis);
+                    if (error_code != FT_ERR_SUCCESS)
+                        return (error_code);
+                }
+            }
+            axis++;
+        }
+        cluster++;
+    }
+    cluster = 0;
+    while (cluster < this->_cluster_count)
+    {
+        if (this->_clusters[cluster].affected)
+        {
+            error_code = this->rebuild_distances(cluster);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+        }
+        cluster++;
+    }
+    cluster = 0;
+    while (cluster < this->_cluster_count)
+    {
+        this->_clusters[cluster].dirty = FT_FALSE;
+        this->_clusters[cluster].affected = FT_FALSE;
+        cluster++;
+    }
+    this->_dirty_count = 0;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_hierarchy::build_internal(const game_map3d &grid,
+    ft_size_t cluster_size) noexcept
+{
+    ft_size_t face_area;
+    ft_size_t volume;
+    ft_size_t largest;
+    uint32_t index;
+    uint8_t axis;
+
+    this->release();
+    if (cluster_size == 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+    this->_dimensions[0] = grid.get_width();
+    this->_dimensions[1] = grid.get_height();
+    this->_dimensions[2] = grid.get_depth();
+    if (this->_dimensions[0] == 0 || this->_dimensions[1] == 0 || this->_dimensions[2] == 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (this->_dimensions[0] > UINT32_MAX / this->_dimensions[1]
+        || this->_dimensions[0] * this->_dimensions[1] > UINT32_MAX / 2 / this->_dimensions[2])
+        return (FT_ERR_OUT_OF_RANGE);
+    largest = this->_dimensions[0];
+    if (this->_dimensions[1] > largest)
+        largest = this->_dimensions[1];
+    if (this->_dimensions[2] > largest)
+        largest = this->_dimensions[2];
+    if (cluster_size > largest)
+        cluster_size = largest;
+    this->_cluster_size = cluster_size;
+    axis = 0;
+    while (axis < 3)
+    {
+        this->_cluster_counts[axis] = (this->_dimensions[axis] + cluster_size - 1) / cluster_size;
+        axis++;
+    }
+    this->_cluster_strides[0] = 1;
+    this->_cluster_strides[1] = this->_cluster_counts[0];
+    this->_cluster_strides[2] = this->_cluster_counts[0] * this->_cluster_counts[1];
+    face_area = cluster_size * cluster_size;
+    volume = 1;
+    axis = 0;
+    while (axis < 3)
+    {
+        if (this->_dimensions[axis] < cluster_size)
+            volume *= this->_dimensions[axis] + 2;
+        else
+            volume *= cluster_size + 2;
+        axis++;
+    }
+    this->_clusters = static_cast<game_path_hierarchy_cluster *>(cma_malloc(
+                this->_cluster_strides[2] * this->_cluster_counts[2]
+                * sizeof(game_path_hierarchy_cluster)));
+    this->_face_marks = static_cast<uint32_t *>(cma_malloc(this->_cluster_strides[2]
+                * this->_cluster_counts[2] * 3 * sizeof(uint32_t)));
+    this->_face_labels = static_cast<uint32_t *>(cma_malloc(face_area * sizeof(uint32_t)));
+    this->_face_stack = static_cast<uint32_t *>(cma_malloc(face_area * sizeof(uint32_t)));
+    this->_face_sizes = static_cast<uint32_t *>(cma_malloc(face_area * sizeof(uint32_t)));
+    this->_occupancy = static_cast<uint8_t *>(cma_malloc(this->_dimensions[0]
+                * this->_dimensions[1] * this->_dimensions[2]));
+    this->_cluster_cells = static_cast<uint8_t *>(cma_malloc(volume));
+    this->_cluster_queue = static_cast<uint32_t *>(cma_malloc(volume * sizeof(uint32_t)));
+    this->_cluster_costs = static_cast<uint32_t *>(cma_malloc(volume * sizeof(uint32_t)));
+    if (this->_clusters == ft_nullptr || this->_face_marks == ft_nullptr
+        || this->_face_labels == ft_nullptr || this->_face_stack == ft_nullptr
+        || this->_face_sizes == ft_nullptr || this->_cluster_cells == ft_nullptr
+        || this->_cluster_queue == ft_nullptr || this->_cluster_costs == ft_nullptr
+        || this->_occupancy == ft_nullptr)
+    {
+        this->release();
+        return (FT_ERR_NO_MEMORY);
+    }
+    this->_cluster_count = static_cast<uint32_t>(this->_cluster_strides[2]
+            * this->_cluster_counts[2]);
+    ft_bzero(this->_face_marks, static_cast<ft_size_t>(this->_cluster_count) * 3
+        * sizeof(uint32_t));
+    index = 0;
+    while (index < this->_cluster_count)
+    {
+        this->_clusters[index].nodes = ft_nullptr;
+        this->_clusters[index].positions = ft_nullptr;
+        this->_clusters[index].distances = ft_nullptr;
+        this->_clusters[index].node_count = 0;
+        this->_clusters[index].node_capacity = 0;
+        this->_clusters[index].position_capacity = 0;
+        this->_clusters[index].dirty = FT_TRUE;
+        this->_clusters[index].affected = FT_FALSE;
+        index++;
+    }
+    this->_dirty_count = this->_cluster_count;
+    return (this->repair(grid));
+}
+
+int32_t game_path_hierarchy::build(const game_map3d &grid, ft_size_t cluster_size) noexcept
+{
+    ft_bool lock_acquired;
+    ft_bool grid_lock_acquired;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::build");
+    grid_lock_acquired = FT_FALSE;
+    error_code = grid.lock(&grid_lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        grid.unlock(grid_lock_acquired);
+        return (this->set_error(error_code));
+    }
+    error_code = this->build_internal(grid, cluster_size);
+    if (error_code != FT_ERR_SUCCESS)
+        this->release();
+    (void)this->unlock_internal(lock_acquired);
+    grid.unlock(grid_lock_acquired);
+    return (this->set_error(error_code));
+}
+
+void game_path_hierarchy::update_cell(ft_size_t x, ft_size_t y, ft_size_t z) noexcept
+{
+    ft_bool lock_acquired;
+    uint32_t cluster;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::update_cell");
+    if (this->lock_internal(&lock_acquired) != FT_ERR_SUCCESS)
+        return ;
+    if (this->_cluster_size != 0 && x < this->_dimensions[0] && y < this->_dimensions[1]
+        && z < this->_dimensions[2])
+    {
+        cluster = this->cluster_of(x, y, z);
+        if (this->_clusters[cluster].dirty == FT_FALSE)
+        {
+            this->_clusters[cluster].dirty = FT_TRUE;
+            this->_dirty_count++;
+        }
+    }
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return ;
+}
+
+int32_t game_path_hierarchy::local_segment(uint32_t cluster, ft_size_t from_cell,
+    ft_size_t to_cell, ft_bool skip_first, uint32_t **cells, uint32_t *cell_count,
+    uint32_t *cell_capacity) noexcept
+{
+    ft_size_t offset[6];
+    ft_size_t local;
+    ft_size_t target;
+    ft_size_t remainder;
+    uint32_t cost;
+    uint32_t count;
+    uint8_t direction;
+    int32_t error_code;
+
+    this->load_cluster(cluster);
+    local = this->snapshot_index(from_cell);
+    target = this->snapshot_index(to_cell);
+    this->flood_snapshot(target, local);
+    cost = this->_cluster_costs[local];
+    if (cost >= GAME_PATH_HIERARCHY_BLOCKED)
+        return (FT_ERR_GAME_INVALID_MOVE);
+    error_code = game_path_hierarchy_grow(cells, cell_capacity, *cell_count + cost + 1);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    offset[0] = 1;
+    offset[1] = static_cast<ft_size_t>(0) - 1;
+    offset[2] = this->_cluster_extent[0];
+    offset[3] = static_cast<ft_size_t>(0) - offset[2];
+    offset[4] = this->_cluster_extent[0] * this->_cluster_extent[1];
+    offset[5] = static_cast<ft_size_t>(0) - offset[4];
+    count = *cell_count;
+    while (FT_TRUE)
+    {
+        cost = this->_cluster_costs[local];
+        if (!skip_first)
+        {
+            remainder = local / offset[2];
+            (*cells)[count++] = static_cast<uint32_t>(((remainder / this->_cluster_extent[1]
+                            - 1 + this->_cluster_lower[2]) * this->_dimensions[1]
+                        + remainder % this->_cluster_extent[1] - 1 + this->_cluster_lower[1])
+                    * this->_dimensions[0] + local % offset[2] - 1 + this->_cluster_lower[0]);
+        }
+        skip_first = FT_FALSE;
+        if (cost == 0)
+            break ;
+        direction = 0;
+        while (this->_cluster_costs[local + offset[direction]] != cost - 1)
+            direction++;
+        local += offset[direction];
+    }
+    *cell_count = count;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_hierarchy::refine(game_path_hierarchy_route *entry) noexcept
+{
+    uint32_t previous;
+    uint32_t current;
+    uint32_t index;
+    int32_t error_code;
+
+    entry->cell_count = 0;
+    error_code = game_path_hierarchy_grow(&entry->cells, &entry->cell_capacity, 1);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    entry->cells[entry->cell_count++] = static_cast<uint32_t>(
+            this->_nodes[entry->nodes[0]].cell);
+    index = 1;
+    while (error_code == FT_ERR_SUCCESS && index < entry->node_count)
+    {
+        previous = entry->nodes[index - 1];
+        current = entry->nodes[index];
+        if (this->_nodes[previous].partner == current)
+        {
+            error_code = game_path_hierarchy_grow(&entry->cells, &entry->cell_capacity,
+                    entry->cell_count + 1);
+            if (error_code == FT_ERR_SUCCESS)
+                entry->cells[entry->cell_count++] = static_cast<uint32_t>(
+                        this->_nodes[current].cell);
+        }
+        else if (this->_nodes[previous].cluster != this->_nodes[current].cluster)
+            error_code = FT_ERR_GAME_INVALID_MOVE;
+        else
+            error_code = this->local_segment(this->_nodes[current].cluster,
+                    this->_nodes[previous].cell, this->_nodes[current].cell, FT_TRUE,
+                    &entry->cells, &entry->cell_count, &entry->cell_capacity);
+        index++;
+    }
+    return (error_code);
+}
+
+void game_path_hierarchy::append_cells(const uint32_t *cells, uint32_t cell_count,
+    ft_vector<game_path_step> &out_path) const noexcept
+{
+    ft_size_t cell;
+    uint32_t index;
+
+    index = 0;
+    while (index < cell_count)
+    {
+        game_path_step step;
+
+        cell = cells[index];
+        (void)step.initialize();
+        (void)step.set_coordinates(cell % this->_dimensions[0],
+            (cell / this->_dimensions[0]) % this->_dimensions[1],
+            cell / (this->_dimensions[0] * this->_dimensions[1]));
+        out_path.push_back(step);
+        index++;
+    }
+    return ;
+}
+
+int32_t game_path_hierarchy::follow_route(ft_size_t start_cell, ft_size_t goal_cell,
+    const game_path_hierarchy_route *entry, ft_vector<game_path_step> &out_path) noexcept
+{
+    const game_path_hierarchy_node *first;
+    const game_path_hierarchy_node *last;
+    uint32_t count;
+    int32_t error_code;
+
+    first = &this->_nodes[entry->nodes[0]];
+    last = &this->_nodes[entry->nodes[entry->node_count - 1]];
+    out_path.clear();
+    count = 0;
+    error_code = this->local_segment(first->cluster, start_cell, first->cell, FT_FALSE,
+            &this->_segment, &count, &this->_segment_capacity);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    this->append_cells(this->_segment, count, out_path);
+    this->append_cells(entry->cells + 1, entry->cell_count - 1, out_path);
+    count = 0;
+    error_code = this->local_segment(last->cluster, last->cell, goal_cell, FT_TRUE,
+            &this->_segment, &count, &this->_segment_capacity);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    this->append_cells(this->_segment, count, out_path);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_hierarchy::abstract_search(ft_size_t start_cell, ft_size_t goal_cell,
+    uint32_t *route_length) noexcept
+{
+    game_path_open_entry entry;
+    game_path_hierarchy_cluster *start_cluster;
+    game_path_hierarchy_cluster *goal_cluster;
+    game_path_hierarchy_cluster *owner;
+    game_path_hierarchy_node *node;
+    game_path_hierarchy_node *partner;
+    ft_size_t start_coordinates[3];
+    ft_size_t goal_coordinates[3];
+    uint32_t start_position[3];
+    uint32_t goal_position[3];
+    uint32_t *start_costs;
+    uint32_t *goal_costs;
+    uint32_t *row;
+    uint32_t source;
+    uint32_t goal;
+    uint32_t current;
+    uint32_t cost;
+    uint32_t index;
+    uint32_t length;
+    int32_t error_code;
+
+    start_coordinates[0] = start_cell % this->_dimensions[0];
+    start_coordinates[1] = (start_cell / this->_dimensions[0]) % this->_dimensions[1];
+    start_coordinates[2] = start_cell / (this->_dimensions[0] * this->_dimensions[1]);
+    goal_coordinates[0] = goal_cell % this->_dimensions[0];
+    goal_coordinates[1] = (goal_cell / this->_dimensions[0]) % this->_dimensions[1];
+    goal_coordinates[2] = goal_cell / (this->_dimensions[0] * this->_dimensions[1]);
+    start_cluster = &this->_clusters[this->cluster_of(start_coordinates[0],
+            start_coordinates[1], start_coordinates[2])];
+    goal_cluster = &this->_clusters[this->cluster_of(goal_coordinates[0],
+            goal_coordinates[1], goal_coordinates[2])];
+    index = 0;
+    while (index < 3)
+    {
+        start_position[index] = static_cast<uint32_t>(start_coordinates[index]);
+        goal_position[index] = static_cast<uint32_t>(goal_coordinates[index]);
+        index++;
+    }
+    source = this->_node_count;
+    goal = this->_node_count + 1;
+    error_code = game_path_hierarchy_grow(&this->_edge_costs, &this->_edge_capacity,
+            start_cluster->node_count + goal_cluster->node_count);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = game_path_hierarchy_grow(&this->_abstract_parent,
+                &this->_abstract_capacity, this->_node_count + 2);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = game_path_hierarchy_grow(&this->_route, &this->_route_capacity,
+                this->_node_count + 2);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    start_costs = this->_edge_costs;
+    goal_costs = this->_edge_costs + start_cluster->node_count;
+    this->load_cluster(static_cast<uint32_t>(start_cluster - this->_clusters));
+    this->flood_cluster(static_cast<uint32_t>(start_cluster - this->_clusters), start_cell,
+        start_costs);
+    this->load_cluster(static_cast<uint32_t>(goal_cluster - this->_clusters));
+    this->flood_cluster(static_cast<uint32_t>(goal_cluster - this->_clusters), goal_cell,
+        goal_costs);
+    error_code = game_path_scratch_reserve(&this->_abstract_scratch,
+                static_cast<ft_size_t>(this->_node_count) + 2);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = game_path_hierarchy_relax(&this->_abstract_scratch,
+                this->_abstract_parent, source, source, 0, start_position, goal_position);
+    while (error_code == FT_ERR_SUCCESS && this->_abstract_scratch.open_count > 0)
+    {
+        entry = game_path_heap_pop(&this->_abstract_scratch);
+        current = static_cast<uint32_t>(entry.cell);
+        cost = this->_abstract_scratch.visit_cost[current];
+        if (this->_abstract_scratch.visit_stamp[current]
+            == this->_abstract_scratch.generation * 2 + 1
+            || UINT32_MAX - static_cast<uint32_t>(entry.key) != cost)
+            continue ;
+        this->_abstract_scratch.visit_stamp[current]
+            = this->_abstract_scratch.generation * 2 + 1;
+        if (current == goal)
+        {
+            length = 0;
+            current = this->_abstract_parent[goal];
+            while (current != source)
+            {
+                this->_route[length++] = current;
+                current = this->_abstract_parent[current];
+            }
+            index = 0;
+            while (index < length / 2)
+            {
+                current = this->_route[index];
+                this->_route[index] = this->_route[length - 1 - index];
+                this->_route[length - 1 - index] = current;
+                index++;
+            }
+            *route_length = length;
+            return (FT_ERR_SUCCESS);
+        }
+        if (current == source)
+        {
+            index = 0;
+            while (error_code == FT_ERR_SUCCESS && index < start_cluster->node_count)
+            {
+                if (start_costs[index] != GAME_PATH_HIERARCHY_UNREACHABLE)
+                    error_code = game_path_hierarchy_relax(&this->_abstract_scratch,
+                            this->_abstract_parent, start_cluster->nodes[index], source,
+                            start_costs[index], start_cluster->positions + index * 3,
+                            goal_position);
+                index++;
+            }
+            continue ;
+        }
+        node = &this->_nodes[current];
+        partner = &this->_nodes[node->partner];
+        error_code = game_path_hierarchy_relax(&this->_abstract_scratch,
+                this->_abstract_parent, node->partner, current, cost + 1,
+                this->_clusters[partner->cluster].positions + partner->slot * 3,
+                goal_position);
+        owner = &this->_clusters[node->cluster];
+        row = owner->distances + static_cast<ft_size_t>(node->slot) * owner->node_count;
+        index = 0;
+        while (error_code == FT_ERR_SUCCESS && index < owner->node_count)
+        {
+            if (index != node->slot && row[index] != GAME_PATH_HIERARCHY_UNREACHABLE)
+                error_code = game_path_hierarchy_relax(&this->_abstract_scratch,
+                        this->_abstract_parent, owner->nodes[index], current,
+                        cost + row[index], owner->positions + index * 3, goal_position);
+            index++;
+        }
+        if (error_code == FT_ERR_SUCCESS && owner == goal_cluster
+            && goal_costs[node->slot] != GAME_PATH_HIERARCHY_UNREACHABLE)
+            error_code = game_path_hierarchy_relax(&this->_abstract_scratch,
+                    this->_abstract_parent, goal, current, cost + goal_costs[node->slot],
+                    goal_position, goal_position);
+    }
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (FT_ERR_GAME_INVALID_MOVE);
+}
+
+game_path_hierarchy_route *game_path_hierarchy::cache_find(uint32_t start_cluster,
+    uint32_t goal_cluster) noexcept
+{
+    uint32_t index;
+
+    index = 0;
+    while (index < GAME_PATH_HIERARCHY_CACHE_SIZE)
+    {
+        if (this->_cache[index].valid && this->_cache[index].start_cluster == start_cluster
+            && this->_cache[index].goal_cluster == goal_cluster)
+        {
+            this->_cache_tick++;
+            this->_cache[index].last_used = this->_cache_tick;
+            return (&this->_cache[index]);
+        }
+        index++;
+    }
+    return (ft_nullptr);
+}
+
+int32_t game_path_hierarchy::cache_store(uint32_t start_cluster, uint32_t goal_cluster,
+    const uint32_t *route, uint32_t route_length, game_path_hierarchy_route **stored) noexcept
+{
+    game_path_hierarchy_route *entry;
+    uint32_t index;
+    int32_t error_code;
+
+    entry = &this->_cache[0];
+    index = 0;
+    while (index < GAME_PATH_HIERARCHY_CACHE_SIZE)
+    {
+        if (this->_cache[index].valid == FT_FALSE)
+        {
+            entry = &this->_cache[index];
+            break ;
+        }
+        if (this->_cache[index].last_used < entry->last_used)
+            entry = &this->_cache[index];
+        index++;
+    }
+    entry->valid = FT_FALSE;
+    error_code = game_path_hierarchy_grow(&entry->nodes, &entry->node_capacity,
+            route_length);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    ft_memcpy(entry->nodes, route, static_cast<ft_size_t>(route_length) * sizeof(uint32_t));
+    entry->node_count = route_length;
+    entry->start_cluster = start_cluster;
+    entry->goal_cluster = goal_cluster;
+    error_code = this->refine(entry);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    this->_cache_tick++;
+    entry->last_used = this->_cache_tick;
+    entry->valid = FT_TRUE;
+    *stored = entry;
+    return (FT_ERR_SUCCESS);
+}
+
+void game_path_hierarchy::cache_invalidate_affected() noexcept
+{
+    game_path_hierarchy_route *entry;
+    uint32_t index;
+    uint32_t node_index;
+
+    index = 0;
+    while (index < GAME_PATH_HIERARCHY_CACHE_SIZE)
+    {
+        entry = &this->_cache[index];
+        index++;
+        if (entry->valid == FT_FALSE)
+            continue ;
+        if (this->_clusters[entry->start_cluster].affected
+            || this->_clusters[entry->goal_cluster].affected)
+        {
+            entry->valid = FT_FALSE;
+            continue ;
+        }
+        node_index = 0;
+        while (node_index < entry->node_count)
+        {
+            if (this->_clusters[this->_nodes[entry->nodes[node_index]].cluster].affected)
+            {
+                entry->valid = FT_FALSE;
+                break ;
+            }
+            node_index++;
+        }
+    }
+    return ;
+}
+
+void game_path_hierarchy::clear_cache() noexcept
+{
+    ft_bool lock_acquired;
+    uint32_t index;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::clear_cache");
+    if (this->lock_internal(&lock_acquired) != FT_ERR_SUCCESS)
+        return ;
+    index = 0;
+    while (index < GAME_PATH_HIERARCHY_CACHE_SIZE)
+        this->_cache[index++].valid = FT_FALSE;
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return ;
+}
+
+int32_t game_path_hierarchy::find_path(const game_map3d &grid,
+    ft_size_t start_x, ft_size_t start_y, ft_size_t start_z,
+    ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z,
+    ft_vector<game_path_step> &out_path) noexcept
+{
+    game_path_hierarchy_route *cached_route;
+    ft_bool lock_acquired;
+    ft_bool grid_lock_acquired;
+    ft_size_t start_cell;
+    ft_size_t goal_cell;
+    uint32_t start_cluster;
+    uint32_t goal_cluster;
+    uint32_t route_length;
+    uint32_t count;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::find_path");
+    grid_lock_acquired = FT_FALSE;
+    error_code = grid.lock(&grid_lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        grid.unlock(grid_lock_acquired);
+        return (this->set_error(error_code));
+    }
+    if (start_x >= grid.get_width() || start_y >= grid.get_height()
+        || start_z >= grid.get_depth() || goal_x >= grid.get_width()
+        || goal_y >= grid.get_height() || goal_z >= grid.get_depth()
+        || grid.get(start_x, start_y, start_z) != 0 || grid.get(goal_x, goal_y, goal_z) != 0)
+        error_code = FT_ERR_GAME_INVALID_MOVE;
+    else if (this->_cluster_size == 0 || this->_dimensions[0] != grid.get_width()
+        || this->_dimensions[1] != grid.get_height() || this->_dimensions[2] != grid.get_depth())
+    {
+        if (this->_cluster_size == 0)
+            error_code = this->build_internal(grid, GAME_PATH_HIERARCHY_DEFAULT_CLUSTER_SIZE);
+        else
+            error_code = this->build_internal(grid, this->_cluster_size);
+    }
+    else
+        error_code = this->repair(grid);
+    out_path.clear();
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        (void)this->unlock_internal(lock_acquired);
+        grid.unlock(grid_lock_acquired);
+        return (this->set_error(error_code));
+    }
+    start_cell = (start_z * this->_dimensions[1] + start_y) * this->_dimensions[0] + start_x;
+    goal_cell = (goal_z * this->_dimensions[1] + goal_y) * this->_dimensions[0] + goal_x;
+    start_cluster = this->cluster_of(start_x, start_y, start_z);
+    goal_cluster = this->cluster_of(goal_x, goal_y, goal_z);
+    error_code = FT_ERR_GAME_INVALID_MOVE;
+    if (start_cluster == goal_cluster)
+    {
+        count = 0;
+        error_code = this->local_segment(start_cluster, start_cell, goal_cell,
+                FT_FALSE, &this->_segment, &count, &this->_segment_capacity);
+        if (error_code == FT_ERR_SUCCESS)
+            this->append_cells(this->_segment, count, out_path);
+    }
+    if (error_code == FT_ERR_GAME_INVALID_MOVE)
+    {
+        cached_route = this->cache_find(start_cluster, goal_cluster);
+        if (cached_route != ft_nullptr)
+        {
+            error_code = this->follow_route(start_cell, goal_cell, cached_route, out_path);
+            if (error_code == FT_ERR_SUCCESS)
+                this->_cache_hits++;
+            else if (error_code == FT_ERR_GAME_INVALID_MOVE)
+                cached_route->valid = FT_FALSE;
+        }
+    }
+    if (error_code == FT_ERR_GAME_INVALID_MOVE)
+    {
+        this->_cache_misses++;
+        error_code = this->abstract_search(start_cell, goal_cell, &route_length);
+        if (error_code == FT_ERR_SUCCESS)
+            error_code = this->cache_store(start_cluster, goal_cluster, this->_route,
+                    route_length, &cached_route);
+        if (error_code == FT_ERR_SUCCESS)
+            error_code = this->follow_route(start_cell, goal_cell, cached_route, out_path);
+    }
+    if (error_code != FT_ERR_SUCCESS)
+        out_path.clear();
+    (void)this->unlock_internal(lock_acquired);
+    grid.unlock(grid_lock_acquired);
+    return (this->set_error(error_code));
+}
+
+ft_size_t game_path_hierarchy::get_cluster_count() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::get_cluster_count");
+    return (this->_cluster_count);
+}
+
+ft_size_t game_path_hierarchy::get_node_count() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::get_node_count");
+    return (this->_alive_count);
+}
+
+ft_size_t game_path_hierarchy::get_dirty_cluster_count() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::get_dirty_cluster_count");
+    return (this->_dirty_count);
+}
+
+ft_size_t game_path_hierarchy::get_cache_hits() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::get_cache_hits");
+    return (this->_cache_hits);
+}
+
+ft_size_t game_path_hierarchy::get_cache_misses() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "game_path_hierarchy::get_cache_misses");
+    return (this->_cache_misses);
+}
+
+int32_t game_path_hierarchy::get_error() const noexcept
+{
+    return (game_path_hierarchy::_last_error);
+}
+
+const char *game_path_hierarchy::get_error_str() const noexcept
+{
+    return (ft_strerror(game_path_hierarchy::_last_error));
+}
@@ -0,0 +1,170 @@
+#ifndef GAME_PATH_HIERARCHY_HPP
+# define GAME_PATH_HIERARCHY_HPP
+
+#include "game_pathfinding.hpp"
+#include "game_map3d.hpp"
+#include "../Template/vector.hpp"
+#include "../Errno/errno.hpp"
+#include "../Basic/basic.hpp"
+#include "../PThread/recursive_mutex.hpp"
+#include <stdint.h>
+
+#define GAME_PATH_HIERARCHY_CACHE_SIZE 64
+#define GAME_PATH_HIERARCHY_DEFAULT_CLUSTER_SIZE 16
+
+typedef struct game_path_hierarchy_node
+{
+    ft_size_t   cell;
+    ft_size_t   position[3];
+    uint32_t    cluster;
+    uint32_t    face;
+    uint32_t    partner;
+    uint32_t    slot;
+    ft_bool     alive;
+} game_path_hierarchy_node;
+
+typedef struct game_path_hierarchy_cluster
+{
+    uint32_t    *nodes;
+    uint32_t    *positions;
+    uint32_t    *distances;
+    uint32_t    node_count;
+    uint32_t    node_capacity;
+    uint32_t    position_capacity;
+    ft_bool     dirty;
+    ft_bool     affected;
+} game_path_hierarchy_cluster;
+
+typedef struct game_path_hierarchy_route
+{
+    uint32_t    start_cluster;
+    uint32_t    goal_cluster;
+    uint32_t    *nodes;
+    uint32_t    node_count;
+    uint32_t    node_capacity;
+    uint32_t    *cells;
+    uint32_t    cell_count;
+    uint32_t    cell_capacity;
+    uint64_t    last_used;
+    ft_bool     valid;
+} game_path_hierarchy_route;
+
+class game_path_hierarchy
+{
+    #ifdef LIBFT_TEST_BUILD
+        public:
+    #else
+        private:
+    #endif
+        game_path_hierarchy_node    *_nodes;
+        uint32_t                    _node_count;
+        uint32_t                    _node_capacity;
+        uint32_t                    *_free_nodes;
+        uint32_t                    _free_count;
+        uint32_t                    _alive_count;
+        uint8_t                     *_occupancy;
+        game_path_hierarchy_cluster *_clusters;
+        uint32_t                    _cluster_count;
+        uint32_t                    _dirty_count;
+        ft_size_t                   _cluster_size;
+        ft_size_t                   _dimensions[3];
+        ft_size_t                   _cluster_counts[3];
+        ft_size_t                   _cluster_strides[3];
+        uint32_t                    *_face_marks;
+        uint32_t                    _face_epoch;
+        uint32_t                    *_face_labels;
+        uint32_t                    *_face_stack;
+        uint32_t                    *_face_sizes;
+        uint8_t                     *_cluster_cells;
+        uint32_t                    *_cluster_queue;
+        uint32_t                    *_cluster_costs;
+        ft_size_t                   _cluster_lower[3];
+        ft_size_t                   _cluster_extent[3];
+        uint32_t                    *_edge_costs;
+        uint32_t                    _edge_capacity;
+        uint32_t                    *_route;
+        uint32_t                    _route_capacity;
+        uint32_t                    *_abstract_parent;
+        uint32_t                    _abstract_capacity;
+        uint32_t                    *_segment;
+        uint32_t                    _segment_capacity;
+        game_path_scratch           _abstract_scratch;
+        game_path_hierarchy_route   _cache[GAME_PATH_HIERARCHY_CACHE_SIZE];
+        uint64_t                    _cache_tick;
+        ft_size_t                   _cache_hits;
+        ft_size_t                   _cache_misses;
+        pt_recursive_mutex          *_mutex;
+        uint8_t                     _initialised_state;
+        static thread_local int32_t _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        int32_t     lock_internal(ft_bool *lock_acquired) const noexcept;
+        int32_t     unlock_internal(ft_bool lock_acquired) const noexcept;
+
+        void        release() noexcept;
+        void        cluster_box(uint32_t cluster, ft_size_t lower[3],
+                        ft_size_t upper[3]) const noexcept;
+        uint32_t    cluster_of(ft_size_t x, ft_size_t y, ft_size_t z) const noexcept;
+        int32_t     add_node(ft_size_t cell, uint32_t cluster, uint32_t face,
+                        uint32_t *node_id) noexcept;
+        void        remove_face_nodes(uint32_t cluster, uint32_t face) noexcept;
+        void        refresh_occupancy(const game_map3d &grid, uint32_t cluster) noexcept;
+        int32_t     rebuild_face(uint32_t owner, uint8_t axis) noexcept;
+        int32_t     rebuild_distances(uint32_t cluster) noexcept;
+        int32_t     repair(const game_map3d &grid) noexcept;
+        int32_t     build_internal(const game_map3d &grid, ft_size_t cluster_size) noexcept;
+        void        load_cluster(uint32_t cluster) noexcept;
+        ft_size_t   snapshot_index(ft_size_t cell) const noexcept;
+        void        flood_snapshot(ft_size_t source, ft_size_t stop) noexcept;
+        void        flood_cluster(uint32_t cluster, ft_size_t cell, uint32_t *costs) noexcept;
+        int32_t     local_segment(uint32_t cluster, ft_size_t from_cell, ft_size_t to_cell,
+                        ft_bool skip_first, uint32_t **cells, uint32_t *cell_count,
+                        uint32_t *cell_capacity) noexcept;
+        int32_t     refine(game_path_hierarchy_route *entry) noexcept;
+        void        append_cells(const uint32_t *cells, uint32_t cell_count,
+                        ft_vector<game_path_step> &out_path) const noexcept;
+        int32_t     follow_route(ft_size_t start_cell, ft_size_t goal_cell,
+                        const game_path_hierarchy_route *entry,
+                        ft_vector<game_path_step> &out_path) noexcept;
+        int32_t     abstract_search(ft_size_t start_cell, ft_size_t goal_cell,
+                        uint32_t *route_length) noexcept;
+        game_path_hierarchy_route *cache_find(uint32_t start_cluster,
+                        uint32_t goal_cluster) noexcept;
+        int32_t     cache_store(uint32_t start_cluster, uint32_t goal_cluster,
+                        const uint32_t *route, uint32_t route_length,
+                        game_path_hierarchy_route **stored) noexcept;
+        void        cache_invalidate_affected() noexcept;
+
+    public:
+        game_path_hierarchy() noexcept;
+        game_path_hierarchy(const game_path_hierarchy &other) = delete;
+        game_path_hierarchy(game_path_hierarchy &&other) = delete;
+        ~game_path_hierarchy() noexcept;
+        game_path_hierarchy &operator=(const game_path_hierarchy &other) = delete;
+        game_path_hierarchy &operator=(game_path_hierarchy &&other) = delete;
+
+        int32_t     initialize() noexcept;
+        int32_t     destroy() noexcept;
+        int32_t     enable_thread_safety() noexcept;
+        int32_t     disable_thread_safety() noexcept;
+        ft_bool     is_thread_safe() const noexcept;
+
+        int32_t     build(const game_map3d &grid,
+                        ft_size_t cluster_size = GAME_PATH_HIERARCHY_DEFAULT_CLUSTER_SIZE) noexcept;
+        void        update_cell(ft_size_t x, ft_size_t y, ft_size_t z) noexcept;
+        int32_t     find_path(const game_map3d &grid,
+                        ft_size_t start_x, ft_size_t start_y, ft_size_t start_z,
+                        ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z,
+                        ft_vector<game_path_step> &out_path) noexcept;
+        void        clear_cache() noexcept;
+
+        ft_size_t   get_cluster_count() const noexcept;
+        ft_size_t   get_node_count() const noexcept;
+        ft_size_t   get_dirty_cluster_count() const noexcept;
+        ft_size_t   get_cache_hits() const noexcept;
+        ft_size_t   get_cache_misses() const noexcept;
+        int32_t     get_error() const noexcept;
+        const char  *get_error_str() const noexcept;
+};
+
+#endif
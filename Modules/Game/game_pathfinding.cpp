@@ -1,5 +1,6 @@
 #include "../PThread/pthread_internal.hpp"
 #include "game_pathfinding.hpp"
+#include "game_path_hierarchy.hpp"
 #include "../Printf/printf.hpp"
 #include "../System_utils/system_utils.hpp"
 #include "../Errno/errno_internal.hpp"
@@ -9,13 +10,6 @@
 #include "../PThread/recursive_mutex.hpp"
 #include "../Template/vector.hpp"
 
-static ft_size_t distance_component(ft_size_t left_value, ft_size_t right_value)
-{
-    if (left_value > right_value)
-        return (left_value - right_value);
-    return (right_value - left_value);
-}
-
 thread_local int32_t game_path_step::_last_error = FT_ERR_SUCCESS;
 
 #ifdef LIBFT_TEST_BUILD
@@ -397,9 +391,10 @@ int32_t game_pathfinding::unlock_internal(ft_bool lock_acquired) const noexcept
 }
 
 game_pathfinding::game_pathfinding() noexcept
-    : _current_path(), _needs_replan(FT_FALSE), _mutex(ft_nullptr),
-      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+    : _current_path(), _needs_replan(FT_FALSE), _scratch(), _scratch_busy(false),
+      _hierarchy(ft_nullptr), _mutex(ft_nullptr), _initialised_state(FT_CLASS_STATE_UNINITIALISED)
 {
+    game_path_scratch_init(&this->_scratch);
     this->set_error(FT_ERR_SUCCESS);
     return ;
 }
@@ -452,6 +447,8 @@ int32_t game_pathfinding::destroy() noexcept
     path_destroy_error = this->_current_path.destroy();
     if (path_destroy_error != FT_ERR_SUCCESS && first_error == FT_ERR_SUCCESS)
         first_error = path_destroy_error;
+    game_path_scratch_destroy(&this->_scratch);
+    this->_hierarchy = ft_nullptr;
     this->_needs_replan = FT_FALSE;
     this->_initialised_state = FT_CLASS_STATE_DESTROYED;
     this->set_error(first_error);
@@ -493,6 +490,10 @@ int32_t game_pathfinding::move(game_pathfinding &other) noexcept
         index += 1;
     }
     this->_needs_replan = other._needs_replan;
+    this->_scratch = other._scratch;
+    game_path_scratch_init(&other._scratch);
+    this->_hierarchy = other._hierarchy;
+    other._hierarchy = ft_nullptr;
     this->_mutex = other._mutex;
     this->_initialised_state = FT_CLASS_STATE_INITIALISED;
     other._current_path.clear();
@@ -568,6 +569,21 @@ void game_pathfinding::unlock(ft_bool lock_acquired) const noexcept
     return ;
 }
 
+int32_t game_pathfinding::attach_hierarchy(game_path_hierarchy *hierarchy) noexcept
+{
+    ft_bool lock_acquired;
+    int32_t lock_error;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "game_pathfinding::attach_hierarchy");
+    lock_error = this->lock_internal(&lock_acquired);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (lock_error);
+    this->_hierarchy = hierarchy;
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
 void game_pathfinding::update_obstacle(ft_size_t x, ft_size_t y, ft_size_t z,
     int32_t value) noexcept
 {
@@ -583,6 +599,8 @@ void game_pathfinding::update_obstacle(ft_size_t x, ft_size_t y, ft_size_t z,
         this->set_error(lock_error);
         return ;
     }
+    if (this->_hierarchy != ft_nullptr)
+        this->_hierarchy->update_cell(x, y, z);
     index = 0;
     while (index < this->_current_path.size())
     {
@@ -658,320 +676,63 @@ int32_t game_pathfinding::astar_grid(const game_map3d &grid,
     ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z,
     ft_vector<game_path_step> &out_path) const noexcept
 {
-    struct node
-    {
-        ft_size_t  x;
-        ft_size_t  y;
-        ft_size_t  z;
-        int32_t     g;
-        int32_t     f;
-        int32_t     parent;
-    };
-
-    ft_vector<node> nodes;
-    ft_vector<ft_size_t> open_set;
-    int32_t initialize_error;
-
-    if (start_x >= grid.get_width() || start_y >= grid.get_height()
-        || start_z >= grid.get_depth() || goal_x >= grid.get_width()
-        || goal_y >= grid.get_height() || goal_z >= grid.get_depth())
-        return (FT_ERR_GAME_INVALID_MOVE);
-    if (grid.get(start_x, start_y, start_z) != 0
-        || grid.get(goal_x, goal_y, goal_z) != 0)
-        return (FT_ERR_GAME_INVALID_MOVE);
+    game_path_scratch local_scratch;
+    bool scratch_free;
+    int32_t result;
 
-    initialize_error = nodes.initialize();
-    if (initialize_error != FT_ERR_SUCCESS)
-        return (initialize_error);
-    initialize_error = open_set.initialize();
-    if (initialize_error != FT_ERR_SUCCESS)
+    scratch_free = false;
+    if (this->_scratch_busy.compare_exchange_strong(scratch_free, true,
+            std::memory_order_acquire))
     {
-        (void)nodes.destroy();
-        return (initialize_error);
+        result = game_path_astar_grid(grid, &this->_scratch, start_x, start_y, start_z,
+                goal_x, goal_y, goal_z, out_path);
+        this->_scratch_busy.store(false, std::memory_order_release);
+        return (result);
     }
-    out_path.clear();
-
-    node start_node;
-    start_node.x = start_x;
-    start_node.y = start_y;
-    start_node.z = start_z;
-    start_node.g = 0;
-    start_node.f = static_cast<int32_t>(distance_component(start_x, goal_x)
-            + distance_component(start_y, goal_y)
-            + distance_component(start_z, goal_z));
-    start_node.parent = -1;
-    nodes.push_back(start_node);
-    open_set.push_back(0);
-
-    while (open_set.size() > 0)
-    {
-        ft_size_t best_open;
-        ft_size_t open_index;
-        ft_size_t current_index;
-
-        best_open = 0;
-        open_index = 0;
-        while (open_index < open_set.size())
-        {
-            if (nodes[open_set[open_index]].f < nodes[open_set[best_open]].f)
-                best_open = open_index;
-            open_index += 1;
-        }
-        current_index = open_set[best_open];
-
-        if (nodes[current_index].x == goal_x && nodes[current_index].y == goal_y
-            && nodes[current_index].z == goal_z)
-        {
-            ft_vector<game_path_step> reverse_path;
-            ft_size_t trace_index;
-            ft_size_t reverse_index;
-
-            initialize_error = reverse_path.initialize();
-            if (initialize_error != FT_ERR_SUCCESS)
-            {
-                (void)open_set.destroy();
-                (void)nodes.destroy();
-                return (initialize_error);
-            }
-            trace_index = current_index;
-            while (FT_TRUE)
-            {
-                game_path_step step;
-
-                (void)step.initialize();
-                (void)step.set_coordinates(nodes[trace_index].x,
-                    nodes[trace_index].y, nodes[trace_index].z);
-                reverse_path.push_back(step);
-                if (nodes[trace_index].parent == -1)
-                    break ;
-                trace_index = static_cast<ft_size_t>(nodes[trace_index].parent);
-            }
-            reverse_index = reverse_path.size();
-            while (reverse_index > 0)
-            {
-                reverse_index -= 1;
-                out_path.push_back(reverse_path[reverse_index]);
-            }
-            (void)reverse_path.destroy();
-            (void)open_set.destroy();
-            (void)nodes.destroy();
-            return (FT_ERR_SUCCESS);
-        }
-
-        open_set.erase(open_set.begin() + best_open);
-
-        int32_t direction_x[6] = {1, -1, 0, 0, 0, 0};
-        int32_t direction_y[6] = {0, 0, 1, -1, 0, 0};
-        int32_t direction_z[6] = {0, 0, 0, 0, 1, -1};
-        ft_size_t neighbor_index;
-
-        neighbor_index = 0;
-        while (neighbor_index < 6)
-        {
-            ft_size_t neighbor_x;
-            ft_size_t neighbor_y;
-            ft_size_t neighbor_z;
-
-            neighbor_x = nodes[current_index].x;
-            neighbor_y = nodes[current_index].y;
-            neighbor_z = nodes[current_index].z;
-            if (direction_x[neighbor_index] > 0)
-                neighbor_x += 1;
-            else if (direction_x[neighbor_index] < 0)
-                neighbor_x -= 1;
-            if (direction_y[neighbor_index] > 0)
-                neighbor_y += 1;
-            else if (direction_y[neighbor_index] < 0)
-                neighbor_y -= 1;
-            if (direction_z[neighbor_index] > 0)
-                neighbor_z += 1;
-            else if (direction_z[neighbor_index] < 0)
-                neighbor_z -= 1;
-            if (neighbor_x < grid.get_width() && neighbor_y < grid.get_height()
-                && neighbor_z < grid.get_depth()
-                && grid.get(neighbor_x, neighbor_y, neighbor_z) == 0)
-            {
-                ft_bool found;
-                ft_size_t search_index;
-                int32_t tentative_g;
-
-                found = FT_FALSE;
-                search_index = 0;
-                while (search_index < nodes.size())
-                {
-                    if (nodes[search_index].x == neighbor_x
-                        && nodes[search_index].y == neighbor_y
-                        && nodes[search_index].z == neighbor_z)
-                    {
-                        found = FT_TRUE;
-                        break ;
-                    }
-                    search_index += 1;
-                }
-                tentative_g = nodes[current_index].g + 1;
-                if (found)
-                {
-                    if (tentative_g < nodes[search_index].g)
-                    {
-                        nodes[search_index].g = tentative_g;
-                        nodes[search_index].f = tentative_g + static_cast<int32_t>(
-                                distance_component(neighbor_x, goal_x)
-                                + distance_component(neighbor_y, goal_y)
-                                + distance_component(neighbor_z, goal_z));
-                        nodes[search_index].parent = static_cast<int32_t>(current_index);
-                    }
-                }
-                else
-                {
-                    node new_node;
-
-                    new_node.x = neighbor_x;
-                    new_node.y = neighbor_y;
-                    new_node.z = neighbor_z;
-                    new_node.g = tentative_g;
-                    new_node.f = tentative_g + static_cast<int32_t>(
-                            distance_component(neighbor_x, goal_x)
-                            + distance_component(neighbor_y, goal_y)
-                            + distance_component(neighbor_z, goal_z));
-                    new_node.parent = static_cast<int32_t>(current_index);
-                    nodes.push_back(new_node);
-                    open_set.push_back(nodes.size() - 1);
-                }
-            }
-            neighbor_index += 1;
-        }
-    }
-    (void)open_set.destroy();
-    (void)nodes.destroy();
-    return (FT_ERR_GAME_INVALID_MOVE);
+    game_path_scratch_init(&local_scratch);
+    result = game_path_astar_grid(grid, &local_scratch, start_x, start_y, start_z,
+            goal_x, goal_y, goal_z, out_path);
+    game_path_scratch_destroy(&local_scratch);
+    return (result);
 }
 
 int32_t game_pathfinding::dijkstra_graph(const ft_graph<int32_t> &graph,
     ft_size_t start_vertex, ft_size_t goal_vertex,
     ft_vector<ft_size_t> &out_path) const noexcept
 {
-    ft_vector<int32_t> distance;
-    ft_vector<int32_t> previous;
-    ft_vector<ft_size_t> queue;
-    int32_t initialize_error;
+    ft_graph_csr<uint32_t> snapshot;
+    int32_t error_code;
 
-    initialize_error = distance.initialize();
-    if (initialize_error != FT_ERR_SUCCESS)
-        return (initialize_error);
-    initialize_error = previous.initialize();
-    if (initialize_error != FT_ERR_SUCCESS)
-    {
-        (void)distance.destroy();
-        return (initialize_error);
-    }
-    initialize_error = queue.initialize();
-    if (initialize_error != FT_ERR_SUCCESS)
-    {
-        (void)previous.destroy();
-        (void)distance.destroy();
-        return (initialize_error);
-    }
-    out_path.clear();
-    if (start_vertex >= graph.size() || goal_vertex >= graph.size())
-    {
-        (void)queue.destroy();
-        (void)previous.destroy();
-        (void)distance.destroy();
-        return (FT_ERR_GAME_INVALID_MOVE);
-    }
+    error_code = snapshot.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = graph.snapshot(snapshot);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = this->dijkstra_graph(snapshot, start_vertex, goal_vertex, out_path);
+    else
+        out_path.clear();
+    (void)snapshot.destroy();
+    return (error_code);
+}
 
-    distance.resize(graph.size(), -1);
-    previous.resize(graph.size(), -1);
-    distance[start_vertex] = 0;
-    queue.push_back(start_vertex);
+int32_t game_pathfinding::dijkstra_graph(const ft_graph_csr<uint32_t> &graph,
+    ft_size_t start_vertex, ft_size_t goal_vertex,
+    ft_vector<ft_size_t> &out_path) const noexcept
+{
+    ft_graph_search<uint32_t> search;
+    int32_t error_code;
 
-    while (queue.size() > 0)
+    error_code = search.initialize();
+    if (error_code != FT_ERR_SUCCESS)
     {
-        ft_size_t best_queue;
-        ft_size_t queue_index;
-        ft_size_t current;
-
-        best_queue = 0;
-        queue_index = 0;
-        while (queue_index < queue.size())
-        {
-            if (distance[queue[queue_index]] < distance[queue[best_queue]])
-                best_queue = queue_index;
-            queue_index += 1;
-        }
-        current = queue[best_queue];
-        queue.erase(queue.begin() + best_queue);
-        if (current == goal_vertex)
-            break ;
-
-        ft_vector<ft_size_t> neighbors;
-        ft_size_t neighbor_index;
-
-        initialize_error = neighbors.initialize();
-        if (initialize_error != FT_ERR_SUCCESS)
-        {
-            (void)queue.destroy();
-            (void)previous.destroy();
-            (void)distance.destroy();
-            return (initialize_error);
-        }
-        graph.neighbors(current, neighbors);
-        neighbor_index = 0;
-        while (neighbor_index < neighbors.size())
-        {
-            ft_size_t neighbor;
-            int32_t alternative_distance;
-
-            neighbor = neighbors[neighbor_index];
-            alternative_distance = distance[current] + 1;
-            if (distance[neighbor] == -1 || alternative_distance < distance[neighbor])
-            {
-                distance[neighbor] = alternative_distance;
-                previous[neighbor] = static_cast<int32_t>(current);
-                queue.push_back(neighbor);
-            }
-            neighbor_index += 1;
-        }
-        (void)neighbors.destroy();
+        out_path.clear();
+        return (error_code);
     }
-
-    if (distance[goal_vertex] == -1)
-    {
-        (void)queue.destroy();
-        (void)previous.destroy();
-        (void)distance.destroy();
+    error_code = search.dijkstra(graph, start_vertex, goal_vertex, out_path);
+    (void)search.destroy();
+    if (error_code == FT_ERR_OUT_OF_RANGE || error_code == FT_ERR_NOT_FOUND)
         return (FT_ERR_GAME_INVALID_MOVE);
-    }
-
-    ft_vector<ft_size_t> reverse_path;
-    ft_size_t vertex;
-
-    initialize_error = reverse_path.initialize();
-    if (initialize_error != FT_ERR_SUCCESS)
-    {
-        (void)queue.destroy();
-        (void)previous.destroy();
-        (void)distance.destroy();
-        return (initialize_error);
-    }
-    vertex = goal_vertex;
-    while (FT_TRUE)
-    {
-        reverse_path.push_back(vertex);
-        if (vertex == start_vertex)
-            break ;
-        vertex = static_cast<ft_size_t>(previous[vertex]);
-    }
-    while (reverse_path.size() > 0)
-    {
-        out_path.push_back(reverse_path[reverse_path.size() - 1]);
-        reverse_path.pop_back();
-    }
-    (void)reverse_path.destroy();
-    (void)queue.destroy();
-    (void)previous.destroy();
-    (void)distance.destroy();
-    return (FT_ERR_SUCCESS);
+    return (error_code);
 }
 
 int32_t game_pathfinding::get_error() const noexcept
@@ -4,12 +4,14 @@
 #include "game_map3d.hpp"
 #include "../Template/vector.hpp"
 #include "../Template/graph.hpp"
+#include "../Template/graph_search.hpp"
 #include "../Errno/errno.hpp"
 #include "../Basic/basic.hpp"
 #include "../PThread/recursive_mutex.hpp"
 #include "../PThread/pthread_internal.hpp"
 #include "../PThread/mutex.hpp"
 #include <stdint.h>
+#include <atomic>
 
 class game_path_step
 {
@@ -83,6 +85,26 @@ class game_path_step_test_helper
 
 #endif
 
+typedef struct game_path_open_entry
+{
+    uint64_t    key;
+    ft_size_t   cell;
+} game_path_open_entry;
+
+typedef struct game_path_scratch
+{
+    uint32_t                *visit_stamp;
+    uint32_t                *visit_cost;
+    uint8_t                 *visit_parent;
+    ft_size_t               visit_capacity;
+    uint32_t                generation;
+    game_path_open_entry    *open_heap;
+    ft_size_t               open_count;
+    ft_size_t               open_capacity;
+} game_path_scratch;
+
+class game_path_hierarchy;
+
 class game_pathfinding
 {
     #ifdef LIBFT_TEST_BUILD
@@ -92,6 +114,9 @@ class game_pathfinding
     #endif
         ft_vector<game_path_step> _current_path;
         ft_bool                    _needs_replan;
+        mutable game_path_scratch  _scratch;
+        mutable std::atomic<bool>  _scratch_busy;
+        game_path_hierarchy        *_hierarchy;
         pt_recursive_mutex               *_mutex;
         uint8_t                 _initialised_state;
         static thread_local int32_t _last_error;
@@ -126,6 +151,11 @@ class game_pathfinding
             ft_size_t start_vertex, ft_size_t goal_vertex,
             ft_vector<ft_size_t> &out_path) const noexcept;
 
+        int32_t dijkstra_graph(const ft_graph_csr<uint32_t> &graph,
+            ft_size_t start_vertex, ft_size_t goal_vertex,
+            ft_vector<ft_size_t> &out_path) const noexcept;
+
+        int32_t attach_hierarchy(game_path_hierarchy *hierarchy) noexcept;
         void    update_obstacle(ft_size_t x, ft_size_t y, ft_size_t z, int32_t value) noexcept;
         int32_t     recalculate_path(const game_map3d &grid,
             ft_size_t start_x, ft_size_t start_y, ft_size_t start_z,
@@ -137,4 +167,15 @@ class game_pathfinding
 
 };
 
+void    game_path_scratch_init(game_path_scratch *scratch) noexcept;
+void    game_path_scratch_destroy(game_path_scratch *scratch) noexcept;
+int32_t game_path_astar_grid(const game_map3d &grid, game_path_scratch *scratch,
+            ft_size_t start_x, ft_size_t start_y, ft_size_t start_z,
+            ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z,
+            ft_vector<game_path_step> &out_path) noexcept;
+int32_t game_path_astar_cells(const uint8_t *cells, const ft_size_t dimensions[3],
+            game_path_scratch *scratch, ft_size_t start_x, ft_size_t start_y,
+            ft_size_t start_z, ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z,
+            ft_vector<game_path_step> &out_path) noexcept;
+
 #endif
@@ -0,0 +1,396 @@
+#include "game_pathfinding_internal.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno.hpp"
+#include <cstdint>
+
+#define GAME_PATH_NO_PARENT 6
+#define GAME_PATH_MAX_GENERATION (UINT32_MAX / 2 - 1)
+#define GAME_PATH_MINIMUM_HEAP 64
+
+typedef struct game_path_query
+{
+    ft_size_t   width;
+    ft_size_t   height;
+    ft_size_t   depth;
+    ft_size_t   stride[3];
+    ft_size_t   target_x;
+    ft_size_t   target_y;
+    ft_size_t   target_z;
+} game_path_query;
+
+void game_path_scratch_init(game_path_scratch *scratch) noexcept
+{
+    scratch->visit_stamp = ft_nullptr;
+    scratch->visit_cost = ft_nullptr;
+    scratch->visit_parent = ft_nullptr;
+    scratch->visit_capacity = 0;
+    scratch->generation = 0;
+    scratch->open_heap = ft_nullptr;
+    scratch->open_count = 0;
+    scratch->open_capacity = 0;
+    return ;
+}
+
+void game_path_scratch_destroy(game_path_scratch *scratch) noexcept
+{
+    if (scratch == ft_nullptr)
+        return ;
+    cma_free(scratch->visit_stamp);
+    cma_free(scratch->visit_cost);
+    cma_free(scratch->visit_parent);
+    cma_free(scratch->open_heap);
+    game_path_scratch_init(scratch);
+    return ;
+}
+
+int32_t game_path_scratch_reserve(game_path_scratch *scratch,
+    ft_size_t cell_count) noexcept
+{
+    if (cell_count > scratch->visit_capacity)
+    {
+        cma_free(scratch->visit_stamp);
+        cma_free(scratch->visit_cost);
+        cma_free(scratch->visit_parent);
+        scratch->visit_stamp = static_cast<uint32_t *>(
+                cma_malloc(cell_count * sizeof(uint32_t)));
+        scratch->visit_cost = static_cast<uint32_t *>(
+                cma_malloc(cell_count * sizeof(uint32_t)));
+        scratch->visit_parent = static_cast<uint8_t *>(cma_malloc(cell_count));
+        if (scratch->visit_stamp == ft_nullptr || scratch->visit_cost == ft_nullptr
+            || scratch->visit_parent == ft_nullptr)
+        {
+            game_path_scratch_destroy(scratch);
+            return (FT_ERR_NO_MEMORY);
+        }
+        scratch->visit_capacity = cell_count;
+        scratch->generation = GAME_PATH_MAX_GENERATION;
+    }
+    if (scratch->generation >= GAME_PATH_MAX_GENERATION)
+    {
+        ft_bzero(scratch->visit_stamp, scratch->visit_capacity * sizeof(uint32_t));
+        scratch->generation = 0;
+    }
+    scratch->generation++;
+    scratch->open_count = 0;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_heap_push(game_path_scratch *scratch, uint64_t key,
+    ft_size_t cell) noexcept
+{
+    game_path_open_entry *resized_heap;
+    ft_size_t new_capacity;
+    ft_size_t index;
+    ft_size_t parent;
+
+    if (scratch->open_count == scratch->open_capacity)
+    {
+        new_capacity = scratch->open_capacity * 2;
+        if (new_capacity < GAME_PATH_MINIMUM_HEAP)
+            new_capacity = GAME_PATH_MINIMUM_HEAP;
+        resized_heap = static_cast<game_path_open_entry *>(cma_realloc(scratch->open_heap,
+                    new_capacity * sizeof(game_path_open_entry)));
+        if (resized_heap == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        scratch->open_heap = resized_heap;
+        scratch->open_capacity = new_capacity;
+    }
+    index = scratch->open_count;
+    scratch->open_count++;
+    while (index > 0)
+    {
+        parent = (index - 1) / 2;
+        if (scratch->open_heap[parent].key <= key)
+            break ;
+        scratch->open_heap[index] = scratch->open_heap[parent];
+        index = parent;
+    }
+    scratch->open_heap[index].key = key;
+    scratch->open_heap[index].cell = cell;
+    return (FT_ERR_SUCCESS);
+}
+
+game_path_open_entry game_path_heap_pop(game_path_scratch *scratch) noexcept
+{
+    game_path_open_entry top;
+    game_path_open_entry last;
+    ft_size_t index;
+    ft_size_t child;
+
+    top = scratch->open_heap[0];
+    scratch->open_count--;
+    if (scratch->open_count == 0)
+        return (top);
+    last = scratch->open_heap[scratch->open_count];
+    index = 0;
+    while (FT_TRUE)
+    {
+        child = index * 2 + 1;
+        if (child >= scratch->open_count)
+            break ;
+        if (child + 1 < scratch->open_count
+            && scratch->open_heap[child + 1].key < scratch->open_heap[child].key)
+            child++;
+        if (scratch->open_heap[child].key >= last.key)
+            break ;
+        scratch->open_heap[index] = scratch->open_heap[child];
+        index = child;
+    }
+    scratch->open_heap[index] = last;
+    return (top);
+}
+
+static uint64_t game_path_heap_key(const game_path_query *query, ft_size_t x,
+    ft_size_t y, ft_size_t z, uint32_t cost) noexcept
+{
+    uint64_t estimate;
+
+    estimate = cost;
+    if (x > query->target_x)
+        estimate += x - query->target_x;
+    else
+        estimate += query->target_x - x;
+    if (y > query->target_y)
+        estimate += y - query->target_y;
+    else
+        estimate += query->target_y - y;
+    if (z > query->target_z)
+        estimate += z - query->target_z;
+    else
+        estimate += query->target_z - z;
+    return ((estimate << 32) | (UINT32_MAX - cost));
+}
+
+static void game_path_cell_coordinates(const game_path_query *query, ft_size_t cell,
+    ft_size_t *x, ft_size_t *y, ft_size_t *z) noexcept
+{
+    *x = cell % query->width;
+    cell /= query->width;
+    *y = cell % query->height;
+    *z = cell / query->height;
+    return ;
+}
+
+static void game_path_emit(const game_path_query *query, const game_path_scratch *scratch,
+    ft_size_t cell, ft_vector<game_path_step> &out_path) noexcept
+{
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+    uint8_t direction;
+
+    while (FT_TRUE)
+    {
+        game_path_step step;
+
+        game_path_cell_coordinates(query, cell, &x, &y, &z);
+        (void)step.initialize();
+        (void)step.set_coordinates(x, y, z);
+        out_path.push_back(step);
+        direction = scratch->visit_parent[cell];
+        if (direction == GAME_PATH_NO_PARENT)
+            break ;
+        if ((direction & 1) == 0)
+            cell -= query->stride[direction / 2];
+        else
+            cell += query->stride[direction / 2];
+    }
+    return ;
+}
+
+static ft_bool game_path_cell_blocked(const game_map3d &grid, const ft_size_t coordinates[3],
+    ft_size_t cell) noexcept
+{
+    (void)cell;
+    return (grid.get(coordinates[0], coordinates[1], coordinates[2]) != 0);
+}
+
+static ft_bool game_path_cell_blocked(const uint8_t *cells, const ft_size_t coordinates[3],
+    ft_size_t cell) noexcept
+{
+    (void)coordinates;
+    return (cells[cell] != 0);
+}
+
+template <typename Cells>
+static int32_t game_path_search(const Cells &cells, game_path_scratch *scratch,
+    const game_path_query *query, ft_size_t source, ft_size_t target,
+    ft_vector<game_path_step> &out_path) noexcept
+{
+    const ft_size_t limit[3] = {query->width, query->height, query->depth};
+    game_path_open_entry entry;
+    ft_size_t coordinates[3];
+    ft_size_t neighbor;
+    uint32_t open_stamp;
+    uint32_t closed_stamp;
+    uint32_t cost;
+    uint8_t direction;
+    uint8_t axis;
+    int32_t error_code;
+
+    open_stamp = scratch->generation * 2;
+    closed_stamp = open_stamp + 1;
+    scratch->visit_stamp[source] = open_stamp;
+    scratch->visit_cost[source] = 0;
+    scratch->visit_parent[source] = GAME_PATH_NO_PARENT;
+    game_path_cell_coordinates(query, source, &coordinates[0], &coordinates[1],
+        &coordinates[2]);
+    error_code = game_path_heap_push(scratch, game_path_heap_key(query, coordinates[0],
+            coordinates[1], coordinates[2], 0), source);
+    while (error_code == FT_ERR_SUCCESS && scratch->open_count > 0)
+    {
+        entry = game_path_heap_pop(scratch);
+        cost = scratch->visit_cost[entry.cell];
+        if (scratch->visit_stamp[entry.cell] == closed_stamp
+            || UINT32_MAX - static_cast<uint32_t>(entry.key) != cost)
+            continue ;
+        scratch->visit_stamp[entry.cell] = closed_stamp;
+        if (entry.cell == target)
+        {
+            game_path_emit(query, scratch, target, out_path);
+            return (FT_ERR_SUCCESS);
+        }
+        game_path_cell_coordinates(query, entry.cell, &coordinates[0], &coordinates[1],
+            &coordinates[2]);
+        direction = 0;
+        while (direction < 6 && error_code == FT_ERR_SUCCESS)
+        {
+            axis = static_cast<uint8_t>(direction / 2);
+            if ((direction & 1) == 0 && coordinates[axis] + 1 < limit[axis])
+                neighbor = entry.cell + query->stride[axis];
+            else if ((direction & 1) == 1 && coordinates[axis] > 0)
+                neighbor = entry.cell - query->stride[axis];
+            else
+            {
+                direction++;
+                continue ;
+            }
+            if (scratch->visit_stamp[neighbor] == closed_stamp
+                || (scratch->visit_stamp[neighbor] == open_stamp
+                    && scratch->visit_cost[neighbor] <= cost + 1))
+            {
+                direction++;
+                continue ;
+            }
+            if ((direction & 1) == 0)
+                coordinates[axis]++;
+            else
+                coordinates[axis]--;
+            if (scratch->visit_stamp[neighbor] != open_stamp
+                && game_path_cell_blocked(cells, coordinates, neighbor))
+                scratch->visit_stamp[neighbor] = closed_stamp;
+            else
+            {
+                scratch->visit_stamp[neighbor] = open_stamp;
+                scratch->visit_cost[neighbor] = cost + 1;
+                scratch->visit_parent[neighbor] = direction;
+                error_code = game_path_heap_push(scratch, game_path_heap_key(query,
+                        coordinates[0], coordinates[1], coordinates[2], cost + 1),
+                        neighbor);
+            }
+            if ((direction & 1) == 0)
+                coordinates[axis]--;
+            else
+                coordinates[axis]++;
+            direction++;
+        }
+    }
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (FT_ERR_GAME_INVALID_MOVE);
+}
+
+static int32_t game_path_query_prepare(game_path_query *query, ft_size_t width,
+    ft_size_t height, ft_size_t depth, ft_size_t start_x, ft_size_t start_y,
+    ft_size_t start_z, ft_size_t *cell_count) noexcept
+{
+    query->width = width;
+    query->height = height;
+    query->depth = depth;
+    if (width == 0 || height == 0 || depth == 0 || width > UINT32_MAX / height
+        || width * height > UINT32_MAX / 2 / depth)
+        return (FT_ERR_OUT_OF_RANGE);
+    query->stride[0] = 1;
+    query->stride[1] = width;
+    query->stride[2] = width * height;
+    *cell_count = query->stride[2] * depth;
+    query->target_x = start_x;
+    query->target_y = start_y;
+    query->target_z = start_z;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t game_path_astar_cells(const uint8_t *cells, const ft_size_t dimensions[3],
+    game_path_scratch *scratch, ft_size_t start_x, ft_size_t start_y, ft_size_t start_z,
+    ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z,
+    ft_vector<game_path_step> &out_path) noexcept
+{
+    game_path_query query;
+    ft_size_t cell_count;
+    ft_size_t start_cell;
+    ft_size_t goal_cell;
+    int32_t error_code;
+
+    if (cells == ft_nullptr || scratch == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    out_path.clear();
+    if (start_x >= dimensions[0] || start_y >= dimensions[1] || start_z >= dimensions[2]
+        || goal_x >= dimensions[0] || goal_y >= dimensions[1] || goal_z >= dimensions[2])
+        return (FT_ERR_GAME_INVALID_MOVE);
+    error_code = game_path_query_prepare(&query, dimensions[0], dimensions[1],
+            dimensions[2], start_x, start_y, start_z, &cell_count);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    start_cell = (start_z * query.height + start_y) * query.width + start_x;
+    goal_cell = (goal_z * query.height + goal_y) * query.width + goal_x;
+    if (cells[start_cell] != 0 || cells[goal_cell] != 0)
+        return (FT_ERR_GAME_INVALID_MOVE);
+    error_code = game_path_scratch_reserve(scratch, cell_count);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = game_path_search(cells, scratch, &query, goal_cell, start_cell,
+                out_path);
+    return (error_code);
+}
+
+int32_t game_path_astar_grid(const game_map3d &grid, game_path_scratch *scratch,
+    ft_size_t start_x, ft_size_t start_y, ft_size_t start_z,
+    ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z,
+    ft_vector<game_path_step> &out_path) noexcept
+{
+    game_path_query query;
+    ft_bool lock_acquired;
+    ft_size_t cell_count;
+    int32_t error_code;
+
+    if (scratch == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    lock_acquired = FT_FALSE;
+    error_code = grid.lock(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    query.width = grid.get_width();
+    query.height = grid.get_height();
+    query.depth = grid.get_depth();
+    if (start_x >= query.width || start_y >= query.height || start_z >= query.depth
+        || goal_x >= query.width || goal_y >= query.height || goal_z >= query.depth
+        || grid.get(start_x, start_y, start_z) != 0
+        || grid.get(goal_x, goal_y, goal_z) != 0)
+    {
+        grid.unlock(lock_acquired);
+        return (FT_ERR_GAME_INVALID_MOVE);
+    }
+    out_path.clear();
+    error_code = game_path_query_prepare(&query, query.width, query.height, query.depth,
+            start_x, start_y, start_z, &cell_count);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = game_path_scratch_reserve(scratch, cell_count);
+    // Searching from the goal leaves parent links that read start to goal.
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = game_path_search(grid, scratch, &query,
+                (goal_z * query.height + goal_y) * query.width + goal_x,
+                (start_z * query.height + start_y) * query.width + start_x, out_path);
+    grid.unlock(lock_acquired);
+    return (error_code);
+}
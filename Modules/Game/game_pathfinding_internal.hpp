@@ -0,0 +1,12 @@
+#ifndef GAME_PATHFINDING_INTERNAL_HPP
+# define GAME_PATHFINDING_INTERNAL_HPP
+
+#include "game_pathfinding.hpp"
+
+int32_t                 game_path_scratch_reserve(game_path_scratch *scratch,
+                            ft_size_t cell_count) noexcept;
+int32_t                 game_path_heap_push(game_path_scratch *scratch, uint64_t key,
+                            ft_size_t cell) noexcept;
+game_path_open_entry    game_path_heap_pop(game_path_scratch *scratch) noexcept;
+
+#endif
@@ -38,8 +38,8 @@ static void gnl_untrack_runtime_leaks(void)
         && g_gnl_leftovers._data != ft_nullptr)
         (void)cma_untrack_leak(g_gnl_leftovers._data);
     if (g_gnl_leftovers.is_initialised() == FT_CLASS_STATE_INITIALISED
-        && g_gnl_leftovers._occupied != ft_nullptr)
-        (void)cma_untrack_leak(g_gnl_leftovers._occupied);
+        && g_gnl_leftovers._hashes != ft_nullptr)
+        (void)cma_untrack_leak(g_gnl_leftovers._hashes);
     if (g_gnl_leftovers.is_initialised() == FT_CLASS_STATE_INITIALISED
         && g_gnl_leftovers._mutex != ft_nullptr)
         (void)cma_untrack_leak(g_gnl_leftovers._mutex);
@@ -47,8 +47,8 @@ static void gnl_untrack_runtime_leaks(void)
         && g_gnl_streams._data != ft_nullptr)
         (void)cma_untrack_leak(g_gnl_streams._data);
     if (g_gnl_streams.is_initialised() == FT_CLASS_STATE_INITIALISED
-        && g_gnl_streams._occupied != ft_nullptr)
-        (void)cma_untrack_leak(g_gnl_streams._occupied);
+        && g_gnl_streams._hashes != ft_nullptr)
+        (void)cma_untrack_leak(g_gnl_streams._hashes);
     if (g_gnl_streams.is_initialised() == FT_CLASS_STATE_INITIALISED
         && g_gnl_streams._mutex != ft_nullptr)
         (void)cma_untrack_leak(g_gnl_streams._mutex);
@@ -0,0 +1,107 @@
+#ifndef JSON_ARENA_HPP
+#define JSON_ARENA_HPP
+
+#include "../Basic/basic.hpp"
+#include <cstdint>
+
+struct cma_arena;
+
+#define JSON_ARENA_INDEX_THRESHOLD 8
+#define JSON_ARENA_MAX_DEPTH 512
+
+enum json_arena_type
+{
+    JSON_ARENA_NULL,
+    JSON_ARENA_BOOLEAN,
+    JSON_ARENA_NUMBER,
+    JSON_ARENA_STRING,
+    JSON_ARENA_ARRAY,
+    JSON_ARENA_OBJECT
+};
+
+struct json_arena_member;
+
+typedef struct json_arena_value
+{
+    uint8_t type;
+    ft_bool boolean_value;
+    uint32_t length;
+    union
+    {
+        const char *text;
+        struct json_arena_value *elements;
+        struct json_arena_member *members;
+    };
+    uint32_t *index;
+    uint32_t index_mask;
+} json_arena_value;
+
+typedef struct json_arena_member
+{
+    const char *key;
+    uint32_t key_length;
+    uint32_t key_hash;
+    json_arena_value value;
+} json_arena_member;
+
+class json_arena_document
+{
+#ifdef LIBFT_TEST_BUILD
+    public:
+#else
+    private:
+#endif
+        cma_arena **_chunks;
+        ft_size_t _chunk_count;
+        ft_size_t _chunk_capacity;
+        ft_size_t _reserved_bytes;
+        json_arena_value _root;
+        mutable int32_t _error_code;
+        uint8_t _initialised_state;
+
+        void release_chunks() noexcept;
+        int32_t add_chunk(ft_size_t minimum_size) noexcept;
+
+    public:
+        json_arena_document() noexcept;
+        ~json_arena_document() noexcept;
+
+        json_arena_document(const json_arena_document &) = delete;
+        json_arena_document &operator=(const json_arena_document &) = delete;
+        json_arena_document(json_arena_document &&) = delete;
+        json_arena_document &operator=(json_arena_document &&) = delete;
+
+        int32_t                 initialize() noexcept;
+        int32_t                 destroy() noexcept;
+        void                    *allocate(ft_size_t size) noexcept;
+        int32_t                 parse(const char *content, ft_size_t length) noexcept;
+        int32_t                 parse(const char *content) noexcept;
+        void                    clear() noexcept;
+        const json_arena_value  *root() const noexcept;
+        const json_arena_value  *find(const char *key) const noexcept;
+        ft_size_t               reserved_bytes() const noexcept;
+        int32_t                 get_error() const noexcept;
+        const char              *get_error_str() const noexcept;
+};
+
+uint32_t                json_arena_hash_key(const char *key, ft_size_t length) noexcept;
+int32_t                 json_arena_build_index(json_arena_document &document,
+                            json_arena_value *object) noexcept;
+const json_arena_value  *json_arena_object_find(const json_arena_value *object,
+                            const char *key, ft_size_t key_length) noexcept;
+const json_arena_value  *json_arena_object_find(const json_arena_value *object,
+                            const char *key) noexcept;
+const json_arena_value  *json_arena_array_at(const json_arena_value *array,
+                            ft_size_t index) noexcept;
+const json_arena_value  *json_arena_find_by_pointer(const json_arena_value *root,
+                            const char *pointer) noexcept;
+int32_t                 json_arena_get_int64(const json_arena_value *value,
+                            int64_t *result) noexcept;
+int32_t                 json_arena_get_double(const json_arena_value *value,
+                            double *result) noexcept;
+int32_t                 json_arena_get_boolean(const json_arena_value *value,
+                            ft_bool *result) noexcept;
+const char              *json_arena_get_string(const json_arena_value *value,
+                            ft_size_t *length) noexcept;
+
+#endif
@@ -0,0 +1,672 @@
+#include "json_arena.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno.hpp"
+#include "../Errno/errno_internal.hpp"
+
+#define JSON_ARENA_MINIMUM_CHUNK 65536
+
+struct json_arena_parser
+{
+    json_arena_document *document;
+    char *cursor;
+    char *end;
+    json_arena_value *value_stack;
+    ft_size_t value_count;
+    ft_size_t value_capacity;
+    json_arena_member *member_stack;
+    ft_size_t member_count;
+    ft_size_t member_capacity;
+    uint32_t depth;
+};
+
+static int32_t json_arena_parse_value(json_arena_parser *parser,
+    json_arena_value *value) noexcept;
+
+static void json_arena_value_reset(json_arena_value *value) noexcept
+{
+    value->type = JSON_ARENA_NULL;
+    value->boolean_value = FT_FALSE;
+    value->length = 0;
+    value->text = ft_nullptr;
+    value->index = ft_nullptr;
+    value->index_mask = 0;
+    return ;
+}
+
+static void json_arena_skip_whitespace(json_arena_parser *parser) noexcept
+{
+    while (parser->cursor < parser->end
+        && (*parser->cursor == ' ' || *parser->cursor == '\n'
+            || *parser->cursor == '\r' || *parser->cursor == '\t'))
+        parser->cursor++;
+    return ;
+}
+
+static int32_t json_arena_parse_hex(json_arena_parser *parser, uint32_t *code_unit) noexcept
+{
+    uint32_t digit_index;
+    char character;
+
+    if (parser->end - parser->cursor < 4)
+        return (FT_ERR_INVALID_ARGUMENT);
+    *code_unit = 0;
+    digit_index = 0;
+    while (digit_index < 4)
+    {
+        character = parser->cursor[digit_index];
+        *code_unit <<= 4;
+        if (character >= '0' && character <= '9')
+            *code_unit |= static_cast<uint32_t>(character - '0');
+        else if (character >= 'a' && character <= 'f')
+            *code_unit |= static_cast<uint32_t>(character - 'a' + 10);
+        else if (character >= 'A' && character <= 'F')
+            *code_unit |= static_cast<uint32_t>(character - 'A' + 10);
+        else
+            return (FT_ERR_INVALID_ARGUMENT);
+        digit_index++;
+    }
+    parser->cursor += 4;
+    return (FT_ERR_SUCCESS);
+}
+
+static char *json_arena_write_utf8(char *output, uint32_t code_point) noexcept
+{
+    if (code_point <= 0x7F)
+        *output++ = static_cast<char>(code_point);
+    else if (code_point <= 0x7FF)
+    {
+        *output++ = static_cast<char>(0xC0 | (code_point >> 6));
+        *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else if (code_point <= 0xFFFF)
+    {
+        *output++ = static_cast<char>(0xE0 | (code_point >> 12));
+        *output++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else
+    {
+        *output++ = static_cast<char>(0xF0 | (code_point >> 18));
+        *output++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        *output++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    return (output);
+}
+
+static int32_t json_arena_decode_escape(json_arena_parser *parser, char **output) noexcept
+{
+    uint32_t code_point;
+    uint32_t low_unit;
+    char escape_character;
+
+    if (parser->cursor >= parser->end)
+        return (FT_ERR_INVALID_ARGUMENT);
+    escape_character = *parser->cursor;
+    parser->cursor++;
+    if (escape_character == '"' || escape_character == '\\' || escape_character == '/')
+        *(*output)++ = escape_character;
+    else if (escape_character == 'b')
+        *(*output)++ = '\b';
+    else if (escape_character == 'f')
+        *(*output)++ = '\f';
+    else if (escape_character == 'n')
+        *(*output)++ = '\n';
+    else if (escape_character == 'r')
+        *(*output)++ = '\r';
+    else if (escape_character == 't')
+        *(*output)++ = '\t';
+    else if (escape_character == 'u')
+    {
+        if (json_arena_parse_hex(parser, &code_point) != FT_ERR_SUCCESS)
+            return (FT_ERR_INVALID_ARGUMENT);
+        if (code_point >= 0xDC00 && code_point <= 0xDFFF)
+            return (FT_ERR_INVALID_ARGUMENT);
+        if (code_point >= 0xD800 && code_point <= 0xDBFF)
+        {
+            if (parser->end - parser->cursor < 2 || parser->cursor[0] != '\\'
+                || parser->cursor[1] != 'u')
+                return (FT_ERR_INVALID_ARGUMENT);
+            parser->cursor += 2;
+            if (json_arena_parse_hex(parser, &low_unit) != FT_ERR_SUCCESS)
+                return (FT_ERR_INVALID_ARGUMENT);
+            if (low_unit < 0xDC00 || low_unit > 0xDFFF)
+                return (FT_ERR_INVALID_ARGUMENT);
+            code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_unit - 0xDC00);
+        }
+        *output = json_arena_write_utf8(*output, code_point);
+    }
+    else
+        return (FT_ERR_INVALID_ARGUMENT);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_arena_parse_string(json_arena_parser *parser, const char **text,
+    uint32_t *length) noexcept
+{
+    char *start;
+    char *output;
+    unsigned char character;
+
+    parser->cursor++;
+    start = parser->cursor;
+    output = start;
+    while (1)
+    {
+        while (parser->cursor < parser->end)
+        {
+            character = static_cast<unsigned char>(*parser->cursor);
+            if (character == '"' || character == '\\' || character < 0x20)
+                break ;
+            if (output != parser->cursor)
+                *output = static_cast<char>(character);
+            output++;
+            parser->cursor++;
+        }
+        if (parser->cursor >= parser->end || *parser->cursor != '\\')
+            break ;
+        parser->cursor++;
+        if (json_arena_decode_escape(parser, &output) != FT_ERR_SUCCESS)
+            return (FT_ERR_INVALID_ARGUMENT);
+    }
+    if (parser->cursor >= parser->end || *parser->cursor != '"')
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (static_cast<ft_size_t>(output - start) > UINT32_MAX)
+        return (FT_ERR_OUT_OF_RANGE);
+    *output = '\0';
+    parser->cursor++;
+    *text = start;
+    *length = static_cast<uint32_t>(output - start);
+    return (FT_ERR_SUCCESS);
+}
+
+static ft_bool json_arena_is_digit(const json_arena_parser *parser) noexcept
+{
+    if (parser->cursor >= parser->end)
+        return (FT_FALSE);
+    return (*parser->cursor >= '0' && *parser->cursor <= '9');
+}
+
+static int32_t json_arena_parse_number(json_arena_parser *parser,
+    json_arena_value *value) noexcept
+{
+    char *start;
+
+    start = parser->cursor;
+    if (*parser->cursor == '-')
+        parser->cursor++;
+    if (!json_arena_is_digit(parser))
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (*parser->cursor == '0')
+        parser->cursor++;
+    else
+    {
+        while (json_arena_is_digit(parser))
+            parser->cursor++;
+    }
+    if (parser->cursor < parser->end && *parser->cursor == '.')
+    {
+        parser->cursor++;
+        if (!json_arena_is_digit(parser))
+            return (FT_ERR_INVALID_ARGUMENT);
+        while (json_arena_is_digit(parser))
+            parser->cursor++;
+    }
+    if (parser->cursor < parser->end
+        && (*parser->cursor == 'e' || *parser->cursor == 'E'))
+    {
+        parser->cursor++;
+        if (parser->cursor < parser->end
+            && (*parser->cursor == '+' || *parser->cursor == '-'))
+            parser->cursor++;
+        if (!json_arena_is_digit(parser))
+            return (FT_ERR_INVALID_ARGUMENT);
+        while (json_arena_is_digit(parser))
+            parser->cursor++;
+    }
+    if (static_cast<ft_size_t>(parser->cursor - start) > UINT32_MAX)
+        return (FT_ERR_OUT_OF_RANGE);
+    value->type = JSON_ARENA_NUMBER;
+    value->text = start;
+    value->length = static_cast<uint32_t>(parser->cursor - start);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_arena_parse_literal(json_arena_parser *parser, const char *literal,
+    ft_size_t literal_length) noexcept
+{
+    if (static_cast<ft_size_t>(parser->end - parser->cursor) < literal_length)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (ft_memcmp(parser->cursor, literal, literal_length) != 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+    parser->cursor += literal_length;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_arena_grow_stack(void **stack, ft_size_t *capacity,
+    ft_size_t element_size) noexcept
+{
+    ft_size_t new_capacity;
+    void *resized;
+
+    new_capacity = *capacity * 2;
+    if (new_capacity == 0)
+        new_capacity = 64;
+    resized = cma_realloc(*stack, new_capacity * element_size);
+    if (resized == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    *stack = resized;
+    *capacity = new_capacity;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_arena_parse_array(json_arena_parser *parser,
+    json_arena_value *value) noexcept
+{
+    json_arena_value element;
+    ft_size_t mark;
+    ft_size_t count;
+    int32_t error_code;
+    void *stack;
+
+    parser->cursor++;
+    mark = parser->value_count;
+    json_arena_skip_whitespace(parser);
+    if (parser->cursor < parser->end && *parser->cursor == ']')
+        parser->cursor++;
+    else
+    {
+        while (1)
+        {
+            error_code = json_arena_parse_value(parser, &element);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            if (parser->value_count == parser->value_capacity)
+            {
+                stack = parser->value_stack;
+                error_code = json_arena_grow_stack(&stack, &parser->value_capacity,
+                        sizeof(json_arena_value));
+                parser->value_stack = static_cast<json_arena_value *>(stack);
+                if (error_code != FT_ERR_SUCCESS)
+                    return (error_code);
+            }
+            parser->value_stack[parser->value_count] = element;
+            parser->value_count++;
+            json_arena_skip_whitespace(parser);
+            if (parser->cursor >= parser->end)
+                return (FT_ERR_INVALID_ARGUMENT);
+            if (*parser->cursor == ']')
+            {
+                parser->cursor++;
+                break ;
+            }
+            if (*parser->cursor != ',')
+                return (FT_ERR_INVALID_ARGUMENT);
+            parser->cursor++;
+        }
+    }
+    count = parser->value_count - mark;
+    if (count > UINT32_MAX)
+        return (FT_ERR_OUT_OF_RANGE);
+    value->type = JSON_ARENA_ARRAY;
+    value->length = static_cast<uint32_t>(count);
+    if (count == 0)
+        return (FT_ERR_SUCCESS);
+    value->elements = static_cast<json_arena_value *>(
+            parser->document->allocate(count * sizeof(json_arena_value)));
+    if (value->elements == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    ft_memcpy(value->elements, parser->value_stack + mark,
+        count * sizeof(json_arena_value));
+    parser->value_count = mark;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_arena_parse_member(json_arena_parser *parser,
+    json_arena_member *member) noexcept
+{
+    int32_t error_code;
+
+    json_arena_skip_whitespace(parser);
+    if (parser->cursor >= parser->end || *parser->cursor != '"')
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_arena_parse_string(parser, &member->key, &member->key_length);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    member->key_hash = json_arena_hash_key(member->key, member->key_length);
+    json_arena_skip_whitespace(parser);
+    if (parser->cursor >= parser->end || *parser->cursor != ':')
+        return (FT_ERR_INVALID_ARGUMENT);
+    parser->cursor++;
+    return (json_arena_parse_value(parser, &member->value));
+}
+
+static int32_t json_arena_parse_object(json_arena_parser *parser,
+    json_arena_value *value) noexcept
+{
+    json_arena_member member;
+    ft_size_t mark;
+    ft_size_t count;
+    int32_t error_code;
+    void *stack;
+
+    parser->cursor++;
+    mark = parser->member_count;
+    json_arena_skip_whitespace(parser);
+    if (parser->cursor < parser->end && *parser->cursor == '}')
+        parser->cursor++;
+    else
+    {
+        while (1)
+        {
+            json_arena_value_reset(&member.value);
+            error_code = json_arena_parse_member(parser, &member);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            if (parser->member_count == parser->member_capacity)
+            {
+                stack = parser->member_stack;
+                error_code = json_arena_grow_stack(&stack, &parser->member_capacity,
+                        sizeof(json_arena_member));
+                parser->member_stack = static_cast<json_arena_member *>(stack);
+                if (error_code != FT_ERR_SUCCESS)
+                    return (error_code);
+            }
+            parser->member_stack[parser->member_count] = member;
+            parser->member_count++;
+            json_arena_skip_whitespace(parser);
+            if (parser->cursor >= parser->end)
+                return (FT_ERR_INVALID_ARGUMENT);
+            if (*parser->cursor == '}')
+            {
+                parser->cursor++;
+                break ;
+            }
+            if (*parser->cursor != ',')
+                return (FT_ERR_INVALID_ARGUMENT);
+            parser->cursor++;
+        }
+    }
+    count = parser->member_count - mark;
+    if (count > UINT32_MAX)
+        return (FT_ERR_OUT_OF_RANGE);
+    value->type = JSON_ARENA_OBJECT;
+    value->length = static_cast<uint32_t>(count);
+    if (count == 0)
+        return (FT_ERR_SUCCESS);
+    value->members = static_cast<json_arena_member *>(
+            parser->document->allocate(count * sizeof(json_arena_member)));
+    if (value->members == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    ft_memcpy(value->members, parser->member_stack + mark,
+        count * sizeof(json_arena_member));
+    parser->member_count = mark;
+    if (count < JSON_ARENA_INDEX_THRESHOLD)
+        return (FT_ERR_SUCCESS);
+    return (json_arena_build_index(*parser->document, value));
+}
+
+static int32_t json_arena_parse_value(json_arena_parser *parser,
+    json_arena_value *value) noexcept
+{
+    int32_t error_code;
+
+    json_arena_value_reset(value);
+    json_arena_skip_whitespace(parser);
+    if (parser->cursor >= parser->end)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (*parser->cursor == '"')
+    {
+        value->type = JSON_ARENA_STRING;
+        return (json_arena_parse_string(parser, &value->text, &value->length));
+    }
+    if (*parser->cursor == '{' || *parser->cursor == '[')
+    {
+        if (parser->depth >= JSON_ARENA_MAX_DEPTH)
+            return (FT_ERR_OUT_OF_RANGE);
+        parser->depth++;
+        if (*parser->cursor == '{')
+            error_code = json_arena_parse_object(parser, value);
+        else
+            error_code = json_arena_parse_array(parser, value);
+        parser->depth--;
+        return (error_code);
+    }
+    if (*parser->cursor == 't' || *parser->cursor == 'f')
+    {
+        value->type = JSON_ARENA_BOOLEAN;
+        value->boolean_value = (*parser->cursor == 't');
+        if (value->boolean_value)
+            return (json_arena_parse_literal(parser, "true", 4));
+        return (json_arena_parse_literal(parser, "false", 5));
+    }
+    if (*parser->cursor == 'n')
+        return (json_arena_parse_literal(parser, "null", 4));
+    return (json_arena_parse_number(parser, value));
+}
+
+json_arena_document::json_arena_document() noexcept
+    : _chunks(ft_nullptr), _chunk_count(0), _chunk_capacity(0), _reserved_bytes(0),
+      _root(), _error_code(FT_ERR_SUCCESS),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    json_arena_value_reset(&this->_root);
+    return ;
+}
+
+json_arena_document::~json_arena_document() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+        (void)this->destroy();
+    return ;
+}
+
+void json_arena_document::release_chunks() noexcept
+{
+    ft_size_t chunk_index;
+
+    chunk_index = 0;
+    while (chunk_index < this->_chunk_count)
+    {
+        (void)cma_arena_destroy(this->_chunks[chunk_index]);
+        chunk_index++;
+    }
+    cma_free(this->_chunks);
+    this->_chunks = ft_nullptr;
+    this->_chunk_count = 0;
+    this->_chunk_capacity = 0;
+    this->_reserved_bytes = 0;
+    return ;
+}
+
+int32_t json_arena_document::add_chunk(ft_size_t minimum_size) noexcept
+{
+    cma_arena **resized_chunks;
+    cma_arena *chunk;
+    ft_size_t capacity;
+    ft_size_t new_chunk_capacity;
+    int32_t error_code;
+
+    if (this->_chunk_count == this->_chunk_capacity)
+    {
+        new_chunk_capacity = this->_chunk_capacity * 2;
+        if (new_chunk_capacity == 0)
+            new_chunk_capacity = 8;
+        resized_chunks = static_cast<cma_arena **>(cma_realloc(this->_chunks,
+                    new_chunk_capacity * sizeof(cma_arena *)));
+        if (resized_chunks == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        this->_chunks = resized_chunks;
+        this->_chunk_capacity = new_chunk_capacity;
+    }
+    capacity = this->_reserved_bytes;
+    if (capacity < JSON_ARENA_MINIMUM_CHUNK)
+        capacity = JSON_ARENA_MINIMUM_CHUNK;
+    if (minimum_size > FT_SYSTEM_SIZE_MAX - 64)
+        return (FT_ERR_OUT_OF_RANGE);
+    if (capacity < minimum_size + 64)
+        capacity = minimum_size + 64;
+    error_code = cma_arena_create(capacity, &chunk);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    this->_chunks[this->_chunk_count] = chunk;
+    this->_chunk_count++;
+    this->_reserved_bytes += cma_arena_capacity(chunk);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_arena_document::initialize() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state,
+            "json_arena_document::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    json_arena_value_reset(&this->_root);
+    this->_error_code = FT_ERR_SUCCESS;
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_arena_document::destroy() noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (FT_ERR_SUCCESS);
+    this->release_chunks();
+    json_arena_value_reset(&this->_root);
+    this->_error_code = FT_ERR_SUCCESS;
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (FT_ERR_SUCCESS);
+}
+
+void *json_arena_document::allocate(ft_size_t size) noexcept
+{
+    void *memory_pointer;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_arena_document::allocate");
+    memory_pointer = ft_nullptr;
+    if (this->_chunk_count > 0)
+        memory_pointer = cma_arena_alloc(this->_chunks[this->_chunk_count - 1], size);
+    if (memory_pointer != ft_nullptr)
+        return (memory_pointer);
+    if (this->add_chunk(size) != FT_ERR_SUCCESS)
+        return (ft_nullptr);
+    return (cma_arena_alloc(this->_chunks[this->_chunk_count - 1], size));
+}
+
+void json_arena_document::clear() noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_arena_document::clear");
+    this->release_chunks();
+    json_arena_value_reset(&this->_root);
+    this->_error_code = FT_ERR_SUCCESS;
+    return ;
+}
+
+int32_t json_arena_document::parse(const char *content, ft_size_t length) noexcept
+{
+    json_arena_parser parser;
+    char *text;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_arena_document::parse");
+    this->clear();
+    if (content == ft_nullptr)
+    {
+        this->_error_code = FT_ERR_INVALID_ARGUMENT;
+        return (FT_ERR_INVALID_ARGUMENT);
+    }
+    error_code = FT_ERR_SUCCESS;
+    if (length > FT_SYSTEM_SIZE_MAX / 2 - 1)
+        error_code = FT_ERR_OUT_OF_RANGE;
+    else
+        error_code = this->add_chunk(length + length / 2 + 1);
+    text = ft_nullptr;
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        text = static_cast<char *>(this->allocate(length + 1));
+        if (text == ft_nullptr)
+            error_code = FT_ERR_NO_MEMORY;
+    }
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->clear();
+        this->_error_code = error_code;
+        return (error_code);
+    }
+    ft_memcpy(text, content, length);
+    text[length] = '\0';
+    parser.document = this;
+    parser.cursor = text;
+    parser.end = text + length;
+    parser.value_stack = ft_nullptr;
+    parser.value_count = 0;
+    parser.value_capacity = 0;
+    parser.member_stack = ft_nullptr;
+    parser.member_count = 0;
+    parser.member_capacity = 0;
+    parser.depth = 0;
+    error_code = json_arena_parse_value(&parser, &this->_root);
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        json_arena_skip_whitespace(&parser);
+        if (parser.cursor != parser.end)
+            error_code = FT_ERR_INVALID_ARGUMENT;
+    }
+    cma_free(parser.value_stack);
+    cma_free(parser.member_stack);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->clear();
+        this->_error_code = error_code;
+        return (error_code);
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_arena_document::parse(const char *content) noexcept
+{
+    if (content == ft_nullptr)
+        return (this->parse(content, 0));
+    return (this->parse(content, ft_strlen_size_t(content)));
+}
+
+const json_arena_value *json_arena_document::root() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_arena_document::root");
+    if (this->_chunk_count == 0)
+        return (ft_nullptr);
+    return (&this->_root);
+}
+
+const json_arena_value *json_arena_document::find(const char *key) const noexcept
+{
+    return (json_arena_object_find(this->root(), key));
+}
+
+ft_size_t json_arena_document::reserved_bytes() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_arena_document::reserved_bytes");
+    return (this->_reserved_bytes);
+}
+
+int32_t json_arena_document::get_error() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_arena_document::get_error");
+    return (this->_error_code);
+}
+
+const char *json_arena_document::get_error_str() const noexcept
+{
+    return (ft_strerror(this->get_error()));
+}
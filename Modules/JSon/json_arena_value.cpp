@@ -0,0 +1,289 @@
+#include "json_arena.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno.hpp"
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
+uint32_t json_arena_hash_key(const char *key, ft_size_t length) noexcept
+{
+    uint32_t hash_value;
+    ft_size_t index;
+
+    hash_value = 2166136261U;
+    index = 0;
+    while (index < length)
+    {
+        hash_value ^= static_cast<unsigned char>(key[index]);
+        hash_value *= 16777619U;
+        index++;
+    }
+    return (hash_value);
+}
+
+static ft_bool json_arena_member_matches(const json_arena_member *member,
+    const char *key, ft_size_t key_length, uint32_t key_hash) noexcept
+{
+    if (member->key_hash != key_hash || member->key_length != key_length)
+        return (FT_FALSE);
+    return (ft_memcmp(member->key, key, key_length) == 0);
+}
+
+int32_t json_arena_build_index(json_arena_document &document,
+    json_arena_value *object) noexcept
+{
+    ft_size_t capacity;
+    ft_size_t mask;
+    ft_size_t slot;
+    uint32_t member_index;
+    uint32_t *slots;
+    const json_arena_member *member;
+
+    if (object == ft_nullptr || object->type != JSON_ARENA_OBJECT)
+        return (FT_ERR_INVALID_ARGUMENT);
+    capacity = 16;
+    while (capacity < static_cast<ft_size_t>(object->length) * 2)
+        capacity <<= 1;
+    if (capacity - 1 > UINT32_MAX)
+        return (FT_ERR_OUT_OF_RANGE);
+    slots = static_cast<uint32_t *>(document.allocate(capacity * sizeof(uint32_t)));
+    if (slots == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    ft_bzero(slots, capacity * sizeof(uint32_t));
+    mask = capacity - 1;
+    member_index = 0;
+    while (member_index < object->length)
+    {
+        member = &object->members[member_index];
+        slot = member->key_hash & mask;
+        while (slots[slot] != 0 && !json_arena_member_matches(
+                &object->members[slots[slot] - 1], member->key, member->key_length,
+                member->key_hash))
+            slot = (slot + 1) & mask;
+        if (slots[slot] == 0)
+            slots[slot] = member_index + 1;
+        member_index++;
+    }
+    object->index = slots;
+    object->index_mask = static_cast<uint32_t>(mask);
+    return (FT_ERR_SUCCESS);
+}
+
+const json_arena_value *json_arena_object_find(const json_arena_value *object,
+    const char *key, ft_size_t key_length) noexcept
+{
+    uint32_t key_hash;
+    uint32_t slot;
+    uint32_t member_index;
+
+    if (object == ft_nullptr || object->type != JSON_ARENA_OBJECT
+        || (key == ft_nullptr && key_length != 0))
+        return (ft_nullptr);
+    key_hash = json_arena_hash_key(key, key_length);
+    if (object->index != ft_nullptr)
+    {
+        slot = key_hash & object->index_mask;
+        while (object->index[slot] != 0)
+        {
+            member_index = object->index[slot] - 1;
+            if (json_arena_member_matches(&object->members[member_index], key,
+                    key_length, key_hash))
+                return (&object->members[member_index].value);
+            slot = (slot + 1) & object->index_mask;
+        }
+        return (ft_nullptr);
+    }
+    member_index = 0;
+    while (member_index < object->length)
+    {
+        if (json_arena_member_matches(&object->members[member_index], key,
+                key_length, key_hash))
+            return (&object->members[member_index].value);
+        member_index++;
+    }
+    return (ft_nullptr);
+}
+
+const json_arena_value *json_arena_object_find(const json_arena_value *object,
+    const char *key) noexcept
+{
+    if (key == ft_nullptr)
+        return (ft_nullptr);
+    return (json_arena_object_find(object, key, ft_strlen_size_t(key)));
+}
+
+const json_arena_value *json_arena_array_at(const json_arena_value *array,
+    ft_size_t index) noexcept
+{
+    if (array == ft_nullptr || array->type != JSON_ARENA_ARRAY
+        || index >= array->length)
+        return (ft_nullptr);
+    return (&array->elements[index]);
+}
+
+static const json_arena_value *json_arena_pointer_step(const json_arena_value *current,
+    const char *token, ft_size_t token_length) noexcept
+{
+    ft_size_t array_index;
+    ft_size_t character_index;
+
+    if (current == ft_nullptr)
+        return (ft_nullptr);
+    if (current->type == JSON_ARENA_OBJECT)
+        return (json_arena_object_find(current, token, token_length));
+    if (current->type != JSON_ARENA_ARRAY || token_length == 0
+        || (token_length > 1 && token[0] == '0'))
+        return (ft_nullptr);
+    array_index = 0;
+    character_index = 0;
+    while (character_index < token_length)
+    {
+        if (token[character_index] < '0' || token[character_index] > '9'
+            || array_index > (FT_SYSTEM_SIZE_MAX - 9) / 10)
+            return (ft_nullptr);
+        array_index = array_index * 10
+            + static_cast<ft_size_t>(token[character_index] - '0');
+        character_index++;
+    }
+    return (json_arena_array_at(current, array_index));
+}
+
+const json_arena_value *json_arena_find_by_pointer(const json_arena_value *root,
+    const char *pointer) noexcept
+{
+    const json_arena_value *current;
+    const char *token_end;
+    char *decoded;
+    ft_size_t token_length;
+    ft_size_t input_index;
+    ft_size_t output_index;
+
+    if (root == ft_nullptr || pointer == ft_nullptr)
+        return (ft_nullptr);
+    current = root;
+    while (*pointer != '\0' && current != ft_nullptr)
+    {
+        if (*pointer != '/')
+            return (ft_nullptr);
+        pointer++;
+        token_end = pointer;
+        while (*token_end != '\0' && *token_end != '/')
+            token_end++;
+        token_length = static_cast<ft_size_t>(token_end - pointer);
+        if (ft_memchr(pointer, '~', token_length) == ft_nullptr)
+            current = json_arena_pointer_step(current, pointer, token_length);
+        else
+        {
+            decoded = static_cast<char *>(cma_malloc(token_length + 1));
+            if (decoded == ft_nullptr)
+                return (ft_nullptr);
+            input_index = 0;
+            output_index = 0;
+            while (input_index < token_length)
+            {
+                decoded[output_index] = pointer[input_index];
+                if (pointer[input_index] == '~')
+                {
+                    if (input_index + 1 >= token_length
+                        || (pointer[input_index + 1] != '0'
+                            && pointer[input_index + 1] != '1'))
+                    {
+                        cma_free(decoded);
+                        return (ft_nullptr);
+                    }
+                    decoded[output_index] = '~';
+                    if (pointer[input_index + 1] == '1')
+                        decoded[output_index] = '/';
+                    input_index++;
+                }
+                input_index++;
+                output_index++;
+            }
+            current = json_arena_pointer_step(current, decoded, output_index);
+            cma_free(decoded);
+        }
+        pointer = token_end;
+    }
+    return (current);
+}
+
+int32_t json_arena_get_int64(const json_arena_value *value, int64_t *result) noexcept
+{
+    ft_size_t index;
+    uint64_t magnitude;
+    uint64_t limit;
+    ft_bool negative;
+
+    if (value == ft_nullptr || result == ft_nullptr || value->type != JSON_ARENA_NUMBER)
+        return (FT_ERR_INVALID_ARGUMENT);
+    index = 0;
+    negative = (value->text[0] == '-');
+    if (negative)
+        index++;
+    limit = static_cast<uint64_t>(FT_LLONG_MAX);
+    if (negative)
+        limit++;
+    magnitude = 0;
+    while (index < value->length)
+    {
+        if (value->text[index] < '0' || value->text[index] > '9')
+            return (FT_ERR_INVALID_ARGUMENT);
+        if (magnitude > (limit - static_cast<uint64_t>(value->text[index] - '0')) / 10)
+            return (FT_ERR_OUT_OF_RANGE);
+        magnitude = magnitude * 10 + static_cast<uint64_t>(value->text[index] - '0');
+        index++;
+    }
+    if (negative && magnitude == limit)
+        *result = FT_LLONG_MIN;
+    else if (negative)
+        *result = -static_cast<int64_t>(magnitude);
+    else
+        *result = static_cast<int64_t>(magnitude);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_arena_get_double(const json_arena_value *value, double *result) noexcept
+{
+    char local_buffer[64];
+    char *buffer;
+    double parsed;
+
+    if (value == ft_nullptr || result == ft_nullptr || value->type != JSON_ARENA_NUMBER)
+        return (FT_ERR_INVALID_ARGUMENT);
+    buffer = local_buffer;
+    if (value->length >= sizeof(local_buffer))
+    {
+        buffer = static_cast<char *>(cma_malloc(value->length + 1));
+        if (buffer == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+    }
+    ft_memcpy(buffer, value->text, value->length);
+    buffer[value->length] = '\0';
+    errno = 0;
+    parsed = std::strtod(buffer, ft_nullptr);
+    if (buffer != local_buffer)
+        cma_free(buffer);
+    if (errno == ERANGE && std::isinf(parsed))
+        return (FT_ERR_OUT_OF_RANGE);
+    *result = parsed;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_arena_get_boolean(const json_arena_value *value, ft_bool *result) noexcept
+{
+    if (value == ft_nullptr || result == ft_nullptr || value->type != JSON_ARENA_BOOLEAN)
+        return (FT_ERR_INVALID_ARGUMENT);
+    *result = value->boolean_value;
+    return (FT_ERR_SUCCESS);
+}
+
+const char *json_arena_get_string(const json_arena_value *value, ft_size_t *length) noexcept
+{
+    if (value == ft_nullptr || value->type != JSON_ARENA_STRING)
+        return (ft_nullptr);
+    if (length != ft_nullptr)
+        *length = value->length;
+    return (value->text);
+}
@@ -0,0 +1,656 @@
+#include "json_cursor.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno.hpp"
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
+typedef struct json_cursor_scan
+{
+    const char *content;
+    ft_size_t length;
+    const uint32_t *positions;
+    ft_size_t count;
+} json_cursor_scan;
+
+static int32_t json_cursor_open_scan(const json_cursor *cursor, json_cursor_scan *scan) noexcept
+{
+    const json_structural_index *index;
+
+    if (cursor == ft_nullptr || cursor->document == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    index = cursor->document->index();
+    scan->content = cursor->document->content();
+    scan->length = cursor->document->length();
+    scan->positions = index->positions;
+    scan->count = index->count;
+    if (scan->content == ft_nullptr || cursor->token >= scan->count)
+        return (FT_ERR_INVALID_ARGUMENT);
+    return (FT_ERR_SUCCESS);
+}
+
+static char json_cursor_character(const json_cursor_scan *scan, ft_size_t token) noexcept
+{
+    if (token >= scan->count)
+        return ('\0');
+    return (scan->content[scan->positions[token]]);
+}
+
+static ft_bool json_cursor_is_delimiter(char character) noexcept
+{
+    return (character == ' ' || character == '\t' || character == '\n'
+        || character == '\r' || character == ',' || character == ':'
+        || character == '{' || character == '}' || character == '['
+        || character == ']' || character == '"');
+}
+
+static int32_t json_cursor_skip_value(const json_cursor_scan *scan, ft_size_t token,
+    ft_size_t *next) noexcept
+{
+    ft_size_t depth;
+    char character;
+
+    character = json_cursor_character(scan, token);
+    if (character == '"')
+    {
+        if (json_cursor_character(scan, token + 1) != '"')
+            return (FT_ERR_INVALID_ARGUMENT);
+        *next = token + 2;
+        return (FT_ERR_SUCCESS);
+    }
+    if (character == '\0' || character == '}' || character == ']'
+        || character == ',' || character == ':')
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (character != '{' && character != '[')
+    {
+        *next = token + 1;
+        return (FT_ERR_SUCCESS);
+    }
+    depth = 1;
+    token++;
+    while (token < scan->count)
+    {
+        character = scan->content[scan->positions[token]];
+        if (character == '{' || character == '[')
+            depth++;
+        else if (character == '}' || character == ']')
+        {
+            depth--;
+            if (depth == 0)
+            {
+                *next = token + 1;
+                return (FT_ERR_SUCCESS);
+            }
+        }
+        else if (character == '"')
+            token++;
+        token++;
+    }
+    return (FT_ERR_INVALID_ARGUMENT);
+}
+
+static json_cursor_type json_cursor_scalar_view(const json_cursor_scan *scan,
+    ft_size_t token, json_cursor_view *view) noexcept
+{
+    const char *text;
+    ft_size_t available;
+    ft_size_t token_length;
+
+    text = scan->content + scan->positions[token];
+    available = scan->length - scan->positions[token];
+    view->data = text;
+    if (available >= 4 && ft_memcmp(text, "true", 4) == 0
+        && (available == 4 || json_cursor_is_delimiter(text[4])))
+    {
+        view->length = 4;
+        return (JSON_CURSOR_BOOLEAN);
+    }
+    if (available >= 5 && ft_memcmp(text, "false", 5) == 0
+        && (available == 5 || json_cursor_is_delimiter(text[5])))
+    {
+        view->length = 5;
+        return (JSON_CURSOR_BOOLEAN);
+    }
+    if (available >= 4 && ft_memcmp(text, "null", 4) == 0
+        && (available == 4 || json_cursor_is_delimiter(text[4])))
+    {
+        view->length = 4;
+        return (JSON_CURSOR_NULL);
+    }
+    token_length = json_structural_number_length(text, available);
+    if (token_length == 0
+        || (token_length < available && !json_cursor_is_delimiter(text[token_length])))
+        return (JSON_CURSOR_INVALID);
+    view->length = token_length;
+    return (JSON_CURSOR_NUMBER);
+}
+
+static int32_t json_cursor_string_view(const json_cursor_scan *scan, ft_size_t token,
+    json_cursor_view *view, ft_bool *has_escapes) noexcept
+{
+    if (json_cursor_character(scan, token) != '"'
+        || json_cursor_character(scan, token + 1) != '"')
+        return (FT_ERR_INVALID_ARGUMENT);
+    view->data = scan->content + scan->positions[token] + 1;
+    view->length = scan->positions[token + 1] - scan->positions[token] - 1;
+    if (has_escapes != ft_nullptr)
+        *has_escapes = (ft_memchr(view->data, '\\', view->length) != ft_nullptr);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_cursor_key_matches(const json_cursor_view *raw_key, const char *key,
+    ft_size_t key_length, ft_bool *matches) noexcept
+{
+    char local_buffer[128];
+    char *buffer;
+    ft_size_t decoded_length;
+    int32_t error_code;
+
+    *matches = FT_FALSE;
+    if (ft_memchr(raw_key->data, '\\', raw_key->length) == ft_nullptr)
+    {
+        *matches = (raw_key->length == key_length
+            && ft_memcmp(raw_key->data, key, key_length) == 0);
+        return (FT_ERR_SUCCESS);
+    }
+    if (raw_key->length < key_length)
+        return (FT_ERR_SUCCESS);
+    buffer = local_buffer;
+    if (raw_key->length >= sizeof(local_buffer))
+    {
+        buffer = static_cast<char *>(cma_malloc(raw_key->length + 1));
+        if (buffer == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+    }
+    error_code = json_structural_decode_string(raw_key->data, raw_key->length, buffer,
+        &decoded_length);
+    if (error_code == FT_ERR_SUCCESS)
+        *matches = (decoded_length == key_length
+            && ft_memcmp(buffer, key, key_length) == 0);
+    if (buffer != local_buffer)
+        cma_free(buffer);
+    return (error_code);
+}
+
+static int32_t json_cursor_member_value(const json_cursor_scan *scan, ft_size_t key_token,
+    ft_size_t *value_token) noexcept
+{
+    if (json_cursor_character(scan, key_token) != '"'
+        || json_cursor_character(scan, key_token + 1) != '"'
+        || json_cursor_character(scan, key_token + 2) != ':')
+        return (FT_ERR_INVALID_ARGUMENT);
+    *value_token = key_token + 3;
+    if (*value_token >= scan->count)
+        return (FT_ERR_INVALID_ARGUMENT);
+    return (FT_ERR_SUCCESS);
+}
+
+json_cursor_type json_cursor_get_type(const json_cursor *cursor) noexcept
+{
+    json_cursor_scan scan;
+    json_cursor_view view;
+    char character;
+
+    if (json_cursor_open_scan(cursor, &scan) != FT_ERR_SUCCESS)
+        return (JSON_CURSOR_INVALID);
+    character = json_cursor_character(&scan, cursor->token);
+    if (character == '{')
+        return (JSON_CURSOR_OBJECT);
+    if (character == '[')
+        return (JSON_CURSOR_ARRAY);
+    if (character == '"')
+        return (JSON_CURSOR_STRING);
+    if (character == '}' || character == ']' || character == ','
+        || character == ':')
+        return (JSON_CURSOR_INVALID);
+    return (json_cursor_scalar_view(&scan, cursor->token, &view));
+}
+
+int32_t json_cursor_find_key(const json_cursor *object, const char *key,
+    ft_size_t key_length, json_cursor *result) noexcept
+{
+    json_cursor_scan scan;
+    json_cursor_view raw_key;
+    ft_size_t token;
+    ft_size_t value_token;
+    ft_bool matches;
+    int32_t error_code;
+    char character;
+
+    if (key == ft_nullptr || result == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_open_scan(object, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (json_cursor_character(&scan, object->token) != '{')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    token = object->token + 1;
+    if (json_cursor_character(&scan, token) == '}')
+        return (FT_ERR_NOT_FOUND);
+    while (FT_TRUE)
+    {
+        error_code = json_cursor_member_value(&scan, token, &value_token);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        raw_key.data = scan.content + scan.positions[token] + 1;
+        raw_key.length = scan.positions[token + 1] - scan.positions[token] - 1;
+        error_code = json_cursor_key_matches(&raw_key, key, key_length, &matches);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        if (matches)
+        {
+            result->document = object->document;
+            result->token = value_token;
+            return (FT_ERR_SUCCESS);
+        }
+        error_code = json_cursor_skip_value(&scan, value_token, &token);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        character = json_cursor_character(&scan, token);
+        if (character == '}')
+            return (FT_ERR_NOT_FOUND);
+        if (character != ',')
+            return (FT_ERR_INVALID_ARGUMENT);
+        token++;
+    }
+}
+
+int32_t json_cursor_find_key(const json_cursor *object, const char *key,
+    json_cursor *result) noexcept
+{
+    if (key == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    return (json_cursor_find_key(object, key, ft_strlen_size_t(key), result));
+}
+
+int32_t json_cursor_array_at(const json_cursor *array, ft_size_t index,
+    json_cursor *result) noexcept
+{
+    json_cursor_scan scan;
+    ft_size_t token;
+    int32_t error_code;
+    char character;
+
+    if (result == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_open_scan(array, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (json_cursor_character(&scan, array->token) != '[')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    token = array->token + 1;
+    if (json_cursor_character(&scan, token) == ']')
+        return (FT_ERR_NOT_FOUND);
+    while (index > 0)
+    {
+        error_code = json_cursor_skip_value(&scan, token, &token);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        character = json_cursor_character(&scan, token);
+        if (character == ']')
+            return (FT_ERR_NOT_FOUND);
+        if (character != ',')
+            return (FT_ERR_INVALID_ARGUMENT);
+        token++;
+        index--;
+    }
+    if (token >= scan.count)
+        return (FT_ERR_INVALID_ARGUMENT);
+    result->document = array->document;
+    result->token = token;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_cursor_pointer_step(json_cursor *current, const char *token,
+    ft_size_t token_length) noexcept
+{
+    ft_size_t array_index;
+    ft_size_t character_index;
+    json_cursor_type type;
+
+    type = json_cursor_get_type(current);
+    if (type == JSON_CURSOR_OBJECT)
+        return (json_cursor_find_key(current, token, token_length, current));
+    if (type != JSON_CURSOR_ARRAY)
+        return (FT_ERR_NOT_FOUND);
+    if (token_length == 0 || (token_length > 1 && token[0] == '0'))
+        return (FT_ERR_NOT_FOUND);
+    array_index = 0;
+    character_index = 0;
+    while (character_index < token_length)
+    {
+        if (token[character_index] < '0' || token[character_index] > '9'
+            || array_index > (FT_SYSTEM_SIZE_MAX - 9) / 10)
+            return (FT_ERR_NOT_FOUND);
+        array_index = array_index * 10
+            + static_cast<ft_size_t>(token[character_index] - '0');
+        character_index++;
+    }
+    return (json_cursor_array_at(current, array_index, current));
+}
+
+int32_t json_cursor_find_pointer(const json_cursor *root, const char *pointer,
+    json_cursor *result) noexcept
+{
+    json_cursor current;
+    const char *token_end;
+    char *decoded;
+    ft_size_t token_length;
+    ft_size_t input_index;
+    ft_size_t output_index;
+    int32_t error_code;
+
+    if (root == ft_nullptr || pointer == ft_nullptr || result == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    current = *root;
+    while (*pointer != '\0')
+    {
+        if (*pointer != '/')
+            return (FT_ERR_INVALID_ARGUMENT);
+        pointer++;
+        token_end = pointer;
+        while (*token_end != '\0' && *token_end != '/')
+            token_end++;
+        token_length = static_cast<ft_size_t>(token_end - pointer);
+        if (ft_memchr(pointer, '~', token_length) == ft_nullptr)
+            error_code = json_cursor_pointer_step(&current, pointer, token_length);
+        else
+        {
+            decoded = static_cast<char *>(cma_malloc(token_length + 1));
+            if (decoded == ft_nullptr)
+                return (FT_ERR_NO_MEMORY);
+            input_index = 0;
+            output_index = 0;
+            while (input_index < token_length)
+            {
+                decoded[output_index] = pointer[input_index];
+                if (pointer[input_index] == '~')
+                {
+                    if (input_index + 1 >= token_length
+                        || (pointer[input_index + 1] != '0'
+                            && pointer[input_index + 1] != '1'))
+                    {
+                        cma_free(decoded);
+                        return (FT_ERR_INVALID_ARGUMENT);
+                    }
+                    decoded[output_index] = '~';
+                    if (pointer[input_index + 1] == '1')
+                        decoded[output_index] = '/';
+                    input_index++;
+                }
+                input_index++;
+                output_index++;
+            }
+            error_code = json_cursor_pointer_step(&current, decoded, output_index);
+            cma_free(decoded);
+        }
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        pointer = token_end;
+    }
+    *result = current;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_first_child(const json_cursor *container, json_cursor *child) noexcept
+{
+    json_cursor_scan scan;
+    ft_size_t token;
+    int32_t error_code;
+    char opening;
+
+    if (child == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_open_scan(container, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    opening = json_cursor_character(&scan, container->token);
+    if (opening != '{' && opening != '[')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    token = container->token + 1;
+    if ((opening == '{' && json_cursor_character(&scan, token) == '}')
+        || (opening == '[' && json_cursor_character(&scan, token) == ']'))
+        return (FT_ERR_END_OF_FILE);
+    if (opening == '{')
+    {
+        error_code = json_cursor_member_value(&scan, token, &token);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+    }
+    else if (token >= scan.count)
+        return (FT_ERR_INVALID_ARGUMENT);
+    child->document = container->document;
+    child->token = token;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_next_sibling(json_cursor *cursor) noexcept
+{
+    json_cursor_scan scan;
+    ft_size_t token;
+    int32_t error_code;
+    char character;
+
+    error_code = json_cursor_open_scan(cursor, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (cursor->token == 0)
+        return (FT_ERR_END_OF_FILE);
+    error_code = json_cursor_skip_value(&scan, cursor->token, &token);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    character = json_cursor_character(&scan, token);
+    if (character == '}' || character == ']')
+        return (FT_ERR_END_OF_FILE);
+    if (character != ',')
+        return (FT_ERR_INVALID_ARGUMENT);
+    token++;
+    if (json_cursor_character(&scan, cursor->token - 1) == ':')
+    {
+        error_code = json_cursor_member_value(&scan, token, &token);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+    }
+    else if (token >= scan.count)
+        return (FT_ERR_INVALID_ARGUMENT);
+    cursor->token = token;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_get_key(const json_cursor *member, json_cursor_view *key,
+    ft_bool *has_escapes) noexcept
+{
+    json_cursor_scan scan;
+    int32_t error_code;
+
+    if (key == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_open_scan(member, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (member->token < 3 || json_cursor_character(&scan, member->token - 1) != ':')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    return (json_cursor_string_view(&scan, member->token - 3, key, has_escapes));
+}
+
+int32_t json_cursor_get_raw(const json_cursor *cursor, json_cursor_view *view) noexcept
+{
+    json_cursor_scan scan;
+    ft_size_t next;
+    int32_t error_code;
+    char character;
+
+    if (view == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_open_scan(cursor, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    character = json_cursor_character(&scan, cursor->token);
+    if (character == '"')
+        return (json_cursor_string_view(&scan, cursor->token, view, ft_nullptr));
+    if (character == '{' || character == '[')
+    {
+        error_code = json_cursor_skip_value(&scan, cursor->token, &next);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        view->data = scan.content + scan.positions[cursor->token];
+        view->length = scan.positions[next - 1] - scan.positions[cursor->token] + 1;
+        return (FT_ERR_SUCCESS);
+    }
+    if (character == '}' || character == ']' || character == ','
+        || character == ':')
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (json_cursor_scalar_view(&scan, cursor->token, view) == JSON_CURSOR_INVALID)
+        return (FT_ERR_INVALID_ARGUMENT);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_get_string(const json_cursor *cursor, json_cursor_view *view,
+    ft_bool *has_escapes) noexcept
+{
+    json_cursor_scan scan;
+    int32_t error_code;
+
+    if (view == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_open_scan(cursor, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (json_cursor_character(&scan, cursor->token) != '"')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    return (json_cursor_string_view(&scan, cursor->token, view, has_escapes));
+}
+
+int32_t json_cursor_copy_string(const json_cursor *cursor, char *buffer,
+    ft_size_t buffer_size, ft_size_t *length) noexcept
+{
+    json_cursor_view view;
+    ft_size_t decoded_length;
+    int32_t error_code;
+
+    if (buffer == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_get_string(cursor, &view, ft_nullptr);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (buffer_size <= view.length)
+        return (FT_ERR_OUT_OF_RANGE);
+    error_code = json_structural_decode_string(view.data, view.length, buffer,
+        &decoded_length);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (length != ft_nullptr)
+        *length = decoded_length;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_cursor_number_view(const json_cursor *cursor,
+    json_cursor_view *view) noexcept
+{
+    json_cursor_scan scan;
+    int32_t error_code;
+    char character;
+
+    error_code = json_cursor_open_scan(cursor, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    character = json_cursor_character(&scan, cursor->token);
+    if (character == '"' || character == '{' || character == '['
+        || json_cursor_scalar_view(&scan, cursor->token, view) != JSON_CURSOR_NUMBER)
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_get_int64(const json_cursor *cursor, int64_t *result) noexcept
+{
+    json_cursor_view view;
+    ft_size_t index;
+    uint64_t magnitude;
+    uint64_t limit;
+    ft_bool negative;
+    int32_t error_code;
+
+    if (result == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_number_view(cursor, &view);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    index = 0;
+    negative = (view.data[0] == '-');
+    if (view.data[0] == '-' || view.data[0] == '+')
+        index++;
+    limit = static_cast<uint64_t>(FT_LLONG_MAX);
+    if (negative)
+        limit++;
+    magnitude = 0;
+    while (index < view.length)
+    {
+        if (view.data[index] < '0' || view.data[index] > '9')
+            return (FT_ERR_INVALID_ARGUMENT);
+        if (magnitude > (limit - static_cast<uint64_t>(view.data[index] - '0')) / 10)
+            return (FT_ERR_OUT_OF_RANGE);
+        magnitude = magnitude * 10 + static_cast<uint64_t>(view.data[index] - '0');
+        index++;
+    }
+    if (negative && magnitude == limit)
+        *result = FT_LLONG_MIN;
+    else if (negative)
+        *result = -static_cast<int64_t>(magnitude);
+    else
+        *result = static_cast<int64_t>(magnitude);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_get_double(const json_cursor *cursor, double *result) noexcept
+{
+    json_cursor_view view;
+    char local_buffer[64];
+    char *buffer;
+    double parsed;
+    int32_t error_code;
+
+    if (result == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_number_view(cursor, &view);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    buffer = local_buffer;
+    if (view.length >= sizeof(local_buffer))
+    {
+        buffer = static_cast<char *>(cma_malloc(view.length + 1));
+        if (buffer == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+    }
+    ft_memcpy(buffer, view.data, view.length);
+    buffer[view.length] = '\0';
+    errno = 0;
+    parsed = std::strtod(buffer, ft_nullptr);
+    if (buffer != local_buffer)
+        cma_free(buffer);
+    if (errno == ERANGE && std::isinf(parsed))
+        return (FT_ERR_OUT_OF_RANGE);
+    *result = parsed;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_get_boolean(const json_cursor *cursor, ft_bool *result) noexcept
+{
+    json_cursor_scan scan;
+    json_cursor_view view;
+    int32_t error_code;
+    char character;
+
+    if (result == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_cursor_open_scan(cursor, &scan);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    character = json_cursor_character(&scan, cursor->token);
+    if ((character != 't' && character != 'f')
+        || json_cursor_scalar_view(&scan, cursor->token, &view) != JSON_CURSOR_BOOLEAN)
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    *result = (character == 't');
+    return (FT_ERR_SUCCESS);
+}
@@ -0,0 +1,93 @@
+#ifndef JSON_CURSOR_HPP
+#define JSON_CURSOR_HPP
+
+#include "../Basic/basic.hpp"
+#include "json_structural_index.hpp"
+#include <cstdint>
+
+enum json_cursor_type
+{
+    JSON_CURSOR_INVALID,
+    JSON_CURSOR_NULL,
+    JSON_CURSOR_BOOLEAN,
+    JSON_CURSOR_NUMBER,
+    JSON_CURSOR_STRING,
+    JSON_CURSOR_ARRAY,
+    JSON_CURSOR_OBJECT
+};
+
+class json_cursor_document;
+
+typedef struct json_cursor
+{
+    const json_cursor_document *document;
+    ft_size_t token;
+} json_cursor;
+
+typedef struct json_cursor_view
+{
+    const char *data;
+    ft_size_t length;
+} json_cursor_view;
+
+class json_cursor_document
+{
+#ifdef LIBFT_TEST_BUILD
+    public:
+#else
+    private:
+#endif
+        const char *_content;
+        ft_size_t _length;
+        json_structural_index _index;
+        mutable int32_t _error_code;
+        uint8_t _initialised_state;
+
+    public:
+        json_cursor_document() noexcept;
+        ~json_cursor_document() noexcept;
+
+        json_cursor_document(const json_cursor_document &) = delete;
+        json_cursor_document &operator=(const json_cursor_document &) = delete;
+        json_cursor_document(json_cursor_document &&) = delete;
+        json_cursor_document &operator=(json_cursor_document &&) = delete;
+
+        int32_t                     initialize() noexcept;
+        int32_t                     destroy() noexcept;
+        int32_t                     open(const char *content, ft_size_t length) noexcept;
+        int32_t                     open(const char *content) noexcept;
+        void                        close() noexcept;
+        int32_t                     root(json_cursor *cursor) const noexcept;
+        int32_t                     find(const char *pointer, json_cursor *cursor) const noexcept;
+        const char                  *content() const noexcept;
+        ft_size_t                   length() const noexcept;
+        const json_structural_index *index() const noexcept;
+        int32_t                     get_error() const noexcept;
+        const char                  *get_error_str() const noexcept;
+};
+
+json_cursor_type    json_cursor_get_type(const json_cursor *cursor) noexcept;
+int32_t             json_cursor_find_key(const json_cursor *object, const char *key,
+                        ft_size_t key_length, json_cursor *result) noexcept;
+int32_t             json_cursor_find_key(const json_cursor *object, const char *key,
+                        json_cursor *result) noexcept;
+int32_t             json_cursor_array_at(const json_cursor *array, ft_size_t index,
+                        json_cursor *result) noexcept;
+int32_t             json_cursor_find_pointer(const json_cursor *root, const char *pointer,
+                        json_cursor *result) noexcept;
+int32_t             json_cursor_first_child(const json_cursor *container,
+                        json_cursor *child) noexcept;
+int32_t             json_cursor_next_sibling(json_cursor *cursor) noexcept;
+int32_t             json_cursor_get_key(const json_cursor *member, json_cursor_view *key,
+                        ft_bool *has_escapes) noexcept;
+int32_t             json_cursor_get_raw(const json_cursor *cursor,
+                        json_cursor_view *view) noexcept;
+int32_t             json_cursor_get_string(const json_cursor *cursor, json_cursor_view *view,
+                        ft_bool *has_escapes) noexcept;
+int32_t             json_cursor_copy_string(const json_cursor *cursor, char *buffer,
+                        ft_size_t buffer_size, ft_size_t *length) noexcept;
+int32_t             json_cursor_get_int64(const json_cursor *cursor, int64_t *result) noexcept;
+int32_t             json_cursor_get_double(const json_cursor *cursor, double *result) noexcept;
+int32_t             json_cursor_get_boolean(const json_cursor *cursor, ft_bool *result) noexcept;
+
+#endif
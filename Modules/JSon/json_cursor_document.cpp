@@ -0,0 +1,149 @@
+#include "json_cursor.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Errno/errno.hpp"
+#include "../Errno/errno_internal.hpp"
+
+json_cursor_document::json_cursor_document() noexcept
+    : _content(ft_nullptr), _length(0), _index(), _error_code(FT_ERR_SUCCESS),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    json_structural_index_init(&this->_index);
+    return ;
+}
+
+json_cursor_document::~json_cursor_document() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+        (void)this->destroy();
+    return ;
+}
+
+int32_t json_cursor_document::initialize() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state,
+            "json_cursor_document::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    json_structural_index_init(&this->_index);
+    this->_content = ft_nullptr;
+    this->_length = 0;
+    this->_error_code = FT_ERR_SUCCESS;
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_document::destroy() noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (FT_ERR_SUCCESS);
+    json_structural_index_destroy(&this->_index);
+    this->_content = ft_nullptr;
+    this->_length = 0;
+    this->_error_code = FT_ERR_SUCCESS;
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_document::open(const char *content, ft_size_t length) noexcept
+{
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_cursor_document::open");
+    this->close();
+    if (content == ft_nullptr)
+    {
+        this->_error_code = FT_ERR_INVALID_ARGUMENT;
+        return (FT_ERR_INVALID_ARGUMENT);
+    }
+    error_code = json_structural_index_build(&this->_index, content, length);
+    if (error_code == FT_ERR_SUCCESS && this->_index.count == 0)
+        error_code = FT_ERR_EMPTY;
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->_index.count = 0;
+        this->_error_code = error_code;
+        return (error_code);
+    }
+    this->_content = content;
+    this->_length = length;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_document::open(const char *content) noexcept
+{
+    if (content == ft_nullptr)
+        return (this->open(content, 0));
+    return (this->open(content, ft_strlen_size_t(content)));
+}
+
+void json_cursor_document::close() noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_cursor_document::close");
+    this->_content = ft_nullptr;
+    this->_length = 0;
+    this->_index.count = 0;
+    this->_error_code = FT_ERR_SUCCESS;
+    return ;
+}
+
+int32_t json_cursor_document::root(json_cursor *cursor) const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_cursor_document::root");
+    if (cursor == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (this->_content == ft_nullptr)
+        return (FT_ERR_INVALID_STATE);
+    cursor->document = this;
+    cursor->token = 0;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_cursor_document::find(const char *pointer, json_cursor *cursor) const noexcept
+{
+    json_cursor root_cursor;
+    int32_t error_code;
+
+    error_code = this->root(&root_cursor);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (json_cursor_find_pointer(&root_cursor, pointer, cursor));
+}
+
+const char *json_cursor_document::content() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_cursor_document::content");
+    return (this->_content);
+}
+
+ft_size_t json_cursor_document::length() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_cursor_document::length");
+    return (this->_length);
+}
+
+const json_structural_index *json_cursor_document::index() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_cursor_document::index");
+    return (&this->_index);
+}
+
+int32_t json_cursor_document::get_error() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "json_cursor_document::get_error");
+    return (this->_error_code);
+}
+
+const char *json_cursor_document::get_error_str() const noexcept
+{
+    return (ft_strerror(this->get_error()));
+}
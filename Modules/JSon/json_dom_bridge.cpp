@@ -364,3 +364,209 @@ int32_t json_document_from_dom(const ft_dom_document &dom, json_document &docume
     document.set_manual_error(FT_ERR_SUCCESS);
     return (FT_ERR_SUCCESS);
 }
+
+static int32_t json_arena_scalar_text(const json_arena_value *value,
+    ft_string &number_buffer, const char **text) noexcept
+{
+    int32_t error_code;
+
+    if (value->type == JSON_ARENA_STRING)
+        *text = value->text;
+    else if (value->type == JSON_ARENA_BOOLEAN && value->boolean_value)
+        *text = "true";
+    else if (value->type == JSON_ARENA_BOOLEAN)
+        *text = "false";
+    else if (value->type == JSON_ARENA_NULL)
+        *text = "null";
+    else if (value->type == JSON_ARENA_NUMBER)
+    {
+        error_code = number_buffer.clear();
+        if (error_code == FT_ERR_SUCCESS)
+            error_code = number_buffer.append(value->text, value->length);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        *text = number_buffer.c_str();
+    }
+    else
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_arena_bridge_group(const json_arena_member *group_member,
+    ft_string &number_buffer, json_group **group_out) noexcept
+{
+    json_group *group;
+    json_item *item;
+    json_item *tail;
+    const char *text;
+    uint32_t member_index;
+    int32_t error_code;
+
+    *group_out = ft_nullptr;
+    if (group_member->value.type != JSON_ARENA_OBJECT)
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    group = json_create_json_group(group_member->key);
+    if (group == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    tail = ft_nullptr;
+    member_index = 0;
+    while (member_index < group_member->value.length)
+    {
+        const json_arena_member &member = group_member->value.members[member_index];
+
+        error_code = json_arena_scalar_text(&member.value, number_buffer, &text);
+        if (error_code != FT_ERR_SUCCESS)
+        {
+            json_free_groups(group);
+            return (error_code);
+        }
+        item = json_create_item(member.key, text);
+        if (item == ft_nullptr)
+        {
+            json_free_groups(group);
+            return (FT_ERR_NO_MEMORY);
+        }
+        if (tail == ft_nullptr)
+            group->items = item;
+        else
+            tail->next = item;
+        tail = item;
+        member_index++;
+    }
+    *group_out = group;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_arena_document_to_document(const json_arena_document &arena_document,
+    json_document &document) noexcept
+{
+    const json_arena_value *root;
+    json_group *head;
+    json_group *tail;
+    json_group *group;
+    ft_string number_buffer;
+    uint32_t member_index;
+    int32_t error_code;
+
+    document.clear();
+    root = arena_document.root();
+    if (root == ft_nullptr || root->type != JSON_ARENA_OBJECT)
+    {
+        document.set_manual_error(FT_ERR_INVALID_ARGUMENT);
+        return (FT_ERR_INVALID_ARGUMENT);
+    }
+    error_code = number_buffer.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        document.set_manual_error(error_code);
+        return (error_code);
+    }
+    head = ft_nullptr;
+    tail = ft_nullptr;
+    member_index = 0;
+    while (member_index < root->length)
+    {
+        error_code = json_arena_bridge_group(&root->members[member_index],
+                number_buffer, &group);
+        if (error_code != FT_ERR_SUCCESS)
+        {
+            json_free_groups(head);
+            document.set_manual_error(error_code);
+            return (error_code);
+        }
+        if (tail == ft_nullptr)
+            head = group;
+        else
+            tail->next = group;
+        tail = group;
+        member_index++;
+    }
+    if (head != ft_nullptr)
+        document.append_group(head);
+    return (document.get_error());
+}
+
+static int32_t json_arena_dom_append(const char *name, const json_arena_value *value,
+    ft_string &number_buffer, ft_dom_node **node_out) noexcept
+{
+    ft_dom_node *node;
+    ft_dom_node *child;
+    const char *text;
+    uint32_t child_index;
+    int32_t error_code;
+
+    *node_out = ft_nullptr;
+    node = new(std::nothrow) ft_dom_node();
+    if (!node)
+        return (FT_ERR_NO_MEMORY);
+    error_code = node->initialize();
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = node->set_name(name);
+    child_index = 0;
+    if (error_code == FT_ERR_SUCCESS && value->type == JSON_ARENA_OBJECT)
+    {
+        node->set_type(FT_DOM_NODE_OBJECT);
+        while (error_code == FT_ERR_SUCCESS && child_index < value->length)
+        {
+            error_code = json_arena_dom_append(value->members[child_index].key,
+                    &value->members[child_index].value, number_buffer, &child);
+            if (error_code == FT_ERR_SUCCESS)
+                error_code = node->add_child(child);
+            if (error_code != FT_ERR_SUCCESS)
+                json_dom_delete_node(child);
+            child_index++;
+        }
+    }
+    else if (error_code == FT_ERR_SUCCESS && value->type == JSON_ARENA_ARRAY)
+    {
+        node->set_type(FT_DOM_NODE_ARRAY);
+        while (error_code == FT_ERR_SUCCESS && child_index < value->length)
+        {
+            error_code = json_arena_dom_append("", &value->elements[child_index],
+                    number_buffer, &child);
+            if (error_code == FT_ERR_SUCCESS)
+                error_code = node->add_child(child);
+            if (error_code != FT_ERR_SUCCESS)
+                json_dom_delete_node(child);
+            child_index++;
+        }
+    }
+    else if (error_code == FT_ERR_SUCCESS && value->type == JSON_ARENA_NULL)
+        node->set_type(FT_DOM_NODE_NULL);
+    else if (error_code == FT_ERR_SUCCESS)
+    {
+        node->set_type(FT_DOM_NODE_VALUE);
+        error_code = json_arena_scalar_text(value, number_buffer, &text);
+        if (error_code == FT_ERR_SUCCESS)
+            error_code = node->set_value(text);
+    }
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        json_dom_delete_node(node);
+        return (error_code);
+    }
+    *node_out = node;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t json_arena_document_to_dom(const json_arena_document &arena_document,
+    ft_dom_document &dom) noexcept
+{
+    const json_arena_value *root;
+    ft_dom_node *root_node;
+    ft_string number_buffer;
+    int32_t error_code;
+
+    dom.clear();
+    root = arena_document.root();
+    if (root == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = number_buffer.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = json_arena_dom_append("json", root, number_buffer, &root_node);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    dom.set_root(root_node);
+    return (FT_ERR_SUCCESS);
+}
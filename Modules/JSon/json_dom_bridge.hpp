@@ -2,9 +2,14 @@
 #define JSON_DOM_BRIDGE_HPP
 
 #include "document.hpp"
+#include "json_arena.hpp"
 #include "../Parser/dom.hpp"
 
 int32_t json_document_to_dom(const json_document &document, ft_dom_document &dom) noexcept;
 int32_t json_document_from_dom(const ft_dom_document &dom, json_document &document) noexcept;
+int32_t json_arena_document_to_document(const json_arena_document &arena_document,
+    json_document &document) noexcept;
+int32_t json_arena_document_to_dom(const json_arena_document &arena_document,
+    ft_dom_document &dom) noexcept;
 
 #endif
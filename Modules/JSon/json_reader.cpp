@@ -1,5 +1,6 @@
 #include "../Basic/basic.hpp"
 #include "json.hpp"
+#include "json_structural_index.hpp"
 #include "document.hpp"
 #include "../CMA/CMA.hpp"
 #include "../Basic/class_nullptr.hpp"
@@ -14,14 +15,6 @@
 
 static thread_local int32_t g_json_reader_last_error = FT_ERR_SUCCESS;
 
-static void skip_whitespace(const char *json_string, ft_size_t &index)
-{
-    while (json_string[index]
-        && ft_isspace(static_cast<unsigned char>(json_string[index])))
-        index++;
-    return ;
-}
-
 static void json_reader_set_error(int32_t error_code)
 {
     g_json_reader_last_error = error_code;
@@ -128,558 +121,156 @@ static char *json_read_file_content(const char *filename)
     return (content);
 }
 
-static int32_t json_reader_hex_value(char character, uint32_t &value) noexcept
+typedef struct json_reader_cursor
 {
-    if (character >= '0' && character <= '9')
-    {
-        value = static_cast<uint32_t>(character - '0');
-        return (FT_ERR_SUCCESS);
-    }
-    if (character >= 'a' && character <= 'f')
-    {
-        value = static_cast<uint32_t>(character - 'a' + 10);
-        return (FT_ERR_SUCCESS);
-    }
-    if (character >= 'A' && character <= 'F')
-    {
-        value = static_cast<uint32_t>(character - 'A' + 10);
-        return (FT_ERR_SUCCESS);
-    }
-    return (FT_ERR_INVALID_STATE);
-}
+    const char *content;
+    ft_size_t length;
+    json_structural_index index;
+    ft_size_t position;
+} json_reader_cursor;
 
-static int32_t json_reader_ensure_capacity(char **buffer_ptr, ft_size_t &capacity, ft_size_t required) noexcept
+static char json_reader_token(const json_reader_cursor &cursor)
 {
-    if (buffer_ptr == ft_nullptr)
-    {
-        json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-        return (FT_ERR_INVALID_STATE);
-    }
-    if (capacity > required)
-        return (FT_ERR_SUCCESS);
-    ft_size_t new_capacity = capacity;
-    if (new_capacity == FT_ERR_SUCCESS)
-        new_capacity = 16;
-    while (new_capacity <= required)
-    {
-        ft_size_t next_capacity = new_capacity * 2;
-        if (next_capacity <= new_capacity)
-        {
-            json_reader_set_error(FT_ERR_OUT_OF_RANGE);
-            return (FT_ERR_INVALID_STATE);
-        }
-        new_capacity = next_capacity;
-    }
-    char *resized_buffer = static_cast<char *>(cma_realloc(*buffer_ptr, new_capacity));
-    int32_t realloc_error = json_reader_get_error();
-    if (!resized_buffer)
-    {
-        if (realloc_error == FT_ERR_SUCCESS)
-            realloc_error = FT_ERR_NO_MEMORY;
-        json_reader_set_error(realloc_error);
-        return (FT_ERR_INVALID_STATE);
-    }
-    *buffer_ptr = resized_buffer;
-    capacity = new_capacity;
-    json_reader_set_error(FT_ERR_SUCCESS);
-    return (FT_ERR_SUCCESS);
+    if (cursor.position >= cursor.index.count)
+        return ('\0');
+    return (cursor.content[cursor.index.positions[cursor.position]]);
 }
 
-static int32_t json_reader_append_utf8(char **buffer_ptr,
-    ft_size_t &capacity,
-    ft_size_t &length,
-    uint32_t code_point) noexcept
+static ft_bool json_reader_is_delimiter(char character)
 {
-    if (code_point <= 0x7F)
-    {
-        if (json_reader_ensure_capacity(buffer_ptr, capacity, length + 1) != FT_ERR_SUCCESS)
-        {
-            int32_t capacity_error = json_reader_get_error();
-            json_reader_set_error(capacity_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        (*buffer_ptr)[length] = static_cast<char>(code_point);
-        length++;
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (code_point <= 0x7FF)
-    {
-        if (json_reader_ensure_capacity(buffer_ptr, capacity, length + 2) != FT_ERR_SUCCESS)
-        {
-            int32_t capacity_error = json_reader_get_error();
-            json_reader_set_error(capacity_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        (*buffer_ptr)[length] = static_cast<char>(0xC0 | (code_point >> 6));
-        length++;
-        (*buffer_ptr)[length] = static_cast<char>(0x80 | (code_point & 0x3F));
-        length++;
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (code_point <= 0xFFFF)
-    {
-        if (json_reader_ensure_capacity(buffer_ptr, capacity, length + 3) != FT_ERR_SUCCESS)
-        {
-            int32_t capacity_error = json_reader_get_error();
-            json_reader_set_error(capacity_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        (*buffer_ptr)[length] = static_cast<char>(0xE0 | (code_point >> 12));
-        length++;
-        (*buffer_ptr)[length] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
-        length++;
-        (*buffer_ptr)[length] = static_cast<char>(0x80 | (code_point & 0x3F));
-        length++;
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (code_point <= 0x10FFFF)
-    {
-        if (json_reader_ensure_capacity(buffer_ptr, capacity, length + 4) != FT_ERR_SUCCESS)
-        {
-            int32_t capacity_error = json_reader_get_error();
-            json_reader_set_error(capacity_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        (*buffer_ptr)[length] = static_cast<char>(0xF0 | (code_point >> 18));
-        length++;
-        (*buffer_ptr)[length] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
-        length++;
-        (*buffer_ptr)[length] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
-        length++;
-        (*buffer_ptr)[length] = static_cast<char>(0x80 | (code_point & 0x3F));
-        length++;
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-    return (FT_ERR_INVALID_STATE);
+    return (character == ' ' || character == '\t' || character == '\n'
+        || character == '\r' || character == ',' || character == ':'
+        || character == '{' || character == '}' || character == '['
+        || character == ']' || character == '"');
 }
 
-static int32_t json_reader_parse_code_unit(const char *json_string,
-    ft_size_t length,
-    ft_size_t &index,
-    uint32_t &code_unit) noexcept
+static char *parse_string(json_reader_cursor &cursor)
 {
-    code_unit = 0;
-    ft_size_t digit_index = 0;
-    while (digit_index < 4)
-    {
-        if (index >= length)
-        {
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (FT_ERR_INVALID_STATE);
-        }
-        uint32_t digit_value = 0;
-        if (json_reader_hex_value(json_string[index], digit_value) != FT_ERR_SUCCESS)
-        {
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (FT_ERR_INVALID_STATE);
-        }
-        code_unit = (code_unit << 4) | digit_value;
-        index++;
-        digit_index++;
-    }
-    json_reader_set_error(FT_ERR_SUCCESS);
-    return (FT_ERR_SUCCESS);
-}
-
-static int32_t json_reader_append_escape(const char *json_string,
-    ft_size_t length,
-    ft_size_t &index,
-    char **buffer_ptr,
-    ft_size_t &capacity,
-    ft_size_t &out_length) noexcept
-{
-    if (index >= length)
-    {
-        json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-        return (FT_ERR_INVALID_STATE);
-    }
-    char escape_char = json_string[index];
-    index++;
-    if (escape_char == '"' || escape_char == '\\' || escape_char == '/')
-    {
-        if (json_reader_ensure_capacity(buffer_ptr, capacity, out_length + 1) != FT_ERR_SUCCESS)
-        {
-            int32_t capacity_error = json_reader_get_error();
-            json_reader_set_error(capacity_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        (*buffer_ptr)[out_length] = escape_char;
-        out_length++;
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (escape_char == 'b')
-    {
-        int32_t utf8_error = json_reader_append_utf8(buffer_ptr, capacity, out_length, '\b');
-        if (utf8_error != FT_ERR_SUCCESS)
-        {
-            int32_t last_error = json_reader_get_error();
-            json_reader_set_error(last_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (escape_char == 'f')
-    {
-        int32_t utf8_error = json_reader_append_utf8(buffer_ptr, capacity, out_length, '\f');
-        if (utf8_error != FT_ERR_SUCCESS)
-        {
-            int32_t last_error = json_reader_get_error();
-            json_reader_set_error(last_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (escape_char == 'n')
-    {
-        int32_t utf8_error = json_reader_append_utf8(buffer_ptr, capacity, out_length, '\n');
-        if (utf8_error != FT_ERR_SUCCESS)
-        {
-            int32_t last_error = json_reader_get_error();
-            json_reader_set_error(last_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (escape_char == 'r')
-    {
-        int32_t utf8_error = json_reader_append_utf8(buffer_ptr, capacity, out_length, '\r');
-        if (utf8_error != FT_ERR_SUCCESS)
-        {
-            int32_t last_error = json_reader_get_error();
-            json_reader_set_error(last_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (escape_char == 't')
-    {
-        int32_t utf8_error = json_reader_append_utf8(buffer_ptr, capacity, out_length, '\t');
-        if (utf8_error != FT_ERR_SUCCESS)
-        {
-            int32_t last_error = json_reader_get_error();
-            json_reader_set_error(last_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (FT_ERR_SUCCESS);
-    }
-    if (escape_char != 'u')
-    {
-        json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-        return (FT_ERR_INVALID_STATE);
-    }
-    uint32_t code_unit = 0;
-    if (json_reader_parse_code_unit(json_string, length, index, code_unit) != FT_ERR_SUCCESS)
-    {
-        int32_t parse_error = json_reader_get_error();
-        json_reader_set_error(parse_error);
-        return (FT_ERR_INVALID_STATE);
-    }
-    json_reader_get_error();
-    uint32_t code_point = code_unit;
-    if (code_unit >= 0xD800 && code_unit <= 0xDBFF)
-    {
-        if (index + 1 >= length)
-        {
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (FT_ERR_INVALID_STATE);
-        }
-        if (json_string[index] != '\\' || json_string[index + 1] != 'u')
-        {
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (FT_ERR_INVALID_STATE);
-        }
-        index = index + 2;
-        uint32_t low_unit = 0;
-        if (json_reader_parse_code_unit(json_string, length, index, low_unit) != FT_ERR_SUCCESS)
-        {
-            int32_t parse_error = json_reader_get_error();
-            json_reader_set_error(parse_error);
-            return (FT_ERR_INVALID_STATE);
-        }
-        json_reader_get_error();
-        if (low_unit < 0xDC00 || low_unit > 0xDFFF)
-        {
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (FT_ERR_INVALID_STATE);
-        }
-        code_point = 0x10000;
-        code_point = code_point + ((code_unit - 0xD800) << 10);
-        code_point = code_point + (low_unit - 0xDC00);
-    }
-    else if (code_unit >= 0xDC00 && code_unit <= 0xDFFF)
-    {
-        json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-        return (FT_ERR_INVALID_STATE);
-    }
-    int32_t utf8_result = json_reader_append_utf8(buffer_ptr, capacity, out_length, code_point);
-    int32_t utf8_error = json_reader_get_error();
-    if (utf8_result != FT_ERR_SUCCESS)
-    {
-        json_reader_set_error(utf8_error);
-        return (FT_ERR_INVALID_STATE);
-    }
-    json_reader_set_error(FT_ERR_SUCCESS);
-    return (FT_ERR_SUCCESS);
-}
+    ft_size_t open_position;
+    ft_size_t raw_length;
+    ft_size_t decoded_length;
+    char *result;
+    int32_t decode_error;
 
-static char *parse_string(const char *json_string, ft_size_t &index)
-{
-    ft_size_t length = ft_strlen_size_t(json_string);
-    if (index >= length || json_string[index] != '"')
+    if (json_reader_token(cursor) != '"' || cursor.position + 1 >= cursor.index.count)
     {
         json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
         return (ft_nullptr);
     }
-    index++;
-    ft_size_t capacity = 32;
-    ft_size_t out_length = 0;
-    char *result = static_cast<char *>(cma_malloc(capacity));
-    int32_t allocation_error = json_reader_get_error();
+    open_position = cursor.index.positions[cursor.position];
+    raw_length = cursor.index.positions[cursor.position + 1] - open_position - 1;
+    result = static_cast<char *>(cma_malloc(raw_length + 1));
     if (!result)
     {
-        json_reader_set_error(allocation_error);
+        json_reader_set_error(FT_ERR_NO_MEMORY);
         return (ft_nullptr);
     }
-    ft_bool closed = FT_FALSE;
-    while (index < length)
-    {
-        char current_char = json_string[index];
-        index++;
-        if (current_char == '"')
-        {
-            closed = FT_TRUE;
-            break ;
-        }
-        if (current_char == '\\')
-        {
-            if (json_reader_append_escape(json_string,
-                    length,
-                    index,
-                    &result,
-                    capacity,
-                    out_length) != FT_ERR_SUCCESS)
-            {
-                int32_t escape_error = json_reader_get_error();
-                cma_free(result);
-                json_reader_set_error(escape_error);
-                return (ft_nullptr);
-            }
-            json_reader_get_error();
-            continue;
-        }
-        if (static_cast<unsigned char>(current_char) < 0x20)
-        {
-            cma_free(result);
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (ft_nullptr);
-        }
-        if (json_reader_ensure_capacity(&result, capacity, out_length + 1) != FT_ERR_SUCCESS)
-        {
-            int32_t capacity_error = json_reader_get_error();
-            cma_free(result);
-            json_reader_set_error(capacity_error);
-            return (ft_nullptr);
-        }
-        json_reader_get_error();
-        result[out_length] = current_char;
-        out_length++;
-    }
-    if (!closed)
+    decode_error = json_structural_decode_string(cursor.content + open_position + 1,
+        raw_length, result, &decoded_length);
+    if (decode_error != FT_ERR_SUCCESS)
     {
         cma_free(result);
-        json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-        return (ft_nullptr);
-    }
-    if (json_reader_ensure_capacity(&result, capacity, out_length + 1) != FT_ERR_SUCCESS)
-    {
-        int32_t capacity_error = json_reader_get_error();
-        cma_free(result);
-        json_reader_set_error(capacity_error);
+        json_reader_set_error(decode_error);
         return (ft_nullptr);
     }
-    json_reader_get_error();
-    result[out_length] = '\0';
+    cursor.position += 2;
     json_reader_set_error(FT_ERR_SUCCESS);
     return (result);
 }
 
-static char *parse_number(const char *json_string, ft_size_t &index)
+static char *parse_number(json_reader_cursor &cursor)
 {
-    ft_size_t length = ft_strlen_size_t(json_string);
-    ft_size_t start_index = index;
-    if (index < length && (json_string[index] == '-' || json_string[index] == '+'))
-        index++;
-    ft_bool has_digits = FT_FALSE;
-    while (index < length
-        && ft_isdigit(static_cast<unsigned char>(json_string[index])))
-    {
-        index++;
-        has_digits = FT_TRUE;
-    }
-    if (index < length && json_string[index] == '.')
-    {
-        ft_size_t fractional_count;
+    const char *text;
+    ft_size_t available;
+    ft_size_t number_length;
+    char *number;
 
-        index++;
-        fractional_count = 0;
-        while (index < length
-            && ft_isdigit(static_cast<unsigned char>(json_string[index])))
-        {
-            index++;
-            fractional_count++;
-        }
-        if (fractional_count == FT_ERR_SUCCESS)
-        {
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (ft_nullptr);
-        }
-    }
-    if (index < length && (json_string[index] == 'e' || json_string[index] == 'E'))
-    {
-        ft_size_t exponent_count;
-
-        index++;
-        if (index < length && (json_string[index] == '-' || json_string[index] == '+'))
-            index++;
-        exponent_count = 0;
-        while (index < length
-            && ft_isdigit(static_cast<unsigned char>(json_string[index])))
-        {
-            index++;
-            exponent_count++;
-        }
-        if (exponent_count == FT_ERR_SUCCESS)
-        {
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (ft_nullptr);
-        }
-    }
-    if (!has_digits)
+    text = cursor.content + cursor.index.positions[cursor.position];
+    available = cursor.length - cursor.index.positions[cursor.position];
+    number_length = json_structural_number_length(text, available);
+    if (number_length == 0
+        || (number_length < available && !json_reader_is_delimiter(text[number_length])))
     {
         json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
         return (ft_nullptr);
     }
-    char *number = adv_substr(json_string,
-                               static_cast<uint32_t>(start_index),
-                               index - start_index);
-    int32_t substr_error = json_reader_get_error();
+    number = static_cast<char *>(cma_malloc(number_length + 1));
     if (!number)
     {
-        json_reader_set_error(substr_error);
+        json_reader_set_error(FT_ERR_NO_MEMORY);
         return (ft_nullptr);
     }
+    ft_memcpy(number, text, number_length);
+    number[number_length] = '\0';
+    cursor.position++;
     json_reader_set_error(FT_ERR_SUCCESS);
     return (number);
 }
 
-static char *parse_value(const char *json_string, ft_size_t &index)
+static char *parse_literal(json_reader_cursor &cursor, const char *literal,
+    ft_size_t literal_length)
 {
-    skip_whitespace(json_string, index);
-    ft_size_t length = ft_strlen_size_t(json_string);
-    if (index >= length)
+    const char *text;
+    ft_size_t available;
+    char *value;
+
+    text = cursor.content + cursor.index.positions[cursor.position];
+    available = cursor.length - cursor.index.positions[cursor.position];
+    if (available < literal_length || ft_memcmp(text, literal, literal_length) != 0
+        || (available > literal_length && !json_reader_is_delimiter(text[literal_length])))
     {
         json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
         return (ft_nullptr);
     }
-    if (json_string[index] == '"')
-    {
-        char *value = parse_string(json_string, index);
-        int32_t string_error = json_reader_get_error();
-        if (!value)
-        {
-            json_reader_set_error(string_error);
-            return (ft_nullptr);
-        }
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (value);
-    }
-    if (length - index >= 4 && ft_strncmp(json_string + index, "true", 4) == FT_ERR_SUCCESS)
-    {
-        index += 4;
-        char *value = adv_strdup("true");
-        int32_t string_error = json_reader_get_error();
-        if (!value)
-        {
-            json_reader_set_error(string_error);
-            return (ft_nullptr);
-        }
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (value);
-    }
-    if (length - index >= 5 && ft_strncmp(json_string + index, "false", 5) == FT_ERR_SUCCESS)
-    {
-        index += 5;
-        char *value = adv_strdup("false");
-        int32_t string_error = json_reader_get_error();
-        if (!value)
-        {
-            json_reader_set_error(string_error);
-            return (ft_nullptr);
-        }
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (value);
-    }
-    if (ft_isdigit(static_cast<unsigned char>(json_string[index]))
-        || json_string[index] == '-' || json_string[index] == '+')
+    value = adv_strdup(literal);
+    if (!value)
     {
-        char *value = parse_number(json_string, index);
-        int32_t number_error = json_reader_get_error();
-        if (!value)
-        {
-            json_reader_set_error(number_error);
-            return (ft_nullptr);
-        }
-        json_reader_set_error(FT_ERR_SUCCESS);
-        return (value);
+        json_reader_set_error(FT_ERR_NO_MEMORY);
+        return (ft_nullptr);
     }
+    cursor.position++;
+    json_reader_set_error(FT_ERR_SUCCESS);
+    return (value);
+}
+
+static char *parse_value(json_reader_cursor &cursor)
+{
+    char token;
+
+    token = json_reader_token(cursor);
+    if (token == '"')
+        return (parse_string(cursor));
+    if (token == 't')
+        return (parse_literal(cursor, "true", 4));
+    if (token == 'f')
+        return (parse_literal(cursor, "false", 5));
+    if (ft_isdigit(static_cast<unsigned char>(token)) || token == '-' || token == '+')
+        return (parse_number(cursor));
     json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
     return (ft_nullptr);
 }
 
-static json_item *parse_items(const char *json_string, ft_size_t &index)
+static json_item *parse_items(json_reader_cursor &cursor)
 {
-    ft_size_t length = ft_strlen_size_t(json_string);
     json_item *head = ft_nullptr;
     json_item *tail = ft_nullptr;
-    skip_whitespace(json_string, index);
-    if (index >= length || json_string[index] != '{')
+
+    if (json_reader_token(cursor) != '{')
     {
         json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
         return (ft_nullptr);
     }
-    index++;
+    cursor.position++;
     ft_bool object_closed = FT_FALSE;
-    while (index < length)
+    while (cursor.position < cursor.index.count)
     {
-        skip_whitespace(json_string, index);
-        if (index < length && json_string[index] == '}')
+        if (json_reader_token(cursor) == '}')
         {
-            index++;
+            cursor.position++;
             object_closed = FT_TRUE;
             break ;
         }
-        char *key = parse_string(json_string, index);
+        char *key = parse_string(cursor);
         int32_t key_error = json_reader_get_error();
         if (!key)
         {
@@ -687,17 +278,15 @@ static json_item *parse_items(const char *json_string, ft_size_t &index)
             json_reader_set_error(key_error);
             return (ft_nullptr);
         }
-        skip_whitespace(json_string, index);
-        if (index >= length || json_string[index] != ':')
+        if (json_reader_token(cursor) != ':')
         {
             cma_free(key);
             json_free_items(head);
             json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
             return (ft_nullptr);
         }
-        index++;
-        skip_whitespace(json_string, index);
-        char *value = parse_value(json_string, index);
+        cursor.position++;
+        char *value = parse_value(cursor);
         int32_t value_error = json_reader_get_error();
         if (!value)
         {
@@ -723,12 +312,8 @@ static json_item *parse_items(const char *json_string, ft_size_t &index)
             tail->next = item;
             tail = item;
         }
-        skip_whitespace(json_string, index);
-        if (index < length && json_string[index] == ',')
-        {
-            index++;
-            continue;
-        }
+        if (json_reader_token(cursor) == ',')
+            cursor.position++;
     }
     if (!object_closed)
     {
@@ -740,70 +325,48 @@ static json_item *parse_items(const char *json_string, ft_size_t &index)
     return (head);
 }
 
-json_group *json_read_from_file(const char *filename)
+static json_group *parse_groups(json_reader_cursor &cursor)
 {
-    char *content;
-    ft_size_t index;
-    ft_size_t length;
-    json_group *head;
-    json_group *tail;
-    ft_bool object_closed;
+    json_group *head = ft_nullptr;
+    json_group *tail = ft_nullptr;
 
-    content = json_read_file_content(filename);
-    int32_t content_error = json_reader_get_error();
-    if (content == ft_nullptr)
+    if (json_reader_token(cursor) != '{')
     {
-        json_reader_set_error(content_error);
-        return (ft_nullptr);
-    }
-    index = 0;
-    skip_whitespace(content, index);
-    length = ft_strlen_size_t(content);
-    if (index >= length || content[index] != '{')
-    {
-        cma_free(content);
         json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
         return (ft_nullptr);
     }
-    index++;
-    head = ft_nullptr;
-    tail = ft_nullptr;
-    object_closed = FT_FALSE;
-    while (index < length)
+    cursor.position++;
+    ft_bool object_closed = FT_FALSE;
+    while (cursor.position < cursor.index.count)
     {
-        skip_whitespace(content, index);
-        if (index < length && content[index] == '}')
+        if (json_reader_token(cursor) == '}')
         {
-            index++;
+            cursor.position++;
             object_closed = FT_TRUE;
             break ;
         }
-        char *group_name = parse_string(content, index);
+        char *group_name = parse_string(cursor);
         int32_t name_error = json_reader_get_error();
         if (!group_name)
         {
             json_free_groups(head);
-            cma_free(content);
             json_reader_set_error(name_error);
             return (ft_nullptr);
         }
-        skip_whitespace(content, index);
-        if (index >= length || content[index] != ':')
+        if (json_reader_token(cursor) != ':')
         {
             cma_free(group_name);
             json_free_groups(head);
-            cma_free(content);
             json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
             return (ft_nullptr);
         }
-        index++;
-        json_item *items = parse_items(content, index);
+        cursor.position++;
+        json_item *items = parse_items(cursor);
         int32_t items_error = json_reader_get_error();
         if (items_error != FT_ERR_SUCCESS)
         {
             cma_free(group_name);
             json_free_groups(head);
-            cma_free(content);
             json_reader_set_error(items_error);
             return (ft_nullptr);
         }
@@ -812,9 +375,10 @@ json_group *json_read_from_file(const char *filename)
         cma_free(group_name);
         if (!group)
         {
+            if (group_error == FT_ERR_SUCCESS)
+                group_error = FT_ERR_INVALID_ARGUMENT;
             json_free_items(items);
             json_free_groups(head);
-            cma_free(content);
             json_reader_set_error(group_error);
             return (ft_nullptr);
         }
@@ -826,25 +390,63 @@ json_group *json_read_from_file(const char *filename)
             tail->next = group;
             tail = group;
         }
-        skip_whitespace(content, index);
-        if (index < length && content[index] == ',')
-        {
-            index++;
-            continue;
-        }
+        if (json_reader_token(cursor) == ',')
+            cursor.position++;
     }
     if (!object_closed)
     {
         json_free_groups(head);
-        cma_free(content);
         json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
         return (ft_nullptr);
     }
-    cma_free(content);
     json_reader_set_error(FT_ERR_SUCCESS);
     return (head);
 }
 
+static json_group *json_reader_parse_content(const char *content, ft_size_t length)
+{
+    json_reader_cursor cursor;
+    json_group *head;
+    int32_t index_error;
+    int32_t parse_error;
+
+    cursor.content = content;
+    cursor.length = length;
+    cursor.position = 0;
+    json_structural_index_init(&cursor.index);
+    index_error = json_structural_index_build(&cursor.index, content, length);
+    if (index_error != FT_ERR_SUCCESS)
+    {
+        json_structural_index_destroy(&cursor.index);
+        json_reader_set_error(index_error);
+        return (ft_nullptr);
+    }
+    head = parse_groups(cursor);
+    parse_error = json_reader_get_error();
+    json_structural_index_destroy(&cursor.index);
+    json_reader_set_error(parse_error);
+    return (head);
+}
+
+json_group *json_read_from_file(const char *filename)
+{
+    char *content;
+    json_group *head;
+
+    content = json_read_file_content(filename);
+    int32_t content_error = json_reader_get_error();
+    if (content == ft_nullptr)
+    {
+        json_reader_set_error(content_error);
+        return (ft_nullptr);
+    }
+    head = json_reader_parse_content(content, ft_strlen_size_t(content));
+    int32_t parse_error = json_reader_get_error();
+    cma_free(content);
+    json_reader_set_error(parse_error);
+    return (head);
+}
+
 json_group *json_read_from_backend(ft_document_source &source)
 {
     ft_string content_buffer;
@@ -856,7 +458,8 @@ json_group *json_read_from_backend(ft_document_source &source)
         json_reader_set_error(read_result);
         return (ft_nullptr);
     }
-    json_group *result = json_read_from_string(content_buffer.c_str());
+    json_group *result = json_reader_parse_content(content_buffer.c_str(),
+        content_buffer.size());
     int32_t parse_error = json_reader_get_error();
     if (!result)
     {
@@ -879,88 +482,5 @@ json_group *json_read_from_string(const char *content)
         json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
         return (ft_nullptr);
     }
-    ft_size_t index = 0;
-    skip_whitespace(content, index);
-    ft_size_t length = ft_strlen_size_t(content);
-    if (index >= length || content[index] != '{')
-    {
-        json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-        return (ft_nullptr);
-    }
-    index++;
-    json_group *head = ft_nullptr;
-    json_group *tail = ft_nullptr;
-    ft_bool object_closed = FT_FALSE;
-    while (index < length)
-    {
-        skip_whitespace(content, index);
-        if (index < length && content[index] == '}')
-        {
-            index++;
-            object_closed = FT_TRUE;
-            break ;
-        }
-        char *group_name = parse_string(content, index);
-        int32_t name_error = json_reader_get_error();
-        if (!group_name)
-        {
-            if (name_error == FT_ERR_SUCCESS)
-                name_error = FT_ERR_INVALID_ARGUMENT;
-            json_free_groups(head);
-            json_reader_set_error(name_error);
-            return (ft_nullptr);
-        }
-        skip_whitespace(content, index);
-        if (index >= length || content[index] != ':')
-        {
-            cma_free(group_name);
-            json_free_groups(head);
-            json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-            return (ft_nullptr);
-        }
-        index++;
-        json_item *items = parse_items(content, index);
-        int32_t items_error = json_reader_get_error();
-        if (items_error != FT_ERR_SUCCESS)
-        {
-            cma_free(group_name);
-            json_free_groups(head);
-            json_reader_set_error(items_error);
-            return (ft_nullptr);
-        }
-        json_group *group = json_create_json_group(group_name);
-        int32_t group_error = json_reader_get_error();
-        cma_free(group_name);
-        if (!group)
-        {
-            if (group_error == FT_ERR_SUCCESS)
-                group_error = FT_ERR_INVALID_ARGUMENT;
-            json_free_items(items);
-            json_free_groups(head);
-            json_reader_set_error(group_error);
-            return (ft_nullptr);
-        }
-        group->items = items;
-        if (!head)
-            head = tail = group;
-        else
-        {
-            tail->next = group;
-            tail = group;
-        }
-        skip_whitespace(content, index);
-        if (index < length && content[index] == ',')
-        {
-            index++;
-            continue;
-        }
-    }
-    if (!object_closed)
-    {
-        json_free_groups(head);
-        json_reader_set_error(FT_ERR_INVALID_ARGUMENT);
-        return (ft_nullptr);
-    }
-    json_reader_set_error(FT_ERR_SUCCESS);
-    return (head);
+    return (json_reader_parse_content(content, ft_strlen_size_t(content)));
 }
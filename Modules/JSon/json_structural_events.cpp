@@ -0,0 +1,272 @@
+#include "json_structural_index.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Errno/errno.hpp"
+
+#define JSON_STRUCTURAL_EXPECT_VALUE 0
+#define JSON_STRUCTURAL_EXPECT_KEY 1
+#define JSON_STRUCTURAL_AFTER_VALUE 2
+
+typedef struct json_structural_walker
+{
+    const char *content;
+    ft_size_t length;
+    const json_structural_index *index;
+    ft_size_t cursor;
+    char *scratch;
+    ft_size_t scratch_capacity;
+    json_stream_event_callback callback;
+    void *user_data;
+} json_structural_walker;
+
+static ft_bool json_structural_is_delimiter(char character) noexcept
+{
+    return (character == ' ' || character == '\t' || character == '\n'
+        || character == '\r' || character == ',' || character == ':'
+        || character == '{' || character == '}' || character == '['
+        || character == ']' || character == '"');
+}
+
+static int32_t json_structural_emit(json_structural_walker *walker,
+    json_stream_event_type type, const char *data, ft_size_t length,
+    ft_bool bool_value) noexcept
+{
+    json_stream_event event;
+
+    if (walker->callback == ft_nullptr)
+        return (FT_ERR_SUCCESS);
+    event.type = type;
+    event.value.data = data;
+    event.value.length = length;
+    event.bool_value = bool_value;
+    if (walker->callback(walker->user_data, &event) != FT_ERR_SUCCESS)
+        return (FT_ERR_INVALID_OPERATION);
+    return (FT_ERR_SUCCESS);
+}
+
+static char json_structural_token(const json_structural_walker *walker) noexcept
+{
+    if (walker->cursor >= walker->index->count)
+        return ('\0');
+    return (walker->content[walker->index->positions[walker->cursor]]);
+}
+
+static int32_t json_structural_reserve_scratch(json_structural_walker *walker,
+    ft_size_t minimum) noexcept
+{
+    char *scratch;
+
+    if (walker->scratch_capacity >= minimum)
+        return (FT_ERR_SUCCESS);
+    scratch = static_cast<char *>(cma_realloc(walker->scratch, minimum));
+    if (scratch == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    walker->scratch = scratch;
+    walker->scratch_capacity = minimum;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_structural_walk_string(json_structural_walker *walker,
+    json_stream_event_type type) noexcept
+{
+    ft_size_t open_position;
+    ft_size_t close_position;
+    ft_size_t raw_length;
+    ft_size_t decoded_length;
+    int32_t error_code;
+
+    if (walker->cursor + 1 >= walker->index->count)
+        return (FT_ERR_INVALID_ARGUMENT);
+    open_position = walker->index->positions[walker->cursor];
+    close_position = walker->index->positions[walker->cursor + 1];
+    if (walker->content[close_position] != '"')
+        return (FT_ERR_INVALID_ARGUMENT);
+    raw_length = close_position - open_position - 1;
+    error_code = json_structural_reserve_scratch(walker, raw_length + 1);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = json_structural_decode_string(walker->content + open_position + 1,
+        raw_length, walker->scratch, &decoded_length);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    walker->cursor += 2;
+    return (json_structural_emit(walker, type, walker->scratch, decoded_length, FT_FALSE));
+}
+
+static int32_t json_structural_walk_scalar(json_structural_walker *walker) noexcept
+{
+    const char *text;
+    ft_size_t available;
+    ft_size_t token_length;
+    int32_t error_code;
+
+    text = walker->content + walker->index->positions[walker->cursor];
+    available = walker->length - walker->index->positions[walker->cursor];
+    walker->cursor++;
+    if (available >= 4 && ft_memcmp(text, "true", 4) == 0
+        && (available == 4 || json_structural_is_delimiter(text[4])))
+        return (json_structural_emit(walker, JSON_STREAM_EVENT_BOOLEAN, ft_nullptr, 0,
+            FT_TRUE));
+    if (available >= 5 && ft_memcmp(text, "false", 5) == 0
+        && (available == 5 || json_structural_is_delimiter(text[5])))
+        return (json_structural_emit(walker, JSON_STREAM_EVENT_BOOLEAN, ft_nullptr, 0,
+            FT_FALSE));
+    if (available >= 4 && ft_memcmp(text, "null", 4) == 0
+        && (available == 4 || json_structural_is_delimiter(text[4])))
+        return (json_structural_emit(walker, JSON_STREAM_EVENT_NULL, ft_nullptr, 0,
+            FT_FALSE));
+    token_length = json_structural_number_length(text, available);
+    if (token_length == 0
+        || (token_length < available && !json_structural_is_delimiter(text[token_length])))
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = json_structural_reserve_scratch(walker, token_length + 1);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    ft_memcpy(walker->scratch, text, token_length);
+    walker->scratch[token_length] = '\0';
+    return (json_structural_emit(walker, JSON_STREAM_EVENT_NUMBER, walker->scratch,
+        token_length, FT_FALSE));
+}
+
+static int32_t json_structural_walk(json_structural_walker *walker) noexcept
+{
+    char stack[JSON_STRUCTURAL_MAX_DEPTH];
+    ft_size_t depth;
+    int32_t state;
+    int32_t error_code;
+    char token;
+    char closing;
+
+    depth = 0;
+    state = JSON_STRUCTURAL_EXPECT_VALUE;
+    while (FT_TRUE)
+    {
+        token = json_structural_token(walker);
+        if (state == JSON_STRUCTURAL_EXPECT_KEY)
+        {
+            if (token != '"')
+                return (FT_ERR_INVALID_ARGUMENT);
+            error_code = json_structural_walk_string(walker, JSON_STREAM_EVENT_KEY);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            if (json_structural_token(walker) != ':')
+                return (FT_ERR_INVALID_ARGUMENT);
+            walker->cursor++;
+            state = JSON_STRUCTURAL_EXPECT_VALUE;
+            continue ;
+        }
+        if (state == JSON_STRUCTURAL_AFTER_VALUE)
+        {
+            if (depth == 0)
+            {
+                if (walker->cursor != walker->index->count)
+                    return (FT_ERR_INVALID_ARGUMENT);
+                return (FT_ERR_SUCCESS);
+            }
+            walker->cursor++;
+            if (token == ',')
+            {
+                if (stack[depth - 1] == '{')
+                    state = JSON_STRUCTURAL_EXPECT_KEY;
+                else
+                    state = JSON_STRUCTURAL_EXPECT_VALUE;
+                continue ;
+            }
+            if (token == '}' && stack[depth - 1] == '{')
+                error_code = json_structural_emit(walker, JSON_STREAM_EVENT_END_OBJECT,
+                    ft_nullptr, 0, FT_FALSE);
+            else if (token == ']' && stack[depth - 1] == '[')
+                error_code = json_structural_emit(walker, JSON_STREAM_EVENT_END_ARRAY,
+                    ft_nullptr, 0, FT_FALSE);
+            else
+                return (FT_ERR_INVALID_ARGUMENT);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            depth--;
+            continue ;
+        }
+        if (token == '{' || token == '[')
+        {
+            if (token == '{')
+                error_code = json_structural_emit(walker, JSON_STREAM_EVENT_BEGIN_OBJECT,
+                    ft_nullptr, 0, FT_FALSE);
+            else
+                error_code = json_structural_emit(walker, JSON_STREAM_EVENT_BEGIN_ARRAY,
+                    ft_nullptr, 0, FT_FALSE);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            walker->cursor++;
+            closing = ']';
+            if (token == '{')
+                closing = '}';
+            if (json_structural_token(walker) == closing)
+            {
+                walker->cursor++;
+                if (token == '{')
+                    error_code = json_structural_emit(walker, JSON_STREAM_EVENT_END_OBJECT,
+                        ft_nullptr, 0, FT_FALSE);
+                else
+                    error_code = json_structural_emit(walker, JSON_STREAM_EVENT_END_ARRAY,
+                        ft_nullptr, 0, FT_FALSE);
+                if (error_code != FT_ERR_SUCCESS)
+                    return (error_code);
+                state = JSON_STRUCTURAL_AFTER_VALUE;
+                continue ;
+            }
+            if (depth >= JSON_STRUCTURAL_MAX_DEPTH)
+                return (FT_ERR_OUT_OF_RANGE);
+            stack[depth] = token;
+            depth++;
+            if (token == '{')
+                state = JSON_STRUCTURAL_EXPECT_KEY;
+            continue ;
+        }
+        if (token == '"')
+            error_code = json_structural_walk_string(walker, JSON_STREAM_EVENT_STRING);
+        else if (token == '\0' || token == '}' || token == ']' || token == ','
+            || token == ':')
+            return (FT_ERR_INVALID_ARGUMENT);
+        else
+            error_code = json_structural_walk_scalar(walker);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        state = JSON_STRUCTURAL_AFTER_VALUE;
+    }
+}
+
+int32_t json_structural_read_events(const char *content, ft_size_t length,
+    json_stream_event_callback callback, void *user_data) noexcept
+{
+    json_structural_index index;
+    json_structural_walker walker;
+    int32_t error_code;
+
+    if (content == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    json_structural_index_init(&index);
+    error_code = json_structural_index_build(&index, content, length);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        json_structural_index_destroy(&index);
+        return (error_code);
+    }
+    walker.content = content;
+    walker.length = length;
+    walker.index = &index;
+    walker.cursor = 0;
+    walker.scratch = ft_nullptr;
+    walker.scratch_capacity = 0;
+    walker.callback = callback;
+    walker.user_data = user_data;
+    error_code = json_structural_emit(&walker, JSON_STREAM_EVENT_BEGIN_DOCUMENT,
+        ft_nullptr, 0, FT_FALSE);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = json_structural_walk(&walker);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = json_structural_emit(&walker, JSON_STREAM_EVENT_END_DOCUMENT,
+            ft_nullptr, 0, FT_FALSE);
+    if (walker.scratch != ft_nullptr)
+        cma_free(walker.scratch);
+    json_structural_index_destroy(&index);
+    return (error_code);
+}
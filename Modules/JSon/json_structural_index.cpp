@@ -0,0 +1,684 @@
+#include "json_structural_index.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Errno/errno.hpp"
+#include <atomic>
+#if defined(__SSE2__)
+# include <immintrin.h>
+#endif
+
+#if defined(__x86_64__) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+# define JSON_STRUCTURAL_HAS_AVX2 1
+#else
+# define JSON_STRUCTURAL_HAS_AVX2 0
+#endif
+
+typedef struct json_structural_masks
+{
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t operators;
+    uint64_t whitespace;
+    uint64_t control;
+    uint64_t non_ascii;
+} json_structural_masks;
+
+typedef struct json_structural_utf8_state
+{
+    uint32_t remaining;
+    unsigned char lower;
+    unsigned char upper;
+    unsigned char previous[32];
+} json_structural_utf8_state;
+
+typedef void (*json_structural_classifier)(const unsigned char *block,
+    json_structural_masks *masks);
+typedef int32_t (*json_structural_utf8_validator)(const unsigned char *block,
+    ft_size_t block_length, json_structural_utf8_state *state);
+
+static std::atomic<int32_t> g_json_structural_backend(JSON_STRUCTURAL_BACKEND_AUTO);
+
+static void json_structural_clear_masks(json_structural_masks *masks) noexcept
+{
+    masks->quote = 0;
+    masks->backslash = 0;
+    masks->operators = 0;
+    masks->whitespace = 0;
+    masks->control = 0;
+    masks->non_ascii = 0;
+    return ;
+}
+
+static void json_structural_classify_scalar(const unsigned char *block,
+    json_structural_masks *masks) noexcept
+{
+    ft_size_t byte_index;
+    uint64_t bit;
+    unsigned char character;
+
+    json_structural_clear_masks(masks);
+    byte_index = 0;
+    while (byte_index < JSON_STRUCTURAL_BLOCK_SIZE)
+    {
+        character = block[byte_index];
+        bit = static_cast<uint64_t>(1) << byte_index;
+        if (character == '"')
+            masks->quote |= bit;
+        else if (character == '\\')
+            masks->backslash |= bit;
+        else if (character == '{' || character == '}' || character == '['
+            || character == ']' || character == ':' || character == ',')
+            masks->operators |= bit;
+        else if (character == ' ' || character == '\t' || character == '\n'
+            || character == '\r')
+            masks->whitespace |= bit;
+        if (character < 0x20)
+            masks->control |= bit;
+        if (character >= 0x80)
+            masks->non_ascii |= bit;
+        byte_index++;
+    }
+    return ;
+}
+
+#if defined(__SSE2__)
+static uint64_t json_structural_sse2_bits(__m128i matches, int32_t chunk) noexcept
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matches)))
+        << (chunk * 16));
+}
+
+static void json_structural_classify_sse2(const unsigned char *block,
+    json_structural_masks *masks) noexcept
+{
+    __m128i bytes;
+    __m128i folded;
+    __m128i matches;
+    int32_t chunk;
+
+    json_structural_clear_masks(masks);
+    chunk = 0;
+    while (chunk < 4)
+    {
+        bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + chunk * 16));
+        folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+        masks->quote |= json_structural_sse2_bits(
+            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('"')), chunk);
+        masks->backslash |= json_structural_sse2_bits(
+            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\')), chunk);
+        matches = _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+            _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(':')));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(',')));
+        masks->operators |= json_structural_sse2_bits(matches, chunk);
+        matches = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')),
+            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')));
+        masks->whitespace |= json_structural_sse2_bits(matches, chunk);
+        masks->non_ascii |= json_structural_sse2_bits(bytes, chunk);
+        masks->control |= json_structural_sse2_bits(
+            _mm_cmplt_epi8(bytes, _mm_set1_epi8(0x20)), chunk);
+        chunk++;
+    }
+    masks->control &= ~masks->non_ascii;
+    return ;
+}
+#endif
+
+#if JSON_STRUCTURAL_HAS_AVX2
+__attribute__((target("avx2")))
+static uint64_t json_structural_avx2_bits(__m256i matches, int32_t chunk) noexcept
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(matches)))
+        << (chunk * 32));
+}
+
+__attribute__((target("avx2")))
+static void json_structural_classify_avx2(const unsigned char *block,
+    json_structural_masks *masks) noexcept
+{
+    __m256i bytes;
+    __m256i folded;
+    __m256i matches;
+    int32_t chunk;
+
+    json_structural_clear_masks(masks);
+    chunk = 0;
+    while (chunk < 2)
+    {
+        bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + chunk * 32));
+        folded = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20));
+        masks->quote |= json_structural_avx2_bits(
+            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')), chunk);
+        masks->backslash |= json_structural_avx2_bits(
+            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\\')), chunk);
+        matches = _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')),
+            _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')));
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(':')));
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(',')));
+        masks->operators |= json_structural_avx2_bits(matches, chunk);
+        matches = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')),
+            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t')));
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')));
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r')));
+        masks->whitespace |= json_structural_avx2_bits(matches, chunk);
+        masks->non_ascii |= json_structural_avx2_bits(bytes, chunk);
+        masks->control |= json_structural_avx2_bits(
+            _mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), bytes), chunk);
+        chunk++;
+    }
+    masks->control &= ~masks->non_ascii;
+    return ;
+}
+static const unsigned char g_json_structural_utf8_byte_1_high[32] = {
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x80, 0x80, 0x80, 0x80, 0x21, 0x01, 0x15, 0x49,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x80, 0x80, 0x80, 0x80, 0x21, 0x01, 0x15, 0x49
+};
+
+static const unsigned char g_json_structural_utf8_byte_1_low[32] = {
+    0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB,
+    0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB,
+    0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB,
+    0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB
+};
+
+static const unsigned char g_json_structural_utf8_byte_2_high[32] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xE6, 0xAE, 0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xE6, 0xAE, 0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01
+};
+
+__attribute__((target("avx2")))
+static __m256i json_structural_avx2_utf8_errors(__m256i input, __m256i previous) noexcept
+{
+    __m256i low_nibble;
+    __m256i shifted;
+    __m256i prev1;
+    __m256i special_cases;
+    __m256i continuations;
+
+    low_nibble = _mm256_set1_epi8(0x0F);
+    shifted = _mm256_permute2x128_si256(previous, input, 0x21);
+    prev1 = _mm256_alignr_epi8(input, shifted, 15);
+    special_cases = _mm256_and_si256(
+        _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                g_json_structural_utf8_byte_1_high)),
+            _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble)),
+        _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                g_json_structural_utf8_byte_1_low)),
+            _mm256_and_si256(prev1, low_nibble)));
+    special_cases = _mm256_and_si256(special_cases,
+        _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                g_json_structural_utf8_byte_2_high)),
+            _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble)));
+    continuations = _mm256_or_si256(
+        _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 14), _mm256_set1_epi8(0x60)),
+        _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 13), _mm256_set1_epi8(0x70)));
+    continuations = _mm256_and_si256(continuations,
+        _mm256_set1_epi8(static_cast<char>(0x80)));
+    return (_mm256_xor_si256(continuations, special_cases));
+}
+
+__attribute__((target("avx2")))
+static int32_t json_structural_validate_utf8_avx2(const unsigned char *block,
+    ft_size_t block_length, json_structural_utf8_state *state) noexcept
+{
+    __m256i previous;
+    __m256i first;
+    __m256i second;
+    __m256i errors;
+
+    (void)block_length;
+    previous = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state->previous));
+    first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+    second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 32));
+    errors = _mm256_or_si256(json_structural_avx2_utf8_errors(first, previous),
+        json_structural_avx2_utf8_errors(second, first));
+    if (!_mm256_testz_si256(errors, errors))
+        return (FT_ERR_INVALID_ARGUMENT);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state->previous), second);
+    state->remaining = 0;
+    if (block[63] >= 0xC0 || block[62] >= 0xE0 || block[61] >= 0xF0)
+        state->remaining = 1;
+    return (FT_ERR_SUCCESS);
+}
+#endif
+
+ft_bool json_structural_backend_supported(json_structural_backend backend) noexcept
+{
+    if (backend == JSON_STRUCTURAL_BACKEND_AUTO || backend == JSON_STRUCTURAL_BACKEND_SCALAR)
+        return (FT_TRUE);
+#if defined(__SSE2__)
+    if (backend == JSON_STRUCTURAL_BACKEND_SSE2)
+        return (FT_TRUE);
+#endif
+#if JSON_STRUCTURAL_HAS_AVX2
+    if (backend == JSON_STRUCTURAL_BACKEND_AVX2 && __builtin_cpu_supports("avx2"))
+        return (FT_TRUE);
+#endif
+    return (FT_FALSE);
+}
+
+int32_t json_structural_set_backend(json_structural_backend backend) noexcept
+{
+    if (!json_structural_backend_supported(backend))
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    g_json_structural_backend.store(static_cast<int32_t>(backend), std::memory_order_relaxed);
+    return (FT_ERR_SUCCESS);
+}
+
+json_structural_backend json_structural_get_backend() noexcept
+{
+    json_structural_backend backend;
+
+    backend = static_cast<json_structural_backend>(
+        g_json_structural_backend.load(std::memory_order_relaxed));
+    if (backend != JSON_STRUCTURAL_BACKEND_AUTO)
+        return (backend);
+    if (json_structural_backend_supported(JSON_STRUCTURAL_BACKEND_AVX2))
+        return (JSON_STRUCTURAL_BACKEND_AVX2);
+    if (json_structural_backend_supported(JSON_STRUCTURAL_BACKEND_SSE2))
+        return (JSON_STRUCTURAL_BACKEND_SSE2);
+    return (JSON_STRUCTURAL_BACKEND_SCALAR);
+}
+
+static uint64_t json_structural_find_escaped(uint64_t backslash,
+    uint64_t *previous_escaped) noexcept
+{
+    uint64_t escaped;
+    uint64_t lowest;
+
+    escaped = *previous_escaped;
+    backslash &= ~escaped;
+    *previous_escaped = 0;
+    while (backslash != 0)
+    {
+        lowest = backslash & (0 - backslash);
+        if (lowest == (static_cast<uint64_t>(1) << 63))
+        {
+            *previous_escaped = 1;
+            break ;
+        }
+        escaped |= lowest << 1;
+        backslash &= ~(lowest | (lowest << 1));
+    }
+    return (escaped);
+}
+
+static uint64_t json_structural_prefix_xor(uint64_t bits) noexcept
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return (bits);
+}
+
+static int32_t json_structural_validate_utf8(const unsigned char *bytes, ft_size_t count,
+    json_structural_utf8_state *state) noexcept
+{
+    ft_size_t byte_index;
+    unsigned char character;
+
+    byte_index = 0;
+    while (byte_index < count)
+    {
+        character = bytes[byte_index];
+        byte_index++;
+        if (state->remaining > 0)
+        {
+            if (character < state->lower || character > state->upper)
+                return (FT_ERR_INVALID_ARGUMENT);
+            state->lower = 0x80;
+            state->upper = 0xBF;
+            state->remaining--;
+            continue ;
+        }
+        if (character < 0x80)
+            continue ;
+        state->lower = 0x80;
+        state->upper = 0xBF;
+        if (character >= 0xC2 && character <= 0xDF)
+            state->remaining = 1;
+        else if (character >= 0xE0 && character <= 0xEF)
+        {
+            state->remaining = 2;
+            if (character == 0xE0)
+                state->lower = 0xA0;
+            else if (character == 0xED)
+                state->upper = 0x9F;
+        }
+        else if (character >= 0xF0 && character <= 0xF4)
+        {
+            state->remaining = 3;
+            if (character == 0xF0)
+                state->lower = 0x90;
+            else if (character == 0xF4)
+                state->upper = 0x8F;
+        }
+        else
+            return (FT_ERR_INVALID_ARGUMENT);
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+static void json_structural_select_kernels(json_structural_classifier *classify,
+    json_structural_utf8_validator *validate_utf8) noexcept
+{
+    json_structural_backend backend;
+
+    backend = json_structural_get_backend();
+    *classify = &json_structural_classify_scalar;
+    *validate_utf8 = &json_structural_validate_utf8;
+#if defined(__SSE2__)
+    if (backend == JSON_STRUCTURAL_BACKEND_SSE2)
+        *classify = &json_structural_classify_sse2;
+#endif
+#if JSON_STRUCTURAL_HAS_AVX2
+    if (backend == JSON_STRUCTURAL_BACKEND_AVX2)
+    {
+        *classify = &json_structural_classify_avx2;
+        *validate_utf8 = &json_structural_validate_utf8_avx2;
+    }
+#endif
+    (void)backend;
+    return ;
+}
+
+static int32_t json_structural_index_reserve(json_structural_index *index,
+    ft_size_t minimum) noexcept
+{
+    ft_size_t new_capacity;
+    uint32_t *positions;
+
+    if (index->capacity >= minimum)
+        return (FT_ERR_SUCCESS);
+    new_capacity = index->capacity;
+    if (new_capacity < 256)
+        new_capacity = 256;
+    while (new_capacity < minimum)
+        new_capacity *= 2;
+    positions = static_cast<uint32_t *>(cma_realloc(index->positions,
+        new_capacity * sizeof(uint32_t)));
+    if (positions == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    index->positions = positions;
+    index->capacity = new_capacity;
+    return (FT_ERR_SUCCESS);
+}
+
+void json_structural_index_init(json_structural_index *index) noexcept
+{
+    if (index == ft_nullptr)
+        return ;
+    index->positions = ft_nullptr;
+    index->count = 0;
+    index->capacity = 0;
+    index->length = 0;
+    return ;
+}
+
+void json_structural_index_destroy(json_structural_index *index) noexcept
+{
+    if (index == ft_nullptr)
+        return ;
+    if (index->positions != ft_nullptr)
+        cma_free(index->positions);
+    json_structural_index_init(index);
+    return ;
+}
+
+int32_t json_structural_index_build(json_structural_index *index,
+    const char *content, ft_size_t length) noexcept
+{
+    json_structural_classifier classify;
+    json_structural_utf8_validator validate_utf8;
+    json_structural_masks masks;
+    json_structural_utf8_state utf8_state;
+    unsigned char padded[JSON_STRUCTURAL_BLOCK_SIZE];
+    const unsigned char *block;
+    ft_size_t offset;
+    ft_size_t block_length;
+    uint64_t previous_escaped;
+    uint64_t previous_in_string;
+    uint64_t previous_scalar;
+    uint64_t quote;
+    uint64_t in_string;
+    uint64_t scalar;
+    uint64_t structurals;
+    int32_t error_code;
+
+    if (index == ft_nullptr || (content == ft_nullptr && length != 0))
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (length > UINT32_MAX)
+        return (FT_ERR_OUT_OF_RANGE);
+    index->count = 0;
+    index->length = length;
+    error_code = json_structural_index_reserve(index, length / 8 + JSON_STRUCTURAL_BLOCK_SIZE);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    json_structural_select_kernels(&classify, &validate_utf8);
+    utf8_state.remaining = 0;
+    utf8_state.lower = 0x80;
+    utf8_state.upper = 0xBF;
+    ft_bzero(utf8_state.previous, sizeof(utf8_state.previous));
+    previous_escaped = 0;
+    previous_in_string = 0;
+    previous_scalar = 0;
+    offset = 0;
+    while (offset < length)
+    {
+        block_length = length - offset;
+        block = reinterpret_cast<const unsigned char *>(content + offset);
+        if (block_length < JSON_STRUCTURAL_BLOCK_SIZE)
+        {
+            ft_memset(padded, ' ', sizeof(padded));
+            ft_memcpy(padded, block, block_length);
+            block = padded;
+        }
+        else
+            block_length = JSON_STRUCTURAL_BLOCK_SIZE;
+        classify(block, &masks);
+        quote = masks.quote & ~json_structural_find_escaped(masks.backslash,
+            &previous_escaped);
+        in_string = json_structural_prefix_xor(quote) ^ previous_in_string;
+        previous_in_string = 0 - (in_string >> 63);
+        if ((masks.control & in_string) != 0)
+            return (FT_ERR_INVALID_ARGUMENT);
+        if (masks.non_ascii != 0 || utf8_state.remaining != 0)
+        {
+            error_code = validate_utf8(block, block_length, &utf8_state);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+        }
+        scalar = ~(masks.operators | masks.whitespace);
+        structurals = scalar & ~(((scalar & ~quote) << 1) | previous_scalar);
+        previous_scalar = (scalar & ~quote) >> 63;
+        structurals = ((structurals | masks.operators) & ~in_string & ~quote) | quote;
+        error_code = json_structural_index_reserve(index,
+            index->count + JSON_STRUCTURAL_BLOCK_SIZE);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        while (structurals != 0)
+        {
+            index->positions[index->count] = static_cast<uint32_t>(offset
+                + static_cast<ft_size_t>(__builtin_ctzll(structurals)));
+            index->count++;
+            structurals &= structurals - 1;
+        }
+        offset += JSON_STRUCTURAL_BLOCK_SIZE;
+    }
+    if (previous_in_string != 0 || utf8_state.remaining != 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+    return (FT_ERR_SUCCESS);
+}
+
+ft_size_t json_structural_number_length(const char *text, ft_size_t length) noexcept
+{
+    ft_size_t position;
+    ft_size_t digit_start;
+    ft_bool has_digits;
+
+    position = 0;
+    if (position < length && (text[position] == '-' || text[position] == '+'))
+        position++;
+    has_digits = FT_FALSE;
+    while (position < length && text[position] >= '0' && text[position] <= '9')
+    {
+        has_digits = FT_TRUE;
+        position++;
+    }
+    if (!has_digits)
+        return (0);
+    if (position < length && text[position] == '.')
+    {
+        position++;
+        digit_start = position;
+        while (position < length && text[position] >= '0' && text[position] <= '9')
+            position++;
+        if (position == digit_start)
+            return (0);
+    }
+    if (position < length && (text[position] == 'e' || text[position] == 'E'))
+    {
+        position++;
+        if (position < length && (text[position] == '-' || text[position] == '+'))
+            position++;
+        digit_start = position;
+        while (position < length && text[position] >= '0' && text[position] <= '9')
+            position++;
+        if (position == digit_start)
+            return (0);
+    }
+    return (position);
+}
+
+static int32_t json_structural_hex_unit(const char *text, uint32_t *code_unit) noexcept
+{
+    ft_size_t digit_index;
+    char character;
+
+    *code_unit = 0;
+    digit_index = 0;
+    while (digit_index < 4)
+    {
+        character = text[digit_index];
+        *code_unit <<= 4;
+        if (character >= '0' && character <= '9')
+            *code_unit |= static_cast<uint32_t>(character - '0');
+        else if (character >= 'a' && character <= 'f')
+            *code_unit |= static_cast<uint32_t>(character - 'a' + 10);
+        else if (character >= 'A' && character <= 'F')
+            *code_unit |= static_cast<uint32_t>(character - 'A' + 10);
+        else
+            return (FT_ERR_INVALID_ARGUMENT);
+        digit_index++;
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+static ft_size_t json_structural_encode_utf8(uint32_t code_point, char *output) noexcept
+{
+    if (code_point <= 0x7F)
+    {
+        output[0] = static_cast<char>(code_point);
+        return (1);
+    }
+    if (code_point <= 0x7FF)
+    {
+        output[0] = static_cast<char>(0xC0 | (code_point >> 6));
+        output[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return (2);
+    }
+    if (code_point <= 0xFFFF)
+    {
+        output[0] = static_cast<char>(0xE0 | (code_point >> 12));
+        output[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        output[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return (3);
+    }
+    output[0] = static_cast<char>(0xF0 | (code_point >> 18));
+    output[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    output[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    output[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return (4);
+}
+
+int32_t json_structural_decode_string(const char *text, ft_size_t length,
+    char *output, ft_size_t *output_length) noexcept
+{
+    const char *escape;
+    ft_size_t input_index;
+    ft_size_t written;
+    ft_size_t chunk_length;
+    uint32_t code_point;
+    uint32_t low_unit;
+    char escape_char;
+
+    input_index = 0;
+    written = 0;
+    while (input_index < length)
+    {
+        escape = static_cast<const char *>(ft_memchr(text + input_index, '\\',
+            length - input_index));
+        if (escape == ft_nullptr)
+            chunk_length = length - input_index;
+        else
+            chunk_length = static_cast<ft_size_t>(escape - (text + input_index));
+        ft_memcpy(output + written, text + input_index, chunk_length);
+        written += chunk_length;
+        input_index += chunk_length;
+        if (escape == ft_nullptr)
+            break ;
+        if (input_index + 1 >= length)
+            return (FT_ERR_INVALID_ARGUMENT);
+        escape_char = text[input_index + 1];
+        input_index += 2;
+        if (escape_char == '"' || escape_char == '\\' || escape_char == '/')
+            output[written] = escape_char;
+        else if (escape_char == 'b')
+            output[written] = '\b';
+        else if (escape_char == 'f')
+            output[written] = '\f';
+        else if (escape_char == 'n')
+            output[written] = '\n';
+        else if (escape_char == 'r')
+            output[written] = '\r';
+        else if (escape_char == 't')
+            output[written] = '\t';
+        else if (escape_char == 'u')
+        {
+            if (input_index + 4 > length
+                || json_structural_hex_unit(text + input_index, &code_point) != FT_ERR_SUCCESS)
+                return (FT_ERR_INVALID_ARGUMENT);
+            input_index += 4;
+            if (code_point >= 0xDC00 && code_point <= 0xDFFF)
+                return (FT_ERR_INVALID_ARGUMENT);
+            if (code_point >= 0xD800 && code_point <= 0xDBFF)
+            {
+                if (input_index + 6 > length || text[input_index] != '\\'
+                    || text[input_index + 1] != 'u'
+                    || json_structural_hex_unit(text + input_index + 2, &low_unit)
+                        != FT_ERR_SUCCESS
+                    || low_unit < 0xDC00 || low_unit > 0xDFFF)
+                    return (FT_ERR_INVALID_ARGUMENT);
+                input_index += 6;
+                code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_unit - 0xDC00);
+            }
+            written += json_structural_encode_utf8(code_point, output + written);
+            continue ;
+        }
+        else
+            return (FT_ERR_INVALID_ARGUMENT);
+        written++;
+    }
+    output[written] = '\0';
+    *output_length = written;
+    return (FT_ERR_SUCCESS);
+}
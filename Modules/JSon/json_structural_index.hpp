@@ -0,0 +1,40 @@
+#ifndef JSON_STRUCTURAL_INDEX_HPP
+#define JSON_STRUCTURAL_INDEX_HPP
+
+#include "../Basic/basic.hpp"
+#include "json_stream_events.hpp"
+#include <cstdint>
+
+#define JSON_STRUCTURAL_BLOCK_SIZE 64
+#define JSON_STRUCTURAL_MAX_DEPTH 1024
+
+enum json_structural_backend
+{
+    JSON_STRUCTURAL_BACKEND_AUTO,
+    JSON_STRUCTURAL_BACKEND_SCALAR,
+    JSON_STRUCTURAL_BACKEND_SSE2,
+    JSON_STRUCTURAL_BACKEND_AVX2
+};
+
+typedef struct json_structural_index
+{
+    uint32_t *positions;
+    ft_size_t count;
+    ft_size_t capacity;
+    ft_size_t length;
+} json_structural_index;
+
+void                    json_structural_index_init(json_structural_index *index) noexcept;
+void                    json_structural_index_destroy(json_structural_index *index) noexcept;
+int32_t                 json_structural_index_build(json_structural_index *index,
+                            const char *content, ft_size_t length) noexcept;
+int32_t                 json_structural_set_backend(json_structural_backend backend) noexcept;
+json_structural_backend json_structural_get_backend() noexcept;
+ft_bool                 json_structural_backend_supported(json_structural_backend backend) noexcept;
+ft_size_t               json_structural_number_length(const char *text, ft_size_t length) noexcept;
+int32_t                 json_structural_decode_string(const char *text, ft_size_t length,
+                            char *output, ft_size_t *output_length) noexcept;
+int32_t                 json_structural_read_events(const char *content, ft_size_t length,
+                            json_stream_event_callback callback, void *user_data) noexcept;
+
+#endif
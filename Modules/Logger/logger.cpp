@@ -527,6 +527,60 @@ ft_size_t ft_logger::get_async_queue_limit() const noexcept
     return (limit);
 }
 
+void ft_logger::set_async_overflow_policy(t_log_async_overflow_policy policy) noexcept
+{
+    ft_bool lock_acquired;
+
+    lock_acquired = FT_FALSE;
+    if (this->lock(&lock_acquired) != FT_ERR_SUCCESS)
+        return ;
+    ft_log_set_async_overflow_policy(policy);
+    this->set_error(FT_ERR_SUCCESS);
+    this->unlock(lock_acquired);
+    return ;
+}
+
+t_log_async_overflow_policy ft_logger::get_async_overflow_policy() const noexcept
+{
+    t_log_async_overflow_policy policy;
+    ft_bool lock_acquired;
+
+    lock_acquired = FT_FALSE;
+    if (this->lock(&lock_acquired) != FT_ERR_SUCCESS)
+        return (LOG_ASYNC_OVERFLOW_DROP_NEWEST);
+    policy = ft_log_get_async_overflow_policy();
+    const_cast<ft_logger *>(this)->set_error(FT_ERR_SUCCESS);
+    this->unlock(lock_acquired);
+    return (policy);
+}
+
+void ft_logger::set_batching(ft_size_t max_bytes, uint32_t max_delay_ms) noexcept
+{
+    ft_bool lock_acquired;
+
+    lock_acquired = FT_FALSE;
+    if (this->lock(&lock_acquired) != FT_ERR_SUCCESS)
+        return ;
+    ft_log_set_batching(max_bytes, max_delay_ms);
+    this->set_error(FT_ERR_SUCCESS);
+    this->unlock(lock_acquired);
+    return ;
+}
+
+int32_t ft_logger::flush() noexcept
+{
+    int32_t operation_result;
+    ft_bool lock_acquired;
+
+    lock_acquired = FT_FALSE;
+    if (this->lock(&lock_acquired) != FT_ERR_SUCCESS)
+        return (FT_ERR_INTERNAL);
+    operation_result = ft_log_flush();
+    this->set_error(operation_result);
+    this->unlock(lock_acquired);
+    return (operation_result);
+}
+
 int32_t ft_logger::get_async_metrics(s_log_async_metrics *metrics) noexcept
 {
     int32_t operation_result;
@@ -728,7 +782,9 @@ void ft_logger::debug(const char *format_string, ...) noexcept
         return ;
     }
     va_start(argument_list, format_string);
-    if (g_async_running)
+    if (g_binary_running)
+        ft_log_enqueue_binary(LOG_LEVEL_DEBUG, format_string, argument_list);
+    else if (g_async_running)
         ft_log_enqueue(LOG_LEVEL_DEBUG, format_string, argument_list);
     else
         ft_log_vwrite(LOG_LEVEL_DEBUG, format_string, argument_list);
@@ -754,7 +810,9 @@ void ft_logger::info(const char *format_string, ...) noexcept
         return ;
     }
     va_start(argument_list, format_string);
-    if (g_async_running)
+    if (g_binary_running)
+        ft_log_enqueue_binary(LOG_LEVEL_INFO, format_string, argument_list);
+    else if (g_async_running)
         ft_log_enqueue(LOG_LEVEL_INFO, format_string, argument_list);
     else
         ft_log_vwrite(LOG_LEVEL_INFO, format_string, argument_list);
@@ -780,7 +838,9 @@ void ft_logger::warn(const char *format_string, ...) noexcept
         return ;
     }
     va_start(argument_list, format_string);
-    if (g_async_running)
+    if (g_binary_running)
+        ft_log_enqueue_binary(LOG_LEVEL_WARN, format_string, argument_list);
+    else if (g_async_running)
         ft_log_enqueue(LOG_LEVEL_WARN, format_string, argument_list);
     else
         ft_log_vwrite(LOG_LEVEL_WARN, format_string, argument_list);
@@ -806,7 +866,9 @@ void ft_logger::error(const char *format_string, ...) noexcept
         return ;
     }
     va_start(argument_list, format_string);
-    if (g_async_running)
+    if (g_binary_running)
+        ft_log_enqueue_binary(LOG_LEVEL_ERROR, format_string, argument_list);
+    else if (g_async_running)
         ft_log_enqueue(LOG_LEVEL_ERROR, format_string, argument_list);
     else
         ft_log_vwrite(LOG_LEVEL_ERROR, format_string, argument_list);
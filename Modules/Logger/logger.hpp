@@ -45,6 +45,15 @@ struct s_log_field
     }
 };
 
+#define FT_LOG_ASYNC_RING_CAPACITY 1024
+#define FT_LOG_ASYNC_SLOT_SIZE 512
+
+enum t_log_async_overflow_policy {
+    LOG_ASYNC_OVERFLOW_DROP_NEWEST = 0,
+    LOG_ASYNC_OVERFLOW_DROP_OLDEST,
+    LOG_ASYNC_OVERFLOW_BLOCK
+};
+
 struct s_log_async_metrics
 {
     pt_mutex *mutex;
@@ -52,10 +61,16 @@ struct s_log_async_metrics
     ft_size_t pending_messages;
     ft_size_t peak_pending_messages;
     ft_size_t dropped_messages;
+    ft_size_t dropped_oldest_messages;
+    ft_size_t blocked_messages;
+    ft_size_t overflow_allocations;
+    ft_size_t worker_wakeups;
 
     s_log_async_metrics()
         : mutex(ft_nullptr), thread_safe_enabled(FT_FALSE), pending_messages(0),
-          peak_pending_messages(0), dropped_messages(0)
+          peak_pending_messages(0), dropped_messages(0),
+          dropped_oldest_messages(0), blocked_messages(0),
+          overflow_allocations(0), worker_wakeups(0)
     {
         return ;
     }
@@ -171,6 +186,47 @@ class ft_log_context_guard
         const char *get_error_str() const;
 };
 
+typedef int32_t (*t_log_binary_sink)(const void *data, ft_size_t size, void *user_data);
+
+class ft_log_binary_decoder
+{
+#ifdef LIBFT_TEST_BUILD
+    public:
+#else
+    private:
+#endif
+        uint8_t _initialised_state;
+        char **_formats;
+        ft_size_t _format_count;
+        ft_size_t _format_capacity;
+        unsigned char *_pending;
+        ft_size_t _pending_size;
+        ft_size_t _pending_capacity;
+        mutable int32_t _error_code;
+
+        void set_error(int32_t error_code_value) const noexcept;
+        int32_t store_format(uint32_t format_id, const unsigned char *text,
+                ft_size_t length) noexcept;
+        int32_t decode_entry(const unsigned char *entry, ft_string &output) noexcept;
+
+    public:
+        ft_log_binary_decoder() noexcept;
+        ft_log_binary_decoder(const ft_log_binary_decoder &other) noexcept = delete;
+        ft_log_binary_decoder(ft_log_binary_decoder &&other) noexcept = delete;
+        ~ft_log_binary_decoder() noexcept;
+
+        ft_log_binary_decoder &operator=(const ft_log_binary_decoder &) = delete;
+        ft_log_binary_decoder &operator=(ft_log_binary_decoder &&) = delete;
+
+        int32_t initialize() noexcept;
+        int32_t destroy() noexcept;
+
+        int32_t decode(const void *data, ft_size_t size, ft_string &output) noexcept;
+        ft_size_t pending_bytes() const noexcept;
+        int32_t get_error() const noexcept;
+        const char *get_error_str() const noexcept;
+};
+
 void ft_log_debug(const char *format_string, ...);
 void ft_log_info(const char *format_string, ...);
 void ft_log_warn(const char *format_string, ...);
@@ -181,8 +237,21 @@ void ft_log_structured(t_log_level level, const char *message,
                        const s_log_field *fields, ft_size_t field_count);
 void ft_log_set_async_queue_limit(ft_size_t limit);
 ft_size_t ft_log_get_async_queue_limit();
+void ft_log_set_async_overflow_policy(t_log_async_overflow_policy policy);
+t_log_async_overflow_policy ft_log_get_async_overflow_policy();
 int32_t  ft_log_get_async_metrics(s_log_async_metrics *metrics);
+void ft_log_enable_binary(ft_bool enable);
+ft_bool ft_log_is_binary_enabled();
+void ft_log_enqueue_binary(t_log_level level, const char *format_string, va_list argument_list);
+int32_t  ft_log_binary_flush();
+void ft_log_set_binary_sink(t_log_binary_sink sink, void *user_data);
+int32_t  ft_log_get_binary_statistics(ft_size_t *record_count, ft_size_t *dropped_count);
 void ft_log_reset_async_metrics();
+void ft_log_set_batching(ft_size_t max_bytes, uint32_t max_delay_ms);
+void ft_log_get_batching(ft_size_t *max_bytes, uint32_t *max_delay_ms);
+int32_t  ft_log_flush();
+int32_t  ft_log_get_write_statistics(ft_size_t *record_count, ft_size_t *syscall_count);
+void ft_log_reset_write_statistics();
 void ft_log_debug_structured(const char *message, const s_log_field *fields,
                              ft_size_t field_count);
 void ft_log_info_structured(const char *message, const s_log_field *fields,
@@ -214,7 +283,8 @@ class ft_logger
 
         void set_error(int32_t error_code_value) const noexcept;
         friend void ft_log_vwrite(t_log_level level, const char *format_string, va_list argument_list);
-        friend void ft_log_process_message(const ft_string &message);
+        friend void ft_log_process_message(t_log_level level, const char *message,
+            ft_size_t length);
 
         int32_t lock(ft_bool *lock_acquired) const noexcept;
         void unlock(ft_bool lock_acquired) const noexcept;
@@ -260,8 +330,12 @@ class ft_logger
         ft_bool is_thread_safe() const noexcept;
         void set_async_queue_limit(ft_size_t limit) noexcept;
         ft_size_t get_async_queue_limit() const noexcept;
+        void set_async_overflow_policy(t_log_async_overflow_policy policy) noexcept;
+        t_log_async_overflow_policy get_async_overflow_policy() const noexcept;
         int32_t  get_async_metrics(s_log_async_metrics *metrics) noexcept;
         void reset_async_metrics() noexcept;
+        void set_batching(ft_size_t max_bytes, uint32_t max_delay_ms) noexcept;
+        int32_t  flush() noexcept;
         void enable_remote_health(ft_bool enable) noexcept;
         void set_remote_health_interval(uint32_t interval_seconds) noexcept;
         int32_t  probe_remote_health() noexcept;
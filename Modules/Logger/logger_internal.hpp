@@ -17,12 +17,47 @@
 extern ft_logger *g_logger;
 extern t_log_level g_level;
 extern ft_bool g_async_running;
+extern ft_bool g_binary_running;
 extern ft_bool g_use_color;
 
 typedef int32_t (*t_log_sink)(const char *message, void *user_data);
 
 typedef ssize_t (*t_network_send_function)(int32_t socket_fd, const void *buffer, ft_size_t length, int32_t flags);
 
+#define FT_LOG_BATCH_MAX_VECTORS 4
+
+struct s_log_batch
+{
+    char        *data;
+    ft_size_t   size;
+    ft_size_t   capacity;
+    ft_size_t   record_count;
+    int64_t     first_record_ms;
+
+    s_log_batch()
+        : data(ft_nullptr), size(0), capacity(0), record_count(0), first_record_ms(0)
+    {
+        return ;
+    }
+
+    s_log_batch(const s_log_batch &other) = delete;
+    s_log_batch &operator=(const s_log_batch &other) = delete;
+    ~s_log_batch();
+};
+
+struct s_log_write_vector
+{
+    const char  *data;
+    ft_size_t   length;
+};
+
+struct s_log_line_buffer
+{
+    char        *data;
+    ft_size_t   capacity;
+    ft_size_t   length;
+};
+
 struct s_log_sink
 {
     pt_mutex   *mutex;
@@ -46,6 +81,7 @@ struct s_file_sink
     ft_size_t    max_size;
     ft_size_t    retention_count;
     uint32_t max_age_seconds;
+    s_log_batch batch;
 
     s_file_sink()
         : mutex(ft_nullptr), thread_safe_enabled(FT_FALSE), file_descriptor(-1), path(),
@@ -64,6 +100,7 @@ struct s_network_sink
     ft_string                   host;
     uint16_t              port;
     ft_bool                        use_tcp;
+    s_log_batch                 batch;
 
     s_network_sink()
         : mutex(ft_nullptr), thread_safe_enabled(FT_FALSE), socket_fd(-1),
@@ -88,6 +125,20 @@ struct s_redaction_rule
     int32_t destroy() noexcept;
 };
 
+struct s_log_redaction_snapshot
+{
+    uint16_t    byte_class[256];
+    uint32_t    class_count;
+    uint32_t    state_count;
+    uint32_t    *transitions;
+    uint32_t    *depth;
+    uint32_t    *match_length;
+    uint32_t    *match_rule;
+    char        **replacements;
+    ft_size_t   *replacement_lengths;
+    ft_size_t   rule_count;
+};
+
 struct s_log_context_entry
 {
     ft_string   key;
@@ -117,15 +168,92 @@ struct s_log_context_view
     }
 };
 
+#define FT_LOG_BINARY_BUFFER_SIZE 65536
+#define FT_LOG_BINARY_MAX_PAYLOAD 4096
+#define FT_LOG_BINARY_STRING_LIMIT 1024
+#define FT_LOG_BINARY_POLL_INTERVAL_MS 1
+
+enum e_log_binary_argument_class
+{
+    LOG_BINARY_ARGUMENT_NONE = 0,
+    LOG_BINARY_ARGUMENT_SIGNED,
+    LOG_BINARY_ARGUMENT_UNSIGNED,
+    LOG_BINARY_ARGUMENT_DOUBLE,
+    LOG_BINARY_ARGUMENT_LONG_DOUBLE,
+    LOG_BINARY_ARGUMENT_CHAR,
+    LOG_BINARY_ARGUMENT_STRING,
+    LOG_BINARY_ARGUMENT_POINTER
+};
+
+enum e_log_binary_entry_type
+{
+    LOG_BINARY_ENTRY_FORMAT = 1,
+    LOG_BINARY_ENTRY_RECORD = 2
+};
+
+#define LOG_BINARY_FLAG_WRAP 0x01
+#define LOG_BINARY_FLAG_PREFORMATTED 0x02
+#define LOG_BINARY_NULL_STRING 0xFFFFFFFFU
+
+struct s_log_binary_spec
+{
+    ft_size_t   start;
+    ft_size_t   body_end;
+    ft_size_t   end;
+    char        length_modifier[3];
+    char        conversion;
+    uint8_t     argument_class;
+};
+
+struct s_log_binary_record
+{
+    uint32_t    size;
+    uint8_t     flags;
+    uint8_t     level;
+    uint16_t    format_size;
+    uint32_t    arguments_size;
+    uint32_t    context_size;
+    int64_t     timestamp;
+};
+
+struct s_log_binary_stream_entry
+{
+    uint32_t    size;
+    uint8_t     type;
+    uint8_t     level;
+    uint8_t     flags;
+    uint8_t     reserved;
+    uint32_t    format_id;
+    uint32_t    arguments_size;
+    uint32_t    context_size;
+    uint32_t    reserved_tail;
+    int64_t     timestamp;
+};
+
+int32_t logger_binary_parse_spec(const char *format, ft_size_t start,
+        s_log_binary_spec *spec);
+int32_t logger_binary_render_message(const char *format,
+        const unsigned char *arguments, ft_size_t arguments_size,
+        ft_string &output);
+int32_t logger_binary_finish_record(t_log_level level, int64_t timestamp_ns,
+        ft_string &message_text, const char *context, ft_size_t context_size,
+        ft_string &formatted_message);
+void logger_binary_release_retired_buffers();
+void ft_log_process_message(t_log_level level, const char *message, ft_size_t length);
+
 extern ft_vector<s_log_sink> g_sinks;
 extern pthread_mutex_t g_sinks_mutex;
 extern ft_vector<s_redaction_rule> g_redaction_rules;
 
 int32_t logger_lock_sinks();
 int32_t logger_unlock_sinks();
-int32_t logger_copy_redaction_rules(ft_vector<s_redaction_rule> &destination);
-int32_t logger_apply_redactions(ft_string &text,
-        const ft_vector<s_redaction_rule> &rules);
+const s_log_redaction_snapshot *logger_redaction_read_lock(uint32_t *epoch);
+void logger_redaction_read_unlock(const s_log_redaction_snapshot *snapshot,
+    uint32_t epoch);
+int32_t logger_apply_redactions(const s_log_redaction_snapshot *snapshot,
+        ft_string &text);
+int32_t logger_apply_redactions_in_place(const s_log_redaction_snapshot *snapshot,
+        char *text, ft_size_t *text_length, ft_size_t capacity);
 int32_t logger_context_push(const s_log_field *fields, ft_size_t field_count,
         ft_size_t *pushed_count);
 void logger_context_pop(ft_size_t entry_count);
@@ -133,14 +261,31 @@ int32_t logger_context_apply_plain(ft_string &text);
 int32_t logger_context_snapshot(ft_vector<s_log_context_view> &snapshot);
 void logger_context_clear();
 int32_t logger_context_format_flat(ft_string &output);
+int32_t logger_context_format_flat_line(s_log_line_buffer *line);
+ft_bool logger_context_is_empty();
 int32_t logger_build_standard_message(t_log_level level, const ft_string &message_text,
         const ft_string &context_fragment, ft_string &formatted_message);
+int32_t logger_build_standard_message_at(t_log_level level, t_time timestamp_value,
+        const ft_string &message_text, const ft_string &context_fragment,
+        ft_string &formatted_message);
+int32_t logger_line_append(s_log_line_buffer *line, const char *text,
+        ft_size_t text_length);
+int32_t logger_line_append_quoted(s_log_line_buffer *line, const char *value);
+int32_t logger_build_standard_line(t_log_level level, const char *message_text,
+        s_log_line_buffer *line);
 
 void ft_log_rotate(s_file_sink *sink);
 int32_t logger_prepare_rotation(s_file_sink *sink, ft_bool *rotate_for_size, ft_bool *rotate_for_age);
 void logger_execute_rotation(s_file_sink *sink);
 int32_t ft_file_sink(const char *message, void *user_data);
 int32_t ft_network_sink(const char *message, void *user_data);
+int32_t logger_file_sink_write_locked(s_file_sink *sink, const char *message, ft_size_t length);
+int32_t logger_file_sink_flush_locked(s_file_sink *sink);
+int32_t logger_network_sink_write_locked(s_network_sink *sink, const char *message, ft_size_t length);
+int32_t logger_network_sink_flush_locked(s_network_sink *sink);
+int32_t logger_flush_sink_entry(const s_log_sink *entry);
+int32_t logger_flush_sink_batches();
+int32_t logger_write_stdout(const char *color_code, const char *message, ft_size_t length);
 const char *ft_level_to_str(t_log_level level);
 int32_t ft_log_level_to_severity(t_log_level level);
 void ft_log_vwrite(t_log_level level, const char *format_string, va_list argument_list);
@@ -1,11 +1,13 @@
 #include "logger_internal.hpp"
 #include "../Basic/class_nullptr.hpp"
+#include "../Basic/basic.hpp"
+#include "../CMA/CMA.hpp"
 #include "../Sink/sink.hpp"
-#include "../Template/queue.hpp"
 #include "../PThread/pthread.hpp"
 #include "../PThread/condition.hpp"
 #include "../Printf/printf.hpp"
 #include <unistd.h>
+#include <atomic>
 #include <cerrno>
 #include <new>
 #include "../Basic/limits.hpp"
@@ -14,17 +16,45 @@
 #include "../Template/vector.hpp"
 #include "../Errno/errno.hpp"
 
+struct s_log_async_slot
+{
+    std::atomic<ft_size_t> sequence;
+    ft_size_t length;
+    t_log_level level;
+    char *overflow_text;
+    char text[FT_LOG_ASYNC_SLOT_SIZE];
+};
+
 ft_bool g_async_running = FT_FALSE;
-static ft_size_t g_async_queue_limit = 1024;
-static ft_size_t g_async_pending_messages = 0;
-static ft_size_t g_async_peak_pending = 0;
-static ft_size_t g_async_dropped_messages = 0;
-static ft_queue<ft_string *> g_log_queue;
-static int32_t log_queue_initialize(void);
-static int32_t g_log_queue_initializer_result = log_queue_initialize();
-static int32_t log_queue_initialize(void)
+static s_log_async_slot g_log_ring[FT_LOG_ASYNC_RING_CAPACITY];
+alignas(64) static std::atomic<ft_size_t> g_log_ring_head(0);
+alignas(64) static std::atomic<ft_size_t> g_log_ring_tail(0);
+alignas(64) static std::atomic<ft_size_t> g_async_pending_messages(0);
+static std::atomic<ft_size_t> g_async_queue_limit(1024);
+static std::atomic<int32_t> g_async_overflow_policy(LOG_ASYNC_OVERFLOW_DROP_NEWEST);
+static std::atomic<ft_size_t> g_async_peak_pending(0);
+static std::atomic<ft_size_t> g_async_dropped_messages(0);
+static std::atomic<ft_size_t> g_async_dropped_oldest_messages(0);
+static std::atomic<ft_size_t> g_async_blocked_messages(0);
+static std::atomic<ft_size_t> g_async_overflow_allocations(0);
+static std::atomic<ft_size_t> g_async_worker_wakeups(0);
+static std::atomic<bool> g_async_worker_sleeping(false);
+static int32_t log_ring_initialize(void);
+static int32_t g_log_ring_initializer_result = log_ring_initialize();
+static int32_t log_ring_initialize(void)
 {
-    return (g_log_queue.initialize());
+    ft_size_t slot_index;
+
+    slot_index = 0;
+    while (slot_index < FT_LOG_ASYNC_RING_CAPACITY)
+    {
+        g_log_ring[slot_index].sequence.store(slot_index, std::memory_order_relaxed);
+        g_log_ring[slot_index].length = 0;
+        g_log_ring[slot_index].level = LOG_LEVEL_INFO;
+        g_log_ring[slot_index].overflow_text = ft_nullptr;
+        slot_index++;
+    }
+    return (FT_ERR_SUCCESS);
 }
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
@@ -33,16 +63,207 @@ static pthread_cond_t g_queue_condition = PTHREAD_COND_INITIALIZER;
 #pragma GCC diagnostic pop
 static pthread_t g_log_thread;
 
-static void ft_log_delete_message(ft_string *message) noexcept
+static ft_size_t log_ring_effective_limit(void)
+{
+    ft_size_t limit;
+
+    limit = g_async_queue_limit.load(std::memory_order_relaxed);
+    if (limit == 0 || limit > FT_LOG_ASYNC_RING_CAPACITY)
+        return (FT_LOG_ASYNC_RING_CAPACITY);
+    return (limit);
+}
+
+static s_log_async_slot *log_ring_claim_push(ft_size_t *position)
+{
+    s_log_async_slot *slot;
+    ft_size_t current;
+    ft_size_t sequence;
+
+    current = g_log_ring_head.load(std::memory_order_relaxed);
+    while (1)
+    {
+        slot = &g_log_ring[current & (FT_LOG_ASYNC_RING_CAPACITY - 1)];
+        sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == current)
+        {
+            if (g_log_ring_head.compare_exchange_weak(current, current + 1,
+                    std::memory_order_relaxed))
+            {
+                *position = current;
+                return (slot);
+            }
+        }
+        else if (sequence < current)
+            return (ft_nullptr);
+        else
+            current = g_log_ring_head.load(std::memory_order_relaxed);
+    }
+}
+
+static s_log_async_slot *log_ring_claim_pop(ft_size_t *position)
+{
+    s_log_async_slot *slot;
+    ft_size_t current;
+    ft_size_t sequence;
+
+    current = g_log_ring_tail.load(std::memory_order_relaxed);
+    while (1)
+    {
+        slot = &g_log_ring[current & (FT_LOG_ASYNC_RING_CAPACITY - 1)];
+        sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == current + 1)
+        {
+            if (g_log_ring_tail.compare_exchange_weak(current, current + 1,
+                    std::memory_order_relaxed))
+            {
+                *position = current;
+                return (slot);
+            }
+        }
+        else if (sequence < current + 1)
+            return (ft_nullptr);
+        else
+            current = g_log_ring_tail.load(std::memory_order_relaxed);
+    }
+}
+
+static void log_ring_release_slot(s_log_async_slot *slot, ft_size_t position)
+{
+    if (slot->overflow_text != ft_nullptr)
+    {
+        cma_free(slot->overflow_text);
+        slot->overflow_text = ft_nullptr;
+    }
+    slot->length = 0;
+    slot->sequence.store(position + FT_LOG_ASYNC_RING_CAPACITY,
+        std::memory_order_release);
+    g_async_pending_messages.fetch_sub(1, std::memory_order_acq_rel);
+    return ;
+}
+
+static ft_bool log_ring_drop_oldest(void)
+{
+    s_log_async_slot *slot;
+    ft_size_t position;
+
+    slot = log_ring_claim_pop(&position);
+    if (slot == ft_nullptr)
+        return (FT_FALSE);
+    log_ring_release_slot(slot, position);
+    g_async_dropped_messages.fetch_add(1, std::memory_order_relaxed);
+    g_async_dropped_oldest_messages.fetch_add(1, std::memory_order_relaxed);
+    return (FT_TRUE);
+}
+
+static void log_ring_update_peak(ft_size_t pending)
+{
+    ft_size_t peak;
+
+    peak = g_async_peak_pending.load(std::memory_order_relaxed);
+    while (pending > peak
+        && !g_async_peak_pending.compare_exchange_weak(peak, pending,
+            std::memory_order_relaxed))
+        continue ;
+    return ;
+}
+
+static void log_ring_wake_worker(void)
 {
-    if (message == ft_nullptr)
+    if (!g_async_worker_sleeping.load(std::memory_order_seq_cst))
+        return ;
+    if (!g_async_worker_sleeping.exchange(false, std::memory_order_seq_cst))
+        return ;
+    if (pthread_mutex_lock(&g_condition_mutex) != 0)
         return ;
-    (void)message->destroy();
-    delete message;
+    (void)pt_cond_signal(&g_queue_condition);
+    (void)pthread_mutex_unlock(&g_condition_mutex);
+    return ;
+}
+
+static ft_bool log_ring_reserve(void)
+{
+    ft_size_t pending;
+    ft_bool blocked;
+    int32_t policy;
+
+    blocked = FT_FALSE;
+    pending = g_async_pending_messages.load(std::memory_order_relaxed);
+    while (1)
+    {
+        if (pending < log_ring_effective_limit())
+        {
+            if (g_async_pending_messages.compare_exchange_weak(pending, pending + 1,
+                    std::memory_order_seq_cst))
+            {
+                log_ring_update_peak(pending + 1);
+                return (FT_TRUE);
+            }
+            continue ;
+        }
+        policy = g_async_overflow_policy.load(std::memory_order_relaxed);
+        if (policy == LOG_ASYNC_OVERFLOW_DROP_OLDEST)
+        {
+            if (!log_ring_drop_oldest())
+                (void)pt_thread_yield();
+        }
+        else if (policy == LOG_ASYNC_OVERFLOW_BLOCK && g_async_running)
+        {
+            if (!blocked)
+            {
+                g_async_blocked_messages.fetch_add(1, std::memory_order_relaxed);
+                blocked = FT_TRUE;
+            }
+            log_ring_wake_worker();
+            (void)pt_thread_yield();
+        }
+        else
+        {
+            g_async_dropped_messages.fetch_add(1, std::memory_order_relaxed);
+            return (FT_FALSE);
+        }
+        pending = g_async_pending_messages.load(std::memory_order_relaxed);
+    }
+}
+
+static void log_ring_publish(t_log_level level, const char *text, ft_size_t length)
+{
+    s_log_async_slot *slot;
+    ft_size_t position;
+    char *overflow_text;
+
+    overflow_text = ft_nullptr;
+    if (length >= FT_LOG_ASYNC_SLOT_SIZE)
+    {
+        overflow_text = static_cast<char *>(cma_malloc(length + 1));
+        if (overflow_text == ft_nullptr)
+        {
+            g_async_pending_messages.fetch_sub(1, std::memory_order_acq_rel);
+            g_async_dropped_messages.fetch_add(1, std::memory_order_relaxed);
+            return ;
+        }
+        ft_memcpy(overflow_text, text, length);
+        overflow_text[length] = '\0';
+        g_async_overflow_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    slot = log_ring_claim_push(&position);
+    while (slot == ft_nullptr)
+    {
+        (void)pt_thread_yield();
+        slot = log_ring_claim_push(&position);
+    }
+    if (overflow_text == ft_nullptr)
+    {
+        ft_memcpy(slot->text, text, length);
+        slot->text[length] = '\0';
+    }
+    slot->overflow_text = overflow_text;
+    slot->length = length;
+    slot->level = level;
+    slot->sequence.store(position + 1, std::memory_order_release);
     return ;
 }
 
-void ft_log_process_message(const ft_string &message)
+void ft_log_process_message(t_log_level level, const char *message, ft_size_t length)
 {
     ft_size_t sink_count;
     ft_vector<s_log_sink> sinks_snapshot;
@@ -64,14 +285,7 @@ void ft_log_process_message(const ft_string &message)
     if (sink_count == 0)
     {
         logger_unlock_sinks();
-        ssize_t write_result;
-#if defined(_WIN32) || defined(_WIN64)
-        write_result = write(1, message.c_str(),
-                static_cast<unsigned int>(message.size()));
-#else
-        write_result = write(1, message.c_str(), message.size());
-#endif
-        (void)write_result;
+        (void)logger_write_stdout(ft_nullptr, message, length);
         return ;
     }
     ft_size_t entry_index;
@@ -126,7 +340,7 @@ void ft_log_process_message(const ft_string &message)
             }
             if (sink_error == FT_ERR_SUCCESS)
             {
-                sink_error = entry.function(message.c_str(), entry.user_data);
+                sink_error = entry.function(message, entry.user_data);
                 if (sink_error != FT_ERR_SUCCESS && g_logger != ft_nullptr)
                     g_logger->set_error(sink_error);
             }
@@ -144,6 +358,8 @@ void ft_log_process_message(const ft_string &message)
                     logger_execute_rotation(file_sink);
                 }
             }
+            if (sink_error == FT_ERR_SUCCESS && level >= LOG_LEVEL_ERROR)
+                (void)logger_flush_sink_entry(&entry);
         }
         if (sink_lock_acquired)
             log_sink_unlock(&entry, sink_lock_acquired);
@@ -154,47 +370,68 @@ void ft_log_process_message(const ft_string &message)
     return ;
 }
 
+static ft_size_t log_ring_drain(void)
+{
+    s_log_async_slot *slot;
+    ft_size_t position;
+    ft_size_t processed;
+
+    processed = 0;
+    slot = log_ring_claim_pop(&position);
+    while (slot != ft_nullptr)
+    {
+        if (slot->overflow_text != ft_nullptr)
+            ft_log_process_message(slot->level, slot->overflow_text, slot->length);
+        else
+            ft_log_process_message(slot->level, slot->text, slot->length);
+        log_ring_release_slot(slot, position);
+        processed++;
+        slot = log_ring_claim_pop(&position);
+    }
+    return (processed);
+}
+
 static void *ft_log_worker(void *argument)
 {
-    ft_bool queue_is_empty;
-    ft_string *message;
-    int32_t queue_error;
+    ft_bool flush_pending;
 
     (void)argument;
-    if (pthread_mutex_lock(&g_condition_mutex) != 0)
-        return (ft_nullptr);
+    flush_pending = FT_FALSE;
     while (1)
     {
-        queue_is_empty = g_log_queue.empty();
-        if (g_log_queue.get_error() != FT_ERR_SUCCESS)
-            break ;
-        if (!g_async_running && queue_is_empty)
-            break ;
-        if (queue_is_empty)
+        if (log_ring_drain() > 0)
         {
-            if (pt_cond_wait(&g_queue_condition, &g_condition_mutex) != 0)
-                break ;
+            flush_pending = FT_TRUE;
+            continue ;
         }
-        else
+        if (flush_pending)
         {
-            message = g_log_queue.dequeue();
-            queue_error = g_log_queue.get_error();
-            if (queue_error == FT_ERR_SUCCESS)
+            (void)logger_flush_sink_batches();
+            flush_pending = FT_FALSE;
+            continue ;
+        }
+        if (pthread_mutex_lock(&g_condition_mutex) != 0)
+            return (ft_nullptr);
+        g_async_worker_sleeping.store(true, std::memory_order_seq_cst);
+        if (g_async_pending_messages.load(std::memory_order_seq_cst) == 0)
+        {
+            if (!g_async_running)
             {
-                if (g_async_pending_messages > 0)
-                    g_async_pending_messages -= 1;
+                g_async_worker_sleeping.store(false, std::memory_order_seq_cst);
+                pthread_mutex_unlock(&g_condition_mutex);
+                break ;
             }
-            pthread_mutex_unlock(&g_condition_mutex);
-            if (queue_error == FT_ERR_SUCCESS)
+            if (pt_cond_wait(&g_queue_condition, &g_condition_mutex) != 0)
             {
-                ft_log_process_message(*message);
-                ft_log_delete_message(message);
+                g_async_worker_sleeping.store(false, std::memory_order_seq_cst);
+                pthread_mutex_unlock(&g_condition_mutex);
+                break ;
             }
-            if (pthread_mutex_lock(&g_condition_mutex) != 0)
-                return (ft_nullptr);
+            g_async_worker_wakeups.fetch_add(1, std::memory_order_relaxed);
         }
+        g_async_worker_sleeping.store(false, std::memory_order_seq_cst);
+        pthread_mutex_unlock(&g_condition_mutex);
     }
-    pthread_mutex_unlock(&g_condition_mutex);
     return (ft_nullptr);
 }
 
@@ -212,9 +449,12 @@ void ft_log_enable_async(ft_bool enable)
             return ;
         }
         g_async_running = FT_TRUE;
-        g_async_pending_messages = 0;
-        g_async_peak_pending = 0;
-        g_async_dropped_messages = 0;
+        g_async_peak_pending.store(g_async_pending_messages.load());
+        g_async_dropped_messages.store(0);
+        g_async_dropped_oldest_messages.store(0);
+        g_async_blocked_messages.store(0);
+        g_async_overflow_allocations.store(0);
+        g_async_worker_wakeups.store(0);
         pthread_mutex_unlock(&g_condition_mutex);
         if (pt_thread_create(&g_log_thread, ft_nullptr, ft_log_worker, ft_nullptr) != 0)
         {
@@ -223,7 +463,6 @@ void ft_log_enable_async(ft_bool enable)
                 return ;
             }
             g_async_running = FT_FALSE;
-            g_async_pending_messages = 0;
             pthread_mutex_unlock(&g_condition_mutex);
         }
     }
@@ -240,33 +479,99 @@ void ft_log_enable_async(ft_bool enable)
             return ;
         if (pt_thread_join(g_log_thread, ft_nullptr) != 0)
             return ;
-        if (pthread_mutex_lock(&g_condition_mutex) == 0)
-        {
-            g_async_pending_messages = 0;
-            pthread_mutex_unlock(&g_condition_mutex);
-        }
+        (void)logger_flush_sink_batches();
     }
     return ;
 }
 
-void ft_log_enqueue(t_log_level level, const char *format_string, va_list argument_list)
+static thread_local char g_log_async_line[FT_LOG_ASYNC_SLOT_SIZE];
+
+static int32_t log_enqueue_render_line(t_log_level level, char *message_buffer,
+    ft_size_t message_capacity, s_log_line_buffer *line, ft_bool *message_redacted)
+{
+    const s_log_redaction_snapshot *redaction_snapshot;
+    uint32_t redaction_epoch;
+    ft_size_t message_length;
+    ft_size_t context_start;
+    ft_size_t context_length;
+    int32_t error_code;
+
+    message_length = ft_strlen_size_t(message_buffer);
+    redaction_epoch = 0;
+    redaction_snapshot = logger_redaction_read_lock(&redaction_epoch);
+    error_code = logger_apply_redactions_in_place(redaction_snapshot,
+            message_buffer, &message_length, message_capacity);
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        *message_redacted = FT_TRUE;
+        error_code = logger_build_standard_line(level, message_buffer, line);
+    }
+    context_start = line->length + 1;
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = logger_line_append(line, " ", 1);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = logger_context_format_flat_line(line);
+    if (error_code == FT_ERR_SUCCESS && line->length == context_start)
+        line->length = context_start - 1;
+    else if (error_code == FT_ERR_SUCCESS)
+    {
+        context_length = line->length - context_start;
+        error_code = logger_apply_redactions_in_place(redaction_snapshot,
+                line->data + context_start, &context_length,
+                line->capacity - context_start);
+        line->length = context_start + context_length;
+    }
+    logger_redaction_read_unlock(redaction_snapshot, redaction_epoch);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = logger_line_append(line, "\n", 1);
+    return (error_code);
+}
+
+static int32_t log_enqueue_render_string(t_log_level level, const char *message,
+    ft_bool message_redacted, ft_string &final_message)
 {
-    ft_vector<s_redaction_rule> redaction_snapshot;
+    const s_log_redaction_snapshot *redaction_snapshot;
+    uint32_t redaction_epoch;
     ft_string message_text;
     ft_string context_fragment;
+    int32_t error_code;
+
+    error_code = message_text.initialize(message);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = context_fragment.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = logger_context_format_flat(context_fragment);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    redaction_epoch = 0;
+    redaction_snapshot = logger_redaction_read_lock(&redaction_epoch);
+    if (!message_redacted)
+        error_code = logger_apply_redactions(redaction_snapshot, message_text);
+    if (error_code == FT_ERR_SUCCESS && context_fragment.size() > 0)
+        error_code = logger_apply_redactions(redaction_snapshot, context_fragment);
+    logger_redaction_read_unlock(redaction_snapshot, redaction_epoch);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = logger_build_standard_message(level, message_text,
+            context_fragment, final_message);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (final_message.get_error());
+}
+
+void ft_log_enqueue(t_log_level level, const char *format_string, va_list argument_list)
+{
+    s_log_line_buffer line;
     ft_string final_message;
-    int32_t queue_error;
-    int32_t signal_result;
-    int32_t unlock_status;
-    ft_string *queued_message;
-    int32_t format_error;
     char message_buffer[1024];
     va_list args_copy;
-    int32_t lock_error;
-    int32_t redaction_error;
-    int32_t redaction_snapshot_initialize_error;
-    int32_t context_fragment_initialize_error;
-    int32_t final_message_initialize_error;
+    int32_t formatted_length;
+    int32_t render_error;
+    ft_bool message_redacted;
+    const char *text;
+    ft_size_t text_length;
 
     if (!format_string)
     {
@@ -277,179 +582,65 @@ void ft_log_enqueue(t_log_level level, const char *format_string, va_list argume
         return ;
     }
     va_copy(args_copy, argument_list);
-    int32_t formatted_length = pf_vsnprintf(message_buffer, sizeof(message_buffer), format_string, args_copy);
+    formatted_length = pf_vsnprintf(message_buffer, sizeof(message_buffer), format_string, args_copy);
     va_end(args_copy);
-    format_error = FT_ERR_SUCCESS;
     if (formatted_length < 0)
-    {
-        if (format_error != FT_ERR_SUCCESS)
-        return ;
-    }
-    if (message_text.initialize(message_buffer) != FT_ERR_SUCCESS)
-    {
-        return ;
-    }
-    context_fragment_initialize_error = context_fragment.initialize();
-    if (context_fragment_initialize_error != FT_ERR_SUCCESS)
-        return ;
-    final_message_initialize_error = final_message.initialize();
-    if (final_message_initialize_error != FT_ERR_SUCCESS)
-        return ;
-    redaction_snapshot_initialize_error = redaction_snapshot.initialize();
-    if (redaction_snapshot_initialize_error != FT_ERR_SUCCESS)
-    {
-        return ;
-    }
-    lock_error = logger_lock_sinks();
-    if (lock_error != FT_ERR_SUCCESS)
-    {
-        return ;
-    }
-    redaction_error = logger_copy_redaction_rules(redaction_snapshot);
-    if (redaction_error != FT_ERR_SUCCESS)
-    {
-        lock_error = logger_unlock_sinks();
-        if (lock_error != FT_ERR_SUCCESS)
-        {
-            return ;
-        }
-        return ;
-    }
-    lock_error = logger_unlock_sinks();
-    if (lock_error != FT_ERR_SUCCESS)
-    {
-        return ;
-    }
-    redaction_error = logger_apply_redactions(message_text, redaction_snapshot);
-    if (redaction_error != FT_ERR_SUCCESS)
-    {
-        return ;
-    }
-    if (logger_context_format_flat(context_fragment) != 0)
-        return ;
-    if (context_fragment.get_error() != FT_ERR_SUCCESS)
-    {
-        return ;
-    }
-    if (context_fragment.size() > 0)
-    {
-        if (logger_apply_redactions(context_fragment, redaction_snapshot) != 0)
-            return ;
-    }
-    if (logger_build_standard_message(level, message_text, context_fragment, final_message) != 0)
-        return ;
-    if (final_message.get_error() != FT_ERR_SUCCESS)
-    {
         return ;
-    }
-    (void)sink_record_message(static_cast<int32_t>(level), final_message.c_str());
-    if (pthread_mutex_lock(&g_condition_mutex) != 0)
-    {
-        return ;
-    }
-    if (g_async_queue_limit > 0 && g_async_pending_messages >= g_async_queue_limit)
-    {
-        g_async_dropped_messages += 1;
-        if (pthread_mutex_unlock(&g_condition_mutex) != 0)
-        {
+    line.data = g_log_async_line;
+    line.capacity = sizeof(g_log_async_line);
+    line.length = 0;
+    message_redacted = FT_FALSE;
+    render_error = log_enqueue_render_line(level, message_buffer,
+            sizeof(message_buffer), &line, &message_redacted);
+    text = line.data;
+    text_length = line.length;
+    if (render_error == FT_ERR_OUT_OF_RANGE)
+    {
+        if (final_message.initialize() != FT_ERR_SUCCESS)
             return ;
-        }
-        return ;
+        render_error = log_enqueue_render_string(level, message_buffer,
+                message_redacted, final_message);
+        text = final_message.c_str();
+        text_length = final_message.size();
     }
-    queued_message = new (std::nothrow) ft_string();
-    if (queued_message == ft_nullptr)
-    {
-        (void)pthread_mutex_unlock(&g_condition_mutex);
+    if (render_error != FT_ERR_SUCCESS)
         return ;
-    }
-    if (queued_message->initialize(final_message) != FT_ERR_SUCCESS)
-    {
-        ft_log_delete_message(queued_message);
-        (void)pthread_mutex_unlock(&g_condition_mutex);
-        return ;
-    }
-    g_log_queue.enqueue(queued_message);
-    queue_error = g_log_queue.get_error();
-    if (queue_error != FT_ERR_SUCCESS)
-        ft_log_delete_message(queued_message);
-    if (queue_error == FT_ERR_SUCCESS)
-    {
-        g_async_pending_messages += 1;
-        if (g_async_pending_messages > g_async_peak_pending)
-            g_async_peak_pending = g_async_pending_messages;
-    }
-    signal_result = 0;
-    if (queue_error == FT_ERR_SUCCESS)
-        signal_result = pt_cond_signal(&g_queue_condition);
-    unlock_status = pthread_mutex_unlock(&g_condition_mutex);
-    if (unlock_status != 0)
-    {
-        return ;
-    }
-    if (queue_error != FT_ERR_SUCCESS)
-    {
-        return ;
-    }
-    if (signal_result != 0)
+    (void)sink_record_message(static_cast<int32_t>(level), text);
+    if (!log_ring_reserve())
         return ;
+    log_ring_publish(level, text, text_length);
+    log_ring_wake_worker();
     return ;
 }
 
 void ft_log_set_async_queue_limit(ft_size_t limit)
 {
-    if (pthread_mutex_lock(&g_condition_mutex) != 0)
-    {
-        return ;
-    }
-    g_async_queue_limit = limit;
-    if (g_async_queue_limit > 0)
-    {
-        ft_bool needs_trim;
-
-        needs_trim = g_async_pending_messages > g_async_queue_limit;
-        while (needs_trim)
-        {
-            ft_string *dropped_message;
-            int32_t drop_error;
-
-            dropped_message = g_log_queue.dequeue();
-            drop_error = g_log_queue.get_error();
-            if (drop_error != FT_ERR_SUCCESS)
-            {
-                if (pthread_mutex_unlock(&g_condition_mutex) != 0)
-                {
-                    return ;
-                }
-                return ;
-            }
-            ft_log_delete_message(dropped_message);
-            if (g_async_pending_messages > 0)
-                g_async_pending_messages -= 1;
-            g_async_dropped_messages += 1;
-            needs_trim = g_async_pending_messages > g_async_queue_limit;
-        }
-    }
-    if (pthread_mutex_unlock(&g_condition_mutex) != 0)
+    g_async_queue_limit.store(limit, std::memory_order_relaxed);
+    while (g_async_pending_messages.load(std::memory_order_acquire)
+        > log_ring_effective_limit())
     {
-        return ;
+        if (!log_ring_drop_oldest())
+            return ;
     }
     return ;
 }
 
 ft_size_t ft_log_get_async_queue_limit()
 {
-    ft_size_t limit;
+    return (g_async_queue_limit.load(std::memory_order_relaxed));
+}
 
-    if (pthread_mutex_lock(&g_condition_mutex) != 0)
-    {
-        return (FT_ERR_SUCCESS);
-    }
-    limit = g_async_queue_limit;
-    if (pthread_mutex_unlock(&g_condition_mutex) != 0)
-    {
-        return (FT_ERR_SUCCESS);
-    }
-    return (limit);
+void ft_log_set_async_overflow_policy(t_log_async_overflow_policy policy)
+{
+    g_async_overflow_policy.store(static_cast<int32_t>(policy),
+        std::memory_order_relaxed);
+    return ;
+}
+
+t_log_async_overflow_policy ft_log_get_async_overflow_policy()
+{
+    return (static_cast<t_log_async_overflow_policy>(
+        g_async_overflow_policy.load(std::memory_order_relaxed)));
 }
 
 int32_t ft_log_get_async_metrics(s_log_async_metrics *metrics)
@@ -465,42 +656,41 @@ int32_t ft_log_get_async_metrics(s_log_async_metrics *metrics)
     {
         return (FT_ERR_INTERNAL);
     }
-    if (pthread_mutex_lock(&g_condition_mutex) != 0)
-    {
-        log_async_metrics_unlock(metrics, metrics_lock_acquired);
-        return (FT_ERR_INTERNAL);
-    }
-    metrics->pending_messages = g_async_pending_messages;
-    metrics->peak_pending_messages = g_async_peak_pending;
-    metrics->dropped_messages = g_async_dropped_messages;
-    if (pthread_mutex_unlock(&g_condition_mutex) != 0)
-    {
-        log_async_metrics_unlock(metrics, metrics_lock_acquired);
-        return (FT_ERR_INTERNAL);
-    }
+    metrics->pending_messages = g_async_pending_messages.load();
+    metrics->peak_pending_messages = g_async_peak_pending.load();
+    metrics->dropped_messages = g_async_dropped_messages.load();
+    metrics->dropped_oldest_messages = g_async_dropped_oldest_messages.load();
+    metrics->blocked_messages = g_async_blocked_messages.load();
+    metrics->overflow_allocations = g_async_overflow_allocations.load();
+    metrics->worker_wakeups = g_async_worker_wakeups.load();
     log_async_metrics_unlock(metrics, metrics_lock_acquired);
     return (FT_ERR_SUCCESS);
 }
 
 void ft_log_reset_async_metrics()
 {
-    if (pthread_mutex_lock(&g_condition_mutex) != 0)
-    {
-        return ;
-    }
-    g_async_peak_pending = g_async_pending_messages;
-    g_async_dropped_messages = 0;
-    if (pthread_mutex_unlock(&g_condition_mutex) != 0)
-    {
-        return ;
-    }
+    g_async_peak_pending.store(g_async_pending_messages.load());
+    g_async_dropped_messages.store(0);
+    g_async_dropped_oldest_messages.store(0);
+    g_async_blocked_messages.store(0);
+    g_async_overflow_allocations.store(0);
+    g_async_worker_wakeups.store(0);
     return ;
 }
 
 #ifdef LIBFT_TEST_BUILD
 void ft_log_destroy_async_runtime_for_tests(void)
 {
-    (void)g_log_queue.destroy();
+    s_log_async_slot *slot;
+    ft_size_t position;
+
+    slot = log_ring_claim_pop(&position);
+    while (slot != ft_nullptr)
+    {
+        log_ring_release_slot(slot, position);
+        slot = log_ring_claim_pop(&position);
+    }
+    logger_binary_release_retired_buffers();
     return ;
 }
 #endif
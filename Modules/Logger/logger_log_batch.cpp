@@ -0,0 +1,395 @@
+#include "logger_internal.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/basic.hpp"
+#include "../Time/time.hpp"
+#include "../System_utils/system_utils.hpp"
+#include "../Networking/networking.hpp"
+#include <atomic>
+#if !defined(_WIN32) && !defined(_WIN64)
+# include <sys/socket.h>
+# include <sys/uio.h>
+#endif
+#include "../Basic/limits.hpp"
+#include "../PThread/mutex.hpp"
+#include "../PThread/recursive_mutex.hpp"
+#include "../Template/vector.hpp"
+#include "../Errno/errno.hpp"
+
+typedef int64_t (*t_log_vector_writer)(void *target,
+        const s_log_write_vector *vectors, int32_t vector_count);
+
+static std::atomic<ft_size_t> g_log_batch_max_bytes(0);
+static std::atomic<uint32_t> g_log_batch_max_delay_ms(0);
+static std::atomic<ft_size_t> g_log_write_records(0);
+static std::atomic<ft_size_t> g_log_write_syscalls(0);
+
+s_log_batch::~s_log_batch()
+{
+    if (this->data != ft_nullptr)
+        cma_free(this->data);
+    this->data = ft_nullptr;
+    this->size = 0;
+    this->capacity = 0;
+    return ;
+}
+
+static int64_t logger_descriptor_vector_writer(void *target,
+        const s_log_write_vector *vectors, int32_t vector_count)
+{
+    int32_t file_descriptor;
+
+    file_descriptor = *static_cast<int32_t *>(target);
+#if !defined(_WIN32) && !defined(_WIN64)
+    if (vector_count > 1)
+    {
+        struct iovec io_vectors[FT_LOG_BATCH_MAX_VECTORS];
+        int32_t vector_index;
+
+        vector_index = 0;
+        while (vector_index < vector_count)
+        {
+            io_vectors[vector_index].iov_base = const_cast<char *>(vectors[vector_index].data);
+            io_vectors[vector_index].iov_len = vectors[vector_index].length;
+            vector_index++;
+        }
+        return (writev(file_descriptor, io_vectors, vector_count));
+    }
+#else
+    (void)vector_count;
+#endif
+    return (su_write(file_descriptor, vectors[0].data, vectors[0].length));
+}
+
+static int64_t logger_network_vector_writer(void *target,
+        const s_log_write_vector *vectors, int32_t vector_count)
+{
+    s_network_sink *sink;
+
+    sink = static_cast<s_network_sink *>(target);
+#if !defined(_WIN32) && !defined(_WIN64)
+    if (vector_count > 1 && sink->send_function == nw_send)
+    {
+        struct iovec io_vectors[FT_LOG_BATCH_MAX_VECTORS];
+        struct msghdr message_header;
+        int32_t vector_index;
+
+        vector_index = 0;
+        while (vector_index < vector_count)
+        {
+            io_vectors[vector_index].iov_base = const_cast<char *>(vectors[vector_index].data);
+            io_vectors[vector_index].iov_len = vectors[vector_index].length;
+            vector_index++;
+        }
+        ft_memset(&message_header, 0, sizeof(message_header));
+        message_header.msg_iov = io_vectors;
+        message_header.msg_iovlen = static_cast<size_t>(vector_count);
+        return (sendmsg(sink->socket_fd, &message_header, 0));
+    }
+#else
+    (void)vector_count;
+#endif
+    return (sink->send_function(sink->socket_fd, vectors[0].data, vectors[0].length, 0));
+}
+
+static int32_t logger_write_vectors(void *target, t_log_vector_writer writer,
+        s_log_write_vector *vectors, int32_t vector_count, int32_t failure_code)
+{
+    int64_t write_result;
+    ft_size_t remaining;
+
+    while (vector_count > 0 && vectors[0].length == 0)
+    {
+        vectors++;
+        vector_count--;
+    }
+    while (vector_count > 0)
+    {
+        write_result = writer(target, vectors, vector_count);
+        g_log_write_syscalls.fetch_add(1, std::memory_order_relaxed);
+        if (write_result <= 0)
+            return (failure_code);
+        remaining = static_cast<ft_size_t>(write_result);
+        while (vector_count > 0 && remaining >= vectors[0].length)
+        {
+            remaining -= vectors[0].length;
+            vectors++;
+            vector_count--;
+        }
+        if (vector_count > 0)
+        {
+            vectors[0].data += remaining;
+            vectors[0].length -= remaining;
+        }
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+static ft_bool logger_batch_reserve(s_log_batch *batch, ft_size_t capacity)
+{
+    char *resized_data;
+
+    if (batch->capacity >= capacity)
+        return (FT_TRUE);
+    resized_data = static_cast<char *>(cma_realloc(batch->data, capacity));
+    if (resized_data == ft_nullptr)
+        return (FT_FALSE);
+    batch->data = resized_data;
+    batch->capacity = capacity;
+    return (FT_TRUE);
+}
+
+static int32_t logger_batch_submit(s_log_batch *batch, void *target,
+        t_log_vector_writer writer, const char *message, ft_size_t length,
+        int32_t failure_code)
+{
+    s_log_write_vector vectors[2];
+    ft_size_t max_bytes;
+    uint32_t max_delay_ms;
+    int64_t now_ms;
+
+    g_log_write_records.fetch_add(1, std::memory_order_relaxed);
+    max_bytes = g_log_batch_max_bytes.load(std::memory_order_relaxed);
+    if (max_bytes > 0)
+    {
+        max_delay_ms = g_log_batch_max_delay_ms.load(std::memory_order_relaxed);
+        now_ms = time_now_ms();
+        if (batch->size == 0)
+            batch->first_record_ms = now_ms;
+        if (batch->size + length <= max_bytes
+            && (max_delay_ms == 0 || now_ms - batch->first_record_ms < max_delay_ms)
+            && logger_batch_reserve(batch, max_bytes))
+        {
+            ft_memcpy(batch->data + batch->size, message, length);
+            batch->size += length;
+            batch->record_count++;
+            return (FT_ERR_SUCCESS);
+        }
+    }
+    vectors[0].data = batch->data;
+    vectors[0].length = batch->size;
+    vectors[1].data = message;
+    vectors[1].length = length;
+    batch->size = 0;
+    batch->record_count = 0;
+    return (logger_write_vectors(target, writer, vectors, 2, failure_code));
+}
+
+static int32_t logger_batch_flush(s_log_batch *batch, void *target,
+        t_log_vector_writer writer, int32_t failure_code)
+{
+    s_log_write_vector vector;
+
+    if (batch->size == 0)
+        return (FT_ERR_SUCCESS);
+    vector.data = batch->data;
+    vector.length = batch->size;
+    batch->size = 0;
+    batch->record_count = 0;
+    return (logger_write_vectors(target, writer, &vector, 1, failure_code));
+}
+
+int32_t logger_file_sink_write_locked(s_file_sink *sink, const char *message,
+        ft_size_t length)
+{
+    return (logger_batch_submit(&sink->batch, &sink->file_descriptor,
+            logger_descriptor_vector_writer, message, length, FT_ERR_IO));
+}
+
+int32_t logger_file_sink_flush_locked(s_file_sink *sink)
+{
+    if (sink->file_descriptor < 0)
+    {
+        sink->batch.size = 0;
+        sink->batch.record_count = 0;
+        return (FT_ERR_SUCCESS);
+    }
+    return (logger_batch_flush(&sink->batch, &sink->file_descriptor,
+            logger_descriptor_vector_writer, FT_ERR_IO));
+}
+
+static void logger_network_sink_disconnect(s_network_sink *sink)
+{
+    if (sink->socket_fd >= 0)
+        su_close(sink->socket_fd);
+    sink->socket_fd = -1;
+    sink->send_function = ft_nullptr;
+    sink->batch.size = 0;
+    sink->batch.record_count = 0;
+    return ;
+}
+
+int32_t logger_network_sink_write_locked(s_network_sink *sink, const char *message,
+        ft_size_t length)
+{
+    s_log_write_vector vector;
+    int32_t write_error;
+
+    if (sink->use_tcp)
+        write_error = logger_batch_submit(&sink->batch, sink,
+                logger_network_vector_writer, message, length,
+                FT_ERR_SOCKET_SEND_FAILED);
+    else
+    {
+        g_log_write_records.fetch_add(1, std::memory_order_relaxed);
+        vector.data = message;
+        vector.length = length;
+        write_error = logger_write_vectors(sink, logger_network_vector_writer,
+                &vector, 1, FT_ERR_SOCKET_SEND_FAILED);
+    }
+    if (write_error != FT_ERR_SUCCESS)
+        logger_network_sink_disconnect(sink);
+    return (write_error);
+}
+
+int32_t logger_network_sink_flush_locked(s_network_sink *sink)
+{
+    int32_t flush_error;
+
+    if (sink->socket_fd < 0 || sink->send_function == ft_nullptr)
+    {
+        sink->batch.size = 0;
+        sink->batch.record_count = 0;
+        return (FT_ERR_SUCCESS);
+    }
+    flush_error = logger_batch_flush(&sink->batch, sink, logger_network_vector_writer,
+            FT_ERR_SOCKET_SEND_FAILED);
+    if (flush_error != FT_ERR_SUCCESS)
+        logger_network_sink_disconnect(sink);
+    return (flush_error);
+}
+
+int32_t logger_flush_sink_entry(const s_log_sink *entry)
+{
+    ft_bool lock_acquired;
+    int32_t flush_error;
+
+    if (entry == ft_nullptr || entry->user_data == ft_nullptr)
+        return (FT_ERR_SUCCESS);
+    lock_acquired = FT_FALSE;
+    if (entry->function == ft_file_sink)
+    {
+        s_file_sink *file_sink;
+
+        file_sink = static_cast<s_file_sink *>(entry->user_data);
+        if (file_sink_lock(file_sink, &lock_acquired) != FT_ERR_SUCCESS)
+            return (FT_ERR_INTERNAL);
+        flush_error = logger_file_sink_flush_locked(file_sink);
+        if (lock_acquired)
+            file_sink_unlock(file_sink, lock_acquired);
+        return (flush_error);
+    }
+    if (entry->function == ft_network_sink)
+    {
+        s_network_sink *network_sink;
+
+        network_sink = static_cast<s_network_sink *>(entry->user_data);
+        if (network_sink_lock(network_sink, &lock_acquired) != FT_ERR_SUCCESS)
+            return (FT_ERR_INTERNAL);
+        flush_error = logger_network_sink_flush_locked(network_sink);
+        if (lock_acquired)
+            network_sink_unlock(network_sink, lock_acquired);
+        return (flush_error);
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t logger_flush_sink_batches()
+{
+    ft_vector<s_log_sink> sinks_snapshot;
+    ft_size_t sink_count;
+    ft_size_t entry_index;
+    int32_t flush_error;
+    int32_t first_error;
+
+    if (sinks_snapshot.initialize() != FT_ERR_SUCCESS)
+        return (FT_ERR_NO_MEMORY);
+    if (logger_lock_sinks() != FT_ERR_SUCCESS)
+        return (FT_ERR_SYS_MUTEX_LOCK_FAILED);
+    sink_count = g_sinks.size();
+    entry_index = 0;
+    while (entry_index < sink_count)
+    {
+        sinks_snapshot.push_back(g_sinks[entry_index]);
+        if (sinks_snapshot.get_error() != FT_ERR_SUCCESS)
+        {
+            (void)logger_unlock_sinks();
+            return (FT_ERR_NO_MEMORY);
+        }
+        entry_index++;
+    }
+    (void)logger_unlock_sinks();
+    first_error = FT_ERR_SUCCESS;
+    entry_index = 0;
+    while (entry_index < sink_count)
+    {
+        flush_error = logger_flush_sink_entry(&sinks_snapshot[entry_index]);
+        if (flush_error != FT_ERR_SUCCESS && first_error == FT_ERR_SUCCESS)
+            first_error = flush_error;
+        entry_index++;
+    }
+    return (first_error);
+}
+
+int32_t logger_write_stdout(const char *color_code, const char *message,
+        ft_size_t length)
+{
+    s_log_write_vector vectors[3];
+    int32_t file_descriptor;
+
+    g_log_write_records.fetch_add(1, std::memory_order_relaxed);
+    file_descriptor = 1;
+    if (color_code == ft_nullptr)
+    {
+        vectors[0].data = message;
+        vectors[0].length = length;
+        return (logger_write_vectors(&file_descriptor, logger_descriptor_vector_writer,
+                vectors, 1, FT_ERR_IO));
+    }
+    vectors[0].data = color_code;
+    vectors[0].length = ft_strlen_size_t(color_code);
+    vectors[1].data = message;
+    vectors[1].length = length;
+    vectors[2].data = "\x1b[0m";
+    vectors[2].length = 4;
+    return (logger_write_vectors(&file_descriptor, logger_descriptor_vector_writer,
+            vectors, 3, FT_ERR_IO));
+}
+
+void ft_log_set_batching(ft_size_t max_bytes, uint32_t max_delay_ms)
+{
+    g_log_batch_max_delay_ms.store(max_delay_ms, std::memory_order_relaxed);
+    g_log_batch_max_bytes.store(max_bytes, std::memory_order_relaxed);
+    if (max_bytes == 0)
+        (void)logger_flush_sink_batches();
+    return ;
+}
+
+void ft_log_get_batching(ft_size_t *max_bytes, uint32_t *max_delay_ms)
+{
+    if (max_bytes != ft_nullptr)
+        *max_bytes = g_log_batch_max_bytes.load(std::memory_order_relaxed);
+    if (max_delay_ms != ft_nullptr)
+        *max_delay_ms = g_log_batch_max_delay_ms.load(std::memory_order_relaxed);
+    return ;
+}
+
+int32_t ft_log_flush()
+{
+    return (logger_flush_sink_batches());
+}
+
+int32_t ft_log_get_write_statistics(ft_size_t *record_count, ft_size_t *syscall_count)
+{
+    if (record_count == ft_nullptr || syscall_count == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    *record_count = g_log_write_records.load(std::memory_order_relaxed);
+    *syscall_count = g_log_write_syscalls.load(std::memory_order_relaxed);
+    return (FT_ERR_SUCCESS);
+}
+
+void ft_log_reset_write_statistics()
+{
+    g_log_write_records.store(0, std::memory_order_relaxed);
+    g_log_write_syscalls.store(0, std::memory_order_relaxed);
+    return ;
+}
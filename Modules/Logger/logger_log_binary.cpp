@@ -0,0 +1,821 @@
+#include "logger_internal.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/basic.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Sink/sink.hpp"
+#include "../PThread/pthread.hpp"
+#include "../Printf/printf.hpp"
+#include "../Time/time.hpp"
+#include "../Template/unordered_map.hpp"
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <sys/types.h>
+#include "../Basic/limits.hpp"
+#include "../PThread/mutex.hpp"
+#include "../PThread/recursive_mutex.hpp"
+#include "../Template/vector.hpp"
+#include "../Errno/errno.hpp"
+
+struct s_log_binary_buffer
+{
+    alignas(64) std::atomic<ft_size_t> write_position;
+    std::atomic<ft_size_t> dropped_records;
+    alignas(64) std::atomic<ft_size_t> read_position;
+    std::atomic<bool> retired;
+    s_log_binary_buffer *next;
+    alignas(8) unsigned char data[FT_LOG_BINARY_BUFFER_SIZE];
+};
+
+struct s_log_binary_thread_handle
+{
+    s_log_binary_buffer *buffer;
+
+    s_log_binary_thread_handle() noexcept
+        : buffer(ft_nullptr)
+    {
+        return ;
+    }
+
+    ~s_log_binary_thread_handle()
+    {
+        if (this->buffer != ft_nullptr)
+            this->buffer->retired.store(true, std::memory_order_release);
+        return ;
+    }
+};
+
+ft_bool g_binary_running = FT_FALSE;
+static std::atomic<s_log_binary_buffer *> g_log_binary_buffers(ft_nullptr);
+static thread_local s_log_binary_thread_handle g_log_binary_thread_handle;
+static thread_local unsigned char g_log_binary_scratch[FT_LOG_BINARY_MAX_PAYLOAD];
+static std::atomic<bool> g_log_binary_stop(false);
+static std::atomic<ft_size_t> g_log_binary_records(0);
+static ft_size_t g_log_binary_retired_dropped = 0;
+static int64_t g_log_binary_monotonic_base = 0;
+static int64_t g_log_binary_wall_base = 0;
+static t_log_binary_sink g_log_binary_sink = ft_nullptr;
+static void *g_log_binary_sink_user_data = ft_nullptr;
+static ft_unordered_map<uint64_t, uint32_t> g_log_binary_format_ids;
+static char **g_log_binary_format_texts = ft_nullptr;
+static ft_size_t g_log_binary_format_capacity = 0;
+static uint32_t g_log_binary_next_format_id = 0;
+static unsigned char *g_log_binary_stream = ft_nullptr;
+static ft_size_t g_log_binary_stream_size = 0;
+static ft_size_t g_log_binary_stream_capacity = 0;
+static int32_t log_binary_format_ids_initialize(void);
+static int32_t g_log_binary_format_ids_initializer_result = log_binary_format_ids_initialize();
+static int32_t log_binary_format_ids_initialize(void)
+{
+    return (g_log_binary_format_ids.initialize());
+}
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
+static pthread_mutex_t g_log_binary_mutex = PTHREAD_MUTEX_INITIALIZER;
+#pragma GCC diagnostic pop
+static pthread_t g_log_binary_thread;
+
+static s_log_binary_buffer *logger_binary_thread_buffer(void)
+{
+    s_log_binary_buffer *buffer;
+    s_log_binary_buffer *head;
+
+    buffer = g_log_binary_thread_handle.buffer;
+    if (buffer != ft_nullptr)
+        return (buffer);
+    buffer = new (std::nothrow) s_log_binary_buffer;
+    if (buffer == ft_nullptr)
+        return (ft_nullptr);
+    buffer->write_position.store(0, std::memory_order_relaxed);
+    buffer->dropped_records.store(0, std::memory_order_relaxed);
+    buffer->read_position.store(0, std::memory_order_relaxed);
+    buffer->retired.store(false, std::memory_order_relaxed);
+    head = g_log_binary_buffers.load(std::memory_order_relaxed);
+    do
+    {
+        buffer->next = head;
+    }
+    while (!g_log_binary_buffers.compare_exchange_weak(head, buffer,
+            std::memory_order_release, std::memory_order_relaxed));
+    g_log_binary_thread_handle.buffer = buffer;
+    return (buffer);
+}
+
+static ft_bool logger_binary_put(unsigned char *payload, ft_size_t *offset,
+        uint8_t argument_class, const void *value, ft_size_t value_size)
+{
+    if (*offset + 1 + value_size > FT_LOG_BINARY_MAX_PAYLOAD)
+        return (FT_FALSE);
+    payload[*offset] = argument_class;
+    ft_memcpy(payload + *offset + 1, value, value_size);
+    *offset += 1 + value_size;
+    return (FT_TRUE);
+}
+
+static int64_t logger_binary_read_signed(const s_log_binary_spec *spec,
+        va_list *argument_list)
+{
+    int64_t value;
+    char modifier;
+
+    modifier = spec->length_modifier[0];
+    if (modifier == 'l' && spec->length_modifier[1] == 'l')
+        value = va_arg(*argument_list, long long);
+    else if (modifier == 'l')
+        value = va_arg(*argument_list, long);
+    else if (modifier == 'j')
+        value = va_arg(*argument_list, intmax_t);
+    else if (modifier == 'z')
+        value = va_arg(*argument_list, ssize_t);
+    else if (modifier == 't')
+        value = va_arg(*argument_list, ptrdiff_t);
+    else if (modifier == 'h' && spec->length_modifier[1] == 'h')
+        value = static_cast<signed char>(va_arg(*argument_list, int));
+    else if (modifier == 'h')
+        value = static_cast<short>(va_arg(*argument_list, int));
+    else
+        value = va_arg(*argument_list, int);
+    return (value);
+}
+
+static uint64_t logger_binary_read_unsigned(const s_log_binary_spec *spec,
+        va_list *argument_list)
+{
+    uint64_t value;
+    char modifier;
+
+    modifier = spec->length_modifier[0];
+    if (modifier == 'l' && spec->length_modifier[1] == 'l')
+        value = va_arg(*argument_list, unsigned long long);
+    else if (modifier == 'l')
+        value = va_arg(*argument_list, unsigned long);
+    else if (modifier == 'j')
+        value = va_arg(*argument_list, uintmax_t);
+    else if (modifier == 'z')
+        value = va_arg(*argument_list, size_t);
+    else if (modifier == 't')
+        value = static_cast<uint64_t>(va_arg(*argument_list, ptrdiff_t));
+    else if (modifier == 'h' && spec->length_modifier[1] == 'h')
+        value = static_cast<unsigned char>(va_arg(*argument_list, unsigned int));
+    else if (modifier == 'h')
+        value = static_cast<unsigned short>(va_arg(*argument_list, unsigned int));
+    else
+        value = va_arg(*argument_list, unsigned int);
+    return (value);
+}
+
+static ft_size_t logger_binary_string_limit(const char *format,
+        const s_log_binary_spec *spec)
+{
+    ft_size_t index;
+    ft_size_t precision;
+
+    index = spec->start + 1;
+    while (index < spec->body_end && format[index] != '.')
+        index++;
+    if (index >= spec->body_end)
+        return (FT_LOG_BINARY_STRING_LIMIT);
+    index++;
+    precision = 0;
+    while (index < spec->body_end && precision < FT_LOG_BINARY_STRING_LIMIT)
+    {
+        precision = precision * 10 + static_cast<ft_size_t>(format[index] - '0');
+        index++;
+    }
+    if (precision > FT_LOG_BINARY_STRING_LIMIT)
+        return (FT_LOG_BINARY_STRING_LIMIT);
+    return (precision);
+}
+
+static ft_bool logger_binary_put_string(unsigned char *payload, ft_size_t *offset,
+        const char *string, ft_size_t limit)
+{
+    uint32_t string_length;
+    ft_size_t length;
+
+    if (string == ft_nullptr)
+    {
+        string_length = LOG_BINARY_NULL_STRING;
+        return (logger_binary_put(payload, offset, LOG_BINARY_ARGUMENT_STRING,
+                &string_length, sizeof(string_length)));
+    }
+    length = 0;
+    while (length < limit && string[length] != '\0')
+        length++;
+    string_length = static_cast<uint32_t>(length);
+    if (!logger_binary_put(payload, offset, LOG_BINARY_ARGUMENT_STRING,
+            &string_length, sizeof(string_length)))
+        return (FT_FALSE);
+    if (*offset + length > FT_LOG_BINARY_MAX_PAYLOAD)
+        return (FT_FALSE);
+    ft_memcpy(payload + *offset, string, length);
+    *offset += length;
+    return (FT_TRUE);
+}
+
+static int32_t logger_binary_pack_arguments(const char *format,
+        va_list *argument_list, unsigned char *payload, ft_size_t *payload_size)
+{
+    s_log_binary_spec spec;
+    ft_size_t index;
+    ft_size_t offset;
+    ft_bool stored;
+    int32_t parse_error;
+    int64_t signed_value;
+    uint64_t unsigned_value;
+    double double_value;
+    long double long_double_value;
+
+    index = 0;
+    offset = *payload_size;
+    while (format[index] != '\0')
+    {
+        if (format[index] != '%')
+        {
+            index++;
+            continue ;
+        }
+        parse_error = logger_binary_parse_spec(format, index, &spec);
+        if (parse_error != FT_ERR_SUCCESS)
+            return (parse_error);
+        stored = FT_TRUE;
+        if (spec.argument_class == LOG_BINARY_ARGUMENT_SIGNED)
+        {
+            signed_value = logger_binary_read_signed(&spec, argument_list);
+            stored = logger_binary_put(payload, &offset, spec.argument_class,
+                    &signed_value, sizeof(signed_value));
+        }
+        else if (spec.argument_class == LOG_BINARY_ARGUMENT_CHAR)
+        {
+            signed_value = va_arg(*argument_list, int);
+            stored = logger_binary_put(payload, &offset, spec.argument_class,
+                    &signed_value, sizeof(signed_value));
+        }
+        else if (spec.argument_class == LOG_BINARY_ARGUMENT_UNSIGNED)
+        {
+            unsigned_value = logger_binary_read_unsigned(&spec, argument_list);
+            stored = logger_binary_put(payload, &offset, spec.argument_class,
+                    &unsigned_value, sizeof(unsigned_value));
+        }
+        else if (spec.argument_class == LOG_BINARY_ARGUMENT_POINTER)
+        {
+            unsigned_value = reinterpret_cast<uintptr_t>(va_arg(*argument_list, void *));
+            stored = logger_binary_put(payload, &offset, spec.argument_class,
+                    &unsigned_value, sizeof(unsigned_value));
+        }
+        else if (spec.argument_class == LOG_BINARY_ARGUMENT_DOUBLE)
+        {
+            double_value = va_arg(*argument_list, double);
+            stored = logger_binary_put(payload, &offset, spec.argument_class,
+                    &double_value, sizeof(double_value));
+        }
+        else if (spec.argument_class == LOG_BINARY_ARGUMENT_LONG_DOUBLE)
+        {
+            long_double_value = va_arg(*argument_list, long double);
+            stored = logger_binary_put(payload, &offset, spec.argument_class,
+                    &long_double_value, sizeof(long_double_value));
+        }
+        else if (spec.argument_class == LOG_BINARY_ARGUMENT_STRING)
+            stored = logger_binary_put_string(payload, &offset,
+                    va_arg(*argument_list, const char *),
+                    logger_binary_string_limit(format, &spec));
+        if (!stored)
+            return (FT_ERR_FULL);
+        index = spec.end;
+    }
+    *payload_size = offset;
+    return (FT_ERR_SUCCESS);
+}
+
+static ft_bool logger_binary_buffer_write(s_log_binary_buffer *buffer,
+        const s_log_binary_record *header, const unsigned char *payload)
+{
+    s_log_binary_record wrap_marker;
+    ft_size_t write_position;
+    ft_size_t read_position;
+    ft_size_t offset;
+    ft_size_t contiguous;
+    ft_size_t needed;
+
+    write_position = buffer->write_position.load(std::memory_order_relaxed);
+    read_position = buffer->read_position.load(std::memory_order_acquire);
+    offset = write_position % FT_LOG_BINARY_BUFFER_SIZE;
+    contiguous = FT_LOG_BINARY_BUFFER_SIZE - offset;
+    needed = header->size;
+    if (contiguous < header->size)
+        needed += contiguous;
+    if (write_position + needed - read_position > FT_LOG_BINARY_BUFFER_SIZE)
+        return (FT_FALSE);
+    if (contiguous < header->size)
+    {
+        wrap_marker.size = static_cast<uint32_t>(contiguous);
+        wrap_marker.flags = LOG_BINARY_FLAG_WRAP;
+        wrap_marker.level = 0;
+        wrap_marker.format_size = 0;
+        ft_memcpy(buffer->data + offset, &wrap_marker, 8);
+        offset = 0;
+    }
+    ft_memcpy(buffer->data + offset, header, sizeof(*header));
+    ft_memcpy(buffer->data + offset + sizeof(*header), payload,
+        static_cast<ft_size_t>(header->format_size) + header->arguments_size
+        + header->context_size);
+    buffer->write_position.store(write_position + needed, std::memory_order_release);
+    return (FT_TRUE);
+}
+
+void ft_log_enqueue_binary(t_log_level level, const char *format_string,
+        va_list argument_list)
+{
+    s_log_binary_buffer *buffer;
+    s_log_binary_record header;
+    ft_size_t payload_size;
+    ft_size_t format_size;
+    ft_size_t record_size;
+    int64_t timestamp;
+    int32_t formatted_length;
+    int32_t pack_error;
+    va_list args_copy;
+
+    if (!format_string || level < g_level)
+        return ;
+    buffer = logger_binary_thread_buffer();
+    if (buffer == ft_nullptr)
+        return ;
+    timestamp = 0;
+    (void)cmp_high_resolution_time(&timestamp);
+    header.flags = 0;
+    header.level = static_cast<uint8_t>(level);
+    header.context_size = 0;
+    header.timestamp = timestamp;
+    format_size = ft_strlen_size_t(format_string) + 1;
+    payload_size = 0;
+    pack_error = FT_ERR_OUT_OF_RANGE;
+    va_copy(args_copy, argument_list);
+    if (format_size <= FT_LOG_BINARY_STRING_LIMIT)
+    {
+        ft_memcpy(g_log_binary_scratch, format_string, format_size);
+        payload_size = format_size;
+        pack_error = logger_binary_pack_arguments(format_string, &args_copy,
+                g_log_binary_scratch, &payload_size);
+    }
+    if (pack_error != FT_ERR_SUCCESS)
+    {
+        formatted_length = pf_vsnprintf(reinterpret_cast<char *>(g_log_binary_scratch),
+                FT_LOG_BINARY_STRING_LIMIT, format_string, argument_list);
+        if (formatted_length < 0)
+        {
+            va_end(args_copy);
+            return ;
+        }
+        payload_size = static_cast<ft_size_t>(formatted_length);
+        if (payload_size >= FT_LOG_BINARY_STRING_LIMIT)
+            payload_size = FT_LOG_BINARY_STRING_LIMIT - 1;
+        header.flags = LOG_BINARY_FLAG_PREFORMATTED;
+        format_size = 0;
+    }
+    va_end(args_copy);
+    header.format_size = static_cast<uint16_t>(format_size);
+    header.arguments_size = static_cast<uint32_t>(payload_size - format_size);
+    if (!logger_context_is_empty())
+    {
+        ft_string context_fragment;
+
+        if (context_fragment.initialize() == FT_ERR_SUCCESS
+            && logger_context_format_flat(context_fragment) == FT_ERR_SUCCESS
+            && payload_size + context_fragment.size() <= FT_LOG_BINARY_MAX_PAYLOAD)
+        {
+            ft_memcpy(g_log_binary_scratch + payload_size, context_fragment.c_str(),
+                context_fragment.size());
+            header.context_size = static_cast<uint32_t>(context_fragment.size());
+        }
+    }
+    record_size = sizeof(header) + payload_size + header.context_size;
+    record_size = (record_size + 7) & ~static_cast<ft_size_t>(7);
+    header.size = static_cast<uint32_t>(record_size);
+    if (!logger_binary_buffer_write(buffer, &header, g_log_binary_scratch))
+        buffer->dropped_records.fetch_add(1, std::memory_order_relaxed);
+    return ;
+}
+
+static ft_bool logger_binary_stream_reserve(ft_size_t additional)
+{
+    unsigned char *resized_stream;
+    ft_size_t new_capacity;
+
+    if (g_log_binary_stream_size + additional <= g_log_binary_stream_capacity)
+        return (FT_TRUE);
+    new_capacity = g_log_binary_stream_capacity * 2;
+    if (new_capacity < 4096)
+        new_capacity = 4096;
+    while (new_capacity < g_log_binary_stream_size + additional)
+        new_capacity *= 2;
+    resized_stream = static_cast<unsigned char *>(cma_realloc(g_log_binary_stream,
+                new_capacity));
+    if (resized_stream == ft_nullptr)
+        return (FT_FALSE);
+    g_log_binary_stream = resized_stream;
+    g_log_binary_stream_capacity = new_capacity;
+    return (FT_TRUE);
+}
+
+static ft_bool logger_binary_stream_append(const s_log_binary_stream_entry *entry,
+        const void *payload, ft_size_t payload_size)
+{
+    if (!logger_binary_stream_reserve(entry->size))
+        return (FT_FALSE);
+    ft_memcpy(g_log_binary_stream + g_log_binary_stream_size, entry, sizeof(*entry));
+    if (payload_size > 0)
+        ft_memcpy(g_log_binary_stream + g_log_binary_stream_size + sizeof(*entry),
+            payload, payload_size);
+    g_log_binary_stream_size += entry->size;
+    return (FT_TRUE);
+}
+
+static uint64_t logger_binary_format_hash(const char *format, ft_size_t length)
+{
+    uint64_t hash;
+    ft_size_t index;
+
+    hash = 14695981039346656037ULL;
+    index = 0;
+    while (index < length)
+    {
+        hash ^= static_cast<unsigned char>(format[index]);
+        hash *= 1099511628211ULL;
+        index++;
+    }
+    return (hash);
+}
+
+static ft_bool logger_binary_store_format_text(uint32_t format_id, const char *format,
+        ft_size_t length)
+{
+    char **resized_texts;
+    char *text;
+    ft_size_t new_capacity;
+
+    if (format_id >= g_log_binary_format_capacity)
+    {
+        new_capacity = g_log_binary_format_capacity * 2;
+        if (new_capacity < 16)
+            new_capacity = 16;
+        resized_texts = static_cast<char **>(cma_realloc(g_log_binary_format_texts,
+                    new_capacity * sizeof(char *)));
+        if (resized_texts == ft_nullptr)
+            return (FT_FALSE);
+        g_log_binary_format_texts = resized_texts;
+        g_log_binary_format_capacity = new_capacity;
+    }
+    text = static_cast<char *>(cma_malloc(length + 1));
+    if (text == ft_nullptr)
+        return (FT_FALSE);
+    ft_memcpy(text, format, length + 1);
+    g_log_binary_format_texts[format_id] = text;
+    return (FT_TRUE);
+}
+
+static void logger_binary_clear_format_texts(void)
+{
+    uint32_t format_id;
+
+    format_id = 0;
+    while (format_id < g_log_binary_next_format_id)
+    {
+        cma_free(g_log_binary_format_texts[format_id]);
+        format_id++;
+    }
+    g_log_binary_format_ids.clear();
+    g_log_binary_next_format_id = 0;
+    return ;
+}
+
+static ft_bool logger_binary_stream_format_id(const char *format, ft_size_t length,
+        uint32_t *format_id)
+{
+    s_log_binary_stream_entry entry;
+    uint64_t key;
+
+    key = logger_binary_format_hash(format, length);
+    while (1)
+    {
+        ft_unordered_map<uint64_t, uint32_t>::iterator found(
+            g_log_binary_format_ids.find(key));
+        if (found == g_log_binary_format_ids.end())
+            break ;
+        if (ft_strcmp(g_log_binary_format_texts[found->second], format) == 0)
+        {
+            *format_id = found->second;
+            return (FT_TRUE);
+        }
+        key++;
+    }
+    if (!logger_binary_store_format_text(g_log_binary_next_format_id, format, length))
+        return (FT_FALSE);
+    entry.size = static_cast<uint32_t>(sizeof(entry) + length);
+    entry.type = LOG_BINARY_ENTRY_FORMAT;
+    entry.level = 0;
+    entry.flags = 0;
+    entry.reserved = 0;
+    entry.format_id = g_log_binary_next_format_id;
+    entry.arguments_size = static_cast<uint32_t>(length);
+    entry.context_size = 0;
+    entry.reserved_tail = 0;
+    entry.timestamp = 0;
+    if (!logger_binary_stream_append(&entry, format, length))
+    {
+        cma_free(g_log_binary_format_texts[entry.format_id]);
+        return (FT_FALSE);
+    }
+    g_log_binary_format_ids.insert(key, entry.format_id);
+    if (g_log_binary_format_ids.get_error() != FT_ERR_SUCCESS)
+    {
+        cma_free(g_log_binary_format_texts[entry.format_id]);
+        return (FT_FALSE);
+    }
+    g_log_binary_next_format_id++;
+    *format_id = entry.format_id;
+    return (FT_TRUE);
+}
+
+static void logger_binary_emit_stream_record(const s_log_binary_record *header,
+        const unsigned char *payload, int64_t wall_timestamp)
+{
+    s_log_binary_stream_entry entry;
+    uint32_t format_id;
+
+    format_id = 0;
+    if ((header->flags & LOG_BINARY_FLAG_PREFORMATTED) == 0
+        && !logger_binary_stream_format_id(reinterpret_cast<const char *>(payload),
+            static_cast<ft_size_t>(header->format_size) - 1, &format_id))
+        return ;
+    entry.size = static_cast<uint32_t>(sizeof(entry) + header->arguments_size
+            + header->context_size);
+    entry.type = LOG_BINARY_ENTRY_RECORD;
+    entry.level = header->level;
+    entry.flags = static_cast<uint8_t>(header->flags & LOG_BINARY_FLAG_PREFORMATTED);
+    entry.reserved = 0;
+    entry.format_id = format_id;
+    entry.arguments_size = header->arguments_size;
+    entry.context_size = header->context_size;
+    entry.reserved_tail = 0;
+    entry.timestamp = wall_timestamp;
+    (void)logger_binary_stream_append(&entry, payload + header->format_size,
+        static_cast<ft_size_t>(header->arguments_size) + header->context_size);
+    return ;
+}
+
+static void logger_binary_process_record(const s_log_binary_record *header,
+        const unsigned char *payload)
+{
+    ft_string message_text;
+    ft_string formatted_message;
+    const unsigned char *arguments;
+    int64_t wall_timestamp;
+    int32_t error_code;
+
+    wall_timestamp = g_log_binary_wall_base
+        + (header->timestamp - g_log_binary_monotonic_base);
+    if (g_log_binary_sink != ft_nullptr)
+    {
+        logger_binary_emit_stream_record(header, payload, wall_timestamp);
+        return ;
+    }
+    if (message_text.initialize() != FT_ERR_SUCCESS
+        || formatted_message.initialize() != FT_ERR_SUCCESS)
+        return ;
+    arguments = payload + header->format_size;
+    if ((header->flags & LOG_BINARY_FLAG_PREFORMATTED) != 0)
+        error_code = message_text.append(reinterpret_cast<const char *>(arguments),
+                header->arguments_size);
+    else
+        error_code = logger_binary_render_message(reinterpret_cast<const char *>(payload),
+                arguments, header->arguments_size, message_text);
+    if (error_code != FT_ERR_SUCCESS)
+        return ;
+    if (logger_binary_finish_record(static_cast<t_log_level>(header->level),
+            wall_timestamp, message_text,
+            reinterpret_cast<const char *>(arguments + header->arguments_size),
+            header->context_size, formatted_message) != FT_ERR_SUCCESS)
+        return ;
+    (void)sink_record_message(static_cast<int32_t>(header->level),
+        formatted_message.c_str());
+    ft_log_process_message(static_cast<t_log_level>(header->level),
+        formatted_message.c_str(), formatted_message.size());
+    return ;
+}
+
+static ft_size_t logger_binary_drain_buffer(s_log_binary_buffer *buffer)
+{
+    s_log_binary_record header;
+    ft_size_t read_position;
+    ft_size_t write_position;
+    ft_size_t offset;
+    ft_size_t processed;
+
+    processed = 0;
+    read_position = buffer->read_position.load(std::memory_order_relaxed);
+    write_position = buffer->write_position.load(std::memory_order_acquire);
+    while (read_position < write_position)
+    {
+        offset = read_position % FT_LOG_BINARY_BUFFER_SIZE;
+        ft_memcpy(&header, buffer->data + offset, 8);
+        if ((header.flags & LOG_BINARY_FLAG_WRAP) == 0)
+        {
+            ft_memcpy(&header, buffer->data + offset, sizeof(header));
+            logger_binary_process_record(&header, buffer->data + offset + sizeof(header));
+            processed++;
+        }
+        read_position += header.size;
+        buffer->read_position.store(read_position, std::memory_order_release);
+    }
+    return (processed);
+}
+
+static void logger_binary_unlink_buffer(s_log_binary_buffer *buffer)
+{
+    s_log_binary_buffer *expected;
+    s_log_binary_buffer *previous;
+
+    expected = buffer;
+    if (g_log_binary_buffers.compare_exchange_strong(expected, buffer->next,
+            std::memory_order_acq_rel))
+        return ;
+    previous = g_log_binary_buffers.load(std::memory_order_acquire);
+    while (previous != ft_nullptr && previous->next != buffer)
+        previous = previous->next;
+    if (previous != ft_nullptr)
+        previous->next = buffer->next;
+    return ;
+}
+
+static ft_size_t logger_binary_drain_all_locked(ft_bool release_retired)
+{
+    s_log_binary_buffer *buffer;
+    s_log_binary_buffer *next_buffer;
+    ft_size_t processed;
+
+    processed = 0;
+    buffer = g_log_binary_buffers.load(std::memory_order_acquire);
+    while (buffer != ft_nullptr)
+    {
+        next_buffer = buffer->next;
+        processed += logger_binary_drain_buffer(buffer);
+        if (release_retired && buffer->retired.load(std::memory_order_acquire)
+            && buffer->read_position.load(std::memory_order_relaxed)
+                == buffer->write_position.load(std::memory_order_acquire))
+        {
+            logger_binary_unlink_buffer(buffer);
+            g_log_binary_retired_dropped += buffer->dropped_records.load(
+                    std::memory_order_relaxed);
+            delete buffer;
+        }
+        buffer = next_buffer;
+    }
+    if (g_log_binary_sink != ft_nullptr && g_log_binary_stream_size > 0)
+    {
+        (void)g_log_binary_sink(g_log_binary_stream, g_log_binary_stream_size,
+            g_log_binary_sink_user_data);
+        g_log_binary_stream_size = 0;
+    }
+    g_log_binary_records.fetch_add(processed, std::memory_order_relaxed);
+    return (processed);
+}
+
+static void *logger_binary_worker(void *argument)
+{
+    ft_size_t processed;
+    bool stop_requested;
+    ft_bool flush_pending;
+
+    (void)argument;
+    flush_pending = FT_FALSE;
+    while (1)
+    {
+        stop_requested = g_log_binary_stop.load(std::memory_order_acquire);
+        if (pthread_mutex_lock(&g_log_binary_mutex) != 0)
+            return (ft_nullptr);
+        processed = logger_binary_drain_all_locked(FT_TRUE);
+        pthread_mutex_unlock(&g_log_binary_mutex);
+        if (processed > 0)
+        {
+            flush_pending = FT_TRUE;
+            continue ;
+        }
+        if (flush_pending)
+        {
+            (void)logger_flush_sink_batches();
+            flush_pending = FT_FALSE;
+        }
+        if (stop_requested)
+            break ;
+        (void)pt_thread_sleep(FT_LOG_BINARY_POLL_INTERVAL_MS);
+    }
+    return (ft_nullptr);
+}
+
+void ft_log_enable_binary(ft_bool enable)
+{
+    if (pthread_mutex_lock(&g_log_binary_mutex) != 0)
+        return ;
+    if (enable)
+    {
+        if (g_binary_running)
+        {
+            pthread_mutex_unlock(&g_log_binary_mutex);
+            return ;
+        }
+        g_log_binary_monotonic_base = 0;
+        (void)cmp_high_resolution_time(&g_log_binary_monotonic_base);
+        g_log_binary_wall_base = time_now_ms() * 1000000LL;
+        g_log_binary_stop.store(false, std::memory_order_release);
+        g_binary_running = FT_TRUE;
+        pthread_mutex_unlock(&g_log_binary_mutex);
+        if (pt_thread_create(&g_log_binary_thread, ft_nullptr, logger_binary_worker,
+                ft_nullptr) != 0)
+        {
+            if (pthread_mutex_lock(&g_log_binary_mutex) != 0)
+                return ;
+            g_binary_running = FT_FALSE;
+            pthread_mutex_unlock(&g_log_binary_mutex);
+        }
+        return ;
+    }
+    if (!g_binary_running)
+    {
+        pthread_mutex_unlock(&g_log_binary_mutex);
+        return ;
+    }
+    g_binary_running = FT_FALSE;
+    g_log_binary_stop.store(true, std::memory_order_release);
+    pthread_mutex_unlock(&g_log_binary_mutex);
+    (void)pt_thread_join(g_log_binary_thread, ft_nullptr);
+    (void)ft_log_binary_flush();
+    return ;
+}
+
+ft_bool ft_log_is_binary_enabled()
+{
+    return (g_binary_running);
+}
+
+int32_t ft_log_binary_flush()
+{
+    if (pthread_mutex_lock(&g_log_binary_mutex) != 0)
+        return (FT_ERR_SYS_MUTEX_LOCK_FAILED);
+    (void)logger_binary_drain_all_locked(FT_FALSE);
+    pthread_mutex_unlock(&g_log_binary_mutex);
+    return (logger_flush_sink_batches());
+}
+
+void ft_log_set_binary_sink(t_log_binary_sink sink, void *user_data)
+{
+    if (pthread_mutex_lock(&g_log_binary_mutex) != 0)
+        return ;
+    (void)logger_binary_drain_all_locked(FT_FALSE);
+    g_log_binary_sink = sink;
+    g_log_binary_sink_user_data = user_data;
+    logger_binary_clear_format_texts();
+    pthread_mutex_unlock(&g_log_binary_mutex);
+    return ;
+}
+
+int32_t ft_log_get_binary_statistics(ft_size_t *record_count, ft_size_t *dropped_count)
+{
+    s_log_binary_buffer *buffer;
+    ft_size_t dropped_total;
+
+    if (record_count == ft_nullptr || dropped_count == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (pthread_mutex_lock(&g_log_binary_mutex) != 0)
+        return (FT_ERR_SYS_MUTEX_LOCK_FAILED);
+    dropped_total = g_log_binary_retired_dropped;
+    buffer = g_log_binary_buffers.load(std::memory_order_acquire);
+    while (buffer != ft_nullptr)
+    {
+        dropped_total += buffer->dropped_records.load(std::memory_order_relaxed);
+        buffer = buffer->next;
+    }
+    *record_count = g_log_binary_records.load(std::memory_order_relaxed);
+    *dropped_count = dropped_total;
+    pthread_mutex_unlock(&g_log_binary_mutex);
+    return (FT_ERR_SUCCESS);
+}
+
+void logger_binary_release_retired_buffers()
+{
+    if (pthread_mutex_lock(&g_log_binary_mutex) != 0)
+        return ;
+    (void)logger_binary_drain_all_locked(FT_TRUE);
+    logger_binary_clear_format_texts();
+    if (g_log_binary_format_texts != ft_nullptr)
+        cma_free(g_log_binary_format_texts);
+    g_log_binary_format_texts = ft_nullptr;
+    g_log_binary_format_capacity = 0;
+    if (g_log_binary_stream != ft_nullptr)
+        cma_free(g_log_binary_stream);
+    g_log_binary_stream = ft_nullptr;
+    g_log_binary_stream_size = 0;
+    g_log_binary_stream_capacity = 0;
+    pthread_mutex_unlock(&g_log_binary_mutex);
+    return ;
+}
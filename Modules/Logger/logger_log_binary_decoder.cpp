@@ -0,0 +1,580 @@
+#include "logger.hpp"
+#include "logger_internal.hpp"
+#include "../Basic/basic.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../Printf/printf.hpp"
+#include "../Basic/limits.hpp"
+#include "../PThread/mutex.hpp"
+#include "../PThread/recursive_mutex.hpp"
+#include "../Template/vector.hpp"
+
+static ft_bool logger_binary_is_flag(char character)
+{
+    if (character == '-' || character == '+' || character == ' '
+        || character == '#' || character == '0')
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
+static ft_size_t logger_binary_skip_digits(const char *format, ft_size_t index)
+{
+    while (format[index] >= '0' && format[index] <= '9')
+        index++;
+    return (index);
+}
+
+int32_t logger_binary_parse_spec(const char *format, ft_size_t start,
+        s_log_binary_spec *spec)
+{
+    ft_size_t index;
+    ft_size_t digits_end;
+    ft_size_t modifier_length;
+    char conversion;
+
+    if (format == ft_nullptr || spec == ft_nullptr || format[start] != '%')
+        return (FT_ERR_INVALID_ARGUMENT);
+    spec->start = start;
+    spec->length_modifier[0] = '\0';
+    spec->length_modifier[1] = '\0';
+    spec->length_modifier[2] = '\0';
+    index = start + 1;
+    while (logger_binary_is_flag(format[index]))
+        index++;
+    if (format[index] == '*')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    digits_end = logger_binary_skip_digits(format, index);
+    if (format[digits_end] == '$')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    index = digits_end;
+    if (format[index] == '.')
+    {
+        index++;
+        if (format[index] == '*')
+            return (FT_ERR_UNSUPPORTED_TYPE);
+        index = logger_binary_skip_digits(format, index);
+    }
+    spec->body_end = index;
+    modifier_length = 0;
+    if ((format[index] == 'h' && format[index + 1] == 'h')
+        || (format[index] == 'l' && format[index + 1] == 'l'))
+        modifier_length = 2;
+    else if (format[index] == 'h' || format[index] == 'l' || format[index] == 'j'
+        || format[index] == 'z' || format[index] == 't' || format[index] == 'L')
+        modifier_length = 1;
+    if (modifier_length > 0)
+        spec->length_modifier[0] = format[index];
+    if (modifier_length > 1)
+        spec->length_modifier[1] = format[index + 1];
+    index += modifier_length;
+    conversion = format[index];
+    spec->conversion = conversion;
+    spec->end = index + 1;
+    if (conversion == '\0')
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (conversion == '%')
+        spec->argument_class = LOG_BINARY_ARGUMENT_NONE;
+    else if (conversion == 'd' || conversion == 'i')
+        spec->argument_class = LOG_BINARY_ARGUMENT_SIGNED;
+    else if (conversion == 'u' || conversion == 'o' || conversion == 'x'
+        || conversion == 'X')
+        spec->argument_class = LOG_BINARY_ARGUMENT_UNSIGNED;
+    else if (conversion == 'f' || conversion == 'F' || conversion == 'e'
+        || conversion == 'E' || conversion == 'g' || conversion == 'G'
+        || conversion == 'a' || conversion == 'A')
+    {
+        if (spec->length_modifier[0] == 'L')
+            spec->argument_class = LOG_BINARY_ARGUMENT_LONG_DOUBLE;
+        else
+            spec->argument_class = LOG_BINARY_ARGUMENT_DOUBLE;
+        return (FT_ERR_SUCCESS);
+    }
+    else if (conversion == 'c' && spec->length_modifier[0] == '\0')
+        spec->argument_class = LOG_BINARY_ARGUMENT_CHAR;
+    else if (conversion == 's' && spec->length_modifier[0] == '\0')
+        spec->argument_class = LOG_BINARY_ARGUMENT_STRING;
+    else if (conversion == 'p' && spec->length_modifier[0] == '\0')
+        spec->argument_class = LOG_BINARY_ARGUMENT_POINTER;
+    else
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    if (spec->length_modifier[0] == 'L')
+        return (FT_ERR_UNSUPPORTED_TYPE);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t logger_binary_build_conversion(const char *format,
+        const s_log_binary_spec *spec, char *conversion_buffer,
+        ft_size_t buffer_size)
+{
+    ft_size_t body_length;
+    ft_size_t index;
+
+    body_length = spec->body_end - spec->start;
+    if (body_length + 4 > buffer_size)
+        return (FT_ERR_OUT_OF_RANGE);
+    ft_memcpy(conversion_buffer, format + spec->start, body_length);
+    index = body_length;
+    if (spec->argument_class == LOG_BINARY_ARGUMENT_SIGNED
+        || spec->argument_class == LOG_BINARY_ARGUMENT_UNSIGNED)
+    {
+        conversion_buffer[index++] = 'l';
+        conversion_buffer[index++] = 'l';
+    }
+    else if (spec->argument_class == LOG_BINARY_ARGUMENT_LONG_DOUBLE)
+        conversion_buffer[index++] = 'L';
+    conversion_buffer[index++] = spec->conversion;
+    conversion_buffer[index] = '\0';
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t logger_binary_read_argument(const unsigned char *arguments,
+        ft_size_t arguments_size, ft_size_t *offset, uint8_t expected_class,
+        void *value, ft_size_t value_size)
+{
+    if (*offset + 1 + value_size > arguments_size)
+        return (FT_ERR_OUT_OF_RANGE);
+    if (arguments[*offset] != expected_class)
+        return (FT_ERR_INVALID_ARGUMENT);
+    ft_memcpy(value, arguments + *offset + 1, value_size);
+    *offset += 1 + value_size;
+    return (FT_ERR_SUCCESS);
+}
+
+struct s_log_binary_value
+{
+    int64_t     signed_value;
+    uint64_t    unsigned_value;
+    double      double_value;
+    long double long_double_value;
+    char        *string_value;
+};
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+static int32_t logger_binary_snprintf(char *target, ft_size_t target_size,
+        const char *conversion, uint8_t argument_class,
+        const s_log_binary_value *value)
+{
+    if (argument_class == LOG_BINARY_ARGUMENT_SIGNED)
+        return (pf_snprintf(target, target_size, conversion,
+                static_cast<long long>(value->signed_value)));
+    if (argument_class == LOG_BINARY_ARGUMENT_CHAR)
+        return (pf_snprintf(target, target_size, conversion,
+                static_cast<int32_t>(value->signed_value)));
+    if (argument_class == LOG_BINARY_ARGUMENT_UNSIGNED)
+        return (pf_snprintf(target, target_size, conversion,
+                static_cast<unsigned long long>(value->unsigned_value)));
+    if (argument_class == LOG_BINARY_ARGUMENT_POINTER)
+        return (pf_snprintf(target, target_size, conversion,
+                reinterpret_cast<void *>(static_cast<uintptr_t>(value->unsigned_value))));
+    if (argument_class == LOG_BINARY_ARGUMENT_DOUBLE)
+        return (pf_snprintf(target, target_size, conversion, value->double_value));
+    if (argument_class == LOG_BINARY_ARGUMENT_LONG_DOUBLE)
+        return (pf_snprintf(target, target_size, conversion,
+                value->long_double_value));
+    return (pf_snprintf(target, target_size, conversion, value->string_value));
+}
+#pragma GCC diagnostic pop
+
+static int32_t logger_binary_read_value(const s_log_binary_spec *spec,
+        const unsigned char *arguments, ft_size_t arguments_size,
+        ft_size_t *offset, s_log_binary_value *value)
+{
+    uint32_t string_length;
+    int32_t read_error;
+
+    if (spec->argument_class == LOG_BINARY_ARGUMENT_SIGNED
+        || spec->argument_class == LOG_BINARY_ARGUMENT_CHAR)
+        return (logger_binary_read_argument(arguments, arguments_size, offset,
+                spec->argument_class, &value->signed_value,
+                sizeof(value->signed_value)));
+    if (spec->argument_class == LOG_BINARY_ARGUMENT_UNSIGNED
+        || spec->argument_class == LOG_BINARY_ARGUMENT_POINTER)
+        return (logger_binary_read_argument(arguments, arguments_size, offset,
+                spec->argument_class, &value->unsigned_value,
+                sizeof(value->unsigned_value)));
+    if (spec->argument_class == LOG_BINARY_ARGUMENT_DOUBLE)
+        return (logger_binary_read_argument(arguments, arguments_size, offset,
+                spec->argument_class, &value->double_value,
+                sizeof(value->double_value)));
+    if (spec->argument_class == LOG_BINARY_ARGUMENT_LONG_DOUBLE)
+        return (logger_binary_read_argument(arguments, arguments_size, offset,
+                spec->argument_class, &value->long_double_value,
+                sizeof(value->long_double_value)));
+    read_error = logger_binary_read_argument(arguments, arguments_size, offset,
+            spec->argument_class, &string_length, sizeof(string_length));
+    if (read_error != FT_ERR_SUCCESS || string_length == LOG_BINARY_NULL_STRING)
+        return (read_error);
+    if (*offset + string_length > arguments_size)
+        return (FT_ERR_OUT_OF_RANGE);
+    value->string_value = static_cast<char *>(cma_malloc(string_length + 1));
+    if (value->string_value == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    ft_memcpy(value->string_value, arguments + *offset, string_length);
+    value->string_value[string_length] = '\0';
+    *offset += string_length;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t logger_binary_append_formatted(ft_string &output,
+        const char *conversion, const s_log_binary_spec *spec,
+        const unsigned char *arguments, ft_size_t arguments_size,
+        ft_size_t *offset)
+{
+    s_log_binary_value value;
+    char render_buffer[256];
+    char *heap_buffer;
+    int32_t rendered_length;
+    int32_t error_code;
+
+    value.signed_value = 0;
+    value.unsigned_value = 0;
+    value.double_value = 0.0;
+    value.long_double_value = 0.0L;
+    value.string_value = ft_nullptr;
+    error_code = logger_binary_read_value(spec, arguments, arguments_size, offset,
+            &value);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    heap_buffer = ft_nullptr;
+    rendered_length = logger_binary_snprintf(render_buffer, sizeof(render_buffer),
+            conversion, spec->argument_class, &value);
+    if (rendered_length >= 0
+        && static_cast<ft_size_t>(rendered_length) >= sizeof(render_buffer))
+    {
+        heap_buffer = static_cast<char *>(cma_malloc(
+                    static_cast<ft_size_t>(rendered_length) + 1));
+        if (heap_buffer != ft_nullptr)
+            rendered_length = logger_binary_snprintf(heap_buffer,
+                    static_cast<ft_size_t>(rendered_length) + 1, conversion,
+                    spec->argument_class, &value);
+        else
+            rendered_length = -1;
+    }
+    if (value.string_value != ft_nullptr)
+        cma_free(value.string_value);
+    if (rendered_length < 0)
+        error_code = FT_ERR_INTERNAL;
+    else if (heap_buffer != ft_nullptr)
+        error_code = output.append(heap_buffer, static_cast<ft_size_t>(rendered_length));
+    else
+        error_code = output.append(render_buffer, static_cast<ft_size_t>(rendered_length));
+    if (heap_buffer != ft_nullptr)
+        cma_free(heap_buffer);
+    return (error_code);
+}
+
+int32_t logger_binary_render_message(const char *format,
+        const unsigned char *arguments, ft_size_t arguments_size,
+        ft_string &output)
+{
+    s_log_binary_spec spec;
+    char conversion[64];
+    ft_size_t index;
+    ft_size_t literal_start;
+    ft_size_t offset;
+    int32_t error_code;
+
+    if (format == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    index = 0;
+    literal_start = 0;
+    offset = 0;
+    while (format[index] != '\0')
+    {
+        if (format[index] != '%')
+        {
+            index++;
+            continue ;
+        }
+        if (index > literal_start)
+        {
+            error_code = output.append(format + literal_start, index - literal_start);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+        }
+        error_code = logger_binary_parse_spec(format, index, &spec);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        if (spec.argument_class == LOG_BINARY_ARGUMENT_NONE)
+            error_code = output.append('%');
+        else
+        {
+            error_code = logger_binary_build_conversion(format, &spec, conversion,
+                    sizeof(conversion));
+            if (error_code == FT_ERR_SUCCESS)
+                error_code = logger_binary_append_formatted(output, conversion, &spec,
+                        arguments, arguments_size, &offset);
+        }
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        index = spec.end;
+        literal_start = index;
+    }
+    if (index > literal_start)
+        return (output.append(format + literal_start, index - literal_start));
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t logger_binary_finish_record(t_log_level level, int64_t timestamp_ns,
+        ft_string &message_text, const char *context, ft_size_t context_size,
+        ft_string &formatted_message)
+{
+    const s_log_redaction_snapshot *redaction_snapshot;
+    uint32_t redaction_epoch;
+    ft_string context_fragment;
+    int32_t error_code;
+
+    error_code = context_fragment.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (context != ft_nullptr && context_size > 0)
+    {
+        error_code = context_fragment.append(context, context_size);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+    }
+    redaction_epoch = 0;
+    redaction_snapshot = logger_redaction_read_lock(&redaction_epoch);
+    error_code = logger_apply_redactions(redaction_snapshot, message_text);
+    if (error_code == FT_ERR_SUCCESS && context_fragment.size() > 0)
+        error_code = logger_apply_redactions(redaction_snapshot, context_fragment);
+    logger_redaction_read_unlock(redaction_snapshot, redaction_epoch);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (logger_build_standard_message_at(level,
+            static_cast<t_time>(timestamp_ns / 1000000000LL), message_text,
+            context_fragment, formatted_message));
+}
+
+ft_log_binary_decoder::ft_log_binary_decoder() noexcept
+    : _initialised_state(FT_CLASS_STATE_UNINITIALISED), _formats(ft_nullptr),
+      _format_count(0), _format_capacity(0), _pending(ft_nullptr),
+      _pending_size(0), _pending_capacity(0), _error_code(FT_ERR_SUCCESS)
+{
+    return ;
+}
+
+ft_log_binary_decoder::~ft_log_binary_decoder() noexcept
+{
+    (void)this->destroy();
+    return ;
+}
+
+int32_t ft_log_binary_decoder::initialize() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+        errno_abort_lifecycle(this->_initialised_state,
+            "ft_log_binary_decoder::initialize",
+            "already initialised");
+    this->_formats = ft_nullptr;
+    this->_format_count = 0;
+    this->_format_capacity = 0;
+    this->_pending = ft_nullptr;
+    this->_pending_size = 0;
+    this->_pending_capacity = 0;
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t ft_log_binary_decoder::destroy() noexcept
+{
+    ft_size_t format_index;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (FT_ERR_SUCCESS);
+    format_index = 0;
+    while (format_index < this->_format_count)
+    {
+        if (this->_formats[format_index] != ft_nullptr)
+            cma_free(this->_formats[format_index]);
+        format_index++;
+    }
+    if (this->_formats != ft_nullptr)
+        cma_free(this->_formats);
+    if (this->_pending != ft_nullptr)
+        cma_free(this->_pending);
+    this->_formats = ft_nullptr;
+    this->_format_count = 0;
+    this->_format_capacity = 0;
+    this->_pending = ft_nullptr;
+    this->_pending_size = 0;
+    this->_pending_capacity = 0;
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    this->set_error(FT_ERR_SUCCESS);
+    return (FT_ERR_SUCCESS);
+}
+
+void ft_log_binary_decoder::set_error(int32_t error_code_value) const noexcept
+{
+    this->_error_code = error_code_value;
+    return ;
+}
+
+int32_t ft_log_binary_decoder::store_format(uint32_t format_id,
+        const unsigned char *text, ft_size_t length) noexcept
+{
+    char **resized_formats;
+    char *format_copy;
+    ft_size_t new_capacity;
+
+    if (format_id >= this->_format_capacity)
+    {
+        new_capacity = this->_format_capacity * 2;
+        if (new_capacity < 16)
+            new_capacity = 16;
+        while (new_capacity <= format_id)
+            new_capacity *= 2;
+        resized_formats = static_cast<char **>(cma_realloc(this->_formats,
+                    new_capacity * sizeof(char *)));
+        if (resized_formats == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        this->_formats = resized_formats;
+        while (this->_format_capacity < new_capacity)
+        {
+            this->_formats[this->_format_capacity] = ft_nullptr;
+            this->_format_capacity++;
+        }
+    }
+    format_copy = static_cast<char *>(cma_malloc(length + 1));
+    if (format_copy == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    ft_memcpy(format_copy, text, length);
+    format_copy[length] = '\0';
+    if (this->_formats[format_id] != ft_nullptr)
+        cma_free(this->_formats[format_id]);
+    this->_formats[format_id] = format_copy;
+    if (format_id >= this->_format_count)
+        this->_format_count = static_cast<ft_size_t>(format_id) + 1;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t ft_log_binary_decoder::decode_entry(const unsigned char *entry,
+        ft_string &output) noexcept
+{
+    s_log_binary_stream_entry header;
+    const unsigned char *payload;
+    ft_string message_text;
+    ft_string formatted_message;
+    int32_t error_code;
+
+    ft_memcpy(&header, entry, sizeof(header));
+    payload = entry + sizeof(header);
+    if (static_cast<ft_size_t>(header.arguments_size) + header.context_size
+        > header.size - sizeof(header))
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (header.type == LOG_BINARY_ENTRY_FORMAT)
+        return (this->store_format(header.format_id, payload, header.arguments_size));
+    if (header.type != LOG_BINARY_ENTRY_RECORD)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (header.level > LOG_LEVEL_ERROR)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = message_text.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = formatted_message.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if ((header.flags & LOG_BINARY_FLAG_PREFORMATTED) != 0)
+        error_code = message_text.append(reinterpret_cast<const char *>(payload),
+                header.arguments_size);
+    else
+    {
+        if (header.format_id >= this->_format_count
+            || this->_formats[header.format_id] == ft_nullptr)
+            return (FT_ERR_NOT_FOUND);
+        error_code = logger_binary_render_message(this->_formats[header.format_id],
+                payload, header.arguments_size, message_text);
+    }
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    error_code = logger_binary_finish_record(static_cast<t_log_level>(header.level),
+            header.timestamp,
+            message_text,
+            reinterpret_cast<const char *>(payload + header.arguments_size),
+            header.context_size, formatted_message);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (output.append(formatted_message));
+}
+
+int32_t ft_log_binary_decoder::decode(const void *data, ft_size_t size,
+        ft_string &output) noexcept
+{
+    unsigned char *resized_pending;
+    ft_size_t new_capacity;
+    ft_size_t offset;
+    uint32_t entry_size;
+    int32_t error_code;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        errno_abort_lifecycle(this->_initialised_state,
+            "ft_log_binary_decoder::decode",
+            "called on uninitialised decoder");
+    if (data == ft_nullptr && size > 0)
+    {
+        this->set_error(FT_ERR_INVALID_ARGUMENT);
+        return (FT_ERR_INVALID_ARGUMENT);
+    }
+    if (this->_pending_size + size > this->_pending_capacity)
+    {
+        new_capacity = this->_pending_capacity * 2;
+        if (new_capacity < 256)
+            new_capacity = 256;
+        while (new_capacity < this->_pending_size + size)
+            new_capacity *= 2;
+        resized_pending = static_cast<unsigned char *>(cma_realloc(this->_pending,
+                    new_capacity));
+        if (resized_pending == ft_nullptr)
+        {
+            this->set_error(FT_ERR_NO_MEMORY);
+            return (FT_ERR_NO_MEMORY);
+        }
+        this->_pending = resized_pending;
+        this->_pending_capacity = new_capacity;
+    }
+    if (size > 0)
+        ft_memcpy(this->_pending + this->_pending_size, data, size);
+    this->_pending_size += size;
+    offset = 0;
+    error_code = FT_ERR_SUCCESS;
+    while (this->_pending_size - offset >= sizeof(s_log_binary_stream_entry))
+    {
+        ft_memcpy(&entry_size, this->_pending + offset, sizeof(entry_size));
+        if (entry_size < sizeof(s_log_binary_stream_entry))
+        {
+            error_code = FT_ERR_INVALID_ARGUMENT;
+            break ;
+        }
+        if (this->_pending_size - offset < entry_size)
+            break ;
+        error_code = this->decode_entry(this->_pending + offset, output);
+        if (error_code != FT_ERR_SUCCESS)
+            break ;
+        offset += entry_size;
+    }
+    if (offset > 0)
+    {
+        ft_memmove(this->_pending, this->_pending + offset,
+            this->_pending_size - offset);
+        this->_pending_size -= offset;
+    }
+    this->set_error(error_code);
+    return (error_code);
+}
+
+ft_size_t ft_log_binary_decoder::pending_bytes() const noexcept
+{
+    return (this->_pending_size);
+}
+
+int32_t ft_log_binary_decoder::get_error() const noexcept
+{
+    return (this->_error_code);
+}
+
+const char *ft_log_binary_decoder::get_error_str() const noexcept
+{
+    return (ft_strerror(this->_error_code));
+}
@@ -16,6 +16,8 @@ static void log_close_report(void)
 void ft_log_close()
 {
     ft_log_enable_async(FT_FALSE);
+    ft_log_enable_binary(FT_FALSE);
+    ft_log_set_batching(0, 0);
     ft_log_enable_remote_health(FT_FALSE);
     ft_log_clear_redactions();
     logger_context_clear();
@@ -141,6 +143,7 @@ void ft_log_close()
                 file_lock_error = file_sink_lock(sink, &file_sink_lock_acquired);
                 if (file_lock_error != FT_ERR_SUCCESS)
                     file_sink_lock_acquired = FT_FALSE;
+                (void)logger_file_sink_flush_locked(sink);
                 (void)cmp_close(sink->file_descriptor);
                 sink->file_descriptor = -1;
                 if (file_sink_lock_acquired)
@@ -164,6 +167,7 @@ void ft_log_close()
                 network_lock_error = network_sink_lock(sink, &network_lock_acquired);
                 if (network_lock_error != FT_ERR_SUCCESS)
                     network_lock_acquired = FT_FALSE;
+                (void)logger_network_sink_flush_locked(sink);
                 cmp_close(sink->socket_fd);
                 sink->socket_fd = -1;
                 if (network_lock_acquired)
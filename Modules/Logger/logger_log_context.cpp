@@ -465,6 +465,43 @@ int32_t logger_context_format_flat(ft_string &output)
     return (FT_ERR_SUCCESS);
 }
 
+int32_t logger_context_format_flat_line(s_log_line_buffer *line)
+{
+    ft_size_t entry_count;
+    ft_size_t entry_index;
+    int32_t error_code_value;
+
+    error_code_value = logger_context_ensure_entries_ready();
+    if (error_code_value != FT_ERR_SUCCESS)
+        return (error_code_value);
+    entry_count = g_log_context_entries.size();
+    error_code_value = g_log_context_entries.get_error();
+    entry_index = 0;
+    while (error_code_value == FT_ERR_SUCCESS && entry_index < entry_count)
+    {
+        const s_log_context_entry &entry = g_log_context_entries[entry_index];
+
+        if (entry_index > 0)
+            error_code_value = logger_line_append(line, " ", 1);
+        if (error_code_value == FT_ERR_SUCCESS)
+            error_code_value = logger_line_append(line, entry.key.c_str(),
+                    entry.key.size());
+        if (error_code_value == FT_ERR_SUCCESS && entry.has_value)
+            error_code_value = logger_line_append(line, "=", 1);
+        if (error_code_value == FT_ERR_SUCCESS && entry.has_value)
+        {
+            if (logger_context_value_needs_quotes(entry.value.c_str()))
+                error_code_value = logger_line_append_quoted(line,
+                        entry.value.c_str());
+            else
+                error_code_value = logger_line_append(line, entry.value.c_str(),
+                        entry.value.size());
+        }
+        entry_index += 1;
+    }
+    return (error_code_value);
+}
+
 int32_t logger_context_snapshot(ft_vector<s_log_context_view> &snapshot)
 {
     ft_size_t entry_count;
@@ -517,6 +554,15 @@ int32_t logger_context_snapshot(ft_vector<s_log_context_view> &snapshot)
     return (FT_ERR_SUCCESS);
 }
 
+ft_bool logger_context_is_empty()
+{
+    if (g_log_context_entries.is_initialised() != FT_CLASS_STATE_INITIALISED)
+        return (FT_TRUE);
+    if (g_log_context_entries.size() == 0)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
 void logger_context_clear()
 {
     ft_size_t entry_count;
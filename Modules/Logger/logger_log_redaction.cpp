@@ -1,5 +1,9 @@
 #include "logger_internal.hpp"
 #include "../Basic/basic.hpp"
+#include "../CMA/CMA.hpp"
+#include "../PThread/pthread.hpp"
+#include <atomic>
+#include <new>
 #include "../Basic/limits.hpp"
 #include "../PThread/mutex.hpp"
 #include "../PThread/recursive_mutex.hpp"
@@ -7,6 +11,9 @@
 #include "../Errno/errno.hpp"
 
 ft_vector<s_redaction_rule> g_redaction_rules;
+static std::atomic<s_log_redaction_snapshot *> g_redaction_snapshot(ft_nullptr);
+static std::atomic<uint32_t> g_redaction_epoch(0);
+static std::atomic<ft_size_t> g_redaction_readers[2];
 
 int32_t s_redaction_rule::initialize(const s_redaction_rule &other) noexcept
 {
@@ -33,63 +40,246 @@ int32_t s_redaction_rule::destroy() noexcept
     return (first_error);
 }
 
-static int32_t logger_apply_redaction_rule(ft_string &text,
-    const s_redaction_rule &rule)
+static void logger_redaction_snapshot_free(s_log_redaction_snapshot *snapshot)
 {
-    const char *pattern;
-    const char *replacement;
-    ft_size_t pattern_length;
-    ft_size_t text_length;
-    ft_size_t entry_index;
-    const char *source;
-    ft_string operation_result;
-    int32_t error_code_value;
+    ft_size_t rule_index;
 
-    if (operation_result.initialize() != FT_ERR_SUCCESS)
+    if (snapshot == ft_nullptr)
+        return ;
+    if (snapshot->replacements != ft_nullptr)
+    {
+        rule_index = 0;
+        while (rule_index < snapshot->rule_count)
+        {
+            cma_free(snapshot->replacements[rule_index]);
+            rule_index++;
+        }
+        cma_free(snapshot->replacements);
+    }
+    cma_free(snapshot->transitions);
+    cma_free(snapshot->depth);
+    cma_free(snapshot->match_length);
+    cma_free(snapshot->match_rule);
+    cma_free(snapshot->replacement_lengths);
+    delete snapshot;
+    return ;
+}
+
+static void *logger_redaction_allocate_zeroed(ft_size_t count, ft_size_t element_size)
+{
+    void *memory_pointer;
+
+    memory_pointer = cma_malloc(count * element_size);
+    if (memory_pointer != ft_nullptr)
+        ft_bzero(memory_pointer, count * element_size);
+    return (memory_pointer);
+}
+
+static int32_t logger_redaction_snapshot_allocate(s_log_redaction_snapshot *snapshot,
+    ft_size_t state_limit)
+{
+    snapshot->transitions = static_cast<uint32_t *>(logger_redaction_allocate_zeroed(
+                state_limit * snapshot->class_count, sizeof(uint32_t)));
+    snapshot->depth = static_cast<uint32_t *>(logger_redaction_allocate_zeroed(
+                state_limit, sizeof(uint32_t)));
+    snapshot->match_length = static_cast<uint32_t *>(logger_redaction_allocate_zeroed(
+                state_limit, sizeof(uint32_t)));
+    snapshot->match_rule = static_cast<uint32_t *>(logger_redaction_allocate_zeroed(
+                state_limit, sizeof(uint32_t)));
+    snapshot->replacements = static_cast<char **>(logger_redaction_allocate_zeroed(
+                snapshot->rule_count, sizeof(char *)));
+    snapshot->replacement_lengths = static_cast<ft_size_t *>(
+            logger_redaction_allocate_zeroed(snapshot->rule_count, sizeof(ft_size_t)));
+    if (snapshot->transitions == ft_nullptr || snapshot->depth == ft_nullptr
+        || snapshot->match_length == ft_nullptr || snapshot->match_rule == ft_nullptr
+        || snapshot->replacements == ft_nullptr
+        || snapshot->replacement_lengths == ft_nullptr)
         return (FT_ERR_NO_MEMORY);
-    if (!text.is_initialised() || !rule.pattern.is_initialised()
-        || !rule.replacement.is_initialised())
-        return (FT_ERR_NOT_INITIALISED);
-    pattern = rule.pattern.c_str();
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t logger_redaction_insert_rule(s_log_redaction_snapshot *snapshot,
+    const s_redaction_rule &rule, uint32_t rule_index)
+{
+    const unsigned char *pattern;
+    ft_size_t pattern_length;
+    ft_size_t character_index;
+    uint32_t state;
+    uint32_t *next_state;
+
+    pattern = reinterpret_cast<const unsigned char *>(rule.pattern.c_str());
     pattern_length = rule.pattern.size();
-    if (pattern_length == 0)
-        return (FT_ERR_SUCCESS);
-    replacement = rule.replacement.c_str();
-    text_length = text.size();
-    source = text.c_str();
-    if (!source)
-        source = "";
-    entry_index = 0;
-    while (entry_index < text_length)
-    {
-        ft_size_t match_index;
-
-        match_index = 0;
-        while (entry_index + match_index < text_length
-            && match_index < pattern_length
-            && source[entry_index + match_index] == pattern[match_index])
-            match_index++;
-        if (match_index == pattern_length)
+    state = 0;
+    character_index = 0;
+    while (character_index < pattern_length)
+    {
+        next_state = &snapshot->transitions[state * snapshot->class_count
+            + snapshot->byte_class[pattern[character_index]]];
+        if (*next_state == 0)
+        {
+            *next_state = snapshot->state_count;
+            snapshot->depth[snapshot->state_count] = snapshot->depth[state] + 1;
+            snapshot->state_count++;
+        }
+        state = *next_state;
+        character_index++;
+    }
+    if (snapshot->match_length[state] == 0)
+    {
+        snapshot->match_length[state] = snapshot->depth[state];
+        snapshot->match_rule[state] = rule_index;
+    }
+    snapshot->replacement_lengths[rule_index] = rule.replacement.size();
+    snapshot->replacements[rule_index] = static_cast<char *>(
+            cma_malloc(snapshot->replacement_lengths[rule_index] + 1));
+    if (snapshot->replacements[rule_index] == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    ft_memcpy(snapshot->replacements[rule_index], rule.replacement.c_str(),
+        snapshot->replacement_lengths[rule_index] + 1);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t logger_redaction_link_states(s_log_redaction_snapshot *snapshot)
+{
+    uint32_t *fail_links;
+    uint32_t *queue;
+    uint32_t queue_head;
+    uint32_t queue_tail;
+    uint32_t state;
+    uint32_t class_index;
+    uint32_t *row;
+    const uint32_t *fail_row;
+
+    fail_links = static_cast<uint32_t *>(logger_redaction_allocate_zeroed(
+                snapshot->state_count, sizeof(uint32_t)));
+    queue = static_cast<uint32_t *>(cma_malloc(snapshot->state_count * sizeof(uint32_t)));
+    if (fail_links == ft_nullptr || queue == ft_nullptr)
+    {
+        cma_free(fail_links);
+        cma_free(queue);
+        return (FT_ERR_NO_MEMORY);
+    }
+    queue_head = 0;
+    queue_tail = 0;
+    class_index = 0;
+    while (class_index < snapshot->class_count)
+    {
+        if (snapshot->transitions[class_index] != 0)
+            queue[queue_tail++] = snapshot->transitions[class_index];
+        class_index++;
+    }
+    while (queue_head < queue_tail)
+    {
+        state = queue[queue_head++];
+        if (snapshot->match_length[state] == 0
+            && snapshot->match_length[fail_links[state]] != 0)
         {
-            error_code_value = operation_result.append(replacement);
-            if (error_code_value != FT_ERR_SUCCESS)
-                return (error_code_value);
-            entry_index += pattern_length;
+            snapshot->match_length[state] = snapshot->match_length[fail_links[state]];
+            snapshot->match_rule[state] = snapshot->match_rule[fail_links[state]];
         }
-        else
+        row = &snapshot->transitions[state * snapshot->class_count];
+        fail_row = &snapshot->transitions[fail_links[state] * snapshot->class_count];
+        class_index = 0;
+        while (class_index < snapshot->class_count)
         {
-            error_code_value = operation_result.append(source[entry_index]);
-            if (error_code_value != FT_ERR_SUCCESS)
-                return (error_code_value);
-            entry_index++;
+            if (row[class_index] != 0)
+            {
+                fail_links[row[class_index]] = fail_row[class_index];
+                queue[queue_tail++] = row[class_index];
+            }
+            else
+                row[class_index] = fail_row[class_index];
+            class_index++;
         }
     }
-    error_code_value = text.destroy();
-    if (error_code_value != FT_ERR_SUCCESS)
-        return (error_code_value);
-    error_code_value = text.initialize(operation_result);
-    if (error_code_value != FT_ERR_SUCCESS)
-        return (error_code_value);
+    cma_free(fail_links);
+    cma_free(queue);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t logger_redaction_snapshot_build(s_log_redaction_snapshot **snapshot_out)
+{
+    s_log_redaction_snapshot *snapshot;
+    ft_size_t rule_count;
+    ft_size_t rule_index;
+    ft_size_t state_limit;
+    ft_size_t character_index;
+    const unsigned char *pattern;
+    int32_t error_code;
+
+    *snapshot_out = ft_nullptr;
+    rule_count = g_redaction_rules.size();
+    if (rule_count == 0)
+        return (FT_ERR_SUCCESS);
+    snapshot = new (std::nothrow) s_log_redaction_snapshot();
+    if (snapshot == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    snapshot->rule_count = rule_count;
+    snapshot->class_count = 1;
+    state_limit = 1;
+    rule_index = 0;
+    while (rule_index < rule_count)
+    {
+        pattern = reinterpret_cast<const unsigned char *>(
+                g_redaction_rules[rule_index].pattern.c_str());
+        character_index = 0;
+        while (pattern[character_index] != '\0')
+        {
+            if (snapshot->byte_class[pattern[character_index]] == 0)
+            {
+                snapshot->byte_class[pattern[character_index]]
+                    = static_cast<uint16_t>(snapshot->class_count);
+                snapshot->class_count++;
+            }
+            character_index++;
+        }
+        state_limit += character_index;
+        rule_index++;
+    }
+    error_code = logger_redaction_snapshot_allocate(snapshot, state_limit);
+    snapshot->state_count = 1;
+    rule_index = 0;
+    while (error_code == FT_ERR_SUCCESS && rule_index < rule_count)
+    {
+        error_code = logger_redaction_insert_rule(snapshot,
+                g_redaction_rules[rule_index], static_cast<uint32_t>(rule_index));
+        rule_index++;
+    }
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = logger_redaction_link_states(snapshot);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        logger_redaction_snapshot_free(snapshot);
+        return (error_code);
+    }
+    *snapshot_out = snapshot;
+    return (FT_ERR_SUCCESS);
+}
+
+static void logger_redaction_publish(s_log_redaction_snapshot *snapshot)
+{
+    s_log_redaction_snapshot *previous_snapshot;
+    uint32_t previous_epoch;
+
+    previous_snapshot = g_redaction_snapshot.exchange(snapshot, std::memory_order_seq_cst);
+    if (previous_snapshot == ft_nullptr)
+        return ;
+    previous_epoch = g_redaction_epoch.fetch_add(1, std::memory_order_seq_cst);
+    while (g_redaction_readers[previous_epoch & 1].load(std::memory_order_seq_cst) != 0)
+        (void)pt_thread_yield();
+    logger_redaction_snapshot_free(previous_snapshot);
+    return ;
+}
+
+static int32_t logger_redaction_rebuild(void)
+{
+    s_log_redaction_snapshot *snapshot;
+    int32_t error_code;
+
+    error_code = logger_redaction_snapshot_build(&snapshot);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    logger_redaction_publish(snapshot);
     return (FT_ERR_SUCCESS);
 }
 
@@ -139,12 +329,15 @@ int32_t ft_log_add_redaction_with_replacement(const char *pattern,
             return (unlock_status);
         return (error_code_value);
     }
+    error_code_value = logger_redaction_rebuild();
+    if (error_code_value != FT_ERR_SUCCESS)
+        g_redaction_rules.pop_back();
     unlock_status = logger_unlock_sinks();
     if (unlock_status != FT_ERR_SUCCESS)
     {
         return (unlock_status);
     }
-    return (FT_ERR_SUCCESS);
+    return (error_code_value);
 }
 
 int32_t ft_log_add_redaction(const char *pattern)
@@ -165,6 +358,7 @@ void ft_log_clear_redactions()
     }
     g_redaction_rules.clear();
     clear_error = g_redaction_rules.get_error();
+    logger_redaction_publish(ft_nullptr);
     unlock_status = logger_unlock_sinks();
     if (unlock_status != FT_ERR_SUCCESS)
     {
@@ -177,71 +371,193 @@ void ft_log_clear_redactions()
     return ;
 }
 
-int32_t logger_copy_redaction_rules(ft_vector<s_redaction_rule> &destination)
+const s_log_redaction_snapshot *logger_redaction_read_lock(uint32_t *epoch)
+{
+    s_log_redaction_snapshot *snapshot;
+    uint32_t current_epoch;
+
+    if (g_redaction_snapshot.load(std::memory_order_acquire) == ft_nullptr)
+        return (ft_nullptr);
+    while (1)
+    {
+        current_epoch = g_redaction_epoch.load(std::memory_order_seq_cst);
+        g_redaction_readers[current_epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+        if (g_redaction_epoch.load(std::memory_order_seq_cst) == current_epoch)
+            break ;
+        g_redaction_readers[current_epoch & 1].fetch_sub(1, std::memory_order_seq_cst);
+    }
+    snapshot = g_redaction_snapshot.load(std::memory_order_seq_cst);
+    if (snapshot == ft_nullptr)
+    {
+        g_redaction_readers[current_epoch & 1].fetch_sub(1, std::memory_order_seq_cst);
+        return (ft_nullptr);
+    }
+    *epoch = current_epoch;
+    return (snapshot);
+}
+
+void logger_redaction_read_unlock(const s_log_redaction_snapshot *snapshot,
+    uint32_t epoch)
+{
+    if (snapshot == ft_nullptr)
+        return ;
+    g_redaction_readers[epoch & 1].fetch_sub(1, std::memory_order_seq_cst);
+    return ;
+}
+
+static int32_t logger_redaction_emit(ft_string &redacted, const char *source,
+    ft_size_t emitted_index, ft_size_t match_start, const char *replacement,
+    ft_size_t replacement_length)
 {
-    ft_size_t rule_count;
-    ft_size_t entry_index;
     int32_t error_code_value;
-    uint8_t destination_state;
-    int32_t destination_initialize_error;
 
-    destination_state = destination.is_initialised();
-    if (destination_state != FT_CLASS_STATE_INITIALISED)
+    if (!redacted.is_initialised())
     {
-        destination_initialize_error = destination.initialize();
-        if (destination_initialize_error != FT_ERR_SUCCESS)
-            return (destination_initialize_error);
+        error_code_value = redacted.initialize();
+        if (error_code_value != FT_ERR_SUCCESS)
+            return (error_code_value);
     }
-    rule_count = g_redaction_rules.size();
-    error_code_value = g_redaction_rules.get_error();
+    error_code_value = redacted.append(source + emitted_index, match_start - emitted_index);
     if (error_code_value != FT_ERR_SUCCESS)
         return (error_code_value);
-    entry_index = 0;
-    while (entry_index < rule_count)
+    return (redacted.append(replacement, replacement_length));
+}
+
+static ft_bool logger_redaction_find(const s_log_redaction_snapshot *snapshot,
+    const char *source, ft_size_t text_length, ft_size_t position,
+    ft_size_t *match_start, ft_size_t *match_length, uint32_t *match_rule)
+{
+    ft_bool has_match;
+    uint32_t state;
+
+    has_match = FT_FALSE;
+    state = 0;
+    while (position < text_length)
     {
-        const s_redaction_rule &source_rule = g_redaction_rules[entry_index];
-        error_code_value = g_redaction_rules.get_error();
-        if (error_code_value != FT_ERR_SUCCESS)
-            return (error_code_value);
-        destination.push_back(source_rule);
-        error_code_value = destination.get_error();
-        if (error_code_value != FT_ERR_SUCCESS)
-            return (error_code_value);
-        entry_index++;
+        state = snapshot->transitions[state * snapshot->class_count
+            + snapshot->byte_class[static_cast<unsigned char>(source[position])]];
+        position++;
+        if (snapshot->match_length[state] != 0
+            && (!has_match || position - snapshot->match_length[state] < *match_start))
+        {
+            *match_length = snapshot->match_length[state];
+            *match_start = position - *match_length;
+            *match_rule = snapshot->match_rule[state];
+            has_match = FT_TRUE;
+        }
+        else if (has_match && snapshot->match_length[state] != 0
+            && position - snapshot->match_length[state] == *match_start)
+        {
+            *match_length = snapshot->match_length[state];
+            *match_rule = snapshot->match_rule[state];
+        }
+        if (has_match && position - snapshot->depth[state] > *match_start)
+            return (FT_TRUE);
     }
-    error_code_value = FT_ERR_SUCCESS;
-    return (error_code_value);
+    return (has_match);
 }
 
-int32_t logger_apply_redactions(ft_string &text,
-    const ft_vector<s_redaction_rule> &rules)
+int32_t logger_apply_redactions(const s_log_redaction_snapshot *snapshot,
+    ft_string &text)
 {
-    ft_size_t rule_count;
-    ft_size_t entry_index;
+    const char *source;
+    ft_size_t text_length;
+    ft_size_t emitted_index;
+    ft_size_t match_start;
+    ft_size_t match_length;
+    uint32_t match_rule;
+    ft_string redacted;
     int32_t error_code_value;
 
-    if (!rules.is_initialised())
-        return (FT_ERR_NOT_INITIALISED);
+    if (snapshot == ft_nullptr)
+        return (FT_ERR_SUCCESS);
     if (!text.is_initialised())
         return (FT_ERR_NOT_INITIALISED);
-    rule_count = rules.size();
-    error_code_value = rules.get_error();
-    if (error_code_value != FT_ERR_SUCCESS)
-        return (error_code_value);
-    entry_index = 0;
-    while (entry_index < rule_count)
+    source = text.c_str();
+    text_length = text.size();
+    emitted_index = 0;
+    match_start = 0;
+    match_length = 0;
+    match_rule = 0;
+    while (logger_redaction_find(snapshot, source, text_length, emitted_index,
+            &match_start, &match_length, &match_rule))
     {
-        int32_t             apply_error;
-
-        const s_redaction_rule &source_rule = rules[entry_index];
-        error_code_value = rules.get_error();
+        error_code_value = logger_redaction_emit(redacted, source, emitted_index,
+                match_start, snapshot->replacements[match_rule],
+                snapshot->replacement_lengths[match_rule]);
         if (error_code_value != FT_ERR_SUCCESS)
             return (error_code_value);
-        apply_error = logger_apply_redaction_rule(text, source_rule);
-        if (apply_error != FT_ERR_SUCCESS)
-            return (apply_error);
-        entry_index++;
+        emitted_index = match_start + match_length;
     }
-    error_code_value = FT_ERR_SUCCESS;
-    return (error_code_value);
+    if (!redacted.is_initialised())
+        return (FT_ERR_SUCCESS);
+    error_code_value = redacted.append(source + emitted_index, text_length - emitted_index);
+    if (error_code_value != FT_ERR_SUCCESS)
+        return (error_code_value);
+    error_code_value = text.destroy();
+    if (error_code_value != FT_ERR_SUCCESS)
+        return (error_code_value);
+    error_code_value = text.initialize(redacted);
+    if (error_code_value != FT_ERR_SUCCESS)
+        return (error_code_value);
+    return (FT_ERR_SUCCESS);
+}
+
+// Rewrites text inside its own buffer. The first pass only sizes the result;
+// the second moves the text to the end of the buffer and writes the redacted
+// form from the front, which never overtakes the unread input because the
+// first pass checked that every prefix fits in the spare capacity.
+int32_t logger_apply_redactions_in_place(const s_log_redaction_snapshot *snapshot,
+    char *text, ft_size_t *text_length, ft_size_t capacity)
+{
+    const char *source;
+    ft_size_t length;
+    ft_size_t spare;
+    ft_size_t scan_index;
+    ft_size_t output_length;
+    ft_size_t match_start;
+    ft_size_t match_length;
+    uint32_t match_rule;
+
+    if (snapshot == ft_nullptr)
+        return (FT_ERR_SUCCESS);
+    if (text == ft_nullptr || text_length == ft_nullptr || *text_length >= capacity)
+        return (FT_ERR_INVALID_ARGUMENT);
+    length = *text_length;
+    spare = capacity - 1 - length;
+    scan_index = 0;
+    output_length = 0;
+    match_start = 0;
+    match_length = 0;
+    match_rule = 0;
+    while (logger_redaction_find(snapshot, text, length, scan_index,
+            &match_start, &match_length, &match_rule))
+    {
+        output_length += match_start - scan_index
+            + snapshot->replacement_lengths[match_rule];
+        scan_index = match_start + match_length;
+        if (output_length > scan_index + spare)
+            return (FT_ERR_OUT_OF_RANGE);
+    }
+    if (scan_index == 0)
+        return (FT_ERR_SUCCESS);
+    ft_memmove(text + spare, text, length);
+    source = text + spare;
+    scan_index = 0;
+    output_length = 0;
+    while (logger_redaction_find(snapshot, source, length, scan_index,
+            &match_start, &match_length, &match_rule))
+    {
+        ft_memmove(text + output_length, source + scan_index, match_start - scan_index);
+        output_length += match_start - scan_index;
+        ft_memcpy(text + output_length, snapshot->replacements[match_rule],
+            snapshot->replacement_lengths[match_rule]);
+        output_length += snapshot->replacement_lengths[match_rule];
+        scan_index = match_start + match_length;
+    }
+    ft_memmove(text + output_length, source + scan_index, length - scan_index);
+    output_length += length - scan_index;
+    text[output_length] = '\0';
+    *text_length = output_length;
+    return (FT_ERR_SUCCESS);
 }
@@ -83,6 +83,7 @@ void ft_log_remove_sink(t_log_sink sink, void *user_data)
                 }
                 return ;
             }
+            (void)logger_flush_sink_entry(&locked_entry);
             if (sink_lock_acquired)
                 log_sink_unlock(&locked_entry, sink_lock_acquired);
             log_sink_teardown_thread_safety(&locked_entry);
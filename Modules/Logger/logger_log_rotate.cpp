@@ -93,6 +93,7 @@ static int32_t logger_prepare_rotation_internal(s_file_sink *sink,
     metadata_error = cmp_file_get_size(sink->path.c_str(), &file_size, ft_nullptr);
     if (metadata_error != FT_ERR_SUCCESS)
         return (FT_ERR_INTERNAL);
+    file_size += sink->batch.size;
     retention_count = sink->retention_count;
     if (retention_count > 1024)
         retention_count = 0;
@@ -161,6 +162,7 @@ void logger_execute_rotation(s_file_sink *sink)
         return ;
     if (lock_acquired)
         should_unlock = FT_TRUE;
+    (void)logger_file_sink_flush_locked(sink);
     retention_count = sink->retention_count;
     reopen_flags = O_CREAT | O_WRONLY | O_APPEND;
     if (retention_count > 0)
@@ -12,34 +12,19 @@
 int32_t ft_file_sink(const char *message, void *user_data)
 {
     s_file_sink *sink;
-    ft_size_t length;
-    ft_size_t total_written;
     ft_bool lock_acquired;
-    int64_t write_result;
+    int32_t write_error;
 
     sink = static_cast<s_file_sink *>(user_data);
-    if (!sink)
+    if (!sink || !message)
         return (FT_ERR_INVALID_ARGUMENT);
     lock_acquired = FT_FALSE;
     if (file_sink_lock(sink, &lock_acquired) != 0)
         return (FT_ERR_INTERNAL);
-    length = ft_strlen(message);
-    total_written = 0;
-    while (total_written < length)
-    {
-        write_result = su_write(sink->file_descriptor, message + total_written,
-                length - total_written);
-        if (write_result <= 0)
-        {
-            if (lock_acquired)
-                file_sink_unlock(sink, lock_acquired);
-            return (FT_ERR_IO);
-        }
-        total_written += static_cast<ft_size_t>(write_result);
-    }
+    write_error = logger_file_sink_write_locked(sink, message, ft_strlen_size_t(message));
     if (lock_acquired)
         file_sink_unlock(sink, lock_acquired);
-    return (FT_ERR_SUCCESS);
+    return (write_error);
 }
 
 static int32_t log_set_file_report(int32_t return_value)
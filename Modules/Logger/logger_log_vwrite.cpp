@@ -65,6 +65,14 @@ static int32_t logger_append_quoted_token(ft_string &buffer, const char *value)
 
 int32_t logger_build_standard_message(t_log_level level, const ft_string &message_text,
     const ft_string &context_fragment, ft_string &formatted_message)
+{
+    return (logger_build_standard_message_at(level, time_now(), message_text,
+            context_fragment, formatted_message));
+}
+
+int32_t logger_build_standard_message_at(t_log_level level, t_time timestamp_value,
+    const ft_string &message_text, const ft_string &context_fragment,
+    ft_string &formatted_message)
 {
     ft_string *timestamp;
     ft_string assembled;
@@ -73,7 +81,7 @@ int32_t logger_build_standard_message(t_log_level level, const ft_string &messag
     char severity_buffer[16];
     int32_t severity_length;
 
-    timestamp = time_format_iso8601(time_now());
+    timestamp = time_format_iso8601(timestamp_value);
     if (timestamp == ft_nullptr)
         return (FT_ERR_INTERNAL);
     string_error = timestamp->get_error();
@@ -133,9 +141,124 @@ int32_t logger_build_standard_message(t_log_level level, const ft_string &messag
     return (FT_ERR_SUCCESS);
 }
 
+int32_t logger_line_append(s_log_line_buffer *line, const char *text,
+    ft_size_t text_length)
+{
+    if (!line || !text)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (line->length >= line->capacity
+        || text_length >= line->capacity - line->length)
+        return (FT_ERR_OUT_OF_RANGE);
+    ft_memcpy(line->data + line->length, text, text_length);
+    line->length += text_length;
+    line->data[line->length] = '\0';
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t logger_line_append_quoted(s_log_line_buffer *line, const char *value)
+{
+    ft_size_t entry_index;
+    ft_size_t run_start;
+    ft_size_t escape_length;
+    int32_t append_error;
+    char escape_buffer[4];
+    static const char hex_digits[] = "0123456789ABCDEF";
+
+    if (!value)
+        return (FT_ERR_INVALID_ARGUMENT);
+    append_error = logger_line_append(line, "\"", 1);
+    entry_index = 0;
+    run_start = 0;
+    while (append_error == FT_ERR_SUCCESS && value[entry_index] != '\0')
+    {
+        unsigned char character;
+
+        character = static_cast<unsigned char>(value[entry_index]);
+        escape_buffer[0] = '\\';
+        if (character == '"' || character == '\\')
+        {
+            escape_buffer[1] = static_cast<char>(character);
+            escape_length = 2;
+        }
+        else if (character < 0x20)
+        {
+            escape_buffer[1] = 'x';
+            escape_buffer[2] = hex_digits[(character >> 4) & 0x0F];
+            escape_buffer[3] = hex_digits[character & 0x0F];
+            escape_length = 4;
+        }
+        else
+        {
+            entry_index += 1;
+            continue ;
+        }
+        append_error = logger_line_append(line, value + run_start,
+                entry_index - run_start);
+        if (append_error == FT_ERR_SUCCESS)
+            append_error = logger_line_append(line, escape_buffer, escape_length);
+        entry_index += 1;
+        run_start = entry_index;
+    }
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, value + run_start,
+                entry_index - run_start);
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, "\"", 1);
+    return (append_error);
+}
+
+int32_t logger_build_standard_line(t_log_level level, const char *message_text,
+    s_log_line_buffer *line)
+{
+    char timestamp[32];
+    char severity_buffer[16];
+    ft_size_t timestamp_length;
+    ft_size_t severity_index;
+    uint32_t severity_value;
+    const char *level_name;
+    int32_t append_error;
+
+    if (!line || !message_text)
+        return (FT_ERR_INVALID_ARGUMENT);
+    timestamp_length = time_format_iso8601_buffer(timestamp, sizeof(timestamp),
+            time_now());
+    if (timestamp_length == 0)
+        return (FT_ERR_INTERNAL);
+    severity_value = static_cast<uint32_t>(ft_log_level_to_severity(level));
+    severity_index = sizeof(severity_buffer);
+    do
+    {
+        severity_index--;
+        severity_buffer[severity_index] = static_cast<char>('0' + severity_value % 10);
+        severity_value /= 10;
+    }
+    while (severity_value > 0);
+    level_name = ft_level_to_str(level);
+    append_error = logger_line_append(line, "time=", 5);
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, timestamp, timestamp_length);
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, " level=", 7);
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, level_name,
+                ft_strlen_size_t(level_name));
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, " severity=", 10);
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, severity_buffer + severity_index,
+                sizeof(severity_buffer) - severity_index);
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append(line, " message=", 9);
+    if (append_error == FT_ERR_SUCCESS)
+        append_error = logger_line_append_quoted(line, message_text);
+    return (append_error);
+}
+
 void ft_log_vwrite(t_log_level level, const char *format_string, va_list argument_list)
 {
-    ft_vector<s_redaction_rule> redaction_snapshot;
+    const s_log_redaction_snapshot *redaction_snapshot;
+    uint32_t redaction_epoch;
+    int32_t redaction_error;
     ft_string message_text;
     ft_string context_fragment;
     ft_string final_message;
@@ -145,7 +268,6 @@ void ft_log_vwrite(t_log_level level, const char *format_string, va_list argumen
     va_list args_copy;
     int32_t formatted_length;
     ft_size_t entry_index;
-    int32_t redaction_snapshot_initialize_error;
     int32_t context_fragment_initialize_error;
     int32_t final_message_initialize_error;
 
@@ -167,43 +289,35 @@ void ft_log_vwrite(t_log_level level, const char *format_string, va_list argumen
     final_message_initialize_error = final_message.initialize();
     if (final_message_initialize_error != FT_ERR_SUCCESS)
         return ;
-    redaction_snapshot_initialize_error = redaction_snapshot.initialize();
-    if (redaction_snapshot_initialize_error != FT_ERR_SUCCESS)
-        return ;
     if (logger_lock_sinks() != 0)
         return ;
     sink_count = g_sinks.size();
     use_color = FT_FALSE;
     if (g_use_color && sink_count == 0 && isatty(1))
         use_color = FT_TRUE;
-    if (logger_copy_redaction_rules(redaction_snapshot) != 0)
-    {
-        (void)logger_unlock_sinks();
-        return ;
-    }
     if (logger_unlock_sinks() != 0)
         return ;
-    if (logger_apply_redactions(message_text, redaction_snapshot) != 0)
-        return ;
     if (logger_context_format_flat(context_fragment) != 0)
         return ;
-    if (context_fragment.size() > 0)
-    {
-        if (logger_apply_redactions(context_fragment, redaction_snapshot) != 0)
-            return ;
-    }
+    redaction_epoch = 0;
+    redaction_snapshot = logger_redaction_read_lock(&redaction_epoch);
+    redaction_error = logger_apply_redactions(redaction_snapshot, message_text);
+    if (redaction_error == FT_ERR_SUCCESS && context_fragment.size() > 0)
+        redaction_error = logger_apply_redactions(redaction_snapshot, context_fragment);
+    logger_redaction_read_unlock(redaction_snapshot, redaction_epoch);
+    if (redaction_error != FT_ERR_SUCCESS)
+        return ;
     if (logger_build_standard_message(level, message_text, context_fragment,
             final_message) != 0)
         return ;
     (void)sink_record_message(static_cast<int32_t>(level), final_message.c_str());
     if (sink_count == 0)
     {
-        ssize_t    write_result;
+        const char *color_code;
 
+        color_code = ft_nullptr;
         if (use_color)
         {
-            const char *color_code;
-
             color_code = "\x1b[31m";
             if (level == LOG_LEVEL_DEBUG)
                 color_code = "\x1b[36m";
@@ -211,30 +325,9 @@ void ft_log_vwrite(t_log_level level, const char *format_string, va_list argumen
                 color_code = "\x1b[32m";
             else if (level == LOG_LEVEL_WARN)
                 color_code = "\x1b[33m";
-            write_result = write(1, color_code, ft_strlen(color_code));
-            if (write_result < 0)
-                return ;
-#if defined(_WIN32) || defined(_WIN64)
-            write_result = write(1, final_message.c_str(),
-                    static_cast<unsigned int>(final_message.size()));
-#else
-            write_result = write(1, final_message.c_str(), final_message.size());
-#endif
-            if (write_result < 0)
-                return ;
-            write_result = write(1, "\x1b[0m", 4);
-            if (write_result < 0)
-                return ;
-            return ;
         }
-#if defined(_WIN32) || defined(_WIN64)
-        write_result = write(1, final_message.c_str(),
-                static_cast<unsigned int>(final_message.size()));
-#else
-        write_result = write(1, final_message.c_str(), final_message.size());
-#endif
-        if (write_result < 0)
-            return ;
+        (void)logger_write_stdout(color_code, final_message.c_str(),
+            final_message.size());
         return ;
     }
     entry_index = 0;
@@ -288,6 +381,8 @@ void ft_log_vwrite(t_log_level level, const char *format_string, va_list argumen
                     || rotate_for_size_post || rotate_for_age_post)
                     logger_execute_rotation(file_sink);
             }
+            if (sink_result == FT_ERR_SUCCESS && level >= LOG_LEVEL_ERROR)
+                (void)logger_flush_sink_entry(&entry);
         }
         if (sink_lock_acquired)
             log_sink_unlock(&entry, sink_lock_acquired);
@@ -8,7 +8,9 @@ void ft_log_warn(const char *format_string, ...)
 {
     va_list argument_list;
     va_start(argument_list, format_string);
-    if (g_async_running)
+    if (g_binary_running)
+        ft_log_enqueue_binary(LOG_LEVEL_WARN, format_string, argument_list);
+    else if (g_async_running)
         ft_log_enqueue(LOG_LEVEL_WARN, format_string, argument_list);
     else
         ft_log_vwrite(LOG_LEVEL_WARN, format_string, argument_list);
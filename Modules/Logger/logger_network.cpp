@@ -89,9 +89,8 @@ int32_t ft_log_set_remote_sink(const char *host, uint16_t port, ft_bool use_tcp)
 int32_t ft_network_sink(const char *message, void *user_data)
 {
     s_network_sink *sink;
-    ft_size_t message_length;
-    ft_size_t total_bytes_sent;
     ft_bool   lock_acquired;
+    int32_t   write_error;
 
     sink = static_cast<s_network_sink *>(user_data);
     if (!sink || !message)
@@ -107,24 +106,13 @@ int32_t ft_network_sink(const char *message, void *user_data)
     {
         goto cleanup;
     }
-    message_length = ft_strlen(message);
-    total_bytes_sent = 0;
-    while (total_bytes_sent < message_length)
+    write_error = logger_network_sink_write_locked(sink, message,
+            ft_strlen_size_t(message));
+    if (write_error != FT_ERR_SUCCESS)
     {
-        ssize_t send_result;
-
-        send_result = sink->send_function(sink->socket_fd, message + total_bytes_sent, message_length - total_bytes_sent, 0);
-        if (send_result <= 0)
-        {
-            if (sink->socket_fd >= 0)
-                su_close(sink->socket_fd);
-            sink->socket_fd = -1;
-            sink->send_function = ft_nullptr;
-            if (lock_acquired)
-                network_sink_unlock(sink, lock_acquired);
-            return (FT_ERR_SOCKET_SEND_FAILED);
-        }
-        total_bytes_sent += static_cast<ft_size_t>(send_result);
+        if (lock_acquired)
+            network_sink_unlock(sink, lock_acquired);
+        return (write_error);
     }
 
 cleanup:
@@ -0,0 +1,91 @@
+#ifndef HTTP_PARSER_HPP
+#define HTTP_PARSER_HPP
+
+#include <cstdint>
+#include "../Basic/basic.hpp"
+#include "../Template/string_view.hpp"
+
+#define HTTP_PARSER_MODE_REQUEST 0
+#define HTTP_PARSER_MODE_RESPONSE 1
+#define HTTP_PARSER_MAX_HEADERS 64
+#define HTTP_PARSER_MAX_HEAD_SIZE 65536
+
+#define HTTP_PARSER_STATE_START_LINE 0
+#define HTTP_PARSER_STATE_HEADER_LINE 1
+#define HTTP_PARSER_STATE_BODY_LENGTH 2
+#define HTTP_PARSER_STATE_CHUNK_SIZE 3
+#define HTTP_PARSER_STATE_CHUNK_DATA 4
+#define HTTP_PARSER_STATE_CHUNK_DATA_END 5
+#define HTTP_PARSER_STATE_CHUNK_TRAILER 6
+#define HTTP_PARSER_STATE_BODY_UNTIL_CLOSE 7
+#define HTTP_PARSER_STATE_COMPLETE 8
+
+struct http_parser_span
+{
+    ft_size_t   offset;
+    ft_size_t   length;
+};
+
+struct http_parser_header
+{
+    http_parser_span    name;
+    http_parser_span    value;
+};
+
+struct http_parser
+{
+    int32_t             mode;
+    int32_t             state;
+    ft_size_t           parse_offset;
+    ft_size_t           line_start;
+    ft_size_t           max_body_size;
+    http_parser_span    method;
+    http_parser_span    target;
+    http_parser_span    version;
+    http_parser_span    reason;
+    int32_t             status_code;
+    ft_bool             http_1_1;
+    http_parser_header  headers[HTTP_PARSER_MAX_HEADERS];
+    uint32_t            header_count;
+    ft_size_t           head_length;
+    ft_bool             has_content_length;
+    ft_size_t           content_length;
+    ft_bool             chunked;
+    ft_bool             transfer_encoding;
+    ft_bool             keep_alive;
+    ft_bool             connection_close;
+    ft_bool             connection_keep_alive;
+    ft_bool             skip_body;
+    http_parser_span    body;
+    ft_size_t           body_discarded;
+    ft_size_t           chunk_remaining;
+};
+
+void    http_parser_init(http_parser *parser, int32_t mode);
+void    http_parser_reset(http_parser *parser);
+void    http_parser_set_max_body_size(http_parser *parser, ft_size_t max_body_size);
+void    http_parser_set_skip_body(http_parser *parser, ft_bool skip_body);
+int32_t http_parser_execute(http_parser *parser, char *buffer, ft_size_t buffer_size,
+            ft_bool *message_complete);
+int32_t http_parser_finish(http_parser *parser, ft_bool *message_complete);
+ft_bool http_parser_headers_complete(const http_parser *parser);
+ft_bool http_parser_message_complete(const http_parser *parser);
+ft_size_t http_parser_message_length(const http_parser *parser);
+void    http_parser_discard_body(http_parser *parser, char *buffer, ft_size_t *buffer_size);
+void    http_parser_consume_message(http_parser *parser, char *buffer, ft_size_t *buffer_size);
+ft_bool http_parser_span_equals(const char *buffer, const http_parser_span &span,
+            const char *token);
+const http_parser_header *http_parser_find_header(const http_parser *parser,
+            const char *buffer, const char *name);
+int32_t http_parser_view(const char *buffer, const http_parser_span &span,
+            ft_string_view<char> &view);
+int32_t http_parser_get_method(const http_parser *parser, const char *buffer,
+            ft_string_view<char> &view);
+int32_t http_parser_get_target(const http_parser *parser, const char *buffer,
+            ft_string_view<char> &view);
+int32_t http_parser_get_header(const http_parser *parser, const char *buffer,
+            const char *name, ft_string_view<char> &view);
+int32_t http_parser_get_body(const http_parser *parser, const char *buffer,
+            ft_string_view<char> &view);
+
+#endif
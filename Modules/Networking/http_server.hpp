@@ -7,6 +7,8 @@
 #include <atomic>
 #include <cstdint>
 
+struct http_server_worker;
+
 class ft_http_server
 {
 #ifdef LIBFT_TEST_BUILD
@@ -18,9 +20,14 @@ class ft_http_server
         ft_socket _server_socket;
         ft_bool _non_blocking;
         std::atomic<bool> _run_once_active;
+        std::atomic<bool> _stop_requested;
+        http_server_worker *_workers;
+        uint32_t _worker_count;
+        uint16_t _event_port;
         mutable pt_recursive_mutex *_mutex;
 
         int32_t run_once_locked();
+        int32_t stop_locked() noexcept;
 
     public:
         ft_http_server() noexcept;
@@ -40,6 +47,12 @@ class ft_http_server
         ft_bool is_thread_safe() const noexcept;
         int32_t start(const char *ip_address, uint16_t port, int32_t address_family = AF_INET, ft_bool non_blocking = FT_FALSE);
         int32_t run_once() noexcept;
+        int32_t start_event_driven(const char *ip_address, uint16_t port,
+            uint32_t worker_count, int32_t address_family = AF_INET) noexcept;
+        int32_t stop() noexcept;
+        ft_bool is_serving() const noexcept;
+        uint16_t get_port() const noexcept;
+        uint64_t get_request_count() const noexcept;
 };
 
 #endif
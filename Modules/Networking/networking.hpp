@@ -81,14 +81,58 @@ void networking_dns_destroy_cache_for_tests(void) noexcept;
 int32_t networking_check_ssl_after_send(SSL *ssl_connection);
 #endif
 
+#define EVENT_LOOP_EVENT_READ 0x01u
+#define EVENT_LOOP_EVENT_WRITE 0x02u
+#define EVENT_LOOP_EVENT_HUP 0x04u
+#define EVENT_LOOP_EVENT_EDGE_TRIGGERED 0x100u
+#define EVENT_LOOP_READY_EVENTS_MAXIMUM 4096
+#define EVENT_LOOP_MINIMUM_SLOT_CAPACITY 64
+
+struct event_loop;
+
+typedef void (*t_event_loop_callback)(event_loop *loop, int32_t socket_fd,
+    uint32_t ready_events, void *user_data);
+
+struct event_loop_registration
+{
+    int32_t                 socket_fd;
+    uint32_t                read_references;
+    uint32_t                write_references;
+    int32_t                 read_position;
+    int32_t                 write_position;
+    uint32_t                watch_events;
+    uint32_t                registered_events;
+    uint32_t                ready_events;
+    ft_bool                 dirty;
+    t_event_loop_callback   callback;
+    void                    *user_data;
+};
+
+struct event_loop_ready_event
+{
+    int32_t     socket_fd;
+    uint32_t    events;
+};
+
 struct event_loop
 {
     int32_t *read_file_descriptors;
     int32_t read_count;
+    int32_t read_capacity;
     int32_t *write_file_descriptors;
     int32_t write_count;
+    int32_t write_capacity;
     pt_mutex *mutex;
     ft_bool thread_safe_enabled;
+    int32_t backend_descriptor;
+    ft_bool backend_open;
+    event_loop_registration *registrations;
+    int32_t registration_count;
+    int32_t registration_capacity;
+    int32_t *dirty_descriptors;
+    int32_t dirty_count;
+    event_loop_ready_event *ready_events;
+    int32_t ready_capacity;
 };
 
 class udp_socket;
@@ -98,6 +142,10 @@ void event_loop_clear(event_loop *loop);
 int32_t event_loop_add_socket(event_loop *loop, int32_t socket_fd, ft_bool is_write);
 int32_t event_loop_remove_socket(event_loop *loop, int32_t socket_fd, ft_bool is_write);
 int32_t event_loop_run(event_loop *loop, int32_t timeout_milliseconds);
+int32_t event_loop_watch(event_loop *loop, int32_t socket_fd, uint32_t events,
+    t_event_loop_callback callback, void *user_data);
+int32_t event_loop_unwatch(event_loop *loop, int32_t socket_fd);
+void *event_loop_get_user_data(event_loop *loop, int32_t socket_fd);
 int32_t event_loop_prepare_thread_safety(event_loop *loop);
 void event_loop_teardown_thread_safety(event_loop *loop);
 int32_t event_loop_lock(event_loop *loop, ft_bool *lock_acquired);
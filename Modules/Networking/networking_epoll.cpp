@@ -1,11 +1,15 @@
 #include "networking.hpp"
+#include "networking_event_backend.hpp"
 #include "../CMA/CMA.hpp"
 #include "../Basic/class_nullptr.hpp"
 #include <unistd.h>
+#include <cerrno>
 #include <sys/epoll.h>
 #include "../Basic/limits.hpp"
 #include "../PThread/mutex.hpp"
 #include "../PThread/recursive_mutex.hpp"
+#include "../Errno/errno.hpp"
+#include "../Compatebility/compatebility_internal.hpp"
 
 int32_t nw_poll(int32_t *read_file_descriptors, int32_t read_count,
             int32_t *write_file_descriptors, int32_t write_count,
@@ -189,3 +193,141 @@ int32_t nw_poll(int32_t *read_file_descriptors, int32_t read_count,
     close(epoll_descriptor);
     return (ready_descriptors);
 }
+
+static uint32_t nw_event_backend_epoll_mask(uint32_t events)
+{
+    uint32_t epoll_events;
+
+    epoll_events = 0;
+    if (events & EVENT_LOOP_EVENT_READ)
+        epoll_events |= EPOLLIN;
+    if (events & EVENT_LOOP_EVENT_WRITE)
+        epoll_events |= EPOLLOUT;
+    if (events & EVENT_LOOP_EVENT_HUP)
+        epoll_events |= EPOLLRDHUP;
+    if (events & EVENT_LOOP_EVENT_EDGE_TRIGGERED)
+        epoll_events |= EPOLLET;
+    return (epoll_events);
+}
+
+int32_t nw_event_backend_open(event_loop *loop)
+{
+    int32_t epoll_descriptor;
+
+    if (loop->backend_open)
+        return (0);
+    epoll_descriptor = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_descriptor == -1)
+    {
+        (void)(cmp_map_system_error_to_ft(errno));
+        return (-1);
+    }
+    loop->backend_descriptor = epoll_descriptor;
+    loop->backend_open = FT_TRUE;
+    return (0);
+}
+
+void nw_event_backend_close(event_loop *loop)
+{
+    if (!loop->backend_open)
+        return ;
+    close(loop->backend_descriptor);
+    loop->backend_descriptor = -1;
+    loop->backend_open = FT_FALSE;
+    return ;
+}
+
+int32_t nw_event_backend_update(event_loop *loop, int32_t socket_fd,
+            uint32_t registered_events, uint32_t desired_events)
+{
+    epoll_event event;
+    int32_t operation;
+
+    if (nw_event_backend_open(loop) != 0)
+        return (-1);
+    event.events = nw_event_backend_epoll_mask(desired_events);
+    event.data.fd = socket_fd;
+    if (desired_events == 0)
+    {
+        if (epoll_ctl(loop->backend_descriptor, EPOLL_CTL_DEL, socket_fd, &event) == -1
+            && errno != ENOENT && errno != EBADF)
+        {
+            (void)(cmp_map_system_error_to_ft(errno));
+            return (-1);
+        }
+        return (0);
+    }
+    if (registered_events == 0)
+        operation = EPOLL_CTL_ADD;
+    else
+        operation = EPOLL_CTL_MOD;
+    if (epoll_ctl(loop->backend_descriptor, operation, socket_fd, &event) == 0)
+        return (0);
+    if (operation == EPOLL_CTL_ADD && errno == EEXIST)
+        operation = EPOLL_CTL_MOD;
+    else if (operation == EPOLL_CTL_MOD && errno == ENOENT)
+        operation = EPOLL_CTL_ADD;
+    else
+    {
+        (void)(cmp_map_system_error_to_ft(errno));
+        return (-1);
+    }
+    if (epoll_ctl(loop->backend_descriptor, operation, socket_fd, &event) == -1)
+    {
+        (void)(cmp_map_system_error_to_ft(errno));
+        return (-1);
+    }
+    return (0);
+}
+
+int32_t nw_event_backend_wait(event_loop *loop, int32_t timeout_milliseconds)
+{
+    epoll_event events[64];
+    int32_t maximum_events;
+    int32_t ready_count;
+    int32_t event_index;
+    int32_t total_ready;
+    uint32_t ready_events;
+
+    if (nw_event_backend_open(loop) != 0)
+        return (-1);
+    total_ready = 0;
+    while (total_ready < loop->ready_capacity)
+    {
+        maximum_events = loop->ready_capacity - total_ready;
+        if (maximum_events > 64)
+            maximum_events = 64;
+        ready_count = epoll_wait(loop->backend_descriptor, events, maximum_events,
+                timeout_milliseconds);
+        if (ready_count < 0)
+        {
+            if (errno == EINTR && total_ready == 0)
+                return (0);
+            if (total_ready > 0)
+                break ;
+            (void)(cmp_map_system_error_to_ft(errno));
+            return (-1);
+        }
+        event_index = 0;
+        while (event_index < ready_count)
+        {
+            ready_events = 0;
+            if (events[event_index].events & EPOLLIN)
+                ready_events |= EVENT_LOOP_EVENT_READ;
+            if (events[event_index].events & EPOLLOUT)
+                ready_events |= EVENT_LOOP_EVENT_WRITE;
+            if (events[event_index].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))
+                ready_events |= EVENT_LOOP_EVENT_HUP;
+            if (events[event_index].events & (EPOLLERR | EPOLLHUP))
+                ready_events |= EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_WRITE;
+            loop->ready_events[total_ready].socket_fd = events[event_index].data.fd;
+            loop->ready_events[total_ready].events = ready_events;
+            total_ready++;
+            event_index++;
+        }
+        if (ready_count < maximum_events)
+            break ;
+        timeout_milliseconds = 0;
+    }
+    return (total_ready);
+}
@@ -0,0 +1,12 @@
+#ifndef NETWORKING_EVENT_BACKEND_HPP
+#define NETWORKING_EVENT_BACKEND_HPP
+
+#include "networking.hpp"
+
+int32_t nw_event_backend_open(event_loop *loop);
+void    nw_event_backend_close(event_loop *loop);
+int32_t nw_event_backend_update(event_loop *loop, int32_t socket_fd,
+            uint32_t registered_events, uint32_t desired_events);
+int32_t nw_event_backend_wait(event_loop *loop, int32_t timeout_milliseconds);
+
+#endif
@@ -1,6 +1,7 @@
 #include <cstdlib>
 
 #include "networking.hpp"
+#include "networking_event_backend.hpp"
 #include "../CMA/CMA.hpp"
 #include "../Basic/class_nullptr.hpp"
 #include "../PThread/mutex.hpp"
@@ -18,10 +19,21 @@ void event_loop_init(event_loop *loop)
     }
     loop->read_file_descriptors = ft_nullptr;
     loop->read_count = 0;
+    loop->read_capacity = 0;
     loop->write_file_descriptors = ft_nullptr;
     loop->write_count = 0;
+    loop->write_capacity = 0;
     loop->mutex = ft_nullptr;
     loop->thread_safe_enabled = FT_FALSE;
+    loop->backend_descriptor = -1;
+    loop->backend_open = FT_FALSE;
+    loop->registrations = ft_nullptr;
+    loop->registration_count = 0;
+    loop->registration_capacity = 0;
+    loop->dirty_descriptors = ft_nullptr;
+    loop->dirty_count = 0;
+    loop->ready_events = ft_nullptr;
+    loop->ready_capacity = 0;
     if (event_loop_prepare_thread_safety(loop) != 0)
         return ;
     return ;
@@ -47,23 +59,289 @@ void event_loop_clear(event_loop *loop)
         loop->write_file_descriptors = ft_nullptr;
     }
     loop->read_count = 0;
+    loop->read_capacity = 0;
     loop->write_count = 0;
+    loop->write_capacity = 0;
+    nw_event_backend_close(loop);
+    if (loop->registrations)
+    {
+        cma_free(loop->registrations);
+        loop->registrations = ft_nullptr;
+    }
+    loop->registration_count = 0;
+    loop->registration_capacity = 0;
+    if (loop->dirty_descriptors)
+    {
+        cma_free(loop->dirty_descriptors);
+        loop->dirty_descriptors = ft_nullptr;
+    }
+    loop->dirty_count = 0;
+    if (loop->ready_events)
+    {
+        cma_free(loop->ready_events);
+        loop->ready_events = ft_nullptr;
+    }
+    loop->ready_capacity = 0;
     if (lock_result == 0)
         event_loop_unlock(loop, lock_acquired);
     event_loop_teardown_thread_safety(loop);
     return ;
 }
 
+static event_loop_registration *event_loop_find_registration_locked(
+            const event_loop *loop, int32_t socket_fd)
+{
+    event_loop_registration *registration;
+
+    if (socket_fd < 0 || socket_fd >= loop->registration_capacity)
+        return (ft_nullptr);
+    registration = &loop->registrations[socket_fd];
+    if (registration->socket_fd != socket_fd)
+        return (ft_nullptr);
+    return (registration);
+}
+
+static int32_t event_loop_reserve_slots_locked(event_loop *loop, int32_t socket_fd)
+{
+    event_loop_registration *new_registrations;
+    int32_t *new_dirty_descriptors;
+    int32_t new_capacity;
+    int32_t index;
+
+    if (socket_fd < loop->registration_capacity)
+        return (0);
+    new_capacity = loop->registration_capacity;
+    if (new_capacity < EVENT_LOOP_MINIMUM_SLOT_CAPACITY)
+        new_capacity = EVENT_LOOP_MINIMUM_SLOT_CAPACITY;
+    while (new_capacity <= socket_fd)
+    {
+        if (new_capacity > FT_INT32_MAX / 2)
+        {
+            new_capacity = FT_INT32_MAX;
+            break ;
+        }
+        new_capacity *= 2;
+    }
+    new_dirty_descriptors = static_cast<int32_t *>(cma_realloc(loop->dirty_descriptors,
+                sizeof(int32_t) * static_cast<ft_size_t>(new_capacity)));
+    if (!new_dirty_descriptors)
+    {
+        (void)(FT_ERR_NO_MEMORY);
+        return (-1);
+    }
+    loop->dirty_descriptors = new_dirty_descriptors;
+    new_registrations = static_cast<event_loop_registration *>(cma_realloc(
+                loop->registrations, sizeof(event_loop_registration)
+                * static_cast<ft_size_t>(new_capacity)));
+    if (!new_registrations)
+    {
+        (void)(FT_ERR_NO_MEMORY);
+        return (-1);
+    }
+    index = loop->registration_capacity;
+    while (index < new_capacity)
+    {
+        new_registrations[index].socket_fd = -1;
+        new_registrations[index].dirty = FT_FALSE;
+        index++;
+    }
+    loop->registrations = new_registrations;
+    loop->registration_capacity = new_capacity;
+    return (0);
+}
+
+static event_loop_registration *event_loop_acquire_registration_locked(
+            event_loop *loop, int32_t socket_fd)
+{
+    event_loop_registration *registration;
+
+    registration = event_loop_find_registration_locked(loop, socket_fd);
+    if (registration)
+        return (registration);
+    if (event_loop_reserve_slots_locked(loop, socket_fd) != 0)
+        return (ft_nullptr);
+    registration = &loop->registrations[socket_fd];
+    registration->socket_fd = socket_fd;
+    registration->read_references = 0;
+    registration->write_references = 0;
+    registration->read_position = -1;
+    registration->write_position = -1;
+    registration->watch_events = 0;
+    registration->registered_events = 0;
+    registration->ready_events = 0;
+    registration->callback = ft_nullptr;
+    registration->user_data = ft_nullptr;
+    loop->registration_count++;
+    return (registration);
+}
+
+static uint32_t event_loop_desired_events(const event_loop_registration *registration)
+{
+    uint32_t desired_events;
+
+    desired_events = registration->watch_events
+        & (EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_WRITE | EVENT_LOOP_EVENT_HUP);
+    if (registration->read_references > 0)
+        desired_events |= EVENT_LOOP_EVENT_READ;
+    if (registration->write_references > 0)
+        desired_events |= EVENT_LOOP_EVENT_WRITE;
+    if (desired_events != 0
+        && (registration->watch_events & EVENT_LOOP_EVENT_EDGE_TRIGGERED)
+        && registration->read_references == 0
+        && registration->write_references == 0)
+        desired_events |= EVENT_LOOP_EVENT_EDGE_TRIGGERED;
+    return (desired_events);
+}
+
+static void event_loop_update_registration_locked(event_loop *loop,
+            event_loop_registration *registration)
+{
+    if (event_loop_desired_events(registration) != 0)
+    {
+        if (!registration->dirty)
+        {
+            registration->dirty = FT_TRUE;
+            loop->dirty_descriptors[loop->dirty_count] = registration->socket_fd;
+            loop->dirty_count++;
+        }
+        return ;
+    }
+    if (registration->registered_events != 0)
+        (void)nw_event_backend_update(loop, registration->socket_fd,
+                registration->registered_events, 0);
+    registration->socket_fd = -1;
+    registration->registered_events = 0;
+    loop->registration_count--;
+    return ;
+}
+
+static int32_t event_loop_apply_changes_locked(event_loop *loop)
+{
+    event_loop_registration *registration;
+    uint32_t desired_events;
+    int32_t socket_fd;
+
+    while (loop->dirty_count > 0)
+    {
+        socket_fd = loop->dirty_descriptors[loop->dirty_count - 1];
+        registration = &loop->registrations[socket_fd];
+        if (registration->socket_fd == socket_fd)
+        {
+            desired_events = event_loop_desired_events(registration);
+            if (desired_events != registration->registered_events)
+            {
+                if (nw_event_backend_update(loop, socket_fd,
+                        registration->registered_events, desired_events) != 0)
+                    return (-1);
+                registration->registered_events = desired_events;
+            }
+        }
+        registration->dirty = FT_FALSE;
+        loop->dirty_count--;
+    }
+    return (0);
+}
+
+static int32_t event_loop_reserve_ready_events_locked(event_loop *loop)
+{
+    event_loop_ready_event *new_events;
+    int32_t required_capacity;
+
+    required_capacity = EVENT_LOOP_READY_EVENTS_MAXIMUM;
+    if (loop->registration_count < EVENT_LOOP_READY_EVENTS_MAXIMUM / 2)
+        required_capacity = loop->registration_count * 2;
+    if (loop->ready_capacity >= required_capacity)
+        return (0);
+    new_events = static_cast<event_loop_ready_event *>(cma_realloc(loop->ready_events,
+                sizeof(event_loop_ready_event) * static_cast<ft_size_t>(required_capacity)));
+    if (!new_events)
+    {
+        (void)(FT_ERR_NO_MEMORY);
+        return (-1);
+    }
+    loop->ready_events = new_events;
+    loop->ready_capacity = required_capacity;
+    return (0);
+}
+
+static void event_loop_mark_descriptor_array_locked(const event_loop *loop,
+            int32_t *descriptors, int32_t descriptor_count, uint32_t event_mask)
+{
+    const event_loop_registration *registration;
+    int32_t index;
+
+    index = 0;
+    while (index < descriptor_count)
+    {
+        if (descriptors[index] >= 0)
+        {
+            registration = event_loop_find_registration_locked(loop,
+                    descriptors[index]);
+            if (!registration || (registration->ready_events & event_mask) == 0)
+                descriptors[index] = -1;
+        }
+        index++;
+    }
+    return ;
+}
+
+static int32_t event_loop_remove_descriptor_locked(event_loop *loop,
+            int32_t *descriptors, int32_t *descriptor_count, int32_t socket_fd,
+            ft_bool is_write)
+{
+    event_loop_registration *registration;
+    event_loop_registration *moved_registration;
+    int32_t *position;
+    int32_t index;
+    int32_t last_index;
+
+    registration = event_loop_find_registration_locked(loop, socket_fd);
+    if (!registration)
+        return (-1);
+    if (is_write)
+        position = &registration->write_position;
+    else
+        position = &registration->read_position;
+    index = *position;
+    if (index < 0 || index >= *descriptor_count || descriptors[index] != socket_fd)
+    {
+        index = 0;
+        while (index < *descriptor_count && descriptors[index] != socket_fd)
+            index++;
+        if (index == *descriptor_count)
+            return (-1);
+    }
+    last_index = *descriptor_count - 1;
+    descriptors[index] = descriptors[last_index];
+    *descriptor_count = last_index;
+    *position = -1;
+    moved_registration = event_loop_find_registration_locked(loop, descriptors[index]);
+    if (index != last_index && moved_registration)
+    {
+        if (is_write && moved_registration->write_position == last_index)
+            moved_registration->write_position = index;
+        else if (!is_write && moved_registration->read_position == last_index)
+            moved_registration->read_position = index;
+    }
+    if (is_write && registration->write_references > 0)
+        registration->write_references--;
+    else if (!is_write && registration->read_references > 0)
+        registration->read_references--;
+    event_loop_update_registration_locked(loop, registration);
+    return (0);
+}
+
 int32_t event_loop_add_socket(event_loop *loop, int32_t socket_fd, ft_bool is_write)
 {
     int32_t  *new_array;
+    event_loop_registration *registration;
     int32_t **descriptor_array;
     int32_t  *descriptor_count;
-    int32_t   current_count;
+    int32_t  *descriptor_capacity;
+    int32_t   new_capacity;
     ft_bool  lock_acquired;
-    int32_t   result;
 
-    if (!loop)
+    if (!loop || socket_fd < 0)
     {
         (void)(FT_ERR_INVALID_ARGUMENT);
         return (-1);
@@ -77,37 +355,56 @@ int32_t event_loop_add_socket(event_loop *loop, int32_t socket_fd, ft_bool is_wr
     {
         descriptor_array = &loop->write_file_descriptors;
         descriptor_count = &loop->write_count;
+        descriptor_capacity = &loop->write_capacity;
     }
     else
     {
         descriptor_array = &loop->read_file_descriptors;
         descriptor_count = &loop->read_count;
+        descriptor_capacity = &loop->read_capacity;
     }
-    new_array = static_cast<int32_t *>(cma_realloc(*descriptor_array,
-                                               sizeof(int32_t) * (*descriptor_count + 1)));
-    if (!new_array)
+    if (*descriptor_count == *descriptor_capacity)
     {
-        (void)(FT_ERR_NO_MEMORY);
-        result = -1;
+        new_capacity = *descriptor_capacity * 2;
+        if (new_capacity == 0)
+            new_capacity = 8;
+        new_array = static_cast<int32_t *>(cma_realloc(*descriptor_array,
+                    sizeof(int32_t) * static_cast<ft_size_t>(new_capacity)));
+        if (!new_array)
+        {
+            event_loop_unlock(loop, lock_acquired);
+            (void)(FT_ERR_NO_MEMORY);
+            return (-1);
+        }
+        *descriptor_array = new_array;
+        *descriptor_capacity = new_capacity;
+    }
+    registration = event_loop_acquire_registration_locked(loop, socket_fd);
+    if (!registration)
+    {
+        event_loop_unlock(loop, lock_acquired);
+        return (-1);
+    }
+    (*descriptor_array)[*descriptor_count] = socket_fd;
+    if (is_write)
+    {
+        registration->write_references++;
+        registration->write_position = *descriptor_count;
     }
     else
     {
-        *descriptor_array = new_array;
-        current_count = *descriptor_count;
-        new_array[current_count] = socket_fd;
-        *descriptor_count = current_count + 1;
-        (void)(FT_ERR_SUCCESS);
-        result = 0;
+        registration->read_references++;
+        registration->read_position = *descriptor_count;
     }
+    *descriptor_count = *descriptor_count + 1;
+    event_loop_update_registration_locked(loop, registration);
     event_loop_unlock(loop, lock_acquired);
-    return (result);
+    (void)(FT_ERR_SUCCESS);
+    return (0);
 }
 
 int32_t event_loop_remove_socket(event_loop *loop, int32_t socket_fd, ft_bool is_write)
 {
-    int32_t  *descriptor_count;
-    int32_t  *descriptors;
-    int32_t   index;
     ft_bool  lock_acquired;
     int32_t   result;
 
@@ -122,45 +419,156 @@ int32_t event_loop_remove_socket(event_loop *loop, int32_t socket_fd, ft_bool is
     if (event_loop_lock(loop, &lock_acquired) != 0)
         return (-1);
     if (is_write)
+        result = event_loop_remove_descriptor_locked(loop,
+                loop->write_file_descriptors, &loop->write_count, socket_fd, FT_TRUE);
+    else
+        result = event_loop_remove_descriptor_locked(loop,
+                loop->read_file_descriptors, &loop->read_count, socket_fd, FT_FALSE);
+    event_loop_unlock(loop, lock_acquired);
+    if (result != 0)
     {
-        descriptors = loop->write_file_descriptors;
-        descriptor_count = &loop->write_count;
+        (void)(FT_ERR_INVALID_ARGUMENT);
+        return (-1);
     }
-    else
+    (void)(FT_ERR_SUCCESS);
+    return (0);
+}
+
+int32_t event_loop_run(event_loop *loop, int32_t timeout_milliseconds)
+{
+    int32_t  ready_count;
+    int32_t  unique_count;
+    int32_t  index;
+    uint32_t ready_events;
+    event_loop_registration *registration;
+    t_event_loop_callback callback;
+    void     *user_data;
+    ft_bool lock_acquired;
+
+    if (!loop)
     {
-        descriptors = loop->read_file_descriptors;
-        descriptor_count = &loop->read_count;
+        (void)(FT_ERR_INVALID_ARGUMENT);
+        return (-1);
     }
+    if (event_loop_prepare_thread_safety(loop) != 0)
+        return (-1);
+    lock_acquired = FT_FALSE;
+    if (event_loop_lock(loop, &lock_acquired) != 0)
+        return (-1);
+    if (loop->registration_count == 0)
+    {
+        event_loop_unlock(loop, lock_acquired);
+        (void)(FT_ERR_SUCCESS);
+        return (0);
+    }
+    if (event_loop_apply_changes_locked(loop) != 0
+        || event_loop_reserve_ready_events_locked(loop) != 0)
+    {
+        event_loop_unlock(loop, lock_acquired);
+        return (-1);
+    }
+    ready_count = nw_event_backend_wait(loop, timeout_milliseconds);
+    if (ready_count < 0)
+    {
+        event_loop_unlock(loop, lock_acquired);
+        return (-1);
+    }
+    unique_count = 0;
     index = 0;
-    while (index < *descriptor_count)
+    while (index < ready_count)
     {
-        if (descriptors[index] == socket_fd)
-            break ;
+        ready_events = loop->ready_events[index].events;
+        registration = event_loop_find_registration_locked(loop,
+                loop->ready_events[index].socket_fd);
+        if (registration)
+        {
+            if (registration->ready_events == 0)
+            {
+                loop->ready_events[unique_count].socket_fd = registration->socket_fd;
+                unique_count++;
+            }
+            registration->ready_events |= ready_events;
+        }
         index++;
     }
-    if (index == *descriptor_count)
+    event_loop_mark_descriptor_array_locked(loop, loop->read_file_descriptors,
+        loop->read_count, EVENT_LOOP_EVENT_READ);
+    event_loop_mark_descriptor_array_locked(loop, loop->write_file_descriptors,
+        loop->write_count, EVENT_LOOP_EVENT_WRITE);
+    index = 0;
+    while (index < unique_count)
     {
-        (void)(FT_ERR_INVALID_ARGUMENT);
-        result = -1;
+        registration = &loop->registrations[loop->ready_events[index].socket_fd];
+        loop->ready_events[index].events = registration->ready_events;
+        registration->ready_events = 0;
+        index++;
     }
-    else
+    event_loop_unlock(loop, lock_acquired);
+    index = 0;
+    while (index < unique_count)
     {
-        while (index + 1 < *descriptor_count)
+        if (event_loop_lock(loop, &lock_acquired) != 0)
+            return (-1);
+        callback = ft_nullptr;
+        user_data = ft_nullptr;
+        ready_events = 0;
+        registration = event_loop_find_registration_locked(loop,
+                loop->ready_events[index].socket_fd);
+        if (registration)
         {
-            descriptors[index] = descriptors[index + 1];
-            index++;
+            ready_events = loop->ready_events[index].events
+                & registration->watch_events
+                & (EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_WRITE
+                    | EVENT_LOOP_EVENT_HUP);
+            callback = registration->callback;
+            user_data = registration->user_data;
         }
-        *descriptor_count = *descriptor_count - 1;
-        (void)(FT_ERR_SUCCESS);
-        result = 0;
+        event_loop_unlock(loop, lock_acquired);
+        if (callback && ready_events != 0)
+            callback(loop, loop->ready_events[index].socket_fd, ready_events,
+                user_data);
+        index++;
+    }
+    (void)(FT_ERR_SUCCESS);
+    return (unique_count);
+}
+
+int32_t event_loop_watch(event_loop *loop, int32_t socket_fd, uint32_t events,
+    t_event_loop_callback callback, void *user_data)
+{
+    event_loop_registration *registration;
+    ft_bool lock_acquired;
+
+    if (!loop || socket_fd < 0 || !callback
+        || (events & (EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_WRITE
+                | EVENT_LOOP_EVENT_HUP)) == 0)
+    {
+        (void)(FT_ERR_INVALID_ARGUMENT);
+        return (-1);
+    }
+    if (event_loop_prepare_thread_safety(loop) != 0)
+        return (-1);
+    lock_acquired = FT_FALSE;
+    if (event_loop_lock(loop, &lock_acquired) != 0)
+        return (-1);
+    registration = event_loop_acquire_registration_locked(loop, socket_fd);
+    if (!registration)
+    {
+        event_loop_unlock(loop, lock_acquired);
+        return (-1);
     }
+    registration->watch_events = events;
+    registration->callback = callback;
+    registration->user_data = user_data;
+    event_loop_update_registration_locked(loop, registration);
     event_loop_unlock(loop, lock_acquired);
-    return (result);
+    (void)(FT_ERR_SUCCESS);
+    return (0);
 }
 
-int32_t event_loop_run(event_loop *loop, int32_t timeout_milliseconds)
+int32_t event_loop_unwatch(event_loop *loop, int32_t socket_fd)
 {
-    int32_t  poll_result;
+    event_loop_registration *registration;
     ft_bool lock_acquired;
 
     if (!loop)
@@ -173,11 +581,46 @@ int32_t event_loop_run(event_loop *loop, int32_t timeout_milliseconds)
     lock_acquired = FT_FALSE;
     if (event_loop_lock(loop, &lock_acquired) != 0)
         return (-1);
-    poll_result = nw_poll(loop->read_file_descriptors, loop->read_count,
-                          loop->write_file_descriptors, loop->write_count,
-                          timeout_milliseconds);
+    registration = event_loop_find_registration_locked(loop, socket_fd);
+    if (!registration || registration->callback == ft_nullptr)
+    {
+        event_loop_unlock(loop, lock_acquired);
+        (void)(FT_ERR_NOT_FOUND);
+        return (-1);
+    }
+    registration->watch_events = 0;
+    registration->callback = ft_nullptr;
+    registration->user_data = ft_nullptr;
+    event_loop_update_registration_locked(loop, registration);
     event_loop_unlock(loop, lock_acquired);
-    return (poll_result);
+    (void)(FT_ERR_SUCCESS);
+    return (0);
+}
+
+void *event_loop_get_user_data(event_loop *loop, int32_t socket_fd)
+{
+    const event_loop_registration *registration;
+    void *user_data;
+    ft_bool lock_acquired;
+
+    if (!loop)
+    {
+        (void)(FT_ERR_INVALID_ARGUMENT);
+        return (ft_nullptr);
+    }
+    lock_acquired = FT_FALSE;
+    if (event_loop_lock(loop, &lock_acquired) != 0)
+        return (ft_nullptr);
+    user_data = ft_nullptr;
+    registration = event_loop_find_registration_locked(loop, socket_fd);
+    if (registration)
+        user_data = registration->user_data;
+    event_loop_unlock(loop, lock_acquired);
+    if (!registration)
+        (void)(FT_ERR_NOT_FOUND);
+    else
+        (void)(FT_ERR_SUCCESS);
+    return (user_data);
 }
 
 int32_t event_loop_prepare_thread_safety(event_loop *loop)
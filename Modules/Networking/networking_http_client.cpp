@@ -2,6 +2,7 @@
 #include "http2_client.hpp"
 #include "socket_class.hpp"
 #include "networking.hpp"
+#include "http_parser.hpp"
 #include "ssl_wrapper.hpp"
 #include "openssl_support.hpp"
 
@@ -34,16 +35,15 @@
 
 struct http_stream_state
 {
-    ft_string           header_buffer;
     ft_string           headers;
-    int32_t                 status_code;
-    ft_bool                headers_ready;
-    ft_bool                keep_alive_allowed;
-    ft_bool                has_content_length;
-    ft_size_t              expected_body_length;
-    ft_size_t              received_body_length;
-    ft_bool                saw_chunked_encoding;
-    ft_bool                http_1_1;
+    http_parser         parser;
+    char                *buffer;
+    ft_size_t           buffer_size;
+    ft_size_t           buffer_capacity;
+    int32_t             status_code;
+    ft_bool             headers_ready;
+    ft_bool             message_complete;
+    ft_bool             parse_failed;
     http_response_handler handler;
 };
 
@@ -375,163 +375,6 @@ static int32_t http_client_pool_acquire_connection(const char *host, const char
     return (FT_ERR_SUCCESS);
 }
 
-static void http_client_trim_string(ft_string &value)
-{
-    ft_size_t start_index;
-    ft_size_t end_index;
-
-    start_index = 0;
-    while (start_index < value.size()
-        && ft_isspace(static_cast<unsigned char>(value[start_index])) != 0)
-        start_index++;
-    if (start_index > 0)
-        value.erase(0, start_index);
-    end_index = value.size();
-    while (end_index > 0
-        && ft_isspace(static_cast<unsigned char>(value[end_index - 1])) != 0)
-        end_index--;
-    if (end_index < value.size())
-        value.erase(end_index, value.size() - end_index);
-    return ;
-}
-
-static void http_client_to_lower(ft_string &value)
-{
-    ft_size_t index;
-    char *mutable_data;
-
-    index = 0;
-    mutable_data = value.data();
-    if (mutable_data == NULL)
-        return ;
-    while (index < value.size())
-    {
-        char character;
-
-        character = mutable_data[index];
-        if (character >= 'A' && character <= 'Z')
-            mutable_data[index] = static_cast<char>(character + 32);
-        index++;
-    }
-    return ;
-}
-
-static void http_client_parse_header_metadata(http_stream_state &state)
-{
-    const char  *header_data;
-    ft_size_t      header_limit;
-    ft_size_t      offset;
-    ft_string   status_prefix;
-    ft_string   header_name;
-    ft_string   header_value;
-    ft_string   lowered_value;
-
-    if (status_prefix.initialize() != FT_ERR_SUCCESS)
-        return ;
-    if (header_name.initialize() != FT_ERR_SUCCESS)
-        return ;
-    if (header_value.initialize() != FT_ERR_SUCCESS)
-        return ;
-    if (lowered_value.initialize() != FT_ERR_SUCCESS)
-        return ;
-
-    state.keep_alive_allowed = FT_FALSE;
-    state.has_content_length = FT_FALSE;
-    state.expected_body_length = 0;
-    state.received_body_length = 0;
-    state.saw_chunked_encoding = FT_FALSE;
-    state.http_1_1 = FT_FALSE;
-    header_limit = state.headers.size();
-    header_data = state.headers.c_str();
-    if (header_limit >= 8)
-    {
-        status_prefix.assign(header_data, 8);
-        if (status_prefix == "HTTP/1.1")
-        {
-            state.http_1_1 = FT_TRUE;
-            state.keep_alive_allowed = FT_TRUE;
-        }
-    }
-    offset = 0;
-    while (offset < header_limit)
-    {
-        ft_size_t line_length;
-        const char *line_start;
-        ft_size_t colon_index;
-
-        line_start = header_data + offset;
-        line_length = 0;
-        while (offset + line_length + 1 < header_limit)
-        {
-            if (line_start[line_length] == '\r'
-                && line_start[line_length + 1] == '\n')
-                break ;
-            line_length++;
-        }
-        if (offset + line_length + 1 >= header_limit)
-            break ;
-        offset += line_length + 2;
-        if (line_length == 0)
-            continue ;
-        colon_index = 0;
-        while (colon_index < line_length && line_start[colon_index] != ':')
-            colon_index++;
-        if (colon_index >= line_length)
-            continue ;
-        header_name.clear();
-        header_value.clear();
-        lowered_value.clear();
-        header_name.assign(line_start, colon_index);
-        header_value.assign(line_start + colon_index + 1, line_length - colon_index - 1);
-        http_client_trim_string(header_name);
-        http_client_trim_string(header_value);
-        http_client_to_lower(header_name);
-        if (header_name == "connection")
-        {
-            lowered_value = header_value;
-            http_client_to_lower(lowered_value);
-            if (lowered_value.find("close") != ft_string::npos)
-                state.keep_alive_allowed = FT_FALSE;
-            else if (lowered_value.find("keep-alive") != ft_string::npos)
-                state.keep_alive_allowed = FT_TRUE;
-            continue ;
-        }
-        if (header_name == "content-length")
-        {
-            ft_size_t digit_index;
-            uint64_t parsed_length;
-
-            digit_index = 0;
-            parsed_length = 0;
-            while (digit_index < header_value.size()
-                && ft_isdigit(static_cast<unsigned char>(header_value[digit_index])) != 0)
-            {
-                parsed_length = (parsed_length * 10)
-                    + static_cast<uint64_t>(header_value[digit_index] - '0');
-                digit_index++;
-            }
-            state.has_content_length = FT_TRUE;
-            state.expected_body_length = static_cast<ft_size_t>(parsed_length);
-            continue ;
-        }
-        if (header_name == "transfer-encoding")
-        {
-            lowered_value = header_value;
-            http_client_to_lower(lowered_value);
-            if (lowered_value.find("chunked") != ft_string::npos)
-            {
-                state.saw_chunked_encoding = FT_TRUE;
-                state.keep_alive_allowed = FT_FALSE;
-            }
-        }
-    }
-    if (state.has_content_length == FT_FALSE)
-        state.keep_alive_allowed = FT_FALSE;
-    if (state.saw_chunked_encoding != FT_FALSE)
-        state.keep_alive_allowed = FT_FALSE;
-    return ;
-}
-
 void http_client_pool_flush(void)
 {
     int32_t lock_error;
@@ -950,155 +793,115 @@ int32_t http_client_send_ssl_request(SSL *ssl_connection, const char *buffer, ft
 
 static int32_t http_client_stream_state_init(http_stream_state &state, http_response_handler handler)
 {
-    if (state.header_buffer.initialize() != FT_ERR_SUCCESS)
-        return (FT_ERR_NO_MEMORY);
     if (state.headers.initialize() != FT_ERR_SUCCESS)
-    {
-        (void)state.header_buffer.destroy();
         return (FT_ERR_NO_MEMORY);
-    }
+    http_parser_init(&state.parser, HTTP_PARSER_MODE_RESPONSE);
+    state.buffer = ft_nullptr;
+    state.buffer_size = 0;
+    state.buffer_capacity = 0;
     state.status_code = 0;
     state.headers_ready = FT_FALSE;
-    state.keep_alive_allowed = FT_FALSE;
-    state.has_content_length = FT_FALSE;
-    state.expected_body_length = 0;
-    state.received_body_length = 0;
-    state.saw_chunked_encoding = FT_FALSE;
-    state.http_1_1 = FT_FALSE;
+    state.message_complete = FT_FALSE;
+    state.parse_failed = FT_FALSE;
     state.handler = handler;
     return (FT_ERR_SUCCESS);
 }
 
-static int32_t http_client_parse_status(const ft_string &headers)
+static void http_client_stream_state_release(http_stream_state &state)
 {
-    const char  *header_cstr;
-    ft_size_t      index;
+    if (state.buffer != ft_nullptr)
+        cma_free(state.buffer);
+    state.buffer = ft_nullptr;
+    state.buffer_size = 0;
+    state.buffer_capacity = 0;
+    return ;
+}
 
-    header_cstr = headers.c_str();
-    index = 0;
-    while (header_cstr[index] != '\0' && header_cstr[index] != ' ')
-        index++;
-    while (header_cstr[index] == ' ')
-        index++;
-    if (header_cstr[index] == '\0')
-        return (0);
-    return (ft_atoi(header_cstr + index));
+static int32_t http_client_stream_reserve(http_stream_state &state, ft_size_t additional)
+{
+    char *new_buffer;
+    ft_size_t new_capacity;
+
+    if (state.buffer_size + additional + 1 <= state.buffer_capacity)
+        return (FT_ERR_SUCCESS);
+    new_capacity = state.buffer_capacity;
+    if (new_capacity < 4096)
+        new_capacity = 4096;
+    while (new_capacity < state.buffer_size + additional + 1)
+        new_capacity *= 2;
+    new_buffer = static_cast<char *>(cma_realloc(state.buffer, new_capacity));
+    if (new_buffer == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    state.buffer = new_buffer;
+    state.buffer_capacity = new_capacity;
+    return (FT_ERR_SUCCESS);
 }
 
-static int32_t http_client_stream_handle_header(http_stream_state &state)
+static void http_client_stream_deliver_body(http_stream_state &state)
 {
-    const char  *terminator;
-    ft_size_t      header_length;
-    ft_size_t      body_length;
+    char *body_pointer;
+    char saved_character;
 
-    terminator = ft_strstr(state.header_buffer.c_str(), "\r\n\r\n");
-    if (terminator == NULL)
-        return (0);
-    header_length = static_cast<ft_size_t>(terminator - state.header_buffer.c_str()) + 4;
-    state.headers = state.header_buffer;
-    if (state.headers.size() > header_length)
-        state.headers.erase(header_length, state.headers.size() - header_length);
-    state.status_code = http_client_parse_status(state.headers);
-    http_client_parse_header_metadata(state);
-    body_length = state.header_buffer.size() - header_length;
-    if (body_length > 0 && state.handler != NULL)
-    {
-        const char *body_ptr;
-        ft_size_t deliver_length;
+    if (state.parser.body.length == 0)
+        return ;
+    body_pointer = state.buffer + state.parser.body.offset;
+    saved_character = body_pointer[state.parser.body.length];
+    body_pointer[state.parser.body.length] = '\0';
+    state.handler(state.status_code, state.headers, body_pointer,
+        state.parser.body.length, FT_FALSE);
+    body_pointer[state.parser.body.length] = saved_character;
+    http_parser_discard_body(&state.parser, state.buffer, &state.buffer_size);
+    return ;
+}
 
-        body_ptr = state.header_buffer.c_str() + header_length;
-        deliver_length = body_length;
-        if (state.has_content_length != FT_FALSE)
-        {
-            ft_size_t remaining_bytes;
+static void http_client_stream_process(http_stream_state &state)
+{
+    int32_t parse_error;
 
-            if (state.expected_body_length > state.received_body_length)
-                remaining_bytes = state.expected_body_length - state.received_body_length;
-            else
-                remaining_bytes = 0;
-            if (deliver_length > remaining_bytes)
-            {
-                deliver_length = remaining_bytes;
-                state.keep_alive_allowed = FT_FALSE;
-            }
-            state.received_body_length += deliver_length;
-        }
-        if (deliver_length > 0)
-            state.handler(state.status_code, state.headers, body_ptr, deliver_length, FT_FALSE);
-        if (deliver_length < body_length)
-            state.keep_alive_allowed = FT_FALSE;
+    parse_error = http_parser_execute(&state.parser, state.buffer, state.buffer_size,
+            &state.message_complete);
+    if (parse_error != FT_ERR_SUCCESS)
+    {
+        state.parse_failed = FT_TRUE;
+        return ;
+    }
+    if (state.headers_ready == FT_FALSE
+        && http_parser_headers_complete(&state.parser) != FT_FALSE)
+    {
+        state.headers.assign(state.buffer, state.parser.head_length);
+        state.status_code = state.parser.status_code;
+        state.headers_ready = FT_TRUE;
     }
-    state.header_buffer.clear();
-    state.headers_ready = FT_TRUE;
-    return (1);
+    if (state.headers_ready != FT_FALSE)
+        http_client_stream_deliver_body(state);
+    return ;
 }
 
-static int32_t http_client_receive_stream(http_client_active_connection &connection,
-    http_response_handler handler, ft_bool &allow_keep_alive)
+static int32_t http_client_receive_stream_data(http_client_active_connection &connection,
+    http_stream_state &state)
 {
-    char                buffer[1024];
     ssize_t             bytes_received;
-    http_stream_state   state;
     int32_t                 socket_fd;
     SSL                 *ssl_connection;
     ft_bool                use_ssl;
 
-    allow_keep_alive = FT_FALSE;
-    if (handler == NULL)
-    {
-        return (FT_ERR_INVALID_ARGUMENT);
-    }
-    if (http_client_stream_state_init(state, handler) != FT_ERR_SUCCESS)
-        return (FT_ERR_NO_MEMORY);
     socket_fd = connection.entry.socket_fd;
     ssl_connection = connection.entry.ssl_connection;
     use_ssl = connection.entry.use_ssl;
-    while (1)
+    while (state.message_complete == FT_FALSE && state.parse_failed == FT_FALSE)
     {
+        if (http_client_stream_reserve(state, 4096) != FT_ERR_SUCCESS)
+            return (FT_ERR_NO_MEMORY);
         if (use_ssl != FT_FALSE)
-            bytes_received = nw_ssl_read(ssl_connection, buffer, sizeof(buffer) - 1);
+            bytes_received = nw_ssl_read(ssl_connection, state.buffer + state.buffer_size,
+                    state.buffer_capacity - state.buffer_size - 1);
         else
-            bytes_received = nw_recv(socket_fd, buffer, sizeof(buffer) - 1, 0);
+            bytes_received = nw_recv(socket_fd, state.buffer + state.buffer_size,
+                    state.buffer_capacity - state.buffer_size - 1, 0);
         if (bytes_received > 0)
         {
-            buffer[bytes_received] = '\0';
-            if (state.headers_ready == FT_FALSE)
-            {
-                state.header_buffer.append(buffer, static_cast<ft_size_t>(bytes_received));
-                if (http_client_stream_handle_header(state) != 0)
-                {
-                    if (state.has_content_length != FT_FALSE
-                        && state.received_body_length >= state.expected_body_length)
-                        break ;
-                    continue ;
-                }
-            }
-            else
-            {
-                ft_size_t deliver_size;
-
-                deliver_size = static_cast<ft_size_t>(bytes_received);
-                if (state.has_content_length != FT_FALSE)
-                {
-                    ft_size_t remaining_bytes;
-
-                    if (state.expected_body_length > state.received_body_length)
-                        remaining_bytes = state.expected_body_length - state.received_body_length;
-                    else
-                        remaining_bytes = 0;
-                    if (deliver_size > remaining_bytes)
-                    {
-                        deliver_size = remaining_bytes;
-                        state.keep_alive_allowed = FT_FALSE;
-                    }
-                    state.received_body_length += deliver_size;
-                }
-                if (deliver_size > 0)
-                    state.handler(state.status_code, state.headers, buffer, deliver_size, FT_FALSE);
-            }
-            if (state.has_content_length != FT_FALSE
-                && state.received_body_length >= state.expected_body_length)
-                break ;
+            state.buffer_size += static_cast<ft_size_t>(bytes_received);
+            http_client_stream_process(state);
         }
         else
         {
@@ -1119,10 +922,7 @@ static int32_t http_client_receive_stream(http_client_active_connection &connect
                     continue ;
                 }
                 if (ssl_error == SSL_ERROR_ZERO_RETURN)
-                {
-                    state.keep_alive_allowed = FT_FALSE;
                     break ;
-                }
                 if (ssl_error == SSL_ERROR_SYSCALL)
                 {
 #ifdef _WIN32
@@ -1156,10 +956,8 @@ static int32_t http_client_receive_stream(http_client_active_connection &connect
                         continue ;
                     }
 #endif
-                    state.keep_alive_allowed = FT_FALSE;
                     return (FT_ERR_INVALID_OPERATION);
                 }
-                state.keep_alive_allowed = FT_FALSE;
                 return (FT_ERR_INVALID_OPERATION);
             }
             if (bytes_received < 0)
@@ -1199,28 +997,47 @@ static int32_t http_client_receive_stream(http_client_active_connection &connect
                 if (last_error == ECONNRESET)
                     break ;
 #endif
-                state.keep_alive_allowed = FT_FALSE;
                 return (FT_ERR_INVALID_OPERATION);
             }
-            state.keep_alive_allowed = FT_FALSE;
             break ;
         }
     }
-    if (state.headers_ready == FT_FALSE && state.header_buffer.empty() == FT_FALSE)
-    {
-        const char *body_ptr;
+    return (FT_ERR_SUCCESS);
+}
 
-        body_ptr = state.header_buffer.c_str();
-        state.handler(state.status_code, state.headers, body_ptr,
-            state.header_buffer.size(), FT_FALSE);
+static int32_t http_client_receive_stream(http_client_active_connection &connection,
+    http_response_handler handler, ft_bool &allow_keep_alive)
+{
+    http_stream_state   state;
+    int32_t             receive_result;
+
+    allow_keep_alive = FT_FALSE;
+    if (handler == NULL)
+    {
+        return (FT_ERR_INVALID_ARGUMENT);
+    }
+    if (http_client_stream_state_init(state, handler) != FT_ERR_SUCCESS)
+        return (FT_ERR_NO_MEMORY);
+    receive_result = http_client_receive_stream_data(connection, state);
+    if (receive_result != FT_ERR_SUCCESS)
+    {
+        http_client_stream_state_release(state);
+        return (receive_result);
+    }
+    if (state.message_complete == FT_FALSE && state.parse_failed == FT_FALSE
+        && http_parser_finish(&state.parser, &state.message_complete) == FT_ERR_SUCCESS)
+        http_client_stream_deliver_body(state);
+    if (state.headers_ready == FT_FALSE && state.buffer_size > 0)
+    {
+        state.buffer[state.buffer_size] = '\0';
+        state.handler(state.status_code, state.headers, state.buffer,
+            state.buffer_size, FT_FALSE);
     }
     state.handler(state.status_code, state.headers, "", 0, FT_TRUE);
-    if (state.headers_ready != FT_FALSE && state.keep_alive_allowed != FT_FALSE
-        && state.has_content_length != FT_FALSE
-        && state.received_body_length >= state.expected_body_length)
+    if (state.message_complete != FT_FALSE && state.parser.keep_alive != FT_FALSE
+        && state.buffer_size == http_parser_message_length(&state.parser))
         allow_keep_alive = FT_TRUE;
-    else
-        allow_keep_alive = FT_FALSE;
+    http_client_stream_state_release(state);
     return (FT_ERR_SUCCESS);
 }
 
@@ -1238,7 +1055,7 @@ static void http_client_buffering_adapter(int32_t status_code, const ft_string &
     }
     if (chunk_size > 0)
     {
-        g_http_buffer_adapter_state.response->append(body_chunk);
+        g_http_buffer_adapter_state.response->append(body_chunk, chunk_size);
         g_http_buffer_adapter_state.body_bytes += chunk_size;
     }
     if (finished != FT_FALSE && status_code != 0)
@@ -0,0 +1,703 @@
+#include "http_parser.hpp"
+#include "../Basic/limits.hpp"
+#include "../Errno/errno.hpp"
+
+#define HTTP_PARSER_MAX_CHUNK_LINE 1024
+
+static char http_parser_to_lower(char character)
+{
+    if (character >= 'A' && character <= 'Z')
+        return (static_cast<char>(character - 'A' + 'a'));
+    return (character);
+}
+
+static ft_bool http_parser_is_token_character(char character)
+{
+    if (ft_isalnum(static_cast<unsigned char>(character)) != 0)
+        return (FT_TRUE);
+    if (character != '\0' && ft_strchr("!#$%&'*+-.^_`|~", character) != ft_nullptr)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
+static ft_bool http_parser_bytes_equal(const char *data, ft_size_t length, const char *token)
+{
+    ft_size_t index;
+
+    index = 0;
+    while (index < length && token[index] != '\0')
+    {
+        if (http_parser_to_lower(data[index]) != http_parser_to_lower(token[index]))
+            return (FT_FALSE);
+        index++;
+    }
+    if (index != length || token[index] != '\0')
+        return (FT_FALSE);
+    return (FT_TRUE);
+}
+
+static int32_t http_parser_hex_value(char character)
+{
+    if (character >= '0' && character <= '9')
+        return (character - '0');
+    if (character >= 'a' && character <= 'f')
+        return (character - 'a' + 10);
+    if (character >= 'A' && character <= 'F')
+        return (character - 'A' + 10);
+    return (-1);
+}
+
+static void http_parser_clear_message(http_parser *parser)
+{
+    parser->state = HTTP_PARSER_STATE_START_LINE;
+    parser->parse_offset = 0;
+    parser->line_start = 0;
+    parser->method.offset = 0;
+    parser->method.length = 0;
+    parser->target.offset = 0;
+    parser->target.length = 0;
+    parser->version.offset = 0;
+    parser->version.length = 0;
+    parser->reason.offset = 0;
+    parser->reason.length = 0;
+    parser->status_code = 0;
+    parser->http_1_1 = FT_FALSE;
+    parser->header_count = 0;
+    parser->head_length = 0;
+    parser->has_content_length = FT_FALSE;
+    parser->content_length = 0;
+    parser->chunked = FT_FALSE;
+    parser->transfer_encoding = FT_FALSE;
+    parser->keep_alive = FT_FALSE;
+    parser->connection_close = FT_FALSE;
+    parser->connection_keep_alive = FT_FALSE;
+    parser->skip_body = FT_FALSE;
+    parser->body.offset = 0;
+    parser->body.length = 0;
+    parser->body_discarded = 0;
+    parser->chunk_remaining = 0;
+    return ;
+}
+
+void http_parser_init(http_parser *parser, int32_t mode)
+{
+    if (parser == ft_nullptr)
+        return ;
+    parser->mode = mode;
+    parser->max_body_size = FT_SYSTEM_SIZE_MAX;
+    http_parser_clear_message(parser);
+    return ;
+}
+
+void http_parser_reset(http_parser *parser)
+{
+    if (parser == ft_nullptr)
+        return ;
+    http_parser_clear_message(parser);
+    return ;
+}
+
+void http_parser_set_max_body_size(http_parser *parser, ft_size_t max_body_size)
+{
+    if (parser == ft_nullptr)
+        return ;
+    parser->max_body_size = max_body_size;
+    return ;
+}
+
+void http_parser_set_skip_body(http_parser *parser, ft_bool skip_body)
+{
+    if (parser == ft_nullptr)
+        return ;
+    parser->skip_body = skip_body;
+    return ;
+}
+
+static ft_bool http_parser_parse_version(const char *data, ft_size_t length,
+    ft_bool *http_1_1)
+{
+    if (length != 8 || ft_strncmp(data, "HTTP/1.", 7) != 0)
+        return (FT_FALSE);
+    if (data[7] == '1')
+        *http_1_1 = FT_TRUE;
+    else if (data[7] == '0')
+        *http_1_1 = FT_FALSE;
+    else
+        return (FT_FALSE);
+    return (FT_TRUE);
+}
+
+static int32_t http_parser_parse_request_line(http_parser *parser, const char *buffer,
+    ft_size_t line_offset, ft_size_t line_length)
+{
+    const char *line;
+    ft_size_t index;
+    ft_size_t target_start;
+
+    line = buffer + line_offset;
+    index = 0;
+    while (index < line_length && http_parser_is_token_character(line[index]) != FT_FALSE)
+        index++;
+    if (index == 0 || index >= line_length || line[index] != ' ')
+        return (FT_ERR_INVALID_ARGUMENT);
+    parser->method.offset = line_offset;
+    parser->method.length = index;
+    index++;
+    target_start = index;
+    while (index < line_length && line[index] != ' ')
+        index++;
+    if (index == target_start || index >= line_length)
+        return (FT_ERR_INVALID_ARGUMENT);
+    parser->target.offset = line_offset + target_start;
+    parser->target.length = index - target_start;
+    index++;
+    parser->version.offset = line_offset + index;
+    parser->version.length = line_length - index;
+    if (http_parser_parse_version(line + index, line_length - index,
+            &parser->http_1_1) == FT_FALSE)
+        return (FT_ERR_INVALID_ARGUMENT);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_parser_parse_status_line(http_parser *parser, const char *buffer,
+    ft_size_t line_offset, ft_size_t line_length)
+{
+    const char *line;
+    ft_size_t index;
+
+    line = buffer + line_offset;
+    if (line_length < 12 || line[8] != ' ')
+        return (FT_ERR_INVALID_ARGUMENT);
+    parser->version.offset = line_offset;
+    parser->version.length = 8;
+    if (http_parser_parse_version(line, 8, &parser->http_1_1) == FT_FALSE)
+        return (FT_ERR_INVALID_ARGUMENT);
+    parser->status_code = 0;
+    index = 9;
+    while (index < 12)
+    {
+        if (ft_isdigit(static_cast<unsigned char>(line[index])) == 0)
+            return (FT_ERR_INVALID_ARGUMENT);
+        parser->status_code = parser->status_code * 10 + (line[index] - '0');
+        index++;
+    }
+    if (line_length > 12 && line[12] != ' ')
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (line_length > 13)
+    {
+        parser->reason.offset = line_offset + 13;
+        parser->reason.length = line_length - 13;
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_parser_apply_content_length(http_parser *parser, const char *value,
+    ft_size_t value_length)
+{
+    ft_size_t parsed_length;
+    ft_size_t index;
+    ft_size_t digit_value;
+
+    if (value_length == 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+    parsed_length = 0;
+    index = 0;
+    while (index < value_length)
+    {
+        if (ft_isdigit(static_cast<unsigned char>(value[index])) == 0)
+            return (FT_ERR_INVALID_ARGUMENT);
+        digit_value = static_cast<ft_size_t>(value[index] - '0');
+        if (parsed_length > (FT_SYSTEM_SIZE_MAX - digit_value) / 10)
+            return (FT_ERR_OUT_OF_RANGE);
+        parsed_length = parsed_length * 10 + digit_value;
+        index++;
+    }
+    if (parser->has_content_length != FT_FALSE && parser->content_length != parsed_length)
+        return (FT_ERR_INVALID_ARGUMENT);
+    parser->has_content_length = FT_TRUE;
+    parser->content_length = parsed_length;
+    return (FT_ERR_SUCCESS);
+}
+
+static void http_parser_apply_token_list(http_parser *parser, const char *value,
+    ft_size_t value_length, ft_bool is_connection)
+{
+    ft_size_t index;
+    ft_size_t token_start;
+    ft_size_t token_end;
+
+    index = 0;
+    while (index < value_length)
+    {
+        while (index < value_length && (value[index] == ' ' || value[index] == '\t'
+                || value[index] == ','))
+            index++;
+        token_start = index;
+        while (index < value_length && value[index] != ',' && value[index] != ';')
+            index++;
+        token_end = index;
+        while (token_end > token_start
+            && (value[token_end - 1] == ' ' || value[token_end - 1] == '\t'))
+            token_end--;
+        while (index < value_length && value[index] != ',')
+            index++;
+        if (token_end == token_start)
+            continue ;
+        if (is_connection != FT_FALSE)
+        {
+            if (http_parser_bytes_equal(value + token_start, token_end - token_start,
+                    "close") != FT_FALSE)
+                parser->connection_close = FT_TRUE;
+            else if (http_parser_bytes_equal(value + token_start, token_end - token_start,
+                    "keep-alive") != FT_FALSE)
+                parser->connection_keep_alive = FT_TRUE;
+            continue ;
+        }
+        parser->transfer_encoding = FT_TRUE;
+        parser->chunked = http_parser_bytes_equal(value + token_start,
+                token_end - token_start, "chunked");
+    }
+    return ;
+}
+
+static int32_t http_parser_parse_header_line(http_parser *parser, const char *buffer,
+    ft_size_t line_offset, ft_size_t line_length)
+{
+    const char *line;
+    http_parser_header *header;
+    ft_size_t name_length;
+    ft_size_t value_start;
+    ft_size_t value_end;
+
+    line = buffer + line_offset;
+    name_length = 0;
+    while (name_length < line_length
+        && http_parser_is_token_character(line[name_length]) != FT_FALSE)
+        name_length++;
+    if (name_length == 0 || name_length >= line_length || line[name_length] != ':')
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (parser->header_count >= HTTP_PARSER_MAX_HEADERS)
+        return (FT_ERR_OUT_OF_RANGE);
+    value_start = name_length + 1;
+    while (value_start < line_length
+        && (line[value_start] == ' ' || line[value_start] == '\t'))
+        value_start++;
+    value_end = line_length;
+    while (value_end > value_start
+        && (line[value_end - 1] == ' ' || line[value_end - 1] == '\t'))
+        value_end--;
+    header = &parser->headers[parser->header_count];
+    header->name.offset = line_offset;
+    header->name.length = name_length;
+    header->value.offset = line_offset + value_start;
+    header->value.length = value_end - value_start;
+    parser->header_count++;
+    if (http_parser_bytes_equal(line, name_length, "content-length") != FT_FALSE)
+        return (http_parser_apply_content_length(parser, line + value_start,
+                value_end - value_start));
+    if (http_parser_bytes_equal(line, name_length, "transfer-encoding") != FT_FALSE)
+        http_parser_apply_token_list(parser, line + value_start,
+            value_end - value_start, FT_FALSE);
+    else if (http_parser_bytes_equal(line, name_length, "connection") != FT_FALSE)
+        http_parser_apply_token_list(parser, line + value_start,
+            value_end - value_start, FT_TRUE);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_parser_finish_head(http_parser *parser)
+{
+    parser->head_length = parser->parse_offset;
+    parser->body.offset = parser->parse_offset;
+    parser->body.length = 0;
+    parser->keep_alive = FT_FALSE;
+    if (parser->connection_close == FT_FALSE
+        && (parser->http_1_1 != FT_FALSE || parser->connection_keep_alive != FT_FALSE))
+        parser->keep_alive = FT_TRUE;
+    if (parser->mode == HTTP_PARSER_MODE_RESPONSE
+        && (parser->skip_body != FT_FALSE || parser->status_code < 200
+            || parser->status_code == 204 || parser->status_code == 304))
+    {
+        parser->state = HTTP_PARSER_STATE_COMPLETE;
+        return (FT_ERR_SUCCESS);
+    }
+    if (parser->transfer_encoding != FT_FALSE)
+    {
+        if (parser->chunked != FT_FALSE)
+        {
+            parser->has_content_length = FT_FALSE;
+            parser->content_length = 0;
+            parser->line_start = parser->parse_offset;
+            parser->state = HTTP_PARSER_STATE_CHUNK_SIZE;
+            return (FT_ERR_SUCCESS);
+        }
+        if (parser->mode == HTTP_PARSER_MODE_REQUEST)
+            return (FT_ERR_INVALID_ARGUMENT);
+        parser->has_content_length = FT_FALSE;
+        parser->keep_alive = FT_FALSE;
+        parser->state = HTTP_PARSER_STATE_BODY_UNTIL_CLOSE;
+        return (FT_ERR_SUCCESS);
+    }
+    if (parser->has_content_length != FT_FALSE)
+    {
+        if (parser->content_length > parser->max_body_size)
+            return (FT_ERR_OUT_OF_RANGE);
+        if (parser->content_length == 0)
+            parser->state = HTTP_PARSER_STATE_COMPLETE;
+        else
+            parser->state = HTTP_PARSER_STATE_BODY_LENGTH;
+        return (FT_ERR_SUCCESS);
+    }
+    if (parser->mode == HTTP_PARSER_MODE_REQUEST)
+    {
+        parser->state = HTTP_PARSER_STATE_COMPLETE;
+        return (FT_ERR_SUCCESS);
+    }
+    parser->keep_alive = FT_FALSE;
+    parser->state = HTTP_PARSER_STATE_BODY_UNTIL_CLOSE;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_parser_parse_chunk_size(http_parser *parser, const char *line,
+    ft_size_t line_length)
+{
+    ft_size_t index;
+    ft_size_t chunk_size;
+    int32_t digit_value;
+
+    index = 0;
+    chunk_size = 0;
+    while (index < line_length)
+    {
+        digit_value = http_parser_hex_value(line[index]);
+        if (digit_value < 0)
+            break ;
+        if (chunk_size > (FT_SYSTEM_SIZE_MAX >> 4))
+            return (FT_ERR_OUT_OF_RANGE);
+        chunk_size = (chunk_size << 4) | static_cast<ft_size_t>(digit_value);
+        index++;
+    }
+    if (index == 0)
+        return (FT_ERR_INVALID_ARGUMENT);
+    while (index < line_length && (line[index] == ' ' || line[index] == '\t'))
+        index++;
+    if (index < line_length && line[index] != ';')
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (chunk_size == 0)
+    {
+        parser->state = HTTP_PARSER_STATE_CHUNK_TRAILER;
+        return (FT_ERR_SUCCESS);
+    }
+    if (chunk_size > parser->max_body_size
+        || parser->body_discarded + parser->body.length
+            > parser->max_body_size - chunk_size)
+        return (FT_ERR_OUT_OF_RANGE);
+    parser->chunk_remaining = chunk_size;
+    parser->state = HTTP_PARSER_STATE_CHUNK_DATA;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_parser_handle_line(http_parser *parser, const char *buffer,
+    ft_size_t line_offset, ft_size_t line_length)
+{
+    if (parser->state == HTTP_PARSER_STATE_START_LINE)
+    {
+        if (line_length == 0)
+            return (FT_ERR_SUCCESS);
+        parser->state = HTTP_PARSER_STATE_HEADER_LINE;
+        if (parser->mode == HTTP_PARSER_MODE_RESPONSE)
+            return (http_parser_parse_status_line(parser, buffer, line_offset,
+                    line_length));
+        return (http_parser_parse_request_line(parser, buffer, line_offset, line_length));
+    }
+    if (parser->state == HTTP_PARSER_STATE_HEADER_LINE)
+    {
+        if (line_length == 0)
+            return (http_parser_finish_head(parser));
+        return (http_parser_parse_header_line(parser, buffer, line_offset, line_length));
+    }
+    if (parser->state == HTTP_PARSER_STATE_CHUNK_SIZE)
+        return (http_parser_parse_chunk_size(parser, buffer + line_offset, line_length));
+    if (parser->state == HTTP_PARSER_STATE_CHUNK_DATA_END)
+    {
+        if (line_length != 0)
+            return (FT_ERR_INVALID_ARGUMENT);
+        parser->state = HTTP_PARSER_STATE_CHUNK_SIZE;
+        return (FT_ERR_SUCCESS);
+    }
+    if (line_length == 0)
+        parser->state = HTTP_PARSER_STATE_COMPLETE;
+    return (FT_ERR_SUCCESS);
+}
+
+static ft_bool http_parser_state_reads_lines(int32_t state)
+{
+    if (state == HTTP_PARSER_STATE_START_LINE || state == HTTP_PARSER_STATE_HEADER_LINE
+        || state == HTTP_PARSER_STATE_CHUNK_SIZE
+        || state == HTTP_PARSER_STATE_CHUNK_DATA_END
+        || state == HTTP_PARSER_STATE_CHUNK_TRAILER)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
+static int32_t http_parser_read_line(http_parser *parser, char *buffer,
+    ft_size_t buffer_size, ft_bool *line_ready)
+{
+    const char *newline;
+    ft_size_t line_end;
+    ft_size_t line_offset;
+    ft_size_t line_length;
+
+    *line_ready = FT_FALSE;
+    newline = ft_nullptr;
+    if (parser->parse_offset < buffer_size)
+        newline = static_cast<const char *>(ft_memchr(buffer + parser->parse_offset,
+                    '\n', buffer_size - parser->parse_offset));
+    if (newline == ft_nullptr)
+    {
+        parser->parse_offset = buffer_size;
+        if (parser->state == HTTP_PARSER_STATE_START_LINE
+            || parser->state == HTTP_PARSER_STATE_HEADER_LINE)
+        {
+            if (buffer_size > HTTP_PARSER_MAX_HEAD_SIZE)
+                return (FT_ERR_OUT_OF_RANGE);
+        }
+        else if (buffer_size - parser->line_start > HTTP_PARSER_MAX_CHUNK_LINE)
+            return (FT_ERR_OUT_OF_RANGE);
+        return (FT_ERR_SUCCESS);
+    }
+    line_end = static_cast<ft_size_t>(newline - buffer);
+    line_length = line_end - parser->line_start;
+    if (line_length > 0 && buffer[line_end - 1] == '\r')
+        line_length--;
+    parser->parse_offset = line_end + 1;
+    if (parser->state == HTTP_PARSER_STATE_HEADER_LINE
+        && parser->parse_offset > HTTP_PARSER_MAX_HEAD_SIZE)
+        return (FT_ERR_OUT_OF_RANGE);
+    *line_ready = FT_TRUE;
+    line_offset = parser->line_start;
+    parser->line_start = parser->parse_offset;
+    return (http_parser_handle_line(parser, buffer, line_offset, line_length));
+}
+
+int32_t http_parser_execute(http_parser *parser, char *buffer, ft_size_t buffer_size,
+    ft_bool *message_complete)
+{
+    ft_bool line_ready;
+    ft_size_t available;
+    ft_size_t destination;
+    int32_t error_code;
+
+    if (message_complete != ft_nullptr)
+        *message_complete = FT_FALSE;
+    if (parser == ft_nullptr || (buffer == ft_nullptr && buffer_size != 0))
+        return (FT_ERR_INVALID_ARGUMENT);
+    while (parser->state != HTTP_PARSER_STATE_COMPLETE)
+    {
+        if (http_parser_state_reads_lines(parser->state) != FT_FALSE)
+        {
+            error_code = http_parser_read_line(parser, buffer, buffer_size, &line_ready);
+            if (error_code != FT_ERR_SUCCESS)
+                return (error_code);
+            if (line_ready == FT_FALSE)
+                return (FT_ERR_SUCCESS);
+            continue ;
+        }
+        if (parser->state == HTTP_PARSER_STATE_BODY_LENGTH)
+        {
+            available = buffer_size - parser->body.offset;
+            if (available > parser->content_length - parser->body_discarded)
+                available = parser->content_length - parser->body_discarded;
+            parser->body.length = available;
+            parser->parse_offset = parser->body.offset + available;
+            if (parser->body_discarded + available < parser->content_length)
+                return (FT_ERR_SUCCESS);
+            parser->state = HTTP_PARSER_STATE_COMPLETE;
+            continue ;
+        }
+        if (parser->state == HTTP_PARSER_STATE_CHUNK_DATA)
+        {
+            available = buffer_size - parser->parse_offset;
+            if (available > parser->chunk_remaining)
+                available = parser->chunk_remaining;
+            destination = parser->body.offset + parser->body.length;
+            if (destination != parser->parse_offset && available > 0)
+                ft_memmove(buffer + destination, buffer + parser->parse_offset, available);
+            parser->body.length += available;
+            parser->parse_offset += available;
+            parser->chunk_remaining -= available;
+            if (parser->chunk_remaining != 0)
+                return (FT_ERR_SUCCESS);
+            parser->line_start = parser->parse_offset;
+            parser->state = HTTP_PARSER_STATE_CHUNK_DATA_END;
+            continue ;
+        }
+        parser->body.length = buffer_size - parser->body.offset;
+        parser->parse_offset = buffer_size;
+        if (parser->body_discarded + parser->body.length > parser->max_body_size)
+            return (FT_ERR_OUT_OF_RANGE);
+        return (FT_ERR_SUCCESS);
+    }
+    if (message_complete != ft_nullptr)
+        *message_complete = FT_TRUE;
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t http_parser_finish(http_parser *parser, ft_bool *message_complete)
+{
+    if (message_complete != ft_nullptr)
+        *message_complete = FT_FALSE;
+    if (parser == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (parser->state == HTTP_PARSER_STATE_BODY_UNTIL_CLOSE)
+        parser->state = HTTP_PARSER_STATE_COMPLETE;
+    if (parser->state != HTTP_PARSER_STATE_COMPLETE)
+        return (FT_ERR_END_OF_FILE);
+    if (message_complete != ft_nullptr)
+        *message_complete = FT_TRUE;
+    return (FT_ERR_SUCCESS);
+}
+
+ft_bool http_parser_headers_complete(const http_parser *parser)
+{
+    if (parser == ft_nullptr)
+        return (FT_FALSE);
+    if (parser->state == HTTP_PARSER_STATE_START_LINE
+        || parser->state == HTTP_PARSER_STATE_HEADER_LINE)
+        return (FT_FALSE);
+    return (FT_TRUE);
+}
+
+ft_bool http_parser_message_complete(const http_parser *parser)
+{
+    if (parser == ft_nullptr || parser->state != HTTP_PARSER_STATE_COMPLETE)
+        return (FT_FALSE);
+    return (FT_TRUE);
+}
+
+ft_size_t http_parser_message_length(const http_parser *parser)
+{
+    if (parser == ft_nullptr)
+        return (0);
+    return (parser->parse_offset);
+}
+
+void http_parser_discard_body(http_parser *parser, char *buffer, ft_size_t *buffer_size)
+{
+    ft_size_t cut_offset;
+    ft_size_t removed_length;
+
+    if (parser == ft_nullptr || buffer_size == ft_nullptr
+        || http_parser_headers_complete(parser) == FT_FALSE)
+        return ;
+    if (http_parser_state_reads_lines(parser->state) != FT_FALSE)
+        cut_offset = parser->line_start;
+    else
+        cut_offset = parser->parse_offset;
+    if (cut_offset > *buffer_size)
+        cut_offset = *buffer_size;
+    removed_length = cut_offset - parser->body.offset;
+    if (removed_length == 0)
+        return ;
+    if (*buffer_size > cut_offset)
+        ft_memmove(buffer + parser->body.offset, buffer + cut_offset,
+            *buffer_size - cut_offset);
+    *buffer_size -= removed_length;
+    parser->parse_offset -= removed_length;
+    if (parser->line_start >= cut_offset)
+        parser->line_start -= removed_length;
+    parser->body_discarded += parser->body.length;
+    parser->body.length = 0;
+    return ;
+}
+
+void http_parser_consume_message(http_parser *parser, char *buffer, ft_size_t *buffer_size)
+{
+    ft_size_t message_length;
+
+    if (parser == ft_nullptr || buffer_size == ft_nullptr)
+        return ;
+    message_length = parser->parse_offset;
+    if (message_length > *buffer_size)
+        message_length = *buffer_size;
+    if (*buffer_size > message_length)
+        ft_memmove(buffer, buffer + message_length, *buffer_size - message_length);
+    *buffer_size -= message_length;
+    http_parser_clear_message(parser);
+    return ;
+}
+
+ft_bool http_parser_span_equals(const char *buffer, const http_parser_span &span,
+    const char *token)
+{
+    if (buffer == ft_nullptr || token == ft_nullptr)
+        return (FT_FALSE);
+    return (http_parser_bytes_equal(buffer + span.offset, span.length, token));
+}
+
+const http_parser_header *http_parser_find_header(const http_parser *parser,
+    const char *buffer, const char *name)
+{
+    uint32_t header_index;
+
+    if (parser == ft_nullptr || buffer == ft_nullptr || name == ft_nullptr)
+        return (ft_nullptr);
+    header_index = 0;
+    while (header_index < parser->header_count)
+    {
+        if (http_parser_span_equals(buffer, parser->headers[header_index].name, name)
+            != FT_FALSE)
+            return (&parser->headers[header_index]);
+        header_index++;
+    }
+    return (ft_nullptr);
+}
+
+int32_t http_parser_view(const char *buffer, const http_parser_span &span,
+    ft_string_view<char> &view)
+{
+    int32_t error_code;
+
+    if (buffer == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    error_code = view.destroy();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (view.initialize(buffer + span.offset, span.length));
+}
+
+int32_t http_parser_get_method(const http_parser *parser, const char *buffer,
+    ft_string_view<char> &view)
+{
+    if (parser == ft_nullptr || http_parser_headers_complete(parser) == FT_FALSE)
+        return (FT_ERR_INVALID_STATE);
+    return (http_parser_view(buffer, parser->method, view));
+}
+
+int32_t http_parser_get_target(const http_parser *parser, const char *buffer,
+    ft_string_view<char> &view)
+{
+    if (parser == ft_nullptr || http_parser_headers_complete(parser) == FT_FALSE)
+        return (FT_ERR_INVALID_STATE);
+    return (http_parser_view(buffer, parser->target, view));
+}
+
+int32_t http_parser_get_header(const http_parser *parser, const char *buffer,
+    const char *name, ft_string_view<char> &view)
+{
+    const http_parser_header *header;
+
+    if (parser == ft_nullptr || http_parser_headers_complete(parser) == FT_FALSE)
+        return (FT_ERR_INVALID_STATE);
+    header = http_parser_find_header(parser, buffer, name);
+    if (header == ft_nullptr)
+        return (FT_ERR_NOT_FOUND);
+    return (http_parser_view(buffer, header->value, view));
+}
+
+int32_t http_parser_get_body(const http_parser *parser, const char *buffer,
+    ft_string_view<char> &view)
+{
+    if (parser == ft_nullptr || http_parser_headers_complete(parser) == FT_FALSE)
+        return (FT_ERR_INVALID_STATE);
+    return (http_parser_view(buffer, parser->body, view));
+}
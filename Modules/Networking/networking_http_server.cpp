@@ -1,5 +1,6 @@
 #include "http_server.hpp"
 #include "networking.hpp"
+#include "http_parser.hpp"
 #include "../Basic/basic.hpp"
 #include "../Time/time.hpp"
 #include "../Observability/observability_networking_metrics.hpp"
@@ -7,6 +8,8 @@
 #include "../Printf/printf.hpp"
 #include "../System_utils/system_utils.hpp"
 #include "../Errno/errno_internal.hpp"
+#include "../Threading/thread.hpp"
+#include "../CMA/CMA.hpp"
 #include <cstring>
 #include <cstdio>
 #include <cerrno>
@@ -18,11 +21,16 @@
 #include "../PThread/recursive_mutex.hpp"
 #ifdef _WIN32
 # include <winsock2.h>
+# include <ws2tcpip.h>
+#else
+# include <netinet/in.h>
+# include <netinet/tcp.h>
 #endif
 
 ft_http_server::ft_http_server() noexcept
     : _initialised_state(FT_CLASS_STATE_UNINITIALISED), _server_socket(),
-      _non_blocking(FT_FALSE), _run_once_active(false), _mutex(ft_nullptr)
+      _non_blocking(FT_FALSE), _run_once_active(false), _stop_requested(false),
+      _workers(ft_nullptr), _worker_count(0), _event_port(0), _mutex(ft_nullptr)
 {
     return ;
 }
@@ -47,6 +55,10 @@ int32_t ft_http_server::initialize() noexcept
     this->_mutex = ft_nullptr;
     this->_non_blocking = FT_FALSE;
     this->_run_once_active.store(false);
+    this->_stop_requested.store(false);
+    this->_workers = ft_nullptr;
+    this->_worker_count = 0;
+    this->_event_port = 0;
     this->_initialised_state = FT_CLASS_STATE_INITIALISED;
     return (FT_ERR_SUCCESS);
 }
@@ -89,6 +101,7 @@ int32_t ft_http_server::destroy() noexcept
     if (this->_initialised_state == FT_CLASS_STATE_UNINITIALISED
         || this->_initialised_state == FT_CLASS_STATE_DESTROYED)
         return (FT_ERR_SUCCESS);
+    (void)this->stop();
     disable_error = this->disable_thread_safety();
     this->_run_once_active.store(false);
     if (disable_error != FT_ERR_SUCCESS)
@@ -174,27 +187,58 @@ int32_t ft_http_server::start(const char *ip_address, uint16_t port, int32_t add
     return (FT_ERR_SUCCESS);
 }
 
-static int32_t parse_request(const ft_string &request, ft_string &body, ft_bool &is_post)
+#define HTTP_SERVER_MAX_REQUEST_SIZE 65536
+
+static int32_t http_server_buffer_reserve(char **buffer, ft_size_t *capacity,
+    ft_size_t required_size)
 {
-    const char *request_data;
-    const char *body_separator;
+    char *new_buffer;
+    ft_size_t new_capacity;
 
-    request_data = request.c_str();
-    if (ft_strncmp(request_data, "POST ", 5) == 0)
-        is_post = FT_TRUE;
-    else if (ft_strncmp(request_data, "GET ", 4) == 0)
-        is_post = FT_FALSE;
-    else
-        return (FT_ERR_INVALID_ARGUMENT);
-    body_separator = ft_strstr(request_data, "\r\n\r\n");
-    if (body_separator)
+    if (required_size + 1 <= *capacity)
+        return (FT_ERR_SUCCESS);
+    new_capacity = *capacity;
+    if (new_capacity < 1024)
+        new_capacity = 1024;
+    while (new_capacity < required_size + 1)
+        new_capacity *= 2;
+    new_buffer = static_cast<char *>(cma_realloc(*buffer, new_capacity));
+    if (new_buffer == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    *buffer = new_buffer;
+    *capacity = new_capacity;
+    return (FT_ERR_SUCCESS);
+}
+
+static ft_bool http_server_method_is(const char *buffer, const http_parser_span &method,
+    const char *expected)
+{
+    ft_size_t expected_length;
+
+    expected_length = ft_strlen_size_t(expected);
+    if (method.length != expected_length)
+        return (FT_FALSE);
+    if (ft_strncmp(buffer + method.offset, expected, expected_length) != 0)
+        return (FT_FALSE);
+    return (FT_TRUE);
+}
+
+static int32_t http_server_classify_request(const http_parser *parser, const char *buffer,
+    ft_bool *is_post, const char **method_label)
+{
+    if (http_server_method_is(buffer, parser->method, "POST") != FT_FALSE)
     {
-        body_separator += 4;
-        body = body_separator;
+        *is_post = FT_TRUE;
+        *method_label = "POST";
+        return (FT_ERR_SUCCESS);
     }
-    else
-        body.clear();
-    return (FT_ERR_SUCCESS);
+    if (http_server_method_is(buffer, parser->method, "GET") != FT_FALSE)
+    {
+        *is_post = FT_FALSE;
+        *method_label = "GET";
+        return (FT_ERR_SUCCESS);
+    }
+    return (FT_ERR_INVALID_ARGUMENT);
 }
 
 static void http_server_record_metrics(const char *method, ft_size_t request_bytes,
@@ -233,100 +277,6 @@ static void http_server_record_metrics(const char *method, ft_size_t request_byt
     return ;
 }
 
-static char http_server_to_lower(char character)
-{
-    if (character >= 'A' && character <= 'Z')
-        return (static_cast<char>(character - 'A' + 'a'));
-    return (character);
-}
-
-static ft_bool http_server_token_equals(const char *token_start, ft_size_t token_length, const char *token)
-{
-    ft_size_t index;
-
-    index = 0;
-    while (index < token_length && token[index] != '\0')
-    {
-        char left_hand_side_character;
-        char right_hand_side_character;
-
-        left_hand_side_character = http_server_to_lower(token_start[index]);
-        right_hand_side_character = http_server_to_lower(token[index]);
-        if (left_hand_side_character != right_hand_side_character)
-            return (FT_FALSE);
-        index++;
-    }
-    if (index != token_length || token[index] != '\0')
-        return (FT_FALSE);
-    return (FT_TRUE);
-}
-
-static ft_bool http_server_request_wants_keep_alive(const ft_string &request, ft_size_t header_length)
-{
-    const char *data;
-    const char *connection_header;
-    const char *value_pointer;
-    ft_bool keep_alive;
-    ft_size_t header_limit;
-
-    data = request.c_str();
-    header_limit = header_length;
-    if (header_limit > request.size())
-        header_limit = request.size();
-    keep_alive = FT_TRUE;
-    if (ft_strnstr(data, "HTTP/1.0", header_limit) != ft_nullptr)
-        keep_alive = FT_FALSE;
-    connection_header = ft_strnstr(data, "Connection:", header_limit);
-    if (connection_header == ft_nullptr)
-        connection_header = ft_strnstr(data, "connection:", header_limit);
-    if (connection_header == ft_nullptr)
-        return (keep_alive);
-    value_pointer = connection_header;
-    while (*value_pointer != '\0' && value_pointer < data + header_limit && *value_pointer != ':')
-        value_pointer++;
-    if (*value_pointer != ':')
-        return (keep_alive);
-    value_pointer++;
-    while (*value_pointer == ' ' || *value_pointer == '\t')
-        value_pointer++;
-    while (value_pointer < data + header_limit
-        && *value_pointer != '\0' && *value_pointer != '\r'
-        && *value_pointer != '\n')
-    {
-        const char *token_start;
-        ft_size_t token_length;
-
-        token_start = value_pointer;
-        while (value_pointer < data + header_limit
-            && *value_pointer != '\0' && *value_pointer != '\r'
-            && *value_pointer != '\n' && *value_pointer != ','
-            && *value_pointer != ';')
-        {
-            value_pointer++;
-        }
-        token_length = static_cast<ft_size_t>(value_pointer - token_start);
-        while (token_length > 0
-            && (token_start[token_length - 1] == ' '
-                || token_start[token_length - 1] == '\t'))
-        {
-            token_length--;
-        }
-        if (token_length > 0)
-        {
-            if (http_server_token_equals(token_start, token_length, "close") != FT_FALSE)
-                keep_alive = FT_FALSE;
-            if (http_server_token_equals(token_start, token_length, "keep-alive") != FT_FALSE)
-                keep_alive = FT_TRUE;
-        }
-        while (*value_pointer == ' ' || *value_pointer == '\t'
-            || *value_pointer == ',' || *value_pointer == ';')
-        {
-            value_pointer++;
-        }
-    }
-    return (keep_alive);
-}
-
 
 int32_t ft_http_server::run_once() noexcept
 {
@@ -352,7 +302,6 @@ int32_t ft_http_server::run_once() noexcept
 
 int32_t ft_http_server::run_once_locked()
 {
-    t_monotonic_time_point start_time;
     struct sockaddr_storage client_address;
     socklen_t address_length;
     int32_t client_socket;
@@ -362,8 +311,12 @@ int32_t ft_http_server::run_once_locked()
     int32_t processed_requests;
     int32_t last_error_code;
     const int32_t max_keep_alive_requests = 100;
+    http_parser parser;
+    char *request_buffer;
+    ft_size_t request_size;
+    ft_size_t request_capacity;
+    ft_string response;
 
-    start_time = time_monotonic_point_now();
     server_fd = this->_server_socket.get_file_descriptor();
     if (server_fd < 0)
         return (FT_ERR_INVALID_OPERATION);
@@ -377,14 +330,12 @@ int32_t ft_http_server::run_once_locked()
         last_error = WSAGetLastError();
         if (this->_non_blocking != FT_FALSE && last_error == WSAEWOULDBLOCK)
             return (FT_ERR_SUCCESS);
-        last_error_code = FT_ERR_SOCKET_ACCEPT_FAILED;
 #else
         int32_t last_error;
 
         last_error = errno;
         if (this->_non_blocking != FT_FALSE && (last_error == EAGAIN || last_error == EWOULDBLOCK))
             return (FT_ERR_SUCCESS);
-        last_error_code = FT_ERR_SOCKET_ACCEPT_FAILED;
 #endif
         return (FT_ERR_INVALID_OPERATION);
     }
@@ -392,8 +343,12 @@ int32_t ft_http_server::run_once_locked()
     overall_result = 0;
     processed_requests = 0;
     last_error_code = FT_ERR_SUCCESS;
-    ft_string pending_data;
-    if (pending_data.initialize() != FT_ERR_SUCCESS)
+    request_buffer = ft_nullptr;
+    request_size = 0;
+    request_capacity = 0;
+    http_parser_init(&parser, HTTP_PARSER_MODE_REQUEST);
+    http_parser_set_max_body_size(&parser, HTTP_SERVER_MAX_REQUEST_SIZE);
+    if (response.initialize() != FT_ERR_SUCCESS)
     {
         nw_close(client_socket);
         return (FT_ERR_NO_MEMORY);
@@ -401,258 +356,114 @@ int32_t ft_http_server::run_once_locked()
     while (connection_active != FT_FALSE)
     {
         t_monotonic_time_point request_start_time;
-        ft_string request;
-        ft_string body;
-        ft_string response;
-        ft_string current_request;
-        ft_bool header_complete;
-        ft_bool request_complete;
-        ft_bool has_content_length;
-        ft_size_t expected_body_length;
-        ft_size_t header_length;
-        const ft_size_t max_request_size = 65536;
-        ft_bool metrics_enabled;
         const char *method_label;
+        const char *body_data;
+        ft_size_t body_length;
         ft_size_t request_bytes;
         ft_size_t response_bytes;
         int32_t status_code_value;
         ft_bool is_post;
+        ft_bool message_complete;
         int32_t parse_error;
         ft_bool request_failed;
         int32_t request_result;
         ft_bool should_keep_alive;
-        char buffer[1024];
+        char length_buffer[32];
         ssize_t bytes_received;
-        if (request.initialize() != FT_ERR_SUCCESS
-            || body.initialize() != FT_ERR_SUCCESS
-            || response.initialize() != FT_ERR_SUCCESS
-            || current_request.initialize() != FT_ERR_SUCCESS)
-        {
-            nw_close(client_socket);
-            return (FT_ERR_NO_MEMORY);
-        }
 
         request_start_time = time_monotonic_point_now();
-        header_complete = FT_FALSE;
-        request_complete = FT_FALSE;
-        has_content_length = FT_FALSE;
-        expected_body_length = 0;
-        header_length = 0;
-        metrics_enabled = FT_TRUE;
         method_label = "UNKNOWN";
         request_bytes = 0;
         response_bytes = 0;
         status_code_value = 0;
         is_post = FT_FALSE;
-        parse_error = FT_ERR_SUCCESS;
         request_failed = FT_FALSE;
         request_result = 1;
-        should_keep_alive = FT_FALSE;
-        request = pending_data;
-        pending_data.clear();
-        while (request_complete == FT_FALSE)
+        parse_error = http_parser_execute(&parser, request_buffer, request_size,
+                &message_complete);
+        while (parse_error == FT_ERR_SUCCESS && message_complete == FT_FALSE)
         {
-            if (header_complete == FT_FALSE)
+            if (request_size > HTTP_SERVER_MAX_REQUEST_SIZE)
             {
-                const char *full_request;
-                const char *header_end_pointer;
-
-                full_request = request.c_str();
-                header_end_pointer = ft_strstr(full_request, "\r\n\r\n");
-                if (header_end_pointer != ft_nullptr)
-                {
-                    const char *content_length_header;
-                    const char *content_length_key;
-                    ft_size_t content_length_key_length;
-
-                    header_end_pointer += 4;
-                    header_length = static_cast<ft_size_t>(header_end_pointer - full_request);
-                    header_complete = FT_TRUE;
-                    content_length_key = "Content-Length:";
-                    content_length_key_length = sizeof("Content-Length:") - 1;
-                    content_length_header = ft_strnstr(full_request, content_length_key, header_length);
-                    if (content_length_header != ft_nullptr)
-                    {
-                        const char *length_value_pointer;
-                        ft_bool has_length_digits;
-
-                        length_value_pointer = content_length_header + content_length_key_length;
-                        while (*length_value_pointer != '\0'
-                            && ft_isspace(static_cast<unsigned char>(*length_value_pointer)) != 0)
-                            length_value_pointer++;
-                        if (*length_value_pointer == '\0'
-                            || ft_isdigit(static_cast<unsigned char>(*length_value_pointer)) == 0)
-                        {
-                            nw_close(client_socket);
-                            overall_result = 1;
-                            last_error_code = FT_ERR_INVALID_ARGUMENT;
-                            request_failed = FT_TRUE;
-                            break ;
-                        }
-                        has_length_digits = FT_FALSE;
-                        expected_body_length = 0;
-                        while (*length_value_pointer != '\0'
-                            && ft_isdigit(static_cast<unsigned char>(*length_value_pointer)) != 0)
-                        {
-                            ft_size_t digit_value;
-
-                            has_length_digits = FT_TRUE;
-                            digit_value = static_cast<ft_size_t>(*length_value_pointer - '0');
-                            if (expected_body_length > (max_request_size - digit_value) / 10)
-                            {
-                                nw_close(client_socket);
-                                overall_result = 1;
-                                last_error_code = FT_ERR_INVALID_ARGUMENT;
-                                request_failed = FT_TRUE;
-                                break ;
-                            }
-                            expected_body_length = expected_body_length * 10 + digit_value;
-                            length_value_pointer++;
-                        }
-                        if (request_failed != FT_FALSE)
-                            break ;
-                        if (has_length_digits == FT_FALSE)
-                        {
-                            nw_close(client_socket);
-                            overall_result = 1;
-                            last_error_code = FT_ERR_INVALID_ARGUMENT;
-                            request_failed = FT_TRUE;
-                            break ;
-                        }
-                        if (expected_body_length > max_request_size)
-                        {
-                            nw_close(client_socket);
-                            overall_result = 1;
-                            last_error_code = FT_ERR_INVALID_ARGUMENT;
-                            request_failed = FT_TRUE;
-                            break ;
-                        }
-                        has_content_length = FT_TRUE;
-                    }
-                }
-            }
-            if (request_failed != FT_FALSE)
+                parse_error = FT_ERR_INVALID_ARGUMENT;
                 break ;
-            if (header_complete != FT_FALSE)
-            {
-                ft_size_t current_body_size;
-
-                if (request.size() >= header_length)
-                    current_body_size = request.size() - header_length;
-                else
-                    current_body_size = 0;
-                if (has_content_length != FT_FALSE)
-                {
-                    if (current_body_size >= expected_body_length)
-                        request_complete = FT_TRUE;
-                }
-                else
-                    request_complete = FT_TRUE;
             }
-            if (request_complete != FT_FALSE)
+            if (http_server_buffer_reserve(&request_buffer, &request_capacity,
+                    request_size + 1024) != FT_ERR_SUCCESS)
+            {
+                last_error_code = FT_ERR_NO_MEMORY;
+                request_failed = FT_TRUE;
                 break ;
-            bytes_received = nw_recv(client_socket, buffer, sizeof(buffer) - 1, 0);
+            }
+            bytes_received = nw_recv(client_socket, request_buffer + request_size,
+                    request_capacity - request_size - 1, 0);
             if (bytes_received < 0)
             {
-                nw_close(client_socket);
-#ifdef _WIN32
                 last_error_code = FT_ERR_SOCKET_RECEIVE_FAILED;
-#else
-                last_error_code = FT_ERR_SOCKET_RECEIVE_FAILED;
-#endif
-                overall_result = 1;
                 request_failed = FT_TRUE;
                 break ;
             }
             if (bytes_received == 0)
             {
-                if (request.empty() != FT_FALSE && header_complete == FT_FALSE)
+                if (request_size == 0)
                 {
                     nw_close(client_socket);
+                    cma_free(request_buffer);
                     return (FT_ERR_SUCCESS);
                 }
-                nw_close(client_socket);
-                overall_result = 1;
                 last_error_code = FT_ERR_SOCKET_RECEIVE_FAILED;
                 request_failed = FT_TRUE;
                 break ;
             }
-            buffer[bytes_received] = '\0';
-            request.append(buffer);
-            if (request.size() > max_request_size)
+            request_size += static_cast<ft_size_t>(bytes_received);
+            parse_error = http_parser_execute(&parser, request_buffer, request_size,
+                    &message_complete);
+        }
+        if (request_failed == FT_FALSE && parse_error != FT_ERR_SUCCESS)
+        {
+            last_error_code = FT_ERR_INVALID_ARGUMENT;
+            request_failed = FT_TRUE;
+        }
+        if (request_failed == FT_FALSE)
+        {
+            request_bytes = http_parser_message_length(&parser);
+            parse_error = http_server_classify_request(&parser, request_buffer,
+                    &is_post, &method_label);
+            if (parse_error != FT_ERR_SUCCESS)
             {
-                nw_close(client_socket);
-                overall_result = 1;
-                last_error_code = FT_ERR_INVALID_ARGUMENT;
+                last_error_code = parse_error;
                 request_failed = FT_TRUE;
-                break ;
             }
         }
         if (request_failed != FT_FALSE)
         {
-            if (metrics_enabled != FT_FALSE)
-                http_server_record_metrics(method_label, request_bytes, response_bytes, status_code_value, request_result, last_error_code, request_start_time);
-            connection_active = FT_FALSE;
-            break ;
-        }
-        ft_size_t consumed_length;
-
-        consumed_length = header_length;
-        if (has_content_length != FT_FALSE)
-            consumed_length += expected_body_length;
-        if (request.size() > consumed_length)
-            pending_data.assign(request.c_str() + consumed_length, request.size() - consumed_length);
-        else
-            pending_data.clear();
-        current_request.assign(request.c_str(), consumed_length);
-        request_bytes = consumed_length;
-        parse_error = parse_request(current_request, body, is_post);
-        if (parse_error != FT_ERR_SUCCESS)
-        {
-            nw_close(client_socket);
             overall_result = 1;
-            last_error_code = parse_error;
-            if (metrics_enabled != FT_FALSE)
-                http_server_record_metrics(method_label, request_bytes, response_bytes, status_code_value, 1, last_error_code, request_start_time);
+            http_server_record_metrics(method_label, request_bytes, response_bytes,
+                status_code_value, request_result, last_error_code, request_start_time);
             connection_active = FT_FALSE;
             break ;
         }
-        if (is_post)
-            method_label = "POST";
-        else
-            method_label = "GET";
-        should_keep_alive = http_server_request_wants_keep_alive(current_request, header_length);
+        should_keep_alive = parser.keep_alive;
         if (processed_requests >= max_keep_alive_requests - 1)
             should_keep_alive = FT_FALSE;
-        if (is_post && !body.empty())
-        {
-            pf_snprintf(buffer, sizeof(buffer), FT_UINT64_DECIMAL_FORMAT,
-                body.size());
-            response.append("HTTP/1.1 200 OK\r\nContent-Length: ");
-            response.append(buffer);
-            if (should_keep_alive != FT_FALSE)
-                response.append("\r\nConnection: keep-alive\r\n\r\n");
-            else
-                response.append("\r\nConnection: close\r\n\r\n");
-            response.append(body);
-        }
-        else if (!is_post)
+        body_data = request_buffer + parser.body.offset;
+        body_length = parser.body.length;
+        if (is_post == FT_FALSE)
         {
-            response.append("HTTP/1.1 200 OK\r\nContent-Length: 3\r\n");
-            if (should_keep_alive != FT_FALSE)
-                response.append("Connection: keep-alive\r\n\r\n");
-            else
-                response.append("Connection: close\r\n\r\n");
-            response.append("GET");
+            body_data = "GET";
+            body_length = 3;
         }
+        pf_snprintf(length_buffer, sizeof(length_buffer), FT_UINT64_DECIMAL_FORMAT,
+            body_length);
+        response.clear();
+        response.append("HTTP/1.1 200 OK\r\nContent-Length: ");
+        response.append(length_buffer);
+        if (should_keep_alive != FT_FALSE)
+            response.append("\r\nConnection: keep-alive\r\n\r\n");
         else
-        {
-            response.append("HTTP/1.1 200 OK\r\nContent-Length: 0\r\n");
-            if (should_keep_alive != FT_FALSE)
-                response.append("Connection: keep-alive\r\n\r\n");
-            else
-                response.append("Connection: close\r\n\r\n");
-        }
+            response.append("\r\nConnection: close\r\n\r\n");
+        if (body_length > 0)
+            response.append(body_data, body_length);
         const char *response_data;
         ft_size_t total_sent;
         ssize_t send_result;
@@ -660,74 +471,725 @@ int32_t ft_http_server::run_once_locked()
         response_data = response.c_str();
         total_sent = 0;
         response_bytes = response.size();
-        ft_bool remote_closed_during_send;
-
-        remote_closed_during_send = FT_FALSE;
         while (total_sent < response.size())
         {
             send_result = nw_send(client_socket, response_data + total_sent, response.size() - total_sent, 0);
             if (send_result <= 0)
             {
-#ifdef _WIN32
-                int32_t last_error;
-
-                last_error = WSAGetLastError();
-                if (send_result == 0
-                    || (send_result < 0
-                        && (last_error == WSAECONNRESET || last_error == WSAECONNABORTED
-                            || last_error == WSAESHUTDOWN)))
-                {
-                    overall_result = 1;
-                    last_error_code = FT_ERR_SOCKET_SEND_FAILED;
-                    request_result = 1;
-                    if (metrics_enabled != FT_FALSE)
-                        http_server_record_metrics(method_label, request_bytes, response_bytes, status_code_value, request_result, last_error_code, request_start_time);
-                    connection_active = FT_FALSE;
-                    remote_closed_during_send = FT_TRUE;
-                    break ;
-                }
-#else
-                if (send_result == 0
-                    || (send_result < 0 && (errno == EPIPE || errno == ECONNRESET)))
-                {
-                    overall_result = 1;
-                    last_error_code = FT_ERR_SOCKET_SEND_FAILED;
-                    request_result = 1;
-                    if (metrics_enabled != FT_FALSE)
-                        http_server_record_metrics(method_label, request_bytes, response_bytes, status_code_value, request_result, last_error_code, request_start_time);
-                    connection_active = FT_FALSE;
-                    remote_closed_during_send = FT_TRUE;
-                    break ;
-                }
-#endif
-                nw_close(client_socket);
-                if (send_result < 0)
-                    last_error_code = FT_ERR_SOCKET_SEND_FAILED;
-                else
-                    last_error_code = FT_ERR_SOCKET_SEND_FAILED;
                 overall_result = 1;
-                request_result = 1;
-                if (metrics_enabled != FT_FALSE)
-                    http_server_record_metrics(method_label, request_bytes, response_bytes, status_code_value, request_result, last_error_code, request_start_time);
+                last_error_code = FT_ERR_SOCKET_SEND_FAILED;
+                http_server_record_metrics(method_label, request_bytes, response_bytes,
+                    status_code_value, request_result, last_error_code, request_start_time);
                 connection_active = FT_FALSE;
                 break ;
             }
             total_sent += static_cast<ft_size_t>(send_result);
         }
-        if (remote_closed_during_send != FT_FALSE)
-            break ;
-        else if (connection_active == FT_FALSE)
+        if (connection_active == FT_FALSE)
             break ;
         status_code_value = 200;
         request_result = 0;
-        if (metrics_enabled != FT_FALSE)
-            http_server_record_metrics(method_label, request_bytes, response_bytes, status_code_value, request_result, FT_ERR_SUCCESS, request_start_time);
+        http_server_record_metrics(method_label, request_bytes, response_bytes,
+            status_code_value, request_result, FT_ERR_SUCCESS, request_start_time);
         processed_requests++;
+        http_parser_consume_message(&parser, request_buffer, &request_size);
         if (should_keep_alive == FT_FALSE)
             connection_active = FT_FALSE;
     }
     nw_close(client_socket);
+    if (request_buffer != ft_nullptr)
+        cma_free(request_buffer);
     if (overall_result == 0)
         return (FT_ERR_SUCCESS);
     return (FT_ERR_INVALID_OPERATION);
 }
+
+#define HTTP_SERVER_EVENT_READ_CHUNK 16384
+#define HTTP_SERVER_EVENT_OUTPUT_HIGH_WATER 262144
+#define HTTP_SERVER_EVENT_BACKLOG 1024
+#define HTTP_SERVER_EVENT_MAX_WORKERS 64
+#define HTTP_SERVER_EVENT_POLL_MILLISECONDS 50
+#define HTTP_SERVER_EVENT_ACCEPT_BACKOFF_MILLISECONDS 100
+
+#ifdef MSG_NOSIGNAL
+# define HTTP_SERVER_EVENT_SEND_FLAGS MSG_NOSIGNAL
+#else
+# define HTTP_SERVER_EVENT_SEND_FLAGS 0
+#endif
+
+struct http_server_connection
+{
+    int32_t                 socket_fd;
+    http_server_worker      *worker;
+    char                    *input_buffer;
+    ft_size_t               input_size;
+    ft_size_t               input_capacity;
+    http_parser             parser;
+    char                    *output_buffer;
+    ft_size_t               output_size;
+    ft_size_t               output_capacity;
+    ft_size_t               output_sent;
+    ft_bool                 close_after_flush;
+    ft_bool                 watching_write;
+    ft_bool                 read_pending;
+    ft_bool                 peer_closed;
+    http_server_connection  *next;
+    http_server_connection  *prev;
+};
+
+struct http_server_worker
+{
+    std::atomic<bool>       *stop_requested;
+    event_loop              loop;
+    ft_bool                 loop_ready;
+    int32_t                 listen_fd;
+    ft_bool                 owns_listener;
+    ft_thread               thread;
+    http_server_connection  *connections;
+    std::atomic<uint64_t>   request_count;
+    int64_t                 accept_resume_ms;
+
+    http_server_worker()
+        : stop_requested(ft_nullptr), loop(), loop_ready(FT_FALSE), listen_fd(-1),
+          owns_listener(FT_FALSE), thread(), connections(ft_nullptr), request_count(0),
+          accept_resume_ms(0)
+    {
+        return ;
+    }
+};
+
+static ft_bool http_server_socket_would_block(void)
+{
+#ifdef _WIN32
+    if (WSAGetLastError() == WSAEWOULDBLOCK)
+        return (FT_TRUE);
+    return (FT_FALSE);
+#else
+    if (errno == EAGAIN || errno == EWOULDBLOCK)
+        return (FT_TRUE);
+    return (FT_FALSE);
+#endif
+}
+
+static ft_bool http_server_socket_interrupted(void)
+{
+#ifdef _WIN32
+    if (WSAGetLastError() == WSAEINTR)
+        return (FT_TRUE);
+    return (FT_FALSE);
+#else
+    if (errno == EINTR)
+        return (FT_TRUE);
+    return (FT_FALSE);
+#endif
+}
+
+static ft_bool http_server_accept_should_retry(void)
+{
+    if (http_server_socket_interrupted() != FT_FALSE)
+        return (FT_TRUE);
+#ifdef _WIN32
+    if (WSAGetLastError() == WSAECONNRESET)
+        return (FT_TRUE);
+    return (FT_FALSE);
+#else
+    if (errno == ECONNABORTED)
+        return (FT_TRUE);
+# ifdef EPROTO
+    if (errno == EPROTO)
+        return (FT_TRUE);
+# endif
+    return (FT_FALSE);
+#endif
+}
+
+static int32_t http_server_set_socket_option(int32_t socket_fd, int32_t level, int32_t option)
+{
+    int32_t option_value;
+
+    option_value = 1;
+#ifdef _WIN32
+    return (setsockopt(static_cast<SOCKET>(socket_fd), level, option,
+            reinterpret_cast<const char *>(&option_value), sizeof(option_value)));
+#else
+    return (setsockopt(socket_fd, level, option, &option_value, sizeof(option_value)));
+#endif
+}
+
+static ft_bool http_server_reuse_port_supported(void)
+{
+#ifdef SO_REUSEPORT
+    return (FT_TRUE);
+#else
+    return (FT_FALSE);
+#endif
+}
+
+static int32_t http_server_open_listener(const char *ip_address, uint16_t port,
+    int32_t address_family, int32_t *listen_fd, uint16_t *bound_port)
+{
+    sockaddr_storage address;
+    socklen_t address_length;
+    int32_t socket_fd;
+
+    ft_memset(&address, 0, sizeof(address));
+    if (address_family == AF_INET)
+    {
+        sockaddr_in *ipv4_address;
+
+        ipv4_address = reinterpret_cast<sockaddr_in *>(&address);
+        ipv4_address->sin_family = AF_INET;
+        ipv4_address->sin_port = htons(port);
+        if (nw_inet_pton(AF_INET, ip_address, &ipv4_address->sin_addr) != 1)
+            return (FT_ERR_INVALID_ARGUMENT);
+        address_length = sizeof(sockaddr_in);
+    }
+    else if (address_family == AF_INET6)
+    {
+        sockaddr_in6 *ipv6_address;
+
+        ipv6_address = reinterpret_cast<sockaddr_in6 *>(&address);
+        ipv6_address->sin6_family = AF_INET6;
+        ipv6_address->sin6_port = htons(port);
+        if (nw_inet_pton(AF_INET6, ip_address, &ipv6_address->sin6_addr) != 1)
+            return (FT_ERR_INVALID_ARGUMENT);
+        address_length = sizeof(sockaddr_in6);
+    }
+    else
+        return (FT_ERR_INVALID_ARGUMENT);
+    socket_fd = nw_socket(address_family, SOCK_STREAM, IPPROTO_TCP);
+    if (socket_fd < 0)
+        return (FT_ERR_SOCKET_CREATION_FAILED);
+    if (http_server_set_socket_option(socket_fd, SOL_SOCKET, SO_REUSEADDR) != 0)
+    {
+        (void)nw_close(socket_fd);
+        return (FT_ERR_CONFIGURATION);
+    }
+#ifdef SO_REUSEPORT
+    if (http_server_set_socket_option(socket_fd, SOL_SOCKET, SO_REUSEPORT) != 0)
+    {
+        (void)nw_close(socket_fd);
+        return (FT_ERR_CONFIGURATION);
+    }
+#endif
+    if (nw_bind(socket_fd, reinterpret_cast<struct sockaddr *>(&address), address_length) != 0)
+    {
+        (void)nw_close(socket_fd);
+        return (FT_ERR_SOCKET_BIND_FAILED);
+    }
+    if (nw_listen(socket_fd, HTTP_SERVER_EVENT_BACKLOG) != 0)
+    {
+        (void)nw_close(socket_fd);
+        return (FT_ERR_SOCKET_LISTEN_FAILED);
+    }
+    if (nw_set_nonblocking(socket_fd) != 0)
+    {
+        (void)nw_close(socket_fd);
+        return (FT_ERR_CONFIGURATION);
+    }
+    address_length = sizeof(address);
+    if (getsockname(socket_fd, reinterpret_cast<struct sockaddr *>(&address),
+            &address_length) != 0)
+    {
+        (void)nw_close(socket_fd);
+        return (FT_ERR_SOCKET_BIND_FAILED);
+    }
+    if (address_family == AF_INET)
+        *bound_port = ntohs(reinterpret_cast<sockaddr_in *>(&address)->sin_port);
+    else
+        *bound_port = ntohs(reinterpret_cast<sockaddr_in6 *>(&address)->sin6_port);
+    *listen_fd = socket_fd;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_server_connection_append_output(http_server_connection *connection,
+    const char *data, ft_size_t length)
+{
+    if (http_server_buffer_reserve(&connection->output_buffer,
+            &connection->output_capacity, connection->output_size + length) != FT_ERR_SUCCESS)
+        return (FT_ERR_NO_MEMORY);
+    ft_memcpy(connection->output_buffer + connection->output_size, data, length);
+    connection->output_size += length;
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_server_connection_append_response(http_server_connection *connection,
+    ft_bool is_post, const char *body, ft_size_t body_length, ft_bool keep_alive)
+{
+    char length_buffer[32];
+    const char *connection_header;
+    int32_t error_code;
+
+    if (keep_alive != FT_FALSE)
+        connection_header = "\r\nConnection: keep-alive\r\n\r\n";
+    else
+        connection_header = "\r\nConnection: close\r\n\r\n";
+    if (is_post == FT_FALSE)
+    {
+        body = "GET";
+        body_length = 3;
+    }
+    pf_snprintf(length_buffer, sizeof(length_buffer), FT_UINT64_DECIMAL_FORMAT,
+        body_length);
+    error_code = http_server_connection_append_output(connection,
+            "HTTP/1.1 200 OK\r\nContent-Length: ", sizeof("HTTP/1.1 200 OK\r\nContent-Length: ") - 1);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = http_server_connection_append_output(connection, length_buffer,
+                ft_strlen_size_t(length_buffer));
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = http_server_connection_append_output(connection, connection_header,
+                ft_strlen_size_t(connection_header));
+    if (error_code == FT_ERR_SUCCESS && body_length > 0)
+        error_code = http_server_connection_append_output(connection, body, body_length);
+    return (error_code);
+}
+
+static ft_bool http_server_connection_output_full(const http_server_connection *connection)
+{
+    if (connection->output_size - connection->output_sent
+            >= HTTP_SERVER_EVENT_OUTPUT_HIGH_WATER)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
+static int32_t http_server_connection_process_input(http_server_connection *connection)
+{
+    t_monotonic_time_point request_start_time;
+    ft_bool message_complete;
+    ft_bool is_post;
+    ft_bool keep_alive;
+    int32_t error_code;
+    const char *method_label;
+
+    while (connection->close_after_flush == FT_FALSE
+        && http_server_connection_output_full(connection) == FT_FALSE)
+    {
+        request_start_time = time_monotonic_point_now();
+        error_code = http_parser_execute(&connection->parser, connection->input_buffer,
+                connection->input_size, &message_complete);
+        if (error_code == FT_ERR_SUCCESS && message_complete == FT_FALSE)
+            return (FT_ERR_SUCCESS);
+        method_label = "UNKNOWN";
+        if (error_code == FT_ERR_SUCCESS)
+            error_code = http_server_classify_request(&connection->parser,
+                    connection->input_buffer, &is_post, &method_label);
+        if (error_code != FT_ERR_SUCCESS)
+        {
+            http_server_record_metrics(method_label,
+                http_parser_message_length(&connection->parser), 0, 0, 1,
+                FT_ERR_INVALID_ARGUMENT, request_start_time);
+            return (FT_ERR_INVALID_ARGUMENT);
+        }
+        keep_alive = connection->parser.keep_alive;
+        error_code = http_server_connection_append_response(connection, is_post,
+                connection->input_buffer + connection->parser.body.offset,
+                connection->parser.body.length, keep_alive);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        http_server_record_metrics(method_label,
+            http_parser_message_length(&connection->parser),
+            connection->output_size - connection->output_sent, 200, 0,
+            FT_ERR_SUCCESS, request_start_time);
+        connection->worker->request_count.fetch_add(1, std::memory_order_relaxed);
+        http_parser_consume_message(&connection->parser, connection->input_buffer,
+            &connection->input_size);
+        if (keep_alive == FT_FALSE)
+        {
+            connection->close_after_flush = FT_TRUE;
+            connection->input_size = 0;
+        }
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+static void http_server_connection_close(http_server_connection *connection)
+{
+    http_server_worker *worker;
+
+    worker = connection->worker;
+    (void)event_loop_unwatch(&worker->loop, connection->socket_fd);
+    (void)nw_close(connection->socket_fd);
+    if (connection->prev != ft_nullptr)
+        connection->prev->next = connection->next;
+    else
+        worker->connections = connection->next;
+    if (connection->next != ft_nullptr)
+        connection->next->prev = connection->prev;
+    if (connection->input_buffer != ft_nullptr)
+        cma_free(connection->input_buffer);
+    if (connection->output_buffer != ft_nullptr)
+        cma_free(connection->output_buffer);
+    delete connection;
+    return ;
+}
+
+static void http_server_connection_ready(event_loop *loop, int32_t socket_fd,
+    uint32_t ready_events, void *user_data);
+
+// Reads while the socket has data, parsing as it goes. Reading stops early
+// once unsent output reaches the high-water mark; read_pending stays set so
+// the next call resumes after a flush, since an edge-triggered watch will
+// not report the unread data again.
+static int32_t http_server_connection_receive(http_server_connection *connection)
+{
+    ssize_t bytes_received;
+
+    while (connection->read_pending != FT_FALSE
+        && connection->close_after_flush == FT_FALSE
+        && http_server_connection_output_full(connection) == FT_FALSE)
+    {
+        if (http_server_buffer_reserve(&connection->input_buffer,
+                &connection->input_capacity,
+                connection->input_size + HTTP_SERVER_EVENT_READ_CHUNK) != FT_ERR_SUCCESS)
+            return (FT_ERR_NO_MEMORY);
+        bytes_received = nw_recv(connection->socket_fd,
+                connection->input_buffer + connection->input_size,
+                HTTP_SERVER_EVENT_READ_CHUNK, 0);
+        if (bytes_received == 0)
+        {
+            connection->peer_closed = FT_TRUE;
+            connection->read_pending = FT_FALSE;
+            break ;
+        }
+        if (bytes_received < 0)
+        {
+            if (http_server_socket_interrupted() != FT_FALSE)
+                continue ;
+            if (http_server_socket_would_block() != FT_FALSE)
+            {
+                connection->read_pending = FT_FALSE;
+                break ;
+            }
+            return (FT_ERR_SOCKET_RECEIVE_FAILED);
+        }
+        connection->input_size += static_cast<ft_size_t>(bytes_received);
+        if (http_server_connection_process_input(connection) != FT_ERR_SUCCESS)
+            return (FT_ERR_INVALID_ARGUMENT);
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t http_server_connection_flush(http_server_connection *connection)
+{
+    ssize_t send_result;
+    uint32_t watch_events;
+
+    while (connection->output_sent < connection->output_size)
+    {
+        send_result = nw_send(connection->socket_fd,
+                connection->output_buffer + connection->output_sent,
+                connection->output_size - connection->output_sent,
+                HTTP_SERVER_EVENT_SEND_FLAGS);
+        if (send_result > 0)
+        {
+            connection->output_sent += static_cast<ft_size_t>(send_result);
+            continue ;
+        }
+        if (send_result < 0 && http_server_socket_interrupted() != FT_FALSE)
+            continue ;
+        if (send_result < 0 && http_server_socket_would_block() != FT_FALSE)
+            break ;
+        return (FT_ERR_SOCKET_SEND_FAILED);
+    }
+    if (connection->output_sent == connection->output_size)
+    {
+        connection->output_sent = 0;
+        connection->output_size = 0;
+    }
+    if ((connection->output_size != 0) == (connection->watching_write != FT_FALSE))
+        return (FT_ERR_SUCCESS);
+    watch_events = EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_HUP
+        | EVENT_LOOP_EVENT_EDGE_TRIGGERED;
+    if (connection->output_size != 0)
+        watch_events |= EVENT_LOOP_EVENT_WRITE;
+    if (event_loop_watch(&connection->worker->loop, connection->socket_fd, watch_events,
+            http_server_connection_ready, connection) != 0)
+        return (FT_ERR_INVALID_STATE);
+    connection->watching_write = (connection->output_size != 0);
+    return (FT_ERR_SUCCESS);
+}
+
+static void http_server_connection_ready(event_loop *loop, int32_t socket_fd,
+    uint32_t ready_events, void *user_data)
+{
+    http_server_connection *connection;
+
+    (void)loop;
+    (void)socket_fd;
+    connection = static_cast<http_server_connection *>(user_data);
+    if (ready_events & (EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_HUP))
+        connection->read_pending = FT_TRUE;
+    while (1)
+    {
+        if (http_server_connection_process_input(connection) != FT_ERR_SUCCESS
+            || http_server_connection_receive(connection) != FT_ERR_SUCCESS
+            || http_server_connection_flush(connection) != FT_ERR_SUCCESS
+            || (connection->output_size == 0
+                && (connection->peer_closed != FT_FALSE
+                    || connection->close_after_flush != FT_FALSE)))
+        {
+            http_server_connection_close(connection);
+            return ;
+        }
+        if (connection->read_pending == FT_FALSE
+            || connection->close_after_flush != FT_FALSE
+            || http_server_connection_output_full(connection) != FT_FALSE)
+            return ;
+    }
+}
+
+static void http_server_accept_ready(event_loop *loop, int32_t socket_fd,
+    uint32_t ready_events, void *user_data)
+{
+    http_server_worker *worker;
+    http_server_connection *connection;
+    struct sockaddr_storage client_address;
+    socklen_t address_length;
+    int32_t client_fd;
+
+    (void)loop;
+    (void)ready_events;
+    worker = static_cast<http_server_worker *>(user_data);
+    if (worker->accept_resume_ms != 0)
+        return ;
+    while (worker->stop_requested->load(std::memory_order_relaxed) == false)
+    {
+        address_length = sizeof(client_address);
+        client_fd = nw_accept(socket_fd, reinterpret_cast<struct sockaddr *>(&client_address),
+                &address_length);
+        if (client_fd < 0)
+        {
+            if (http_server_accept_should_retry() != FT_FALSE)
+                continue ;
+            if (http_server_socket_would_block() != FT_FALSE)
+                return ;
+            // Out of descriptors (EMFILE, ENFILE) or another hard failure:
+            // the backlog is still pending and the edge-triggered listener
+            // will not signal again, so the worker drains it after a pause.
+            worker->accept_resume_ms = time_monotonic()
+                + HTTP_SERVER_EVENT_ACCEPT_BACKOFF_MILLISECONDS;
+            return ;
+        }
+        connection = new (std::nothrow) http_server_connection();
+        if (connection == ft_nullptr || nw_set_nonblocking(client_fd) != 0)
+        {
+            delete connection;
+            (void)nw_close(client_fd);
+            continue ;
+        }
+        (void)http_server_set_socket_option(client_fd, IPPROTO_TCP, TCP_NODELAY);
+        connection->socket_fd = client_fd;
+        connection->worker = worker;
+        connection->input_buffer = ft_nullptr;
+        connection->input_size = 0;
+        connection->input_capacity = 0;
+        http_parser_init(&connection->parser, HTTP_PARSER_MODE_REQUEST);
+        http_parser_set_max_body_size(&connection->parser, HTTP_SERVER_MAX_REQUEST_SIZE);
+        connection->output_buffer = ft_nullptr;
+        connection->output_size = 0;
+        connection->output_capacity = 0;
+        connection->output_sent = 0;
+        connection->close_after_flush = FT_FALSE;
+        connection->watching_write = FT_FALSE;
+        connection->read_pending = FT_FALSE;
+        connection->peer_closed = FT_FALSE;
+        connection->prev = ft_nullptr;
+        connection->next = worker->connections;
+        if (event_loop_watch(&worker->loop, client_fd, EVENT_LOOP_EVENT_READ
+                | EVENT_LOOP_EVENT_HUP | EVENT_LOOP_EVENT_EDGE_TRIGGERED,
+                http_server_connection_ready, connection) != 0)
+        {
+            delete connection;
+            (void)nw_close(client_fd);
+            continue ;
+        }
+        if (worker->connections != ft_nullptr)
+            worker->connections->prev = connection;
+        worker->connections = connection;
+    }
+    return ;
+}
+
+static void http_server_worker_main(http_server_worker *worker)
+{
+    while (worker->stop_requested->load(std::memory_order_acquire) == false)
+    {
+        if (event_loop_run(&worker->loop, HTTP_SERVER_EVENT_POLL_MILLISECONDS) < 0)
+            time_sleep_ms(HTTP_SERVER_EVENT_POLL_MILLISECONDS);
+        if (worker->accept_resume_ms != 0 && time_monotonic() >= worker->accept_resume_ms)
+        {
+            worker->accept_resume_ms = 0;
+            http_server_accept_ready(&worker->loop, worker->listen_fd,
+                EVENT_LOOP_EVENT_READ, worker);
+        }
+    }
+    return ;
+}
+
+static void http_server_worker_release(http_server_worker *worker)
+{
+    while (worker->connections != ft_nullptr)
+        http_server_connection_close(worker->connections);
+    if (worker->loop_ready != FT_FALSE)
+    {
+        if (worker->listen_fd >= 0)
+            (void)event_loop_unwatch(&worker->loop, worker->listen_fd);
+        event_loop_clear(&worker->loop);
+        worker->loop_ready = FT_FALSE;
+    }
+    if (worker->owns_listener != FT_FALSE && worker->listen_fd >= 0)
+        (void)nw_close(worker->listen_fd);
+    worker->listen_fd = -1;
+    worker->owns_listener = FT_FALSE;
+    return ;
+}
+
+int32_t ft_http_server::stop_locked() noexcept
+{
+    uint32_t worker_index;
+
+    if (this->_workers == ft_nullptr)
+        return (FT_ERR_SUCCESS);
+    this->_stop_requested.store(true, std::memory_order_release);
+    worker_index = 0;
+    while (worker_index < this->_worker_count)
+    {
+        if (this->_workers[worker_index].thread.joinable())
+            this->_workers[worker_index].thread.join();
+        worker_index++;
+    }
+    worker_index = this->_worker_count;
+    while (worker_index > 0)
+    {
+        worker_index--;
+        http_server_worker_release(&this->_workers[worker_index]);
+    }
+    delete[] this->_workers;
+    this->_workers = ft_nullptr;
+    this->_worker_count = 0;
+    this->_event_port = 0;
+    this->_stop_requested.store(false, std::memory_order_release);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t ft_http_server::start_event_driven(const char *ip_address, uint16_t port,
+    uint32_t worker_count, int32_t address_family) noexcept
+{
+    http_server_worker *worker;
+    uint32_t worker_index;
+    uint16_t bound_port;
+    int32_t error_code;
+    int32_t lock_error;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_http_server::start_event_driven");
+    if (ip_address == ft_nullptr || worker_count > HTTP_SERVER_EVENT_MAX_WORKERS)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (worker_count == 0)
+        worker_count = 1;
+    lock_error = pt_recursive_mutex_lock_if_not_null(this->_mutex);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (FT_ERR_INVALID_OPERATION);
+    if (this->_workers != ft_nullptr)
+    {
+        (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+        return (FT_ERR_INVALID_STATE);
+    }
+    this->_workers = new (std::nothrow) http_server_worker[worker_count];
+    if (this->_workers == ft_nullptr)
+    {
+        (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+        return (FT_ERR_NO_MEMORY);
+    }
+    this->_worker_count = worker_count;
+    this->_stop_requested.store(false, std::memory_order_release);
+    bound_port = port;
+    error_code = FT_ERR_SUCCESS;
+    worker_index = 0;
+    while (worker_index < worker_count && error_code == FT_ERR_SUCCESS)
+    {
+        worker = &this->_workers[worker_index];
+        worker->stop_requested = &this->_stop_requested;
+        if (worker_index == 0 || http_server_reuse_port_supported() != FT_FALSE)
+        {
+            error_code = http_server_open_listener(ip_address, bound_port,
+                    address_family, &worker->listen_fd, &bound_port);
+            worker->owns_listener = (error_code == FT_ERR_SUCCESS);
+        }
+        else
+            worker->listen_fd = this->_workers[0].listen_fd;
+        if (error_code != FT_ERR_SUCCESS)
+            break ;
+        event_loop_init(&worker->loop);
+        worker->loop_ready = FT_TRUE;
+        if (event_loop_watch(&worker->loop, worker->listen_fd, EVENT_LOOP_EVENT_READ
+                | EVENT_LOOP_EVENT_EDGE_TRIGGERED, http_server_accept_ready, worker) != 0)
+            error_code = FT_ERR_INVALID_STATE;
+        worker_index++;
+    }
+    worker_index = 0;
+    while (worker_index < worker_count && error_code == FT_ERR_SUCCESS)
+    {
+        worker = &this->_workers[worker_index];
+        worker->thread = ft_thread(http_server_worker_main, worker);
+        if (worker->thread.joinable() == false)
+            error_code = FT_ERR_INVALID_STATE;
+        worker_index++;
+    }
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        (void)this->stop_locked();
+        (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+        return (error_code);
+    }
+    this->_event_port = bound_port;
+    (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t ft_http_server::stop() noexcept
+{
+    int32_t lock_error;
+    int32_t stop_error;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (FT_ERR_SUCCESS);
+    lock_error = pt_recursive_mutex_lock_if_not_null(this->_mutex);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (FT_ERR_INVALID_OPERATION);
+    stop_error = this->stop_locked();
+    (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+    return (stop_error);
+}
+
+ft_bool ft_http_server::is_serving() const noexcept
+{
+    if (this->_workers != ft_nullptr)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
+uint16_t ft_http_server::get_port() const noexcept
+{
+    return (this->_event_port);
+}
+
+uint64_t ft_http_server::get_request_count() const noexcept
+{
+    uint64_t total;
+    uint32_t worker_index;
+    int32_t lock_error;
+
+    lock_error = pt_recursive_mutex_lock_if_not_null(this->_mutex);
+    if (lock_error != FT_ERR_SUCCESS)
+        return (0);
+    total = 0;
+    worker_index = 0;
+    while (this->_workers != ft_nullptr && worker_index < this->_worker_count)
+    {
+        total += this->_workers[worker_index].request_count.load(std::memory_order_relaxed);
+        worker_index++;
+    }
+    (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+    return (total);
+}
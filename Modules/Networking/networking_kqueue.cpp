@@ -1,4 +1,5 @@
 #include "networking.hpp"
+#include "networking_event_backend.hpp"
 #include "../CMA/CMA.hpp"
 #include "../Compatebility/compatebility_internal.hpp"
 #include "../Errno/errno.hpp"
@@ -117,3 +118,142 @@ int32_t nw_poll(int32_t *read_file_descriptors, int32_t read_count,
     (void)(FT_ERR_SUCCESS);
     return (ready_descriptors);
 }
+
+int32_t nw_event_backend_open(event_loop *loop)
+{
+    int32_t kqueue_descriptor;
+
+    if (loop->backend_open)
+        return (0);
+    kqueue_descriptor = kqueue();
+    if (kqueue_descriptor == -1)
+    {
+        (void)(cmp_map_system_error_to_ft(errno));
+        return (-1);
+    }
+    loop->backend_descriptor = kqueue_descriptor;
+    loop->backend_open = FT_TRUE;
+    return (0);
+}
+
+void nw_event_backend_close(event_loop *loop)
+{
+    if (!loop->backend_open)
+        return ;
+    close(loop->backend_descriptor);
+    loop->backend_descriptor = -1;
+    loop->backend_open = FT_FALSE;
+    return ;
+}
+
+static int32_t nw_event_backend_update_filter(int32_t kqueue_descriptor,
+            int32_t socket_fd, int16_t filter, ft_bool was_registered,
+            ft_bool want_registered, uint32_t desired_events)
+{
+    struct kevent change_event;
+    uint16_t flags;
+
+    if (!want_registered)
+    {
+        if (!was_registered)
+            return (0);
+        EV_SET(&change_event, socket_fd, filter, EV_DELETE, 0, 0, NULL);
+        if (kevent(kqueue_descriptor, &change_event, 1, NULL, 0, NULL) == -1
+            && errno != ENOENT && errno != EBADF)
+        {
+            (void)(cmp_map_system_error_to_ft(errno));
+            return (-1);
+        }
+        return (0);
+    }
+    flags = EV_ADD | EV_ENABLE;
+    if (desired_events & EVENT_LOOP_EVENT_EDGE_TRIGGERED)
+        flags |= EV_CLEAR;
+    EV_SET(&change_event, socket_fd, filter, flags, 0, 0, NULL);
+    if (kevent(kqueue_descriptor, &change_event, 1, NULL, 0, NULL) == -1)
+    {
+        (void)(cmp_map_system_error_to_ft(errno));
+        return (-1);
+    }
+    return (0);
+}
+
+int32_t nw_event_backend_update(event_loop *loop, int32_t socket_fd,
+            uint32_t registered_events, uint32_t desired_events)
+{
+    if (nw_event_backend_open(loop) != 0)
+        return (-1);
+    if (nw_event_backend_update_filter(loop->backend_descriptor, socket_fd,
+            EVFILT_READ,
+            (registered_events & (EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_HUP)) != 0,
+            (desired_events & (EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_HUP)) != 0,
+            desired_events) != 0)
+        return (-1);
+    if (nw_event_backend_update_filter(loop->backend_descriptor, socket_fd,
+            EVFILT_WRITE, (registered_events & EVENT_LOOP_EVENT_WRITE) != 0,
+            (desired_events & EVENT_LOOP_EVENT_WRITE) != 0, desired_events) != 0)
+        return (-1);
+    return (0);
+}
+
+int32_t nw_event_backend_wait(event_loop *loop, int32_t timeout_milliseconds)
+{
+    struct kevent event_list[64];
+    timespec timeout;
+    timespec *timeout_pointer;
+    int32_t maximum_events;
+    int32_t ready_count;
+    int32_t event_index;
+    int32_t total_ready;
+    uint32_t ready_events;
+
+    if (nw_event_backend_open(loop) != 0)
+        return (-1);
+    timeout_pointer = NULL;
+    if (timeout_milliseconds >= 0)
+    {
+        timeout.tv_sec = timeout_milliseconds / 1000;
+        timeout.tv_nsec = (timeout_milliseconds % 1000) * 1000000;
+        timeout_pointer = &timeout;
+    }
+    total_ready = 0;
+    while (total_ready < loop->ready_capacity)
+    {
+        maximum_events = loop->ready_capacity - total_ready;
+        if (maximum_events > 64)
+            maximum_events = 64;
+        ready_count = kevent(loop->backend_descriptor, NULL, 0, event_list,
+                maximum_events, timeout_pointer);
+        if (ready_count < 0)
+        {
+            if (errno == EINTR && total_ready == 0)
+                return (0);
+            if (total_ready > 0)
+                break ;
+            (void)(cmp_map_system_error_to_ft(errno));
+            return (-1);
+        }
+        event_index = 0;
+        while (event_index < ready_count)
+        {
+            if (event_list[event_index].filter == EVFILT_WRITE)
+                ready_events = EVENT_LOOP_EVENT_WRITE;
+            else
+                ready_events = EVENT_LOOP_EVENT_READ;
+            if (event_list[event_index].flags & (EV_EOF | EV_ERROR))
+                ready_events |= EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_WRITE
+                    | EVENT_LOOP_EVENT_HUP;
+            loop->ready_events[total_ready].socket_fd
+                = static_cast<int32_t>(event_list[event_index].ident);
+            loop->ready_events[total_ready].events = ready_events;
+            total_ready++;
+            event_index++;
+        }
+        if (ready_count < maximum_events)
+            break ;
+        timeout.tv_sec = 0;
+        timeout.tv_nsec = 0;
+        timeout_pointer = &timeout;
+    }
+    return (total_ready);
+}
@@ -1,4 +1,5 @@
 #include "networking.hpp"
+#include "networking_event_backend.hpp"
 #include "../Errno/errno.hpp"
 #include "../Compatebility/compatebility_internal.hpp"
 
@@ -495,3 +496,107 @@ int32_t nw_poll(int32_t *read_file_descriptors, int32_t read_count,
     return (total_ready);
 #endif
 }
+
+int32_t nw_event_backend_open(event_loop *loop)
+{
+    loop->backend_descriptor = -1;
+    loop->backend_open = FT_TRUE;
+    return (0);
+}
+
+void nw_event_backend_close(event_loop *loop)
+{
+    loop->backend_descriptor = -1;
+    loop->backend_open = FT_FALSE;
+    return ;
+}
+
+int32_t nw_event_backend_update(event_loop *loop, int32_t socket_fd,
+            uint32_t registered_events, uint32_t desired_events)
+{
+    (void)socket_fd;
+    (void)registered_events;
+    (void)desired_events;
+    return (nw_event_backend_open(loop));
+}
+
+int32_t nw_event_backend_wait(event_loop *loop, int32_t timeout_milliseconds)
+{
+    int32_t *read_descriptors;
+    int32_t *write_descriptors;
+    int32_t read_count;
+    int32_t write_count;
+    int32_t index;
+    int32_t poll_result;
+    int32_t total_ready;
+    const event_loop_registration *registration;
+
+    if (loop->registration_count == 0)
+        return (0);
+    read_descriptors = static_cast<int32_t *>(cma_malloc(sizeof(int32_t)
+                * static_cast<ft_size_t>(loop->registration_count)));
+    if (read_descriptors == ft_nullptr)
+        return (-1);
+    write_descriptors = static_cast<int32_t *>(cma_malloc(sizeof(int32_t)
+                * static_cast<ft_size_t>(loop->registration_count)));
+    if (write_descriptors == ft_nullptr)
+    {
+        cma_free(read_descriptors);
+        return (-1);
+    }
+    read_count = 0;
+    write_count = 0;
+    index = 0;
+    while (index < loop->registration_capacity)
+    {
+        registration = &loop->registrations[index];
+        if (registration->socket_fd != index)
+        {
+            index++;
+            continue ;
+        }
+        if (registration->registered_events & EVENT_LOOP_EVENT_READ)
+        {
+            read_descriptors[read_count] = registration->socket_fd;
+            read_count++;
+        }
+        if (registration->registered_events & EVENT_LOOP_EVENT_WRITE)
+        {
+            write_descriptors[write_count] = registration->socket_fd;
+            write_count++;
+        }
+        index++;
+    }
+    poll_result = nw_poll(read_descriptors, read_count, write_descriptors,
+            write_count, timeout_milliseconds);
+    total_ready = 0;
+    index = 0;
+    while (poll_result > 0 && index < read_count
+        && total_ready < loop->ready_capacity)
+    {
+        if (read_descriptors[index] >= 0)
+        {
+            loop->ready_events[total_ready].socket_fd = read_descriptors[index];
+            loop->ready_events[total_ready].events = EVENT_LOOP_EVENT_READ;
+            total_ready++;
+        }
+        index++;
+    }
+    index = 0;
+    while (poll_result > 0 && index < write_count
+        && total_ready < loop->ready_capacity)
+    {
+        if (write_descriptors[index] >= 0)
+        {
+            loop->ready_events[total_ready].socket_fd = write_descriptors[index];
+            loop->ready_events[total_ready].events = EVENT_LOOP_EVENT_WRITE;
+            total_ready++;
+        }
+        index++;
+    }
+    cma_free(read_descriptors);
+    cma_free(write_descriptors);
+    if (poll_result < 0)
+        return (-1);
+    return (total_ready);
+}
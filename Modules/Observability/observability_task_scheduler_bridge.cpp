@@ -35,8 +35,8 @@ static void observability_task_scheduler_bridge_untrack_runtime_leaks(void)
         && g_observability_span_states._data != ft_nullptr)
         (void)cma_untrack_leak(g_observability_span_states._data);
     if (g_observability_span_states.is_initialised() == FT_CLASS_STATE_INITIALISED
-        && g_observability_span_states._occupied != ft_nullptr)
-        (void)cma_untrack_leak(g_observability_span_states._occupied);
+        && g_observability_span_states._hashes != ft_nullptr)
+        (void)cma_untrack_leak(g_observability_span_states._hashes);
     if (g_observability_span_states.is_initialised() == FT_CLASS_STATE_INITIALISED
         && g_observability_span_states._mutex != ft_nullptr)
         (void)cma_untrack_leak(g_observability_span_states._mutex);
@@ -3,39 +3,89 @@
 
 #include "../Basic/class_nullptr.hpp"
 #include "../Basic/basic.hpp"
+#include "constructor.hpp"
 #include "move.hpp"
 
+#include <cstddef>
 #include <new>
 #include <type_traits>
 #include <utility>
 
+#define FT_FUNCTION_INLINE_SIZE 48
+
+template <typename FunctionType>
+struct ft_function_stores_inline
+{
+    static const bool value = sizeof(FunctionType) <= FT_FUNCTION_INLINE_SIZE
+        && alignof(FunctionType) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible<FunctionType>::value;
+};
+
 template <typename Signature>
-class ft_function;
+class ft_function_storage;
 
 template <typename ReturnType, typename... Args>
-class ft_function<ReturnType(Args...)>
+class ft_function_storage<ReturnType(Args...)>
 {
-    private:
+    protected:
+        alignas(std::max_align_t) unsigned char _storage[FT_FUNCTION_INLINE_SIZE];
         void *_callable;
         ReturnType (*_invoke)(void *, Args...);
         void (*_destroy)(void *);
-        void *(*_clone)(void *);
+        void *(*_relocate)(void *, void *);
+
+        ft_function_storage() noexcept;
+        ~ft_function_storage();
 
+        template <typename FunctionType>
+        ft_bool emplace_callable(FunctionType &&function);
+
+        void    take_callable(ft_function_storage &other) noexcept;
         void    clear_callable();
 
         template <typename FunctionType>
         static ReturnType invoke(void *callable, Args... args);
 
         template <typename FunctionType>
-        static void destroy(void *callable);
+        static void destroy_inline(void *callable);
+
+        template <typename FunctionType>
+        static void destroy_heap(void *callable);
 
         template <typename FunctionType>
-        static void *clone(void *callable);
+        static void *relocate_inline(void *callable, void *storage);
+
+        static void *relocate_heap(void *callable, void *storage);
 
     public:
-        ft_function();
+        ft_function_storage(const ft_function_storage &other) = delete;
+        ft_function_storage &operator=(const ft_function_storage &other) = delete;
+
+        ReturnType   operator()(Args... args) const;
+        operator ft_bool() const noexcept;
+        ft_bool is_inline() const noexcept;
+};
+
+template <typename Signature>
+class ft_function;
+
+template <typename ReturnType, typename... Args>
+class ft_function<ReturnType(Args...)> : public ft_function_storage<ReturnType(Args...)>
+{
+    private:
+        void *(*_clone)(void *, void *);
 
         template <typename FunctionType>
+        static void *clone_inline(void *callable, void *storage);
+
+        template <typename FunctionType>
+        static void *clone_heap(void *callable, void *storage);
+
+    public:
+        ft_function();
+
+        template <typename FunctionType, typename = typename std::enable_if<
+            !std::is_same<typename std::decay<FunctionType>::type, ft_function>::value>::type>
         ft_function(FunctionType function);
 
         ft_function(const ft_function &other);
@@ -44,28 +94,81 @@ class ft_function<ReturnType(Args...)>
 
         ft_function &operator=(const ft_function &other);
         ft_function &operator=(ft_function &&other) noexcept;
-
-        ReturnType   operator()(Args... args) const;
-        operator ft_bool() const noexcept;
 };
 
 template <typename ReturnType, typename... Args>
-void ft_function<ReturnType(Args...)>::clear_callable()
+ft_function_storage<ReturnType(Args...)>::ft_function_storage() noexcept
+    : _callable(ft_nullptr), _invoke(ft_nullptr), _destroy(ft_nullptr),
+      _relocate(ft_nullptr)
 {
-    if (this->_destroy && this->_callable)
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+ft_function_storage<ReturnType(Args...)>::~ft_function_storage()
+{
+    this->clear_callable();
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+template <typename FunctionType>
+ft_bool ft_function_storage<ReturnType(Args...)>::emplace_callable(FunctionType &&function)
+{
+    typedef typename std::decay<FunctionType>::type stored_type;
+    stored_type *copy;
+
+    if constexpr (ft_function_stores_inline<stored_type>::value)
     {
-        this->_destroy(this->_callable);
+        copy = construct_at(reinterpret_cast<stored_type *>(this->_storage),
+                std::forward<FunctionType>(function));
+        this->_destroy = &ft_function_storage::template destroy_inline<stored_type>;
+        this->_relocate = &ft_function_storage::template relocate_inline<stored_type>;
     }
+    else
+    {
+        copy = new (std::nothrow) stored_type(std::forward<FunctionType>(function));
+        if (copy == ft_nullptr)
+            return (FT_FALSE);
+        this->_destroy = &ft_function_storage::template destroy_heap<stored_type>;
+        this->_relocate = &ft_function_storage::relocate_heap;
+    }
+    this->_callable = copy;
+    this->_invoke = &ft_function_storage::template invoke<stored_type>;
+    return (FT_TRUE);
+}
+
+template <typename ReturnType, typename... Args>
+void ft_function_storage<ReturnType(Args...)>::take_callable(ft_function_storage &other) noexcept
+{
+    if (other._callable == ft_nullptr)
+        return ;
+    this->_callable = other._relocate(other._callable, this->_storage);
+    this->_invoke = other._invoke;
+    this->_destroy = other._destroy;
+    this->_relocate = other._relocate;
+    other._callable = ft_nullptr;
+    other._invoke = ft_nullptr;
+    other._destroy = ft_nullptr;
+    other._relocate = ft_nullptr;
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+void ft_function_storage<ReturnType(Args...)>::clear_callable()
+{
+    if (this->_destroy && this->_callable)
+        this->_destroy(this->_callable);
     this->_callable = ft_nullptr;
     this->_invoke = ft_nullptr;
     this->_destroy = ft_nullptr;
-    this->_clone = ft_nullptr;
+    this->_relocate = ft_nullptr;
     return ;
 }
 
 template <typename ReturnType, typename... Args>
 template <typename FunctionType>
-ReturnType ft_function<ReturnType(Args...)>::invoke(void *callable, Args... args)
+ReturnType ft_function_storage<ReturnType(Args...)>::invoke(void *callable, Args... args)
 {
     FunctionType *function;
 
@@ -75,7 +178,15 @@ ReturnType ft_function<ReturnType(Args...)>::invoke(void *callable, Args... args
 
 template <typename ReturnType, typename... Args>
 template <typename FunctionType>
-void ft_function<ReturnType(Args...)>::destroy(void *callable)
+void ft_function_storage<ReturnType(Args...)>::destroy_inline(void *callable)
+{
+    destroy_at(static_cast<FunctionType *>(callable));
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+template <typename FunctionType>
+void ft_function_storage<ReturnType(Args...)>::destroy_heap(void *callable)
 {
     FunctionType *function;
 
@@ -86,11 +197,72 @@ void ft_function<ReturnType(Args...)>::destroy(void *callable)
 
 template <typename ReturnType, typename... Args>
 template <typename FunctionType>
-void *ft_function<ReturnType(Args...)>::clone(void *callable)
+void *ft_function_storage<ReturnType(Args...)>::relocate_inline(void *callable, void *storage)
+{
+    FunctionType *function;
+    FunctionType *moved;
+
+    function = static_cast<FunctionType *>(callable);
+    moved = construct_at(static_cast<FunctionType *>(storage), ft_move(*function));
+    destroy_at(function);
+    return (moved);
+}
+
+template <typename ReturnType, typename... Args>
+void *ft_function_storage<ReturnType(Args...)>::relocate_heap(void *callable, void *storage)
+{
+    (void)storage;
+    return (callable);
+}
+
+template <typename ReturnType, typename... Args>
+ReturnType ft_function_storage<ReturnType(Args...)>::operator()(Args... args) const
+{
+    ReturnType (*invoke_target)(void *, Args...);
+    void *callable;
+
+    invoke_target = this->_invoke;
+    callable = this->_callable;
+    if (invoke_target == ft_nullptr || callable == ft_nullptr)
+    {
+        if constexpr (std::is_void<ReturnType>::value)
+        {
+            return ;
+        }
+        return (ReturnType());
+    }
+    return (invoke_target(callable, args...));
+}
+
+template <typename ReturnType, typename... Args>
+ft_function_storage<ReturnType(Args...)>::operator ft_bool() const noexcept
+{
+    return (this->_callable != ft_nullptr && this->_invoke != ft_nullptr);
+}
+
+template <typename ReturnType, typename... Args>
+ft_bool ft_function_storage<ReturnType(Args...)>::is_inline() const noexcept
+{
+    return (this->_callable != ft_nullptr
+        && this->_callable == static_cast<const void *>(this->_storage));
+}
+
+template <typename ReturnType, typename... Args>
+template <typename FunctionType>
+void *ft_function<ReturnType(Args...)>::clone_inline(void *callable, void *storage)
+{
+    return (construct_at(static_cast<FunctionType *>(storage),
+            *static_cast<FunctionType *>(callable)));
+}
+
+template <typename ReturnType, typename... Args>
+template <typename FunctionType>
+void *ft_function<ReturnType(Args...)>::clone_heap(void *callable, void *storage)
 {
     FunctionType *function;
     FunctionType *copy;
 
+    (void)storage;
     function = static_cast<FunctionType *>(callable);
     copy = new (std::nothrow) FunctionType(*function);
     return (copy);
@@ -98,59 +270,49 @@ void *ft_function<ReturnType(Args...)>::clone(void *callable)
 
 template <typename ReturnType, typename... Args>
 ft_function<ReturnType(Args...)>::ft_function()
-    : _callable(ft_nullptr), _invoke(ft_nullptr), _destroy(ft_nullptr),
-      _clone(ft_nullptr)
+    : ft_function_storage<ReturnType(Args...)>(), _clone(ft_nullptr)
 {
     return ;
 }
 
 template <typename ReturnType, typename... Args>
-template <typename FunctionType>
+template <typename FunctionType, typename>
 ft_function<ReturnType(Args...)>::ft_function(FunctionType function)
-    : _callable(ft_nullptr), _invoke(ft_nullptr), _destroy(ft_nullptr),
-      _clone(ft_nullptr)
+    : ft_function_storage<ReturnType(Args...)>(), _clone(ft_nullptr)
 {
-    FunctionType *copy;
-
-    copy = new (std::nothrow) FunctionType(ft_move(function));
-    if (copy == ft_nullptr)
-    {
+    if (!this->emplace_callable(ft_move(function)))
         return ;
-    }
-    this->_callable = copy;
-    this->_invoke = &ft_function<ReturnType(Args...)>::template invoke<FunctionType>;
-    this->_destroy = &ft_function<ReturnType(Args...)>::template destroy<FunctionType>;
-    this->_clone = &ft_function<ReturnType(Args...)>::template clone<FunctionType>;
+    if constexpr (ft_function_stores_inline<FunctionType>::value)
+        this->_clone = &ft_function::template clone_inline<FunctionType>;
+    else
+        this->_clone = &ft_function::template clone_heap<FunctionType>;
     return ;
 }
 
 template <typename ReturnType, typename... Args>
 ft_function<ReturnType(Args...)>::ft_function(const ft_function &other)
-    : _callable(ft_nullptr), _invoke(ft_nullptr), _destroy(ft_nullptr),
-      _clone(ft_nullptr)
+    : ft_function_storage<ReturnType(Args...)>(), _clone(ft_nullptr)
 {
-    if (other._callable == ft_nullptr)
-        return ;
     void *new_callable;
 
-    new_callable = other._clone(other._callable);
+    if (other._callable == ft_nullptr)
+        return ;
+    new_callable = other._clone(other._callable, this->_storage);
     if (new_callable == ft_nullptr)
         return ;
     this->_callable = new_callable;
     this->_invoke = other._invoke;
     this->_destroy = other._destroy;
+    this->_relocate = other._relocate;
     this->_clone = other._clone;
     return ;
 }
 
 template <typename ReturnType, typename... Args>
 ft_function<ReturnType(Args...)>::ft_function(ft_function &&other) noexcept
-    : _callable(other._callable), _invoke(other._invoke),
-      _destroy(other._destroy), _clone(other._clone)
+    : ft_function_storage<ReturnType(Args...)>(), _clone(other._clone)
 {
-    other._callable = ft_nullptr;
-    other._invoke = ft_nullptr;
-    other._destroy = ft_nullptr;
+    this->take_callable(other);
     other._clone = ft_nullptr;
     return ;
 }
@@ -159,6 +321,7 @@ template <typename ReturnType, typename... Args>
 ft_function<ReturnType(Args...)>::~ft_function()
 {
     this->clear_callable();
+    this->_clone = ft_nullptr;
     return ;
 }
 
@@ -167,18 +330,9 @@ ft_function<ReturnType(Args...)> &ft_function<ReturnType(Args...)>::operator=(co
 {
     if (this == &other)
         return (*this);
-    void *new_callable;
+    ft_function copy(other);
 
-    new_callable = ft_nullptr;
-    if (other._callable != ft_nullptr)
-        new_callable = other._clone(other._callable);
-    this->clear_callable();
-    if (new_callable == ft_nullptr)
-        return (*this);
-    this->_callable = new_callable;
-    this->_invoke = other._invoke;
-    this->_destroy = other._destroy;
-    this->_clone = other._clone;
+    *this = ft_move(copy);
     return (*this);
 }
 
@@ -188,40 +342,10 @@ ft_function<ReturnType(Args...)> &ft_function<ReturnType(Args...)>::operator=(ft
     if (this == &other)
         return (*this);
     this->clear_callable();
-    this->_callable = other._callable;
-    this->_invoke = other._invoke;
-    this->_destroy = other._destroy;
     this->_clone = other._clone;
-    other._callable = ft_nullptr;
-    other._invoke = ft_nullptr;
-    other._destroy = ft_nullptr;
+    this->take_callable(other);
     other._clone = ft_nullptr;
     return (*this);
 }
 
-template <typename ReturnType, typename... Args>
-ReturnType ft_function<ReturnType(Args...)>::operator()(Args... args) const
-{
-    ReturnType (*invoke_target)(void *, Args...);
-    void *callable;
-
-    invoke_target = this->_invoke;
-    callable = this->_callable;
-    if (invoke_target == ft_nullptr || callable == ft_nullptr)
-    {
-        if constexpr (std::is_void<ReturnType>::value)
-        {
-            return ;
-        }
-        return (ReturnType());
-    }
-    return (invoke_target(callable, args...));
-}
-
-template <typename ReturnType, typename... Args>
-ft_function<ReturnType(Args...)>::operator ft_bool() const noexcept
-{
-    return (this->_callable != ft_nullptr && this->_invoke != ft_nullptr);
-}
-
 #endif
@@ -15,6 +15,56 @@
 #include <cstdint>
 #include <new>
 
+template <typename VertexType>
+class ft_graph;
+
+// Immutable compressed-sparse-row copy of an ft_graph: the edges of vertex v
+// are targets[offsets[v]] .. targets[offsets[v + 1] - 1], with matching weights.
+template <typename WeightType>
+class ft_graph_csr
+{
+    private:
+        ft_size_t                   *_offsets;
+        ft_size_t                   *_targets;
+        WeightType                  *_weights;
+        ft_size_t                   _vertex_count;
+        ft_size_t                   _edge_count;
+        ft_size_t                   _vertex_capacity;
+        ft_size_t                   _edge_capacity;
+        uint8_t                     _initialised_state;
+        static thread_local int32_t _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        int32_t reserve(ft_size_t vertex_count, ft_size_t edge_count);
+
+        template <typename GraphVertexType>
+        friend class ft_graph;
+
+    public:
+        ft_graph_csr();
+        ft_graph_csr(const ft_graph_csr &other) = delete;
+        ft_graph_csr(ft_graph_csr &&other) = delete;
+        ~ft_graph_csr();
+        ft_graph_csr &operator=(const ft_graph_csr &other) = delete;
+        ft_graph_csr &operator=(ft_graph_csr &&other) = delete;
+
+        int32_t initialize();
+        int32_t destroy();
+
+        ft_size_t vertex_count() const;
+        ft_size_t edge_count() const;
+        ft_size_t edge_begin(ft_size_t vertex) const;
+        ft_size_t edge_end(ft_size_t vertex) const;
+        ft_size_t edge_target(ft_size_t edge) const;
+        WeightType edge_weight(ft_size_t edge) const;
+        const ft_size_t *offsets() const;
+        const ft_size_t *targets() const;
+        const WeightType *weights() const;
+
+        int32_t get_error() const noexcept;
+        const char *get_error_str() const noexcept;
+};
+
 template <typename VertexType>
 class ft_graph
 {
@@ -67,6 +117,12 @@ class ft_graph
         void dfs(ft_size_t start, Func visit);
 
         void neighbors(ft_size_t index, ft_vector<ft_size_t> &out) const;
+
+        template <typename WeightType>
+        int32_t snapshot(ft_graph_csr<WeightType> &out) const;
+
+        template <typename WeightType, typename WeightFunction>
+        int32_t snapshot(ft_graph_csr<WeightType> &out, WeightFunction weight) const;
         ft_size_t size() const;
         ft_bool empty() const;
         void clear();
@@ -809,4 +865,285 @@ const char *ft_graph<VertexType>::get_error_str() const noexcept
     return (ft_strerror(_last_error));
 }
 
+template <typename VertexType>
+template <typename WeightType>
+int32_t ft_graph<VertexType>::snapshot(ft_graph_csr<WeightType> &out) const
+{
+    return (this->snapshot(out, [](const VertexType &, const VertexType &)
+        {
+            return (static_cast<WeightType>(1));
+        }));
+}
+
+template <typename VertexType>
+template <typename WeightType, typename WeightFunction>
+int32_t ft_graph<VertexType>::snapshot(ft_graph_csr<WeightType> &out,
+    WeightFunction weight) const
+{
+    ft_bool lock_acquired;
+    int32_t error_code;
+    ft_size_t vertex;
+    ft_size_t edge_index;
+    ft_size_t edge_count;
+    const graph_node *node;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_graph::snapshot");
+    lock_acquired = FT_FALSE;
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (set_error(error_code));
+    edge_count = 0;
+    vertex = 0;
+    while (vertex < this->_size)
+    {
+        edge_count += this->_nodes[vertex]._degree;
+        ++vertex;
+    }
+    error_code = out.reserve(this->_size, edge_count);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        (void)this->unlock_internal(lock_acquired);
+        return (set_error(error_code));
+    }
+    edge_count = 0;
+    vertex = 0;
+    while (vertex < this->_size)
+    {
+        node = &this->_nodes[vertex];
+        out._offsets[vertex] = edge_count;
+        edge_index = 0;
+        while (edge_index < node->_degree)
+        {
+            out._targets[edge_count] = node->_edges[edge_index];
+            out._weights[edge_count] = weight(*node->_value_pointer,
+                    *this->_nodes[node->_edges[edge_index]]._value_pointer);
+            ++edge_count;
+            ++edge_index;
+        }
+        ++vertex;
+    }
+    out._offsets[this->_size] = edge_count;
+    out._vertex_count = this->_size;
+    out._edge_count = edge_count;
+    (void)this->unlock_internal(lock_acquired);
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename WeightType>
+thread_local int32_t ft_graph_csr<WeightType>::_last_error = FT_ERR_SUCCESS;
+
+template <typename WeightType>
+int32_t ft_graph_csr<WeightType>::set_error(int32_t error_code) noexcept
+{
+    _last_error = error_code;
+    return (error_code);
+}
+
+template <typename WeightType>
+ft_graph_csr<WeightType>::ft_graph_csr()
+    : _offsets(ft_nullptr)
+    , _targets(ft_nullptr)
+    , _weights(ft_nullptr)
+    , _vertex_count(0)
+    , _edge_count(0)
+    , _vertex_capacity(0)
+    , _edge_capacity(0)
+    , _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+template <typename WeightType>
+ft_graph_csr<WeightType>::~ft_graph_csr()
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+        (void)this->destroy();
+    return ;
+}
+
+template <typename WeightType>
+int32_t ft_graph_csr<WeightType>::initialize()
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "ft_graph_csr::initialize",
+            "called while object is already initialised");
+        return (set_error(FT_ERR_INVALID_STATE));
+    }
+    this->_offsets = ft_nullptr;
+    this->_targets = ft_nullptr;
+    this->_weights = ft_nullptr;
+    this->_vertex_count = 0;
+    this->_edge_count = 0;
+    this->_vertex_capacity = 0;
+    this->_edge_capacity = 0;
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename WeightType>
+int32_t ft_graph_csr<WeightType>::destroy()
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_SUCCESS));
+    cma_free(this->_offsets);
+    cma_free(this->_targets);
+    cma_free(this->_weights);
+    this->_offsets = ft_nullptr;
+    this->_targets = ft_nullptr;
+    this->_weights = ft_nullptr;
+    this->_vertex_count = 0;
+    this->_edge_count = 0;
+    this->_vertex_capacity = 0;
+    this->_edge_capacity = 0;
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename WeightType>
+int32_t ft_graph_csr<WeightType>::reserve(ft_size_t vertex_count, ft_size_t edge_count)
+{
+    ft_size_t *new_offsets;
+    ft_size_t *new_targets;
+    WeightType *new_weights;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::reserve");
+    this->_vertex_count = 0;
+    this->_edge_count = 0;
+    if (vertex_count + 1 > this->_vertex_capacity)
+    {
+        new_offsets = static_cast<ft_size_t *>(cma_realloc(this->_offsets,
+                    sizeof(ft_size_t) * (vertex_count + 1)));
+        if (new_offsets == ft_nullptr)
+            return (set_error(FT_ERR_NO_MEMORY));
+        this->_offsets = new_offsets;
+        this->_vertex_capacity = vertex_count + 1;
+    }
+    if (edge_count > this->_edge_capacity)
+    {
+        new_targets = static_cast<ft_size_t *>(cma_realloc(this->_targets,
+                    sizeof(ft_size_t) * edge_count));
+        if (new_targets == ft_nullptr)
+            return (set_error(FT_ERR_NO_MEMORY));
+        this->_targets = new_targets;
+        new_weights = static_cast<WeightType *>(cma_realloc(this->_weights,
+                    sizeof(WeightType) * edge_count));
+        if (new_weights == ft_nullptr)
+            return (set_error(FT_ERR_NO_MEMORY));
+        this->_weights = new_weights;
+        this->_edge_capacity = edge_count;
+    }
+    this->_offsets[0] = 0;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename WeightType>
+ft_size_t ft_graph_csr<WeightType>::vertex_count() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::vertex_count");
+    return (this->_vertex_count);
+}
+
+template <typename WeightType>
+ft_size_t ft_graph_csr<WeightType>::edge_count() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::edge_count");
+    return (this->_edge_count);
+}
+
+template <typename WeightType>
+ft_size_t ft_graph_csr<WeightType>::edge_begin(ft_size_t vertex) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::edge_begin");
+    if (vertex >= this->_vertex_count)
+    {
+        set_error(FT_ERR_OUT_OF_RANGE);
+        return (this->_edge_count);
+    }
+    set_error(FT_ERR_SUCCESS);
+    return (this->_offsets[vertex]);
+}
+
+template <typename WeightType>
+ft_size_t ft_graph_csr<WeightType>::edge_end(ft_size_t vertex) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::edge_end");
+    if (vertex >= this->_vertex_count)
+    {
+        set_error(FT_ERR_OUT_OF_RANGE);
+        return (this->_edge_count);
+    }
+    set_error(FT_ERR_SUCCESS);
+    return (this->_offsets[vertex + 1]);
+}
+
+template <typename WeightType>
+ft_size_t ft_graph_csr<WeightType>::edge_target(ft_size_t edge) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::edge_target");
+    if (edge >= this->_edge_count)
+    {
+        set_error(FT_ERR_OUT_OF_RANGE);
+        return (this->_vertex_count);
+    }
+    set_error(FT_ERR_SUCCESS);
+    return (this->_targets[edge]);
+}
+
+template <typename WeightType>
+WeightType ft_graph_csr<WeightType>::edge_weight(ft_size_t edge) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::edge_weight");
+    if (edge >= this->_edge_count)
+    {
+        set_error(FT_ERR_OUT_OF_RANGE);
+        return (WeightType());
+    }
+    set_error(FT_ERR_SUCCESS);
+    return (this->_weights[edge]);
+}
+
+template <typename WeightType>
+const ft_size_t *ft_graph_csr<WeightType>::offsets() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::offsets");
+    return (this->_offsets);
+}
+
+template <typename WeightType>
+const ft_size_t *ft_graph_csr<WeightType>::targets() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::targets");
+    return (this->_targets);
+}
+
+template <typename WeightType>
+const WeightType *ft_graph_csr<WeightType>::weights() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_csr::weights");
+    return (this->_weights);
+}
+
+template <typename WeightType>
+int32_t ft_graph_csr<WeightType>::get_error() const noexcept
+{
+    return (_last_error);
+}
+
+template <typename WeightType>
+const char *ft_graph_csr<WeightType>::get_error_str() const noexcept
+{
+    return (ft_strerror(_last_error));
+}
+
 #endif
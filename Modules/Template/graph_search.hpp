@@ -0,0 +1,602 @@
+#ifndef FT_GRAPH_SEARCH_HPP
+#define FT_GRAPH_SEARCH_HPP
+
+#include "graph.hpp"
+#include "indexed_heap.hpp"
+#include "vector.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Errno/errno.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include "../PThread/recursive_mutex.hpp"
+#include "../PThread/pthread_internal.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#define FT_GRAPH_SEARCH_NO_VERTEX FT_SYSTEM_SIZE_MAX
+
+// Reusable BFS, Dijkstra and A* over an ft_graph_csr snapshot. Per-vertex
+// state is generation stamped, so consecutive searches skip the O(V) reset.
+template <typename WeightType>
+class ft_graph_search
+{
+    private:
+        WeightType                      *_distances;
+        ft_size_t                       *_parents;
+        uint32_t                        *_stamps;
+        ft_size_t                       *_queue;
+        ft_size_t                       _capacity;
+        ft_size_t                       _vertex_count;
+        ft_size_t                       _source;
+        uint32_t                        _generation;
+        ft_indexed_heap<WeightType>     _heap;
+        mutable pt_recursive_mutex      *_mutex;
+        uint8_t                         _initialised_state;
+        static thread_local int32_t     _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        int32_t lock_internal(ft_bool *lock_acquired) const;
+        int32_t unlock_internal(ft_bool lock_acquired) const;
+
+        void release();
+        int32_t prepare(const ft_graph_csr<WeightType> &graph, ft_size_t start,
+                    ft_size_t goal);
+        ft_bool seen(ft_size_t vertex) const;
+        void visit(ft_size_t vertex, const WeightType &distance, ft_size_t parent);
+        int32_t build_path(ft_size_t goal, ft_vector<ft_size_t> &out) const;
+        template <typename Heuristic>
+        int32_t best_first(const ft_graph_csr<WeightType> &graph, ft_size_t start,
+                    ft_size_t goal, Heuristic heuristic);
+        template <typename Heuristic>
+        int32_t search_path(const ft_graph_csr<WeightType> &graph, ft_size_t start,
+                    ft_size_t goal, Heuristic heuristic, ft_vector<ft_size_t> &out);
+
+    public:
+        ft_graph_search();
+        ft_graph_search(const ft_graph_search &other) = delete;
+        ft_graph_search(ft_graph_search &&other) = delete;
+        ~ft_graph_search();
+        ft_graph_search &operator=(const ft_graph_search &other) = delete;
+        ft_graph_search &operator=(ft_graph_search &&other) = delete;
+
+        int32_t initialize();
+        int32_t destroy();
+        int32_t enable_thread_safety();
+        int32_t disable_thread_safety();
+        ft_bool is_thread_safe() const;
+
+        int32_t bfs(const ft_graph_csr<WeightType> &graph, ft_size_t start,
+                    ft_size_t goal, ft_vector<ft_size_t> &out);
+        int32_t dijkstra(const ft_graph_csr<WeightType> &graph, ft_size_t start,
+                    ft_size_t goal, ft_vector<ft_size_t> &out);
+        template <typename Heuristic>
+        int32_t astar(const ft_graph_csr<WeightType> &graph, ft_size_t start,
+                    ft_size_t goal, Heuristic heuristic, ft_vector<ft_size_t> &out);
+        int32_t shortest_path_tree(const ft_graph_csr<WeightType> &graph,
+                    ft_size_t start);
+
+        ft_bool reached(ft_size_t vertex) const;
+        WeightType distance_to(ft_size_t vertex) const;
+        int32_t extract_path(ft_size_t goal, ft_vector<ft_size_t> &out) const;
+
+        int32_t get_error() const noexcept;
+        const char *get_error_str() const noexcept;
+};
+
+template <typename WeightType>
+thread_local int32_t ft_graph_search<WeightType>::_last_error = FT_ERR_SUCCESS;
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::set_error(int32_t error_code) noexcept
+{
+    _last_error = error_code;
+    return (error_code);
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::lock_internal(ft_bool *lock_acquired) const
+{
+    int32_t lock_result;
+
+    if (lock_acquired != ft_nullptr)
+        *lock_acquired = FT_FALSE;
+    lock_result = pt_recursive_mutex_lock_if_not_null(this->_mutex);
+    if (lock_result != FT_ERR_SUCCESS)
+        return (lock_result);
+    if (lock_acquired != ft_nullptr && this->_mutex != ft_nullptr)
+        *lock_acquired = FT_TRUE;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::unlock_internal(ft_bool lock_acquired) const
+{
+    if (lock_acquired == FT_FALSE)
+        return (FT_ERR_SUCCESS);
+    (void)pt_recursive_mutex_unlock_if_not_null(this->_mutex);
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename WeightType>
+ft_graph_search<WeightType>::ft_graph_search()
+    : _distances(ft_nullptr)
+    , _parents(ft_nullptr)
+    , _stamps(ft_nullptr)
+    , _queue(ft_nullptr)
+    , _capacity(0)
+    , _vertex_count(0)
+    , _source(FT_GRAPH_SEARCH_NO_VERTEX)
+    , _generation(0)
+    , _heap()
+    , _mutex(ft_nullptr)
+    , _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+template <typename WeightType>
+ft_graph_search<WeightType>::~ft_graph_search()
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+        (void)this->destroy();
+    return ;
+}
+
+template <typename WeightType>
+void ft_graph_search<WeightType>::release()
+{
+    cma_free(this->_distances);
+    cma_free(this->_parents);
+    cma_free(this->_stamps);
+    cma_free(this->_queue);
+    this->_distances = ft_nullptr;
+    this->_parents = ft_nullptr;
+    this->_stamps = ft_nullptr;
+    this->_queue = ft_nullptr;
+    this->_capacity = 0;
+    this->_vertex_count = 0;
+    this->_source = FT_GRAPH_SEARCH_NO_VERTEX;
+    this->_generation = 0;
+    return ;
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::initialize()
+{
+    int32_t heap_error;
+
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "ft_graph_search::initialize",
+            "called while object is already initialised");
+        return (set_error(FT_ERR_INVALID_STATE));
+    }
+    heap_error = this->_heap.initialize();
+    if (heap_error != FT_ERR_SUCCESS)
+        return (set_error(heap_error));
+    this->release();
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::destroy()
+{
+    int32_t disable_error;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_SUCCESS));
+    this->release();
+    (void)this->_heap.destroy();
+    disable_error = this->disable_thread_safety();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (set_error(disable_error));
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::enable_thread_safety()
+{
+    pt_recursive_mutex *new_mutex;
+    int32_t initialize_result;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_search::enable_thread_safety");
+    if (this->_mutex != ft_nullptr)
+        return (set_error(FT_ERR_SUCCESS));
+    new_mutex = new (std::nothrow) pt_recursive_mutex();
+    if (new_mutex == ft_nullptr)
+        return (set_error(FT_ERR_NO_MEMORY));
+    initialize_result = new_mutex->initialize();
+    if (initialize_result != FT_ERR_SUCCESS)
+    {
+        delete new_mutex;
+        return (set_error(initialize_result));
+    }
+    this->_mutex = new_mutex;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::disable_thread_safety()
+{
+    pt_recursive_mutex *mutex_pointer;
+    int32_t destroy_result;
+
+    mutex_pointer = this->_mutex;
+    if (mutex_pointer == ft_nullptr)
+        return (set_error(FT_ERR_SUCCESS));
+    this->_mutex = ft_nullptr;
+    destroy_result = mutex_pointer->destroy();
+    delete mutex_pointer;
+    return (set_error(destroy_result));
+}
+
+template <typename WeightType>
+ft_bool ft_graph_search<WeightType>::is_thread_safe() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_search::is_thread_safe");
+    return (this->_mutex != ft_nullptr);
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::prepare(const ft_graph_csr<WeightType> &graph,
+    ft_size_t start, ft_size_t goal)
+{
+    WeightType *new_distances;
+    ft_size_t *new_parents;
+    uint32_t *new_stamps;
+    ft_size_t *new_queue;
+    ft_size_t vertex_count;
+    int32_t heap_error;
+
+    vertex_count = graph.vertex_count();
+    this->_vertex_count = 0;
+    this->_source = FT_GRAPH_SEARCH_NO_VERTEX;
+    if (start >= vertex_count
+        || (goal != FT_GRAPH_SEARCH_NO_VERTEX && goal >= vertex_count))
+        return (FT_ERR_OUT_OF_RANGE);
+    if (vertex_count > this->_capacity)
+    {
+        new_distances = static_cast<WeightType *>(cma_realloc(this->_distances,
+                    sizeof(WeightType) * vertex_count));
+        if (new_distances == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        this->_distances = new_distances;
+        new_parents = static_cast<ft_size_t *>(cma_realloc(this->_parents,
+                    sizeof(ft_size_t) * vertex_count));
+        if (new_parents == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        this->_parents = new_parents;
+        new_queue = static_cast<ft_size_t *>(cma_realloc(this->_queue,
+                    sizeof(ft_size_t) * vertex_count));
+        if (new_queue == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        this->_queue = new_queue;
+        new_stamps = static_cast<uint32_t *>(cma_realloc(this->_stamps,
+                    sizeof(uint32_t) * vertex_count));
+        if (new_stamps == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        this->_stamps = new_stamps;
+        while (this->_capacity < vertex_count)
+        {
+            this->_stamps[this->_capacity] = 0;
+            this->_capacity++;
+        }
+    }
+    heap_error = this->_heap.reserve(vertex_count);
+    if (heap_error != FT_ERR_SUCCESS)
+        return (heap_error);
+    this->_heap.clear();
+    this->_generation++;
+    if (this->_generation == 0)
+    {
+        ft_size_t index;
+
+        index = 0;
+        while (index < this->_capacity)
+        {
+            this->_stamps[index] = 0;
+            index++;
+        }
+        this->_generation = 1;
+    }
+    this->_vertex_count = vertex_count;
+    this->_source = start;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename WeightType>
+ft_bool ft_graph_search<WeightType>::seen(ft_size_t vertex) const
+{
+    return (this->_stamps[vertex] == this->_generation);
+}
+
+template <typename WeightType>
+void ft_graph_search<WeightType>::visit(ft_size_t vertex, const WeightType &distance,
+    ft_size_t parent)
+{
+    this->_stamps[vertex] = this->_generation;
+    this->_distances[vertex] = distance;
+    this->_parents[vertex] = parent;
+    return ;
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::build_path(ft_size_t goal,
+    ft_vector<ft_size_t> &out) const
+{
+    ft_size_t vertex;
+    ft_size_t length;
+
+    out.clear();
+    length = 0;
+    vertex = goal;
+    while (vertex != FT_GRAPH_SEARCH_NO_VERTEX)
+    {
+        length++;
+        vertex = this->_parents[vertex];
+    }
+    out.resize(length, 0);
+    if (out.size() != length)
+        return (FT_ERR_NO_MEMORY);
+    vertex = goal;
+    while (length > 0)
+    {
+        length--;
+        out[length] = vertex;
+        vertex = this->_parents[vertex];
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+// Relaxed vertices are re-keyed in place; a vertex improved after it was
+// popped is simply queued again, so inconsistent heuristics stay correct.
+template <typename WeightType>
+template <typename Heuristic>
+int32_t ft_graph_search<WeightType>::best_first(const ft_graph_csr<WeightType> &graph,
+    ft_size_t start, ft_size_t goal, Heuristic heuristic)
+{
+    const ft_size_t *offsets;
+    const ft_size_t *targets;
+    const WeightType *weights;
+    ft_size_t current;
+    ft_size_t edge;
+    ft_size_t edge_end;
+    ft_size_t target;
+    WeightType candidate;
+    int32_t error_code;
+
+    offsets = graph.offsets();
+    targets = graph.targets();
+    weights = graph.weights();
+    this->visit(start, WeightType(), FT_GRAPH_SEARCH_NO_VERTEX);
+    error_code = this->_heap.push_or_decrease(start, heuristic(start));
+    while (error_code == FT_ERR_SUCCESS && this->_heap.size() > 0)
+    {
+        error_code = this->_heap.pop(&current, ft_nullptr);
+        if (error_code != FT_ERR_SUCCESS || current == goal)
+            break ;
+        edge = offsets[current];
+        edge_end = offsets[current + 1];
+        while (edge < edge_end)
+        {
+            target = targets[edge];
+            candidate = this->_distances[current] + weights[edge];
+            if (!this->seen(target) || candidate < this->_distances[target])
+            {
+                this->visit(target, candidate, current);
+                error_code = this->_heap.push_or_decrease(target,
+                        candidate + heuristic(target));
+                if (error_code != FT_ERR_SUCCESS)
+                    break ;
+            }
+            edge++;
+        }
+    }
+    return (error_code);
+}
+
+template <typename WeightType>
+template <typename Heuristic>
+int32_t ft_graph_search<WeightType>::search_path(const ft_graph_csr<WeightType> &graph,
+    ft_size_t start, ft_size_t goal, Heuristic heuristic, ft_vector<ft_size_t> &out)
+{
+    ft_bool lock_acquired;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_search::search");
+    out.clear();
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (set_error(error_code));
+    error_code = this->prepare(graph, start, goal);
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = this->best_first(graph, start, goal, heuristic);
+    if (error_code == FT_ERR_SUCCESS && goal != FT_GRAPH_SEARCH_NO_VERTEX)
+    {
+        if (!this->seen(goal))
+            error_code = FT_ERR_NOT_FOUND;
+        else
+            error_code = this->build_path(goal, out);
+    }
+    (void)this->unlock_internal(lock_acquired);
+    return (set_error(error_code));
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::bfs(const ft_graph_csr<WeightType> &graph,
+    ft_size_t start, ft_size_t goal, ft_vector<ft_size_t> &out)
+{
+    const ft_size_t *offsets;
+    const ft_size_t *targets;
+    ft_size_t head;
+    ft_size_t tail;
+    ft_size_t current;
+    ft_size_t edge;
+    ft_size_t target;
+    ft_bool lock_acquired;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_search::bfs");
+    out.clear();
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (set_error(error_code));
+    error_code = this->prepare(graph, start, goal);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        (void)this->unlock_internal(lock_acquired);
+        return (set_error(error_code));
+    }
+    offsets = graph.offsets();
+    targets = graph.targets();
+    this->visit(start, WeightType(), FT_GRAPH_SEARCH_NO_VERTEX);
+    this->_queue[0] = start;
+    head = 0;
+    tail = 1;
+    while (head < tail && !this->seen(goal))
+    {
+        current = this->_queue[head];
+        head++;
+        edge = offsets[current];
+        while (edge < offsets[current + 1])
+        {
+            target = targets[edge];
+            if (!this->seen(target))
+            {
+                this->visit(target, this->_distances[current]
+                    + static_cast<WeightType>(1), current);
+                this->_queue[tail] = target;
+                tail++;
+            }
+            edge++;
+        }
+    }
+    if (!this->seen(goal))
+        error_code = FT_ERR_NOT_FOUND;
+    else
+        error_code = this->build_path(goal, out);
+    (void)this->unlock_internal(lock_acquired);
+    return (set_error(error_code));
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::dijkstra(const ft_graph_csr<WeightType> &graph,
+    ft_size_t start, ft_size_t goal, ft_vector<ft_size_t> &out)
+{
+    return (this->search_path(graph, start, goal, [](ft_size_t)
+        {
+            return (WeightType());
+        }, out));
+}
+
+template <typename WeightType>
+template <typename Heuristic>
+int32_t ft_graph_search<WeightType>::astar(const ft_graph_csr<WeightType> &graph,
+    ft_size_t start, ft_size_t goal, Heuristic heuristic, ft_vector<ft_size_t> &out)
+{
+    if (goal == FT_GRAPH_SEARCH_NO_VERTEX)
+        return (set_error(FT_ERR_OUT_OF_RANGE));
+    return (this->search_path(graph, start, goal, [&heuristic, goal](ft_size_t vertex)
+        {
+            return (static_cast<WeightType>(heuristic(vertex, goal)));
+        }, out));
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::shortest_path_tree(
+    const ft_graph_csr<WeightType> &graph, ft_size_t start)
+{
+    ft_vector<ft_size_t> unused_path;
+
+    return (this->search_path(graph, start, FT_GRAPH_SEARCH_NO_VERTEX, [](ft_size_t)
+        {
+            return (WeightType());
+        }, unused_path));
+}
+
+template <typename WeightType>
+ft_bool ft_graph_search<WeightType>::reached(ft_size_t vertex) const
+{
+    ft_bool lock_acquired;
+    ft_bool result;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_search::reached");
+    if (this->lock_internal(&lock_acquired) != FT_ERR_SUCCESS)
+        return (FT_FALSE);
+    result = FT_FALSE;
+    if (vertex < this->_vertex_count && this->seen(vertex))
+        result = FT_TRUE;
+    (void)this->unlock_internal(lock_acquired);
+    return (result);
+}
+
+template <typename WeightType>
+WeightType ft_graph_search<WeightType>::distance_to(ft_size_t vertex) const
+{
+    ft_bool lock_acquired;
+    WeightType distance;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_search::distance_to");
+    distance = WeightType();
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        set_error(error_code);
+        return (distance);
+    }
+    if (vertex >= this->_vertex_count)
+        error_code = FT_ERR_OUT_OF_RANGE;
+    else if (!this->seen(vertex))
+        error_code = FT_ERR_NOT_FOUND;
+    else
+        distance = this->_distances[vertex];
+    (void)this->unlock_internal(lock_acquired);
+    set_error(error_code);
+    return (distance);
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::extract_path(ft_size_t goal,
+    ft_vector<ft_size_t> &out) const
+{
+    ft_bool lock_acquired;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_graph_search::extract_path");
+    out.clear();
+    error_code = this->lock_internal(&lock_acquired);
+    if (error_code != FT_ERR_SUCCESS)
+        return (set_error(error_code));
+    if (goal >= this->_vertex_count)
+        error_code = FT_ERR_OUT_OF_RANGE;
+    else if (!this->seen(goal))
+        error_code = FT_ERR_NOT_FOUND;
+    else
+        error_code = this->build_path(goal, out);
+    (void)this->unlock_internal(lock_acquired);
+    return (set_error(error_code));
+}
+
+template <typename WeightType>
+int32_t ft_graph_search<WeightType>::get_error() const noexcept
+{
+    return (_last_error);
+}
+
+template <typename WeightType>
+const char *ft_graph_search<WeightType>::get_error_str() const noexcept
+{
+    return (ft_strerror(_last_error));
+}
+
+#endif
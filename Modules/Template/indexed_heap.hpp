@@ -0,0 +1,328 @@
+#ifndef FT_INDEXED_HEAP_HPP
+#define FT_INDEXED_HEAP_HPP
+
+#include "../CMA/CMA.hpp"
+#include "../Errno/errno.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Basic/limits.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#define FT_INDEXED_HEAP_ABSENT FT_SYSTEM_SIZE_MAX
+
+// Min-heap over item ids in [0, capacity) with O(1) lookup of an item's slot,
+// so a smaller key for a queued item is applied in place instead of pushed twice.
+template <typename KeyType, ft_size_t Arity = 4>
+class ft_indexed_heap
+{
+    private:
+        struct heap_slot
+        {
+            KeyType     _key;
+            ft_size_t   _item;
+        };
+
+        heap_slot                   *_slots;
+        ft_size_t                   *_positions;
+        ft_size_t                   _size;
+        ft_size_t                   _capacity;
+        uint8_t                     _initialised_state;
+        static thread_local int32_t _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        void sift_up(ft_size_t index, heap_slot slot) noexcept;
+        void sift_down(ft_size_t index, heap_slot slot) noexcept;
+
+    public:
+        ft_indexed_heap();
+        ft_indexed_heap(const ft_indexed_heap &other) = delete;
+        ft_indexed_heap(ft_indexed_heap &&other) = delete;
+        ~ft_indexed_heap();
+        ft_indexed_heap &operator=(const ft_indexed_heap &other) = delete;
+        ft_indexed_heap &operator=(ft_indexed_heap &&other) = delete;
+
+        int32_t initialize();
+        int32_t destroy();
+
+        int32_t reserve(ft_size_t item_count);
+        int32_t push_or_decrease(ft_size_t item, const KeyType &key);
+        int32_t pop(ft_size_t *item, KeyType *key);
+        ft_bool contains(ft_size_t item) const;
+        KeyType key_of(ft_size_t item) const;
+
+        ft_size_t size() const;
+        ft_size_t capacity() const;
+        ft_bool empty() const;
+        void clear();
+
+        int32_t get_error() const noexcept;
+        const char *get_error_str() const noexcept;
+};
+
+template <typename KeyType, ft_size_t Arity>
+thread_local int32_t ft_indexed_heap<KeyType, Arity>::_last_error = FT_ERR_SUCCESS;
+
+template <typename KeyType, ft_size_t Arity>
+int32_t ft_indexed_heap<KeyType, Arity>::set_error(int32_t error_code) noexcept
+{
+    _last_error = error_code;
+    return (error_code);
+}
+
+template <typename KeyType, ft_size_t Arity>
+void ft_indexed_heap<KeyType, Arity>::sift_up(ft_size_t index, heap_slot slot) noexcept
+{
+    ft_size_t parent;
+
+    while (index > 0)
+    {
+        parent = (index - 1) / Arity;
+        if (!(slot._key < this->_slots[parent]._key))
+            break ;
+        this->_slots[index] = this->_slots[parent];
+        this->_positions[this->_slots[index]._item] = index;
+        index = parent;
+    }
+    this->_slots[index] = slot;
+    this->_positions[slot._item] = index;
+    return ;
+}
+
+template <typename KeyType, ft_size_t Arity>
+void ft_indexed_heap<KeyType, Arity>::sift_down(ft_size_t index, heap_slot slot) noexcept
+{
+    ft_size_t first_child;
+    ft_size_t last_child;
+    ft_size_t child;
+    ft_size_t best;
+
+    while (FT_TRUE)
+    {
+        first_child = index * Arity + 1;
+        if (first_child >= this->_size)
+            break ;
+        last_child = first_child + Arity;
+        if (last_child > this->_size)
+            last_child = this->_size;
+        best = first_child;
+        child = first_child + 1;
+        while (child < last_child)
+        {
+            if (this->_slots[child]._key < this->_slots[best]._key)
+                best = child;
+            child++;
+        }
+        if (!(this->_slots[best]._key < slot._key))
+            break ;
+        this->_slots[index] = this->_slots[best];
+        this->_positions[this->_slots[index]._item] = index;
+        index = best;
+    }
+    this->_slots[index] = slot;
+    this->_positions[slot._item] = index;
+    return ;
+}
+
+template <typename KeyType, ft_size_t Arity>
+ft_indexed_heap<KeyType, Arity>::ft_indexed_heap()
+    : _slots(ft_nullptr), _positions(ft_nullptr), _size(0), _capacity(0),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    static_assert(Arity >= 2, "ft_indexed_heap needs at least two children per node");
+    static_assert(std::is_trivially_copyable<KeyType>::value,
+        "ft_indexed_heap grows its slots with cma_realloc and needs a trivially copyable key");
+    return ;
+}
+
+template <typename KeyType, ft_size_t Arity>
+ft_indexed_heap<KeyType, Arity>::~ft_indexed_heap()
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+        (void)this->destroy();
+    return ;
+}
+
+template <typename KeyType, ft_size_t Arity>
+int32_t ft_indexed_heap<KeyType, Arity>::initialize()
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "ft_indexed_heap::initialize",
+            "called while object is already initialised");
+        return (set_error(FT_ERR_INVALID_STATE));
+    }
+    this->_slots = ft_nullptr;
+    this->_positions = ft_nullptr;
+    this->_size = 0;
+    this->_capacity = 0;
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename KeyType, ft_size_t Arity>
+int32_t ft_indexed_heap<KeyType, Arity>::destroy()
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_SUCCESS));
+    cma_free(this->_slots);
+    cma_free(this->_positions);
+    this->_slots = ft_nullptr;
+    this->_positions = ft_nullptr;
+    this->_size = 0;
+    this->_capacity = 0;
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename KeyType, ft_size_t Arity>
+int32_t ft_indexed_heap<KeyType, Arity>::reserve(ft_size_t item_count)
+{
+    heap_slot *new_slots;
+    ft_size_t *new_positions;
+    ft_size_t index;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::reserve");
+    if (item_count <= this->_capacity)
+        return (set_error(FT_ERR_SUCCESS));
+    new_slots = static_cast<heap_slot *>(cma_realloc(this->_slots,
+                sizeof(heap_slot) * item_count));
+    if (new_slots == ft_nullptr)
+        return (set_error(FT_ERR_NO_MEMORY));
+    this->_slots = new_slots;
+    new_positions = static_cast<ft_size_t *>(cma_realloc(this->_positions,
+                sizeof(ft_size_t) * item_count));
+    if (new_positions == ft_nullptr)
+        return (set_error(FT_ERR_NO_MEMORY));
+    this->_positions = new_positions;
+    index = this->_capacity;
+    while (index < item_count)
+    {
+        this->_positions[index] = FT_INDEXED_HEAP_ABSENT;
+        index++;
+    }
+    this->_capacity = item_count;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename KeyType, ft_size_t Arity>
+int32_t ft_indexed_heap<KeyType, Arity>::push_or_decrease(ft_size_t item, const KeyType &key)
+{
+    heap_slot slot;
+    ft_size_t position;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::push_or_decrease");
+    if (item >= this->_capacity)
+        return (set_error(FT_ERR_OUT_OF_RANGE));
+    slot._key = key;
+    slot._item = item;
+    position = this->_positions[item];
+    if (position == FT_INDEXED_HEAP_ABSENT)
+    {
+        this->_size++;
+        this->sift_up(this->_size - 1, slot);
+    }
+    else if (key < this->_slots[position]._key)
+        this->sift_up(position, slot);
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename KeyType, ft_size_t Arity>
+int32_t ft_indexed_heap<KeyType, Arity>::pop(ft_size_t *item, KeyType *key)
+{
+    heap_slot top;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::pop");
+    if (this->_size == 0)
+        return (set_error(FT_ERR_EMPTY));
+    top = this->_slots[0];
+    this->_positions[top._item] = FT_INDEXED_HEAP_ABSENT;
+    this->_size--;
+    if (this->_size > 0)
+        this->sift_down(0, this->_slots[this->_size]);
+    if (item != ft_nullptr)
+        *item = top._item;
+    if (key != ft_nullptr)
+        *key = top._key;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename KeyType, ft_size_t Arity>
+ft_bool ft_indexed_heap<KeyType, Arity>::contains(ft_size_t item) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::contains");
+    if (item >= this->_capacity)
+        return (FT_FALSE);
+    return (this->_positions[item] != FT_INDEXED_HEAP_ABSENT);
+}
+
+template <typename KeyType, ft_size_t Arity>
+KeyType ft_indexed_heap<KeyType, Arity>::key_of(ft_size_t item) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::key_of");
+    if (item >= this->_capacity || this->_positions[item] == FT_INDEXED_HEAP_ABSENT)
+    {
+        set_error(FT_ERR_NOT_FOUND);
+        return (KeyType());
+    }
+    set_error(FT_ERR_SUCCESS);
+    return (this->_slots[this->_positions[item]]._key);
+}
+
+template <typename KeyType, ft_size_t Arity>
+ft_size_t ft_indexed_heap<KeyType, Arity>::size() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::size");
+    return (this->_size);
+}
+
+template <typename KeyType, ft_size_t Arity>
+ft_size_t ft_indexed_heap<KeyType, Arity>::capacity() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::capacity");
+    return (this->_capacity);
+}
+
+template <typename KeyType, ft_size_t Arity>
+ft_bool ft_indexed_heap<KeyType, Arity>::empty() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::empty");
+    return (this->_size == 0);
+}
+
+template <typename KeyType, ft_size_t Arity>
+void ft_indexed_heap<KeyType, Arity>::clear()
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_indexed_heap::clear");
+    while (this->_size > 0)
+    {
+        this->_size--;
+        this->_positions[this->_slots[this->_size]._item] = FT_INDEXED_HEAP_ABSENT;
+    }
+    set_error(FT_ERR_SUCCESS);
+    return ;
+}
+
+template <typename KeyType, ft_size_t Arity>
+int32_t ft_indexed_heap<KeyType, Arity>::get_error() const noexcept
+{
+    return (_last_error);
+}
+
+template <typename KeyType, ft_size_t Arity>
+const char *ft_indexed_heap<KeyType, Arity>::get_error_str() const noexcept
+{
+    return (ft_strerror(_last_error));
+}
+
+#endif
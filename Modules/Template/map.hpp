@@ -4,6 +4,7 @@
 #include "pair.hpp"
 #include "constructor.hpp"
 #include "move.hpp"
+#include "../Basic/basic.hpp"
 #include "../Basic/limits.hpp"
 #include "../CMA/CMA.hpp"
 #include "../Errno/errno.hpp"
@@ -35,6 +36,14 @@ class ft_map
 
         ft_bool    ensure_capacity(ft_size_t desired_capacity);
         ft_size_t  find_index(const Key& key) const;
+        ft_size_t  lower_bound_index(const Key& key) const;
+        ft_size_t  upper_bound_index(const Key& key) const;
+        ft_bool    grow_unlocked();
+        int32_t    relocate_slot_unlocked(ft_size_t destination, ft_size_t source);
+        int32_t    open_slot_unlocked(ft_size_t index);
+        int32_t    close_slot_unlocked(ft_size_t index);
+        int32_t    assign_value_unlocked(ft_size_t index, const MappedType& value);
+        int32_t    assign_value_unlocked(ft_size_t index, MappedType&& value);
         void    destroy_all_unlocked();
         Pair<Key, MappedType>*  end_pointer_unlocked();
         const Pair<Key, MappedType>* end_pointer_unlocked() const;
@@ -100,8 +109,20 @@ class ft_map
         void        clear();
         ft_size_t      size() const;
         ft_size_t      capacity() const;
+        Pair<Key, MappedType>* begin();
+        const Pair<Key, MappedType>* begin() const;
         Pair<Key, MappedType>* end();
         const Pair<Key, MappedType>* end() const;
+        Pair<Key, MappedType>* lower_bound(const Key& key);
+        const Pair<Key, MappedType>* lower_bound(const Key& key) const;
+        Pair<Key, MappedType>* upper_bound(const Key& key);
+        const Pair<Key, MappedType>* upper_bound(const Key& key) const;
+        int32_t     range(const Key& lower_key, const Key& upper_key,
+                        Pair<Key, MappedType>** range_begin,
+                        Pair<Key, MappedType>** range_end);
+        int32_t     range(const Key& lower_key, const Key& upper_key,
+                        const Pair<Key, MappedType>** range_begin,
+                        const Pair<Key, MappedType>** range_end) const;
         MappedType& at(const Key& key);
         const MappedType& at(const Key& key) const;
 
@@ -376,15 +397,211 @@ template <typename Key, typename MappedType>
 ft_size_t ft_map<Key, MappedType>::find_index(const Key& key) const
 {
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::find_index");
-    ft_size_t index = 0;
+    ft_size_t index = this->lower_bound_index(key);
 
-    while (index < this->_size)
+    if (index < this->_size && !(key < this->_data[index].key))
+        return (index);
+    return (this->_size);
+}
+
+template <typename Key, typename MappedType>
+ft_size_t ft_map<Key, MappedType>::lower_bound_index(const Key& key) const
+{
+    ft_size_t low = 0;
+    ft_size_t high = this->_size;
+    ft_size_t middle;
+
+    while (low < high)
     {
-        if (this->_data[index].key == key)
-            return (index);
-        index++;
+        middle = low + (high - low) / 2;
+        if (this->_data[middle].key < key)
+            low = middle + 1;
+        else
+            high = middle;
     }
-    return (this->_size);
+    return (low);
+}
+
+template <typename Key, typename MappedType>
+ft_size_t ft_map<Key, MappedType>::upper_bound_index(const Key& key) const
+{
+    ft_size_t low = 0;
+    ft_size_t high = this->_size;
+    ft_size_t middle;
+
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        if (key < this->_data[middle].key)
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    return (low);
+}
+
+template <typename Key, typename MappedType>
+ft_bool ft_map<Key, MappedType>::grow_unlocked()
+{
+    ft_size_t next_capacity;
+
+    if (this->_size < this->_capacity)
+        return (FT_TRUE);
+    if (this->_capacity == 0)
+        next_capacity = 1;
+    else
+    {
+        next_capacity = this->_capacity * 2;
+        if (next_capacity <= this->_capacity)
+        {
+            next_capacity = this->_capacity + 1;
+            if (next_capacity == 0)
+                return (FT_FALSE);
+        }
+    }
+    return (this->ensure_capacity(next_capacity));
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_map<Key, MappedType>::relocate_slot_unlocked(ft_size_t destination,
+    ft_size_t source)
+{
+    if constexpr (std::is_move_assignable<Key>::value)
+        this->_data[destination].key = ft_move(this->_data[source].key);
+    else
+        this->_data[destination].key = this->_data[source].key;
+    if constexpr (ft_map<Key, MappedType>::template has_destroy<MappedType>::value
+        && ft_map<Key, MappedType>::template has_initialize_copy<MappedType>::value)
+    {
+        int32_t destroy_error = this->_data[destination].value.destroy();
+        if (destroy_error != FT_ERR_SUCCESS)
+            return (destroy_error);
+        return (this->_data[destination].value.initialize(this->_data[source].value));
+    }
+    else if constexpr (std::is_move_assignable<MappedType>::value)
+        this->_data[destination].value = ft_move(this->_data[source].value);
+    else if constexpr (std::is_copy_assignable<MappedType>::value)
+        this->_data[destination].value = this->_data[source].value;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_map<Key, MappedType>::open_slot_unlocked(ft_size_t index)
+{
+    if constexpr (std::is_trivially_copyable<Key>::value
+        && std::is_trivially_copyable<MappedType>::value)
+    {
+        ft_memmove(&this->_data[index + 1], &this->_data[index],
+            sizeof(Pair<Key, MappedType>) * (this->_size - index));
+        this->_size += 1;
+        return (FT_ERR_SUCCESS);
+    }
+    else
+    {
+        Pair<Key, MappedType> &previous = this->_data[this->_size - 1];
+        Pair<Key, MappedType> &tail = this->_data[this->_size];
+        ft_size_t slot;
+
+        construct_at(&tail);
+        if constexpr (ft_map<Key, MappedType>::template has_initialize_copy<Key>::value)
+        {
+            int32_t key_initialize_error = tail.key.initialize(previous.key);
+            if (key_initialize_error != FT_ERR_SUCCESS)
+            {
+                destroy_at(&tail);
+                return (key_initialize_error);
+            }
+        }
+        else
+            tail.key = previous.key;
+        if constexpr (ft_map<Key, MappedType>::template has_initialize_copy<MappedType>::value)
+        {
+            int32_t initialize_error = tail.value.initialize(previous.value);
+            if (initialize_error != FT_ERR_SUCCESS)
+            {
+                if constexpr (ft_map<Key, MappedType>::template has_destroy<Key>::value)
+                    (void)tail.key.destroy();
+                destroy_at(&tail);
+                return (initialize_error);
+            }
+        }
+        else if constexpr (std::is_move_assignable<MappedType>::value)
+            tail.value = ft_move(previous.value);
+        else if constexpr (std::is_copy_assignable<MappedType>::value)
+            tail.value = previous.value;
+        this->_size += 1;
+        slot = this->_size - 2;
+        while (slot > index)
+        {
+            int32_t relocate_error = this->relocate_slot_unlocked(slot, slot - 1);
+            if (relocate_error != FT_ERR_SUCCESS)
+                return (relocate_error);
+            slot--;
+        }
+        return (FT_ERR_SUCCESS);
+    }
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_map<Key, MappedType>::close_slot_unlocked(ft_size_t index)
+{
+    if constexpr (std::is_trivially_copyable<Key>::value
+        && std::is_trivially_copyable<MappedType>::value)
+    {
+        ft_memmove(&this->_data[index], &this->_data[index + 1],
+            sizeof(Pair<Key, MappedType>) * (this->_size - index - 1));
+        this->_size -= 1;
+        return (FT_ERR_SUCCESS);
+    }
+    else
+    {
+        ft_size_t slot = index;
+
+        while (slot + 1 < this->_size)
+        {
+            int32_t relocate_error = this->relocate_slot_unlocked(slot, slot + 1);
+            if (relocate_error != FT_ERR_SUCCESS)
+                return (relocate_error);
+            slot++;
+        }
+        destroy_at(&this->_data[this->_size - 1]);
+        this->_size -= 1;
+        return (FT_ERR_SUCCESS);
+    }
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_map<Key, MappedType>::assign_value_unlocked(ft_size_t index,
+    const MappedType& value)
+{
+    if constexpr (ft_map<Key, MappedType>::template has_destroy<MappedType>::value
+        && ft_map<Key, MappedType>::template has_initialize_copy<MappedType>::value)
+    {
+        int32_t destroy_error = this->_data[index].value.destroy();
+        if (destroy_error != FT_ERR_SUCCESS)
+            return (destroy_error);
+        return (this->_data[index].value.initialize(value));
+    }
+    else if constexpr (std::is_copy_assignable<MappedType>::value)
+        this->_data[index].value = value;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_map<Key, MappedType>::assign_value_unlocked(ft_size_t index,
+    MappedType&& value)
+{
+    if constexpr (ft_map<Key, MappedType>::template has_destroy<MappedType>::value
+        && ft_map<Key, MappedType>::template has_initialize_move<MappedType>::value)
+    {
+        int32_t destroy_error = this->_data[index].value.destroy();
+        if (destroy_error != FT_ERR_SUCCESS)
+            return (destroy_error);
+        return (this->_data[index].value.initialize(ft_move(value)));
+    }
+    else if constexpr (std::is_move_assignable<MappedType>::value)
+        this->_data[index].value = ft_move(value);
+    return (FT_ERR_SUCCESS);
 }
 
 template <typename Key, typename MappedType>
@@ -510,56 +727,32 @@ void ft_map<Key, MappedType>::insert(const Key& key, const MappedType& value)
         this->set_error(lock_error);
         return ;
     }
-    ft_size_t index = this->find_index(key);
+    ft_size_t index = this->lower_bound_index(key);
+    int32_t assign_error;
 
-    if (index != this->_size)
+    if (index < this->_size && !(key < this->_data[index].key))
     {
-        if constexpr (ft_map<Key, MappedType>::template has_destroy<MappedType>::value
-            && ft_map<Key, MappedType>::template has_initialize_copy<MappedType>::value)
-        {
-            int32_t destroy_error = this->_data[index].value.destroy();
-            if (destroy_error != FT_ERR_SUCCESS)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                this->set_error(destroy_error);
-                return ;
-            }
-            int32_t initialize_error = this->_data[index].value.initialize(value);
-            if (initialize_error != FT_ERR_SUCCESS)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                this->set_error(initialize_error);
-                return ;
-            }
-        }
-        else if constexpr (std::is_copy_assignable<MappedType>::value)
-            this->_data[index].value = value;
+        assign_error = this->assign_value_unlocked(index, value);
         (void)this->unlock_internal(lock_acquired);
-        this->set_error(FT_ERR_SUCCESS);
+        this->set_error(assign_error);
         return ;
     }
-    ft_size_t next_capacity;
-
-    if (this->_capacity == 0)
-        next_capacity = 1;
-    else
+    if (!this->grow_unlocked())
     {
-        next_capacity = this->_capacity * 2;
-        if (next_capacity <= this->_capacity)
-        {
-            ft_size_t incremented_capacity = this->_capacity + 1;
-            if (incremented_capacity == 0)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                return ;
-            }
-            next_capacity = incremented_capacity;
-        }
+        (void)this->unlock_internal(lock_acquired);
+        this->set_error(FT_ERR_NO_MEMORY);
+        return ;
     }
-    if (!this->ensure_capacity(next_capacity))
+    if (index < this->_size)
     {
+        assign_error = this->open_slot_unlocked(index);
+        if (assign_error == FT_ERR_SUCCESS)
+        {
+            this->_data[index].key = key;
+            assign_error = this->assign_value_unlocked(index, value);
+        }
         (void)this->unlock_internal(lock_acquired);
-        this->set_error(FT_ERR_NO_MEMORY);
+        this->set_error(assign_error);
         return ;
     }
     if constexpr (ft_map<Key, MappedType>::template has_initialize_copy<MappedType>::value)
@@ -627,56 +820,32 @@ void ft_map<Key, MappedType>::insert(const Key& key, MappedType&& value)
         this->set_error(lock_error);
         return ;
     }
-    ft_size_t index = this->find_index(key);
+    ft_size_t index = this->lower_bound_index(key);
+    int32_t assign_error;
 
-    if (index != this->_size)
+    if (index < this->_size && !(key < this->_data[index].key))
     {
-        if constexpr (ft_map<Key, MappedType>::template has_destroy<MappedType>::value
-            && ft_map<Key, MappedType>::template has_initialize_move<MappedType>::value)
-        {
-            int32_t destroy_error = this->_data[index].value.destroy();
-            if (destroy_error != FT_ERR_SUCCESS)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                this->set_error(destroy_error);
-                return ;
-            }
-            int32_t initialize_error = this->_data[index].value.initialize(ft_move(value));
-            if (initialize_error != FT_ERR_SUCCESS)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                this->set_error(initialize_error);
-                return ;
-            }
-        }
-        else if constexpr (std::is_move_assignable<MappedType>::value)
-            this->_data[index].value = ft_move(value);
+        assign_error = this->assign_value_unlocked(index, ft_move(value));
         (void)this->unlock_internal(lock_acquired);
-        this->set_error(FT_ERR_SUCCESS);
+        this->set_error(assign_error);
         return ;
     }
-    ft_size_t next_capacity;
-
-    if (this->_capacity == 0)
-        next_capacity = 1;
-    else
+    if (!this->grow_unlocked())
     {
-        next_capacity = this->_capacity * 2;
-        if (next_capacity <= this->_capacity)
-        {
-            ft_size_t incremented_capacity = this->_capacity + 1;
-            if (incremented_capacity == 0)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                return ;
-            }
-            next_capacity = incremented_capacity;
-        }
+        (void)this->unlock_internal(lock_acquired);
+        this->set_error(FT_ERR_NO_MEMORY);
+        return ;
     }
-    if (!this->ensure_capacity(next_capacity))
+    if (index < this->_size)
     {
+        assign_error = this->open_slot_unlocked(index);
+        if (assign_error == FT_ERR_SUCCESS)
+        {
+            this->_data[index].key = key;
+            assign_error = this->assign_value_unlocked(index, ft_move(value));
+        }
         (void)this->unlock_internal(lock_acquired);
-        this->set_error(FT_ERR_NO_MEMORY);
+        this->set_error(assign_error);
         return ;
     }
     if constexpr (ft_map<Key, MappedType>::template has_initialize_move<MappedType>::value)
@@ -800,40 +969,10 @@ void ft_map<Key, MappedType>::remove(const Key& key)
         this->set_error(FT_ERR_SUCCESS);
         return ;
     }
-    ft_size_t move_index = index;
+    int32_t close_error = this->close_slot_unlocked(index);
 
-    while (move_index + 1 < this->_size)
-    {
-        this->_data[move_index].key = this->_data[move_index + 1].key;
-        if constexpr (ft_map<Key, MappedType>::template has_destroy<MappedType>::value
-            && ft_map<Key, MappedType>::template has_initialize_copy<MappedType>::value)
-        {
-            int32_t destroy_error = this->_data[move_index].value.destroy();
-            if (destroy_error != FT_ERR_SUCCESS)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                this->set_error(destroy_error);
-                return ;
-            }
-            int32_t initialize_error = this->_data[move_index].value.initialize(this->_data[move_index + 1].value);
-            if (initialize_error != FT_ERR_SUCCESS)
-            {
-                (void)this->unlock_internal(lock_acquired);
-                this->set_error(initialize_error);
-                return ;
-            }
-        }
-        else if constexpr (std::is_copy_assignable<MappedType>::value)
-            this->_data[move_index].value = this->_data[move_index + 1].value;
-        move_index++;
-    }
-    if (this->_size > 0)
-    {
-        destroy_at(&this->_data[this->_size - 1]);
-        this->_size -= 1;
-    }
     (void)this->unlock_internal(lock_acquired);
-    this->set_error(FT_ERR_SUCCESS);
+    this->set_error(close_error);
     return ;
 }
 
@@ -951,6 +1090,170 @@ const Pair<Key, MappedType>* ft_map<Key, MappedType>::end() const
     return (result);
 }
 
+template <typename Key, typename MappedType>
+Pair<Key, MappedType>* ft_map<Key, MappedType>::begin()
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::begin");
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    Pair<Key, MappedType>* result;
+
+    if (lock_error != FT_ERR_SUCCESS)
+    {
+        this->set_error(lock_error);
+        return (this->end_pointer_unlocked());
+    }
+    result = this->_data;
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return (result);
+}
+
+template <typename Key, typename MappedType>
+const Pair<Key, MappedType>* ft_map<Key, MappedType>::begin() const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::begin_const");
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    const Pair<Key, MappedType>* result;
+
+    if (lock_error != FT_ERR_SUCCESS)
+    {
+        this->set_error(lock_error);
+        return (this->end_pointer_unlocked());
+    }
+    result = this->_data;
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return (result);
+}
+
+template <typename Key, typename MappedType>
+Pair<Key, MappedType>* ft_map<Key, MappedType>::lower_bound(const Key& key)
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::lower_bound");
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    Pair<Key, MappedType>* result;
+
+    if (lock_error != FT_ERR_SUCCESS)
+    {
+        this->set_error(lock_error);
+        return (this->end_pointer_unlocked());
+    }
+    result = this->_data + this->lower_bound_index(key);
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return (result);
+}
+
+template <typename Key, typename MappedType>
+const Pair<Key, MappedType>* ft_map<Key, MappedType>::lower_bound(const Key& key) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::lower_bound_const");
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    const Pair<Key, MappedType>* result;
+
+    if (lock_error != FT_ERR_SUCCESS)
+    {
+        this->set_error(lock_error);
+        return (this->end_pointer_unlocked());
+    }
+    result = this->_data + this->lower_bound_index(key);
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return (result);
+}
+
+template <typename Key, typename MappedType>
+Pair<Key, MappedType>* ft_map<Key, MappedType>::upper_bound(const Key& key)
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::upper_bound");
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    Pair<Key, MappedType>* result;
+
+    if (lock_error != FT_ERR_SUCCESS)
+    {
+        this->set_error(lock_error);
+        return (this->end_pointer_unlocked());
+    }
+    result = this->_data + this->upper_bound_index(key);
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return (result);
+}
+
+template <typename Key, typename MappedType>
+const Pair<Key, MappedType>* ft_map<Key, MappedType>::upper_bound(const Key& key) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::upper_bound_const");
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    const Pair<Key, MappedType>* result;
+
+    if (lock_error != FT_ERR_SUCCESS)
+    {
+        this->set_error(lock_error);
+        return (this->end_pointer_unlocked());
+    }
+    result = this->_data + this->upper_bound_index(key);
+    (void)this->unlock_internal(lock_acquired);
+    this->set_error(FT_ERR_SUCCESS);
+    return (result);
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_map<Key, MappedType>::range(const Key& lower_key, const Key& upper_key,
+    Pair<Key, MappedType>** range_begin,
+    Pair<Key, MappedType>** range_end)
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::range");
+    if (range_begin == ft_nullptr || range_end == ft_nullptr)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    ft_size_t begin_index;
+    ft_size_t end_index;
+
+    if (lock_error != FT_ERR_SUCCESS)
+        return (this->set_error(lock_error));
+    begin_index = this->lower_bound_index(lower_key);
+    end_index = this->upper_bound_index(upper_key);
+    if (end_index < begin_index)
+        end_index = begin_index;
+    *range_begin = this->_data + begin_index;
+    *range_end = this->_data + end_index;
+    (void)this->unlock_internal(lock_acquired);
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_map<Key, MappedType>::range(const Key& lower_key, const Key& upper_key,
+    const Pair<Key, MappedType>** range_begin,
+    const Pair<Key, MappedType>** range_end) const
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_map::range_const");
+    if (range_begin == ft_nullptr || range_end == ft_nullptr)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    ft_bool lock_acquired = FT_FALSE;
+    int32_t lock_error = this->lock_internal(&lock_acquired);
+    ft_size_t begin_index;
+    ft_size_t end_index;
+
+    if (lock_error != FT_ERR_SUCCESS)
+        return (this->set_error(lock_error));
+    begin_index = this->lower_bound_index(lower_key);
+    end_index = this->upper_bound_index(upper_key);
+    if (end_index < begin_index)
+        end_index = begin_index;
+    *range_begin = this->_data + begin_index;
+    *range_end = this->_data + end_index;
+    (void)this->unlock_internal(lock_acquired);
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
 template <typename Key, typename MappedType>
 MappedType& ft_map<Key, MappedType>::at(const Key& key)
 {
@@ -0,0 +1,72 @@
+#ifndef TEMPLATE_MOVE_ONLY_FUNCTION_HPP
+#define TEMPLATE_MOVE_ONLY_FUNCTION_HPP
+
+#include "function.hpp"
+
+template <typename Signature>
+class ft_move_only_function;
+
+template <typename ReturnType, typename... Args>
+class ft_move_only_function<ReturnType(Args...)>
+    : public ft_function_storage<ReturnType(Args...)>
+{
+    public:
+        ft_move_only_function();
+
+        template <typename FunctionType, typename = typename std::enable_if<
+            !std::is_same<typename std::decay<FunctionType>::type,
+                ft_move_only_function>::value>::type>
+        ft_move_only_function(FunctionType function);
+
+        ft_move_only_function(const ft_move_only_function &other) = delete;
+        ft_move_only_function(ft_move_only_function &&other) noexcept;
+        ~ft_move_only_function();
+
+        ft_move_only_function &operator=(const ft_move_only_function &other) = delete;
+        ft_move_only_function &operator=(ft_move_only_function &&other) noexcept;
+};
+
+template <typename ReturnType, typename... Args>
+ft_move_only_function<ReturnType(Args...)>::ft_move_only_function()
+    : ft_function_storage<ReturnType(Args...)>()
+{
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+template <typename FunctionType, typename>
+ft_move_only_function<ReturnType(Args...)>::ft_move_only_function(FunctionType function)
+    : ft_function_storage<ReturnType(Args...)>()
+{
+    (void)this->emplace_callable(ft_move(function));
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+ft_move_only_function<ReturnType(Args...)>::ft_move_only_function(
+        ft_move_only_function &&other) noexcept
+    : ft_function_storage<ReturnType(Args...)>()
+{
+    this->take_callable(other);
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+ft_move_only_function<ReturnType(Args...)>::~ft_move_only_function()
+{
+    this->clear_callable();
+    return ;
+}
+
+template <typename ReturnType, typename... Args>
+ft_move_only_function<ReturnType(Args...)> &
+ft_move_only_function<ReturnType(Args...)>::operator=(ft_move_only_function &&other) noexcept
+{
+    if (this == &other)
+        return (*this);
+    this->clear_callable();
+    this->take_callable(other);
+    return (*this);
+}
+
+#endif
@@ -8,25 +8,123 @@
 #include "../PThread/mutex.hpp"
 #include "../PThread/recursive_mutex.hpp"
 #include "../PThread/pthread_internal.hpp"
+#include "constructor.hpp"
+#include <atomic>
 #include <cstdint>
 #include <new>
+#include <utility>
+
+struct ft_shared_control_block
+{
+    std::atomic<ft_size_t> _strong_count;
+    std::atomic<ft_size_t> _weak_count;
+    void (*_destroy_object)(ft_shared_control_block *block) noexcept;
+    void (*_release_block)(ft_shared_control_block *block) noexcept;
+};
+
+template <typename ManagedType>
+struct ft_shared_pointer_block : public ft_shared_control_block
+{
+    ManagedType *_pointer;
+    ft_bool     _is_array;
+};
+
+template <typename ManagedType>
+struct ft_shared_inplace_block : public ft_shared_control_block
+{
+    alignas(ManagedType) unsigned char _storage[sizeof(ManagedType)];
+};
+
+inline void ft_shared_control_block_initialize(ft_shared_control_block *block,
+    void (*destroy_object)(ft_shared_control_block *) noexcept,
+    void (*release_block)(ft_shared_control_block *) noexcept) noexcept
+{
+    block->_strong_count.store(1, std::memory_order_relaxed);
+    block->_weak_count.store(1, std::memory_order_relaxed);
+    block->_destroy_object = destroy_object;
+    block->_release_block = release_block;
+    return ;
+}
+
+inline void ft_shared_control_block_add_strong(ft_shared_control_block *block) noexcept
+{
+    block->_strong_count.fetch_add(1, std::memory_order_relaxed);
+    return ;
+}
+
+inline ft_bool ft_shared_control_block_try_add_strong(
+    ft_shared_control_block *block) noexcept
+{
+    ft_size_t count;
+
+    count = block->_strong_count.load(std::memory_order_relaxed);
+    while (count != 0)
+    {
+        if (block->_strong_count.compare_exchange_weak(count, count + 1,
+                std::memory_order_acq_rel, std::memory_order_relaxed))
+            return (FT_TRUE);
+    }
+    return (FT_FALSE);
+}
+
+inline void ft_shared_control_block_add_weak(ft_shared_control_block *block) noexcept
+{
+    block->_weak_count.fetch_add(1, std::memory_order_relaxed);
+    return ;
+}
+
+inline void ft_shared_control_block_release_weak(ft_shared_control_block *block) noexcept
+{
+    if (block->_weak_count.fetch_sub(1, std::memory_order_release) != 1)
+        return ;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    block->_release_block(block);
+    return ;
+}
+
+inline void ft_shared_control_block_release_strong(ft_shared_control_block *block) noexcept
+{
+    if (block->_strong_count.fetch_sub(1, std::memory_order_release) != 1)
+        return ;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    block->_destroy_object(block);
+    ft_shared_control_block_release_weak(block);
+    return ;
+}
+
+template <typename ManagedType>
+class ft_weakptr;
 
 template <typename ManagedType>
 class ft_sharedptr
 {
     private:
-        ManagedType                *_managed_pointer;
-        ft_size_t                  *_reference_count;
-        ft_size_t                  _array_size;
-        ft_bool                    _is_array_type;
-        mutable pt_recursive_mutex *_mutex;
-        uint8_t                    _initialised_state;
+        ManagedType                 *_managed_pointer;
+        ft_shared_control_block     *_control_block;
+        ft_size_t                   _array_size;
+        ft_bool                     _is_array_type;
+        mutable pt_recursive_mutex  *_mutex;
+        uint8_t                     _initialised_state;
         static thread_local int32_t _last_error;
 
         static int32_t set_error(int32_t error_code) noexcept;
         int32_t lock_internal(ft_bool *lock_acquired) const noexcept;
         void unlock_internal(ft_bool lock_acquired) const noexcept;
         void destroy_storage() noexcept;
+        int32_t adopt_pointer(ManagedType *pointer, ft_bool array_type) noexcept;
+        static void destroy_pointer_block(ft_shared_control_block *block) noexcept;
+        static void release_pointer_block(ft_shared_control_block *block) noexcept;
+        static void destroy_inplace_block(ft_shared_control_block *block) noexcept;
+        static void release_inplace_block(ft_shared_control_block *block) noexcept;
+
+        template <typename OtherType>
+        friend class ft_weakptr;
+
+        template <typename OtherType, typename... Args>
+        friend ft_sharedptr<OtherType> ft_make_shared(Args&&... args) noexcept;
+
+        ft_sharedptr(ManagedType *pointer, ft_shared_control_block *control_block,
+            ft_bool array_type, ft_size_t array_size) noexcept;
 
     public:
         class reference_proxy
@@ -140,40 +238,82 @@ void ft_sharedptr<ManagedType>::unlock_internal(ft_bool lock_acquired) const noe
 template <typename ManagedType>
 void ft_sharedptr<ManagedType>::destroy_storage() noexcept
 {
-    if (this->_managed_pointer == ft_nullptr)
-    {
-        this->_reference_count = ft_nullptr;
-        return ;
-    }
-    if (this->_reference_count == ft_nullptr)
-    {
-        if (this->_is_array_type)
-            delete[] this->_managed_pointer;
-        else
-            delete this->_managed_pointer;
-        this->_managed_pointer = ft_nullptr;
-        this->_array_size = 0;
-        this->_is_array_type = FT_FALSE;
-        return ;
-    }
-    if (*this->_reference_count > 1)
+    ft_shared_control_block *control_block;
+
+    control_block = this->_control_block;
+    this->_managed_pointer = ft_nullptr;
+    this->_control_block = ft_nullptr;
+    this->_array_size = 0;
+    this->_is_array_type = FT_FALSE;
+    if (control_block != ft_nullptr)
+        ft_shared_control_block_release_strong(control_block);
+    return ;
+}
+
+template <typename ManagedType>
+int32_t ft_sharedptr<ManagedType>::adopt_pointer(ManagedType *pointer,
+    ft_bool array_type) noexcept
+{
+    ft_shared_pointer_block<ManagedType> *control_block;
+
+    this->_managed_pointer = pointer;
+    this->_control_block = ft_nullptr;
+    if (pointer == ft_nullptr)
+        return (FT_ERR_SUCCESS);
+    control_block = new (std::nothrow) ft_shared_pointer_block<ManagedType>;
+    if (control_block == ft_nullptr)
     {
-        *this->_reference_count = *this->_reference_count - 1;
         this->_managed_pointer = ft_nullptr;
-        this->_reference_count = ft_nullptr;
-        this->_array_size = 0;
-        this->_is_array_type = FT_FALSE;
-        return ;
+        return (FT_ERR_NO_MEMORY);
     }
-    if (this->_is_array_type)
-        delete[] this->_managed_pointer;
+    ft_shared_control_block_initialize(control_block,
+        &ft_sharedptr<ManagedType>::destroy_pointer_block,
+        &ft_sharedptr<ManagedType>::release_pointer_block);
+    control_block->_pointer = pointer;
+    control_block->_is_array = array_type;
+    this->_control_block = control_block;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename ManagedType>
+void ft_sharedptr<ManagedType>::destroy_pointer_block(
+    ft_shared_control_block *block) noexcept
+{
+    ft_shared_pointer_block<ManagedType> *pointer_block;
+
+    pointer_block = static_cast<ft_shared_pointer_block<ManagedType> *>(block);
+    if (pointer_block->_is_array)
+        delete[] pointer_block->_pointer;
     else
-        delete this->_managed_pointer;
-    delete this->_reference_count;
-    this->_managed_pointer = ft_nullptr;
-    this->_reference_count = ft_nullptr;
-    this->_array_size = 0;
-    this->_is_array_type = FT_FALSE;
+        delete pointer_block->_pointer;
+    pointer_block->_pointer = ft_nullptr;
+    return ;
+}
+
+template <typename ManagedType>
+void ft_sharedptr<ManagedType>::release_pointer_block(
+    ft_shared_control_block *block) noexcept
+{
+    delete static_cast<ft_shared_pointer_block<ManagedType> *>(block);
+    return ;
+}
+
+template <typename ManagedType>
+void ft_sharedptr<ManagedType>::destroy_inplace_block(
+    ft_shared_control_block *block) noexcept
+{
+    ft_shared_inplace_block<ManagedType> *inplace_block;
+
+    inplace_block = static_cast<ft_shared_inplace_block<ManagedType> *>(block);
+    destroy_at(reinterpret_cast<ManagedType *>(inplace_block->_storage));
+    return ;
+}
+
+template <typename ManagedType>
+void ft_sharedptr<ManagedType>::release_inplace_block(
+    ft_shared_control_block *block) noexcept
+{
+    delete static_cast<ft_shared_inplace_block<ManagedType> *>(block);
     return ;
 }
 
@@ -249,7 +389,7 @@ int32_t ft_sharedptr<ManagedType>::const_reference_proxy::get_error() const noex
 
 template <typename ManagedType>
 ft_sharedptr<ManagedType>::ft_sharedptr() noexcept
-    : _managed_pointer(ft_nullptr), _reference_count(ft_nullptr),
+    : _managed_pointer(ft_nullptr), _control_block(ft_nullptr),
       _array_size(0), _is_array_type(FT_FALSE), _mutex(ft_nullptr),
       _initialised_state(FT_CLASS_STATE_UNINITIALISED)
 {
@@ -259,7 +399,7 @@ ft_sharedptr<ManagedType>::ft_sharedptr() noexcept
 template <typename ManagedType>
 ft_sharedptr<ManagedType>::ft_sharedptr(ManagedType *pointer, ft_bool array_type,
     ft_size_t array_size) noexcept
-    : _managed_pointer(ft_nullptr), _reference_count(ft_nullptr),
+    : _managed_pointer(ft_nullptr), _control_block(ft_nullptr),
       _array_size(0), _is_array_type(FT_FALSE), _mutex(ft_nullptr),
       _initialised_state(FT_CLASS_STATE_UNINITIALISED)
 {
@@ -273,7 +413,7 @@ ft_sharedptr<ManagedType>::ft_sharedptr(ManagedType *pointer, ft_bool array_type
 
 template <typename ManagedType>
 ft_sharedptr<ManagedType>::ft_sharedptr(ft_size_t size) noexcept
-    : _managed_pointer(ft_nullptr), _reference_count(ft_nullptr),
+    : _managed_pointer(ft_nullptr), _control_block(ft_nullptr),
       _array_size(0), _is_array_type(FT_FALSE), _mutex(ft_nullptr),
       _initialised_state(FT_CLASS_STATE_UNINITIALISED)
 {
@@ -285,6 +425,17 @@ ft_sharedptr<ManagedType>::ft_sharedptr(ft_size_t size) noexcept
     return ;
 }
 
+template <typename ManagedType>
+ft_sharedptr<ManagedType>::ft_sharedptr(ManagedType *pointer,
+    ft_shared_control_block *control_block, ft_bool array_type,
+    ft_size_t array_size) noexcept
+    : _managed_pointer(pointer), _control_block(control_block),
+      _array_size(array_size), _is_array_type(array_type), _mutex(ft_nullptr),
+      _initialised_state(FT_CLASS_STATE_INITIALISED)
+{
+    return ;
+}
+
 template <typename ManagedType>
 ft_sharedptr<ManagedType> &ft_sharedptr<ManagedType>::operator=(
     const ft_sharedptr &other) noexcept
@@ -297,11 +448,11 @@ ft_sharedptr<ManagedType> &ft_sharedptr<ManagedType>::operator=(
     if (other._initialised_state != FT_CLASS_STATE_INITIALISED)
         return (*this);
     this->_managed_pointer = other._managed_pointer;
-    this->_reference_count = other._reference_count;
+    this->_control_block = other._control_block;
     this->_array_size = other._array_size;
     this->_is_array_type = other._is_array_type;
-    if (this->_reference_count != ft_nullptr)
-        *this->_reference_count = *this->_reference_count + 1;
+    if (this->_control_block != ft_nullptr)
+        ft_shared_control_block_add_strong(this->_control_block);
     set_error(FT_ERR_SUCCESS);
     return (*this);
 }
@@ -336,7 +487,7 @@ int32_t ft_sharedptr<ManagedType>::initialize() noexcept
     if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
         return (set_error(FT_ERR_INVALID_STATE));
     this->_managed_pointer = ft_nullptr;
-    this->_reference_count = ft_nullptr;
+    this->_control_block = ft_nullptr;
     this->_array_size = 0;
     this->_is_array_type = FT_FALSE;
     this->_initialised_state = FT_CLASS_STATE_INITIALISED;
@@ -349,16 +500,10 @@ int32_t ft_sharedptr<ManagedType>::initialize(ManagedType *pointer,
 {
     if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
         return (set_error(FT_ERR_INVALID_STATE));
-    this->_managed_pointer = pointer;
-    this->_reference_count = ft_nullptr;
-    if (pointer != ft_nullptr)
+    if (this->adopt_pointer(pointer, array_type) != FT_ERR_SUCCESS)
     {
-        this->_reference_count = new (std::nothrow) ft_size_t(1);
-        if (this->_reference_count == ft_nullptr)
-        {
-            this->_initialised_state = FT_CLASS_STATE_DESTROYED;
-            return (set_error(FT_ERR_NO_MEMORY));
-        }
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (set_error(FT_ERR_NO_MEMORY));
     }
     if (array_type)
         this->_array_size = array_size;
@@ -376,32 +521,29 @@ int32_t ft_sharedptr<ManagedType>::initialize(ft_size_t size) noexcept
 {
     if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
         return (set_error(FT_ERR_INVALID_STATE));
+    ManagedType *array_pointer;
+
     this->_managed_pointer = ft_nullptr;
-    this->_reference_count = ft_nullptr;
+    this->_control_block = ft_nullptr;
     this->_array_size = 0;
     this->_is_array_type = FT_TRUE;
+    array_pointer = ft_nullptr;
     if (size > 0)
     {
-        this->_managed_pointer = new (std::nothrow) ManagedType[size];
-        if (this->_managed_pointer == ft_nullptr)
+        array_pointer = new (std::nothrow) ManagedType[size];
+        if (array_pointer == ft_nullptr)
         {
             this->_initialised_state = FT_CLASS_STATE_DESTROYED;
             return (set_error(FT_ERR_NO_MEMORY));
         }
     }
-    this->_array_size = size;
-    if (this->_managed_pointer != ft_nullptr)
+    if (this->adopt_pointer(array_pointer, FT_TRUE) != FT_ERR_SUCCESS)
     {
-        this->_reference_count = new (std::nothrow) ft_size_t(1);
-        if (this->_reference_count == ft_nullptr)
-        {
-            delete[] this->_managed_pointer;
-            this->_managed_pointer = ft_nullptr;
-            this->_array_size = 0;
-            this->_initialised_state = FT_CLASS_STATE_DESTROYED;
-            return (set_error(FT_ERR_NO_MEMORY));
-        }
+        delete[] array_pointer;
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (set_error(FT_ERR_NO_MEMORY));
     }
+    this->_array_size = size;
     this->_initialised_state = FT_CLASS_STATE_INITIALISED;
     return (set_error(FT_ERR_SUCCESS));
 }
@@ -433,7 +575,7 @@ int32_t ft_sharedptr<ManagedType>::initialize(const ft_sharedptr &other) noexcep
     if (other._initialised_state == FT_CLASS_STATE_DESTROYED)
     {
         this->_managed_pointer = ft_nullptr;
-        this->_reference_count = ft_nullptr;
+        this->_control_block = ft_nullptr;
         this->_array_size = 0;
         this->_is_array_type = FT_FALSE;
         this->_mutex = ft_nullptr;
@@ -454,13 +596,13 @@ int32_t ft_sharedptr<ManagedType>::initialize(const ft_sharedptr &other) noexcep
         }
     }
     this->_managed_pointer = other._managed_pointer;
-    this->_reference_count = other._reference_count;
+    this->_control_block = other._control_block;
     this->_array_size = other._array_size;
     this->_is_array_type = other._is_array_type;
     this->_mutex = new_mutex;
     this->_initialised_state = FT_CLASS_STATE_INITIALISED;
-    if (this->_reference_count != ft_nullptr)
-        *this->_reference_count = *this->_reference_count + 1;
+    if (this->_control_block != ft_nullptr)
+        ft_shared_control_block_add_strong(this->_control_block);
     return (set_error(FT_ERR_SUCCESS));
 }
 
@@ -515,7 +657,7 @@ int32_t ft_sharedptr<ManagedType>::move(ft_sharedptr<ManagedType> &other) noexce
     if (other._initialised_state == FT_CLASS_STATE_DESTROYED)
     {
         this->_managed_pointer = ft_nullptr;
-        this->_reference_count = ft_nullptr;
+        this->_control_block = ft_nullptr;
         this->_array_size = 1;
         this->_is_array_type = FT_FALSE;
         this->_mutex = ft_nullptr;
@@ -523,13 +665,13 @@ int32_t ft_sharedptr<ManagedType>::move(ft_sharedptr<ManagedType> &other) noexce
         return (set_error(FT_ERR_SUCCESS));
     }
     this->_managed_pointer = other._managed_pointer;
-    this->_reference_count = other._reference_count;
+    this->_control_block = other._control_block;
     this->_array_size = other._array_size;
     this->_is_array_type = other._is_array_type;
     this->_mutex = other._mutex;
     this->_initialised_state = FT_CLASS_STATE_INITIALISED;
     other._managed_pointer = ft_nullptr;
-    other._reference_count = ft_nullptr;
+    other._control_block = ft_nullptr;
     other._array_size = 1;
     other._is_array_type = FT_FALSE;
     other._mutex = ft_nullptr;
@@ -655,10 +797,11 @@ int32_t ft_sharedptr<ManagedType>::use_count() const noexcept
         set_error(FT_ERR_SUCCESS);
         return (0);
     }
-    if (this->_reference_count == ft_nullptr)
+    if (this->_control_block == ft_nullptr)
         return (1);
     set_error(FT_ERR_SUCCESS);
-    return (static_cast<int32_t>(*this->_reference_count));
+    return (static_cast<int32_t>(
+        this->_control_block->_strong_count.load(std::memory_order_relaxed)));
 }
 
 template <typename ManagedType>
@@ -683,19 +826,10 @@ void ft_sharedptr<ManagedType>::reset(ManagedType *pointer, ft_size_t size,
         return ;
     }
     this->destroy_storage();
-    this->_managed_pointer = pointer;
-    this->_reference_count = ft_nullptr;
-    if (pointer != ft_nullptr)
+    if (this->adopt_pointer(pointer, array_type) != FT_ERR_SUCCESS)
     {
-        this->_reference_count = new (std::nothrow) ft_size_t(1);
-        if (this->_reference_count == ft_nullptr)
-        {
-            this->_managed_pointer = ft_nullptr;
-            this->_array_size = 0;
-            this->_is_array_type = FT_FALSE;
-            set_error(FT_ERR_NO_MEMORY);
-            return ;
-        }
+        set_error(FT_ERR_NO_MEMORY);
+        return ;
     }
     if (array_type)
         this->_array_size = size;
@@ -722,16 +856,16 @@ void ft_sharedptr<ManagedType>::swap(ft_sharedptr &other) noexcept
         return ;
     }
     pointer_value = this->_managed_pointer;
-    ft_size_t *reference_count_value;
+    ft_shared_control_block *control_block_value;
     array_size_value = this->_array_size;
     is_array_type_value = this->_is_array_type;
-    reference_count_value = this->_reference_count;
+    control_block_value = this->_control_block;
     this->_managed_pointer = other._managed_pointer;
-    this->_reference_count = other._reference_count;
+    this->_control_block = other._control_block;
     this->_array_size = other._array_size;
     this->_is_array_type = other._is_array_type;
     other._managed_pointer = pointer_value;
-    other._reference_count = reference_count_value;
+    other._control_block = control_block_value;
     other._array_size = array_size_value;
     other._is_array_type = is_array_type_value;
     set_error(FT_ERR_SUCCESS);
@@ -845,4 +979,242 @@ ft_bool operator!=(const ft_sharedptr<LeftType> &left,
     return (left.get() != right.get());
 }
 
+template <typename ManagedType, typename... Args>
+ft_sharedptr<ManagedType> ft_make_shared(Args&&... args) noexcept
+{
+    ft_shared_inplace_block<ManagedType> *control_block;
+    ManagedType *object_pointer;
+
+    control_block = new (std::nothrow) ft_shared_inplace_block<ManagedType>;
+    if (control_block == ft_nullptr)
+    {
+        (void)ft_sharedptr<ManagedType>::set_error(FT_ERR_NO_MEMORY);
+        return (ft_sharedptr<ManagedType>(ft_nullptr, ft_nullptr, FT_FALSE, 0));
+    }
+    object_pointer = construct_at(reinterpret_cast<ManagedType *>(control_block->_storage),
+            std::forward<Args>(args)...);
+    ft_shared_control_block_initialize(control_block,
+        &ft_sharedptr<ManagedType>::destroy_inplace_block,
+        &ft_sharedptr<ManagedType>::release_inplace_block);
+    (void)ft_sharedptr<ManagedType>::set_error(FT_ERR_SUCCESS);
+    return (ft_sharedptr<ManagedType>(object_pointer, control_block, FT_FALSE, 1));
+}
+
+template <typename ManagedType>
+class ft_weakptr
+{
+    private:
+        ManagedType                 *_managed_pointer;
+        ft_shared_control_block     *_control_block;
+        ft_size_t                   _array_size;
+        ft_bool                     _is_array_type;
+        uint8_t                     _initialised_state;
+        static thread_local int32_t _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        void release() noexcept;
+        void attach(ManagedType *pointer, ft_shared_control_block *control_block,
+            ft_size_t array_size, ft_bool array_type) noexcept;
+
+    public:
+        ft_weakptr() noexcept;
+        ft_weakptr(const ft_weakptr &other) noexcept = delete;
+        ft_weakptr(ft_weakptr &&other) noexcept = delete;
+        ~ft_weakptr();
+
+        ft_weakptr &operator=(const ft_weakptr &other) noexcept;
+        ft_weakptr &operator=(const ft_sharedptr<ManagedType> &shared) noexcept;
+
+        int32_t initialize() noexcept;
+        int32_t initialize(const ft_sharedptr<ManagedType> &shared) noexcept;
+        int32_t initialize(const ft_weakptr &other) noexcept;
+        int32_t destroy() noexcept;
+
+        int32_t lock(ft_sharedptr<ManagedType> &destination) const noexcept;
+        ft_bool expired() const noexcept;
+        int32_t use_count() const noexcept;
+        void reset() noexcept;
+
+        int32_t get_error() const noexcept;
+        const char *get_error_str() const noexcept;
+};
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::set_error(int32_t error_code) noexcept
+{
+    _last_error = error_code;
+    return (error_code);
+}
+
+template <typename ManagedType>
+void ft_weakptr<ManagedType>::release() noexcept
+{
+    ft_shared_control_block *control_block;
+
+    control_block = this->_control_block;
+    this->_managed_pointer = ft_nullptr;
+    this->_control_block = ft_nullptr;
+    this->_array_size = 0;
+    this->_is_array_type = FT_FALSE;
+    if (control_block != ft_nullptr)
+        ft_shared_control_block_release_weak(control_block);
+    return ;
+}
+
+template <typename ManagedType>
+void ft_weakptr<ManagedType>::attach(ManagedType *pointer,
+    ft_shared_control_block *control_block, ft_size_t array_size,
+    ft_bool array_type) noexcept
+{
+    if (control_block != ft_nullptr)
+        ft_shared_control_block_add_weak(control_block);
+    this->release();
+    this->_managed_pointer = pointer;
+    this->_control_block = control_block;
+    this->_array_size = array_size;
+    this->_is_array_type = array_type;
+    return ;
+}
+
+template <typename ManagedType>
+ft_weakptr<ManagedType>::ft_weakptr() noexcept
+    : _managed_pointer(ft_nullptr), _control_block(ft_nullptr), _array_size(0),
+      _is_array_type(FT_FALSE), _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+template <typename ManagedType>
+ft_weakptr<ManagedType>::~ft_weakptr()
+{
+    this->release();
+    return ;
+}
+
+template <typename ManagedType>
+ft_weakptr<ManagedType> &ft_weakptr<ManagedType>::operator=(
+    const ft_weakptr &other) noexcept
+{
+    if (this == &other)
+        return (*this);
+    (void)this->initialize(other);
+    return (*this);
+}
+
+template <typename ManagedType>
+ft_weakptr<ManagedType> &ft_weakptr<ManagedType>::operator=(
+    const ft_sharedptr<ManagedType> &shared) noexcept
+{
+    (void)this->initialize(shared);
+    return (*this);
+}
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::initialize() noexcept
+{
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_INVALID_STATE));
+    this->release();
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::initialize(const ft_sharedptr<ManagedType> &shared) noexcept
+{
+    if (shared._initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_INVALID_STATE));
+    this->attach(shared._managed_pointer, shared._control_block,
+        shared._array_size, shared._is_array_type);
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::initialize(const ft_weakptr &other) noexcept
+{
+    if (this == &other)
+        return (set_error(FT_ERR_SUCCESS));
+    if (other._initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_INVALID_STATE));
+    this->attach(other._managed_pointer, other._control_block,
+        other._array_size, other._is_array_type);
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::destroy() noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_SUCCESS));
+    this->release();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::lock(ft_sharedptr<ManagedType> &destination) const noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (set_error(FT_ERR_INVALID_STATE));
+    if (destination._initialised_state != FT_CLASS_STATE_INITIALISED)
+        (void)destination.initialize();
+    destination.destroy_storage();
+    if (this->_control_block == ft_nullptr
+        || !ft_shared_control_block_try_add_strong(this->_control_block))
+        return (set_error(FT_ERR_SUCCESS));
+    destination._managed_pointer = this->_managed_pointer;
+    destination._control_block = this->_control_block;
+    destination._array_size = this->_array_size;
+    destination._is_array_type = this->_is_array_type;
+    return (set_error(FT_ERR_SUCCESS));
+}
+
+template <typename ManagedType>
+ft_bool ft_weakptr<ManagedType>::expired() const noexcept
+{
+    if (this->_control_block == ft_nullptr)
+        return (FT_TRUE);
+    if (this->_control_block->_strong_count.load(std::memory_order_acquire) == 0)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::use_count() const noexcept
+{
+    if (this->_control_block == ft_nullptr)
+        return (0);
+    return (static_cast<int32_t>(
+        this->_control_block->_strong_count.load(std::memory_order_relaxed)));
+}
+
+template <typename ManagedType>
+void ft_weakptr<ManagedType>::reset() noexcept
+{
+    this->release();
+    set_error(FT_ERR_SUCCESS);
+    return ;
+}
+
+template <typename ManagedType>
+int32_t ft_weakptr<ManagedType>::get_error() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_weakptr::get_error");
+    return (_last_error);
+}
+
+template <typename ManagedType>
+const char *ft_weakptr<ManagedType>::get_error_str() const noexcept
+{
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "ft_weakptr::get_error_str");
+    return (ft_strerror(_last_error));
+}
+
+template <typename ManagedType>
+thread_local int32_t ft_weakptr<ManagedType>::_last_error = FT_ERR_SUCCESS;
+
 #endif
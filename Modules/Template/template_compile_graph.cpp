@@ -6,3 +6,4 @@
 #include "vector.hpp"
 
 template class ft_graph<int32_t>;
+template class ft_graph_csr<uint32_t>;
@@ -0,0 +1,4 @@
+#include "graph_search.hpp"
+#include <cstdint>
+
+template class ft_graph_search<uint32_t>;
@@ -0,0 +1,5 @@
+#include "indexed_heap.hpp"
+#include <cstdint>
+
+template class ft_indexed_heap<uint32_t>;
+template class ft_indexed_heap<double, 2>;
@@ -0,0 +1,4 @@
+#include "move_only_function.hpp"
+#include <cstdint>
+
+template class ft_move_only_function<int32_t(int32_t)>;
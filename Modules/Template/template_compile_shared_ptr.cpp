@@ -4,3 +4,4 @@
 #include "../PThread/recursive_mutex.hpp"
 
 template class ft_sharedptr<int32_t>;
+template class ft_weakptr<int32_t>;
@@ -2,6 +2,7 @@
 #define FT_UNORDERED_MAP_HPP
 
 #include "../CMA/CMA.hpp"
+#include "../Basic/basic.hpp"
 #include "../Errno/errno.hpp"
 #include "../Errno/errno_internal.hpp"
 #include "../Basic/class_nullptr.hpp"
@@ -12,6 +13,9 @@
 #include <cstdint>
 #include <functional>
 #include <new>
+#if defined(__SSE2__)
+# include <immintrin.h>
+#endif
 
 template <typename Key, typename MappedType>
 struct ft_pair
@@ -22,6 +26,10 @@ struct ft_pair
     ft_pair(const Key& key, const MappedType& value);
 };
 
+#define FT_UNORDERED_MAP_GROUP_WIDTH 16
+#define FT_UNORDERED_MAP_CONTROL_EMPTY 0x80
+#define FT_UNORDERED_MAP_CONTROL_DELETED 0xFE
+
 template <typename Key, typename MappedType>
 class ft_unordered_map
 {
@@ -31,9 +39,11 @@ class ft_unordered_map
     private:
 #endif
         ft_pair<Key, MappedType>      *_data;
-        ft_bool                          *_occupied;
+        ft_size_t                     *_hashes;
+        uint8_t                       *_control;
         ft_size_t                        _capacity;
         ft_size_t                        _size;
+        ft_size_t                        _tombstones;
         ft_size_t                        _requested_capacity;
         mutable pt_recursive_mutex    *_mutex;
         mutable uint8_t               _initialised_state;
@@ -41,14 +51,27 @@ class ft_unordered_map
         static thread_local int32_t _last_error;
         static int32_t set_error(int32_t error_code) noexcept;
 
+        static ft_size_t   normalize_capacity(ft_size_t capacity);
+        static ft_size_t   growth_limit(ft_size_t capacity);
+        static uint32_t    match_byte(const uint8_t *group, uint8_t value);
+        static uint32_t    match_empty_or_deleted(const uint8_t *group);
+        static uint32_t    lowest_bit_index(uint32_t mask);
+        static ft_bool     control_is_full(uint8_t control);
+
         ft_bool    has_storage_unlocked() const;
         void    destroy_elements_unlocked();
         void    release_storage_unlocked();
+        static int32_t allocate_storage(ft_size_t capacity,
+                    ft_pair<Key, MappedType> **data, ft_size_t **hashes,
+                    uint8_t **control);
         int32_t prepare_empty_storage_unlocked(ft_size_t capacity);
 
         ft_size_t  hash_key(const Key& key) const;
         ft_size_t  find_index_unlocked(const Key& key) const;
-        int32_t insert_internal_unlocked(const Key& key, const MappedType& value);
+        ft_size_t  find_index_with_hash_unlocked(const Key& key, ft_size_t hash_value) const;
+        ft_size_t  find_insert_slot_unlocked(ft_size_t hash_value) const;
+        int32_t insert_internal_unlocked(const Key& key, const MappedType& value,
+                    ft_size_t *slot_index);
         int32_t resize_unlocked(ft_size_t new_capacity);
 
         int32_t lock_internal(ft_bool *lock_acquired) const;
@@ -83,7 +106,7 @@ class ft_unordered_map
         {
             private:
                 ft_pair<Key, MappedType>      *_data;
-                ft_bool                          *_occupied;
+                const uint8_t                 *_control;
                 ft_size_t                        _index;
                 ft_size_t                        _capacity;
                 uint8_t                       _initialised_state;
@@ -96,7 +119,7 @@ class ft_unordered_map
 
             public:
                 iterator();
-                iterator(ft_pair<Key, MappedType>* data, ft_bool* occupied,
+                iterator(ft_pair<Key, MappedType>* data, const uint8_t* control,
                     ft_size_t index, ft_size_t capacity);
                 iterator(const iterator& other) = delete;
                 iterator(iterator&& other) = delete;
@@ -104,7 +127,7 @@ class ft_unordered_map
                 iterator& operator=(iterator&& other) = delete;
                 ~iterator();
 
-                int32_t initialize(ft_pair<Key, MappedType>* data, ft_bool* occupied,
+                int32_t initialize(ft_pair<Key, MappedType>* data, const uint8_t* control,
                     ft_size_t index, ft_size_t capacity);
                 int32_t initialize(const iterator& other);
                 int32_t initialize(iterator&& other);
@@ -123,7 +146,7 @@ class ft_unordered_map
         {
             private:
                 const ft_pair<Key, MappedType>    *_data;
-                const ft_bool                        *_occupied;
+                const uint8_t                     *_control;
                 ft_size_t                            _index;
                 ft_size_t                            _capacity;
                 uint8_t                           _initialised_state;
@@ -137,7 +160,7 @@ class ft_unordered_map
             public:
                 const_iterator();
                 const_iterator(const ft_pair<Key, MappedType>* data,
-                    const ft_bool* occupied, ft_size_t index, ft_size_t capacity);
+                    const uint8_t* control, ft_size_t index, ft_size_t capacity);
                 const_iterator(const const_iterator& other) = delete;
                 const_iterator(const_iterator&& other) = delete;
                 const_iterator& operator=(const const_iterator& other) = delete;
@@ -145,7 +168,7 @@ class ft_unordered_map
                 ~const_iterator();
 
                 int32_t initialize(const ft_pair<Key, MappedType>* data,
-                    const ft_bool* occupied, ft_size_t index, ft_size_t capacity);
+                    const uint8_t* control, ft_size_t index, ft_size_t capacity);
                 int32_t initialize(const const_iterator& other);
                 int32_t initialize(const_iterator&& other);
                 int32_t destroy();
@@ -227,12 +250,105 @@ int32_t ft_unordered_map<Key, MappedType>::set_error(int32_t error_code) noexcep
     return (error_code);
 }
 
+template <typename Key, typename MappedType>
+ft_size_t ft_unordered_map<Key, MappedType>::normalize_capacity(ft_size_t capacity)
+{
+    ft_size_t normalized_capacity;
+
+    normalized_capacity = FT_UNORDERED_MAP_GROUP_WIDTH;
+    while (normalized_capacity < capacity)
+        normalized_capacity *= 2;
+    return (normalized_capacity);
+}
+
+template <typename Key, typename MappedType>
+ft_size_t ft_unordered_map<Key, MappedType>::growth_limit(ft_size_t capacity)
+{
+    return (capacity - capacity / 8);
+}
+
+template <typename Key, typename MappedType>
+uint32_t ft_unordered_map<Key, MappedType>::match_byte(const uint8_t *group, uint8_t value)
+{
+#if defined(__SSE2__)
+    __m128i control_bytes;
+    __m128i pattern;
+
+    control_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    pattern = _mm_set1_epi8(static_cast<char>(value));
+    return (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control_bytes, pattern))));
+#else
+    uint32_t match_mask;
+    uint32_t index;
+
+    match_mask = 0;
+    index = 0;
+    while (index < FT_UNORDERED_MAP_GROUP_WIDTH)
+    {
+        if (group[index] == value)
+            match_mask |= (1U << index);
+        index += 1;
+    }
+    return (match_mask);
+#endif
+}
+
+template <typename Key, typename MappedType>
+uint32_t ft_unordered_map<Key, MappedType>::match_empty_or_deleted(const uint8_t *group)
+{
+#if defined(__SSE2__)
+    __m128i control_bytes;
+
+    control_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return (static_cast<uint32_t>(_mm_movemask_epi8(control_bytes)));
+#else
+    uint32_t match_mask;
+    uint32_t index;
+
+    match_mask = 0;
+    index = 0;
+    while (index < FT_UNORDERED_MAP_GROUP_WIDTH)
+    {
+        if ((group[index] & FT_UNORDERED_MAP_CONTROL_EMPTY) != 0)
+            match_mask |= (1U << index);
+        index += 1;
+    }
+    return (match_mask);
+#endif
+}
+
+template <typename Key, typename MappedType>
+uint32_t ft_unordered_map<Key, MappedType>::lowest_bit_index(uint32_t mask)
+{
+#if defined(__GNUC__)
+    return (static_cast<uint32_t>(__builtin_ctz(mask)));
+#else
+    uint32_t bit_index;
+
+    bit_index = 0;
+    while ((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        bit_index += 1;
+    }
+    return (bit_index);
+#endif
+}
+
+template <typename Key, typename MappedType>
+ft_bool ft_unordered_map<Key, MappedType>::control_is_full(uint8_t control)
+{
+    if ((control & FT_UNORDERED_MAP_CONTROL_EMPTY) == 0)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
 template <typename Key, typename MappedType>
 ft_bool ft_unordered_map<Key, MappedType>::has_storage_unlocked() const
 {
     if (this->_data == ft_nullptr)
         return (FT_FALSE);
-    if (this->_occupied == ft_nullptr)
+    if (this->_hashes == ft_nullptr || this->_control == ft_nullptr)
         return (FT_FALSE);
     if (this->_capacity == 0)
         return (FT_FALSE);
@@ -251,15 +367,16 @@ void ft_unordered_map<Key, MappedType>::destroy_elements_unlocked()
     remaining_elements = this->_size;
     while (index < this->_capacity && remaining_elements > 0)
     {
-        if (this->_occupied[index])
+        if (control_is_full(this->_control[index]))
         {
             ::destroy_at(&this->_data[index]);
-            this->_occupied[index] = FT_FALSE;
             remaining_elements -= 1;
         }
         index += 1;
     }
+    ft_memset(this->_control, FT_UNORDERED_MAP_CONTROL_EMPTY, this->_capacity);
     this->_size = 0;
+    this->_tombstones = 0;
     return ;
 }
 
@@ -268,43 +385,53 @@ void ft_unordered_map<Key, MappedType>::release_storage_unlocked()
 {
     if (this->_data != ft_nullptr)
         cma_free(this->_data);
-    if (this->_occupied != ft_nullptr)
-        cma_free(this->_occupied);
+    if (this->_hashes != ft_nullptr)
+        cma_free(this->_hashes);
     this->_data = ft_nullptr;
-    this->_occupied = ft_nullptr;
+    this->_hashes = ft_nullptr;
+    this->_control = ft_nullptr;
     this->_capacity = 0;
     this->_size = 0;
+    this->_tombstones = 0;
     return ;
 }
 
 template <typename Key, typename MappedType>
-int32_t ft_unordered_map<Key, MappedType>::prepare_empty_storage_unlocked(ft_size_t capacity)
+int32_t ft_unordered_map<Key, MappedType>::allocate_storage(ft_size_t capacity,
+    ft_pair<Key, MappedType> **data, ft_size_t **hashes, uint8_t **control)
 {
     void    *raw_data;
-    void    *raw_occupied;
-    ft_size_t  index;
+    void    *raw_metadata;
 
-    if (capacity == 0)
-        capacity = 1;
     raw_data = cma_malloc(sizeof(ft_pair<Key, MappedType>) * capacity);
     if (raw_data == ft_nullptr)
         return (FT_ERR_NO_MEMORY);
-    raw_occupied = cma_malloc(sizeof(ft_bool) * capacity);
-    if (raw_occupied == ft_nullptr)
+    raw_metadata = cma_malloc((sizeof(ft_size_t) + sizeof(uint8_t)) * capacity);
+    if (raw_metadata == ft_nullptr)
     {
         cma_free(raw_data);
         return (FT_ERR_NO_MEMORY);
     }
-    this->_data = static_cast<ft_pair<Key, MappedType>*>(raw_data);
-    this->_occupied = static_cast<ft_bool*>(raw_occupied);
+    *data = static_cast<ft_pair<Key, MappedType>*>(raw_data);
+    *hashes = static_cast<ft_size_t*>(raw_metadata);
+    *control = reinterpret_cast<uint8_t*>(*hashes + capacity);
+    ft_memset(*control, FT_UNORDERED_MAP_CONTROL_EMPTY, capacity);
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename Key, typename MappedType>
+int32_t ft_unordered_map<Key, MappedType>::prepare_empty_storage_unlocked(ft_size_t capacity)
+{
+    int32_t allocation_error;
+
+    capacity = normalize_capacity(capacity);
+    allocation_error = allocate_storage(capacity, &this->_data, &this->_hashes,
+            &this->_control);
+    if (allocation_error != FT_ERR_SUCCESS)
+        return (allocation_error);
     this->_capacity = capacity;
     this->_size = 0;
-    index = 0;
-    while (index < this->_capacity)
-    {
-        this->_occupied[index] = FT_FALSE;
-        index += 1;
-    }
+    this->_tombstones = 0;
     return (FT_ERR_SUCCESS);
 }
 
@@ -312,153 +439,177 @@ template <typename Key, typename MappedType>
 ft_size_t ft_unordered_map<Key, MappedType>::hash_key(const Key& key) const
 {
     std::hash<Key> hasher;
+    ft_size_t hash_value;
 
-    if (this->_capacity == 0)
-        return (0);
-    return (hasher(key) % this->_capacity);
+    hash_value = hasher(key);
+    hash_value ^= hash_value >> 32;
+    hash_value *= 0x9E3779B97F4A7C15ULL;
+    hash_value ^= hash_value >> 29;
+    return (hash_value);
 }
 
 template <typename Key, typename MappedType>
 ft_size_t ft_unordered_map<Key, MappedType>::find_index_unlocked(const Key& key) const
 {
-    ft_size_t  start_index;
-    ft_size_t  current_index;
-
     if (!this->has_storage_unlocked())
         return (this->_capacity);
     if (this->_size == 0)
         return (this->_capacity);
-    start_index = this->hash_key(key);
-    current_index = start_index;
-    while (FT_TRUE)
-    {
-        if (!this->_occupied[current_index])
-            return (this->_capacity);
-        if (this->_data[current_index].first == key)
-            return (current_index);
-        current_index = (current_index + 1) % this->_capacity;
-        if (current_index == start_index)
+    return (this->find_index_with_hash_unlocked(key, this->hash_key(key)));
+}
+
+template <typename Key, typename MappedType>
+ft_size_t ft_unordered_map<Key, MappedType>::find_index_with_hash_unlocked(
+    const Key& key, ft_size_t hash_value) const
+{
+    ft_size_t  group_mask;
+    ft_size_t  group_index;
+    ft_size_t  group_offset;
+    ft_size_t  probe_step;
+    ft_size_t  slot_index;
+    uint32_t   match_mask;
+    uint8_t    fragment;
+
+    if (!this->has_storage_unlocked() || this->_size == 0)
+        return (this->_capacity);
+    group_mask = this->_capacity / FT_UNORDERED_MAP_GROUP_WIDTH - 1;
+    group_index = (hash_value >> 7) & group_mask;
+    fragment = static_cast<uint8_t>(hash_value & 0x7F);
+    probe_step = 0;
+    while (probe_step <= group_mask)
+    {
+        group_offset = group_index * FT_UNORDERED_MAP_GROUP_WIDTH;
+        match_mask = match_byte(this->_control + group_offset, fragment);
+        while (match_mask != 0)
+        {
+            slot_index = group_offset + lowest_bit_index(match_mask);
+            if (this->_data[slot_index].first == key)
+                return (slot_index);
+            match_mask &= match_mask - 1;
+        }
+        if (match_byte(this->_control + group_offset, FT_UNORDERED_MAP_CONTROL_EMPTY) != 0)
             return (this->_capacity);
+        probe_step += 1;
+        group_index = (group_index + probe_step) & group_mask;
     }
     return (this->_capacity);
 }
 
 template <typename Key, typename MappedType>
-int32_t ft_unordered_map<Key, MappedType>::resize_unlocked(ft_size_t new_capacity)
+ft_size_t ft_unordered_map<Key, MappedType>::find_insert_slot_unlocked(
+    ft_size_t hash_value) const
 {
-    ft_pair<Key, MappedType>  *old_data;
-    ft_bool                      *old_occupied;
-    ft_size_t                    old_capacity;
-    ft_size_t                    old_size;
-    void                      *raw_data;
-    void                      *raw_occupied;
-    ft_pair<Key, MappedType>  *new_data;
-    ft_bool                      *new_occupied;
-    ft_size_t                    old_index;
-    ft_size_t                    inserted_count;
+    ft_size_t  group_mask;
+    ft_size_t  group_index;
+    ft_size_t  group_offset;
+    ft_size_t  probe_step;
+    uint32_t   match_mask;
 
-    if (new_capacity == 0)
-        return (FT_ERR_NO_MEMORY);
-    raw_data = cma_malloc(sizeof(ft_pair<Key, MappedType>) * new_capacity);
-    if (raw_data == ft_nullptr)
-        return (FT_ERR_NO_MEMORY);
-    raw_occupied = cma_malloc(sizeof(ft_bool) * new_capacity);
-    if (raw_occupied == ft_nullptr)
+    group_mask = this->_capacity / FT_UNORDERED_MAP_GROUP_WIDTH - 1;
+    group_index = (hash_value >> 7) & group_mask;
+    probe_step = 0;
+    while (probe_step <= group_mask)
     {
-        cma_free(raw_data);
-        return (FT_ERR_NO_MEMORY);
-    }
-    new_data = static_cast<ft_pair<Key, MappedType>*>(raw_data);
-    new_occupied = static_cast<ft_bool*>(raw_occupied);
-    old_index = 0;
-    while (old_index < new_capacity)
-    {
-        new_occupied[old_index] = FT_FALSE;
-        old_index += 1;
+        group_offset = group_index * FT_UNORDERED_MAP_GROUP_WIDTH;
+        match_mask = match_empty_or_deleted(this->_control + group_offset);
+        if (match_mask != 0)
+            return (group_offset + lowest_bit_index(match_mask));
+        probe_step += 1;
+        group_index = (group_index + probe_step) & group_mask;
     }
+    return (this->_capacity);
+}
 
+template <typename Key, typename MappedType>
+int32_t ft_unordered_map<Key, MappedType>::resize_unlocked(ft_size_t new_capacity)
+{
+    ft_pair<Key, MappedType>  *old_data;
+    ft_size_t                 *old_hashes;
+    uint8_t                   *old_control;
+    ft_size_t                 old_capacity;
+    ft_pair<Key, MappedType>  *new_data;
+    ft_size_t                 *new_hashes;
+    uint8_t                   *new_control;
+    ft_size_t                 old_index;
+    ft_size_t                 slot_index;
+    int32_t                   allocation_error;
+
+    new_data = ft_nullptr;
+    new_hashes = ft_nullptr;
+    new_control = ft_nullptr;
+    allocation_error = allocate_storage(new_capacity, &new_data, &new_hashes,
+            &new_control);
+    if (allocation_error != FT_ERR_SUCCESS)
+        return (allocation_error);
     old_data = this->_data;
-    old_occupied = this->_occupied;
+    old_hashes = this->_hashes;
+    old_control = this->_control;
     old_capacity = this->_capacity;
-    old_size = this->_size;
-
-    inserted_count = 0;
+    this->_data = new_data;
+    this->_hashes = new_hashes;
+    this->_control = new_control;
+    this->_capacity = new_capacity;
+    this->_tombstones = 0;
     old_index = 0;
-    while (old_index < old_capacity && inserted_count < old_size)
+    while (old_index < old_capacity)
     {
-        if (old_occupied[old_index])
+        if (control_is_full(old_control[old_index]))
         {
-            ft_size_t destination_index;
-            std::hash<Key> hasher;
-
-            destination_index = hasher(old_data[old_index].first) % new_capacity;
-            while (new_occupied[destination_index])
-                destination_index = (destination_index + 1) % new_capacity;
-            construct_at(&new_data[destination_index], ft_move(old_data[old_index]));
-            new_occupied[destination_index] = FT_TRUE;
+            slot_index = this->find_insert_slot_unlocked(old_hashes[old_index]);
+            construct_at(&this->_data[slot_index], ft_move(old_data[old_index]));
+            this->_hashes[slot_index] = old_hashes[old_index];
+            this->_control[slot_index] = old_control[old_index];
             ::destroy_at(&old_data[old_index]);
-            inserted_count += 1;
         }
         old_index += 1;
     }
-
     cma_free(old_data);
-    cma_free(old_occupied);
-
-    this->_data = new_data;
-    this->_occupied = new_occupied;
-    this->_capacity = new_capacity;
-    this->_size = inserted_count;
+    cma_free(old_hashes);
     return (FT_ERR_SUCCESS);
 }
 
 template <typename Key, typename MappedType>
 int32_t ft_unordered_map<Key, MappedType>::insert_internal_unlocked(
-    const Key& key, const MappedType& value)
+    const Key& key, const MappedType& value, ft_size_t *slot_index)
 {
+    ft_size_t hash_value;
     ft_size_t key_index;
-    ft_size_t start_index;
-    ft_size_t current_index;
 
     if (!this->has_storage_unlocked())
         return (FT_ERR_INVALID_STATE);
-
-    key_index = this->find_index_unlocked(key);
+    hash_value = this->hash_key(key);
+    key_index = this->find_index_with_hash_unlocked(key, hash_value);
     if (key_index != this->_capacity)
     {
         this->_data[key_index].second = value;
+        if (slot_index != ft_nullptr)
+            *slot_index = key_index;
         return (FT_ERR_SUCCESS);
     }
-
-    if ((this->_size * 2) >= this->_capacity)
+    if (this->_size + this->_tombstones + 1 > growth_limit(this->_capacity))
     {
         ft_size_t new_capacity;
         int32_t resize_error;
 
-        new_capacity = this->_capacity * 2;
-        if (new_capacity == 0)
-            new_capacity = 1;
+        new_capacity = this->_capacity;
+        if ((this->_size + 1) * 2 > this->_capacity)
+            new_capacity = this->_capacity * 2;
         resize_error = this->resize_unlocked(new_capacity);
         if (resize_error != FT_ERR_SUCCESS)
             return (resize_error);
     }
-
-    start_index = this->hash_key(key);
-    current_index = start_index;
-    while (FT_TRUE)
-    {
-        if (!this->_occupied[current_index])
-        {
-            construct_at(&this->_data[current_index], ft_pair<Key, MappedType>(key, value));
-            this->_occupied[current_index] = FT_TRUE;
-            this->_size += 1;
-            return (FT_ERR_SUCCESS);
-        }
-        current_index = (current_index + 1) % this->_capacity;
-        if (current_index == start_index)
-            return (FT_ERR_INTERNAL);
-    }
-    return (FT_ERR_INTERNAL);
+    key_index = this->find_insert_slot_unlocked(hash_value);
+    if (key_index == this->_capacity)
+        return (FT_ERR_INTERNAL);
+    if (this->_control[key_index] == FT_UNORDERED_MAP_CONTROL_DELETED)
+        this->_tombstones -= 1;
+    construct_at(&this->_data[key_index], ft_pair<Key, MappedType>(key, value));
+    this->_hashes[key_index] = hash_value;
+    this->_control[key_index] = static_cast<uint8_t>(hash_value & 0x7F);
+    this->_size += 1;
+    if (slot_index != ft_nullptr)
+        *slot_index = key_index;
+    return (FT_ERR_SUCCESS);
 }
 
 template <typename Key, typename MappedType>
@@ -490,9 +641,11 @@ int32_t ft_unordered_map<Key, MappedType>::unlock_internal(ft_bool lock_acquired
 template <typename Key, typename MappedType>
 ft_unordered_map<Key, MappedType>::ft_unordered_map(ft_size_t initial_capacity)
     : _data(ft_nullptr)
-    , _occupied(ft_nullptr)
+    , _hashes(ft_nullptr)
+    , _control(ft_nullptr)
     , _capacity(0)
     , _size(0)
+    , _tombstones(0)
     , _requested_capacity(initial_capacity)
     , _mutex(ft_nullptr)
     , _initialised_state(FT_CLASS_STATE_UNINITIALISED)
@@ -547,7 +700,7 @@ ft_unordered_map<Key, MappedType>& ft_unordered_map<Key, MappedType>::operator=(
     index = 0;
     while (index < other._capacity)
     {
-        if (other._occupied[index])
+        if (ft_unordered_map<Key, MappedType>::control_is_full(other._control[index]))
             this->insert(other._data[index].first, other._data[index].second);
         index += 1;
     }
@@ -574,9 +727,11 @@ ft_unordered_map<Key, MappedType>& ft_unordered_map<Key, MappedType>::operator=(
     if (other._initialised_state == FT_CLASS_STATE_DESTROYED)
     {
         this->_data = ft_nullptr;
-        this->_occupied = ft_nullptr;
+        this->_hashes = ft_nullptr;
+        this->_control = ft_nullptr;
         this->_capacity = 0;
         this->_size = 0;
+        this->_tombstones = 0;
         this->_requested_capacity = other._requested_capacity;
         this->_mutex = ft_nullptr;
         this->_initialised_state = FT_CLASS_STATE_DESTROYED;
@@ -584,16 +739,20 @@ ft_unordered_map<Key, MappedType>& ft_unordered_map<Key, MappedType>::operator=(
         return (*this);
     }
     this->_data = other._data;
-    this->_occupied = other._occupied;
+    this->_hashes = other._hashes;
+    this->_control = other._control;
     this->_capacity = other._capacity;
     this->_size = other._size;
+    this->_tombstones = other._tombstones;
     this->_requested_capacity = other._requested_capacity;
     this->_mutex = other._mutex;
     this->_initialised_state = FT_CLASS_STATE_INITIALISED;
     other._data = ft_nullptr;
-    other._occupied = ft_nullptr;
+    other._hashes = ft_nullptr;
+    other._control = ft_nullptr;
     other._capacity = 0;
     other._size = 0;
+    other._tombstones = 0;
     other._mutex = ft_nullptr;
     other._initialised_state = FT_CLASS_STATE_DESTROYED;
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
@@ -784,7 +943,7 @@ void ft_unordered_map<Key, MappedType>::insert(const Key& key, const MappedType&
         return ;
     }
 
-    insert_error = this->insert_internal_unlocked(key, value);
+    insert_error = this->insert_internal_unlocked(key, value, ft_nullptr);
     (void)this->unlock_internal(lock_acquired);
 
     if (insert_error != FT_ERR_SUCCESS)
@@ -811,7 +970,7 @@ ft_unordered_map<Key, MappedType>::find(const Key& key)
     if (lock_error != FT_ERR_SUCCESS)
     {
         ft_unordered_map<Key, MappedType>::set_error(lock_error);
-        return (iterator(this->_data, this->_occupied, this->_capacity,
+        return (iterator(this->_data, this->_control, this->_capacity,
             this->_capacity));
     }
 
@@ -820,9 +979,9 @@ ft_unordered_map<Key, MappedType>::find(const Key& key)
     (void)this->unlock_internal(lock_acquired);
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
     if (index == this->_capacity)
-        return (iterator(this->_data, this->_occupied, this->_capacity,
+        return (iterator(this->_data, this->_control, this->_capacity,
             this->_capacity));
-    return (iterator(this->_data, this->_occupied, index, this->_capacity));
+    return (iterator(this->_data, this->_control, index, this->_capacity));
 }
 
 template <typename Key, typename MappedType>
@@ -840,7 +999,7 @@ ft_unordered_map<Key, MappedType>::find(const Key& key) const
     if (lock_error != FT_ERR_SUCCESS)
     {
         ft_unordered_map<Key, MappedType>::set_error(lock_error);
-        return (const_iterator(this->_data, this->_occupied, this->_capacity,
+        return (const_iterator(this->_data, this->_control, this->_capacity,
             this->_capacity));
     }
 
@@ -849,9 +1008,9 @@ ft_unordered_map<Key, MappedType>::find(const Key& key) const
     (void)this->unlock_internal(lock_acquired);
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
     if (index == this->_capacity)
-        return (const_iterator(this->_data, this->_occupied, this->_capacity,
+        return (const_iterator(this->_data, this->_control, this->_capacity,
             this->_capacity));
-    return (const_iterator(this->_data, this->_occupied, index, this->_capacity));
+    return (const_iterator(this->_data, this->_control, index, this->_capacity));
 }
 
 template <typename Key, typename MappedType>
@@ -860,7 +1019,7 @@ void ft_unordered_map<Key, MappedType>::erase(const Key& key)
     ft_bool lock_acquired;
     int32_t lock_error;
     ft_size_t  index;
-    ft_size_t  next_index;
+    ft_size_t  group_offset;
 
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_unordered_map::erase");
 
@@ -881,31 +1040,15 @@ void ft_unordered_map<Key, MappedType>::erase(const Key& key)
     }
 
     ::destroy_at(&this->_data[index]);
-    this->_occupied[index] = FT_FALSE;
-    if (this->_size > 0)
-        this->_size -= 1;
-
-    next_index = (index + 1) % this->_capacity;
-    while (this->_occupied[next_index])
+    group_offset = index - index % FT_UNORDERED_MAP_GROUP_WIDTH;
+    if (match_byte(this->_control + group_offset, FT_UNORDERED_MAP_CONTROL_EMPTY) != 0)
+        this->_control[index] = FT_UNORDERED_MAP_CONTROL_EMPTY;
+    else
     {
-        ft_pair<Key, MappedType> moving_pair;
-        int32_t reinsert_error;
-
-        moving_pair = this->_data[next_index];
-        ::destroy_at(&this->_data[next_index]);
-        this->_occupied[next_index] = FT_FALSE;
-        if (this->_size > 0)
-            this->_size -= 1;
-
-        reinsert_error = this->insert_internal_unlocked(moving_pair.first, moving_pair.second);
-        if (reinsert_error != FT_ERR_SUCCESS)
-        {
-            (void)this->unlock_internal(lock_acquired);
-            ft_unordered_map<Key, MappedType>::set_error(reinsert_error);
-            return ;
-        }
-        next_index = (next_index + 1) % this->_capacity;
+        this->_control[index] = FT_UNORDERED_MAP_CONTROL_DELETED;
+        this->_tombstones += 1;
     }
+    this->_size -= 1;
 
     (void)this->unlock_internal(lock_acquired);
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
@@ -1053,7 +1196,7 @@ typename ft_unordered_map<Key, MappedType>::iterator ft_unordered_map<Key, Mappe
     errno_abort_if_uninitialised(this->_initialised_state, "ft_unordered_map::begin");
 
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
-    return (iterator(this->_data, this->_occupied, 0, this->_capacity));
+    return (iterator(this->_data, this->_control, 0, this->_capacity));
 }
 
 template <typename Key, typename MappedType>
@@ -1062,7 +1205,7 @@ typename ft_unordered_map<Key, MappedType>::iterator ft_unordered_map<Key, Mappe
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_unordered_map::end");
 
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
-    return (iterator(this->_data, this->_occupied, this->_capacity,
+    return (iterator(this->_data, this->_control, this->_capacity,
         this->_capacity));
 }
 
@@ -1073,7 +1216,7 @@ ft_unordered_map<Key, MappedType>::begin() const
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_unordered_map::begin const");
 
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
-    return (const_iterator(this->_data, this->_occupied, 0, this->_capacity));
+    return (const_iterator(this->_data, this->_control, 0, this->_capacity));
 }
 
 template <typename Key, typename MappedType>
@@ -1083,7 +1226,7 @@ ft_unordered_map<Key, MappedType>::end() const
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_unordered_map::end const");
 
     ft_unordered_map<Key, MappedType>::set_error(FT_ERR_SUCCESS);
-    return (const_iterator(this->_data, this->_occupied, this->_capacity,
+    return (const_iterator(this->_data, this->_control, this->_capacity,
         this->_capacity));
 }
 
@@ -1292,14 +1435,13 @@ ft_unordered_map<Key, MappedType>::operator[](const Key& key)
     key_index = this->find_index_unlocked(key);
     if (key_index == this->_capacity)
     {
-        insert_error = this->insert_internal_unlocked(key, MappedType());
+        insert_error = this->insert_internal_unlocked(key, MappedType(), &key_index);
         if (insert_error != FT_ERR_SUCCESS)
         {
             (void)this->unlock_internal(lock_acquired);
             ft_unordered_map<Key, MappedType>::set_error(insert_error);
             return (mapped_proxy(this, ft_nullptr, insert_error, 0));
         }
-        key_index = this->find_index_unlocked(key);
     }
 
     (void)this->unlock_internal(lock_acquired);
@@ -1325,7 +1467,7 @@ int32_t ft_unordered_map<Key, MappedType>::iterator::set_error(
 template <typename Key, typename MappedType>
 ft_unordered_map<Key, MappedType>::iterator::iterator()
     : _data(ft_nullptr)
-    , _occupied(ft_nullptr)
+    , _control(ft_nullptr)
     , _index(0)
     , _capacity(0)
     , _initialised_state(FT_CLASS_STATE_UNINITIALISED)
@@ -1335,14 +1477,14 @@ ft_unordered_map<Key, MappedType>::iterator::iterator()
 
 template <typename Key, typename MappedType>
 ft_unordered_map<Key, MappedType>::iterator::iterator(
-    ft_pair<Key, MappedType>* data, ft_bool* occupied, ft_size_t index, ft_size_t capacity)
+    ft_pair<Key, MappedType>* data, const uint8_t* control, ft_size_t index, ft_size_t capacity)
     : _data(ft_nullptr)
-    , _occupied(ft_nullptr)
+    , _control(ft_nullptr)
     , _index(0)
     , _capacity(0)
     , _initialised_state(FT_CLASS_STATE_UNINITIALISED)
 {
-    (void)this->initialize(data, occupied, index, capacity);
+    (void)this->initialize(data, control, index, capacity);
     return ;
 }
 
@@ -1361,13 +1503,13 @@ ft_unordered_map<Key, MappedType>::iterator::~iterator()
 
 template <typename Key, typename MappedType>
 int32_t ft_unordered_map<Key, MappedType>::iterator::initialize(
-    ft_pair<Key, MappedType>* data, ft_bool* occupied, ft_size_t index, ft_size_t capacity)
+    ft_pair<Key, MappedType>* data, const uint8_t* control, ft_size_t index, ft_size_t capacity)
 {
     if (this->_initialised_state
         == FT_CLASS_STATE_INITIALISED)
         errno_abort_lifecycle(this->_initialised_state, "ft_unordered_map::iterator::initialize", "called while already initialised");
     this->_data = data;
-    this->_occupied = occupied;
+    this->_control = control;
     this->_index = index;
     this->_capacity = capacity;
     this->_initialised_state
@@ -1384,7 +1526,7 @@ int32_t ft_unordered_map<Key, MappedType>::iterator::initialize(const iterator&
         == FT_CLASS_STATE_INITIALISED)
         errno_abort_lifecycle(this->_initialised_state, "ft_unordered_map::iterator::initialize copy", "called while already initialised");
     this->_data = other._data;
-    this->_occupied = other._occupied;
+    this->_control = other._control;
     this->_index = other._index;
     this->_capacity = other._capacity;
     this->_initialised_state
@@ -1401,14 +1543,14 @@ int32_t ft_unordered_map<Key, MappedType>::iterator::initialize(iterator&& other
         == FT_CLASS_STATE_INITIALISED)
         errno_abort_lifecycle(this->_initialised_state, "ft_unordered_map::iterator::initialize move", "called while already initialised");
     this->_data = other._data;
-    this->_occupied = other._occupied;
+    this->_control = other._control;
     this->_index = other._index;
     this->_capacity = other._capacity;
     this->_initialised_state
         = FT_CLASS_STATE_INITIALISED;
     this->advance_to_valid_index_unlocked();
     other._data = ft_nullptr;
-    other._occupied = ft_nullptr;
+    other._control = ft_nullptr;
     other._index = 0;
     other._capacity = 0;
     other._initialised_state
@@ -1427,7 +1569,7 @@ int32_t ft_unordered_map<Key, MappedType>::iterator::destroy()
         return (this->_last_error);
     }
     this->_data = ft_nullptr;
-    this->_occupied = ft_nullptr;
+    this->_control = ft_nullptr;
     this->_index = 0;
     this->_capacity = 0;
     this->_initialised_state
@@ -1442,12 +1584,12 @@ int32_t ft_unordered_map<Key, MappedType>::iterator::move(iterator& other)
     errno_abort_if_uninitialised(this->_initialised_state, "ft_unordered_map::iterator::move");
     errno_abort_if_uninitialised(other._initialised_state, "ft_unordered_map::iterator::move");
     this->_data = other._data;
-    this->_occupied = other._occupied;
+    this->_control = other._control;
     this->_index = other._index;
     this->_capacity = other._capacity;
     this->advance_to_valid_index_unlocked();
     other._data = ft_nullptr;
-    other._occupied = ft_nullptr;
+    other._control = ft_nullptr;
     other._index = 0;
     other._capacity = 0;
     other._initialised_state
@@ -1466,11 +1608,12 @@ int32_t ft_unordered_map<Key, MappedType>::iterator::get_error() const
 template <typename Key, typename MappedType>
 void ft_unordered_map<Key, MappedType>::iterator::advance_to_valid_index_unlocked()
 {
-    if (this->_occupied == ft_nullptr)
+    if (this->_control == ft_nullptr)
         return ;
     while (this->_index < this->_capacity)
     {
-        if (this->_occupied[this->_index])
+        if (ft_unordered_map<Key, MappedType>::control_is_full(
+                this->_control[this->_index]))
             return ;
         this->_index += 1;
     }
@@ -1488,7 +1631,7 @@ ft_pair<Key, MappedType>& ft_unordered_map<Key, MappedType>::iterator::operator*
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (error_value);
     }
-    if (this->_occupied == ft_nullptr)
+    if (this->_control == ft_nullptr)
     {
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (error_value);
@@ -1498,7 +1641,8 @@ ft_pair<Key, MappedType>& ft_unordered_map<Key, MappedType>::iterator::operator*
         (void)set_error(FT_ERR_OUT_OF_RANGE);
         return (error_value);
     }
-    if (!this->_occupied[this->_index])
+    if (!ft_unordered_map<Key, MappedType>::control_is_full(
+            this->_control[this->_index]))
     {
         (void)set_error(FT_ERR_NOT_FOUND);
         return (error_value);
@@ -1518,7 +1662,7 @@ ft_pair<Key, MappedType>* ft_unordered_map<Key, MappedType>::iterator::operator-
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (&error_value);
     }
-    if (this->_occupied == ft_nullptr)
+    if (this->_control == ft_nullptr)
     {
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (&error_value);
@@ -1528,7 +1672,8 @@ ft_pair<Key, MappedType>* ft_unordered_map<Key, MappedType>::iterator::operator-
         (void)set_error(FT_ERR_OUT_OF_RANGE);
         return (&error_value);
     }
-    if (!this->_occupied[this->_index])
+    if (!ft_unordered_map<Key, MappedType>::control_is_full(
+            this->_control[this->_index]))
     {
         (void)set_error(FT_ERR_NOT_FOUND);
         return (&error_value);
@@ -1556,7 +1701,7 @@ ft_bool ft_unordered_map<Key, MappedType>::iterator::operator==(const iterator&
     errno_abort_if_uninitialised_or_destroyed(other._initialised_state, "ft_unordered_map::iterator::operator==");
     (void)set_error(FT_ERR_SUCCESS);
     return (this->_data == other._data
-        && this->_occupied == other._occupied
+        && this->_control == other._control
         && this->_index == other._index
         && this->_capacity == other._capacity);
 }
@@ -1585,7 +1730,7 @@ int32_t ft_unordered_map<Key, MappedType>::const_iterator::set_error(
 template <typename Key, typename MappedType>
 ft_unordered_map<Key, MappedType>::const_iterator::const_iterator()
     : _data(ft_nullptr)
-    , _occupied(ft_nullptr)
+    , _control(ft_nullptr)
     , _index(0)
     , _capacity(0)
     , _initialised_state(FT_CLASS_STATE_UNINITIALISED)
@@ -1595,15 +1740,15 @@ ft_unordered_map<Key, MappedType>::const_iterator::const_iterator()
 
 template <typename Key, typename MappedType>
 ft_unordered_map<Key, MappedType>::const_iterator::const_iterator(
-    const ft_pair<Key, MappedType>* data, const ft_bool* occupied,
+    const ft_pair<Key, MappedType>* data, const uint8_t* control,
     ft_size_t index, ft_size_t capacity)
     : _data(ft_nullptr)
-    , _occupied(ft_nullptr)
+    , _control(ft_nullptr)
     , _index(0)
     , _capacity(0)
     , _initialised_state(FT_CLASS_STATE_UNINITIALISED)
 {
-    (void)this->initialize(data, occupied, index, capacity);
+    (void)this->initialize(data, control, index, capacity);
     return ;
 }
 
@@ -1622,14 +1767,14 @@ ft_unordered_map<Key, MappedType>::const_iterator::~const_iterator()
 
 template <typename Key, typename MappedType>
 int32_t ft_unordered_map<Key, MappedType>::const_iterator::initialize(
-    const ft_pair<Key, MappedType>* data, const ft_bool* occupied,
+    const ft_pair<Key, MappedType>* data, const uint8_t* control,
     ft_size_t index, ft_size_t capacity)
 {
     if (this->_initialised_state
         == FT_CLASS_STATE_INITIALISED)
         errno_abort_lifecycle(this->_initialised_state, "ft_unordered_map::const_iterator::initialize", "called while already initialised");
     this->_data = data;
-    this->_occupied = occupied;
+    this->_control = control;
     this->_index = index;
     this->_capacity = capacity;
     this->_initialised_state
@@ -1647,7 +1792,7 @@ int32_t ft_unordered_map<Key, MappedType>::const_iterator::initialize(
         == FT_CLASS_STATE_INITIALISED)
         errno_abort_lifecycle(this->_initialised_state, "ft_unordered_map::const_iterator::initialize copy", "called while already initialised");
     this->_data = other._data;
-    this->_occupied = other._occupied;
+    this->_control = other._control;
     this->_index = other._index;
     this->_capacity = other._capacity;
     this->_initialised_state
@@ -1665,14 +1810,14 @@ int32_t ft_unordered_map<Key, MappedType>::const_iterator::initialize(
         == FT_CLASS_STATE_INITIALISED)
         errno_abort_lifecycle(this->_initialised_state, "ft_unordered_map::const_iterator::initialize move", "called while already initialised");
     this->_data = other._data;
-    this->_occupied = other._occupied;
+    this->_control = other._control;
     this->_index = other._index;
     this->_capacity = other._capacity;
     this->_initialised_state
         = FT_CLASS_STATE_INITIALISED;
     this->advance_to_valid_index_unlocked();
     other._data = ft_nullptr;
-    other._occupied = ft_nullptr;
+    other._control = ft_nullptr;
     other._index = 0;
     other._capacity = 0;
     other._initialised_state
@@ -1691,7 +1836,7 @@ int32_t ft_unordered_map<Key, MappedType>::const_iterator::destroy()
         return (this->_last_error);
     }
     this->_data = ft_nullptr;
-    this->_occupied = ft_nullptr;
+    this->_control = ft_nullptr;
     this->_index = 0;
     this->_capacity = 0;
     this->_initialised_state
@@ -1706,12 +1851,12 @@ int32_t ft_unordered_map<Key, MappedType>::const_iterator::move(const_iterator&
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_unordered_map::const_iterator::move");
     errno_abort_if_uninitialised(other._initialised_state, "ft_unordered_map::const_iterator::move");
     this->_data = other._data;
-    this->_occupied = other._occupied;
+    this->_control = other._control;
     this->_index = other._index;
     this->_capacity = other._capacity;
     this->advance_to_valid_index_unlocked();
     other._data = ft_nullptr;
-    other._occupied = ft_nullptr;
+    other._control = ft_nullptr;
     other._index = 0;
     other._capacity = 0;
     other._initialised_state
@@ -1730,11 +1875,12 @@ int32_t ft_unordered_map<Key, MappedType>::const_iterator::get_error() const
 template <typename Key, typename MappedType>
 void ft_unordered_map<Key, MappedType>::const_iterator::advance_to_valid_index_unlocked()
 {
-    if (this->_occupied == ft_nullptr)
+    if (this->_control == ft_nullptr)
         return ;
     while (this->_index < this->_capacity)
     {
-        if (this->_occupied[this->_index])
+        if (ft_unordered_map<Key, MappedType>::control_is_full(
+                this->_control[this->_index]))
             return ;
         this->_index += 1;
     }
@@ -1753,7 +1899,7 @@ ft_unordered_map<Key, MappedType>::const_iterator::operator*() const
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (error_value);
     }
-    if (this->_occupied == ft_nullptr)
+    if (this->_control == ft_nullptr)
     {
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (error_value);
@@ -1763,7 +1909,8 @@ ft_unordered_map<Key, MappedType>::const_iterator::operator*() const
         (void)set_error(FT_ERR_OUT_OF_RANGE);
         return (error_value);
     }
-    if (!this->_occupied[this->_index])
+    if (!ft_unordered_map<Key, MappedType>::control_is_full(
+            this->_control[this->_index]))
     {
         (void)set_error(FT_ERR_NOT_FOUND);
         return (error_value);
@@ -1784,7 +1931,7 @@ ft_unordered_map<Key, MappedType>::const_iterator::operator->() const
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (&error_value);
     }
-    if (this->_occupied == ft_nullptr)
+    if (this->_control == ft_nullptr)
     {
         (void)set_error(FT_ERR_INVALID_POINTER);
         return (&error_value);
@@ -1794,7 +1941,8 @@ ft_unordered_map<Key, MappedType>::const_iterator::operator->() const
         (void)set_error(FT_ERR_OUT_OF_RANGE);
         return (&error_value);
     }
-    if (!this->_occupied[this->_index])
+    if (!ft_unordered_map<Key, MappedType>::control_is_full(
+            this->_control[this->_index]))
     {
         (void)set_error(FT_ERR_NOT_FOUND);
         return (&error_value);
@@ -1823,7 +1971,7 @@ ft_bool ft_unordered_map<Key, MappedType>::const_iterator::operator==(
     errno_abort_if_uninitialised_or_destroyed(other._initialised_state, "ft_unordered_map::const_iterator::operator==");
     (void)set_error(FT_ERR_SUCCESS);
     return (this->_data == other._data
-        && this->_occupied == other._occupied
+        && this->_control == other._control
         && this->_index == other._index
         && this->_capacity == other._capacity);
 }
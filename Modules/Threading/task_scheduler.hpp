@@ -16,6 +16,7 @@
 #include "../PThread/mutex.hpp"
 #include "../PThread/pthread_internal.hpp"
 #include "task_scheduler_tracing.hpp"
+#include "work_stealing_queue.hpp"
 
 #include <pthread.h>
 #include <cerrno>
@@ -177,7 +178,7 @@ class ft_task_scheduler
             int is_initialised() const;
         };
 
-        ft_blocking_queue<task_queue_entry> _queue;
+        ft_work_stealing_queue<task_queue_entry> _queue;
         ft_vector<ft_thread> _workers;
         ft_thread _timer_thread;
         ft_vector<scheduled_task> _scheduled;
@@ -200,7 +201,7 @@ class ft_task_scheduler
 
         bool cancel_task_state(const ft_sharedptr<ft_scheduled_task_state> &state);
         bool scheduled_remove_index(size_t index);
-        void worker_loop();
+        void worker_loop(size_t worker_index);
         void timer_loop();
         bool scheduled_heap_push(scheduled_task &&task);
         bool scheduled_heap_pop(scheduled_task &task);
@@ -700,23 +701,14 @@ int32_t ft_task_scheduler::submit(
     using return_type = typename std::invoke_result<FunctionType, Args...>::type;
     using promise_type = ft_promise<return_type>;
 
-    promise_type *promise_raw;
     ft_sharedptr<promise_type> promise_shared;
     std::shared_ptr<ft_sharedptr<promise_type> > promise_capture;
     int promise_shared_initialize_error;
     int future_initialize_error;
 
-    promise_shared_initialize_error = promise_shared.initialize();
-    if (promise_shared_initialize_error != FT_ERR_SUCCESS)
-        return (promise_shared_initialize_error);
-    promise_raw = new (std::nothrow) promise_type();
-    if (!promise_raw)
+    promise_shared = ft_make_shared<promise_type>();
+    if (!promise_shared)
         return (FT_ERR_NO_MEMORY);
-    promise_shared.reset(promise_raw, 1, false);
-    int promise_error = promise_shared.get_error();
-
-    if (promise_error != FT_ERR_SUCCESS)
-        return (promise_error);
     future_initialize_error = future_value.initialize(promise_shared);
     if (future_initialize_error != FT_ERR_SUCCESS)
         return (future_initialize_error);
@@ -751,24 +743,28 @@ int32_t ft_task_scheduler::submit(
         return ;
     };
     ft_function<void()> wrapper(task_body);
-    task_queue_entry queue_entry;
+    task_queue_entry *queue_entry;
     unsigned long long parent_span;
     unsigned long long trace_id;
     bool metrics_updated;
 
     parent_span = task_scheduler_trace_current_span();
     trace_id = task_scheduler_trace_generate_span_id();
-    queue_entry._function = ft_move(wrapper);
-    queue_entry._trace_id = trace_id;
-    queue_entry._parent_id = parent_span;
-    queue_entry._label = g_ft_task_trace_label_async;
+    queue_entry = new (std::nothrow) task_queue_entry();
+    if (queue_entry == ft_nullptr)
+        return (FT_ERR_NO_MEMORY);
+    queue_entry->_function = ft_move(wrapper);
+    queue_entry->_trace_id = trace_id;
+    queue_entry->_parent_id = parent_span;
+    queue_entry->_label = g_ft_task_trace_label_async;
     this->trace_emit_event(FT_TASK_TRACE_PHASE_SUBMITTED, trace_id, parent_span,
             g_ft_task_trace_label_async, false);
     this->trace_emit_event(FT_TASK_TRACE_PHASE_ENQUEUED, trace_id, parent_span,
             g_ft_task_trace_label_async, false);
-    int queue_push_error = this->_queue.push(ft_move(queue_entry));
+    int queue_push_error = this->_queue.push(queue_entry);
     if (queue_push_error != FT_ERR_SUCCESS)
     {
+        delete queue_entry;
         this->trace_emit_event(FT_TASK_TRACE_PHASE_CANCELLED, trace_id, parent_span,
                 g_ft_task_trace_label_async, false);
         return (queue_push_error);
@@ -790,29 +786,13 @@ auto ft_task_scheduler::schedule_after(std::chrono::duration<Rep, Period> delay,
     using promise_type = ft_promise<return_type>;
 
     Pair<ft_future<return_type>, ft_scheduled_task_handle> result_pair;
-    promise_type *promise_raw;
     ft_sharedptr<promise_type> promise_shared;
-    ft_scheduled_task_state *state_raw;
     ft_sharedptr<ft_scheduled_task_state> state_shared;
-    int shared_initialize_error;
-    int state_shared_initialize_error;
     int result_future_initialize_error;
 
-    shared_initialize_error = promise_shared.initialize();
-    if (shared_initialize_error != FT_ERR_SUCCESS)
-        return (result_pair);
-    promise_raw = new (std::nothrow) promise_type();
-    if (!promise_raw)
-    {
-        return (result_pair);
-    }
-    promise_shared.reset(promise_raw, 1, false);
-    int promise_error = promise_shared.get_error();
-
-    if (promise_error != FT_ERR_SUCCESS)
-    {
+    promise_shared = ft_make_shared<promise_type>();
+    if (!promise_shared)
         return (result_pair);
-    }
     result_future_initialize_error = result_pair.key.initialize(promise_shared);
     if (result_future_initialize_error != FT_ERR_SUCCESS)
     {
@@ -825,21 +805,9 @@ auto ft_task_scheduler::schedule_after(std::chrono::duration<Rep, Period> delay,
             return (result_pair);
         }
     }
-    state_raw = new (std::nothrow) ft_scheduled_task_state();
-    if (!state_raw)
-    {
-        return (result_pair);
-    }
-    state_shared_initialize_error = state_shared.initialize();
-    if (state_shared_initialize_error != FT_ERR_SUCCESS)
+    state_shared = ft_make_shared<ft_scheduled_task_state>();
+    if (!state_shared)
         return (result_pair);
-    state_shared.reset(state_raw, 1, false);
-    int state_error = state_shared.get_error();
-
-    if (state_error != FT_ERR_SUCCESS)
-    {
-        return (result_pair);
-    }
     destroy_at(&result_pair.value);
     construct_at(&result_pair.value, this, state_shared);
     if (!result_pair.value.valid())
@@ -951,30 +919,16 @@ ft_scheduled_task_handle ft_task_scheduler::schedule_every(std::chrono::duration
     std::chrono::milliseconds interval_duration;
     long long interval_milliseconds;
     t_monotonic_time_point start_point;
-    ft_scheduled_task_state *state_raw;
     ft_sharedptr<ft_scheduled_task_state> state_shared;
-    int state_shared_initialize_error;
 
     interval_duration = std::chrono::duration_cast<std::chrono::milliseconds>(interval);
     interval_milliseconds = interval_duration.count();
     start_point = time_monotonic_point_now();
     task_entry._time = time_monotonic_point_add_ms(start_point, interval_milliseconds);
     task_entry._interval_ms = interval_milliseconds;
-    state_raw = new (std::nothrow) ft_scheduled_task_state();
-    if (!state_raw)
-    {
+    state_shared = ft_make_shared<ft_scheduled_task_state>();
+    if (!state_shared)
         return (handle_result);
-    }
-    state_shared_initialize_error = state_shared.initialize();
-    if (state_shared_initialize_error != FT_ERR_SUCCESS)
-        return (handle_result);
-    state_shared.reset(state_raw, 1, false);
-    int state_error = state_shared.get_error();
-
-    if (state_error != FT_ERR_SUCCESS)
-    {
-        return (handle_result);
-    }
     handle_result = ft_scheduled_task_handle(this, state_shared);
     if (!handle_result.valid())
     {
@@ -0,0 +1,262 @@
+#ifndef THREADING_TASK_SLAB_HPP
+#define THREADING_TASK_SLAB_HPP
+
+#include "../Errno/errno.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../CMA/CMA.hpp"
+#include "../PThread/mutex.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#define FT_TASK_SLAB_FIRST_CHUNK 64U
+#define FT_TASK_SLAB_MAX_CHUNKS 24U
+
+// Hands out task objects from chunks that are kept until destroy, so a
+// released task is reused by the next create instead of going back to the
+// allocator. Chunk k holds FT_TASK_SLAB_FIRST_CHUNK << k nodes. The free list
+// is a tagged index stack: the tag changes on every update, so a node that is
+// popped and pushed again between a load and the CAS cannot corrupt it.
+template <typename TaskType>
+class ft_task_slab
+{
+#ifdef LIBFT_TEST_BUILD
+    public:
+#else
+    private:
+#endif
+        struct node
+        {
+            alignas(TaskType) unsigned char storage[sizeof(TaskType)];
+            std::atomic<uint32_t>           next;
+            uint32_t                        index;
+        };
+
+        std::atomic<node *>     _chunks[FT_TASK_SLAB_MAX_CHUNKS];
+        uint32_t                _chunk_count;
+        std::atomic<uint64_t>   _free_head;
+        pt_mutex                _grow_mutex;
+        uint8_t                 _initialised_state;
+
+        node *node_at(uint32_t index) const;
+        node *pop_free();
+        void push_free(node *first, node *last);
+        node *grow();
+
+    public:
+        ft_task_slab();
+        ft_task_slab(const ft_task_slab &other) = delete;
+        ft_task_slab(ft_task_slab &&other) = delete;
+        ~ft_task_slab();
+
+        ft_task_slab &operator=(const ft_task_slab &other) = delete;
+        ft_task_slab &operator=(ft_task_slab &&other) = delete;
+
+        int32_t initialize();
+        int32_t destroy();
+
+        template <typename... Args>
+        TaskType *create(Args &&... args);
+        void release(TaskType *task);
+        ft_size_t capacity() const;
+};
+
+template <typename TaskType>
+ft_task_slab<TaskType>::ft_task_slab()
+    : _chunks(), _chunk_count(0), _free_head(0), _grow_mutex(),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+template <typename TaskType>
+ft_task_slab<TaskType>::~ft_task_slab()
+{
+    (void)this->destroy();
+    return ;
+}
+
+template <typename TaskType>
+int32_t ft_task_slab<TaskType>::initialize()
+{
+    uint32_t chunk;
+    int32_t error_code;
+
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "ft_task_slab::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    error_code = this->_grow_mutex.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (error_code);
+    }
+    chunk = 0;
+    while (chunk < FT_TASK_SLAB_MAX_CHUNKS)
+    {
+        this->_chunks[chunk].store(ft_nullptr, std::memory_order_relaxed);
+        chunk++;
+    }
+    this->_chunk_count = 0;
+    this->_free_head.store(0, std::memory_order_relaxed);
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+int32_t ft_task_slab<TaskType>::destroy()
+{
+    uint32_t chunk;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+    {
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (FT_ERR_SUCCESS);
+    }
+    chunk = 0;
+    while (chunk < this->_chunk_count)
+    {
+        cma_free(this->_chunks[chunk].load(std::memory_order_relaxed));
+        this->_chunks[chunk].store(ft_nullptr, std::memory_order_relaxed);
+        chunk++;
+    }
+    this->_chunk_count = 0;
+    this->_free_head.store(0, std::memory_order_relaxed);
+    (void)this->_grow_mutex.destroy();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+typename ft_task_slab<TaskType>::node *ft_task_slab<TaskType>::node_at(uint32_t index) const
+{
+    uint32_t group;
+    uint32_t chunk;
+
+    group = index / FT_TASK_SLAB_FIRST_CHUNK + 1;
+    chunk = 0;
+    while ((2U << chunk) <= group)
+        chunk++;
+    return (this->_chunks[chunk].load(std::memory_order_acquire)
+        + (index - FT_TASK_SLAB_FIRST_CHUNK * ((1U << chunk) - 1)));
+}
+
+template <typename TaskType>
+typename ft_task_slab<TaskType>::node *ft_task_slab<TaskType>::pop_free()
+{
+    uint64_t head;
+    uint64_t next_head;
+    node *candidate;
+
+    head = this->_free_head.load(std::memory_order_acquire);
+    while (static_cast<uint32_t>(head) != 0)
+    {
+        candidate = this->node_at(static_cast<uint32_t>(head) - 1);
+        next_head = (((head >> 32) + 1) << 32)
+            | candidate->next.load(std::memory_order_relaxed);
+        if (this->_free_head.compare_exchange_weak(head, next_head,
+                std::memory_order_acq_rel, std::memory_order_acquire))
+            return (candidate);
+    }
+    return (ft_nullptr);
+}
+
+template <typename TaskType>
+void ft_task_slab<TaskType>::push_free(node *first, node *last)
+{
+    uint64_t head;
+    uint64_t next_head;
+
+    head = this->_free_head.load(std::memory_order_relaxed);
+    do
+    {
+        last->next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        next_head = (((head >> 32) + 1) << 32) | (first->index + 1);
+    }
+    while (!this->_free_head.compare_exchange_weak(head, next_head,
+            std::memory_order_release, std::memory_order_relaxed));
+    return ;
+}
+
+template <typename TaskType>
+typename ft_task_slab<TaskType>::node *ft_task_slab<TaskType>::grow()
+{
+    node *nodes;
+    node *recycled;
+    uint32_t node_count;
+    uint32_t base;
+    uint32_t index;
+
+    if (this->_grow_mutex.lock() != FT_ERR_SUCCESS)
+        return (ft_nullptr);
+    recycled = this->pop_free();
+    if (recycled != ft_nullptr || this->_chunk_count == FT_TASK_SLAB_MAX_CHUNKS)
+    {
+        (void)this->_grow_mutex.unlock();
+        return (recycled);
+    }
+    node_count = FT_TASK_SLAB_FIRST_CHUNK << this->_chunk_count;
+    base = FT_TASK_SLAB_FIRST_CHUNK * ((1U << this->_chunk_count) - 1);
+    nodes = static_cast<node *>(cma_malloc(sizeof(node) * node_count));
+    if (nodes == ft_nullptr)
+    {
+        (void)this->_grow_mutex.unlock();
+        return (ft_nullptr);
+    }
+    index = 0;
+    while (index < node_count)
+    {
+        new (&nodes[index]) node();
+        nodes[index].index = base + index;
+        nodes[index].next.store(base + index + 2, std::memory_order_relaxed);
+        index++;
+    }
+    this->_chunks[this->_chunk_count].store(nodes, std::memory_order_release);
+    this->_chunk_count++;
+    if (node_count > 1)
+        this->push_free(&nodes[1], &nodes[node_count - 1]);
+    (void)this->_grow_mutex.unlock();
+    return (&nodes[0]);
+}
+
+template <typename TaskType>
+template <typename... Args>
+TaskType *ft_task_slab<TaskType>::create(Args &&... args)
+{
+    node *slot;
+
+    slot = this->pop_free();
+    if (slot == ft_nullptr)
+        slot = this->grow();
+    if (slot == ft_nullptr)
+        return (ft_nullptr);
+    return (new (slot->storage) TaskType(std::forward<Args>(args)...));
+}
+
+template <typename TaskType>
+void ft_task_slab<TaskType>::release(TaskType *task)
+{
+    node *slot;
+
+    if (task == ft_nullptr)
+        return ;
+    task->~TaskType();
+    slot = reinterpret_cast<node *>(reinterpret_cast<unsigned char *>(task));
+    this->push_free(slot, slot);
+    return ;
+}
+
+template <typename TaskType>
+ft_size_t ft_task_slab<TaskType>::capacity() const
+{
+    return (static_cast<ft_size_t>(FT_TASK_SLAB_FIRST_CHUNK)
+        * ((static_cast<ft_size_t>(1) << this->_chunk_count) - 1));
+}
+
+#endif
@@ -12,7 +12,11 @@
 #include "../Template/queue.hpp"
 #include "cancellation.hpp"
 #include "../Template/function.hpp"
+#include "../Template/move_only_function.hpp"
 #include "../Template/move.hpp"
+#include "work_stealing_queue.hpp"
+#include "task_slab.hpp"
+#include <atomic>
 #include <cstddef>
 #include <utility>
 #include <type_traits>
@@ -20,14 +24,14 @@
 class ft_thread_pool
 {
     private:
-        ft_vector<ft_thread>            _workers;
-        ft_queue<ft_function<void()> >  _tasks;
-        ft_size_t                       _configured_thread_count;
-        ft_size_t                       _max_tasks;
-        ft_bool                         _stop;
-        ft_size_t                       _active;
-        mutable pt_recursive_mutex      *_work_mutex;
-        mutable pt_recursive_mutex      *_thread_safe_mutex;
+        ft_vector<ft_thread>                            _workers;
+        ft_work_stealing_queue<ft_move_only_function<void()> >  _tasks;
+        ft_task_slab<ft_move_only_function<void()> >    _task_slab;
+        ft_size_t                                       _configured_thread_count;
+        ft_size_t                                       _max_tasks;
+        std::atomic<bool>                               _stop;
+        std::atomic<ft_size_t>                          _outstanding;
+        mutable pt_recursive_mutex                      *_thread_safe_mutex;
         uint8_t                         _initialised_state;
         static thread_local int32_t     _last_error;
 
@@ -35,8 +39,9 @@ class ft_thread_pool
         int32_t lock_internal(ft_bool *lock_acquired) const;
         void unlock_internal(ft_bool lock_acquired) const;
 
-        static void worker_entry(ft_thread_pool *pool);
-        void worker();
+        static void worker_entry(ft_thread_pool *pool, ft_size_t worker_index);
+        void release_queued_tasks();
+        void worker(ft_size_t worker_index);
 
     public:
         ft_thread_pool(ft_size_t thread_count = 0, ft_size_t max_tasks = 0);
@@ -76,8 +81,8 @@ void ft_thread_pool::submit(Function &&function)
 {
     ft_bool lock_acquired;
     int32_t lock_error;
-    int32_t work_lock_error;
-    ft_size_t task_count;
+    int32_t push_error;
+    ft_move_only_function<void()> *task;
 
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_thread_pool::submit");
     lock_acquired = FT_FALSE;
@@ -87,43 +92,37 @@ void ft_thread_pool::submit(Function &&function)
         set_error(lock_error);
         return ;
     }
-    work_lock_error = pt_recursive_mutex_lock_if_not_null(this->_work_mutex);
-    if (work_lock_error != FT_ERR_SUCCESS)
+    if (this->_stop.load())
     {
         this->unlock_internal(lock_acquired);
-        set_error(work_lock_error);
+        set_error(FT_ERR_INVALID_STATE);
         return ;
     }
-    if (this->_stop)
+    if (this->_max_tasks != 0
+        && static_cast<ft_size_t>(this->_tasks.pending()) >= this->_max_tasks)
     {
-        (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
         this->unlock_internal(lock_acquired);
-        set_error(FT_ERR_INVALID_STATE);
+        set_error(FT_ERR_FULL);
         return ;
     }
-    if (this->_max_tasks != 0)
+    task = this->_task_slab.create(std::forward<Function>(function));
+    if (task == ft_nullptr || !(*task))
     {
-        task_count = this->_tasks.size();
-        if (task_count >= this->_max_tasks)
-        {
-            (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
-            this->unlock_internal(lock_acquired);
-            set_error(FT_ERR_FULL);
-            return ;
-        }
+        this->_task_slab.release(task);
+        this->unlock_internal(lock_acquired);
+        set_error(FT_ERR_NO_MEMORY);
+        return ;
     }
+    this->_outstanding.fetch_add(1);
+    push_error = this->_tasks.push(task);
+    if (push_error != FT_ERR_SUCCESS)
     {
-        ft_function<void()> wrapper(ft_move(function));
-        this->_tasks.enqueue(ft_move(wrapper));
-        if (this->_tasks.get_error() != FT_ERR_SUCCESS)
-        {
-            (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
-            this->unlock_internal(lock_acquired);
-            set_error(this->_tasks.get_error());
-            return ;
-        }
+        this->_outstanding.fetch_sub(1);
+        this->_task_slab.release(task);
+        this->unlock_internal(lock_acquired);
+        set_error(push_error);
+        return ;
     }
-    (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
     this->unlock_internal(lock_acquired);
     set_error(FT_ERR_SUCCESS);
     return ;
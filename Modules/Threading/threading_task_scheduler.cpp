@@ -743,7 +743,7 @@ int ft_task_scheduler::initialize(size_t thread_count)
         this->_running.store(false);
         return (FT_ERR_INVALID_STATE);
     }
-    queue_initialize_error = this->_queue.initialize();
+    queue_initialize_error = this->_queue.initialize(thread_count);
     if (queue_initialize_error != FT_ERR_SUCCESS)
     {
         this->_running.store(false);
@@ -798,9 +798,9 @@ int ft_task_scheduler::initialize(size_t thread_count)
     index = 0;
     while (index < thread_count)
     {
-        ft_thread worker([this]()
+        ft_thread worker([this, index]()
         {
-            this->worker_loop();
+            this->worker_loop(index);
             return ;
         });
         {
@@ -949,39 +949,45 @@ int ft_task_scheduler::destroy()
     return (FT_ERR_SUCCESS);
 }
 
-void ft_task_scheduler::worker_loop()
+void ft_task_scheduler::worker_loop(size_t worker_index)
 {
+    this->_queue.bind_worker(worker_index);
     while (true)
     {
-        task_queue_entry queue_entry;
-        bool has_task;
+        task_queue_entry *queue_entry;
         unsigned long long previous_span;
 
         if (!this->_running.load())
             break ;
-        has_task = this->_queue.wait_pop(queue_entry, this->_running);
-        if (!has_task)
+        queue_entry = this->_queue.wait_pop(worker_index);
+        if (queue_entry == ft_nullptr)
+            break ;
+        if (!this->_running.load())
         {
-            if (!this->_running.load())
-                break ;
-            continue;
+            delete queue_entry;
+            break ;
         }
-        if (!this->update_worker_counters(1, -1))
-            return ;
-        if (!this->update_queue_size(-1))
+        if (!this->update_worker_counters(1, -1) || !this->update_queue_size(-1))
+        {
+            delete queue_entry;
             return ;
-        this->trace_emit_event(FT_TASK_TRACE_PHASE_DEQUEUED, queue_entry._trace_id,
-                queue_entry._parent_id, queue_entry._label, false);
-        this->trace_emit_event(FT_TASK_TRACE_PHASE_STARTED, queue_entry._trace_id,
-                queue_entry._parent_id, queue_entry._label, false);
-        previous_span = task_scheduler_trace_push_span(queue_entry._trace_id);
-        if (queue_entry._function)
-            queue_entry._function();
+        }
+        this->trace_emit_event(FT_TASK_TRACE_PHASE_DEQUEUED, queue_entry->_trace_id,
+                queue_entry->_parent_id, queue_entry->_label, false);
+        this->trace_emit_event(FT_TASK_TRACE_PHASE_STARTED, queue_entry->_trace_id,
+                queue_entry->_parent_id, queue_entry->_label, false);
+        previous_span = task_scheduler_trace_push_span(queue_entry->_trace_id);
+        if (queue_entry->_function)
+            queue_entry->_function();
         task_scheduler_trace_pop_span(previous_span);
         if (!this->update_worker_counters(-1, 1))
+        {
+            delete queue_entry;
             return ;
-        this->trace_emit_event(FT_TASK_TRACE_PHASE_FINISHED, queue_entry._trace_id,
-                queue_entry._parent_id, queue_entry._label, false);
+        }
+        this->trace_emit_event(FT_TASK_TRACE_PHASE_FINISHED, queue_entry->_trace_id,
+                queue_entry->_parent_id, queue_entry->_label, false);
+        delete queue_entry;
     }
     (void)this->update_worker_counters(0, -1);
     return ;
@@ -1444,13 +1450,16 @@ void ft_task_scheduler::timer_loop()
                 }
                 continue;
             }
-            task_queue_entry queue_entry;
+            task_queue_entry *queue_entry;
 
-            queue_entry._function = expired_task._function;
-            if (!queue_entry._function)
+            queue_entry = new (std::nothrow) task_queue_entry();
+            if (queue_entry != ft_nullptr)
+                queue_entry->_function = expired_task._function;
+            if (queue_entry == ft_nullptr || !queue_entry->_function)
             {
                 ft_function<void()> original_function;
 
+                delete queue_entry;
                 original_function = ft_move(expired_task._function);
                 (void)pt_mutex_unlock_if_not_null(&this->_scheduled_mutex);
                 if (original_function)
@@ -1489,18 +1498,19 @@ void ft_task_scheduler::timer_loop()
                 continue;
             }
             (void)pt_mutex_unlock_if_not_null(&this->_scheduled_mutex);
-            queue_entry._trace_id = expired_task._trace_id;
-            queue_entry._parent_id = expired_task._parent_id;
-            queue_entry._label = expired_task._label;
+            queue_entry->_trace_id = expired_task._trace_id;
+            queue_entry->_parent_id = expired_task._parent_id;
+            queue_entry->_label = expired_task._label;
             this->trace_emit_event(FT_TASK_TRACE_PHASE_TIMER_TRIGGERED,
-                    queue_entry._trace_id, queue_entry._parent_id,
-                    queue_entry._label, true);
+                    queue_entry->_trace_id, queue_entry->_parent_id,
+                    queue_entry->_label, true);
             this->trace_emit_event(FT_TASK_TRACE_PHASE_ENQUEUED,
                     expired_task._trace_id, expired_task._parent_id,
                     expired_task._label, true);
-            int queue_push_error = this->_queue.push(ft_move(queue_entry));
+            int queue_push_error = this->_queue.push(queue_entry);
             if (queue_push_error != FT_ERR_SUCCESS)
             {
+                delete queue_entry;
                 this->trace_emit_event(FT_TASK_TRACE_PHASE_CANCELLED,
                         expired_task._trace_id, expired_task._parent_id,
                         expired_task._label, true);
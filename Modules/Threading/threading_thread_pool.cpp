@@ -38,52 +38,47 @@ void ft_thread_pool::unlock_internal(ft_bool lock_acquired) const
     return ;
 }
 
-void ft_thread_pool::worker_entry(ft_thread_pool *pool)
+void ft_thread_pool::worker_entry(ft_thread_pool *pool, ft_size_t worker_index)
 {
     if (pool == ft_nullptr)
         return ;
-    pool->worker();
+    pool->worker(worker_index);
     return ;
 }
 
-void ft_thread_pool::worker()
+void ft_thread_pool::worker(ft_size_t worker_index)
 {
-    int32_t work_lock_error;
+    ft_move_only_function<void()> *task;
 
+    this->_tasks.bind_worker(worker_index);
     while (FT_TRUE)
     {
-        ft_function<void()> task;
-
-        work_lock_error = pt_recursive_mutex_lock_if_not_null(this->_work_mutex);
-        if (work_lock_error != FT_ERR_SUCCESS)
-            return ;
-        if (this->_stop && this->_tasks.empty())
-        {
-            (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
+        task = this->_tasks.wait_pop(worker_index);
+        if (task == ft_nullptr)
             return ;
-        }
-        if (this->_tasks.empty())
-        {
-            (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
-            pt_thread_yield();
-            continue ;
-        }
-        task = this->_tasks.dequeue();
-        this->_active += 1;
-        (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
-        task();
-        work_lock_error = pt_recursive_mutex_lock_if_not_null(this->_work_mutex);
-        if (work_lock_error != FT_ERR_SUCCESS)
-            return ;
-        this->_active -= 1;
-        (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
+        (*task)();
+        this->_task_slab.release(task);
+        this->_outstanding.fetch_sub(1);
+    }
+    return ;
+}
+
+void ft_thread_pool::release_queued_tasks()
+{
+    ft_move_only_function<void()> *task;
+
+    task = this->_tasks.try_pop(0);
+    while (task != ft_nullptr)
+    {
+        this->_task_slab.release(task);
+        task = this->_tasks.try_pop(0);
     }
     return ;
 }
 
 ft_thread_pool::ft_thread_pool(ft_size_t thread_count, ft_size_t max_tasks)
-    : _workers(), _tasks(), _configured_thread_count(thread_count),
-      _max_tasks(max_tasks), _stop(FT_FALSE), _active(0), _work_mutex(ft_nullptr),
+    : _workers(), _tasks(), _task_slab(), _configured_thread_count(thread_count),
+      _max_tasks(max_tasks), _stop(false), _outstanding(0),
       _thread_safe_mutex(ft_nullptr),
       _initialised_state(FT_CLASS_STATE_UNINITIALISED)
 {
@@ -106,7 +101,6 @@ ft_thread_pool::~ft_thread_pool()
 int32_t ft_thread_pool::initialize()
 {
     ft_size_t worker_index;
-    int32_t mutex_result;
     int32_t queue_result;
     int32_t workers_result;
 
@@ -115,56 +109,49 @@ int32_t ft_thread_pool::initialize()
         errno_abort_lifecycle(this->_initialised_state, "ft_thread_pool::initialize", "called while object is already initialised");
         return (set_error(FT_ERR_INVALID_STATE));
     }
-    this->_stop = FT_FALSE;
-    this->_active = 0;
-    this->_work_mutex = new (std::nothrow) pt_recursive_mutex();
-    if (this->_work_mutex == ft_nullptr)
-    {
-        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
-        return (set_error(FT_ERR_NO_MEMORY));
-    }
-    mutex_result = this->_work_mutex->initialize();
-    if (mutex_result != FT_ERR_SUCCESS)
-    {
-        delete this->_work_mutex;
-        this->_work_mutex = ft_nullptr;
-        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
-        return (set_error(mutex_result));
-    }
+    this->_stop.store(false);
+    this->_outstanding.store(0);
     workers_result = this->_workers.initialize();
     if (workers_result != FT_ERR_SUCCESS)
     {
-        (void)this->_work_mutex->destroy();
-        delete this->_work_mutex;
-        this->_work_mutex = ft_nullptr;
         this->_initialised_state = FT_CLASS_STATE_DESTROYED;
         return (set_error(workers_result));
     }
-    queue_result = this->_tasks.initialize();
+    queue_result = this->_task_slab.initialize();
+    if (queue_result == FT_ERR_SUCCESS)
+    {
+        queue_result = this->_tasks.initialize(this->_configured_thread_count);
+        if (queue_result != FT_ERR_SUCCESS)
+            (void)this->_task_slab.destroy();
+    }
     if (queue_result != FT_ERR_SUCCESS)
     {
         (void)this->_workers.destroy();
-        (void)this->_work_mutex->destroy();
-        delete this->_work_mutex;
-        this->_work_mutex = ft_nullptr;
         this->_initialised_state = FT_CLASS_STATE_DESTROYED;
         return (set_error(queue_result));
     }
     worker_index = 0;
     while (worker_index < this->_configured_thread_count)
     {
-        ft_thread worker(&ft_thread_pool::worker_entry, this);
+        ft_thread worker(&ft_thread_pool::worker_entry, this, worker_index);
 
         this->_workers.push_back(ft_move(worker));
         if (this->_workers.get_error() != FT_ERR_SUCCESS)
         {
+            workers_result = this->_workers.get_error();
+            this->_stop.store(true);
+            this->_tasks.shutdown();
+            while (this->_workers.size() > 0)
+            {
+                if (this->_workers[this->_workers.size() - 1].joinable())
+                    this->_workers[this->_workers.size() - 1].join();
+                this->_workers.pop_back();
+            }
             (void)this->_tasks.destroy();
+            (void)this->_task_slab.destroy();
             (void)this->_workers.destroy();
-            (void)this->_work_mutex->destroy();
-            delete this->_work_mutex;
-            this->_work_mutex = ft_nullptr;
             this->_initialised_state = FT_CLASS_STATE_DESTROYED;
-            return (set_error(this->_workers.get_error()));
+            return (set_error(workers_result));
         }
         ++worker_index;
     }
@@ -183,22 +170,11 @@ int32_t ft_thread_pool::destroy()
 {
     ft_size_t worker_index;
     ft_size_t worker_count;
-    int32_t first_error;
-    int32_t work_lock_error;
-    int32_t work_destroy_error;
-    pt_recursive_mutex *work_mutex_pointer;
 
     if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
         return (set_error(FT_ERR_SUCCESS));
-    first_error = FT_ERR_SUCCESS;
-    work_lock_error = pt_recursive_mutex_lock_if_not_null(this->_work_mutex);
-    if (work_lock_error != FT_ERR_SUCCESS)
-        first_error = work_lock_error;
-    else
-    {
-        this->_stop = FT_TRUE;
-        (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
-    }
+    this->_stop.store(true);
+    this->_tasks.shutdown();
     worker_index = 0;
     worker_count = this->_workers.size();
     while (worker_index < worker_count)
@@ -209,18 +185,12 @@ int32_t ft_thread_pool::destroy()
     }
     this->_workers.clear();
     (void)this->_workers.destroy();
+    this->release_queued_tasks();
     (void)this->_tasks.destroy();
-    work_mutex_pointer = this->_work_mutex;
-    this->_work_mutex = ft_nullptr;
-    if (work_mutex_pointer != ft_nullptr)
-    {
-        work_destroy_error = work_mutex_pointer->destroy();
-        delete work_mutex_pointer;
-        if (first_error == FT_ERR_SUCCESS && work_destroy_error != FT_ERR_SUCCESS)
-            first_error = work_destroy_error;
-    }
+    (void)this->_task_slab.destroy();
+    this->_outstanding.store(0);
     this->_initialised_state = FT_CLASS_STATE_DESTROYED;
-    return (set_error(first_error));
+    return (set_error(FT_ERR_SUCCESS));
 }
 
 int32_t ft_thread_pool::move(ft_thread_pool &other) noexcept
@@ -248,9 +218,8 @@ int32_t ft_thread_pool::move(ft_thread_pool &other) noexcept
     this->_max_tasks = other._max_tasks;
     if (other._initialised_state == FT_CLASS_STATE_DESTROYED)
     {
-        this->_stop = FT_FALSE;
-        this->_active = 0;
-        this->_work_mutex = ft_nullptr;
+        this->_stop.store(false);
+        this->_outstanding.store(0);
         this->_thread_safe_mutex = ft_nullptr;
         this->_initialised_state = FT_CLASS_STATE_DESTROYED;
         return (set_error(FT_ERR_SUCCESS));
@@ -280,8 +249,6 @@ void ft_thread_pool::wait()
 {
     ft_bool lock_acquired;
     int32_t lock_error;
-    int32_t work_lock_error;
-    ft_bool done;
 
     errno_abort_if_uninitialised_or_destroyed(this->_initialised_state, "ft_thread_pool::wait");
     lock_acquired = FT_FALSE;
@@ -291,23 +258,9 @@ void ft_thread_pool::wait()
         set_error(lock_error);
         return ;
     }
-    done = FT_FALSE;
-    while (done == FT_FALSE)
-    {
-        work_lock_error = pt_recursive_mutex_lock_if_not_null(this->_work_mutex);
-        if (work_lock_error != FT_ERR_SUCCESS)
-        {
-            this->unlock_internal(lock_acquired);
-            set_error(work_lock_error);
-            return ;
-        }
-        if (this->_tasks.empty() == FT_TRUE && this->_active == 0)
-            done = FT_TRUE;
-        (void)pt_recursive_mutex_unlock_if_not_null(this->_work_mutex);
-        if (done == FT_FALSE)
-            pt_thread_yield();
-    }
     this->unlock_internal(lock_acquired);
+    while (this->_outstanding.load() != 0)
+        pt_thread_yield();
     set_error(FT_ERR_SUCCESS);
     return ;
 }
@@ -0,0 +1,685 @@
+#ifndef THREADING_WORK_STEALING_QUEUE_HPP
+#define THREADING_WORK_STEALING_QUEUE_HPP
+
+#include "../Errno/errno.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../CMA/CMA.hpp"
+#include "../PThread/condition.hpp"
+#include "../PThread/mutex.hpp"
+#include "../PThread/pthread.hpp"
+#include "../PThread/pthread_internal.hpp"
+#include "../Template/constructor.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <new>
+
+#define FT_WORK_STEALING_DEQUE_INITIAL_CAPACITY 64
+#define FT_WORK_STEALING_PARK_TIMEOUT_NS 20000000L
+#define FT_WORK_STEALING_INJECTION_INITIAL_CAPACITY 64
+
+template <typename TaskType>
+class ft_work_stealing_deque
+{
+#ifdef LIBFT_TEST_BUILD
+    public:
+#else
+    private:
+#endif
+        struct ring
+        {
+            int64_t                 capacity;
+            std::atomic<TaskType *> *slots;
+            ring                    *retired;
+        };
+
+        alignas(64) std::atomic<int64_t>    _top;
+        alignas(64) std::atomic<int64_t>    _bottom;
+        std::atomic<ring *>                 _ring;
+        uint8_t                             _initialised_state;
+
+        static ring *allocate_ring(int64_t capacity);
+        static void release_rings(ring *ring_pointer);
+        ring *grow(ring *current, int64_t top, int64_t bottom);
+
+    public:
+        ft_work_stealing_deque();
+        ft_work_stealing_deque(const ft_work_stealing_deque &other) = delete;
+        ft_work_stealing_deque(ft_work_stealing_deque &&other) = delete;
+        ~ft_work_stealing_deque();
+
+        ft_work_stealing_deque &operator=(const ft_work_stealing_deque &other) = delete;
+        ft_work_stealing_deque &operator=(ft_work_stealing_deque &&other) = delete;
+
+        int32_t initialize();
+        int32_t destroy();
+
+        int32_t push(TaskType *task);
+        TaskType *pop();
+        TaskType *steal();
+        int64_t size() const;
+};
+
+template <typename TaskType>
+class ft_work_stealing_queue
+{
+#ifdef LIBFT_TEST_BUILD
+    public:
+#else
+    private:
+#endif
+        ft_work_stealing_deque<TaskType>    *_deques;
+        ft_size_t                           _worker_count;
+        TaskType                            **_injection;
+        ft_size_t                           _injection_capacity;
+        ft_size_t                           _injection_head;
+        ft_size_t                           _injection_count;
+        mutable pt_mutex                    _injection_mutex;
+        mutable pt_mutex                    _park_mutex;
+        pt_condition_variable               _park_condition;
+        std::atomic<int64_t>                _pending;
+        std::atomic<int64_t>                _parked;
+        std::atomic<bool>                   _shutdown;
+        uint8_t                             _initialised_state;
+        static thread_local const ft_work_stealing_queue<TaskType> *_current_queue;
+        static thread_local ft_size_t       _current_worker;
+        static thread_local uint64_t        _steal_seed;
+
+        int32_t push_injection(TaskType *task);
+        TaskType *pop_injection();
+        TaskType *steal_from_victims(ft_size_t worker_index);
+        void unpark_one();
+        void delete_remaining_tasks();
+
+    public:
+        ft_work_stealing_queue();
+        ft_work_stealing_queue(const ft_work_stealing_queue &other) = delete;
+        ft_work_stealing_queue(ft_work_stealing_queue &&other) = delete;
+        ~ft_work_stealing_queue();
+
+        ft_work_stealing_queue &operator=(const ft_work_stealing_queue &other) = delete;
+        ft_work_stealing_queue &operator=(ft_work_stealing_queue &&other) = delete;
+
+        int32_t initialize(ft_size_t worker_count);
+        int32_t destroy();
+
+        void bind_worker(ft_size_t worker_index);
+        ft_bool is_worker_thread() const;
+        int32_t push(TaskType *task);
+        TaskType *try_pop(ft_size_t worker_index);
+        TaskType *wait_pop(ft_size_t worker_index);
+        void shutdown();
+        int64_t pending() const;
+};
+
+template <typename TaskType>
+thread_local const ft_work_stealing_queue<TaskType>
+    *ft_work_stealing_queue<TaskType>::_current_queue = ft_nullptr;
+
+template <typename TaskType>
+thread_local ft_size_t ft_work_stealing_queue<TaskType>::_current_worker = 0;
+
+template <typename TaskType>
+thread_local uint64_t ft_work_stealing_queue<TaskType>::_steal_seed = 0;
+
+template <typename TaskType>
+ft_work_stealing_deque<TaskType>::ft_work_stealing_deque()
+    : _top(0), _bottom(0), _ring(ft_nullptr),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+template <typename TaskType>
+ft_work_stealing_deque<TaskType>::~ft_work_stealing_deque()
+{
+    (void)this->destroy();
+    return ;
+}
+
+template <typename TaskType>
+typename ft_work_stealing_deque<TaskType>::ring *
+ft_work_stealing_deque<TaskType>::allocate_ring(int64_t capacity)
+{
+    ring *ring_pointer;
+    int64_t index;
+
+    ring_pointer = static_cast<ring *>(cma_malloc(sizeof(ring)));
+    if (ring_pointer == ft_nullptr)
+        return (ft_nullptr);
+    ring_pointer->slots = static_cast<std::atomic<TaskType *> *>(
+            cma_malloc(sizeof(std::atomic<TaskType *>) * static_cast<ft_size_t>(capacity)));
+    if (ring_pointer->slots == ft_nullptr)
+    {
+        cma_free(ring_pointer);
+        return (ft_nullptr);
+    }
+    index = 0;
+    while (index < capacity)
+    {
+        construct_at(&ring_pointer->slots[index], static_cast<TaskType *>(ft_nullptr));
+        index++;
+    }
+    ring_pointer->capacity = capacity;
+    ring_pointer->retired = ft_nullptr;
+    return (ring_pointer);
+}
+
+template <typename TaskType>
+void ft_work_stealing_deque<TaskType>::release_rings(ring *ring_pointer)
+{
+    ring *next_ring;
+
+    while (ring_pointer != ft_nullptr)
+    {
+        next_ring = ring_pointer->retired;
+        cma_free(ring_pointer->slots);
+        cma_free(ring_pointer);
+        ring_pointer = next_ring;
+    }
+    return ;
+}
+
+template <typename TaskType>
+int32_t ft_work_stealing_deque<TaskType>::initialize()
+{
+    ring *ring_pointer;
+
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "ft_work_stealing_deque::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    ring_pointer = allocate_ring(FT_WORK_STEALING_DEQUE_INITIAL_CAPACITY);
+    if (ring_pointer == ft_nullptr)
+    {
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (FT_ERR_NO_MEMORY);
+    }
+    this->_top.store(0, std::memory_order_relaxed);
+    this->_bottom.store(0, std::memory_order_relaxed);
+    this->_ring.store(ring_pointer, std::memory_order_relaxed);
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+int32_t ft_work_stealing_deque<TaskType>::destroy()
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+    {
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (FT_ERR_SUCCESS);
+    }
+    release_rings(this->_ring.load(std::memory_order_relaxed));
+    this->_ring.store(ft_nullptr, std::memory_order_relaxed);
+    this->_top.store(0, std::memory_order_relaxed);
+    this->_bottom.store(0, std::memory_order_relaxed);
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+typename ft_work_stealing_deque<TaskType>::ring *
+ft_work_stealing_deque<TaskType>::grow(ring *current, int64_t top, int64_t bottom)
+{
+    ring *next_ring;
+    int64_t index;
+
+    next_ring = allocate_ring(current->capacity * 2);
+    if (next_ring == ft_nullptr)
+        return (ft_nullptr);
+    index = top;
+    while (index < bottom)
+    {
+        next_ring->slots[index & (next_ring->capacity - 1)].store(
+            current->slots[index & (current->capacity - 1)].load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+        index++;
+    }
+    next_ring->retired = current;
+    this->_ring.store(next_ring, std::memory_order_release);
+    return (next_ring);
+}
+
+template <typename TaskType>
+int32_t ft_work_stealing_deque<TaskType>::push(TaskType *task)
+{
+    int64_t bottom;
+    int64_t top;
+    ring *ring_pointer;
+
+    bottom = this->_bottom.load(std::memory_order_relaxed);
+    top = this->_top.load(std::memory_order_acquire);
+    ring_pointer = this->_ring.load(std::memory_order_relaxed);
+    if (bottom - top > ring_pointer->capacity - 1)
+    {
+        ring_pointer = this->grow(ring_pointer, top, bottom);
+        if (ring_pointer == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+    }
+    ring_pointer->slots[bottom & (ring_pointer->capacity - 1)].store(task,
+        std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+TaskType *ft_work_stealing_deque<TaskType>::pop()
+{
+    int64_t bottom;
+    int64_t top;
+    ring *ring_pointer;
+    TaskType *task;
+
+    bottom = this->_bottom.load(std::memory_order_relaxed) - 1;
+    ring_pointer = this->_ring.load(std::memory_order_relaxed);
+    this->_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    top = this->_top.load(std::memory_order_relaxed);
+    if (top > bottom)
+    {
+        this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return (ft_nullptr);
+    }
+    task = ring_pointer->slots[bottom & (ring_pointer->capacity - 1)].load(
+            std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        if (!this->_top.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed))
+            task = ft_nullptr;
+        this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return (task);
+}
+
+template <typename TaskType>
+TaskType *ft_work_stealing_deque<TaskType>::steal()
+{
+    int64_t top;
+    int64_t bottom;
+    ring *ring_pointer;
+    TaskType *task;
+
+    top = this->_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bottom = this->_bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+        return (ft_nullptr);
+    ring_pointer = this->_ring.load(std::memory_order_acquire);
+    task = ring_pointer->slots[top & (ring_pointer->capacity - 1)].load(
+            std::memory_order_relaxed);
+    if (!this->_top.compare_exchange_strong(top, top + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed))
+        return (ft_nullptr);
+    return (task);
+}
+
+template <typename TaskType>
+int64_t ft_work_stealing_deque<TaskType>::size() const
+{
+    int64_t bottom;
+    int64_t top;
+
+    bottom = this->_bottom.load(std::memory_order_relaxed);
+    top = this->_top.load(std::memory_order_relaxed);
+    if (bottom <= top)
+        return (0);
+    return (bottom - top);
+}
+
+template <typename TaskType>
+ft_work_stealing_queue<TaskType>::ft_work_stealing_queue()
+    : _deques(ft_nullptr), _worker_count(0), _injection(ft_nullptr),
+      _injection_capacity(0), _injection_head(0), _injection_count(0), _injection_mutex(),
+      _park_mutex(), _park_condition(), _pending(0), _parked(0), _shutdown(false),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+template <typename TaskType>
+ft_work_stealing_queue<TaskType>::~ft_work_stealing_queue()
+{
+    (void)this->destroy();
+    return ;
+}
+
+template <typename TaskType>
+int32_t ft_work_stealing_queue<TaskType>::initialize(ft_size_t worker_count)
+{
+    ft_size_t index;
+    int32_t error_code;
+
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "ft_work_stealing_queue::initialize",
+            "called while object is already initialised");
+        return (FT_ERR_INVALID_STATE);
+    }
+    this->_pending.store(0);
+    this->_parked.store(0);
+    this->_shutdown.store(false);
+    this->_worker_count = 0;
+    this->_deques = ft_nullptr;
+    error_code = this->_injection_mutex.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (error_code);
+    }
+    error_code = this->_park_mutex.initialize();
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        (void)this->_injection_mutex.destroy();
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (error_code);
+    }
+    this->_injection_head = 0;
+    this->_injection_count = 0;
+    this->_injection_capacity = FT_WORK_STEALING_INJECTION_INITIAL_CAPACITY;
+    this->_injection = static_cast<TaskType **>(cma_malloc(sizeof(TaskType *)
+                * this->_injection_capacity));
+    if (this->_injection == ft_nullptr)
+        error_code = FT_ERR_NO_MEMORY;
+    if (error_code == FT_ERR_SUCCESS)
+        error_code = this->_park_condition.enable_thread_safety();
+    if (error_code == FT_ERR_SUCCESS && worker_count > 0)
+    {
+        this->_deques = new (std::nothrow) ft_work_stealing_deque<TaskType>[worker_count];
+        if (this->_deques == ft_nullptr)
+            error_code = FT_ERR_NO_MEMORY;
+    }
+    index = 0;
+    while (error_code == FT_ERR_SUCCESS && index < worker_count)
+    {
+        error_code = this->_deques[index].initialize();
+        index++;
+    }
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        delete[] this->_deques;
+        this->_deques = ft_nullptr;
+        (void)this->_park_condition.disable_thread_safety();
+        cma_free(this->_injection);
+        this->_injection = ft_nullptr;
+        this->_injection_capacity = 0;
+        (void)this->_park_mutex.destroy();
+        (void)this->_injection_mutex.destroy();
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (error_code);
+    }
+    this->_worker_count = worker_count;
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+void ft_work_stealing_queue<TaskType>::delete_remaining_tasks()
+{
+    TaskType *task;
+    ft_size_t index;
+
+    index = 0;
+    while (index < this->_worker_count)
+    {
+        task = this->_deques[index].pop();
+        while (task != ft_nullptr)
+        {
+            delete task;
+            task = this->_deques[index].pop();
+        }
+        index++;
+    }
+    while (this->_injection_count > 0)
+    {
+        task = this->_injection[this->_injection_head];
+        this->_injection_head = (this->_injection_head + 1) % this->_injection_capacity;
+        this->_injection_count--;
+        delete task;
+    }
+    this->_pending.store(0);
+    return ;
+}
+
+template <typename TaskType>
+int32_t ft_work_stealing_queue<TaskType>::destroy()
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+    {
+        this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+        return (FT_ERR_SUCCESS);
+    }
+    this->shutdown();
+    this->delete_remaining_tasks();
+    delete[] this->_deques;
+    this->_deques = ft_nullptr;
+    this->_worker_count = 0;
+    (void)this->_park_condition.disable_thread_safety();
+    cma_free(this->_injection);
+    this->_injection = ft_nullptr;
+    this->_injection_capacity = 0;
+    (void)this->_park_mutex.destroy();
+    (void)this->_injection_mutex.destroy();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+void ft_work_stealing_queue<TaskType>::bind_worker(ft_size_t worker_index)
+{
+    _current_queue = this;
+    _current_worker = worker_index;
+    _steal_seed = (worker_index + 1) * 0x9E3779B97F4A7C15ULL;
+    return ;
+}
+
+template <typename TaskType>
+ft_bool ft_work_stealing_queue<TaskType>::is_worker_thread() const
+{
+    if (_current_queue == this)
+        return (FT_TRUE);
+    return (FT_FALSE);
+}
+
+template <typename TaskType>
+void ft_work_stealing_queue<TaskType>::unpark_one()
+{
+    if (this->_parked.load() == 0)
+        return ;
+    if (this->_park_mutex.lock() != FT_ERR_SUCCESS)
+        return ;
+    (void)this->_park_condition.signal();
+    (void)this->_park_mutex.unlock();
+    return ;
+}
+
+template <typename TaskType>
+int32_t ft_work_stealing_queue<TaskType>::push(TaskType *task)
+{
+    int32_t error_code;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (FT_ERR_INVALID_STATE);
+    if (task == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    this->_pending.fetch_add(1);
+    if (_current_queue == this)
+        error_code = this->_deques[_current_worker].push(task);
+    else
+    {
+        error_code = this->push_injection(task);
+    }
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->_pending.fetch_sub(1);
+        return (error_code);
+    }
+    this->unpark_one();
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+int32_t ft_work_stealing_queue<TaskType>::push_injection(TaskType *task)
+{
+    TaskType **resized;
+    ft_size_t new_capacity;
+    ft_size_t index;
+    int32_t error_code;
+
+    error_code = this->_injection_mutex.lock();
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (this->_injection_count == this->_injection_capacity)
+    {
+        new_capacity = this->_injection_capacity * 2;
+        resized = static_cast<TaskType **>(cma_malloc(sizeof(TaskType *) * new_capacity));
+        if (resized == ft_nullptr)
+        {
+            (void)this->_injection_mutex.unlock();
+            return (FT_ERR_NO_MEMORY);
+        }
+        index = 0;
+        while (index < this->_injection_count)
+        {
+            resized[index] = this->_injection[(this->_injection_head + index)
+                % this->_injection_capacity];
+            index++;
+        }
+        cma_free(this->_injection);
+        this->_injection = resized;
+        this->_injection_capacity = new_capacity;
+        this->_injection_head = 0;
+    }
+    this->_injection[(this->_injection_head + this->_injection_count)
+        % this->_injection_capacity] = task;
+    this->_injection_count++;
+    (void)this->_injection_mutex.unlock();
+    return (FT_ERR_SUCCESS);
+}
+
+template <typename TaskType>
+TaskType *ft_work_stealing_queue<TaskType>::pop_injection()
+{
+    TaskType *task;
+
+    if (this->_injection_mutex.lock() != FT_ERR_SUCCESS)
+        return (ft_nullptr);
+    task = ft_nullptr;
+    if (this->_injection_count > 0)
+    {
+        task = this->_injection[this->_injection_head];
+        this->_injection_head = (this->_injection_head + 1) % this->_injection_capacity;
+        this->_injection_count--;
+    }
+    (void)this->_injection_mutex.unlock();
+    return (task);
+}
+
+template <typename TaskType>
+TaskType *ft_work_stealing_queue<TaskType>::steal_from_victims(ft_size_t worker_index)
+{
+    ft_size_t attempt;
+    ft_size_t victim;
+    TaskType *task;
+
+    if (this->_worker_count < 2)
+        return (ft_nullptr);
+    _steal_seed ^= _steal_seed << 13;
+    _steal_seed ^= _steal_seed >> 7;
+    _steal_seed ^= _steal_seed << 17;
+    victim = _steal_seed % this->_worker_count;
+    attempt = 0;
+    while (attempt < this->_worker_count)
+    {
+        if (victim != worker_index)
+        {
+            task = this->_deques[victim].steal();
+            if (task != ft_nullptr)
+                return (task);
+        }
+        victim++;
+        if (victim == this->_worker_count)
+            victim = 0;
+        attempt++;
+    }
+    return (ft_nullptr);
+}
+
+template <typename TaskType>
+TaskType *ft_work_stealing_queue<TaskType>::try_pop(ft_size_t worker_index)
+{
+    TaskType *task;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (ft_nullptr);
+    task = ft_nullptr;
+    if (worker_index < this->_worker_count)
+        task = this->_deques[worker_index].pop();
+    if (task == ft_nullptr)
+        task = this->pop_injection();
+    if (task == ft_nullptr)
+        task = this->steal_from_victims(worker_index);
+    if (task != ft_nullptr)
+        this->_pending.fetch_sub(1);
+    return (task);
+}
+
+template <typename TaskType>
+TaskType *ft_work_stealing_queue<TaskType>::wait_pop(ft_size_t worker_index)
+{
+    TaskType *task;
+    struct timespec park_timeout;
+
+    park_timeout.tv_sec = 0;
+    park_timeout.tv_nsec = FT_WORK_STEALING_PARK_TIMEOUT_NS;
+    while (true)
+    {
+        task = this->try_pop(worker_index);
+        if (task != ft_nullptr)
+            return (task);
+        if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+            return (ft_nullptr);
+        if (this->_pending.load() > 0)
+        {
+            pt_thread_yield();
+            continue ;
+        }
+        if (this->_shutdown.load())
+            return (ft_nullptr);
+        if (this->_park_mutex.lock() != FT_ERR_SUCCESS)
+            return (ft_nullptr);
+        this->_parked.fetch_add(1);
+        if (this->_pending.load() == 0 && !this->_shutdown.load())
+            (void)this->_park_condition.wait_for(this->_park_mutex, park_timeout);
+        this->_parked.fetch_sub(1);
+        (void)this->_park_mutex.unlock();
+    }
+    return (ft_nullptr);
+}
+
+template <typename TaskType>
+void ft_work_stealing_queue<TaskType>::shutdown()
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return ;
+    this->_shutdown.store(true);
+    if (this->_park_mutex.lock() != FT_ERR_SUCCESS)
+        return ;
+    (void)this->_park_condition.broadcast();
+    (void)this->_park_mutex.unlock();
+    return ;
+}
+
+template <typename TaskType>
+int64_t ft_work_stealing_queue<TaskType>::pending() const
+{
+    return (this->_pending.load());
+}
+
+#endif
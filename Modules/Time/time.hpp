@@ -101,6 +101,7 @@ void        time_sleep(uint32_t seconds);
 void        time_sleep_ms(uint32_t milliseconds);
 ft_size_t   time_strftime(char *buffer, ft_size_t size, const char *format, const t_time_info *time_info);
 ft_string   *time_format_iso8601(t_time time_value);
+ft_size_t   time_format_iso8601_buffer(char *buffer, ft_size_t size, t_time time_value);
 ft_string   *time_format_iso8601_with_offset(t_time time_value, int32_t offset_minutes);
 ft_size_t   time_format_timezone_offset(char *buffer, ft_size_t size, int32_t offset_minutes);
 ft_string   *time_format_rfc3339(t_time time_value);
@@ -151,35 +151,39 @@ static void time_format_unlock_gmtime_mutex(ft_bool lock_acquired)
     return ;
 }
 
-ft_string    *time_format_iso8601(t_time time_value)
+ft_size_t    time_format_iso8601_buffer(char *buffer, ft_size_t size, t_time time_value)
 {
     std::time_t standard_time;
     std::tm time_storage;
     std::tm *time_pointer;
-    char buffer[21];
-    ft_string *formatted;
     ft_bool lock_acquired;
     int32_t lock_error;
-    ft_size_t strftime_result;
 
+    if (!buffer || size == 0)
+        return (0);
     standard_time = time_value;
     lock_acquired = FT_FALSE;
     lock_error = time_format_lock_gmtime_mutex(&lock_acquired);
     if (lock_error != FT_ERR_SUCCESS)
-        return (time_format_failure(lock_error));
+        return (0);
     time_pointer = std::gmtime(&standard_time);
     if (!time_pointer)
     {
         time_format_unlock_gmtime_mutex(lock_acquired);
-        return (time_format_failure(FT_ERR_INVALID_ARGUMENT));
+        return (0);
     }
     time_storage = *time_pointer;
     time_format_unlock_gmtime_mutex(lock_acquired);
-    strftime_result = std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &time_storage);
-    if (strftime_result == 0)
-    {
+    return (std::strftime(buffer, size, "%Y-%m-%dT%H:%M:%SZ", &time_storage));
+}
+
+ft_string    *time_format_iso8601(t_time time_value)
+{
+    char buffer[21];
+    ft_string *formatted;
+
+    if (time_format_iso8601_buffer(buffer, sizeof(buffer), time_value) == 0)
         return (time_format_failure(FT_ERR_INVALID_ARGUMENT));
-    }
     formatted = new (std::nothrow) ft_string();
     if (formatted == ft_nullptr)
         return (time_format_failure(FT_ERR_NO_MEMORY));
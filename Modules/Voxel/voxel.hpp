@@ -44,6 +44,9 @@ class game_voxel_region;
 # define TERRAIN_STAGE_DECORATION 8U
 # define TERRAIN_STAGE_STRUCTURES 16U
 # define TERRAIN_STAGE_ORES 32U
+# define TERRAIN_STAGE_ALL (TERRAIN_STAGE_BASE_TERRAIN | TERRAIN_STAGE_CAVES \
+    | TERRAIN_STAGE_FLUIDS | TERRAIN_STAGE_DECORATION \
+    | TERRAIN_STAGE_STRUCTURES | TERRAIN_STAGE_ORES)
 
 enum terrain_biome
 {
@@ -545,6 +548,14 @@ int32_t terrain_generate_chunk_with_context(game_voxel_chunk &chunk,
     int32_t world_block_origin_x, int32_t world_block_origin_z,
     const char *seed_string,
     const terrain_generation_context &context) noexcept;
+int32_t terrain_generate_chunk_base_with_context(game_voxel_chunk &chunk,
+    int32_t world_block_origin_x, int32_t world_block_origin_z,
+    const char *seed_string,
+    const terrain_generation_context &context) noexcept;
+int32_t terrain_decorate_chunk_with_context(game_voxel_chunk &chunk,
+    int32_t world_block_origin_x, int32_t world_block_origin_z,
+    const char *seed_string, const terrain_generation_context &context,
+    terrain_cross_chunk_block_writer writer, void *writer_user_data) noexcept;
 int32_t terrain_generate_chunk_in_region(game_voxel_region &region,
     int32_t world_block_origin_x, int32_t world_block_origin_z,
     const char *seed_string, const terrain_generation_config &config) noexcept;
@@ -118,7 +118,7 @@ static void terrain_stage_prepare_columns(uint64_t seed_value,
 static ft_bool terrain_can_place_tree_with_writer(game_voxel_chunk &chunk,
     int32_t local_origin_x, int32_t local_origin_y, int32_t local_origin_z,
     const terrain_tree_template &tree_template,
-    const terrain_generation_config &config) noexcept
+    terrain_cross_chunk_block_writer writer) noexcept
 {
     uint32_t block_index;
     int32_t target_x;
@@ -138,8 +138,7 @@ static ft_bool terrain_can_place_tree_with_writer(game_voxel_chunk &chunk,
             || target_y < 0 || target_y >= GAME_VOXEL_CHUNK_HEIGHT
             || target_z < 0 || target_z >= GAME_VOXEL_CHUNK_DEPTH)
         {
-            if (config.allow_cross_chunk_features == FT_FALSE
-                || config.cross_chunk_block_writer == ft_nullptr)
+            if (writer == ft_nullptr)
                 return (FT_FALSE);
         }
         else
@@ -158,7 +157,7 @@ static int32_t terrain_place_tree_with_writer(game_voxel_chunk &chunk,
     int32_t local_origin_x, int32_t local_origin_y, int32_t local_origin_z,
     int32_t world_block_origin_x, int32_t world_block_origin_z,
     const terrain_tree_template &tree_template,
-    const terrain_generation_config &config) noexcept
+    terrain_cross_chunk_block_writer writer, void *writer_user_data) noexcept
 {
     uint32_t block_index;
     int32_t target_x;
@@ -178,11 +177,9 @@ static int32_t terrain_place_tree_with_writer(game_voxel_chunk &chunk,
             error_code = chunk.write_block(target_x, target_y, target_z,
                 tree_template.blocks[block_index].block_id);
         else
-            error_code = config.cross_chunk_block_writer(
-                world_block_origin_x + target_x, target_y,
+            error_code = writer(world_block_origin_x + target_x, target_y,
                 world_block_origin_z + target_z,
-                tree_template.blocks[block_index].block_id,
-                config.cross_chunk_block_writer_user_data);
+                tree_template.blocks[block_index].block_id, writer_user_data);
         if (error_code != FT_ERR_SUCCESS)
             return (error_code);
         block_index += 1U;
@@ -690,17 +687,56 @@ int32_t terrain_generate_chunk(game_voxel_chunk &chunk,
         world_block_origin_z, seed_string, config));
 }
 
-static int32_t terrain_generate_chunk_snapshot(game_voxel_chunk &chunk,
+static int32_t terrain_feature_margin(
+    terrain_cross_chunk_block_writer writer) noexcept
+{
+    if (writer != ft_nullptr)
+        return (0);
+    return (2);
+}
+
+static void terrain_stage_prepare_feature_columns(uint64_t seed_value,
     int32_t world_block_origin_x, int32_t world_block_origin_z,
-    const char *seed_string,
-    const terrain_generation_config &requested_config,
-    ft_bool configuration_validated, ft_bool signature_precomputed,
-    uint32_t precomputed_signature) noexcept
+    const terrain_generation_config &config, int32_t feature_margin,
+    terrain_column_cache *column_cache) noexcept
 {
-    terrain_generation_config config;
+    int32_t local_x;
+    int32_t local_z;
+    int32_t world_block_x;
+    int32_t world_block_z;
+    int32_t column_index;
+    uint32_t biome;
 
-    if (config.initialize(requested_config) != FT_ERR_SUCCESS)
-        return (FT_ERR_INVALID_ARGUMENT);
+    local_z = feature_margin;
+    while (local_z + feature_margin < GAME_VOXEL_CHUNK_DEPTH)
+    {
+        world_block_z = world_block_origin_z + local_z;
+        local_x = feature_margin;
+        while (local_x + feature_margin < GAME_VOXEL_CHUNK_WIDTH)
+        {
+            column_index = (local_z * GAME_VOXEL_CHUNK_WIDTH) + local_x;
+            world_block_x = world_block_origin_x + local_x;
+            biome = terrain_select_biome(config, seed_value, world_block_x,
+                world_block_z);
+            column_cache[column_index].biome = biome;
+            column_cache[column_index].biome_profile = config.biomes[biome].profile;
+            column_cache[column_index].can_place_trees
+                = config.biomes[biome].allow_trees;
+            column_cache[column_index].column_height
+                = terrain_smooth_heightfield(seed_value, world_block_x,
+                    world_block_z, config.biomes[biome].profile, config);
+            local_x += 4;
+        }
+        local_z += 4;
+    }
+    return ;
+}
+
+static int32_t terrain_stage_base(game_voxel_chunk &chunk,
+    uint64_t seed_value, int32_t world_block_origin_x,
+    int32_t world_block_origin_z, const terrain_generation_config &config,
+    terrain_column_cache *column_cache) noexcept
+{
     int32_t local_x;
     int32_t local_y;
     int32_t local_z;
@@ -714,46 +750,9 @@ static int32_t terrain_generate_chunk_snapshot(game_voxel_chunk &chunk,
     uint32_t surface_block_id;
     uint32_t subsurface_block_id;
     uint32_t deep_block_id;
-    uint64_t seed_value;
-    uint32_t configuration_signature;
     ft_bool place_shrub;
-    const terrain_tree_template *tree_template;
-    uint64_t tree_feature_seed;
-    uint32_t feature_index;
-    uint64_t feature_seed;
-    const terrain_feature_rule *feature_rule;
-    uint32_t tree_template_index;
-    game_voxel_generation_metadata generation_metadata;
-    terrain_column_cache column_cache[TERRAIN_COLUMN_CACHE_COUNT];
     int32_t column_index;
-    int32_t feature_margin;
 
-    if (configuration_validated == FT_FALSE
-        && terrain_generation_config_is_valid(config) == FT_FALSE)
-        return (FT_ERR_INVALID_ARGUMENT);
-
-    seed_value = terrain_seed_value(seed_string);
-    if (signature_precomputed == FT_TRUE)
-        configuration_signature = precomputed_signature;
-    else
-        configuration_signature = terrain_generation_config_signature(config);
-    if (chunk.generation_metadata_matches(seed_value, world_block_origin_x,
-            world_block_origin_z, configuration_signature) == FT_TRUE
-        && chunk.get_generation_metadata().generator_version
-            == TERRAIN_GENERATOR_VERSION
-        && chunk.get_generation_metadata().completed_stage_mask
-            == (TERRAIN_STAGE_BASE_TERRAIN | TERRAIN_STAGE_CAVES
-                | TERRAIN_STAGE_FLUIDS | TERRAIN_STAGE_DECORATION
-                | TERRAIN_STAGE_STRUCTURES | TERRAIN_STAGE_ORES))
-    {
-        chunk.clear_dirty();
-        return (FT_ERR_SUCCESS);
-    }
-    error_code = terrain_stage_clear_chunk(chunk);
-    if (error_code != FT_ERR_SUCCESS)
-        return (error_code);
-    terrain_stage_prepare_columns(seed_value, world_block_origin_x,
-        world_block_origin_z, config, column_cache);
     /* Stage: base terrain, caves, terrain-aware layers, and fluids. */
     local_z = 0;
     while (local_z < GAME_VOXEL_CHUNK_DEPTH)
@@ -875,11 +874,33 @@ static int32_t terrain_generate_chunk_snapshot(game_voxel_chunk &chunk,
         }
         local_z += 1;
     }
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t terrain_stage_decorate(game_voxel_chunk &chunk,
+    uint64_t seed_value, int32_t world_block_origin_x,
+    int32_t world_block_origin_z, const terrain_generation_config &config,
+    terrain_cross_chunk_block_writer writer, void *writer_user_data,
+    const terrain_column_cache *column_cache) noexcept
+{
+    int32_t local_x;
+    int32_t local_z;
+    int32_t error_code;
+    int32_t column_height;
+    int32_t world_block_x;
+    int32_t world_block_z;
+    uint32_t biome;
+    const terrain_tree_template *tree_template;
+    uint64_t tree_feature_seed;
+    uint32_t feature_index;
+    uint64_t feature_seed;
+    const terrain_feature_rule *feature_rule;
+    uint32_t tree_template_index;
+    int32_t column_index;
+    int32_t feature_margin;
+
     /* Stage: biome decorations and configured structures. */
-    feature_margin = 2;
-    if (config.allow_cross_chunk_features == FT_TRUE
-        && config.cross_chunk_block_writer != ft_nullptr)
-        feature_margin = 0;
+    feature_margin = terrain_feature_margin(writer);
     local_z = feature_margin;
     while (local_z + feature_margin < GAME_VOXEL_CHUNK_DEPTH)
     {
@@ -915,12 +936,12 @@ static int32_t terrain_generate_chunk_snapshot(game_voxel_chunk &chunk,
                     if (tree_template != ft_nullptr
                         && terrain_can_place_tree_with_writer(chunk, local_x,
                             column_height + 1, local_z, *tree_template,
-                            config) == FT_TRUE)
+                            writer) == FT_TRUE)
                     {
                         error_code = terrain_place_tree_with_writer(chunk,
                             local_x, column_height + 1, local_z,
                             world_block_origin_x, world_block_origin_z,
-                            *tree_template, config);
+                            *tree_template, writer, writer_user_data);
                         if (error_code != FT_ERR_SUCCESS)
                             return (error_code);
                     }
@@ -963,13 +984,14 @@ static int32_t terrain_generate_chunk_snapshot(game_voxel_chunk &chunk,
                             < feature_rule->chance_percent
                             && terrain_can_place_tree_with_writer(chunk,
                                 local_x, column_height + 1, local_z,
-                                *feature_rule->template_data, config)
+                                *feature_rule->template_data, writer)
                                 == FT_TRUE)
                         {
                             error_code = terrain_place_tree_with_writer(chunk,
                                 local_x, column_height + 1, local_z,
                                 world_block_origin_x, world_block_origin_z,
-                                *feature_rule->template_data, config);
+                                *feature_rule->template_data, writer,
+                                writer_user_data);
                             if (error_code != FT_ERR_SUCCESS)
                                 return (error_code);
                         }
@@ -986,21 +1008,83 @@ static int32_t terrain_generate_chunk_snapshot(game_voxel_chunk &chunk,
         world_block_origin_x, world_block_origin_z, config);
     if (error_code != FT_ERR_SUCCESS)
         return (error_code);
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t terrain_store_generation_metadata(game_voxel_chunk &chunk,
+    uint64_t seed_value, int32_t world_block_origin_x,
+    int32_t world_block_origin_z, uint32_t configuration_signature,
+    uint32_t completed_stage_mask) noexcept
+{
+    game_voxel_generation_metadata generation_metadata;
+
     chunk.clear_dirty();
     generation_metadata.seed_value = seed_value;
     generation_metadata.world_block_origin_x = world_block_origin_x;
     generation_metadata.world_block_origin_z = world_block_origin_z;
     generation_metadata.configuration_signature = configuration_signature;
-    generation_metadata.completed_stage_mask = TERRAIN_STAGE_BASE_TERRAIN
-        | TERRAIN_STAGE_CAVES | TERRAIN_STAGE_FLUIDS
-        | TERRAIN_STAGE_DECORATION | TERRAIN_STAGE_STRUCTURES
-        | TERRAIN_STAGE_ORES;
+    generation_metadata.completed_stage_mask = completed_stage_mask;
     generation_metadata.generator_version = TERRAIN_GENERATOR_VERSION;
     generation_metadata.valid = FT_TRUE;
-    error_code = chunk.set_generation_metadata(generation_metadata);
+    return (chunk.set_generation_metadata(generation_metadata));
+}
+
+static int32_t terrain_generate_chunk_snapshot(game_voxel_chunk &chunk,
+    int32_t world_block_origin_x, int32_t world_block_origin_z,
+    const char *seed_string,
+    const terrain_generation_config &requested_config,
+    ft_bool configuration_validated, ft_bool signature_precomputed,
+    uint32_t precomputed_signature) noexcept
+{
+    terrain_generation_config config;
+
+    if (config.initialize(requested_config) != FT_ERR_SUCCESS)
+        return (FT_ERR_INVALID_ARGUMENT);
+    int32_t error_code;
+    uint64_t seed_value;
+    uint32_t configuration_signature;
+    terrain_cross_chunk_block_writer writer;
+    terrain_column_cache column_cache[TERRAIN_COLUMN_CACHE_COUNT];
+
+    if (configuration_validated == FT_FALSE
+        && terrain_generation_config_is_valid(config) == FT_FALSE)
+        return (FT_ERR_INVALID_ARGUMENT);
+
+    seed_value = terrain_seed_value(seed_string);
+    if (signature_precomputed == FT_TRUE)
+        configuration_signature = precomputed_signature;
+    else
+        configuration_signature = terrain_generation_config_signature(config);
+    if (chunk.generation_metadata_matches(seed_value, world_block_origin_x,
+            world_block_origin_z, configuration_signature) == FT_TRUE
+        && chunk.get_generation_metadata().generator_version
+            == TERRAIN_GENERATOR_VERSION
+        && chunk.get_generation_metadata().completed_stage_mask
+            == TERRAIN_STAGE_ALL)
+    {
+        chunk.clear_dirty();
+        return (FT_ERR_SUCCESS);
+    }
+    error_code = terrain_stage_clear_chunk(chunk);
     if (error_code != FT_ERR_SUCCESS)
         return (error_code);
-    return (FT_ERR_SUCCESS);
+    terrain_stage_prepare_columns(seed_value, world_block_origin_x,
+        world_block_origin_z, config, column_cache);
+    error_code = terrain_stage_base(chunk, seed_value, world_block_origin_x,
+        world_block_origin_z, config, column_cache);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    writer = ft_nullptr;
+    if (config.allow_cross_chunk_features == FT_TRUE)
+        writer = config.cross_chunk_block_writer;
+    error_code = terrain_stage_decorate(chunk, seed_value,
+        world_block_origin_x, world_block_origin_z, config, writer,
+        config.cross_chunk_block_writer_user_data, column_cache);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (terrain_store_generation_metadata(chunk, seed_value,
+        world_block_origin_x, world_block_origin_z, configuration_signature,
+        TERRAIN_STAGE_ALL));
 }
 
 int32_t terrain_generate_chunk(game_voxel_chunk &chunk,
@@ -1022,6 +1106,57 @@ int32_t terrain_generate_chunk_with_context(game_voxel_chunk &chunk,
         context.configuration_signature()));
 }
 
+int32_t terrain_generate_chunk_base_with_context(game_voxel_chunk &chunk,
+    int32_t world_block_origin_x, int32_t world_block_origin_z,
+    const char *seed_string, const terrain_generation_context &context) noexcept
+{
+    terrain_column_cache column_cache[TERRAIN_COLUMN_CACHE_COUNT];
+    uint64_t seed_value;
+    int32_t error_code;
+
+    if (context.is_initialised() == FT_FALSE)
+        return (FT_ERR_INVALID_OPERATION);
+    seed_value = terrain_seed_value(seed_string);
+    error_code = terrain_stage_clear_chunk(chunk);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    terrain_stage_prepare_columns(seed_value, world_block_origin_x,
+        world_block_origin_z, context.config(), column_cache);
+    error_code = terrain_stage_base(chunk, seed_value, world_block_origin_x,
+        world_block_origin_z, context.config(), column_cache);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (terrain_store_generation_metadata(chunk, seed_value,
+        world_block_origin_x, world_block_origin_z,
+        context.configuration_signature(), TERRAIN_STAGE_BASE_TERRAIN
+            | TERRAIN_STAGE_CAVES | TERRAIN_STAGE_FLUIDS));
+}
+
+int32_t terrain_decorate_chunk_with_context(game_voxel_chunk &chunk,
+    int32_t world_block_origin_x, int32_t world_block_origin_z,
+    const char *seed_string, const terrain_generation_context &context,
+    terrain_cross_chunk_block_writer writer, void *writer_user_data) noexcept
+{
+    terrain_column_cache column_cache[TERRAIN_COLUMN_CACHE_COUNT];
+    uint64_t seed_value;
+    int32_t error_code;
+
+    if (context.is_initialised() == FT_FALSE)
+        return (FT_ERR_INVALID_OPERATION);
+    seed_value = terrain_seed_value(seed_string);
+    terrain_stage_prepare_feature_columns(seed_value, world_block_origin_x,
+        world_block_origin_z, context.config(),
+        terrain_feature_margin(writer), column_cache);
+    error_code = terrain_stage_decorate(chunk, seed_value,
+        world_block_origin_x, world_block_origin_z, context.config(), writer,
+        writer_user_data, column_cache);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (terrain_store_generation_metadata(chunk, seed_value,
+        world_block_origin_x, world_block_origin_z,
+        context.configuration_signature(), TERRAIN_STAGE_ALL));
+}
+
 int32_t terrain_generate_chunk_in_region(game_voxel_region &region,
     int32_t world_block_origin_x, int32_t world_block_origin_z,
     const char *seed_string, const terrain_generation_config &config) noexcept
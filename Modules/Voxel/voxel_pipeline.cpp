@@ -0,0 +1,1119 @@
+#ifdef GAME_USE_VOXEL_REGION_BACKEND
+
+#include "voxel_pipeline.hpp"
+#include "../CMA/CMA.hpp"
+#include "../Basic/basic.hpp"
+#include "../Basic/class_nullptr.hpp"
+#include "../Errno/errno_internal.hpp"
+#include "../PThread/pthread_internal.hpp"
+#include "../PThread/pthread.hpp"
+#include "../Time/time.hpp"
+#include <new>
+
+#define CHUNK_PIPELINE_GENERATED_MARGIN 3
+#define CHUNK_PIPELINE_DECORATED_MARGIN 2
+
+thread_local int32_t chunk_pipeline::_last_error = FT_ERR_SUCCESS;
+
+static int32_t chunk_pipeline_floor_div(int32_t value, int32_t size) noexcept
+{
+    if (value >= 0)
+        return (value / size);
+    return (-((-value + size - 1) / size));
+}
+
+static int32_t chunk_pipeline_modulo(int32_t value, int32_t size) noexcept
+{
+    int32_t remainder;
+
+    remainder = value % size;
+    if (remainder < 0)
+        remainder += size;
+    return (remainder);
+}
+
+static int32_t chunk_pipeline_absolute(int32_t value) noexcept
+{
+    if (value < 0)
+        return (-value);
+    return (value);
+}
+
+static uint32_t chunk_pipeline_claim_bit(int32_t offset_x, int32_t offset_z) noexcept
+{
+    return (1U << static_cast<uint32_t>((offset_z + 1) * 3 + offset_x + 1));
+}
+
+// Generation reads the journals of every neighbour it finds, decoration
+// writes into the whole 3x3 block, and meshing only samples face neighbours.
+static ft_bool chunk_pipeline_footprint_has(uint8_t stage, int32_t offset_x,
+    int32_t offset_z) noexcept
+{
+    if (stage == CHUNK_PIPELINE_STAGE_MESHED && offset_x != 0 && offset_z != 0)
+        return (FT_FALSE);
+    return (FT_TRUE);
+}
+
+static ft_bool chunk_pipeline_footprint_writes(uint8_t stage, int32_t offset_x,
+    int32_t offset_z) noexcept
+{
+    if (offset_x == 0 && offset_z == 0)
+        return (FT_TRUE);
+    return (stage == CHUNK_PIPELINE_STAGE_DECORATED);
+}
+
+chunk_pipeline::chunk_pipeline() noexcept
+    : _slots(ft_nullptr), _deferred(ft_nullptr), _slot_count(0), _window(0),
+      _view_radius(0), _center_x(0), _center_z(0), _has_center(FT_FALSE),
+      _context(ft_nullptr), _seed_string(ft_nullptr), _pool(ft_nullptr),
+      _lane_limit(0), _active_lanes(0), _running_tasks(0), _stopping(FT_FALSE),
+      _ready(), _metrics(), _mutex(ft_nullptr),
+      _initialised_state(FT_CLASS_STATE_UNINITIALISED)
+{
+    return ;
+}
+
+chunk_pipeline::~chunk_pipeline() noexcept
+{
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return ;
+    (void)this->destroy();
+    return ;
+}
+
+int32_t chunk_pipeline::set_error(int32_t error_code) noexcept
+{
+    chunk_pipeline::_last_error = error_code;
+    return (error_code);
+}
+
+void chunk_pipeline::release() noexcept
+{
+    ft_size_t slot_index;
+
+    slot_index = 0;
+    while (slot_index < this->_slot_count)
+    {
+        (void)this->_slots[slot_index].chunk.destroy();
+        (void)chunk_mesh_destroy(this->_slots[slot_index].mesh);
+        cma_free(this->_slots[slot_index].journal);
+        slot_index++;
+    }
+    delete[] this->_slots;
+    cma_free(this->_deferred);
+    cma_free(this->_seed_string);
+    (void)this->_ready.destroy();
+    if (this->_mutex != ft_nullptr)
+    {
+        (void)this->_mutex->destroy();
+        delete this->_mutex;
+    }
+    this->_slots = ft_nullptr;
+    this->_deferred = ft_nullptr;
+    this->_slot_count = 0;
+    this->_seed_string = ft_nullptr;
+    this->_mutex = ft_nullptr;
+    this->_context = ft_nullptr;
+    this->_pool = ft_nullptr;
+    this->_has_center = FT_FALSE;
+    this->_active_lanes = 0;
+    this->_running_tasks = 0;
+    this->_stopping = FT_FALSE;
+    return ;
+}
+
+int32_t chunk_pipeline::initialize(const terrain_generation_context &context,
+    const char *seed_string, ft_thread_pool *pool, uint32_t view_radius,
+    uint32_t lane_count) noexcept
+{
+    pipeline_slot *slot;
+    ft_size_t slot_count;
+    int32_t seed_length;
+    int32_t error_code;
+
+    if (this->_initialised_state == FT_CLASS_STATE_INITIALISED)
+    {
+        errno_abort_lifecycle(this->_initialised_state, "chunk_pipeline::initialize",
+            "called while object is already initialised");
+        return (this->set_error(FT_ERR_INVALID_STATE));
+    }
+    // An empty seed makes the generator draw a fresh random seed per call,
+    // which would give every chunk its own world.
+    if (context.is_initialised() == FT_FALSE || seed_string == ft_nullptr
+        || seed_string[0] == '\0')
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    if (view_radius > CHUNK_PIPELINE_MAX_VIEW_RADIUS)
+        return (this->set_error(FT_ERR_OUT_OF_RANGE));
+    this->_view_radius = static_cast<int32_t>(view_radius);
+    this->_window = 2 * (this->_view_radius + CHUNK_PIPELINE_GENERATED_MARGIN) + 1;
+    slot_count = static_cast<ft_size_t>(this->_window)
+        * static_cast<ft_size_t>(this->_window);
+    seed_length = 0;
+    this->_mutex = new (std::nothrow) pt_mutex();
+    error_code = FT_ERR_NO_MEMORY;
+    if (this->_mutex != ft_nullptr)
+        error_code = this->_mutex->initialize();
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        this->_slots = new (std::nothrow) pipeline_slot[slot_count];
+        this->_deferred = static_cast<pipeline_deferred *>(cma_malloc(
+                    sizeof(pipeline_deferred) * slot_count));
+        seed_length = ft_strlen(seed_string);
+        this->_seed_string = static_cast<char *>(cma_malloc(
+                    static_cast<ft_size_t>(seed_length) + 1));
+        if (this->_slots == ft_nullptr || this->_deferred == ft_nullptr
+            || this->_seed_string == ft_nullptr)
+            error_code = FT_ERR_NO_MEMORY;
+    }
+    else if (this->_mutex != ft_nullptr)
+    {
+        delete this->_mutex;
+        this->_mutex = ft_nullptr;
+    }
+    if (error_code == FT_ERR_SUCCESS)
+    {
+        ft_memcpy(this->_seed_string, seed_string,
+            static_cast<ft_size_t>(seed_length) + 1);
+        error_code = this->_ready.initialize();
+        if (error_code == FT_ERR_SUCCESS)
+            error_code = this->_ready.reserve(slot_count);
+    }
+    while (error_code == FT_ERR_SUCCESS && this->_slot_count < slot_count)
+    {
+        slot = &this->_slots[this->_slot_count];
+        error_code = slot->chunk.initialize();
+        if (error_code != FT_ERR_SUCCESS)
+            break ;
+        error_code = chunk_mesh_initialize(slot->mesh);
+        if (error_code != FT_ERR_SUCCESS)
+        {
+            (void)slot->chunk.destroy();
+            break ;
+        }
+        slot->journal = ft_nullptr;
+        slot->journal_count = 0;
+        slot->journal_capacity = 0;
+        slot->chunk_x = 0;
+        slot->chunk_z = 0;
+        slot->stage = CHUNK_PIPELINE_STAGE_NONE;
+        slot->target = CHUNK_PIPELINE_STAGE_NONE;
+        slot->writers = 0;
+        slot->readers = 0;
+        slot->occupied = FT_FALSE;
+        slot->evicting = FT_FALSE;
+        slot->failed = FT_FALSE;
+        this->_slot_count++;
+    }
+    if (error_code != FT_ERR_SUCCESS)
+    {
+        this->release();
+        return (this->set_error(error_code));
+    }
+    if (lane_count == 0)
+        lane_count = 1;
+    this->_context = &context;
+    this->_pool = pool;
+    this->_lane_limit = lane_count;
+    this->reset_metrics();
+    this->_initialised_state = FT_CLASS_STATE_INITIALISED;
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+int32_t chunk_pipeline::destroy() noexcept
+{
+    ft_bool busy;
+
+    if (this->_initialised_state != FT_CLASS_STATE_INITIALISED)
+        return (this->set_error(FT_ERR_SUCCESS));
+    (void)pt_mutex_lock_if_not_null(this->_mutex);
+    this->_stopping = FT_TRUE;
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    busy = FT_TRUE;
+    while (busy == FT_TRUE)
+    {
+        (void)pt_mutex_lock_if_not_null(this->_mutex);
+        busy = (this->_active_lanes != 0 || this->_running_tasks != 0);
+        (void)pt_mutex_unlock_if_not_null(this->_mutex);
+        if (busy == FT_TRUE)
+            pt_thread_yield();
+    }
+    this->release();
+    this->_initialised_state = FT_CLASS_STATE_DESTROYED;
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+ft_size_t chunk_pipeline::slot_index_of(int32_t chunk_x, int32_t chunk_z) const noexcept
+{
+    return (static_cast<ft_size_t>(chunk_pipeline_modulo(chunk_z, this->_window))
+        * static_cast<ft_size_t>(this->_window)
+        + static_cast<ft_size_t>(chunk_pipeline_modulo(chunk_x, this->_window)));
+}
+
+chunk_pipeline::pipeline_slot *chunk_pipeline::find_slot(int32_t chunk_x,
+    int32_t chunk_z, ft_bool include_evicting) const noexcept
+{
+    pipeline_slot *slot;
+
+    slot = &this->_slots[this->slot_index_of(chunk_x, chunk_z)];
+    if (slot->occupied == FT_FALSE || slot->chunk_x != chunk_x
+        || slot->chunk_z != chunk_z)
+        return (ft_nullptr);
+    if (slot->evicting == FT_TRUE && include_evicting == FT_FALSE)
+        return (ft_nullptr);
+    return (slot);
+}
+
+void chunk_pipeline::wanted_chunk(ft_size_t slot_index, int32_t *chunk_x,
+    int32_t *chunk_z) const noexcept
+{
+    int32_t base_x;
+    int32_t base_z;
+    int32_t window_x;
+    int32_t window_z;
+
+    base_x = this->_center_x - this->_view_radius - CHUNK_PIPELINE_GENERATED_MARGIN;
+    base_z = this->_center_z - this->_view_radius - CHUNK_PIPELINE_GENERATED_MARGIN;
+    window_x = static_cast<int32_t>(slot_index % static_cast<ft_size_t>(this->_window));
+    window_z = static_cast<int32_t>(slot_index / static_cast<ft_size_t>(this->_window));
+    *chunk_x = base_x + chunk_pipeline_modulo(window_x - base_x, this->_window);
+    *chunk_z = base_z + chunk_pipeline_modulo(window_z - base_z, this->_window);
+    return ;
+}
+
+uint8_t chunk_pipeline::target_of(int32_t chunk_x, int32_t chunk_z) const noexcept
+{
+    int32_t distance;
+    int32_t distance_z;
+
+    distance = chunk_pipeline_absolute(chunk_x - this->_center_x);
+    distance_z = chunk_pipeline_absolute(chunk_z - this->_center_z);
+    if (distance_z > distance)
+        distance = distance_z;
+    if (distance <= this->_view_radius)
+        return (CHUNK_PIPELINE_STAGE_MESHED);
+    if (distance <= this->_view_radius + CHUNK_PIPELINE_DECORATED_MARGIN)
+        return (CHUNK_PIPELINE_STAGE_DECORATED);
+    if (distance <= this->_view_radius + CHUNK_PIPELINE_GENERATED_MARGIN)
+        return (CHUNK_PIPELINE_STAGE_GENERATED);
+    return (CHUNK_PIPELINE_STAGE_NONE);
+}
+
+uint8_t chunk_pipeline::next_stage(const pipeline_slot &slot) const noexcept
+{
+    if (slot.failed == FT_TRUE || slot.stage >= slot.target)
+        return (CHUNK_PIPELINE_STAGE_NONE);
+    return (static_cast<uint8_t>(slot.stage + 1));
+}
+
+// Decoration may write into any neighbour, so it waits for all of them to
+// exist; a mesh samples its face neighbours, whose blocks are only final
+// once every chunk within two rings has been decorated.
+ft_bool chunk_pipeline::is_ready(const pipeline_slot &slot, uint8_t stage) const noexcept
+{
+    const pipeline_slot *neighbour;
+    uint8_t required_stage;
+    int32_t radius;
+    int32_t offset_x;
+    int32_t offset_z;
+
+    if (stage == CHUNK_PIPELINE_STAGE_GENERATED)
+        return (FT_TRUE);
+    radius = 1;
+    required_stage = CHUNK_PIPELINE_STAGE_GENERATED;
+    if (stage == CHUNK_PIPELINE_STAGE_MESHED)
+    {
+        radius = 2;
+        required_stage = CHUNK_PIPELINE_STAGE_DECORATED;
+    }
+    offset_z = -radius;
+    while (offset_z <= radius)
+    {
+        offset_x = -radius;
+        while (offset_x <= radius)
+        {
+            if (offset_x != 0 || offset_z != 0)
+            {
+                neighbour = this->find_slot(slot.chunk_x + offset_x,
+                        slot.chunk_z + offset_z, FT_FALSE);
+                if (neighbour == ft_nullptr || neighbour->stage < required_stage)
+                    return (FT_FALSE);
+            }
+            offset_x++;
+        }
+        offset_z++;
+    }
+    return (FT_TRUE);
+}
+
+ft_bool chunk_pipeline::footprint_free(const pipeline_slot &slot,
+    uint8_t stage) const noexcept
+{
+    const pipeline_slot *target;
+    int32_t offset_x;
+    int32_t offset_z;
+
+    offset_z = -1;
+    while (offset_z <= 1)
+    {
+        offset_x = -1;
+        while (offset_x <= 1)
+        {
+            target = this->find_slot(slot.chunk_x + offset_x,
+                    slot.chunk_z + offset_z, FT_TRUE);
+            if (target != ft_nullptr
+                && chunk_pipeline_footprint_has(stage, offset_x, offset_z) == FT_TRUE)
+            {
+                if (target->writers != 0)
+                    return (FT_FALSE);
+                if (target->readers != 0 && chunk_pipeline_footprint_writes(stage,
+                        offset_x, offset_z) == FT_TRUE)
+                    return (FT_FALSE);
+            }
+            offset_x++;
+        }
+        offset_z++;
+    }
+    return (FT_TRUE);
+}
+
+uint32_t chunk_pipeline::claim_footprint(ft_size_t slot_index, uint8_t stage) noexcept
+{
+    pipeline_slot *target;
+    uint32_t claim_mask;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t offset_x;
+    int32_t offset_z;
+
+    chunk_x = this->_slots[slot_index].chunk_x;
+    chunk_z = this->_slots[slot_index].chunk_z;
+    claim_mask = 0;
+    offset_z = -1;
+    while (offset_z <= 1)
+    {
+        offset_x = -1;
+        while (offset_x <= 1)
+        {
+            target = this->find_slot(chunk_x + offset_x, chunk_z + offset_z, FT_TRUE);
+            if (target != ft_nullptr
+                && chunk_pipeline_footprint_has(stage, offset_x, offset_z) == FT_TRUE)
+            {
+                if (chunk_pipeline_footprint_writes(stage, offset_x, offset_z) == FT_TRUE)
+                    target->writers = static_cast<uint8_t>(target->writers + 1);
+                else
+                    target->readers = static_cast<uint16_t>(target->readers + 1);
+                claim_mask |= chunk_pipeline_claim_bit(offset_x, offset_z);
+            }
+            offset_x++;
+        }
+        offset_z++;
+    }
+    return (claim_mask);
+}
+
+void chunk_pipeline::release_footprint(const pipeline_task &task) noexcept
+{
+    pipeline_slot *target;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t offset_x;
+    int32_t offset_z;
+
+    chunk_x = this->_slots[task.slot_index].chunk_x;
+    chunk_z = this->_slots[task.slot_index].chunk_z;
+    offset_z = -1;
+    while (offset_z <= 1)
+    {
+        offset_x = -1;
+        while (offset_x <= 1)
+        {
+            if ((task.claim_mask & chunk_pipeline_claim_bit(offset_x, offset_z)) != 0)
+            {
+                target = &this->_slots[this->slot_index_of(chunk_x + offset_x,
+                        chunk_z + offset_z)];
+                if (chunk_pipeline_footprint_writes(task.stage, offset_x,
+                        offset_z) == FT_TRUE)
+                    target->writers = static_cast<uint8_t>(target->writers - 1);
+                else
+                    target->readers = static_cast<uint16_t>(target->readers - 1);
+            }
+            offset_x++;
+        }
+        offset_z++;
+    }
+    return ;
+}
+
+int32_t chunk_pipeline::append_journal(pipeline_slot &slot, int32_t world_x,
+    int32_t world_y, int32_t world_z, uint32_t block_id) noexcept
+{
+    chunk_pipeline_block_write *resized_journal;
+    uint32_t new_capacity;
+
+    if (slot.journal_count == slot.journal_capacity)
+    {
+        new_capacity = slot.journal_capacity * 2;
+        if (new_capacity == 0)
+            new_capacity = 64;
+        resized_journal = static_cast<chunk_pipeline_block_write *>(cma_realloc(
+                    slot.journal, sizeof(chunk_pipeline_block_write) * new_capacity));
+        if (resized_journal == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        slot.journal = resized_journal;
+        slot.journal_capacity = new_capacity;
+    }
+    slot.journal[slot.journal_count].world_x = world_x;
+    slot.journal[slot.journal_count].world_y = world_y;
+    slot.journal[slot.journal_count].world_z = world_z;
+    slot.journal[slot.journal_count].block_id = block_id;
+    slot.journal_count++;
+    return (FT_ERR_SUCCESS);
+}
+
+// A chunk that re-enters range after its neighbours were decorated would
+// otherwise lose the trees they grew into it, so their journals are replayed.
+int32_t chunk_pipeline::replay_journals(const pipeline_task &task) noexcept
+{
+    pipeline_slot *slot;
+    const pipeline_slot *neighbour;
+    const chunk_pipeline_block_write *entry;
+    uint32_t entry_index;
+    int32_t offset_x;
+    int32_t offset_z;
+    int32_t error_code;
+
+    slot = &this->_slots[task.slot_index];
+    offset_z = -1;
+    while (offset_z <= 1)
+    {
+        offset_x = -1;
+        while (offset_x <= 1)
+        {
+            if ((offset_x != 0 || offset_z != 0)
+                && (task.claim_mask & chunk_pipeline_claim_bit(offset_x, offset_z)) != 0)
+            {
+                neighbour = &this->_slots[this->slot_index_of(slot->chunk_x + offset_x,
+                        slot->chunk_z + offset_z)];
+                entry_index = 0;
+                while (entry_index < neighbour->journal_count)
+                {
+                    entry = &neighbour->journal[entry_index];
+                    if (chunk_pipeline_floor_div(entry->world_x,
+                            GAME_VOXEL_CHUNK_WIDTH) == slot->chunk_x
+                        && chunk_pipeline_floor_div(entry->world_z,
+                            GAME_VOXEL_CHUNK_DEPTH) == slot->chunk_z)
+                    {
+                        error_code = slot->chunk.write_block(entry->world_x
+                                - slot->chunk_x * GAME_VOXEL_CHUNK_WIDTH, entry->world_y,
+                                entry->world_z - slot->chunk_z * GAME_VOXEL_CHUNK_DEPTH,
+                                entry->block_id);
+                        if (error_code != FT_ERR_SUCCESS)
+                            return (error_code);
+                    }
+                    entry_index++;
+                }
+            }
+            offset_x++;
+        }
+        offset_z++;
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+int32_t chunk_pipeline::write_cross_chunk_block(int32_t world_block_x,
+    int32_t world_block_y, int32_t world_block_z, uint32_t block_id,
+    void *user_data) noexcept
+{
+    pipeline_task_context *context;
+    pipeline_slot *source;
+    pipeline_slot *target;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t error_code;
+
+    context = static_cast<pipeline_task_context *>(user_data);
+    if (context == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    source = &context->pipeline->_slots[context->slot_index];
+    chunk_x = chunk_pipeline_floor_div(world_block_x, GAME_VOXEL_CHUNK_WIDTH);
+    chunk_z = chunk_pipeline_floor_div(world_block_z, GAME_VOXEL_CHUNK_DEPTH);
+    if (chunk_pipeline_absolute(chunk_x - source->chunk_x) > 1
+        || chunk_pipeline_absolute(chunk_z - source->chunk_z) > 1)
+        return (FT_ERR_OUT_OF_RANGE);
+    target = context->pipeline->find_slot(chunk_x, chunk_z, FT_TRUE);
+    if (target == ft_nullptr)
+        return (FT_ERR_NOT_FOUND);
+    error_code = target->chunk.write_block(
+            world_block_x - chunk_x * GAME_VOXEL_CHUNK_WIDTH, world_block_y,
+            world_block_z - chunk_z * GAME_VOXEL_CHUNK_DEPTH, block_id);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    return (context->pipeline->append_journal(*source, world_block_x,
+            world_block_y, world_block_z, block_id));
+}
+
+int32_t chunk_pipeline::lookup_mesh_block(void *user_data, int32_t world_x,
+    int32_t world_y, int32_t world_z, uint32_t *block_id)
+{
+    pipeline_task_context *context;
+    const pipeline_slot *target;
+    int32_t chunk_x;
+    int32_t chunk_z;
+
+    context = static_cast<pipeline_task_context *>(user_data);
+    chunk_x = chunk_pipeline_floor_div(world_x, GAME_VOXEL_CHUNK_WIDTH);
+    chunk_z = chunk_pipeline_floor_div(world_z, GAME_VOXEL_CHUNK_DEPTH);
+    target = context->pipeline->find_slot(chunk_x, chunk_z, FT_TRUE);
+    if (target == ft_nullptr)
+    {
+        *block_id = GAME_VOXEL_AIR_BLOCK;
+        return (FT_ERR_SUCCESS);
+    }
+    return (target->chunk.read_block(world_x - chunk_x * GAME_VOXEL_CHUNK_WIDTH,
+            world_y, world_z - chunk_z * GAME_VOXEL_CHUNK_DEPTH, block_id));
+}
+
+void chunk_pipeline::evaluate(ft_size_t slot_index) noexcept
+{
+    const pipeline_slot *slot;
+    uint64_t distance_x;
+    uint64_t distance_z;
+    uint8_t stage;
+
+    slot = &this->_slots[slot_index];
+    if (this->_has_center == FT_FALSE || slot->occupied == FT_FALSE
+        || slot->evicting == FT_TRUE)
+        return ;
+    stage = this->next_stage(*slot);
+    if (stage == CHUNK_PIPELINE_STAGE_NONE || this->is_ready(*slot, stage) == FT_FALSE)
+        return ;
+    distance_x = static_cast<uint64_t>(chunk_pipeline_absolute(
+                slot->chunk_x - this->_center_x));
+    distance_z = static_cast<uint64_t>(chunk_pipeline_absolute(
+                slot->chunk_z - this->_center_z));
+    // Nearest chunks first; at equal distance, later stages win so visible
+    // meshes finish before the outer rings are filled in.
+    (void)this->_ready.push_or_decrease(slot_index,
+        (distance_x * distance_x + distance_z * distance_z) * 4U
+            + (CHUNK_PIPELINE_STAGE_MESHED - stage));
+    return ;
+}
+
+void chunk_pipeline::install(ft_size_t slot_index) noexcept
+{
+    pipeline_slot *slot;
+
+    slot = &this->_slots[slot_index];
+    this->wanted_chunk(slot_index, &slot->chunk_x, &slot->chunk_z);
+    (void)chunk_mesh_clear(slot->mesh);
+    slot->journal_count = 0;
+    slot->stage = CHUNK_PIPELINE_STAGE_NONE;
+    slot->target = this->target_of(slot->chunk_x, slot->chunk_z);
+    slot->occupied = FT_TRUE;
+    slot->evicting = FT_FALSE;
+    slot->failed = FT_FALSE;
+    return ;
+}
+
+void chunk_pipeline::settle(ft_size_t slot_index) noexcept
+{
+    const pipeline_slot *slot;
+
+    slot = &this->_slots[slot_index];
+    if (slot->evicting == FT_TRUE && slot->writers == 0 && slot->readers == 0)
+        this->install(slot_index);
+    this->evaluate(slot_index);
+    return ;
+}
+
+// Decoration writes into its 3x3 block, so any mesh built from one of
+// those chunks or their faces is out of date and has to be rebuilt.
+void chunk_pipeline::demote_meshes_around(const pipeline_slot &slot) noexcept
+{
+    pipeline_slot *neighbour;
+    int32_t offset_x;
+    int32_t offset_z;
+
+    offset_z = -2;
+    while (offset_z <= 2)
+    {
+        offset_x = -2;
+        while (offset_x <= 2)
+        {
+            if (chunk_pipeline_absolute(offset_x) + chunk_pipeline_absolute(offset_z) < 4)
+            {
+                neighbour = this->find_slot(slot.chunk_x + offset_x,
+                        slot.chunk_z + offset_z, FT_TRUE);
+                if (neighbour != ft_nullptr
+                    && neighbour->stage == CHUNK_PIPELINE_STAGE_MESHED)
+                    neighbour->stage = CHUNK_PIPELINE_STAGE_DECORATED;
+            }
+            offset_x++;
+        }
+        offset_z++;
+    }
+    return ;
+}
+
+ft_bool chunk_pipeline::pick_task(pipeline_task *task) noexcept
+{
+    const pipeline_slot *slot;
+    ft_size_t deferred_count;
+    ft_size_t slot_index;
+    uint64_t key;
+    uint8_t stage;
+    ft_bool found;
+
+    if (this->_stopping == FT_TRUE)
+        return (FT_FALSE);
+    deferred_count = 0;
+    found = FT_FALSE;
+    while (found == FT_FALSE && this->_ready.pop(&slot_index, &key) == FT_ERR_SUCCESS)
+    {
+        slot = &this->_slots[slot_index];
+        if (slot->occupied == FT_FALSE || slot->evicting == FT_TRUE)
+            continue ;
+        stage = this->next_stage(*slot);
+        if (stage == CHUNK_PIPELINE_STAGE_NONE || this->is_ready(*slot, stage) == FT_FALSE)
+            continue ;
+        if (this->footprint_free(*slot, stage) == FT_FALSE)
+        {
+            this->_deferred[deferred_count].slot_index = slot_index;
+            this->_deferred[deferred_count].key = key;
+            deferred_count++;
+            continue ;
+        }
+        task->slot_index = slot_index;
+        task->stage = stage;
+        task->claim_mask = this->claim_footprint(slot_index, stage);
+        found = FT_TRUE;
+    }
+    while (deferred_count > 0)
+    {
+        deferred_count--;
+        (void)this->_ready.push_or_decrease(this->_deferred[deferred_count].slot_index,
+            this->_deferred[deferred_count].key);
+    }
+    return (found);
+}
+
+int32_t chunk_pipeline::execute(const pipeline_task &task) noexcept
+{
+    pipeline_slot *slot;
+    pipeline_task_context context;
+    int32_t origin_x;
+    int32_t origin_z;
+    int32_t error_code;
+
+    slot = &this->_slots[task.slot_index];
+    context.pipeline = this;
+    context.slot_index = task.slot_index;
+    origin_x = slot->chunk_x * GAME_VOXEL_CHUNK_WIDTH;
+    origin_z = slot->chunk_z * GAME_VOXEL_CHUNK_DEPTH;
+    if (task.stage == CHUNK_PIPELINE_STAGE_GENERATED)
+    {
+        error_code = terrain_generate_chunk_base_with_context(slot->chunk, origin_x,
+                origin_z, this->_seed_string, *this->_context);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        return (this->replay_journals(task));
+    }
+    if (task.stage == CHUNK_PIPELINE_STAGE_DECORATED)
+    {
+        slot->journal_count = 0;
+        return (terrain_decorate_chunk_with_context(slot->chunk, origin_x, origin_z,
+                this->_seed_string, *this->_context,
+                &chunk_pipeline::write_cross_chunk_block, &context));
+    }
+    return (chunk_mesh_generate_from_chunk_with_neighbors(slot->mesh, slot->chunk,
+            slot->chunk_x, slot->chunk_z, &chunk_pipeline::lookup_mesh_block, &context));
+}
+
+void chunk_pipeline::finish_task(const pipeline_task &task, int32_t error_code,
+    int64_t elapsed_ns) noexcept
+{
+    pipeline_slot *slot;
+    pipeline_slot *neighbour;
+    chunk_pipeline_stage_metrics *metrics;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t offset_x;
+    int32_t offset_z;
+
+    this->release_footprint(task);
+    slot = &this->_slots[task.slot_index];
+    metrics = &this->_metrics.stages[task.stage - 1];
+    if (slot->evicting == FT_TRUE)
+        this->_metrics.discarded++;
+    else if (error_code != FT_ERR_SUCCESS)
+    {
+        slot->failed = FT_TRUE;
+        metrics->failed++;
+    }
+    else
+    {
+        slot->stage = task.stage;
+        metrics->completed++;
+        if (elapsed_ns > 0)
+        {
+            metrics->total_ns += static_cast<uint64_t>(elapsed_ns);
+            if (static_cast<uint64_t>(elapsed_ns) > metrics->max_ns)
+                metrics->max_ns = static_cast<uint64_t>(elapsed_ns);
+        }
+        if (task.stage == CHUNK_PIPELINE_STAGE_DECORATED)
+            this->demote_meshes_around(*slot);
+    }
+    chunk_x = slot->chunk_x;
+    chunk_z = slot->chunk_z;
+    offset_z = -2;
+    while (offset_z <= 2)
+    {
+        offset_x = -2;
+        while (offset_x <= 2)
+        {
+            neighbour = this->find_slot(chunk_x + offset_x, chunk_z + offset_z, FT_TRUE);
+            if (neighbour != ft_nullptr)
+                this->settle(static_cast<ft_size_t>(neighbour - this->_slots));
+            offset_x++;
+        }
+        offset_z++;
+    }
+    return ;
+}
+
+int32_t chunk_pipeline::run_one(ft_bool *ran) noexcept
+{
+    pipeline_task task;
+    t_high_resolution_time_point start_time;
+    t_high_resolution_time_point end_time;
+    int64_t elapsed_ns;
+    int32_t error_code;
+
+    *ran = FT_FALSE;
+    error_code = pt_mutex_lock_if_not_null(this->_mutex);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    if (this->pick_task(&task) == FT_FALSE)
+    {
+        (void)pt_mutex_unlock_if_not_null(this->_mutex);
+        return (FT_ERR_SUCCESS);
+    }
+    this->_running_tasks++;
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    elapsed_ns = 0;
+    (void)time_high_resolution_now(&start_time);
+    error_code = this->execute(task);
+    if (time_high_resolution_now(&end_time) == FT_TRUE)
+        elapsed_ns = time_high_resolution_diff_ns(start_time, end_time);
+    (void)pt_mutex_lock_if_not_null(this->_mutex);
+    this->_running_tasks--;
+    this->finish_task(task, error_code, elapsed_ns);
+    this->dispatch_lanes();
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    *ran = FT_TRUE;
+    return (FT_ERR_SUCCESS);
+}
+
+// Lanes are pool tasks that keep pulling work until the queue runs dry; one
+// is added whenever more chunks are ready than there are idle lanes.
+void chunk_pipeline::dispatch_lanes() noexcept
+{
+    uint32_t idle_lanes;
+
+    if (this->_pool == ft_nullptr || this->_stopping == FT_TRUE)
+        return ;
+    while (this->_active_lanes < this->_lane_limit)
+    {
+        idle_lanes = 0;
+        if (this->_active_lanes > this->_running_tasks)
+            idle_lanes = this->_active_lanes - this->_running_tasks;
+        if (this->_ready.size() <= idle_lanes)
+            return ;
+        this->_active_lanes++;
+        this->_pool->submit([this]() { this->run_lane(); });
+        if (this->_pool->get_error() != FT_ERR_SUCCESS)
+        {
+            this->_active_lanes--;
+            return ;
+        }
+    }
+    return ;
+}
+
+void chunk_pipeline::run_lane() noexcept
+{
+    ft_bool ran;
+
+    ran = FT_TRUE;
+    while (ran == FT_TRUE)
+    {
+        if (this->run_one(&ran) != FT_ERR_SUCCESS)
+            ran = FT_FALSE;
+    }
+    (void)pt_mutex_lock_if_not_null(this->_mutex);
+    this->_active_lanes--;
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    return ;
+}
+
+int32_t chunk_pipeline::set_center(int32_t chunk_x, int32_t chunk_z) noexcept
+{
+    pipeline_slot *slot;
+    ft_size_t slot_index;
+    int32_t wanted_x;
+    int32_t wanted_z;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::set_center");
+    error_code = pt_mutex_lock_if_not_null(this->_mutex);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    this->_center_x = chunk_x;
+    this->_center_z = chunk_z;
+    this->_has_center = FT_TRUE;
+    this->_ready.clear();
+    slot_index = 0;
+    while (slot_index < this->_slot_count)
+    {
+        slot = &this->_slots[slot_index];
+        this->wanted_chunk(slot_index, &wanted_x, &wanted_z);
+        if (slot->occupied == FT_TRUE && slot->chunk_x == wanted_x
+            && slot->chunk_z == wanted_z)
+        {
+            slot->evicting = FT_FALSE;
+            slot->target = this->target_of(wanted_x, wanted_z);
+        }
+        else
+        {
+            if (slot->occupied == FT_TRUE && slot->evicting == FT_FALSE
+                && slot->stage < slot->target)
+                this->_metrics.cancelled++;
+            // Running tasks still hold the old chunk; it is replaced once
+            // their claims are released.
+            if (slot->writers != 0 || slot->readers != 0)
+                slot->evicting = FT_TRUE;
+            else
+                this->install(slot_index);
+        }
+        slot_index++;
+    }
+    slot_index = 0;
+    while (slot_index < this->_slot_count)
+    {
+        this->evaluate(slot_index);
+        slot_index++;
+    }
+    this->dispatch_lanes();
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+int32_t chunk_pipeline::pump(uint32_t task_budget) noexcept
+{
+    ft_bool ran;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::pump");
+    error_code = pt_mutex_lock_if_not_null(this->_mutex);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    this->dispatch_lanes();
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    ran = FT_TRUE;
+    while (task_budget > 0 && ran == FT_TRUE)
+    {
+        error_code = this->run_one(&ran);
+        if (error_code != FT_ERR_SUCCESS)
+            return (this->set_error(error_code));
+        task_budget--;
+    }
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+int32_t chunk_pipeline::wait_idle() noexcept
+{
+    ft_bool ran;
+    ft_bool busy;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::wait_idle");
+    busy = FT_TRUE;
+    while (busy == FT_TRUE)
+    {
+        error_code = this->run_one(&ran);
+        if (error_code != FT_ERR_SUCCESS)
+            return (this->set_error(error_code));
+        if (ran == FT_FALSE)
+        {
+            // Nothing could be picked: either running tasks will queue more
+            // work, or the remaining chunks wait on meshes the caller holds.
+            (void)pt_mutex_lock_if_not_null(this->_mutex);
+            busy = (this->_running_tasks != 0);
+            (void)pt_mutex_unlock_if_not_null(this->_mutex);
+            if (busy == FT_TRUE)
+                pt_thread_yield();
+        }
+    }
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+uint8_t chunk_pipeline::get_stage(int32_t chunk_x, int32_t chunk_z) const noexcept
+{
+    const pipeline_slot *slot;
+    uint8_t stage;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::get_stage");
+    (void)pt_mutex_lock_if_not_null(this->_mutex);
+    stage = CHUNK_PIPELINE_STAGE_NONE;
+    slot = this->find_slot(chunk_x, chunk_z, FT_FALSE);
+    if (slot != ft_nullptr)
+        stage = slot->stage;
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    this->set_error(FT_ERR_SUCCESS);
+    return (stage);
+}
+
+int32_t chunk_pipeline::acquire_mesh(int32_t chunk_x, int32_t chunk_z,
+    const chunk_mesh **mesh) noexcept
+{
+    pipeline_slot *slot;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::acquire_mesh");
+    if (mesh == ft_nullptr)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    *mesh = ft_nullptr;
+    error_code = pt_mutex_lock_if_not_null(this->_mutex);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    slot = this->find_slot(chunk_x, chunk_z, FT_FALSE);
+    error_code = FT_ERR_NOT_FOUND;
+    if (slot != ft_nullptr && slot->stage == CHUNK_PIPELINE_STAGE_MESHED
+        && slot->writers == 0)
+    {
+        slot->readers = static_cast<uint16_t>(slot->readers + 1);
+        *mesh = &slot->mesh;
+        error_code = FT_ERR_SUCCESS;
+    }
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    return (this->set_error(error_code));
+}
+
+int32_t chunk_pipeline::release_mesh(int32_t chunk_x, int32_t chunk_z) noexcept
+{
+    pipeline_slot *slot;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::release_mesh");
+    error_code = pt_mutex_lock_if_not_null(this->_mutex);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    slot = this->find_slot(chunk_x, chunk_z, FT_TRUE);
+    error_code = FT_ERR_INVALID_STATE;
+    if (slot != ft_nullptr && slot->readers != 0)
+    {
+        slot->readers = static_cast<uint16_t>(slot->readers - 1);
+        this->settle(static_cast<ft_size_t>(slot - this->_slots));
+        this->dispatch_lanes();
+        error_code = FT_ERR_SUCCESS;
+    }
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    return (this->set_error(error_code));
+}
+
+int32_t chunk_pipeline::read_block(int32_t world_x, int32_t world_y,
+    int32_t world_z, uint32_t *block_id) const noexcept
+{
+    const pipeline_slot *slot;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::read_block");
+    if (block_id == ft_nullptr)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    chunk_x = chunk_pipeline_floor_div(world_x, GAME_VOXEL_CHUNK_WIDTH);
+    chunk_z = chunk_pipeline_floor_div(world_z, GAME_VOXEL_CHUNK_DEPTH);
+    error_code = pt_mutex_lock_if_not_null(this->_mutex);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    slot = this->find_slot(chunk_x, chunk_z, FT_FALSE);
+    if (slot == ft_nullptr || slot->stage == CHUNK_PIPELINE_STAGE_NONE)
+        error_code = FT_ERR_NOT_FOUND;
+    else if (slot->writers != 0)
+        error_code = FT_ERR_THREAD_BUSY;
+    else
+        error_code = slot->chunk.read_block(world_x - chunk_x * GAME_VOXEL_CHUNK_WIDTH,
+                world_y, world_z - chunk_z * GAME_VOXEL_CHUNK_DEPTH, block_id);
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    return (this->set_error(error_code));
+}
+
+ft_size_t chunk_pipeline::get_pending_count() const noexcept
+{
+    ft_size_t pending;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::get_pending_count");
+    (void)pt_mutex_lock_if_not_null(this->_mutex);
+    pending = this->_ready.size() + this->_running_tasks;
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    this->set_error(FT_ERR_SUCCESS);
+    return (pending);
+}
+
+int32_t chunk_pipeline::get_metrics(chunk_pipeline_metrics *metrics) const noexcept
+{
+    int32_t error_code;
+
+    errno_abort_if_uninitialised_or_destroyed(this->_initialised_state,
+        "chunk_pipeline::get_metrics");
+    if (metrics == ft_nullptr)
+        return (this->set_error(FT_ERR_INVALID_ARGUMENT));
+    error_code = pt_mutex_lock_if_not_null(this->_mutex);
+    if (error_code != FT_ERR_SUCCESS)
+        return (this->set_error(error_code));
+    *metrics = this->_metrics;
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    return (this->set_error(FT_ERR_SUCCESS));
+}
+
+void chunk_pipeline::reset_metrics() noexcept
+{
+    uint32_t stage_index;
+
+    (void)pt_mutex_lock_if_not_null(this->_mutex);
+    stage_index = 0;
+    while (stage_index < CHUNK_PIPELINE_STAGE_COUNT)
+    {
+        this->_metrics.stages[stage_index].completed = 0;
+        this->_metrics.stages[stage_index].failed = 0;
+        this->_metrics.stages[stage_index].total_ns = 0;
+        this->_metrics.stages[stage_index].max_ns = 0;
+        stage_index++;
+    }
+    this->_metrics.cancelled = 0;
+    this->_metrics.discarded = 0;
+    (void)pt_mutex_unlock_if_not_null(this->_mutex);
+    this->set_error(FT_ERR_SUCCESS);
+    return ;
+}
+
+int32_t chunk_pipeline::get_error() const noexcept
+{
+    return (chunk_pipeline::_last_error);
+}
+
+const char *chunk_pipeline::get_error_str() const noexcept
+{
+    return (ft_strerror(chunk_pipeline::_last_error));
+}
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef VOXEL_PIPELINE_HPP
+# define VOXEL_PIPELINE_HPP
+
+#ifdef GAME_USE_VOXEL_REGION_BACKEND
+
+# include "voxel.hpp"
+# include "voxel_mesh.hpp"
+# include "../Game/game_voxel_chunk.hpp"
+# include "../Template/indexed_heap.hpp"
+# include "../Threading/thread_pool.hpp"
+# include "../PThread/mutex.hpp"
+# include "../Errno/errno.hpp"
+# include <stdint.h>
+
+# define CHUNK_PIPELINE_STAGE_COUNT 3U
+# define CHUNK_PIPELINE_MAX_VIEW_RADIUS 64U
+
+enum chunk_pipeline_stage
+{
+    CHUNK_PIPELINE_STAGE_NONE = 0,
+    CHUNK_PIPELINE_STAGE_GENERATED = 1,
+    CHUNK_PIPELINE_STAGE_DECORATED = 2,
+    CHUNK_PIPELINE_STAGE_MESHED = 3
+};
+
+struct chunk_pipeline_stage_metrics
+{
+    uint64_t completed;
+    uint64_t failed;
+    uint64_t total_ns;
+    uint64_t max_ns;
+};
+
+struct chunk_pipeline_metrics
+{
+    chunk_pipeline_stage_metrics stages[CHUNK_PIPELINE_STAGE_COUNT];
+    uint64_t cancelled;
+    uint64_t discarded;
+};
+
+struct chunk_pipeline_block_write
+{
+    int32_t world_x;
+    int32_t world_y;
+    int32_t world_z;
+    uint32_t block_id;
+};
+
+// Streams a square of chunks around a moving center through generate,
+// decorate, and mesh stages on an ft_thread_pool. Chunks live in a toroidal
+// window of (2 * (view_radius + 3) + 1)^2 slots: meshes are built within
+// view_radius, decoration runs two rings further so every meshed chunk and
+// its face neighbours hold final blocks, and one more ring is generated so
+// decoration can write trees into its neighbours.
+class chunk_pipeline
+{
+#ifdef LIBFT_TEST_BUILD
+    public:
+#else
+    private:
+#endif
+        struct pipeline_slot
+        {
+            game_voxel_chunk            chunk;
+            chunk_mesh                  mesh;
+            chunk_pipeline_block_write  *journal;
+            uint32_t                    journal_count;
+            uint32_t                    journal_capacity;
+            int32_t                     chunk_x;
+            int32_t                     chunk_z;
+            uint8_t                     stage;
+            uint8_t                     target;
+            uint8_t                     writers;
+            uint16_t                    readers;
+            ft_bool                     occupied;
+            ft_bool                     evicting;
+            ft_bool                     failed;
+        };
+
+        struct pipeline_task
+        {
+            ft_size_t                   slot_index;
+            uint8_t                     stage;
+            uint32_t                    claim_mask;
+        };
+
+        struct pipeline_deferred
+        {
+            ft_size_t                   slot_index;
+            uint64_t                    key;
+        };
+
+        struct pipeline_task_context
+        {
+            chunk_pipeline              *pipeline;
+            ft_size_t                   slot_index;
+        };
+
+        pipeline_slot                   *_slots;
+        pipeline_deferred               *_deferred;
+        ft_size_t                       _slot_count;
+        int32_t                         _window;
+        int32_t                         _view_radius;
+        int32_t                         _center_x;
+        int32_t                         _center_z;
+        ft_bool                         _has_center;
+        const terrain_generation_context *_context;
+        char                            *_seed_string;
+        ft_thread_pool                  *_pool;
+        uint32_t                        _lane_limit;
+        uint32_t                        _active_lanes;
+        uint32_t                        _running_tasks;
+        ft_bool                         _stopping;
+        ft_indexed_heap<uint64_t>       _ready;
+        chunk_pipeline_metrics          _metrics;
+        pt_mutex                        *_mutex;
+        uint8_t                         _initialised_state;
+        static thread_local int32_t     _last_error;
+
+        static int32_t set_error(int32_t error_code) noexcept;
+        static int32_t write_cross_chunk_block(int32_t world_block_x,
+                            int32_t world_block_y, int32_t world_block_z,
+                            uint32_t block_id, void *user_data) noexcept;
+        static int32_t lookup_mesh_block(void *user_data, int32_t world_x,
+                            int32_t world_y, int32_t world_z,
+                            uint32_t *block_id);
+
+        void            release() noexcept;
+        ft_size_t       slot_index_of(int32_t chunk_x, int32_t chunk_z) const noexcept;
+        pipeline_slot   *find_slot(int32_t chunk_x, int32_t chunk_z,
+                            ft_bool include_evicting) const noexcept;
+        uint8_t         target_of(int32_t chunk_x, int32_t chunk_z) const noexcept;
+        uint8_t         next_stage(const pipeline_slot &slot) const noexcept;
+        ft_bool         is_ready(const pipeline_slot &slot, uint8_t stage) const noexcept;
+        ft_bool         footprint_free(const pipeline_slot &slot,
+                            uint8_t stage) const noexcept;
+        uint32_t        claim_footprint(ft_size_t slot_index, uint8_t stage) noexcept;
+        void            release_footprint(const pipeline_task &task) noexcept;
+        int32_t         append_journal(pipeline_slot &slot, int32_t world_x,
+                            int32_t world_y, int32_t world_z,
+                            uint32_t block_id) noexcept;
+        int32_t         replay_journals(const pipeline_task &task) noexcept;
+        void            wanted_chunk(ft_size_t slot_index, int32_t *chunk_x,
+                            int32_t *chunk_z) const noexcept;
+        void            evaluate(ft_size_t slot_index) noexcept;
+        void            install(ft_size_t slot_index) noexcept;
+        void            settle(ft_size_t slot_index) noexcept;
+        void            demote_meshes_around(const pipeline_slot &slot) noexcept;
+        ft_bool         pick_task(pipeline_task *task) noexcept;
+        int32_t         execute(const pipeline_task &task) noexcept;
+        void            finish_task(const pipeline_task &task, int32_t error_code,
+                            int64_t elapsed_ns) noexcept;
+        int32_t         run_one(ft_bool *ran) noexcept;
+        void            dispatch_lanes() noexcept;
+        void            run_lane() noexcept;
+
+    public:
+        chunk_pipeline() noexcept;
+        chunk_pipeline(const chunk_pipeline &other) noexcept = delete;
+        chunk_pipeline(chunk_pipeline &&other) noexcept = delete;
+        ~chunk_pipeline() noexcept;
+
+        chunk_pipeline &operator=(const chunk_pipeline &other) noexcept = delete;
+        chunk_pipeline &operator=(chunk_pipeline &&other) noexcept = delete;
+
+        int32_t initialize(const terrain_generation_context &context,
+                    const char *seed_string, ft_thread_pool *pool,
+                    uint32_t view_radius, uint32_t lane_count) noexcept;
+        int32_t destroy() noexcept;
+
+        int32_t set_center(int32_t chunk_x, int32_t chunk_z) noexcept;
+        int32_t pump(uint32_t task_budget) noexcept;
+        int32_t wait_idle() noexcept;
+
+        uint8_t get_stage(int32_t chunk_x, int32_t chunk_z) const noexcept;
+        int32_t acquire_mesh(int32_t chunk_x, int32_t chunk_z,
+                    const chunk_mesh **mesh) noexcept;
+        int32_t release_mesh(int32_t chunk_x, int32_t chunk_z) noexcept;
+        int32_t read_block(int32_t world_x, int32_t world_y, int32_t world_z,
+                    uint32_t *block_id) const noexcept;
+        ft_size_t get_pending_count() const noexcept;
+        int32_t get_metrics(chunk_pipeline_metrics *metrics) const noexcept;
+        void reset_metrics() noexcept;
+
+        int32_t get_error() const noexcept;
+        const char *get_error_str() const noexcept;
+};
+
+#endif
+
+#endif
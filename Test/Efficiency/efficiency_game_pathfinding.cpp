@@ -0,0 +1,490 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Game/game_pathfinding.hpp"
+#include "../../Modules/Game/game_path_hierarchy.hpp"
+#include "../../Modules/Game/game_flow_field.hpp"
+#include "../../Modules/Game/game_path_batch.hpp"
+#include "../../Modules/Threading/thread_pool.hpp"
+#include "../../Modules/Game/game_map3d.hpp"
+#include "../../Modules/Template/vector.hpp"
+#include "../../Modules/Template/graph.hpp"
+#include "../../Modules/Template/graph_search.hpp"
+#include "utils.hpp"
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+#include <cstdio>
+
+typedef struct efficiency_path_node
+{
+    ft_size_t   x;
+    ft_size_t   y;
+    ft_size_t   z;
+    int32_t     g;
+    int32_t     f;
+} efficiency_path_node;
+
+static int32_t efficiency_path_estimate(ft_size_t x, ft_size_t y, ft_size_t z,
+    ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z)
+{
+    ft_size_t estimate;
+
+    estimate = (x > goal_x) ? x - goal_x : goal_x - x;
+    estimate += (y > goal_y) ? y - goal_y : goal_y - y;
+    estimate += (z > goal_z) ? z - goal_z : goal_z - z;
+    return (static_cast<int32_t>(estimate));
+}
+
+static int32_t efficiency_path_linear_astar(const game_map3d &grid, ft_size_t goal_x,
+    ft_size_t goal_y, ft_size_t goal_z)
+{
+    const int32_t direction_x[6] = {1, -1, 0, 0, 0, 0};
+    const int32_t direction_y[6] = {0, 0, 1, -1, 0, 0};
+    const int32_t direction_z[6] = {0, 0, 0, 0, 1, -1};
+    ft_vector<efficiency_path_node> nodes;
+    ft_vector<ft_size_t> open_set;
+    efficiency_path_node node;
+    ft_size_t best;
+    ft_size_t index;
+    ft_size_t current;
+    ft_size_t search;
+    int direction;
+
+    if (nodes.initialize() != FT_ERR_SUCCESS || open_set.initialize() != FT_ERR_SUCCESS)
+        return (-1);
+    node.x = 0;
+    node.y = 0;
+    node.z = 0;
+    node.g = 0;
+    node.f = efficiency_path_estimate(0, 0, 0, goal_x, goal_y, goal_z);
+    nodes.push_back(node);
+    open_set.push_back(0);
+    while (open_set.size() > 0)
+    {
+        best = 0;
+        index = 0;
+        while (index < open_set.size())
+        {
+            if (nodes[open_set[index]].f < nodes[open_set[best]].f)
+                best = index;
+            index++;
+        }
+        current = open_set[best];
+        if (nodes[current].x == goal_x && nodes[current].y == goal_y
+            && nodes[current].z == goal_z)
+            return (nodes[current].g);
+        open_set.erase(open_set.begin() + best);
+        direction = 0;
+        while (direction < 6)
+        {
+            node.x = nodes[current].x + static_cast<ft_size_t>(direction_x[direction]);
+            node.y = nodes[current].y + static_cast<ft_size_t>(direction_y[direction]);
+            node.z = nodes[current].z + static_cast<ft_size_t>(direction_z[direction]);
+            node.g = nodes[current].g + 1;
+            node.f = node.g + efficiency_path_estimate(node.x, node.y, node.z,
+                    goal_x, goal_y, goal_z);
+            direction++;
+            if (node.x >= grid.get_width() || node.y >= grid.get_height()
+                || node.z >= grid.get_depth() || grid.get(node.x, node.y, node.z) != 0)
+                continue ;
+            search = 0;
+            while (search < nodes.size() && (nodes[search].x != node.x
+                    || nodes[search].y != node.y || nodes[search].z != node.z))
+                search++;
+            if (search < nodes.size())
+            {
+                if (node.g < nodes[search].g)
+                {
+                    nodes[search].g = node.g;
+                    nodes[search].f = node.f;
+                }
+                continue ;
+            }
+            nodes.push_back(node);
+            open_set.push_back(nodes.size() - 1);
+        }
+    }
+    return (-1);
+}
+
+static void efficiency_path_build_map(game_map3d &grid, ft_size_t width, ft_size_t height,
+    ft_size_t depth)
+{
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+    uint32_t seed;
+
+    seed = 7;
+    z = 0;
+    while (z < depth)
+    {
+        y = 0;
+        while (y < height)
+        {
+            x = 0;
+            while (x < width)
+            {
+                seed = seed * 1103515245u + 12345u;
+                if ((seed >> 16) % 100 < 25 && x + y + z != 0
+                    && (x != width - 1 || y != height - 1 || z != depth - 1))
+                    grid.set(x, y, z, 1);
+                x++;
+            }
+            y++;
+        }
+        z++;
+    }
+    return ;
+}
+
+int test_efficiency_game_pathfinding_astar(void)
+{
+    const size_t iterations = 20;
+    game_map3d small_grid;
+    game_map3d large_grid;
+    game_pathfinding finder;
+    ft_vector<game_path_step> path;
+    int32_t linear_cost;
+    size_t iteration;
+
+    if (small_grid.initialize(40, 40, 2, 0) != FT_ERR_SUCCESS
+        || large_grid.initialize(256, 256, 16, 0) != FT_ERR_SUCCESS
+        || finder.initialize() != FT_ERR_SUCCESS || path.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    efficiency_path_build_map(small_grid, 40, 40, 2);
+    efficiency_path_build_map(large_grid, 256, 256, 16);
+    auto linear_start = clock_type::now();
+    linear_cost = efficiency_path_linear_astar(small_grid, 39, 39, 1);
+    auto linear_end = clock_type::now();
+    auto heap_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        if (finder.astar_grid(small_grid, 0, 0, 0, 39, 39, 1, path) != FT_ERR_SUCCESS)
+            return (0);
+        iteration++;
+    }
+    auto heap_end = clock_type::now();
+    if (linear_cost < 0 || path.size() != static_cast<ft_size_t>(linear_cost) + 1)
+        return (0);
+    print_comparison("astar 40x40x2 linear open list vs heap (per query)",
+        elapsed_us(linear_start, linear_end),
+        elapsed_us(heap_start, heap_end) / static_cast<int64_t>(iterations));
+    auto large_start = clock_type::now();
+    iteration = 0;
+    while (iteration < 4)
+    {
+        if (finder.astar_grid(large_grid, 0, 0, 0, 255, 255, 15, path) != FT_ERR_SUCCESS)
+            return (0);
+        prevent_optimization(&path);
+        iteration++;
+    }
+    auto large_end = clock_type::now();
+    printf("astar 256x256x16 heap: " FT_INT64_DECIMAL_FORMAT " us per query, %zu steps\n",
+        elapsed_us(large_start, large_end) / 4, static_cast<size_t>(path.size()));
+    return (1);
+}
+
+int test_efficiency_game_pathfinding_hierarchy(void)
+{
+    const size_t agents = 16;
+    game_map3d grid;
+    game_pathfinding finder;
+    game_path_hierarchy hierarchy;
+    ft_vector<game_path_step> path;
+    ft_size_t flat_steps;
+    ft_size_t hierarchy_steps;
+    size_t agent;
+
+    if (grid.initialize(256, 256, 16, 0) != FT_ERR_SUCCESS
+        || finder.initialize() != FT_ERR_SUCCESS || hierarchy.initialize() != FT_ERR_SUCCESS
+        || path.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    efficiency_path_build_map(grid, 256, 256, 16);
+    agent = 0;
+    while (agent < agents)
+    {
+        grid.set(agent % 4 * 3, agent / 4 * 3, 1, 0);
+        agent++;
+    }
+    auto build_start = clock_type::now();
+    if (hierarchy.build(grid) != FT_ERR_SUCCESS)
+        return (0);
+    auto build_end = clock_type::now();
+    flat_steps = 0;
+    auto flat_start = clock_type::now();
+    agent = 0;
+    while (agent < agents)
+    {
+        if (finder.astar_grid(grid, agent % 4 * 3, agent / 4 * 3, 1, 255, 255, 15,
+                path) != FT_ERR_SUCCESS)
+            return (0);
+        flat_steps += path.size();
+        agent++;
+    }
+    auto flat_end = clock_type::now();
+    hierarchy_steps = 0;
+    auto hierarchy_start = clock_type::now();
+    agent = 0;
+    while (agent < agents)
+    {
+        if (hierarchy.find_path(grid, agent % 4 * 3, agent / 4 * 3, 1, 255, 255, 15,
+                path) != FT_ERR_SUCCESS)
+            return (0);
+        hierarchy_steps += path.size();
+        agent++;
+    }
+    auto hierarchy_end = clock_type::now();
+    print_comparison("path 256x256x16, 16 agents to one goal: grid astar vs hierarchy",
+        elapsed_us(flat_start, flat_end), elapsed_us(hierarchy_start, hierarchy_end));
+    printf("hierarchy build " FT_INT64_DECIMAL_FORMAT " us, %zu entrances, %zu cache hits, "
+        "path length +%.1f%%\n", elapsed_us(build_start, build_end),
+        static_cast<size_t>(hierarchy.get_node_count()),
+        static_cast<size_t>(hierarchy.get_cache_hits()),
+        100.0 * (static_cast<double>(hierarchy_steps) - static_cast<double>(flat_steps))
+        / static_cast<double>(flat_steps));
+    return (1);
+}
+
+int test_efficiency_game_pathfinding_flow_field(void)
+{
+    const size_t agents = 256;
+    game_map3d grid;
+    game_pathfinding finder;
+    game_flow_field field;
+    ft_vector<game_path_step> path;
+    ft_size_t position[3];
+    ft_size_t astar_steps;
+    ft_size_t field_steps;
+    size_t agent;
+
+    if (grid.initialize(128, 128, 8, 0) != FT_ERR_SUCCESS
+        || finder.initialize() != FT_ERR_SUCCESS || field.initialize() != FT_ERR_SUCCESS
+        || path.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    efficiency_path_build_map(grid, 128, 128, 8);
+    agent = 0;
+    while (agent < agents)
+    {
+        grid.set(agent * 37 % 128, agent * 11 % 128, agent % 8, 0);
+        agent++;
+    }
+    astar_steps = 0;
+    auto astar_start = clock_type::now();
+    agent = 0;
+    while (agent < agents)
+    {
+        if (finder.astar_grid(grid, agent * 37 % 128, agent * 11 % 128, agent % 8,
+                127, 127, 7, path) == FT_ERR_SUCCESS)
+            astar_steps += path.size() - 1;
+        agent++;
+    }
+    auto astar_end = clock_type::now();
+    field_steps = 0;
+    auto field_start = clock_type::now();
+    if (field.build(grid, 127, 127, 7) != FT_ERR_SUCCESS)
+        return (0);
+    agent = 0;
+    while (agent < agents)
+    {
+        position[0] = agent * 37 % 128;
+        position[1] = agent * 11 % 128;
+        position[2] = agent % 8;
+        while (field.get_distance(position[0], position[1], position[2]) != 0
+            && field.next_step(position[0], position[1], position[2], &position[0],
+                &position[1], &position[2]) == FT_ERR_SUCCESS)
+            field_steps++;
+        agent++;
+    }
+    auto field_end = clock_type::now();
+    if (astar_steps != field_steps)
+        return (0);
+    print_comparison("path 128x128x8, 256 agents to one goal: astar per agent vs flow field",
+        elapsed_us(astar_start, astar_end), elapsed_us(field_start, field_end));
+    return (1);
+}
+
+int test_efficiency_game_pathfinding_batch(void)
+{
+    const size_t queries = 64;
+    game_map3d grid;
+    game_pathfinding finder;
+    game_path_batch batch;
+    ft_thread_pool pool(4, 0);
+    game_path_request requests[64];
+    ft_vector<game_path_step> paths[64];
+    ft_size_t serial_steps;
+    ft_size_t batch_steps;
+    size_t query;
+
+    if (grid.initialize(128, 128, 8, 0) != FT_ERR_SUCCESS
+        || finder.initialize() != FT_ERR_SUCCESS || batch.initialize() != FT_ERR_SUCCESS
+        || pool.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    efficiency_path_build_map(grid, 128, 128, 8);
+    query = 0;
+    while (query < queries)
+    {
+        if (paths[query].initialize() != FT_ERR_SUCCESS)
+            return (0);
+        requests[query].start_x = query * 37 % 128;
+        requests[query].start_y = query * 11 % 128;
+        requests[query].start_z = query % 8;
+        requests[query].goal_x = 127 - query * 13 % 128;
+        requests[query].goal_y = 127 - query * 29 % 128;
+        requests[query].goal_z = 7 - query % 8;
+        requests[query].out_path = &paths[query];
+        grid.set(requests[query].start_x, requests[query].start_y,
+            requests[query].start_z, 0);
+        grid.set(requests[query].goal_x, requests[query].goal_y, requests[query].goal_z, 0);
+        query++;
+    }
+    serial_steps = 0;
+    auto serial_start = clock_type::now();
+    query = 0;
+    while (query < queries)
+    {
+        if (finder.astar_grid(grid, requests[query].start_x, requests[query].start_y,
+                requests[query].start_z, requests[query].goal_x, requests[query].goal_y,
+                requests[query].goal_z, paths[query]) == FT_ERR_SUCCESS)
+            serial_steps += paths[query].size();
+        query++;
+    }
+    auto serial_end = clock_type::now();
+    batch_steps = 0;
+    auto batch_start = clock_type::now();
+    if (batch.run(grid, pool, requests, queries, 4) != FT_ERR_SUCCESS)
+        return (0);
+    auto batch_end = clock_type::now();
+    query = 0;
+    while (query < queries)
+    {
+        if (requests[query].result == FT_ERR_SUCCESS)
+            batch_steps += paths[query].size();
+        query++;
+    }
+    pool.wait();
+    if (pool.destroy() != FT_ERR_SUCCESS || serial_steps != batch_steps)
+        return (0);
+    print_comparison("path 128x128x8, 64 queries: serial astar vs 4-lane batch",
+        elapsed_us(serial_start, serial_end), elapsed_us(batch_start, batch_end));
+    return (1);
+}
+
+static ft_size_t efficiency_path_linear_dijkstra(const ft_graph<int32_t> &graph,
+    ft_size_t start_vertex, ft_size_t goal_vertex)
+{
+    ft_vector<int32_t> distance;
+    ft_vector<ft_size_t> queue;
+    ft_vector<ft_size_t> neighbors;
+    ft_size_t best_queue;
+    ft_size_t queue_index;
+    ft_size_t current;
+    ft_size_t neighbor_index;
+
+    if (distance.initialize() != FT_ERR_SUCCESS || queue.initialize() != FT_ERR_SUCCESS
+        || neighbors.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    distance.resize(graph.size(), -1);
+    distance[start_vertex] = 0;
+    queue.push_back(start_vertex);
+    while (queue.size() > 0)
+    {
+        best_queue = 0;
+        queue_index = 0;
+        while (queue_index < queue.size())
+        {
+            if (distance[queue[queue_index]] < distance[queue[best_queue]])
+                best_queue = queue_index;
+            queue_index++;
+        }
+        current = queue[best_queue];
+        queue.erase(queue.begin() + best_queue);
+        if (current == goal_vertex)
+            break ;
+        neighbors.clear();
+        graph.neighbors(current, neighbors);
+        neighbor_index = 0;
+        while (neighbor_index < neighbors.size())
+        {
+            if (distance[neighbors[neighbor_index]] == -1
+                || distance[current] + 1 < distance[neighbors[neighbor_index]])
+            {
+                distance[neighbors[neighbor_index]] = distance[current] + 1;
+                queue.push_back(neighbors[neighbor_index]);
+            }
+            neighbor_index++;
+        }
+    }
+    if (distance[goal_vertex] < 0)
+        return (0);
+    return (static_cast<ft_size_t>(distance[goal_vertex]));
+}
+
+int test_efficiency_game_pathfinding_graph(void)
+{
+    const ft_size_t side = 160;
+    const size_t queries = 8;
+    ft_graph<int32_t> graph;
+    ft_graph_csr<uint32_t> csr;
+    ft_graph_search<uint32_t> search;
+    ft_vector<ft_size_t> path;
+    ft_size_t vertex;
+    ft_size_t linear_hops;
+    ft_size_t csr_hops;
+    size_t query;
+
+    if (graph.initialize() != FT_ERR_SUCCESS || csr.initialize() != FT_ERR_SUCCESS
+        || search.initialize() != FT_ERR_SUCCESS || path.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    vertex = 0;
+    while (vertex < side * side)
+    {
+        graph.add_vertex(static_cast<int32_t>(vertex));
+        vertex++;
+    }
+    vertex = 0;
+    while (vertex < side * side)
+    {
+        if (vertex % side + 1 < side && (vertex / side) % 8 != 7)
+        {
+            graph.add_edge(vertex, vertex + 1);
+            graph.add_edge(vertex + 1, vertex);
+        }
+        if (vertex + side < side * side && vertex % 16 != 15)
+        {
+            graph.add_edge(vertex, vertex + side);
+            graph.add_edge(vertex + side, vertex);
+        }
+        vertex++;
+    }
+    linear_hops = 0;
+    auto linear_start = clock_type::now();
+    query = 0;
+    while (query < queries)
+    {
+        linear_hops += efficiency_path_linear_dijkstra(graph, query * 19,
+                side * side - 1 - query * 7);
+        query++;
+    }
+    auto linear_end = clock_type::now();
+    csr_hops = 0;
+    auto csr_start = clock_type::now();
+    if (graph.snapshot(csr) != FT_ERR_SUCCESS)
+        return (0);
+    query = 0;
+    while (query < queries)
+    {
+        if (search.dijkstra(csr, query * 19, side * side - 1 - query * 7, path)
+            == FT_ERR_SUCCESS)
+            csr_hops += path.size() - 1;
+        query++;
+    }
+    auto csr_end = clock_type::now();
+    if (linear_hops == 0 || linear_hops != csr_hops)
+        return (0);
+    print_comparison("graph 160x160 lattice, 8 queries: linear-queue dijkstra vs csr + indexed heap",
+        elapsed_us(linear_start, linear_end), elapsed_us(csr_start, csr_end));
+    return (1);
+}
@@ -0,0 +1,138 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Networking/http_server.hpp"
+#include "../../Modules/Networking/networking.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "utils.hpp"
+
+#include "../../Modules/Errno/errno.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+static int32_t efficiency_http_connect(uint16_t port)
+{
+    sockaddr_in server_address;
+    int32_t client_fd;
+
+    client_fd = nw_socket(AF_INET, SOCK_STREAM, 0);
+    if (client_fd < 0)
+        return (-1);
+    ft_memset(&server_address, 0, sizeof(server_address));
+    server_address.sin_family = AF_INET;
+    server_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    server_address.sin_port = htons(port);
+    if (nw_connect(client_fd, reinterpret_cast<struct sockaddr *>(&server_address),
+            sizeof(server_address)) != 0)
+    {
+        (void)nw_close(client_fd);
+        return (-1);
+    }
+    return (client_fd);
+}
+
+static void efficiency_http_client(uint16_t port, size_t request_count,
+    std::vector<int64_t> *latencies, bool *client_ok)
+{
+    const char *request;
+    char buffer[512];
+    size_t request_length;
+    size_t index;
+    ssize_t bytes_received;
+    int32_t client_fd;
+
+    request = "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    request_length = ft_strlen_size_t(request);
+    client_fd = efficiency_http_connect(port);
+    if (client_fd < 0)
+    {
+        *client_ok = false;
+        return ;
+    }
+    index = 0;
+    while (index < request_count)
+    {
+        auto start = clock_type::now();
+        if (nw_send(client_fd, request, request_length, 0)
+            != static_cast<ssize_t>(request_length))
+        {
+            *client_ok = false;
+            break ;
+        }
+        bytes_received = nw_recv(client_fd, buffer, sizeof(buffer), 0);
+        if (bytes_received <= 0)
+        {
+            *client_ok = false;
+            break ;
+        }
+        auto end = clock_type::now();
+        latencies->push_back(time_high_resolution_diff_ns(start, end));
+        index++;
+    }
+    (void)nw_close(client_fd);
+    return ;
+}
+
+int test_efficiency_http_server_event_driven(void)
+{
+    const size_t client_count = 32;
+    const size_t requests_per_client = 2000;
+    ft_http_server server;
+    std::vector<std::thread> clients;
+    std::vector<std::vector<int64_t> > latencies(client_count);
+    std::vector<int64_t> all_latencies;
+    bool client_ok[client_count];
+    size_t index;
+
+    if (server.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    if (server.start_event_driven("127.0.0.1", 0, 4) != FT_ERR_SUCCESS)
+    {
+        (void)server.destroy();
+        return (0);
+    }
+    auto start = clock_type::now();
+    index = 0;
+    while (index < client_count)
+    {
+        client_ok[index] = true;
+        latencies[index].reserve(requests_per_client);
+        clients.emplace_back(efficiency_http_client, server.get_port(),
+            requests_per_client, &latencies[index], &client_ok[index]);
+        index++;
+    }
+    index = 0;
+    while (index < client_count)
+    {
+        clients[index].join();
+        index++;
+    }
+    auto end = clock_type::now();
+    (void)server.destroy();
+    index = 0;
+    while (index < client_count)
+    {
+        if (client_ok[index] == false)
+            return (0);
+        all_latencies.insert(all_latencies.end(), latencies[index].begin(),
+            latencies[index].end());
+        index++;
+    }
+    if (all_latencies.empty())
+        return (0);
+    std::sort(all_latencies.begin(), all_latencies.end());
+    int64_t elapsed = elapsed_us(start, end);
+    double requests_per_second;
+    if (elapsed > 0)
+        requests_per_second = static_cast<double>(all_latencies.size())
+            * 1000000.0 / static_cast<double>(elapsed);
+    else
+        requests_per_second = 0.0;
+    printf("http server event driven: %.0f req/s, p50 " FT_INT64_DECIMAL_FORMAT
+        " us, p99 " FT_INT64_DECIMAL_FORMAT " us\n", requests_per_second,
+        all_latencies[all_latencies.size() / 2] / 1000,
+        all_latencies[all_latencies.size() * 99 / 100] / 1000);
+    return (1);
+}
@@ -0,0 +1,319 @@
+#include "../test_internal.hpp"
+#include "../../Modules/JSon/json.hpp"
+#include "../../Modules/JSon/json_stream_reader.hpp"
+#include "../../Modules/JSon/json_structural_index.hpp"
+#include "../../Modules/JSon/json_arena.hpp"
+#include "../../Modules/JSon/json_cursor.hpp"
+#include "../../Modules/CPP_class/class_string.hpp"
+#include "utils.hpp"
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+#include <cstdio>
+
+typedef struct efficiency_json_memory_source
+{
+    const char *content;
+    ft_size_t length;
+    ft_size_t offset;
+} efficiency_json_memory_source;
+
+static ft_size_t efficiency_json_memory_read(void *user_data, char *buffer, ft_size_t max_size)
+{
+    efficiency_json_memory_source *source;
+    ft_size_t chunk;
+
+    source = static_cast<efficiency_json_memory_source *>(user_data);
+    chunk = source->length - source->offset;
+    if (chunk > max_size)
+        chunk = max_size;
+    ft_memcpy(buffer, source->content + source->offset, chunk);
+    source->offset += chunk;
+    return (chunk);
+}
+
+static int32_t efficiency_json_count_event(void *user_data, const json_stream_event *event)
+{
+    (void)event;
+    (*static_cast<ft_size_t *>(user_data))++;
+    return (FT_ERR_SUCCESS);
+}
+
+static int efficiency_json_build_records(ft_string &content, ft_size_t target_size)
+{
+    char record[256];
+    size_t index;
+
+    if (content.initialize("[") != FT_ERR_SUCCESS)
+        return (0);
+    index = 0;
+    while (content.size() < target_size)
+    {
+        if (std::snprintf(record, sizeof(record),
+                "%s\n  {\"id\": %zu, \"user\": \"player_%zu\", \"title\": \"caf\xc3\xa9 \\\"quoted\\\" %zu\","
+                " \"score\": %zu.%02zu, \"active\": %s, \"tags\": [\"a\", \"b\", null],"
+                " \"pos\": {\"x\": -%zu, \"y\": %zue3}}",
+                index == 0 ? "" : ",", index, index % 977, index, index * 7, index % 100,
+                index % 3 == 0 ? "true" : "false", index % 4096, index % 50) <= 0)
+            return (0);
+        if (content.append(record) != FT_ERR_SUCCESS)
+            return (0);
+        index++;
+    }
+    return (content.append("\n]\n") == FT_ERR_SUCCESS);
+}
+
+static int efficiency_json_build_config(ft_string &content, ft_size_t target_size)
+{
+    char entry[192];
+    size_t group;
+    size_t item;
+
+    if (content.initialize("{") != FT_ERR_SUCCESS)
+        return (0);
+    group = 0;
+    while (content.size() < target_size)
+    {
+        if (std::snprintf(entry, sizeof(entry), "%s\n  \"section_%zu\": {",
+                group == 0 ? "" : ",", group) <= 0 || content.append(entry) != FT_ERR_SUCCESS)
+            return (0);
+        item = 0;
+        while (item < 16)
+        {
+            if (std::snprintf(entry, sizeof(entry),
+                    "%s\n    \"key_%zu\": \"value with \\\"escapes\\\" %zu\", \"n_%zu\": %zu.5",
+                    item == 0 ? "" : ",", item, group, item, group * item) <= 0
+                || content.append(entry) != FT_ERR_SUCCESS)
+                return (0);
+            item++;
+        }
+        if (content.append("\n  }") != FT_ERR_SUCCESS)
+            return (0);
+        group++;
+    }
+    return (content.append("\n}\n") == FT_ERR_SUCCESS);
+}
+
+static void efficiency_json_print_rate(const char *name, ft_size_t bytes, int64_t time_us)
+{
+    double megabytes_per_second;
+
+    megabytes_per_second = 0.0;
+    if (time_us > 0)
+        megabytes_per_second = static_cast<double>(bytes) / static_cast<double>(time_us);
+    printf("%s: %.1f MB/s\n", name, megabytes_per_second);
+    return ;
+}
+
+static int64_t efficiency_json_index_time(const ft_string &content,
+    json_structural_backend backend, size_t iterations)
+{
+    json_structural_index index;
+    size_t iteration;
+
+    if (json_structural_set_backend(backend) != FT_ERR_SUCCESS)
+        return (-1);
+    json_structural_index_init(&index);
+    auto start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        if (json_structural_index_build(&index, content.c_str(), content.size())
+            != FT_ERR_SUCCESS)
+        {
+            json_structural_index_destroy(&index);
+            return (-1);
+        }
+        prevent_optimization(index.positions);
+        iteration++;
+    }
+    auto end = clock_type::now();
+    json_structural_index_destroy(&index);
+    return (elapsed_us(start, end));
+}
+
+int test_efficiency_json_structural_index(void)
+{
+    const size_t iterations = 10;
+    ft_string content;
+    int64_t scalar_time;
+    int64_t vector_time;
+
+    if (!efficiency_json_build_records(content, 8 * 1024 * 1024))
+        return (0);
+    scalar_time = efficiency_json_index_time(content, JSON_STRUCTURAL_BACKEND_SCALAR,
+            iterations);
+    vector_time = efficiency_json_index_time(content, JSON_STRUCTURAL_BACKEND_AUTO,
+            iterations);
+    if (scalar_time < 0 || vector_time < 0)
+        return (0);
+    print_comparison("json structural index scalar vs auto", scalar_time, vector_time);
+    efficiency_json_print_rate("json structural index scalar",
+        content.size() * iterations, scalar_time);
+    efficiency_json_print_rate("json structural index auto",
+        content.size() * iterations, vector_time);
+    return (1);
+}
+
+int test_efficiency_json_parse_events(void)
+{
+    const size_t iterations = 5;
+    ft_string content;
+    efficiency_json_memory_source source;
+    ft_size_t stream_events;
+    ft_size_t indexed_events;
+    size_t iteration;
+
+    if (!efficiency_json_build_records(content, 8 * 1024 * 1024))
+        return (0);
+    stream_events = 0;
+    indexed_events = 0;
+    auto stream_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        source.content = content.c_str();
+        source.length = content.size();
+        source.offset = 0;
+        if (json_stream_read_from_stream_events(efficiency_json_memory_read, &source,
+                65536, efficiency_json_count_event, &stream_events) != FT_ERR_SUCCESS)
+            return (0);
+        iteration++;
+    }
+    auto stream_end = clock_type::now();
+    auto indexed_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        if (json_structural_read_events(content.c_str(), content.size(),
+                efficiency_json_count_event, &indexed_events) != FT_ERR_SUCCESS)
+            return (0);
+        iteration++;
+    }
+    auto indexed_end = clock_type::now();
+    print_comparison("json events stream reader vs structural index",
+        elapsed_us(stream_start, stream_end), elapsed_us(indexed_start, indexed_end));
+    efficiency_json_print_rate("json events structural index",
+        content.size() * iterations, elapsed_us(indexed_start, indexed_end));
+    return (stream_events == indexed_events);
+}
+
+int test_efficiency_json_read_groups(void)
+{
+    const size_t iterations = 3;
+    ft_string content;
+    efficiency_json_memory_source source;
+    json_arena_document arena;
+    json_group *groups;
+    size_t iteration;
+
+    if (!efficiency_json_build_config(content, 1024 * 1024))
+        return (0);
+    auto stream_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        source.content = content.c_str();
+        source.length = content.size();
+        source.offset = 0;
+        groups = json_read_from_stream(efficiency_json_memory_read, &source, 65536);
+        if (groups == ft_nullptr)
+            return (0);
+        json_free_groups(groups);
+        iteration++;
+    }
+    auto stream_end = clock_type::now();
+    auto indexed_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        groups = json_read_from_string(content.c_str());
+        if (groups == ft_nullptr)
+            return (0);
+        json_free_groups(groups);
+        iteration++;
+    }
+    auto indexed_end = clock_type::now();
+    print_comparison("json groups stream reader vs structural index",
+        elapsed_us(stream_start, stream_end), elapsed_us(indexed_start, indexed_end));
+    if (arena.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    auto arena_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        if (arena.parse(content.c_str(), content.size()) != FT_ERR_SUCCESS)
+            return (0);
+        iteration++;
+    }
+    auto arena_end = clock_type::now();
+    efficiency_json_print_rate("json groups structural index",
+        content.size() * iterations, elapsed_us(indexed_start, indexed_end));
+    efficiency_json_print_rate("json arena document",
+        content.size() * iterations, elapsed_us(arena_start, arena_end));
+    return (1);
+}
+
+int test_efficiency_json_cursor_fields(void)
+{
+    const size_t iterations = 5;
+    const char *pointers[3] = {"/30000/title", "/30000/score", "/30000/pos/x"};
+    ft_string content;
+    json_arena_document arena;
+    json_cursor_document document;
+    json_cursor value;
+    json_cursor_view view;
+    ft_size_t arena_length;
+    ft_size_t cursor_length;
+    size_t iteration;
+    size_t field;
+
+    if (!efficiency_json_build_records(content, 8 * 1024 * 1024))
+        return (0);
+    if (arena.initialize() != FT_ERR_SUCCESS || document.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    arena_length = 0;
+    cursor_length = 0;
+    auto arena_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        if (arena.parse(content.c_str(), content.size()) != FT_ERR_SUCCESS)
+            return (0);
+        field = 0;
+        while (field < 3)
+        {
+            if (json_arena_find_by_pointer(arena.root(), pointers[field]) == ft_nullptr)
+                return (0);
+            arena_length++;
+            field++;
+        }
+        iteration++;
+    }
+    auto arena_end = clock_type::now();
+    auto cursor_start = clock_type::now();
+    iteration = 0;
+    while (iteration < iterations)
+    {
+        if (document.open(content.c_str(), content.size()) != FT_ERR_SUCCESS)
+            return (0);
+        field = 0;
+        while (field < 3)
+        {
+            if (document.find(pointers[field], &value) != FT_ERR_SUCCESS
+                || json_cursor_get_raw(&value, &view) != FT_ERR_SUCCESS)
+                return (0);
+            prevent_optimization(view.data);
+            cursor_length++;
+            field++;
+        }
+        iteration++;
+    }
+    auto cursor_end = clock_type::now();
+    print_comparison("json three fields arena document vs lazy cursor",
+        elapsed_us(arena_start, arena_end), elapsed_us(cursor_start, cursor_end));
+    efficiency_json_print_rate("json three fields lazy cursor",
+        content.size() * iterations, elapsed_us(cursor_start, cursor_end));
+    return (arena_length == cursor_length);
+}
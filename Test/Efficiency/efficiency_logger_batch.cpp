@@ -0,0 +1,60 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Logger/logger.hpp"
+#include "utils.hpp"
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+#include <unistd.h>
+
+static int64_t efficiency_logger_batch_run(const char *path, ft_size_t max_bytes,
+    size_t iterations, ft_size_t *syscall_count)
+{
+    ft_size_t record_count;
+
+    ft_log_close();
+    if (ft_log_set_file(path, 0) != 0)
+        return (-1);
+    ft_log_set_batching(max_bytes, 0);
+    ft_log_reset_write_statistics();
+    auto start = clock_type::now();
+    for (size_t i = 0; i < iterations; ++i)
+        ft_log_info("efficiency batch record %zu value=%d", i, static_cast<int>(i * 3));
+    (void)ft_log_flush();
+    auto end = clock_type::now();
+    (void)ft_log_get_write_statistics(&record_count, syscall_count);
+    ft_log_close();
+    return (elapsed_us(start, end));
+}
+
+int test_efficiency_logger_batch_file_sink(void)
+{
+    const size_t iterations = 20000;
+    char template_path[256];
+    ft_size_t unbatched_syscalls;
+    ft_size_t batched_syscalls;
+    int64_t unbatched_time;
+    int64_t batched_time;
+    int temp_fd;
+
+    temp_fd = test_create_temp_file_from_template(template_path,
+            sizeof(template_path), ft_nullptr);
+    if (temp_fd < 0)
+        return (0);
+    close(temp_fd);
+    unbatched_syscalls = 0;
+    batched_syscalls = 0;
+    unbatched_time = efficiency_logger_batch_run(template_path, 0, iterations,
+            &unbatched_syscalls);
+    batched_time = efficiency_logger_batch_run(template_path, 65536, iterations,
+            &batched_syscalls);
+    unlink(template_path);
+    if (unbatched_time < 0 || batched_time < 0)
+        return (0);
+    print_comparison("logger file sink unbatched vs batched", unbatched_time,
+        batched_time);
+    printf("logger file sink syscalls/message unbatched: %.4f batched: %.4f\n",
+        static_cast<double>(unbatched_syscalls) / static_cast<double>(iterations),
+        static_cast<double>(batched_syscalls) / static_cast<double>(iterations));
+    return (batched_syscalls < unbatched_syscalls);
+}
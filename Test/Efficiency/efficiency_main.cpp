@@ -46,10 +46,21 @@ int test_efficiency_cma_memdup(void);
 int test_efficiency_cma_realloc(void);
 int test_efficiency_cma_strdup(void);
 int test_efficiency_exp(void);
+int test_efficiency_game_pathfinding_astar(void);
+int test_efficiency_game_pathfinding_hierarchy(void);
+int test_efficiency_game_pathfinding_flow_field(void);
+int test_efficiency_game_pathfinding_batch(void);
+int test_efficiency_game_pathfinding_graph(void);
+int test_efficiency_http_server_event_driven(void);
 int test_efficiency_isalnum(void);
 int test_efficiency_isalpha(void);
 int test_efficiency_isdigit(void);
 int test_efficiency_isspace(void);
+int test_efficiency_json_structural_index(void);
+int test_efficiency_json_parse_events(void);
+int test_efficiency_json_read_groups(void);
+int test_efficiency_json_cursor_fields(void);
+int test_efficiency_logger_batch_file_sink(void);
 int test_efficiency_map_insert_find(void);
 int test_efficiency_map_insert_remove(void);
 int test_efficiency_map_iterate(void);
@@ -103,6 +114,7 @@ int test_efficiency_unordered_map_insert_erase(void);
 int test_efficiency_unordered_map_iterate(void);
 int test_efficiency_unordered_map_copy(void);
 int test_efficiency_unordered_map_move(void);
+int test_efficiency_unordered_map_open_addressing(void);
 int test_efficiency_unordered_map_clear(void);
 int test_efficiency_unordered_map_swap(void);
 int test_efficiency_vector_push_back(void);
@@ -112,6 +124,7 @@ int test_efficiency_vector_clear(void);
 int test_efficiency_vector_iterate(void);
 int test_efficiency_vector_move(void);
 int test_efficiency_vector_swap(void);
+int test_efficiency_voxel_pipeline(void);
 
 static const s_efficiency_test_case g_efficiency_tests[] =
 {
@@ -126,10 +139,21 @@ static const s_efficiency_test_case g_efficiency_tests[] =
     {&test_efficiency_cma_realloc, "test_efficiency_cma_realloc"},
     {&test_efficiency_cma_strdup, "test_efficiency_cma_strdup"},
     {&test_efficiency_exp, "test_efficiency_exp"},
+    {&test_efficiency_game_pathfinding_astar, "test_efficiency_game_pathfinding_astar"},
+    {&test_efficiency_game_pathfinding_hierarchy, "test_efficiency_game_pathfinding_hierarchy"},
+    {&test_efficiency_game_pathfinding_flow_field, "test_efficiency_game_pathfinding_flow_field"},
+    {&test_efficiency_game_pathfinding_batch, "test_efficiency_game_pathfinding_batch"},
+    {&test_efficiency_game_pathfinding_graph, "test_efficiency_game_pathfinding_graph"},
+    {&test_efficiency_http_server_event_driven, "test_efficiency_http_server_event_driven"},
     {&test_efficiency_isalnum, "test_efficiency_isalnum"},
     {&test_efficiency_isalpha, "test_efficiency_isalpha"},
     {&test_efficiency_isdigit, "test_efficiency_isdigit"},
     {&test_efficiency_isspace, "test_efficiency_isspace"},
+    {&test_efficiency_json_structural_index, "test_efficiency_json_structural_index"},
+    {&test_efficiency_json_parse_events, "test_efficiency_json_parse_events"},
+    {&test_efficiency_json_read_groups, "test_efficiency_json_read_groups"},
+    {&test_efficiency_json_cursor_fields, "test_efficiency_json_cursor_fields"},
+    {&test_efficiency_logger_batch_file_sink, "test_efficiency_logger_batch_file_sink"},
     {&test_efficiency_map_insert_find, "test_efficiency_map_insert_find"},
     {&test_efficiency_map_insert_remove, "test_efficiency_map_insert_remove"},
     {&test_efficiency_map_iterate, "test_efficiency_map_iterate"},
@@ -183,6 +207,7 @@ static const s_efficiency_test_case g_efficiency_tests[] =
     {&test_efficiency_unordered_map_iterate, "test_efficiency_unordered_map_iterate"},
     {&test_efficiency_unordered_map_copy, "test_efficiency_unordered_map_copy"},
     {&test_efficiency_unordered_map_move, "test_efficiency_unordered_map_move"},
+    {&test_efficiency_unordered_map_open_addressing, "test_efficiency_unordered_map_open_addressing"},
     {&test_efficiency_unordered_map_clear, "test_efficiency_unordered_map_clear"},
     {&test_efficiency_unordered_map_swap, "test_efficiency_unordered_map_swap"},
     {&test_efficiency_vector_push_back, "test_efficiency_vector_push_back"},
@@ -191,7 +216,8 @@ static const s_efficiency_test_case g_efficiency_tests[] =
     {&test_efficiency_vector_clear, "test_efficiency_vector_clear"},
     {&test_efficiency_vector_iterate, "test_efficiency_vector_iterate"},
     {&test_efficiency_vector_move, "test_efficiency_vector_move"},
-    {&test_efficiency_vector_swap, "test_efficiency_vector_swap"}
+    {&test_efficiency_vector_swap, "test_efficiency_vector_swap"},
+    {&test_efficiency_voxel_pipeline, "test_efficiency_voxel_pipeline"}
 };
 
 static const char *get_name_filter(void)
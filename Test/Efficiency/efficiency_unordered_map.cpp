@@ -6,6 +6,7 @@
 #ifndef LIBFT_TEST_BUILD
 #endif
 
+#include <functional>
 #include <unordered_map>
 #include <utility>
 
@@ -329,3 +330,292 @@ int test_efficiency_unordered_map_swap(void)
         return (1);
     return (0);
 }
+
+struct efficiency_linear_probe_map
+{
+    ft_pair<int, int>   *data;
+    ft_bool             *occupied;
+    ft_size_t           capacity;
+    ft_size_t           size;
+};
+
+static void linear_probe_initialize(efficiency_linear_probe_map &map_reference,
+    ft_size_t capacity)
+{
+    map_reference.data = new ft_pair<int, int>[capacity];
+    map_reference.occupied = new ft_bool[capacity]();
+    map_reference.capacity = capacity;
+    map_reference.size = 0;
+    return ;
+}
+
+static void linear_probe_destroy(efficiency_linear_probe_map &map_reference)
+{
+    delete[] map_reference.data;
+    delete[] map_reference.occupied;
+    map_reference.data = ft_nullptr;
+    map_reference.occupied = ft_nullptr;
+    return ;
+}
+
+static ft_size_t linear_probe_find(const efficiency_linear_probe_map &map_reference,
+    int key)
+{
+    std::hash<int> hasher;
+    ft_size_t start_index;
+    ft_size_t current_index;
+
+    start_index = hasher(key) % map_reference.capacity;
+    current_index = start_index;
+    while (map_reference.occupied[current_index])
+    {
+        if (map_reference.data[current_index].first == key)
+            return (current_index);
+        current_index = (current_index + 1) % map_reference.capacity;
+        if (current_index == start_index)
+            break ;
+    }
+    return (map_reference.capacity);
+}
+
+static void linear_probe_place(efficiency_linear_probe_map &map_reference,
+    int key, int value)
+{
+    std::hash<int> hasher;
+    ft_size_t index;
+
+    index = hasher(key) % map_reference.capacity;
+    while (map_reference.occupied[index])
+        index = (index + 1) % map_reference.capacity;
+    map_reference.data[index].first = key;
+    map_reference.data[index].second = value;
+    map_reference.occupied[index] = FT_TRUE;
+    map_reference.size += 1;
+    return ;
+}
+
+static void linear_probe_insert(efficiency_linear_probe_map &map_reference,
+    int key, int value)
+{
+    ft_size_t index;
+
+    index = linear_probe_find(map_reference, key);
+    if (index != map_reference.capacity)
+    {
+        map_reference.data[index].second = value;
+        return ;
+    }
+    if (map_reference.size * 2 >= map_reference.capacity)
+    {
+        efficiency_linear_probe_map grown_map;
+
+        linear_probe_initialize(grown_map, map_reference.capacity * 2);
+        index = 0;
+        while (index < map_reference.capacity)
+        {
+            if (map_reference.occupied[index])
+                linear_probe_place(grown_map, map_reference.data[index].first,
+                    map_reference.data[index].second);
+            index++;
+        }
+        linear_probe_destroy(map_reference);
+        map_reference = grown_map;
+    }
+    linear_probe_place(map_reference, key, value);
+    return ;
+}
+
+static void linear_probe_erase(efficiency_linear_probe_map &map_reference, int key)
+{
+    ft_size_t index;
+    ft_size_t next_index;
+    ft_pair<int, int> moving_pair;
+
+    index = linear_probe_find(map_reference, key);
+    if (index == map_reference.capacity)
+        return ;
+    map_reference.occupied[index] = FT_FALSE;
+    map_reference.size -= 1;
+    next_index = (index + 1) % map_reference.capacity;
+    while (map_reference.occupied[next_index])
+    {
+        moving_pair = map_reference.data[next_index];
+        map_reference.occupied[next_index] = FT_FALSE;
+        map_reference.size -= 1;
+        linear_probe_place(map_reference, moving_pair.first, moving_pair.second);
+        next_index = (next_index + 1) % map_reference.capacity;
+    }
+    return ;
+}
+
+static int efficiency_open_addressing_key(int index, int stride)
+{
+    uint32_t mixed;
+
+    if (stride != 0)
+        return (index * stride);
+    mixed = static_cast<uint32_t>(index) * 2654435761U;
+    return (static_cast<int>(mixed >> 1));
+}
+
+static void print_open_addressing_row(const char *label, const char *phase,
+    int64_t std_time, int64_t legacy_time, int64_t ft_time)
+{
+    printf("unordered_map %s %-10s std: " FT_INT64_DECIMAL_FORMAT " us, linear probe: "
+        FT_INT64_DECIMAL_FORMAT " us, ft: " FT_INT64_DECIMAL_FORMAT " us\n",
+        label, phase, std_time, legacy_time, ft_time);
+    return ;
+}
+
+static int efficiency_open_addressing_round(const char *label, int elements, int stride)
+{
+    std::unordered_map<int, int> std_map;
+    efficiency_linear_probe_map legacy_map;
+    ft_unordered_map<int, int> ft_map;
+    int64_t std_times[4];
+    int64_t legacy_times[4];
+    int64_t ft_times[4];
+    ft_size_t legacy_index;
+    long long sum;
+    int index;
+
+    if (ft_map.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    if (ft_map.disable_thread_safety() != FT_ERR_SUCCESS)
+        return (0);
+    linear_probe_initialize(legacy_map, 10);
+    sum = 0;
+
+    auto start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        std_map.insert(std::make_pair(efficiency_open_addressing_key(index, stride), index));
+        index++;
+    }
+    std_times[0] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        linear_probe_insert(legacy_map, efficiency_open_addressing_key(index, stride), index);
+        index++;
+    }
+    legacy_times[0] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        ft_map.insert(efficiency_open_addressing_key(index, stride), index);
+        index++;
+    }
+    ft_times[0] = elapsed_us(start, clock_type::now());
+
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        std::unordered_map<int, int>::iterator iterator_std
+            = std_map.find(efficiency_open_addressing_key(index, stride));
+        if (iterator_std != std_map.end())
+            sum += iterator_std->second;
+        index++;
+    }
+    std_times[1] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        legacy_index = linear_probe_find(legacy_map,
+                efficiency_open_addressing_key(index, stride));
+        if (legacy_index != legacy_map.capacity)
+            sum += legacy_map.data[legacy_index].second;
+        index++;
+    }
+    legacy_times[1] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        sum += ft_map.at(efficiency_open_addressing_key(index, stride));
+        index++;
+    }
+    ft_times[1] = elapsed_us(start, clock_type::now());
+
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        if (std_map.find(efficiency_open_addressing_key(index + elements, stride))
+            != std_map.end())
+            sum += 1;
+        index++;
+    }
+    std_times[2] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        if (linear_probe_find(legacy_map,
+                efficiency_open_addressing_key(index + elements, stride))
+            != legacy_map.capacity)
+            sum += 1;
+        index++;
+    }
+    legacy_times[2] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        (void)ft_map.at(efficiency_open_addressing_key(index + elements, stride));
+        if (ft_map.get_error() == FT_ERR_SUCCESS)
+            sum += 1;
+        index++;
+    }
+    ft_times[2] = elapsed_us(start, clock_type::now());
+
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        std_map.erase(efficiency_open_addressing_key(index, stride));
+        index++;
+    }
+    std_times[3] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        linear_probe_erase(legacy_map, efficiency_open_addressing_key(index, stride));
+        index++;
+    }
+    legacy_times[3] = elapsed_us(start, clock_type::now());
+    start = clock_type::now();
+    index = 0;
+    while (index < elements)
+    {
+        ft_map.erase(efficiency_open_addressing_key(index, stride));
+        index++;
+    }
+    ft_times[3] = elapsed_us(start, clock_type::now());
+
+    prevent_optimization((void*)&sum);
+    print_open_addressing_row(label, "insert", std_times[0], legacy_times[0], ft_times[0]);
+    print_open_addressing_row(label, "find hit", std_times[1], legacy_times[1], ft_times[1]);
+    print_open_addressing_row(label, "find miss", std_times[2], legacy_times[2], ft_times[2]);
+    print_open_addressing_row(label, "erase", std_times[3], legacy_times[3], ft_times[3]);
+    index = static_cast<int>(legacy_map.size);
+    linear_probe_destroy(legacy_map);
+    if (std_map.empty() && ft_map.empty() && index == 0)
+        return (1);
+    return (0);
+}
+
+int test_efficiency_unordered_map_open_addressing(void)
+{
+    if (efficiency_open_addressing_round("scrambled", 200000, 0) == 0)
+        return (0);
+    if (efficiency_open_addressing_round("stride 64", 50000, 64) == 0)
+        return (0);
+    return (1);
+}
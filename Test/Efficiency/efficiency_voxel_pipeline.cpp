@@ -0,0 +1,140 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Voxel/voxel_pipeline.hpp"
+#include "../../Modules/Threading/thread_pool.hpp"
+#include "utils.hpp"
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+#ifdef GAME_USE_VOXEL_REGION_BACKEND
+
+#define EFFICIENCY_VOXEL_VIEW_RADIUS 3
+#define EFFICIENCY_VOXEL_SERIAL_SIDE (2 * (EFFICIENCY_VOXEL_VIEW_RADIUS + 1) + 1)
+
+typedef struct efficiency_voxel_grid
+{
+    game_voxel_chunk    *chunks;
+    int32_t             origin;
+    int32_t             side;
+} efficiency_voxel_grid;
+
+static int32_t efficiency_voxel_floor_div(int32_t value)
+{
+    if (value >= 0)
+        return (value / GAME_VOXEL_CHUNK_WIDTH);
+    return (-((-value + GAME_VOXEL_CHUNK_WIDTH - 1) / GAME_VOXEL_CHUNK_WIDTH));
+}
+
+static int32_t efficiency_voxel_lookup(void *user_data, int32_t world_x,
+    int32_t world_y, int32_t world_z, uint32_t *block_id)
+{
+    efficiency_voxel_grid *grid;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t index;
+
+    grid = static_cast<efficiency_voxel_grid *>(user_data);
+    chunk_x = efficiency_voxel_floor_div(world_x);
+    chunk_z = efficiency_voxel_floor_div(world_z);
+    if (chunk_x < grid->origin || chunk_x >= grid->origin + grid->side
+        || chunk_z < grid->origin || chunk_z >= grid->origin + grid->side)
+    {
+        *block_id = GAME_VOXEL_AIR_BLOCK;
+        return (FT_ERR_SUCCESS);
+    }
+    index = (chunk_z - grid->origin) * grid->side + (chunk_x - grid->origin);
+    return (grid->chunks[index].read_block(world_x - chunk_x * GAME_VOXEL_CHUNK_WIDTH,
+            world_y, world_z - chunk_z * GAME_VOXEL_CHUNK_DEPTH, block_id));
+}
+
+int test_efficiency_voxel_pipeline(void)
+{
+    const int32_t radius = EFFICIENCY_VOXEL_VIEW_RADIUS;
+    const int32_t side = EFFICIENCY_VOXEL_SERIAL_SIDE;
+    game_voxel_chunk serial_chunks[EFFICIENCY_VOXEL_SERIAL_SIDE
+        * EFFICIENCY_VOXEL_SERIAL_SIDE];
+    efficiency_voxel_grid grid;
+    terrain_generation_config config;
+    terrain_generation_context context;
+    chunk_pipeline pipeline;
+    ft_thread_pool pool(4, 0);
+    chunk_mesh mesh;
+    int64_t serial_first_us;
+    int64_t pipeline_first_us;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t index;
+
+    if (terrain_default_generation_config(config) != FT_ERR_SUCCESS
+        || terrain_generation_context_initialize(context, config) != FT_ERR_SUCCESS
+        || chunk_mesh_initialize(mesh) != FT_ERR_SUCCESS
+        || pool.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    grid.chunks = serial_chunks;
+    grid.origin = -(radius + 1);
+    grid.side = side;
+    serial_first_us = -1;
+    auto serial_start = clock_type::now();
+    index = 0;
+    while (index < side * side)
+    {
+        if (serial_chunks[index].initialize() != FT_ERR_SUCCESS
+            || terrain_generate_chunk_with_context(serial_chunks[index],
+                (grid.origin + index % side) * GAME_VOXEL_CHUNK_WIDTH,
+                (grid.origin + index / side) * GAME_VOXEL_CHUNK_DEPTH,
+                "efficiency-seed", context) != FT_ERR_SUCCESS)
+            return (0);
+        index++;
+    }
+    chunk_z = -radius;
+    while (chunk_z <= radius)
+    {
+        chunk_x = -radius;
+        while (chunk_x <= radius)
+        {
+            index = (chunk_z - grid.origin) * side + (chunk_x - grid.origin);
+            if (chunk_mesh_generate_from_chunk_with_neighbors(mesh,
+                    serial_chunks[index], chunk_x, chunk_z,
+                    &efficiency_voxel_lookup, &grid) != FT_ERR_SUCCESS)
+                return (0);
+            prevent_optimization(&mesh);
+            if (chunk_x == 0 && chunk_z == 0)
+                serial_first_us = elapsed_us(serial_start, clock_type::now());
+            chunk_x++;
+        }
+        chunk_z++;
+    }
+    auto serial_end = clock_type::now();
+    pipeline_first_us = -1;
+    auto pipeline_start = clock_type::now();
+    if (pipeline.initialize(context, "efficiency-seed", &pool,
+            static_cast<uint32_t>(radius), 4U) != FT_ERR_SUCCESS
+        || pipeline.set_center(0, 0) != FT_ERR_SUCCESS)
+        return (0);
+    while (pipeline.get_stage(0, 0) != CHUNK_PIPELINE_STAGE_MESHED)
+    {
+        if (pipeline.pump(1U) != FT_ERR_SUCCESS)
+            return (0);
+    }
+    pipeline_first_us = elapsed_us(pipeline_start, clock_type::now());
+    if (pipeline.wait_idle() != FT_ERR_SUCCESS)
+        return (0);
+    auto pipeline_end = clock_type::now();
+    if (pipeline.destroy() != FT_ERR_SUCCESS || pool.destroy() != FT_ERR_SUCCESS)
+        return (0);
+    (void)chunk_mesh_destroy(mesh);
+    print_comparison("voxel view radius 3: center mesh ready, serial generate+mesh vs pipeline",
+        serial_first_us, pipeline_first_us);
+    print_comparison("voxel view radius 3: full view, serial generate+mesh vs pipeline",
+        elapsed_us(serial_start, serial_end), elapsed_us(pipeline_start, pipeline_end));
+    return (1);
+}
+
+#else
+
+int test_efficiency_voxel_pipeline(void)
+{
+    return (1);
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "../test_internal.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/CMA/cma_arena_scope.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#include "../../Modules/Basic/limits.hpp"
+#include <cstdint>
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_cma_arena_create_rejects_invalid_arguments)
+{
+    cma_arena *arena;
+
+    arena = reinterpret_cast<cma_arena *>(&arena);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, cma_arena_create(0, &arena));
+    FT_ASSERT_EQ(ft_nullptr, arena);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, cma_arena_create(64, ft_nullptr));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, cma_arena_destroy(ft_nullptr));
+    return (1);
+}
+
+FT_TEST(test_cma_arena_mark_and_rewind_reuse_space)
+{
+    cma_arena *arena;
+    void *first_pointer;
+    void *second_pointer;
+    void *aligned_pointer;
+    ft_size_t mark;
+
+    arena = ft_nullptr;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_create(4096, &arena));
+    FT_ASSERT_EQ(4096, cma_arena_capacity(arena));
+    first_pointer = cma_arena_alloc(arena, 100);
+    FT_ASSERT(first_pointer != ft_nullptr);
+    mark = cma_arena_mark(arena);
+    second_pointer = cma_arena_alloc(arena, 200);
+    FT_ASSERT(second_pointer != ft_nullptr);
+    FT_ASSERT(cma_arena_mark(arena) > mark);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_rewind(arena, mark));
+    FT_ASSERT_EQ(mark, cma_arena_mark(arena));
+    FT_ASSERT(cma_arena_alloc(arena, 200) == second_pointer);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT,
+        cma_arena_rewind(arena, cma_arena_capacity(arena) + 1));
+    aligned_pointer = cma_arena_aligned_alloc(arena, 256, 32);
+    FT_ASSERT(aligned_pointer != ft_nullptr);
+    FT_ASSERT_EQ(0, reinterpret_cast<uintptr_t>(aligned_pointer) % 256);
+    FT_ASSERT_EQ(ft_nullptr, cma_arena_alloc(arena, 8192));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_reset(arena));
+    FT_ASSERT_EQ(0, cma_arena_mark(arena));
+    FT_ASSERT(cma_arena_alloc(arena, 100) == first_pointer);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_destroy(arena));
+    return (1);
+}
+
+FT_TEST(test_cma_arena_scope_redirects_cma_malloc)
+{
+    cma_arena *arena;
+    char *scoped_pointer;
+    char *grown_pointer;
+    void *heap_pointer;
+    ft_size_t allocation_count_before;
+    ft_size_t allocation_count_after;
+
+    arena = ft_nullptr;
+    cma_set_alloc_limit(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_create(4096, &arena));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocation_count_before,
+            ft_nullptr));
+    {
+        ft_arena_scope scope(arena);
+
+        FT_ASSERT_EQ(FT_TRUE, scope.is_active());
+        FT_ASSERT(cma_arena_thread_scope() == arena);
+        FT_ASSERT_EQ(FT_ERR_INVALID_STATE, cma_arena_destroy(arena));
+        scoped_pointer = static_cast<char *>(cma_malloc(24));
+        FT_ASSERT(scoped_pointer != ft_nullptr);
+        FT_ASSERT_EQ(24, cma_alloc_size(scoped_pointer));
+        ft_memcpy(scoped_pointer, "arena", 6);
+        grown_pointer = static_cast<char *>(cma_realloc(scoped_pointer, 48));
+        FT_ASSERT(grown_pointer == scoped_pointer);
+        FT_ASSERT_EQ(0, ft_strcmp(grown_pointer, "arena"));
+        FT_ASSERT_EQ(48, cma_alloc_size(grown_pointer));
+        cma_free(grown_pointer);
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_checked_free(grown_pointer));
+        FT_ASSERT(cma_arena_mark(arena) > 0);
+        heap_pointer = cma_malloc(8192);
+        FT_ASSERT(heap_pointer != ft_nullptr);
+        FT_ASSERT_EQ(8192, cma_alloc_size(heap_pointer));
+    }
+    FT_ASSERT(cma_arena_thread_scope() == ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocation_count_after,
+            ft_nullptr));
+    FT_ASSERT_EQ(allocation_count_before + 1, allocation_count_after);
+    cma_free(heap_pointer);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_destroy(arena));
+    return (1);
+}
+
+FT_TEST(test_cma_arena_scope_nests_and_restores_previous)
+{
+    cma_arena *outer_arena;
+    cma_arena *inner_arena;
+
+    outer_arena = ft_nullptr;
+    inner_arena = ft_nullptr;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_create(1024, &outer_arena));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_create(1024, &inner_arena));
+    {
+        ft_arena_scope outer_scope(outer_arena);
+
+        {
+            ft_arena_scope inner_scope(inner_arena);
+
+            FT_ASSERT(cma_arena_thread_scope() == inner_arena);
+            inner_scope.release();
+            FT_ASSERT_EQ(FT_FALSE, inner_scope.is_active());
+            FT_ASSERT(cma_arena_thread_scope() == outer_arena);
+        }
+        FT_ASSERT(cma_arena_thread_scope() == outer_arena);
+    }
+    FT_ASSERT(cma_arena_thread_scope() == ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_destroy(inner_arena));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_arena_destroy(outer_arena));
+    return (1);
+}
@@ -0,0 +1,126 @@
+#include "../test_internal.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#include "../../Modules/Basic/limits.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+#if !defined(_WIN32) && !defined(_WIN64)
+
+FT_TEST(test_cma_huge_allocation_is_reported_separately)
+{
+    ft_size_t previous_threshold;
+    ft_size_t huge_count_before;
+    ft_size_t huge_bytes_before;
+    ft_size_t huge_count_live;
+    ft_size_t huge_bytes_live;
+    ft_size_t huge_count_after;
+    ft_size_t huge_bytes_after;
+    unsigned char *allocation;
+
+    cma_set_alloc_limit(0);
+    previous_threshold = cma_get_huge_threshold();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_huge_threshold(65536));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_before, &huge_bytes_before));
+    allocation = static_cast<unsigned char *>(cma_malloc(200000));
+    FT_ASSERT(allocation != ft_nullptr);
+    allocation[0] = 1;
+    allocation[199999] = 2;
+    FT_ASSERT_EQ(200000, cma_alloc_size(allocation));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_live, &huge_bytes_live));
+    FT_ASSERT_EQ(huge_count_before + 1, huge_count_live);
+    FT_ASSERT(huge_bytes_live >= huge_bytes_before + 200000);
+    cma_free(allocation);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_after, &huge_bytes_after));
+    FT_ASSERT_EQ(huge_count_before, huge_count_after);
+    FT_ASSERT_EQ(huge_bytes_before, huge_bytes_after);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_huge_threshold(previous_threshold));
+    return (1);
+}
+
+FT_TEST(test_cma_huge_realloc_grows_and_shrinks_mapping)
+{
+    ft_size_t previous_threshold;
+    ft_size_t huge_count_before;
+    ft_size_t huge_count_live;
+    ft_size_t huge_bytes_small;
+    ft_size_t huge_bytes_large;
+    unsigned char *allocation;
+    unsigned char *grown_allocation;
+    unsigned char *shrunk_allocation;
+    ft_size_t index;
+
+    cma_set_alloc_limit(0);
+    previous_threshold = cma_get_huge_threshold();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_huge_threshold(65536));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_before, ft_nullptr));
+    allocation = static_cast<unsigned char *>(cma_malloc(131072));
+    FT_ASSERT(allocation != ft_nullptr);
+    index = 0;
+    while (index < 131072)
+    {
+        allocation[index] = static_cast<unsigned char>(index % 251);
+        index += 512;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, ft_nullptr, &huge_bytes_small));
+    grown_allocation = static_cast<unsigned char *>(cma_realloc(allocation,
+            4194304));
+    FT_ASSERT(grown_allocation != ft_nullptr);
+    FT_ASSERT_EQ(4194304, cma_alloc_size(grown_allocation));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_live, &huge_bytes_large));
+    FT_ASSERT_EQ(huge_count_before + 1, huge_count_live);
+    FT_ASSERT(huge_bytes_large >= huge_bytes_small + 4194304 - 131072);
+    index = 0;
+    while (index < 131072)
+    {
+        FT_ASSERT_EQ(static_cast<unsigned char>(index % 251),
+            grown_allocation[index]);
+        index += 512;
+    }
+    grown_allocation[4194303] = 7;
+    shrunk_allocation = static_cast<unsigned char *>(cma_realloc(
+            grown_allocation, 98304));
+    FT_ASSERT(shrunk_allocation != ft_nullptr);
+    FT_ASSERT_EQ(98304, cma_alloc_size(shrunk_allocation));
+    FT_ASSERT_EQ(static_cast<unsigned char>(512 % 251), shrunk_allocation[512]);
+    cma_free(shrunk_allocation);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_live, ft_nullptr));
+    FT_ASSERT_EQ(huge_count_before, huge_count_live);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_huge_threshold(previous_threshold));
+    return (1);
+}
+
+FT_TEST(test_cma_huge_threshold_zero_disables_mapping)
+{
+    ft_size_t previous_threshold;
+    ft_size_t huge_count_before;
+    ft_size_t huge_count_live;
+    void *allocation;
+
+    cma_set_alloc_limit(0);
+    previous_threshold = cma_get_huge_threshold();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_huge_threshold(0));
+    FT_ASSERT_EQ(0, cma_get_huge_threshold());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_before, ft_nullptr));
+    allocation = cma_malloc(2097152);
+    FT_ASSERT(allocation != ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(ft_nullptr, ft_nullptr,
+            ft_nullptr, ft_nullptr, &huge_count_live, ft_nullptr));
+    FT_ASSERT_EQ(huge_count_before, huge_count_live);
+    cma_free(allocation);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_huge_threshold(previous_threshold));
+    return (1);
+}
+
+#endif
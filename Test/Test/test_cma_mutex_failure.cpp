@@ -30,11 +30,13 @@ FT_TEST(test_cma_lock_allocator_mutex_lock_failure)
 
 FT_TEST(test_cma_malloc_mutex_lock_failure)
 {
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_thread_cache_enabled(FT_FALSE));
     pt_recursive_mutex_lock_override_error_code.store(FT_ERR_SYS_MUTEX_LOCK_FAILED,
         std::memory_order_release);
     void *allocation = cma_malloc(32);
     pt_recursive_mutex_lock_override_error_code.store(FT_ERR_SUCCESS,
         std::memory_order_release);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_thread_cache_enabled(FT_TRUE));
     FT_ASSERT_EQ(ft_nullptr, allocation);
     return (1);
 }
@@ -0,0 +1,126 @@
+#include "../test_internal.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#include "../../Modules/Basic/limits.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_cma_size_classes_reuse_freed_block)
+{
+    void *first_pointer;
+    void *second_pointer;
+    void *reused_pointer;
+
+    cma_set_alloc_limit(0);
+    first_pointer = cma_malloc(640);
+    second_pointer = cma_malloc(640);
+    FT_ASSERT(first_pointer != ft_nullptr);
+    FT_ASSERT(second_pointer != ft_nullptr);
+    cma_free(first_pointer);
+    reused_pointer = cma_malloc(640);
+    FT_ASSERT(reused_pointer != ft_nullptr);
+    FT_ASSERT_EQ(640, cma_alloc_size(reused_pointer));
+    cma_free(reused_pointer);
+    cma_free(second_pointer);
+    return (1);
+}
+
+FT_TEST(test_cma_size_classes_many_live_blocks_keep_sizes)
+{
+    const ft_size_t block_count = 2048;
+    void **pointers;
+    ft_size_t index;
+
+    cma_set_alloc_limit(0);
+    pointers = static_cast<void **>(cma_malloc(block_count * sizeof(void *)));
+    FT_ASSERT(pointers != ft_nullptr);
+    index = 0;
+    while (index < block_count)
+    {
+        ft_size_t request_size;
+
+        request_size = 272 + (index % 37) * 48;
+        pointers[index] = cma_malloc(request_size);
+        FT_ASSERT(pointers[index] != ft_nullptr);
+        static_cast<unsigned char *>(pointers[index])[0]
+            = static_cast<unsigned char>(index);
+        index++;
+    }
+    index = 0;
+    while (index < block_count)
+    {
+        FT_ASSERT_EQ(272 + (index % 37) * 48, cma_alloc_size(pointers[index]));
+        FT_ASSERT_EQ(static_cast<unsigned char>(index),
+            static_cast<unsigned char *>(pointers[index])[0]);
+        index += 1;
+    }
+    index = 0;
+    while (index < block_count)
+    {
+        cma_free(pointers[index]);
+        pointers[index] = ft_nullptr;
+        index += 2;
+    }
+    index = 0;
+    while (index < block_count)
+    {
+        pointers[index] = cma_malloc(512);
+        FT_ASSERT(pointers[index] != ft_nullptr);
+        FT_ASSERT_EQ(512, cma_alloc_size(pointers[index]));
+        index += 2;
+    }
+    index = 0;
+    while (index < block_count)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_checked_free(pointers[index]));
+        index++;
+    }
+    cma_free(pointers);
+    return (1);
+}
+
+FT_TEST(test_cma_size_classes_realloc_grows_into_free_neighbor)
+{
+    char *first_pointer;
+    char *second_pointer;
+    char *grown_pointer;
+
+    cma_set_alloc_limit(0);
+    first_pointer = static_cast<char *>(cma_malloc(400));
+    second_pointer = static_cast<char *>(cma_malloc(400));
+    FT_ASSERT(first_pointer != ft_nullptr);
+    FT_ASSERT(second_pointer != ft_nullptr);
+    first_pointer[0] = 'c';
+    first_pointer[399] = 'a';
+    cma_free(second_pointer);
+    grown_pointer = static_cast<char *>(cma_realloc(first_pointer, 720));
+    FT_ASSERT(grown_pointer != ft_nullptr);
+    FT_ASSERT_EQ('c', grown_pointer[0]);
+    FT_ASSERT_EQ('a', grown_pointer[399]);
+    FT_ASSERT_EQ(720, cma_alloc_size(grown_pointer));
+    cma_free(grown_pointer);
+    return (1);
+}
+
+FT_TEST(test_cma_size_classes_foreign_pointer_is_rejected)
+{
+    char *allocation_pointer;
+    ft_size_t reported_size;
+
+    cma_set_alloc_limit(0);
+    allocation_pointer = static_cast<char *>(cma_malloc(512));
+    FT_ASSERT(allocation_pointer != ft_nullptr);
+    reported_size = 99;
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT,
+        cma_checked_block_size(allocation_pointer + 16, &reported_size));
+    FT_ASSERT_EQ(0, reported_size);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT,
+        cma_checked_free(allocation_pointer + 16));
+    FT_ASSERT_EQ(512, cma_alloc_size(allocation_pointer));
+    cma_free(allocation_pointer);
+    return (1);
+}
@@ -0,0 +1,202 @@
+#include "../test_internal.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include <thread>
+
+#include "../../Modules/Basic/limits.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_cma_thread_cache_reuses_freed_block)
+{
+    void *first_pointer;
+    void *second_pointer;
+
+    cma_set_alloc_limit(0);
+    FT_ASSERT_EQ(FT_TRUE, cma_is_thread_cache_enabled());
+    first_pointer = cma_malloc(40);
+    FT_ASSERT(first_pointer != ft_nullptr);
+    FT_ASSERT_EQ(48, cma_alloc_size(first_pointer));
+    cma_free(first_pointer);
+    FT_ASSERT_EQ(0, cma_alloc_size(first_pointer));
+    second_pointer = cma_malloc(48);
+    FT_ASSERT(second_pointer == first_pointer);
+    FT_ASSERT_EQ(48, cma_alloc_size(second_pointer));
+    cma_free(second_pointer);
+    return (1);
+}
+
+FT_TEST(test_cma_thread_cache_stats_include_cached_operations)
+{
+    ft_size_t allocation_count_before;
+    ft_size_t free_count_before;
+    ft_size_t current_bytes_before;
+    ft_size_t allocation_count_after;
+    ft_size_t free_count_after;
+    ft_size_t current_bytes_after;
+    ft_size_t peak_bytes;
+    void *pointers[64];
+    ft_size_t index;
+
+    cma_set_alloc_limit(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(&allocation_count_before,
+            &free_count_before, &current_bytes_before, &peak_bytes));
+    index = 0;
+    while (index < 64)
+    {
+        pointers[index] = cma_malloc(64);
+        FT_ASSERT(pointers[index] != ft_nullptr);
+        index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(&allocation_count_after,
+            &free_count_after, &current_bytes_after, &peak_bytes));
+    FT_ASSERT_EQ(allocation_count_before + 64, allocation_count_after);
+    FT_ASSERT_EQ(free_count_before, free_count_after);
+    FT_ASSERT_EQ(current_bytes_before + 64 * 64, current_bytes_after);
+    FT_ASSERT(peak_bytes >= current_bytes_after);
+    index = 0;
+    while (index < 64)
+    {
+        cma_free(pointers[index]);
+        index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(&allocation_count_after,
+            &free_count_after, &current_bytes_after, &peak_bytes));
+    FT_ASSERT_EQ(free_count_before + 64, free_count_after);
+    FT_ASSERT_EQ(current_bytes_before, current_bytes_after);
+    return (1);
+}
+
+FT_TEST(test_cma_thread_cache_disabled_skips_cache)
+{
+    void *first_pointer;
+
+    cma_set_alloc_limit(0);
+    first_pointer = cma_malloc(96);
+    FT_ASSERT(first_pointer != ft_nullptr);
+    cma_free(first_pointer);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_thread_cache_enabled(FT_FALSE));
+    FT_ASSERT_EQ(FT_FALSE, cma_is_thread_cache_enabled());
+    first_pointer = cma_malloc(96);
+    FT_ASSERT(first_pointer != ft_nullptr);
+    FT_ASSERT_EQ(96, cma_alloc_size(first_pointer));
+    cma_free(first_pointer);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_thread_cache_enabled(FT_TRUE));
+    return (1);
+}
+
+FT_TEST(test_cma_thread_cache_cross_thread_free_keeps_stats)
+{
+    ft_size_t allocation_count_before;
+    ft_size_t free_count_before;
+    ft_size_t current_bytes_before;
+    ft_size_t allocation_count_after;
+    ft_size_t free_count_after;
+    ft_size_t current_bytes_after;
+    void *pointers[256];
+    ft_bool worker_ok;
+    ft_size_t index;
+
+    cma_set_alloc_limit(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(&allocation_count_before,
+            &free_count_before, &current_bytes_before, ft_nullptr));
+    worker_ok = FT_TRUE;
+    std::thread producer([&pointers, &worker_ok]()
+    {
+        ft_size_t producer_index;
+
+        producer_index = 0;
+        while (producer_index < 256)
+        {
+            pointers[producer_index] = cma_malloc(16 + (producer_index % 16) * 16);
+            if (pointers[producer_index] == ft_nullptr)
+                worker_ok = FT_FALSE;
+            producer_index++;
+        }
+        return ;
+    });
+    producer.join();
+    FT_ASSERT_EQ(FT_TRUE, worker_ok);
+    index = 0;
+    while (index < 256)
+    {
+        FT_ASSERT_EQ(16 + (index % 16) * 16, cma_alloc_size(pointers[index]));
+        cma_free(pointers[index]);
+        index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(&allocation_count_after,
+            &free_count_after, &current_bytes_after, ft_nullptr));
+    FT_ASSERT(allocation_count_after >= allocation_count_before + 256);
+    FT_ASSERT_EQ(allocation_count_after - allocation_count_before,
+        free_count_after - free_count_before);
+    FT_ASSERT_EQ(current_bytes_before, current_bytes_after);
+    return (1);
+}
+
+FT_TEST(test_cma_thread_cache_toggle_while_threads_allocate)
+{
+    ft_size_t allocation_count_before;
+    ft_size_t free_count_before;
+    ft_size_t current_bytes_before;
+    ft_size_t allocation_count_after;
+    ft_size_t free_count_after;
+    ft_size_t current_bytes_after;
+    ft_bool worker_ok[2];
+    ft_size_t round_index;
+
+    cma_set_alloc_limit(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(&allocation_count_before,
+            &free_count_before, &current_bytes_before, ft_nullptr));
+    worker_ok[0] = FT_TRUE;
+    worker_ok[1] = FT_TRUE;
+    auto worker = [&worker_ok](ft_size_t worker_index)
+    {
+        void *pointers[32];
+        ft_size_t loop_index;
+        ft_size_t pointer_index;
+
+        loop_index = 0;
+        while (loop_index < 500)
+        {
+            pointer_index = 0;
+            while (pointer_index < 32)
+            {
+                pointers[pointer_index] = cma_malloc(16 + (pointer_index % 16) * 16);
+                if (pointers[pointer_index] == ft_nullptr)
+                    worker_ok[worker_index] = FT_FALSE;
+                pointer_index++;
+            }
+            while (pointer_index > 0)
+            {
+                pointer_index--;
+                cma_free(pointers[pointer_index]);
+            }
+            loop_index++;
+        }
+        if (cma_flush_thread_cache() != FT_ERR_SUCCESS)
+            worker_ok[worker_index] = FT_FALSE;
+        return ;
+    };
+    std::thread first_worker(worker, 0);
+    std::thread second_worker(worker, 1);
+    round_index = 0;
+    while (round_index < 50)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_thread_cache_enabled(
+            (round_index % 2) != 0));
+        round_index++;
+    }
+    first_worker.join();
+    second_worker.join();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_thread_cache_enabled(FT_TRUE));
+    FT_ASSERT_EQ(FT_TRUE, worker_ok[0]);
+    FT_ASSERT_EQ(FT_TRUE, worker_ok[1]);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_extended_stats(&allocation_count_after,
+            &free_count_after, &current_bytes_after, ft_nullptr));
+    FT_ASSERT_EQ(allocation_count_after - allocation_count_before,
+        free_count_after - free_count_before);
+    FT_ASSERT_EQ(current_bytes_before, current_bytes_after);
+    return (1);
+}
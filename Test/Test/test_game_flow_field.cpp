@@ -0,0 +1,136 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Game/game_flow_field.hpp"
+#include "../../Modules/Game/game_pathfinding.hpp"
+#include "../../Modules/Game/game_map3d.hpp"
+#include "../../Modules/Template/vector.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static void game_flow_field_scatter(game_map3d &grid, ft_size_t width, ft_size_t height,
+    ft_size_t depth, uint32_t seed)
+{
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+
+    z = 0;
+    while (z < depth)
+    {
+        y = 0;
+        while (y < height)
+        {
+            x = 0;
+            while (x < width)
+            {
+                seed = seed * 1103515245u + 12345u;
+                if ((seed >> 16) % 100 < 25)
+                    grid.set(x, y, z, 1);
+                x++;
+            }
+            y++;
+        }
+        z++;
+    }
+    grid.set(0, 0, 0, 0);
+    return ;
+}
+
+FT_TEST(test_game_flow_field_distances_match_grid_astar)
+{
+    game_flow_field field;
+    game_pathfinding finder;
+    game_map3d grid;
+    ft_vector<game_path_step> field_path;
+    ft_vector<game_path_step> optimal_path;
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+    ft_size_t next[3];
+    int32_t optimal_result;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, field_path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, optimal_path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(12, 9, 3, 0));
+    game_flow_field_scatter(grid, 12, 9, 3, 7);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.build(grid, 0, 0, 0));
+    FT_ASSERT(field.get_reachable_count() > 1);
+    z = 0;
+    while (z < 3)
+    {
+        y = 0;
+        while (y < 9)
+        {
+            x = 0;
+            while (x < 12)
+            {
+                optimal_result = FT_ERR_GAME_INVALID_MOVE;
+                if (grid.get(x, y, z) == 0)
+                    optimal_result = finder.astar_grid(grid, x, y, z, 0, 0, 0, optimal_path);
+                if (optimal_result != FT_ERR_SUCCESS)
+                {
+                    FT_ASSERT_EQ(GAME_FLOW_FIELD_UNREACHABLE, field.get_distance(x, y, z));
+                    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, field.next_step(x, y, z,
+                            &next[0], &next[1], &next[2]));
+                }
+                else
+                {
+                    FT_ASSERT_EQ(optimal_path.size(), field.get_distance(x, y, z) + 1u);
+                    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.extract_path(x, y, z, field_path));
+                    FT_ASSERT_EQ(optimal_path.size(), field_path.size());
+                    FT_ASSERT_EQ(0u, field_path[field_path.size() - 1].get_x());
+                    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.next_step(x, y, z,
+                            &next[0], &next[1], &next[2]));
+                    if (field_path.size() > 1)
+                    {
+                        FT_ASSERT_EQ(field_path[1].get_x(), next[0]);
+                        FT_ASSERT_EQ(field_path[1].get_y(), next[1]);
+                        FT_ASSERT_EQ(field_path[1].get_z(), next[2]);
+                        FT_ASSERT_EQ(field.get_distance(x, y, z) - 1,
+                            field.get_distance(next[0], next[1], next[2]));
+                    }
+                }
+                x++;
+            }
+            y++;
+        }
+        z++;
+    }
+    return (1);
+}
+
+FT_TEST(test_game_flow_field_rejects_invalid_queries)
+{
+    game_flow_field field;
+    game_map3d grid;
+    ft_size_t next[3];
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(4, 4, 1, 0));
+    FT_ASSERT_EQ(FT_ERR_INVALID_STATE, field.next_step(0, 0, 0, &next[0], &next[1],
+            &next[2]));
+    grid.set(3, 3, 0, 1);
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, field.build(grid, 3, 3, 0));
+    FT_ASSERT_EQ(FT_FALSE, field.is_built());
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, field.build(grid, 4, 0, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.build(grid, 2, 1, 0));
+    FT_ASSERT_EQ(FT_TRUE, field.is_built());
+    FT_ASSERT_EQ(15u, field.get_reachable_count());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.next_step(2, 1, 0, &next[0], &next[1], &next[2]));
+    FT_ASSERT_EQ(2u, next[0]);
+    FT_ASSERT_EQ(1u, next[1]);
+    FT_ASSERT_EQ(0u, field.get_distance(2, 1, 0));
+    FT_ASSERT_EQ(4u, field.get_distance(0, 3, 0));
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, field.next_step(3, 3, 0, &next[0], &next[1],
+            &next[2]));
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, field.next_step(0, 4, 0, &next[0], &next[1],
+            &next[2]));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, field.next_step(0, 0, 0, ft_nullptr, &next[1],
+            &next[2]));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, field.destroy());
+    return (1);
+}
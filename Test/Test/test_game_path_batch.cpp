@@ -0,0 +1,160 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Game/game_path_batch.hpp"
+#include "../../Modules/Game/game_pathfinding.hpp"
+#include "../../Modules/Game/game_map3d.hpp"
+#include "../../Modules/Threading/thread_pool.hpp"
+#include "../../Modules/Template/vector.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include <atomic>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+#define GAME_PATH_BATCH_TEST_REQUESTS 24
+
+FT_TEST(test_game_path_batch_matches_serial_astar)
+{
+    game_path_batch batch;
+    game_pathfinding finder;
+    game_map3d grid;
+    ft_thread_pool pool(3, 0);
+    game_path_request requests[GAME_PATH_BATCH_TEST_REQUESTS];
+    ft_vector<game_path_step> paths[GAME_PATH_BATCH_TEST_REQUESTS];
+    ft_vector<game_path_step> serial_path;
+    ft_size_t index;
+    ft_size_t x;
+    ft_size_t y;
+    uint32_t seed;
+    int32_t serial_result;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, serial_path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(30, 20, 2, 0));
+    seed = 3;
+    y = 0;
+    while (y < 20)
+    {
+        x = 0;
+        while (x < 30)
+        {
+            seed = seed * 1103515245u + 12345u;
+            if ((seed >> 16) % 100 < 25)
+                grid.set(x, y, seed % 2, 1);
+            x++;
+        }
+        y++;
+    }
+    index = 0;
+    while (index < GAME_PATH_BATCH_TEST_REQUESTS)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, paths[index].initialize());
+        requests[index].start_x = index;
+        requests[index].start_y = index % 20;
+        requests[index].start_z = index % 2;
+        requests[index].goal_x = 29 - index;
+        requests[index].goal_y = 19 - index % 20;
+        requests[index].goal_z = (index + 1) % 2;
+        requests[index].out_path = &paths[index];
+        requests[index].result = FT_ERR_INVALID_STATE;
+        index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.run(grid, pool, requests,
+            GAME_PATH_BATCH_TEST_REQUESTS, 4));
+    FT_ASSERT_EQ(4u, batch.get_lane_count());
+    index = 0;
+    while (index < GAME_PATH_BATCH_TEST_REQUESTS)
+    {
+        serial_path.clear();
+        serial_result = finder.astar_grid(grid, requests[index].start_x,
+                requests[index].start_y, requests[index].start_z, requests[index].goal_x,
+                requests[index].goal_y, requests[index].goal_z, serial_path);
+        FT_ASSERT_EQ(serial_result, requests[index].result);
+        FT_ASSERT_EQ(serial_path.size(), paths[index].size());
+        if (serial_result == FT_ERR_SUCCESS)
+        {
+            FT_ASSERT_EQ(requests[index].start_x, paths[index][0].get_x());
+            FT_ASSERT_EQ(requests[index].goal_x,
+                paths[index][paths[index].size() - 1].get_x());
+        }
+        index++;
+    }
+    pool.wait();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.destroy());
+    return (1);
+}
+
+FT_TEST(test_game_path_batch_reports_per_request_errors)
+{
+    game_path_batch batch;
+    game_map3d grid;
+    ft_thread_pool pool(2, 0);
+    game_path_request requests[3];
+    ft_vector<game_path_step> open_path;
+    ft_vector<game_path_step> blocked_path;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, open_path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, blocked_path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(5, 5, 1, 0));
+    grid.set(2, 2, 0, 1);
+    requests[0] = {0, 0, 0, 4, 4, 0, &open_path, FT_ERR_INVALID_STATE};
+    requests[1] = {2, 2, 0, 4, 4, 0, &blocked_path, FT_ERR_INVALID_STATE};
+    requests[2] = {0, 0, 0, 4, 4, 0, ft_nullptr, FT_ERR_INVALID_STATE};
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.run(grid, pool, requests, 3, 8));
+    FT_ASSERT_EQ(3u, batch.get_lane_count());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, requests[0].result);
+    FT_ASSERT_EQ(9u, open_path.size());
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, requests[1].result);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, requests[2].result);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.run(grid, pool, requests, 0, 4));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, batch.run(grid, pool, ft_nullptr, 2, 4));
+    pool.wait();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.destroy());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.destroy());
+    return (1);
+}
+
+FT_TEST(test_game_path_batch_runs_from_inside_single_worker_pool)
+{
+    game_path_batch batch;
+    game_map3d grid;
+    ft_thread_pool pool(1, 0);
+    game_path_request requests[4];
+    ft_vector<game_path_step> paths[4];
+    std::atomic<int32_t> batch_result;
+    ft_size_t index;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(6, 6, 1, 0));
+    index = 0;
+    while (index < 4)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, paths[index].initialize());
+        requests[index] = {index, 0, 0, 5, 5 - index, 0, &paths[index],
+            FT_ERR_INVALID_STATE};
+        index++;
+    }
+    batch_result.store(FT_ERR_INVALID_STATE);
+    pool.submit([&batch, &grid, &pool, &requests, &batch_result]()
+    {
+        batch_result.store(batch.run(grid, pool, requests, 4, 4));
+        return ;
+    });
+    pool.wait();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch_result.load());
+    index = 0;
+    while (index < 4)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, requests[index].result);
+        FT_ASSERT(paths[index].size() > 0);
+        index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.destroy());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, batch.destroy());
+    return (1);
+}
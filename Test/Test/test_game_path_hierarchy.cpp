@@ -0,0 +1,188 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Game/game_path_hierarchy.hpp"
+#include "../../Modules/Game/game_pathfinding.hpp"
+#include "../../Modules/Game/game_map3d.hpp"
+#include "../../Modules/Template/vector.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static void game_path_hierarchy_scatter(game_map3d &grid, ft_size_t width, ft_size_t height,
+    ft_size_t depth, uint32_t seed)
+{
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+
+    z = 0;
+    while (z < depth)
+    {
+        y = 0;
+        while (y < height)
+        {
+            x = 0;
+            while (x < width)
+            {
+                seed = seed * 1103515245u + 12345u;
+                if ((seed >> 16) % 100 < 22)
+                    grid.set(x, y, z, 1);
+                x++;
+            }
+            y++;
+        }
+        z++;
+    }
+    grid.set(0, 0, 0, 0);
+    grid.set(width - 1, height - 1, depth - 1, 0);
+    return ;
+}
+
+static int game_path_hierarchy_path_is_valid(game_map3d &grid,
+    ft_vector<game_path_step> &path, ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z)
+{
+    ft_size_t index;
+    ft_size_t moved;
+
+    if (path.size() == 0 || path[0].get_x() != 0 || path[0].get_y() != 0
+        || path[0].get_z() != 0)
+        return (0);
+    index = 0;
+    while (index < path.size())
+    {
+        if (grid.get(path[index].get_x(), path[index].get_y(), path[index].get_z()) != 0)
+            return (0);
+        if (index > 0)
+        {
+            moved = 0;
+            moved += (path[index].get_x() != path[index - 1].get_x());
+            moved += (path[index].get_y() != path[index - 1].get_y());
+            moved += (path[index].get_z() != path[index - 1].get_z());
+            if (moved != 1)
+                return (0);
+        }
+        index++;
+    }
+    index = path.size() - 1;
+    return (path[index].get_x() == goal_x && path[index].get_y() == goal_y
+        && path[index].get_z() == goal_z);
+}
+
+FT_TEST(test_game_path_hierarchy_agrees_with_grid_astar)
+{
+    game_path_hierarchy hierarchy;
+    game_pathfinding finder;
+    ft_vector<game_path_step> hierarchical_path;
+    ft_vector<game_path_step> optimal_path;
+    ft_size_t sizes[3][3] = {{40, 40, 1}, {24, 20, 6}, {33, 17, 3}};
+    uint32_t seed;
+    int size_index;
+    int32_t optimal_result;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchical_path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, optimal_path.initialize());
+    seed = 1;
+    while (seed <= 9)
+    {
+        size_index = static_cast<int>(seed % 3);
+        game_map3d grid;
+
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(sizes[size_index][0],
+                sizes[size_index][1], sizes[size_index][2], 0));
+        game_path_hierarchy_scatter(grid, sizes[size_index][0], sizes[size_index][1],
+            sizes[size_index][2], seed);
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.build(grid, 8));
+        optimal_result = finder.astar_grid(grid, 0, 0, 0, sizes[size_index][0] - 1,
+                sizes[size_index][1] - 1, sizes[size_index][2] - 1, optimal_path);
+        FT_ASSERT_EQ(optimal_result, hierarchy.find_path(grid, 0, 0, 0,
+                sizes[size_index][0] - 1, sizes[size_index][1] - 1,
+                sizes[size_index][2] - 1, hierarchical_path));
+        if (optimal_result == FT_ERR_SUCCESS)
+        {
+            FT_ASSERT_EQ(1, game_path_hierarchy_path_is_valid(grid, hierarchical_path,
+                    sizes[size_index][0] - 1, sizes[size_index][1] - 1,
+                    sizes[size_index][2] - 1));
+            FT_ASSERT(hierarchical_path.size() >= optimal_path.size());
+            FT_ASSERT(hierarchical_path.size() * 2 <= optimal_path.size() * 3);
+        }
+        seed++;
+    }
+    FT_ASSERT(hierarchy.get_cluster_count() > 1);
+    FT_ASSERT(hierarchy.get_node_count() > 0);
+    return (1);
+}
+
+FT_TEST(test_game_path_hierarchy_repairs_after_toggle_obstacle)
+{
+    game_path_hierarchy hierarchy;
+    game_pathfinding finder;
+    game_map3d grid;
+    ft_vector<game_path_step> path;
+    ft_size_t y;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(16, 8, 1, 0));
+    y = 0;
+    while (y < 8)
+    {
+        if (y != 6)
+            grid.set(9, y, 0, 1);
+        y++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.build(grid, 4));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.attach_hierarchy(&hierarchy));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.find_path(grid, 0, 0, 0, 15, 0, 0, path));
+    FT_ASSERT_EQ(28u, path.size());
+    grid.toggle_obstacle(9, 6, 0, &finder);
+    FT_ASSERT_EQ(1u, hierarchy.get_dirty_cluster_count());
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, hierarchy.find_path(grid, 0, 0, 0, 15, 0, 0,
+            path));
+    FT_ASSERT_EQ(0u, path.size());
+    FT_ASSERT_EQ(0u, hierarchy.get_dirty_cluster_count());
+    grid.toggle_obstacle(9, 2, 0, &finder);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.find_path(grid, 0, 0, 0, 15, 0, 0, path));
+    FT_ASSERT_EQ(1, game_path_hierarchy_path_is_valid(grid, path, 15, 0, 0));
+    FT_ASSERT_EQ(20u, path.size());
+    return (1);
+}
+
+FT_TEST(test_game_path_hierarchy_cache_survives_unrelated_repairs)
+{
+    game_path_hierarchy hierarchy;
+    game_pathfinding finder;
+    game_map3d grid;
+    ft_vector<game_path_step> path;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(32, 32, 1, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.build(grid, 8));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.attach_hierarchy(&hierarchy));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.find_path(grid, 0, 0, 0, 31, 0, 0, path));
+    FT_ASSERT_EQ(1, game_path_hierarchy_path_is_valid(grid, path, 31, 0, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.find_path(grid, 1, 1, 0, 30, 2, 0, path));
+    FT_ASSERT_EQ(1u, path[0].get_x());
+    FT_ASSERT_EQ(30u, path[path.size() - 1].get_x());
+    FT_ASSERT_EQ(1u, hierarchy.get_cache_misses());
+    FT_ASSERT_EQ(1u, hierarchy.get_cache_hits());
+    grid.toggle_obstacle(20, 30, 0, &finder);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.find_path(grid, 0, 0, 0, 31, 0, 0, path));
+    FT_ASSERT_EQ(2u, hierarchy.get_cache_hits());
+    grid.toggle_obstacle(12, 5, 0, &finder);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.find_path(grid, 0, 0, 0, 31, 0, 0, path));
+    FT_ASSERT_EQ(2u, hierarchy.get_cache_misses());
+    FT_ASSERT_EQ(1, game_path_hierarchy_path_is_valid(grid, path, 31, 0, 0));
+    hierarchy.clear_cache();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.find_path(grid, 0, 0, 0, 31, 0, 0, path));
+    FT_ASSERT_EQ(3u, hierarchy.get_cache_misses());
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, hierarchy.find_path(grid, 0, 0, 0, 32, 0, 0,
+            path));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, hierarchy.destroy());
+    return (1);
+}
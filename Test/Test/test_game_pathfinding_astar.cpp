@@ -0,0 +1,227 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Game/game_pathfinding.hpp"
+#include "../../Modules/Game/game_map3d.hpp"
+#include "../../Modules/Template/vector.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include <cstdlib>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static void game_pathfinding_astar_build_maze(game_map3d &grid, ft_size_t width,
+    ft_size_t height, ft_size_t depth, uint32_t seed)
+{
+    ft_size_t x;
+    ft_size_t y;
+    ft_size_t z;
+
+    z = 0;
+    while (z < depth)
+    {
+        y = 0;
+        while (y < height)
+        {
+            x = 0;
+            while (x < width)
+            {
+                seed = seed * 1103515245u + 12345u;
+                if ((seed >> 16) % 100 < 30)
+                    grid.set(x, y, z, 1);
+                x++;
+            }
+            y++;
+        }
+        z++;
+    }
+    grid.set(0, 0, 0, 0);
+    grid.set(width - 1, height - 1, depth - 1, 0);
+    return ;
+}
+
+static int game_pathfinding_astar_bfs_length(game_map3d &grid, ft_size_t width,
+    ft_size_t height, ft_size_t depth)
+{
+    ft_size_t cell_count;
+    ft_size_t *queue;
+    int *distance;
+    ft_size_t head;
+    ft_size_t tail;
+    ft_size_t cell;
+    ft_size_t coordinates[3];
+    ft_size_t limit[3];
+    ft_size_t stride[3];
+    int direction;
+    int result;
+
+    cell_count = width * height * depth;
+    queue = static_cast<ft_size_t *>(std::malloc(cell_count * sizeof(ft_size_t)));
+    distance = static_cast<int *>(std::malloc(cell_count * sizeof(int)));
+    if (queue == ft_nullptr || distance == ft_nullptr)
+    {
+        std::free(queue);
+        std::free(distance);
+        return (-2);
+    }
+    cell = 0;
+    while (cell < cell_count)
+        distance[cell++] = -1;
+    limit[0] = width;
+    limit[1] = height;
+    limit[2] = depth;
+    stride[0] = 1;
+    stride[1] = width;
+    stride[2] = width * height;
+    head = 0;
+    tail = 0;
+    distance[0] = 0;
+    queue[tail++] = 0;
+    while (head < tail)
+    {
+        cell = queue[head++];
+        coordinates[0] = cell % width;
+        coordinates[1] = (cell / width) % height;
+        coordinates[2] = cell / (width * height);
+        direction = 0;
+        while (direction < 6)
+        {
+            ft_size_t axis;
+            ft_size_t neighbor;
+
+            axis = static_cast<ft_size_t>(direction / 2);
+            if (direction % 2 == 0 && coordinates[axis] + 1 < limit[axis])
+                neighbor = cell + stride[axis];
+            else if (direction % 2 == 1 && coordinates[axis] > 0)
+                neighbor = cell - stride[axis];
+            else
+            {
+                direction++;
+                continue ;
+            }
+            if (distance[neighbor] == -1 && grid.get(neighbor % width,
+                    (neighbor / width) % height, neighbor / (width * height)) == 0)
+            {
+                distance[neighbor] = distance[cell] + 1;
+                queue[tail++] = neighbor;
+            }
+            direction++;
+        }
+    }
+    result = distance[cell_count - 1];
+    std::free(queue);
+    std::free(distance);
+    return (result);
+}
+
+static int game_pathfinding_astar_path_is_valid(game_map3d &grid,
+    ft_vector<game_path_step> &path, ft_size_t goal_x, ft_size_t goal_y, ft_size_t goal_z)
+{
+    ft_size_t index;
+    ft_size_t moved;
+
+    if (path.size() == 0 || path[0].get_x() != 0 || path[0].get_y() != 0
+        || path[0].get_z() != 0)
+        return (0);
+    index = 0;
+    while (index < path.size())
+    {
+        if (grid.get(path[index].get_x(), path[index].get_y(), path[index].get_z()) != 0)
+            return (0);
+        if (index > 0)
+        {
+            moved = 0;
+            moved += (path[index].get_x() != path[index - 1].get_x());
+            moved += (path[index].get_y() != path[index - 1].get_y());
+            moved += (path[index].get_z() != path[index - 1].get_z());
+            if (moved != 1)
+                return (0);
+        }
+        index++;
+    }
+    index = path.size() - 1;
+    return (path[index].get_x() == goal_x && path[index].get_y() == goal_y
+        && path[index].get_z() == goal_z);
+}
+
+FT_TEST(test_game_pathfinding_astar_matches_bfs_on_random_mazes)
+{
+    game_pathfinding finder;
+    ft_vector<game_path_step> path;
+    ft_size_t sizes[3][3] = {{12, 9, 3}, {20, 20, 1}, {7, 6, 5}};
+    uint32_t seed;
+    int size_index;
+    int expected;
+    int32_t result;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, path.initialize());
+    seed = 1;
+    while (seed <= 12)
+    {
+        size_index = static_cast<int>(seed % 3);
+        game_map3d grid;
+
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(sizes[size_index][0],
+                sizes[size_index][1], sizes[size_index][2], 0));
+        game_pathfinding_astar_build_maze(grid, sizes[size_index][0],
+            sizes[size_index][1], sizes[size_index][2], seed);
+        expected = game_pathfinding_astar_bfs_length(grid, sizes[size_index][0],
+                sizes[size_index][1], sizes[size_index][2]);
+        FT_ASSERT(expected != -2);
+        result = finder.astar_grid(grid, 0, 0, 0, sizes[size_index][0] - 1,
+                sizes[size_index][1] - 1, sizes[size_index][2] - 1, path);
+        if (expected < 0)
+            FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, result);
+        else
+        {
+            FT_ASSERT_EQ(FT_ERR_SUCCESS, result);
+            FT_ASSERT_EQ(static_cast<ft_size_t>(expected + 1), path.size());
+            FT_ASSERT_EQ(1, game_pathfinding_astar_path_is_valid(grid, path,
+                    sizes[size_index][0] - 1, sizes[size_index][1] - 1,
+                    sizes[size_index][2] - 1));
+        }
+        seed++;
+    }
+    FT_ASSERT(finder._scratch.visit_capacity >= 20 * 20);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, finder.destroy());
+    FT_ASSERT(finder._scratch.visit_stamp == ft_nullptr);
+    return (1);
+}
+
+FT_TEST(test_game_pathfinding_astar_scratch_survives_generation_wrap)
+{
+    game_map3d grid;
+    game_path_scratch scratch;
+    ft_vector<game_path_step> path;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, grid.initialize(4, 4, 1, 0));
+    grid.set(1, 0, 0, 1);
+    grid.set(1, 1, 0, 1);
+    grid.set(1, 2, 0, 1);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, path.initialize());
+    game_path_scratch_init(&scratch);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, game_path_astar_grid(grid, &scratch, 0, 0, 0, 2, 0, 0,
+            path));
+    FT_ASSERT_EQ(9u, path.size());
+    scratch.generation = UINT32_MAX / 2 - 1;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, game_path_astar_grid(grid, &scratch, 0, 0, 0, 2, 0, 0,
+            path));
+    FT_ASSERT_EQ(9u, path.size());
+    FT_ASSERT_EQ(1u, scratch.generation);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, game_path_astar_grid(grid, &scratch, 3, 3, 0, 3, 3, 0,
+            path));
+    FT_ASSERT_EQ(1u, path.size());
+    FT_ASSERT_EQ(3u, path[0].get_x());
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, game_path_astar_grid(grid, &scratch,
+            0, 0, 0, 1, 1, 0, path));
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, game_path_astar_grid(grid, &scratch,
+            0, 0, 0, 4, 0, 0, path));
+    grid.set(1, 3, 0, 1);
+    FT_ASSERT_EQ(FT_ERR_GAME_INVALID_MOVE, game_path_astar_grid(grid, &scratch,
+            0, 0, 0, 2, 0, 0, path));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, game_path_astar_grid(grid, ft_nullptr,
+            0, 0, 0, 0, 0, 0, path));
+    game_path_scratch_destroy(&scratch);
+    return (1);
+}
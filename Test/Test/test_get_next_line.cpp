@@ -234,14 +234,14 @@ FT_TEST(test_get_next_line_hash_map_allocation_failure_is_reported)
 {
     int     file_descriptor;
     char    *line;
-    int     filler_descriptors[6];
+    int     filler_descriptors[14];
     int     filler_count;
     int     cleanup_index;
     char    *filler_line;
 
     gnl_reset_all_streams();
     filler_count = 0;
-    while (filler_count < 5)
+    while (filler_count < 14)
     {
         filler_descriptors[filler_count] = create_temp_fd_with_content("alpha\nbeta\n");
         FT_ASSERT(filler_descriptors[filler_count] >= 0);
@@ -0,0 +1,170 @@
+#include "../test_internal.hpp"
+#include "../../Modules/JSon/json.hpp"
+#include "../../Modules/JSon/json_arena.hpp"
+#include "../../Modules/JSon/json_dom_bridge.hpp"
+#include "../../Modules/JSon/document.hpp"
+#include "../../Modules/Parser/dom.hpp"
+#include "../../Modules/CPP_class/class_string.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include <cstdio>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_json_arena_parses_nested_values_in_place)
+{
+    json_arena_document document;
+    const json_arena_value *value;
+    ft_size_t length;
+    int64_t integer_value;
+    double real_value;
+    ft_bool boolean_value;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.parse(
+            "{ \"name\": \"caf\\u00e9 \\\"bar\\\"\", \"count\": -42, \"ratio\": 2.5e1,"
+            " \"flags\": [true, false, null], \"nested\": { \"a/b\": { \"x~y\": 7 } } }"));
+    value = document.find("name");
+    FT_ASSERT(value != ft_nullptr);
+    FT_ASSERT(ft_strcmp(json_arena_get_string(value, &length), "caf\xc3\xa9 \"bar\"") == 0);
+    FT_ASSERT_EQ(11, length);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_arena_get_int64(document.find("count"), &integer_value));
+    FT_ASSERT_EQ(-42, integer_value);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_arena_get_double(document.find("ratio"), &real_value));
+    FT_ASSERT(real_value > 24.999 && real_value < 25.001);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_arena_get_int64(document.find("ratio"),
+            &integer_value));
+    value = document.find("flags");
+    FT_ASSERT(value != ft_nullptr);
+    FT_ASSERT_EQ(JSON_ARENA_ARRAY, value->type);
+    FT_ASSERT_EQ(3, value->length);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_arena_get_boolean(json_arena_array_at(value, 0),
+            &boolean_value));
+    FT_ASSERT_EQ(FT_TRUE, boolean_value);
+    FT_ASSERT_EQ(JSON_ARENA_NULL, json_arena_array_at(value, 2)->type);
+    FT_ASSERT(json_arena_array_at(value, 3) == ft_nullptr);
+    value = json_arena_find_by_pointer(document.root(), "/nested/a~1b/x~0y");
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_arena_get_int64(value, &integer_value));
+    FT_ASSERT_EQ(7, integer_value);
+    FT_ASSERT(json_arena_find_by_pointer(document.root(), "/flags/1") != ft_nullptr);
+    FT_ASSERT(json_arena_find_by_pointer(document.root(), "/flags/01") == ft_nullptr);
+    FT_ASSERT(document.find("missing") == ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.destroy());
+    return (1);
+}
+
+FT_TEST(test_json_arena_indexes_large_objects)
+{
+    json_arena_document document;
+    ft_string content;
+    char key[32];
+    const json_arena_value *value;
+    int64_t integer_value;
+    int key_index;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, content.initialize("{"));
+    key_index = 0;
+    while (key_index < 500)
+    {
+        if (key_index > 0)
+            FT_ASSERT_EQ(FT_ERR_SUCCESS, content.append(","));
+        FT_ASSERT(std::snprintf(key, sizeof(key), "\"key%d\":%d", key_index,
+                key_index * 3) > 0);
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, content.append(key));
+        key_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, content.append(",\"key7\":-1}"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.parse(content.c_str(), content.size()));
+    FT_ASSERT(document.root()->index != ft_nullptr);
+    FT_ASSERT_EQ(501, document.root()->length);
+    key_index = 0;
+    while (key_index < 500)
+    {
+        FT_ASSERT(std::snprintf(key, sizeof(key), "key%d", key_index) > 0);
+        value = document.find(key);
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, json_arena_get_int64(value, &integer_value));
+        if (key_index == 7)
+            FT_ASSERT_EQ(21, integer_value);
+        else
+            FT_ASSERT_EQ(key_index * 3, integer_value);
+        key_index++;
+    }
+    FT_ASSERT(document.find("key500") == ft_nullptr);
+    FT_ASSERT(document.reserved_bytes() >= content.size());
+    document.clear();
+    FT_ASSERT(document.root() == ft_nullptr);
+    FT_ASSERT_EQ(0, document.reserved_bytes());
+    return (1);
+}
+
+FT_TEST(test_json_arena_rejects_malformed_input)
+{
+    json_arena_document document;
+    ft_string deep;
+    int depth;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.initialize());
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.parse("{\"a\": 1,}"));
+    FT_ASSERT(document.root() == ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.get_error());
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.parse("{\"a\": \"unterminated}"));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.parse("[01]"));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.parse("{\"a\": \"\\ud800\"}"));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.parse("[1] [2]"));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.parse("tru"));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.parse(ft_nullptr));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, deep.initialize());
+    depth = 0;
+    while (depth < JSON_ARENA_MAX_DEPTH + 1)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, deep.append("["));
+        depth++;
+    }
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, document.parse(deep.c_str()));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.parse("  [ ]  "));
+    FT_ASSERT_EQ(JSON_ARENA_ARRAY, document.root()->type);
+    FT_ASSERT_EQ(0, document.root()->length);
+    return (1);
+}
+
+FT_TEST(test_json_arena_bridges_to_group_document_and_dom)
+{
+    json_arena_document arena_document;
+    json_document document;
+    ft_dom_document dom;
+    json_group *group;
+    json_item *item;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, arena_document.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, arena_document.parse(
+            "{\"server\": {\"host\": \"example\", \"port\": 8080, \"tls\": true},"
+            " \"limits\": {\"burst\": 12345678901234567890}}"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_arena_document_to_document(arena_document, document));
+    group = document.find_group("server");
+    FT_ASSERT(group != ft_nullptr);
+    item = document.find_item(group, "port");
+    FT_ASSERT(item != ft_nullptr);
+    FT_ASSERT(ft_strcmp(item->value, "8080") == 0);
+    item = document.find_item(group, "tls");
+    FT_ASSERT(item != ft_nullptr);
+    FT_ASSERT(ft_strcmp(item->value, "true") == 0);
+    group = document.find_group("limits");
+    FT_ASSERT(group != ft_nullptr);
+    item = document.find_item(group, "burst");
+    FT_ASSERT(item != ft_nullptr);
+    FT_ASSERT(ft_strcmp(item->value, "12345678901234567890") == 0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, dom.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_arena_document_to_dom(arena_document, dom));
+    FT_ASSERT(dom.get_root() != ft_nullptr);
+    FT_ASSERT_EQ(2, dom.get_root()->get_children().size());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, arena_document.parse("{\"server\": {\"list\": [1]}}"));
+    FT_ASSERT_EQ(FT_ERR_UNSUPPORTED_TYPE, json_arena_document_to_document(arena_document,
+            document));
+    FT_ASSERT(document.get_groups() == ft_nullptr);
+    return (1);
+}
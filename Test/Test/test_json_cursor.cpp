@@ -0,0 +1,146 @@
+#include "../test_internal.hpp"
+#include "../../Modules/JSon/json_cursor.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static const char *g_json_cursor_sample =
+    "{\"skip\": {\"deep\": [[1, {\"}\": \"]\"}], \"x\\\"y\"], \"more\": {}},"
+    " \"list\": [10, -20, 3.5e1, \"a\\u00e9\\\\b\", true, null, [], {\"k\": false}],"
+    " \"se\\u0063ret\": \"found\", \"a/b\": {\"m~n\": 7}, \"big\": 9223372036854775808}";
+
+FT_TEST(test_json_cursor_finds_keys_and_pointers_without_materializing)
+{
+    json_cursor_document document;
+    json_cursor root;
+    json_cursor value;
+    json_cursor_view view;
+    ft_bool has_escapes;
+    int64_t number;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.open(g_json_cursor_sample));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.root(&root));
+    FT_ASSERT_EQ(JSON_CURSOR_OBJECT, json_cursor_get_type(&root));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_find_key(&root, "secret", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_string(&value, &view, &has_escapes));
+    FT_ASSERT_EQ(5, view.length);
+    FT_ASSERT(ft_memcmp(view.data, "found", 5) == 0);
+    FT_ASSERT_EQ(FT_FALSE, has_escapes);
+    FT_ASSERT(view.data > g_json_cursor_sample);
+    FT_ASSERT(view.data < g_json_cursor_sample + ft_strlen_size_t(g_json_cursor_sample));
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, json_cursor_find_key(&root, "deep", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/list/1", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_int64(&value, &number));
+    FT_ASSERT_EQ(-20, number);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/a~1b/m~0n", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_int64(&value, &number));
+    FT_ASSERT_EQ(7, number);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/skip/deep/0/1/}", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_raw(&value, &view));
+    FT_ASSERT_EQ(1, view.length);
+    FT_ASSERT_EQ(']', view.data[0]);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/skip/deep/0", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_raw(&value, &view));
+    FT_ASSERT_EQ(15, view.length);
+    FT_ASSERT(ft_memcmp(view.data, "[1, {\"}\": \"]\"}]", 15) == 0);
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, document.find("/list/8", &value));
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, document.find("/list/01", &value));
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, document.find("/secret/x", &value));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.find("list", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/big", &value));
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, json_cursor_get_int64(&value, &number));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.destroy());
+    return (1);
+}
+
+FT_TEST(test_json_cursor_iterates_children_and_reads_scalars)
+{
+    json_cursor_document document;
+    json_cursor list;
+    json_cursor child;
+    json_cursor_view view;
+    char buffer[16];
+    ft_size_t length;
+    ft_size_t count;
+    double real;
+    int64_t number;
+    ft_bool flag;
+    ft_bool has_escapes;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.open(g_json_cursor_sample));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/list", &list));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_first_child(&list, &child));
+    count = 1;
+    while (json_cursor_next_sibling(&child) == FT_ERR_SUCCESS)
+        count++;
+    FT_ASSERT_EQ(8, count);
+    FT_ASSERT_EQ(JSON_CURSOR_OBJECT, json_cursor_get_type(&child));
+    FT_ASSERT_EQ(FT_ERR_END_OF_FILE, json_cursor_next_sibling(&child));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_array_at(&list, 2, &child));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_double(&child, &real));
+    FT_ASSERT(real > 34.9 && real < 35.1);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_cursor_get_int64(&child, &number));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_array_at(&list, 3, &child));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_string(&child, &view, &has_escapes));
+    FT_ASSERT_EQ(FT_TRUE, has_escapes);
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, json_cursor_copy_string(&child, buffer, 4, &length));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_copy_string(&child, buffer, sizeof(buffer),
+            &length));
+    FT_ASSERT_EQ(5, length);
+    FT_ASSERT(ft_memcmp(buffer, "a\xc3\xa9\\b", 5) == 0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_array_at(&list, 4, &child));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_get_boolean(&child, &flag));
+    FT_ASSERT_EQ(FT_TRUE, flag);
+    FT_ASSERT_EQ(FT_ERR_UNSUPPORTED_TYPE, json_cursor_get_double(&child, &real));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_next_sibling(&child));
+    FT_ASSERT_EQ(JSON_CURSOR_NULL, json_cursor_get_type(&child));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_next_sibling(&child));
+    FT_ASSERT_EQ(FT_ERR_END_OF_FILE, json_cursor_first_child(&child, &list));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.root(&list));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_first_child(&list, &child));
+    count = 0;
+    while (json_cursor_get_key(&child, &view, &has_escapes) == FT_ERR_SUCCESS)
+    {
+        count++;
+        if (json_cursor_next_sibling(&child) != FT_ERR_SUCCESS)
+            break ;
+    }
+    FT_ASSERT_EQ(5, count);
+    FT_ASSERT_EQ(3, view.length);
+    FT_ASSERT(ft_memcmp(view.data, "big", 3) == 0);
+    FT_ASSERT_EQ(FT_ERR_UNSUPPORTED_TYPE, json_cursor_get_key(&list, &view, ft_nullptr));
+    return (1);
+}
+
+FT_TEST(test_json_cursor_reports_malformed_input_lazily)
+{
+    json_cursor_document document;
+    json_cursor root;
+    json_cursor value;
+    json_cursor_view view;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.initialize());
+    FT_ASSERT_EQ(FT_ERR_INVALID_STATE, document.root(&root));
+    FT_ASSERT_EQ(FT_ERR_EMPTY, document.open("  \n "));
+    FT_ASSERT_EQ(FT_ERR_EMPTY, document.get_error());
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.open("{\"a\": \"open}"));
+    FT_ASSERT_EQ(FT_ERR_INVALID_STATE, document.root(&root));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.open("{\"a\": [1, 2 \"b\": 3}"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/a/1", &value));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.find("/b", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.open("{\"a\": {\"b\": [1}"));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, document.find("/c", &value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.open("{\"a\": 12x, \"b\": nul}"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.find("/a", &value));
+    FT_ASSERT_EQ(JSON_CURSOR_INVALID, json_cursor_get_type(&value));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, document.root(&root));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_cursor_find_key(&root, "b", &value));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_cursor_get_raw(&value, &view));
+    return (1);
+}
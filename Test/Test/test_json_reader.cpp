@@ -58,6 +58,14 @@ FT_TEST(test_json_read_from_string_missing_exponent_digits_sets_errno)
     return (1);
 }
 
+FT_TEST(test_json_read_from_string_rejects_invalid_utf8_in_strings)
+{
+    const char *content = "{\"g\": {\"k\": \"caf\xe9\"}}";
+    json_group *groups = json_read_from_string(content);
+    FT_ASSERT(groups == ft_nullptr);
+    return (1);
+}
+
 FT_TEST(test_json_read_from_string_success_resets_errno)
 {
     const char *content = "{ \"config\": { \"name\": \"value\" } }";
@@ -0,0 +1,244 @@
+#include "../test_internal.hpp"
+#include "../../Modules/JSon/json.hpp"
+#include "../../Modules/JSon/json_structural_index.hpp"
+#include "../../Modules/CPP_class/class_string.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include <cstdio>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+typedef struct json_structural_event_log
+{
+    ft_string text;
+    int32_t stop_after;
+    int32_t seen;
+} json_structural_event_log;
+
+static int32_t json_structural_test_record(void *user_data, const json_stream_event *event)
+{
+    json_structural_event_log *log;
+    static const char *names = "(){}[]KSNBZ";
+
+    log = static_cast<json_structural_event_log *>(user_data);
+    log->seen++;
+    if (log->stop_after != 0 && log->seen >= log->stop_after)
+        return (FT_ERR_INVALID_OPERATION);
+    if (log->text.append(&names[event->type], 1) != FT_ERR_SUCCESS)
+        return (FT_ERR_NO_MEMORY);
+    if (event->type == JSON_STREAM_EVENT_KEY || event->type == JSON_STREAM_EVENT_STRING
+        || event->type == JSON_STREAM_EVENT_NUMBER)
+    {
+        if (log->text.append(event->value.data, event->value.length) != FT_ERR_SUCCESS)
+            return (FT_ERR_NO_MEMORY);
+    }
+    if (event->type == JSON_STREAM_EVENT_BOOLEAN && event->bool_value == FT_TRUE)
+    {
+        if (log->text.append("1", 1) != FT_ERR_SUCCESS)
+            return (FT_ERR_NO_MEMORY);
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t json_structural_test_build_sample(ft_string &content)
+{
+    char entry[96];
+    int32_t entry_index;
+    int32_t error_code;
+
+    error_code = content.initialize("{\"records\": [");
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    entry_index = 0;
+    while (entry_index < 200)
+    {
+        if (std::snprintf(entry, sizeof(entry),
+                "%s{\"id\": %d, \"name\": \"n\\\\%d\\\"q\xc3\xa9\", \"ok\": %s, \"v\": -%d.5e2}",
+                entry_index == 0 ? "" : ",", entry_index, entry_index,
+                entry_index % 2 == 0 ? "true" : "null", entry_index) <= 0)
+            return (FT_ERR_INVALID_STATE);
+        error_code = content.append(entry);
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+        entry_index++;
+    }
+    return (content.append("]}"));
+}
+
+FT_TEST(test_json_structural_index_backends_agree)
+{
+    ft_string content;
+    json_structural_index reference;
+    json_structural_index candidate;
+    json_structural_backend backends[3];
+    int32_t backend_index;
+
+    backends[0] = JSON_STRUCTURAL_BACKEND_SCALAR;
+    backends[1] = JSON_STRUCTURAL_BACKEND_SSE2;
+    backends[2] = JSON_STRUCTURAL_BACKEND_AVX2;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_test_build_sample(content));
+    json_structural_index_init(&reference);
+    json_structural_index_init(&candidate);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_set_backend(JSON_STRUCTURAL_BACKEND_SCALAR));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_index_build(&reference, content.c_str(),
+            content.size()));
+    FT_ASSERT(reference.count > 200 * 20);
+    backend_index = 1;
+    while (backend_index < 3)
+    {
+        if (json_structural_backend_supported(backends[backend_index]))
+        {
+            FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_set_backend(backends[backend_index]));
+            FT_ASSERT_EQ(backends[backend_index], json_structural_get_backend());
+            FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_index_build(&candidate,
+                    content.c_str(), content.size()));
+            FT_ASSERT_EQ(reference.count, candidate.count);
+            FT_ASSERT(ft_memcmp(reference.positions, candidate.positions,
+                    reference.count * sizeof(uint32_t)) == 0);
+        }
+        else
+            FT_ASSERT_EQ(FT_ERR_UNSUPPORTED_TYPE,
+                json_structural_set_backend(backends[backend_index]));
+        backend_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_set_backend(JSON_STRUCTURAL_BACKEND_AUTO));
+    json_structural_index_destroy(&reference);
+    json_structural_index_destroy(&candidate);
+    return (1);
+}
+
+FT_TEST(test_json_structural_index_tracks_escapes_and_scalars)
+{
+    json_structural_index index;
+    const char *content;
+    const uint32_t expected[] = {0, 1, 8, 9, 11, 12, 16, 18, 22, 23, 24, 26, 28, 29, 30, 32};
+    ft_size_t entry;
+
+    content = "{\"a\\\\\\\"b\": [true, \"}\\\\\"], \"c\":-1}";
+    json_structural_index_init(&index);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_index_build(&index, content,
+            ft_strlen_size_t(content)));
+    FT_ASSERT_EQ(sizeof(expected) / sizeof(expected[0]), index.count);
+    entry = 0;
+    while (entry < index.count)
+    {
+        FT_ASSERT_EQ(expected[entry], index.positions[entry]);
+        entry++;
+    }
+    json_structural_index_destroy(&index);
+    return (1);
+}
+
+static int json_structural_test_rejections(json_structural_index *index)
+{
+    char split[80];
+
+    if (json_structural_index_build(index, "{\"a\": \"open}", 12) != FT_ERR_INVALID_ARGUMENT
+        || json_structural_index_build(index, "[\"tab\there\"]", 12) != FT_ERR_INVALID_ARGUMENT
+        || json_structural_index_build(index, "[\"\xc0\xaf\"]", 6) != FT_ERR_INVALID_ARGUMENT
+        || json_structural_index_build(index, "[\"\xed\xa0\x80\"]", 7) != FT_ERR_INVALID_ARGUMENT
+        || json_structural_index_build(index, "[\"\xf4\x90\x80\x80\"]", 8)
+            != FT_ERR_INVALID_ARGUMENT
+        || json_structural_index_build(index, "\"\xe2\x82", 3) != FT_ERR_INVALID_ARGUMENT
+        || json_structural_index_build(index, "\t[1]\n", 5) != FT_ERR_SUCCESS)
+        return (0);
+    ft_memset(split, ' ', sizeof(split));
+    split[0] = '"';
+    split[62] = '\xf0';
+    split[63] = '\x9f';
+    split[64] = '\x98';
+    split[65] = '\x80';
+    split[79] = '"';
+    if (json_structural_index_build(index, split, sizeof(split)) != FT_ERR_SUCCESS
+        || index->count != 2)
+        return (0);
+    split[65] = 'x';
+    if (json_structural_index_build(index, split, sizeof(split)) != FT_ERR_INVALID_ARGUMENT)
+        return (0);
+    split[65] = '\x80';
+    split[63] = ' ';
+    return (json_structural_index_build(index, split, sizeof(split)) == FT_ERR_INVALID_ARGUMENT);
+}
+
+FT_TEST(test_json_structural_index_rejects_bad_strings_and_utf8)
+{
+    json_structural_index index;
+    json_structural_backend backend;
+
+    json_structural_index_init(&index);
+    backend = JSON_STRUCTURAL_BACKEND_SCALAR;
+    while (backend <= JSON_STRUCTURAL_BACKEND_AVX2)
+    {
+        if (json_structural_set_backend(backend) == FT_ERR_SUCCESS)
+            FT_ASSERT_EQ(1, json_structural_test_rejections(&index));
+        backend = static_cast<json_structural_backend>(backend + 1);
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_set_backend(JSON_STRUCTURAL_BACKEND_AUTO));
+    json_structural_index_destroy(&index);
+    return (1);
+}
+
+FT_TEST(test_json_structural_read_events_matches_stream_grammar)
+{
+    json_structural_event_log log;
+    const char *content;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, log.text.initialize());
+    log.stop_after = 0;
+    log.seen = 0;
+    content = "{\"k\": [1, -2.5e3, \"s\\u00e9\", true, false, null, {}], \"e\": []}";
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_read_events(content,
+            ft_strlen_size_t(content), json_structural_test_record, &log));
+    FT_ASSERT(ft_strcmp(log.text.c_str(),
+            "({Kk[N1N-2.5e3Ss\xc3\xa9" "B1BZ{}]Ke[]})") == 0);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_structural_read_events("[1,]", 4,
+            ft_nullptr, ft_nullptr));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_structural_read_events("{\"a\" 1}", 7,
+            ft_nullptr, ft_nullptr));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_structural_read_events("[1 2]", 5,
+            ft_nullptr, ft_nullptr));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_structural_read_events("[truex]", 7,
+            ft_nullptr, ft_nullptr));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, json_structural_read_events("{\"a\":1}]", 8,
+            ft_nullptr, ft_nullptr));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, json_structural_read_events(" 42 ", 4,
+            ft_nullptr, ft_nullptr));
+    log.stop_after = 3;
+    log.seen = 0;
+    FT_ASSERT_EQ(FT_ERR_INVALID_OPERATION, json_structural_read_events("[1, 2]", 6,
+            json_structural_test_record, &log));
+    return (1);
+}
+
+FT_TEST(test_json_read_from_string_uses_structural_index)
+{
+    ft_string content;
+    json_group *groups;
+    json_item *item;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, content.initialize("{\"g\": {"));
+    while (content.size() < 150)
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, content.append("\"pad\": \"xxxxxxxx\", "));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, content.append(
+            "\"quote\": \"a\\\"b\\\\\", \"n\": +12.5E-3 \"t\": true},"
+            " \"h\": {}}"));
+    groups = json_read_from_string(content.c_str());
+    FT_ASSERT(groups != ft_nullptr);
+    item = json_find_item(groups, "quote");
+    FT_ASSERT(item != ft_nullptr);
+    FT_ASSERT(ft_strcmp(item->value, "a\"b\\") == 0);
+    item = json_find_item(groups, "n");
+    FT_ASSERT(item != ft_nullptr);
+    FT_ASSERT(ft_strcmp(item->value, "+12.5E-3") == 0);
+    item = json_find_item(groups, "t");
+    FT_ASSERT(item != ft_nullptr);
+    FT_ASSERT(ft_strcmp(item->value, "true") == 0);
+    FT_ASSERT(json_find_group(groups, "h") != ft_nullptr);
+    json_free_groups(groups);
+    FT_ASSERT(json_read_from_string("{\"g\": {\"a\": 12x}}") == ft_nullptr);
+    FT_ASSERT(json_read_from_string("{\"g\": {\"a\": \"\xff\"}}") == ft_nullptr);
+    return (1);
+}
@@ -0,0 +1,229 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Logger/logger.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/Printf/printf.hpp"
+#include <cstdarg>
+#include <cstring>
+#include <atomic>
+#include <thread>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+struct logger_ring_sink_context
+{
+    std::atomic<ft_size_t> handled_messages;
+    std::atomic<ft_size_t> longest_message;
+    char first_message[256];
+};
+
+static int32_t logger_ring_sink(const char *message, void *user_data)
+{
+    logger_ring_sink_context *context;
+    ft_size_t length;
+    ft_size_t longest;
+
+    context = static_cast<logger_ring_sink_context *>(user_data);
+    if (context == ft_nullptr || message == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (context->handled_messages.fetch_add(1) == 0)
+        ft_strlcpy(context->first_message, message, sizeof(context->first_message));
+    length = ft_strlen_size_t(message);
+    longest = context->longest_message.load();
+    while (length > longest
+        && !context->longest_message.compare_exchange_weak(longest, length))
+        continue ;
+    return (FT_ERR_SUCCESS);
+}
+
+static void logger_ring_enqueue(const char *format_string, ...)
+{
+    va_list argument_list;
+
+    va_start(argument_list, format_string);
+    ft_log_enqueue(LOG_LEVEL_ERROR, format_string, argument_list);
+    va_end(argument_list);
+    return ;
+}
+
+static void logger_ring_prepare_context(logger_ring_sink_context *context)
+{
+    context->handled_messages.store(0);
+    context->longest_message.store(0);
+    context->first_message[0] = '\0';
+    return ;
+}
+
+FT_TEST(test_logger_async_ring_drop_oldest_keeps_newest_messages)
+{
+    logger_ring_sink_context context;
+    s_log_async_metrics metrics;
+    ft_size_t original_limit;
+    int message_index;
+
+    logger_ring_prepare_context(&context);
+    ft_log_enable_async(FT_FALSE);
+    original_limit = ft_log_get_async_queue_limit();
+    ft_log_set_async_queue_limit(4);
+    ft_log_set_async_overflow_policy(LOG_ASYNC_OVERFLOW_DROP_OLDEST);
+    ft_log_reset_async_metrics();
+    message_index = 0;
+    while (message_index < 10)
+    {
+        logger_ring_enqueue("ring-oldest-%d", message_index);
+        message_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_async_metrics(&metrics));
+    FT_ASSERT_EQ(4, metrics.pending_messages);
+    FT_ASSERT_EQ(6, metrics.dropped_messages);
+    FT_ASSERT_EQ(6, metrics.dropped_oldest_messages);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_sink(logger_ring_sink, &context));
+    ft_log_enable_async(FT_TRUE);
+    ft_log_enable_async(FT_FALSE);
+    ft_log_remove_sink(logger_ring_sink, &context);
+    ft_log_set_async_overflow_policy(LOG_ASYNC_OVERFLOW_DROP_NEWEST);
+    ft_log_set_async_queue_limit(original_limit);
+    ft_log_reset_async_metrics();
+    FT_ASSERT_EQ(4, context.handled_messages.load());
+    FT_ASSERT(std::strstr(context.first_message, "ring-oldest-6") != ft_nullptr);
+    return (1);
+}
+
+FT_TEST(test_logger_async_ring_block_policy_delivers_every_message)
+{
+    logger_ring_sink_context context;
+    s_log_async_metrics metrics;
+    ft_size_t original_limit;
+
+    logger_ring_prepare_context(&context);
+    ft_log_enable_async(FT_FALSE);
+    original_limit = ft_log_get_async_queue_limit();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_sink(logger_ring_sink, &context));
+    ft_log_set_async_queue_limit(8);
+    ft_log_set_async_overflow_policy(LOG_ASYNC_OVERFLOW_BLOCK);
+    ft_log_enable_async(FT_TRUE);
+    auto producer = []()
+    {
+        int message_index;
+
+        message_index = 0;
+        while (message_index < 500)
+        {
+            logger_ring_enqueue("ring-block-%d", message_index);
+            message_index++;
+        }
+        return ;
+    };
+    std::thread first_producer(producer);
+    std::thread second_producer(producer);
+    std::thread third_producer(producer);
+    std::thread fourth_producer(producer);
+    first_producer.join();
+    second_producer.join();
+    third_producer.join();
+    fourth_producer.join();
+    ft_log_enable_async(FT_FALSE);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_async_metrics(&metrics));
+    ft_log_remove_sink(logger_ring_sink, &context);
+    ft_log_set_async_overflow_policy(LOG_ASYNC_OVERFLOW_DROP_NEWEST);
+    ft_log_set_async_queue_limit(original_limit);
+    ft_log_reset_async_metrics();
+    FT_ASSERT_EQ(2000, context.handled_messages.load());
+    FT_ASSERT_EQ(0, metrics.pending_messages);
+    FT_ASSERT_EQ(0, metrics.dropped_messages);
+    FT_ASSERT(metrics.peak_pending_messages <= 8);
+    FT_ASSERT(metrics.worker_wakeups < 2000);
+    return (1);
+}
+
+FT_TEST(test_logger_async_ring_spills_long_messages_to_heap)
+{
+    logger_ring_sink_context context;
+    s_log_async_metrics metrics;
+    char long_text[FT_LOG_ASYNC_SLOT_SIZE + 64];
+    ft_size_t index;
+
+    index = 0;
+    while (index + 1 < sizeof(long_text))
+    {
+        long_text[index] = 'x';
+        index++;
+    }
+    long_text[index] = '\0';
+    logger_ring_prepare_context(&context);
+    ft_log_enable_async(FT_FALSE);
+    ft_log_reset_async_metrics();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_sink(logger_ring_sink, &context));
+    ft_log_enable_async(FT_TRUE);
+    logger_ring_enqueue("%s", long_text);
+    logger_ring_enqueue("short");
+    ft_log_enable_async(FT_FALSE);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_async_metrics(&metrics));
+    ft_log_remove_sink(logger_ring_sink, &context);
+    ft_log_reset_async_metrics();
+    FT_ASSERT_EQ(2, context.handled_messages.load());
+    FT_ASSERT(context.longest_message.load() > sizeof(long_text) - 1);
+    FT_ASSERT_EQ(1, metrics.overflow_allocations);
+    return (1);
+}
+
+FT_TEST(test_logger_async_ring_enqueue_allocates_only_in_the_formatter)
+{
+    logger_ring_sink_context context;
+    char formatted[64];
+    ft_size_t original_limit;
+    ft_size_t allocation_count_start;
+    ft_size_t free_count_start;
+    ft_size_t allocation_count_formatted;
+    ft_size_t free_count_formatted;
+    ft_size_t allocation_count_enqueued;
+    ft_size_t free_count_enqueued;
+    int message_index;
+
+    logger_ring_prepare_context(&context);
+    ft_log_enable_async(FT_FALSE);
+    original_limit = ft_log_get_async_queue_limit();
+    ft_log_set_async_queue_limit(64);
+    ft_log_reset_async_metrics();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction("secret"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_context_push_field("request_id", "42"));
+    logger_ring_enqueue("ring-warm-up secret");
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocation_count_start,
+            &free_count_start));
+    message_index = 0;
+    while (message_index < 32)
+    {
+        pf_snprintf(formatted, sizeof(formatted), "ring-alloc-%d secret", message_index);
+        message_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocation_count_formatted,
+            &free_count_formatted));
+    message_index = 0;
+    while (message_index < 32)
+    {
+        logger_ring_enqueue("ring-alloc-%d secret", message_index);
+        message_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocation_count_enqueued,
+            &free_count_enqueued));
+    ft_log_context_pop(1);
+    ft_log_clear_redactions();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_sink(logger_ring_sink, &context));
+    ft_log_enable_async(FT_TRUE);
+    ft_log_enable_async(FT_FALSE);
+    ft_log_remove_sink(logger_ring_sink, &context);
+    ft_log_set_async_queue_limit(original_limit);
+    ft_log_reset_async_metrics();
+    FT_ASSERT_EQ(allocation_count_formatted - allocation_count_start,
+        allocation_count_enqueued - allocation_count_formatted);
+    FT_ASSERT_EQ(free_count_formatted - free_count_start,
+        free_count_enqueued - free_count_formatted);
+    FT_ASSERT_EQ(33, context.handled_messages.load());
+    FT_ASSERT(std::strstr(context.first_message,
+            "message=\"ring-warm-up [REDACTED]\" request_id=42\n") != ft_nullptr);
+    return (1);
+}
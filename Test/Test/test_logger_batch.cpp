@@ -0,0 +1,187 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Logger/logger.hpp"
+#include "../../Modules/Logger/logger_internal.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Networking/networking.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static ssize_t logger_batch_read_file(const char *path, char *buffer, size_t buffer_size)
+{
+    int file_descriptor;
+    ssize_t read_count;
+
+    file_descriptor = open(path, O_RDONLY);
+    if (file_descriptor < 0)
+        return (-1);
+    read_count = read(file_descriptor, buffer, buffer_size - 1);
+    close(file_descriptor);
+    if (read_count < 0)
+        return (-1);
+    buffer[read_count] = '\0';
+    return (read_count);
+}
+
+static ft_size_t logger_batch_count_lines(const char *text, const char *needle)
+{
+    ft_size_t count;
+    const char *cursor;
+
+    count = 0;
+    cursor = ft_strstr(text, needle);
+    while (cursor != ft_nullptr)
+    {
+        count++;
+        cursor = ft_strstr(cursor + 1, needle);
+    }
+    return (count);
+}
+
+FT_TEST(test_logger_batch_coalesces_file_writes_until_flush)
+{
+    char template_path[256];
+    char read_buffer[8192];
+    ft_size_t record_count;
+    ft_size_t syscall_count;
+    int temp_fd;
+    int message_index;
+
+    temp_fd = test_create_temp_file_from_template(template_path,
+            sizeof(template_path), ft_nullptr);
+    FT_ASSERT(temp_fd >= 0);
+    close(temp_fd);
+    ft_log_close();
+    FT_ASSERT_EQ(0, ft_log_set_file(template_path, 0));
+    ft_log_set_batching(16384, 0);
+    ft_log_reset_write_statistics();
+    message_index = 0;
+    while (message_index < 20)
+    {
+        ft_log_info("batched record %d", message_index);
+        message_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_write_statistics(&record_count, &syscall_count));
+    FT_ASSERT_EQ(20, record_count);
+    FT_ASSERT_EQ(0, syscall_count);
+    FT_ASSERT_EQ(0, logger_batch_read_file(template_path, read_buffer, sizeof(read_buffer)));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_flush());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_write_statistics(&record_count, &syscall_count));
+    FT_ASSERT_EQ(1, syscall_count);
+    FT_ASSERT(logger_batch_read_file(template_path, read_buffer, sizeof(read_buffer)) > 0);
+    FT_ASSERT_EQ(20, logger_batch_count_lines(read_buffer, "batched record"));
+    FT_ASSERT(ft_strstr(read_buffer, "batched record 19") != ft_nullptr);
+    ft_log_close();
+    unlink(template_path);
+    return (1);
+}
+
+FT_TEST(test_logger_batch_error_level_and_shutdown_flush)
+{
+    char template_path[256];
+    char read_buffer[8192];
+    ft_size_t max_bytes;
+    uint32_t max_delay_ms;
+    int temp_fd;
+
+    temp_fd = test_create_temp_file_from_template(template_path,
+            sizeof(template_path), ft_nullptr);
+    FT_ASSERT(temp_fd >= 0);
+    close(temp_fd);
+    ft_log_close();
+    FT_ASSERT_EQ(0, ft_log_set_file(template_path, 0));
+    ft_log_set_batching(16384, 60000);
+    ft_log_get_batching(&max_bytes, &max_delay_ms);
+    FT_ASSERT_EQ(16384, max_bytes);
+    FT_ASSERT_EQ(60000, max_delay_ms);
+    ft_log_info("before error one");
+    ft_log_warn("before error two");
+    FT_ASSERT_EQ(0, logger_batch_read_file(template_path, read_buffer, sizeof(read_buffer)));
+    ft_log_error("error forces flush");
+    FT_ASSERT(logger_batch_read_file(template_path, read_buffer, sizeof(read_buffer)) > 0);
+    FT_ASSERT(ft_strstr(read_buffer, "before error one") != ft_nullptr);
+    FT_ASSERT(ft_strstr(read_buffer, "error forces flush") != ft_nullptr);
+    ft_log_info("pending at shutdown");
+    ft_log_close();
+    ft_log_get_batching(&max_bytes, &max_delay_ms);
+    FT_ASSERT_EQ(0, max_bytes);
+    FT_ASSERT(logger_batch_read_file(template_path, read_buffer, sizeof(read_buffer)) > 0);
+    FT_ASSERT(ft_strstr(read_buffer, "pending at shutdown") != ft_nullptr);
+    unlink(template_path);
+    return (1);
+}
+
+FT_TEST(test_logger_batch_size_threshold_writes_batch_with_new_record)
+{
+    char template_path[256];
+    char read_buffer[16384];
+    ft_size_t record_count;
+    ft_size_t syscall_count;
+    int temp_fd;
+    int message_index;
+
+    temp_fd = test_create_temp_file_from_template(template_path,
+            sizeof(template_path), ft_nullptr);
+    FT_ASSERT(temp_fd >= 0);
+    close(temp_fd);
+    ft_log_close();
+    FT_ASSERT_EQ(0, ft_log_set_file(template_path, 0));
+    ft_log_set_batching(512, 0);
+    ft_log_reset_write_statistics();
+    message_index = 0;
+    while (message_index < 40)
+    {
+        ft_log_info("threshold record %d", message_index);
+        message_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_write_statistics(&record_count, &syscall_count));
+    FT_ASSERT_EQ(40, record_count);
+    FT_ASSERT(syscall_count > 0);
+    FT_ASSERT(syscall_count < 20);
+    ft_log_close();
+    FT_ASSERT(logger_batch_read_file(template_path, read_buffer, sizeof(read_buffer)) > 0);
+    FT_ASSERT_EQ(40, logger_batch_count_lines(read_buffer, "threshold record"));
+    FT_ASSERT(ft_strstr(read_buffer, "threshold record 39") != ft_nullptr);
+    unlink(template_path);
+    return (1);
+}
+
+FT_TEST(test_logger_batch_stream_network_sink_flushes_with_one_send)
+{
+    s_network_sink sink;
+    char read_buffer[1024];
+    ft_size_t record_count;
+    ft_size_t syscall_count;
+    int socket_pair[2];
+    ssize_t read_count;
+
+    FT_ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, socket_pair));
+    sink.socket_fd = socket_pair[0];
+    sink.send_function = nw_send;
+    sink.use_tcp = FT_TRUE;
+    ft_log_set_batching(4096, 0);
+    ft_log_reset_write_statistics();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_network_sink("first;", &sink));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_network_sink("second;", &sink));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_network_sink("third;", &sink));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_write_statistics(&record_count, &syscall_count));
+    FT_ASSERT_EQ(3, record_count);
+    FT_ASSERT_EQ(0, syscall_count);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, logger_network_sink_flush_locked(&sink));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_write_statistics(&record_count, &syscall_count));
+    FT_ASSERT_EQ(1, syscall_count);
+    ft_log_set_batching(0, 0);
+    read_count = read(socket_pair[1], read_buffer, sizeof(read_buffer) - 1);
+    FT_ASSERT(read_count > 0);
+    read_buffer[read_count] = '\0';
+    FT_ASSERT(ft_strcmp(read_buffer, "first;second;third;") == 0);
+    close(socket_pair[0]);
+    close(socket_pair[1]);
+    return (1);
+}
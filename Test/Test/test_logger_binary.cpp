@@ -0,0 +1,259 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Logger/logger.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/CPP_class/class_string.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+struct logger_binary_text_context
+{
+    std::atomic<ft_size_t> handled_messages;
+    char last_message[512];
+};
+
+struct logger_binary_stream_context
+{
+    unsigned char *data;
+    ft_size_t size;
+    ft_size_t capacity;
+    ft_size_t calls;
+};
+
+static int32_t logger_binary_text_sink(const char *message, void *user_data)
+{
+    logger_binary_text_context *context;
+
+    context = static_cast<logger_binary_text_context *>(user_data);
+    if (context == ft_nullptr || message == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    context->handled_messages.fetch_add(1);
+    ft_strlcpy(context->last_message, message, sizeof(context->last_message));
+    return (FT_ERR_SUCCESS);
+}
+
+static int32_t logger_binary_stream_sink(const void *data, ft_size_t size, void *user_data)
+{
+    logger_binary_stream_context *context;
+    unsigned char *resized;
+
+    context = static_cast<logger_binary_stream_context *>(user_data);
+    if (context == ft_nullptr || data == ft_nullptr)
+        return (FT_ERR_INVALID_ARGUMENT);
+    if (context->size + size > context->capacity)
+    {
+        resized = static_cast<unsigned char *>(cma_realloc(context->data,
+                    context->size + size));
+        if (resized == ft_nullptr)
+            return (FT_ERR_NO_MEMORY);
+        context->data = resized;
+        context->capacity = context->size + size;
+    }
+    ft_memcpy(context->data + context->size, data, size);
+    context->size += size;
+    context->calls++;
+    return (FT_ERR_SUCCESS);
+}
+
+static ft_size_t logger_binary_count_occurrences(const char *text, const char *needle)
+{
+    ft_size_t count;
+    const char *cursor;
+
+    count = 0;
+    cursor = std::strstr(text, needle);
+    while (cursor != ft_nullptr)
+    {
+        count++;
+        cursor = std::strstr(cursor + 1, needle);
+    }
+    return (count);
+}
+
+FT_TEST(test_logger_binary_text_sink_matches_formatted_output)
+{
+    logger_binary_text_context context;
+
+    context.handled_messages.store(0);
+    context.last_message[0] = '\0';
+    ft_log_set_level(LOG_LEVEL_DEBUG);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_sink(logger_binary_text_sink, &context));
+    ft_log_enable_binary(FT_TRUE);
+    FT_ASSERT_EQ(FT_TRUE, ft_log_is_binary_enabled());
+    ft_log_info("binary %d %s %.2f %zu %c %x %%", -42, "text", 3.14159,
+        static_cast<size_t>(7), 'z', 255U);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_binary_flush());
+    FT_ASSERT_EQ(1, context.handled_messages.load());
+    FT_ASSERT(std::strstr(context.last_message,
+            "binary -42 text 3.14 7 z ff %") != ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_context_push_field("request_id", "77"));
+    ft_log_warn("with context %s", "attached");
+    ft_log_context_pop(1);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_binary_flush());
+    FT_ASSERT_EQ(2, context.handled_messages.load());
+    FT_ASSERT(std::strstr(context.last_message, "with context") != ft_nullptr);
+    FT_ASSERT(std::strstr(context.last_message, "request_id") != ft_nullptr);
+    FT_ASSERT(std::strstr(context.last_message, "77") != ft_nullptr);
+    ft_log_error("width %*d|", 5, 7);
+    ft_log_enable_binary(FT_FALSE);
+    FT_ASSERT_EQ(FT_FALSE, ft_log_is_binary_enabled());
+    ft_log_remove_sink(logger_binary_text_sink, &context);
+    FT_ASSERT_EQ(3, context.handled_messages.load());
+    FT_ASSERT(std::strstr(context.last_message, "width     7|") != ft_nullptr);
+    return (1);
+}
+
+FT_TEST(test_logger_binary_stream_decodes_to_text_lines)
+{
+    logger_binary_stream_context stream;
+    ft_log_binary_decoder decoder;
+    ft_string output;
+    ft_size_t split_offset;
+    int message_index;
+
+    stream.data = ft_nullptr;
+    stream.size = 0;
+    stream.capacity = 0;
+    stream.calls = 0;
+    ft_log_set_level(LOG_LEVEL_DEBUG);
+    ft_log_set_binary_sink(logger_binary_stream_sink, &stream);
+    ft_log_enable_binary(FT_TRUE);
+    message_index = 0;
+    while (message_index < 3)
+    {
+        ft_log_info("stream-record-%d-%s", message_index, "payload");
+        message_index++;
+    }
+    ft_log_enable_binary(FT_FALSE);
+    ft_log_set_binary_sink(ft_nullptr, ft_nullptr);
+    FT_ASSERT(stream.size > 0);
+    FT_ASSERT(stream.calls >= 1);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, output.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.initialize());
+    split_offset = stream.size / 2 + 3;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.decode(stream.data, split_offset, output));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.decode(stream.data + split_offset,
+            stream.size - split_offset, output));
+    FT_ASSERT_EQ(0, decoder.pending_bytes());
+    FT_ASSERT(std::strstr(output.c_str(), "stream-record-0-payload") != ft_nullptr);
+    FT_ASSERT(std::strstr(output.c_str(), "stream-record-2-payload") != ft_nullptr);
+    FT_ASSERT_EQ(3, logger_binary_count_occurrences(output.c_str(), "stream-record-"));
+    FT_ASSERT_EQ(3, logger_binary_count_occurrences(output.c_str(), "INFO"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.destroy());
+    cma_free(stream.data);
+    return (1);
+}
+
+FT_TEST(test_logger_binary_copies_formats_that_do_not_outlive_the_call)
+{
+    logger_binary_stream_context stream;
+    ft_log_binary_decoder decoder;
+    ft_string output;
+    char format_buffer[64];
+    char *heap_format;
+
+    stream.data = ft_nullptr;
+    stream.size = 0;
+    stream.capacity = 0;
+    stream.calls = 0;
+    heap_format = static_cast<char *>(cma_malloc(32));
+    FT_ASSERT(heap_format != ft_nullptr);
+    ft_log_set_level(LOG_LEVEL_DEBUG);
+    ft_log_set_binary_sink(logger_binary_stream_sink, &stream);
+    ft_log_enable_binary(FT_TRUE);
+    ft_strlcpy(format_buffer, "reused-first-%d", sizeof(format_buffer));
+    ft_log_info(format_buffer, 1);
+    ft_strlcpy(format_buffer, "reused-second-%s", sizeof(format_buffer));
+    ft_log_info(format_buffer, "tail");
+    ft_strlcpy(heap_format, "heap-format-%d", 32);
+    ft_log_warn(heap_format, 3);
+    ft_memset(heap_format, 'x', 31);
+    cma_free(heap_format);
+    ft_strlcpy(format_buffer, "reused-first-%d", sizeof(format_buffer));
+    ft_log_info(format_buffer, 4);
+    ft_log_enable_binary(FT_FALSE);
+    ft_log_set_binary_sink(ft_nullptr, ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, output.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.decode(stream.data, stream.size, output));
+    FT_ASSERT(std::strstr(output.c_str(), "reused-first-1") != ft_nullptr);
+    FT_ASSERT(std::strstr(output.c_str(), "reused-second-tail") != ft_nullptr);
+    FT_ASSERT(std::strstr(output.c_str(), "heap-format-3") != ft_nullptr);
+    FT_ASSERT(std::strstr(output.c_str(), "reused-first-4") != ft_nullptr);
+    FT_ASSERT_EQ(3, decoder._format_count);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.destroy());
+    cma_free(stream.data);
+    return (1);
+}
+
+FT_TEST(test_logger_binary_rejects_truncated_garbage)
+{
+    ft_log_binary_decoder decoder;
+    ft_string output;
+    unsigned char garbage[48];
+
+    ft_memset(garbage, 0, sizeof(garbage));
+    garbage[0] = 48;
+    garbage[4] = 9;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, output.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.initialize());
+    FT_ASSERT(decoder.decode(garbage, sizeof(garbage), output) != FT_ERR_SUCCESS);
+    FT_ASSERT_EQ(0, output.size());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, decoder.destroy());
+    return (1);
+}
+
+FT_TEST(test_logger_binary_multiple_producers_account_for_every_record)
+{
+    logger_binary_text_context context;
+    ft_size_t records_before;
+    ft_size_t dropped_before;
+    ft_size_t records_after;
+    ft_size_t dropped_after;
+
+    context.handled_messages.store(0);
+    context.last_message[0] = '\0';
+    ft_log_set_level(LOG_LEVEL_DEBUG);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_binary_statistics(&records_before,
+            &dropped_before));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_sink(logger_binary_text_sink, &context));
+    ft_log_enable_binary(FT_TRUE);
+    auto producer = []()
+    {
+        int message_index;
+
+        message_index = 0;
+        while (message_index < 400)
+        {
+            ft_log_debug("binary-producer-%d", message_index);
+            message_index++;
+        }
+        return ;
+    };
+    std::thread first_producer(producer);
+    std::thread second_producer(producer);
+    std::thread third_producer(producer);
+    std::thread fourth_producer(producer);
+    first_producer.join();
+    second_producer.join();
+    third_producer.join();
+    fourth_producer.join();
+    ft_log_enable_binary(FT_FALSE);
+    ft_log_remove_sink(logger_binary_text_sink, &context);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_get_binary_statistics(&records_after,
+            &dropped_after));
+    FT_ASSERT_EQ(1600, (records_after - records_before)
+        + (dropped_after - dropped_before));
+    FT_ASSERT_EQ(records_after - records_before, context.handled_messages.load());
+    FT_ASSERT(context.handled_messages.load() > 0);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, ft_log_get_binary_statistics(ft_nullptr,
+            &dropped_after));
+    return (1);
+}
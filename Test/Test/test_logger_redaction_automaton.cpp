@@ -0,0 +1,132 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Logger/logger.hpp"
+#include "../../Modules/Logger/logger_internal.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/CPP_class/class_string.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include <atomic>
+#include <thread>
+
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static int32_t logger_redaction_automaton_apply(const char *input, ft_string &output)
+{
+    const s_log_redaction_snapshot *snapshot;
+    uint32_t epoch;
+    int32_t error_code;
+
+    if (output.is_initialised())
+    {
+        error_code = output.destroy();
+        if (error_code != FT_ERR_SUCCESS)
+            return (error_code);
+    }
+    error_code = output.initialize(input);
+    if (error_code != FT_ERR_SUCCESS)
+        return (error_code);
+    epoch = 0;
+    snapshot = logger_redaction_read_lock(&epoch);
+    error_code = logger_apply_redactions(snapshot, output);
+    logger_redaction_read_unlock(snapshot, epoch);
+    return (error_code);
+}
+
+FT_TEST(test_logger_redaction_automaton_replaces_every_rule_in_one_pass)
+{
+    ft_string output;
+
+    ft_log_clear_redactions();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction("token=abc"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction_with_replacement("secret", "<s>"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction_with_replacement("pw", "<p>"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, logger_redaction_automaton_apply(
+            "pw secret token=abc secretsecret pwx", output));
+    FT_ASSERT(ft_strcmp(output.c_str(), "<p> <s> [REDACTED] <s><s> <p>x") == 0);
+    ft_log_clear_redactions();
+    return (1);
+}
+
+FT_TEST(test_logger_redaction_automaton_prefers_leftmost_longest_match)
+{
+    ft_string output;
+
+    ft_log_clear_redactions();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction_with_replacement("key", "K"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction_with_replacement("api_key", "A"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction_with_replacement("keyring", "R"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction_with_replacement("ab", "1"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction_with_replacement("bc", "2"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, logger_redaction_automaton_apply(
+            "api_key keyring keyrin abc", output));
+    FT_ASSERT(ft_strcmp(output.c_str(), "A R Krin 1c") == 0);
+    ft_log_clear_redactions();
+    return (1);
+}
+
+FT_TEST(test_logger_redaction_automaton_leaves_unmatched_text_untouched)
+{
+    ft_string output;
+    const s_log_redaction_snapshot *snapshot;
+    uint32_t epoch;
+
+    ft_log_clear_redactions();
+    epoch = 0;
+    snapshot = logger_redaction_read_lock(&epoch);
+    FT_ASSERT(snapshot == ft_nullptr);
+    logger_redaction_read_unlock(snapshot, epoch);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, ft_log_add_redaction("password"));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, logger_redaction_automaton_apply(
+            "passwor pass word", output));
+    FT_ASSERT(ft_strcmp(output.c_str(), "passwor pass word") == 0);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, ft_log_add_redaction(""));
+    ft_log_clear_redactions();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, logger_redaction_automaton_apply("password", output));
+    FT_ASSERT(ft_strcmp(output.c_str(), "password") == 0);
+    return (1);
+}
+
+FT_TEST(test_logger_redaction_automaton_survives_concurrent_rule_updates)
+{
+    std::atomic<int> running;
+    std::atomic<int> failures;
+    int iteration;
+
+    ft_log_clear_redactions();
+    running.store(1);
+    failures.store(0);
+    auto reader = [&running, &failures]()
+    {
+        ft_string output;
+
+        while (running.load() != 0)
+        {
+            if (logger_redaction_automaton_apply("user=alice secret=hunter2", output)
+                != FT_ERR_SUCCESS)
+                failures.fetch_add(1);
+            else if (ft_strstr(output.c_str(), "hunter2") != ft_nullptr
+                && ft_strstr(output.c_str(), "[REDACTED]") != ft_nullptr)
+                failures.fetch_add(1);
+        }
+        return ;
+    };
+    std::thread first_reader(reader);
+    std::thread second_reader(reader);
+    iteration = 0;
+    while (iteration < 200)
+    {
+        if (ft_log_add_redaction("hunter2") != FT_ERR_SUCCESS)
+            failures.fetch_add(1);
+        if (ft_log_add_redaction("alice") != FT_ERR_SUCCESS)
+            failures.fetch_add(1);
+        ft_log_clear_redactions();
+        iteration++;
+    }
+    running.store(0);
+    first_reader.join();
+    second_reader.join();
+    FT_ASSERT_EQ(0, failures.load());
+    return (1);
+}
@@ -7,6 +7,7 @@
 #include "../../Modules/Basic/limits.hpp"
 #include "../../Modules/PThread/mutex.hpp"
 #include "../../Modules/PThread/recursive_mutex.hpp"
+#include <unistd.h>
 #ifndef LIBFT_TEST_BUILD
 #endif
 
@@ -108,3 +109,227 @@ FT_TEST(test_networking_event_loop_lock_and_unlock_reset_errno)
     event_loop_clear(&loop);
     return (1);
 }
+
+struct event_loop_test_record
+{
+    int32_t     call_count;
+    int32_t     last_fd;
+    uint32_t    last_events;
+};
+
+static void event_loop_test_callback(event_loop *loop, int32_t socket_fd,
+    uint32_t ready_events, void *user_data)
+{
+    event_loop_test_record *record;
+
+    (void)loop;
+    record = static_cast<event_loop_test_record *>(user_data);
+    record->call_count++;
+    record->last_fd = socket_fd;
+    record->last_events = ready_events;
+    return ;
+}
+
+FT_TEST(test_networking_event_loop_watch_dispatches_callback)
+{
+    event_loop loop;
+    event_loop_test_record record;
+    int pipe_descriptors[2];
+    int run_result;
+
+    FT_ASSERT_EQ(0, pipe(pipe_descriptors));
+    event_loop_init(&loop);
+    record.call_count = 0;
+    record.last_fd = -1;
+    record.last_events = 0;
+    FT_ASSERT_EQ(0, event_loop_watch(&loop, pipe_descriptors[0],
+            EVENT_LOOP_EVENT_READ, event_loop_test_callback, &record));
+    run_result = event_loop_run(&loop, 0);
+    FT_ASSERT_EQ(0, run_result);
+    FT_ASSERT_EQ(0, record.call_count);
+    FT_ASSERT_EQ(1, write(pipe_descriptors[1], "x", 1));
+    run_result = event_loop_run(&loop, 1000);
+    FT_ASSERT_EQ(1, run_result);
+    FT_ASSERT_EQ(1, record.call_count);
+    FT_ASSERT_EQ(pipe_descriptors[0], record.last_fd);
+    FT_ASSERT_EQ(EVENT_LOOP_EVENT_READ, record.last_events);
+    FT_ASSERT_EQ(0, event_loop_unwatch(&loop, pipe_descriptors[0]));
+    FT_ASSERT_EQ(-1, event_loop_unwatch(&loop, pipe_descriptors[0]));
+    FT_ASSERT_EQ(0, event_loop_run(&loop, 0));
+    FT_ASSERT_EQ(1, record.call_count);
+    event_loop_clear(&loop);
+    close(pipe_descriptors[0]);
+    close(pipe_descriptors[1]);
+    return (1);
+}
+
+FT_TEST(test_networking_event_loop_edge_triggered_reports_new_data_once)
+{
+    event_loop loop;
+    event_loop_test_record record;
+    int pipe_descriptors[2];
+
+    FT_ASSERT_EQ(0, pipe(pipe_descriptors));
+    event_loop_init(&loop);
+    record.call_count = 0;
+    record.last_fd = -1;
+    record.last_events = 0;
+    FT_ASSERT_EQ(0, event_loop_watch(&loop, pipe_descriptors[0],
+            EVENT_LOOP_EVENT_READ | EVENT_LOOP_EVENT_EDGE_TRIGGERED,
+            event_loop_test_callback, &record));
+    FT_ASSERT_EQ(0, event_loop_run(&loop, 0));
+    FT_ASSERT_EQ(1, write(pipe_descriptors[1], "x", 1));
+    FT_ASSERT_EQ(1, event_loop_run(&loop, 1000));
+    FT_ASSERT_EQ(1, record.call_count);
+    FT_ASSERT_EQ(0, event_loop_run(&loop, 0));
+    FT_ASSERT_EQ(1, record.call_count);
+    FT_ASSERT_EQ(1, write(pipe_descriptors[1], "y", 1));
+    FT_ASSERT_EQ(1, event_loop_run(&loop, 1000));
+    FT_ASSERT_EQ(2, record.call_count);
+    event_loop_clear(&loop);
+    close(pipe_descriptors[0]);
+    close(pipe_descriptors[1]);
+    return (1);
+}
+
+FT_TEST(test_networking_event_loop_run_keeps_registrations_between_ticks)
+{
+    event_loop loop;
+    int pipe_descriptors[2];
+    int tick;
+
+    FT_ASSERT_EQ(0, pipe(pipe_descriptors));
+    event_loop_init(&loop);
+    FT_ASSERT_EQ(0, event_loop_add_socket(&loop, pipe_descriptors[0], FT_FALSE));
+    FT_ASSERT_EQ(0, event_loop_add_socket(&loop, pipe_descriptors[1], FT_TRUE));
+    FT_ASSERT_EQ(1, write(pipe_descriptors[1], "x", 1));
+    tick = 0;
+    while (tick < 3)
+    {
+        FT_ASSERT_EQ(2, event_loop_run(&loop, 1000));
+        FT_ASSERT_EQ(pipe_descriptors[0], loop.read_file_descriptors[0]);
+        FT_ASSERT_EQ(pipe_descriptors[1], loop.write_file_descriptors[0]);
+        FT_ASSERT(loop.backend_open);
+        tick++;
+    }
+    FT_ASSERT_EQ(0, event_loop_remove_socket(&loop, pipe_descriptors[1], FT_TRUE));
+    FT_ASSERT_EQ(1, event_loop_run(&loop, 1000));
+    FT_ASSERT_EQ(1, loop.registration_count);
+    event_loop_clear(&loop);
+    FT_ASSERT_EQ(FT_FALSE, loop.backend_open);
+    close(pipe_descriptors[0]);
+    close(pipe_descriptors[1]);
+    return (1);
+}
+
+FT_TEST(test_networking_event_loop_hup_interest_reports_peer_close)
+{
+    event_loop loop;
+    event_loop_test_record record;
+    int pipe_descriptors[2];
+
+    FT_ASSERT_EQ(0, pipe(pipe_descriptors));
+    event_loop_init(&loop);
+    record.call_count = 0;
+    record.last_fd = -1;
+    record.last_events = 0;
+    FT_ASSERT_EQ(0, event_loop_watch(&loop, pipe_descriptors[0],
+            EVENT_LOOP_EVENT_HUP, event_loop_test_callback, &record));
+    FT_ASSERT_EQ(&record, event_loop_get_user_data(&loop, pipe_descriptors[0]));
+    FT_ASSERT_EQ(1, write(pipe_descriptors[1], "x", 1));
+    FT_ASSERT_EQ(0, event_loop_run(&loop, 0));
+    close(pipe_descriptors[1]);
+    FT_ASSERT_EQ(1, event_loop_run(&loop, 1000));
+    FT_ASSERT_EQ(1, record.call_count);
+    FT_ASSERT_EQ(EVENT_LOOP_EVENT_HUP, record.last_events);
+    FT_ASSERT_EQ(0, event_loop_unwatch(&loop, pipe_descriptors[0]));
+    FT_ASSERT(event_loop_get_user_data(&loop, pipe_descriptors[0]) == ft_nullptr);
+    event_loop_clear(&loop);
+    close(pipe_descriptors[0]);
+    return (1);
+}
+
+FT_TEST(test_networking_event_loop_dispatches_only_ready_descriptors)
+{
+    event_loop loop;
+    event_loop_test_record records[32];
+    int pipe_descriptors[32][2];
+    int index;
+    int total_calls;
+
+    event_loop_init(&loop);
+    index = 0;
+    while (index < 32)
+    {
+        FT_ASSERT_EQ(0, pipe(pipe_descriptors[index]));
+        records[index].call_count = 0;
+        records[index].last_fd = -1;
+        records[index].last_events = 0;
+        FT_ASSERT_EQ(0, event_loop_watch(&loop, pipe_descriptors[index][0],
+                EVENT_LOOP_EVENT_READ, event_loop_test_callback, &records[index]));
+        index++;
+    }
+    FT_ASSERT_EQ(32, loop.registration_count);
+    FT_ASSERT_EQ(1, write(pipe_descriptors[5][1], "x", 1));
+    FT_ASSERT_EQ(1, write(pipe_descriptors[17][1], "x", 1));
+    FT_ASSERT_EQ(2, event_loop_run(&loop, 1000));
+    total_calls = 0;
+    index = 0;
+    while (index < 32)
+    {
+        total_calls += records[index].call_count;
+        index++;
+    }
+    FT_ASSERT_EQ(2, total_calls);
+    FT_ASSERT_EQ(1, records[5].call_count);
+    FT_ASSERT_EQ(1, records[17].call_count);
+    FT_ASSERT_EQ(pipe_descriptors[17][0], records[17].last_fd);
+    event_loop_clear(&loop);
+    index = 0;
+    while (index < 32)
+    {
+        close(pipe_descriptors[index][0]);
+        close(pipe_descriptors[index][1]);
+        index++;
+    }
+    return (1);
+}
+
+FT_TEST(test_networking_event_loop_remove_socket_keeps_remaining_descriptors)
+{
+    event_loop loop;
+    int descriptor;
+    int index;
+    int seen_mask;
+
+    event_loop_init(&loop);
+    descriptor = 100;
+    while (descriptor < 108)
+    {
+        FT_ASSERT_EQ(0, event_loop_add_socket(&loop, descriptor, FT_FALSE));
+        descriptor++;
+    }
+    FT_ASSERT_EQ(0, event_loop_remove_socket(&loop, 101, FT_FALSE));
+    FT_ASSERT_EQ(0, event_loop_remove_socket(&loop, 104, FT_FALSE));
+    FT_ASSERT_EQ(-1, event_loop_remove_socket(&loop, 104, FT_FALSE));
+    FT_ASSERT_EQ(0, event_loop_remove_socket(&loop, 107, FT_FALSE));
+    FT_ASSERT_EQ(5, loop.read_count);
+    FT_ASSERT_EQ(5, loop.registration_count);
+    seen_mask = 0;
+    index = 0;
+    while (index < loop.read_count)
+    {
+        seen_mask |= 1 << (loop.read_file_descriptors[index] - 100);
+        index++;
+    }
+    FT_ASSERT_EQ(0x6D, seen_mask);
+    index = 0;
+    while (index < loop.read_count)
+    {
+        FT_ASSERT_EQ(0, event_loop_remove_socket(&loop,
+                loop.read_file_descriptors[loop.read_count - 1], FT_FALSE));
+    }
+    FT_ASSERT_EQ(0, loop.registration_count);
+    event_loop_clear(&loop);
+    return (1);
+}
@@ -0,0 +1,188 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Networking/http_parser.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_networking_http_parser_request_incremental)
+{
+    http_parser parser;
+    char buffer[256];
+    const char *request;
+    ft_size_t request_length;
+    ft_size_t fed_length;
+    ft_bool message_complete;
+    ft_string_view<char> view;
+
+    request = "POST /submit?x=1 HTTP/1.1\r\nHost: localhost\r\n"
+        "Content-Length: 5\r\nX-Custom:  padded value \r\n\r\nhello";
+    request_length = ft_strlen_size_t(request);
+    ft_memcpy(buffer, request, request_length);
+    http_parser_init(&parser, HTTP_PARSER_MODE_REQUEST);
+    fed_length = 1;
+    message_complete = FT_FALSE;
+    while (fed_length <= request_length)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_execute(&parser, buffer, fed_length,
+                &message_complete));
+        if (fed_length < request_length)
+            FT_ASSERT_EQ(FT_FALSE, message_complete);
+        fed_length++;
+    }
+    FT_ASSERT_EQ(FT_TRUE, message_complete);
+    FT_ASSERT_EQ(request_length, http_parser_message_length(&parser));
+    FT_ASSERT_EQ(FT_TRUE, parser.keep_alive);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_get_method(&parser, buffer, view));
+    FT_ASSERT_EQ(4, view.size());
+    FT_ASSERT_EQ(0, ft_strncmp(view.data(), "POST", 4));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_get_target(&parser, buffer, view));
+    FT_ASSERT_EQ(11, view.size());
+    FT_ASSERT_EQ(0, ft_strncmp(view.data(), "/submit?x=1", 11));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_get_header(&parser, buffer, "x-custom", view));
+    FT_ASSERT_EQ(12, view.size());
+    FT_ASSERT_EQ(0, ft_strncmp(view.data(), "padded value", 12));
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, http_parser_get_header(&parser, buffer, "Cookie", view));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_get_body(&parser, buffer, view));
+    FT_ASSERT_EQ(5, view.size());
+    FT_ASSERT(view.data() == buffer + request_length - 5);
+    return (1);
+}
+
+FT_TEST(test_networking_http_parser_chunked_body_decoded_in_place)
+{
+    http_parser parser;
+    char buffer[256];
+    const char *request;
+    ft_size_t buffer_size;
+    ft_bool message_complete;
+
+    request = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+        "4\r\nWiki\r\n5;ext=1\r\npedia\r\nE\r\n in\r\n\r\nchunks.\r\n0\r\nTrailer: x\r\n\r\n"
+        "GET /next HTTP/1.1\r\n\r\n";
+    buffer_size = ft_strlen_size_t(request);
+    ft_memcpy(buffer, request, buffer_size);
+    http_parser_init(&parser, HTTP_PARSER_MODE_REQUEST);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_execute(&parser, buffer, buffer_size,
+            &message_complete));
+    FT_ASSERT_EQ(FT_TRUE, message_complete);
+    FT_ASSERT_EQ(FT_TRUE, parser.chunked);
+    FT_ASSERT_EQ(23, parser.body.length);
+    FT_ASSERT_EQ(0, ft_strncmp(buffer + parser.body.offset,
+            "Wikipedia in\r\n\r\nchunks.", 23));
+    http_parser_consume_message(&parser, buffer, &buffer_size);
+    FT_ASSERT_EQ(ft_strlen_size_t("GET /next HTTP/1.1\r\n\r\n"), buffer_size);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_execute(&parser, buffer, buffer_size,
+            &message_complete));
+    FT_ASSERT_EQ(FT_TRUE, message_complete);
+    FT_ASSERT_EQ(FT_TRUE, http_parser_span_equals(buffer, parser.target, "/next"));
+    FT_ASSERT_EQ(0, parser.body.length);
+    return (1);
+}
+
+FT_TEST(test_networking_http_parser_response_streaming_discard)
+{
+    http_parser parser;
+    char buffer[256];
+    const char *response;
+    ft_size_t response_length;
+    ft_size_t buffer_size;
+    ft_size_t input_offset;
+    ft_size_t delivered_length;
+    char delivered[64];
+    ft_bool message_complete;
+
+    response = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+        "3\r\nabc\r\n4\r\ndefg\r\n0\r\n\r\n";
+    response_length = ft_strlen_size_t(response);
+    http_parser_init(&parser, HTTP_PARSER_MODE_RESPONSE);
+    buffer_size = 0;
+    delivered_length = 0;
+    input_offset = 0;
+    message_complete = FT_FALSE;
+    while (input_offset < response_length)
+    {
+        buffer[buffer_size] = response[input_offset];
+        buffer_size++;
+        input_offset++;
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_execute(&parser, buffer, buffer_size,
+                &message_complete));
+        if (http_parser_headers_complete(&parser) != FT_FALSE && parser.body.length > 0)
+        {
+            ft_memcpy(delivered + delivered_length, buffer + parser.body.offset,
+                parser.body.length);
+            delivered_length += parser.body.length;
+            http_parser_discard_body(&parser, buffer, &buffer_size);
+        }
+    }
+    FT_ASSERT_EQ(FT_TRUE, message_complete);
+    FT_ASSERT_EQ(200, parser.status_code);
+    FT_ASSERT_EQ(7, delivered_length);
+    FT_ASSERT_EQ(0, ft_strncmp(delivered, "abcdefg", 7));
+    FT_ASSERT_EQ(buffer_size, http_parser_message_length(&parser));
+    FT_ASSERT(buffer_size <= parser.head_length + 7);
+    return (1);
+}
+
+FT_TEST(test_networking_http_parser_response_until_close)
+{
+    http_parser parser;
+    char buffer[128];
+    const char *response;
+    ft_size_t buffer_size;
+    ft_bool message_complete;
+
+    response = "HTTP/1.0 200 OK\r\nServer: test\r\n\r\nbody bytes";
+    buffer_size = ft_strlen_size_t(response);
+    ft_memcpy(buffer, response, buffer_size);
+    http_parser_init(&parser, HTTP_PARSER_MODE_RESPONSE);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_execute(&parser, buffer, buffer_size,
+            &message_complete));
+    FT_ASSERT_EQ(FT_FALSE, message_complete);
+    FT_ASSERT_EQ(FT_FALSE, parser.keep_alive);
+    FT_ASSERT_EQ(10, parser.body.length);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_finish(&parser, &message_complete));
+    FT_ASSERT_EQ(FT_TRUE, message_complete);
+    return (1);
+}
+
+FT_TEST(test_networking_http_parser_rejects_malformed_input)
+{
+    http_parser parser;
+    char buffer[128];
+    const char *request;
+    ft_size_t buffer_size;
+    ft_bool message_complete;
+
+    request = "GET / HTTP/1.1\r\nContent-Length: 12x\r\n\r\n";
+    buffer_size = ft_strlen_size_t(request);
+    ft_memcpy(buffer, request, buffer_size);
+    http_parser_init(&parser, HTTP_PARSER_MODE_REQUEST);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, http_parser_execute(&parser, buffer,
+            buffer_size, &message_complete));
+    request = "GET / HTTP/1.1\r\nContent-Length: 100\r\n\r\n";
+    buffer_size = ft_strlen_size_t(request);
+    ft_memcpy(buffer, request, buffer_size);
+    http_parser_init(&parser, HTTP_PARSER_MODE_REQUEST);
+    http_parser_set_max_body_size(&parser, 64);
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, http_parser_execute(&parser, buffer,
+            buffer_size, &message_complete));
+    request = "GET / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n";
+    buffer_size = ft_strlen_size_t(request);
+    ft_memcpy(buffer, request, buffer_size);
+    http_parser_init(&parser, HTTP_PARSER_MODE_REQUEST);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, http_parser_execute(&parser, buffer,
+            buffer_size, &message_complete));
+    request = "GET / HTTP/1.1\r\nConnection: close\r\n\r\n";
+    buffer_size = ft_strlen_size_t(request);
+    ft_memcpy(buffer, request, buffer_size);
+    http_parser_init(&parser, HTTP_PARSER_MODE_REQUEST);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, http_parser_execute(&parser, buffer,
+            buffer_size, &message_complete));
+    FT_ASSERT_EQ(FT_TRUE, message_complete);
+    FT_ASSERT_EQ(FT_FALSE, parser.keep_alive);
+    return (1);
+}
@@ -0,0 +1,362 @@
+#include "../test_internal.hpp"
+#include "networking_test_support.hpp"
+#include "../../Modules/Networking/http_server.hpp"
+#include "../../Modules/Networking/networking.hpp"
+#include "../../Modules/Basic/basic.hpp"
+#include "../../Modules/Time/time.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <cerrno>
+
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static int32_t http_event_open_client(void)
+{
+    struct timeval receive_timeout;
+    int32_t client_fd;
+
+    client_fd = nw_socket(AF_INET, SOCK_STREAM, 0);
+    if (client_fd < 0)
+        return (-1);
+    receive_timeout.tv_sec = 5;
+    receive_timeout.tv_usec = 0;
+    (void)setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &receive_timeout,
+        sizeof(receive_timeout));
+    return (client_fd);
+}
+
+static int32_t http_event_connect_socket(int32_t client_fd, uint16_t port)
+{
+    sockaddr_in server_address;
+
+    ft_memset(&server_address, 0, sizeof(server_address));
+    server_address.sin_family = AF_INET;
+    server_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    server_address.sin_port = htons(port);
+    return (nw_connect(client_fd, reinterpret_cast<struct sockaddr *>(&server_address),
+            sizeof(server_address)));
+}
+
+static int32_t http_event_connect_client(uint16_t port)
+{
+    int32_t client_fd;
+
+    client_fd = http_event_open_client();
+    if (client_fd < 0)
+        return (-1);
+    if (http_event_connect_socket(client_fd, port) != 0)
+    {
+        (void)nw_close(client_fd);
+        return (-1);
+    }
+    return (client_fd);
+}
+
+static int32_t http_event_count_responses(const char *data, ft_size_t size)
+{
+    const char *cursor;
+    const char *match;
+    int32_t count;
+
+    count = 0;
+    cursor = data;
+    while (cursor < data + size)
+    {
+        match = ft_strnstr(cursor, "HTTP/1.1 200 OK",
+                static_cast<ft_size_t>(data + size - cursor));
+        if (match == ft_nullptr)
+            break ;
+        count++;
+        cursor = match + 1;
+    }
+    return (count);
+}
+
+static ft_size_t http_event_receive_responses(int32_t client_fd, char *buffer,
+    ft_size_t buffer_size, int32_t expected_responses, const char *expected_tail)
+{
+    ft_size_t received_size;
+    ssize_t bytes_received;
+
+    received_size = 0;
+    buffer[0] = '\0';
+    while (received_size + 1 < buffer_size)
+    {
+        if (http_event_count_responses(buffer, received_size) >= expected_responses
+            && (expected_tail == ft_nullptr
+                || ft_strnstr(buffer, expected_tail, received_size) != ft_nullptr))
+            break ;
+        bytes_received = nw_recv(client_fd, buffer + received_size,
+                buffer_size - received_size - 1, 0);
+        if (bytes_received <= 0)
+            break ;
+        received_size += static_cast<ft_size_t>(bytes_received);
+        buffer[received_size] = '\0';
+    }
+    return (received_size);
+}
+
+FT_TEST(test_networking_http_server_event_driven_pipelined_requests)
+{
+    if (networking_test_local_ipv4_available() == FT_FALSE)
+        return (1);
+    ft_http_server server;
+    const char *requests;
+    char buffer[4096];
+    ft_size_t received_size;
+    int32_t client_fd;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.start_event_driven("127.0.0.1", 0, 2));
+    FT_ASSERT_EQ(FT_TRUE, server.is_serving());
+    FT_ASSERT(server.get_port() != 0);
+    client_fd = http_event_connect_client(server.get_port());
+    FT_ASSERT(client_fd >= 0);
+    requests = "GET /a HTTP/1.1\r\nHost: localhost\r\n\r\n"
+        "POST /b HTTP/1.1\r\nHost: localhost\r\nContent-Length: 5\r\n\r\nhello"
+        "GET /c HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    FT_ASSERT_EQ(static_cast<ssize_t>(ft_strlen(requests)),
+        nw_send(client_fd, requests, ft_strlen_size_t(requests), 0));
+    received_size = http_event_receive_responses(client_fd, buffer, sizeof(buffer),
+            3, ft_nullptr);
+    (void)nw_close(client_fd);
+    FT_ASSERT_EQ(3, http_event_count_responses(buffer, received_size));
+    FT_ASSERT(ft_strnstr(buffer, "hello", received_size) != ft_nullptr);
+    FT_ASSERT(ft_strnstr(buffer, "Connection: keep-alive", received_size) != ft_nullptr);
+    FT_ASSERT_EQ(3, server.get_request_count());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.stop());
+    FT_ASSERT_EQ(FT_FALSE, server.is_serving());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.destroy());
+    return (1);
+}
+
+FT_TEST(test_networking_http_server_event_driven_many_connections)
+{
+    if (networking_test_local_ipv4_available() == FT_FALSE)
+        return (1);
+    ft_http_server server;
+    int32_t client_fds[16];
+    char buffer[1024];
+    const char *request;
+    ft_size_t received_size;
+    int32_t client_index;
+    int32_t round_index;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.start_event_driven("127.0.0.1", 0, 4));
+    client_index = 0;
+    while (client_index < 16)
+    {
+        client_fds[client_index] = http_event_connect_client(server.get_port());
+        FT_ASSERT(client_fds[client_index] >= 0);
+        client_index++;
+    }
+    request = "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    round_index = 0;
+    while (round_index < 3)
+    {
+        client_index = 0;
+        while (client_index < 16)
+        {
+            FT_ASSERT_EQ(static_cast<ssize_t>(ft_strlen(request)),
+                nw_send(client_fds[client_index], request, ft_strlen_size_t(request), 0));
+            client_index++;
+        }
+        client_index = 0;
+        while (client_index < 16)
+        {
+            received_size = http_event_receive_responses(client_fds[client_index],
+                    buffer, sizeof(buffer), 1, "\r\n\r\nGET");
+            FT_ASSERT_EQ(1, http_event_count_responses(buffer, received_size));
+            client_index++;
+        }
+        round_index++;
+    }
+    client_index = 0;
+    while (client_index < 16)
+    {
+        (void)nw_close(client_fds[client_index]);
+        client_index++;
+    }
+    FT_ASSERT_EQ(48, server.get_request_count());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.destroy());
+    return (1);
+}
+
+FT_TEST(test_networking_http_server_event_driven_connection_close)
+{
+    if (networking_test_local_ipv4_available() == FT_FALSE)
+        return (1);
+    ft_http_server server;
+    const char *request;
+    char buffer[1024];
+    ft_size_t received_size;
+    ssize_t trailing_result;
+    int32_t client_fd;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.initialize());
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, server.start_event_driven("127.0.0.1", 0, 1000));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.start_event_driven("127.0.0.1", 0, 1));
+    FT_ASSERT_EQ(FT_ERR_INVALID_STATE, server.start_event_driven("127.0.0.1", 0, 1));
+    client_fd = http_event_connect_client(server.get_port());
+    FT_ASSERT(client_fd >= 0);
+    request = "GET / HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+    FT_ASSERT_EQ(static_cast<ssize_t>(ft_strlen(request)),
+        nw_send(client_fd, request, ft_strlen_size_t(request), 0));
+    received_size = http_event_receive_responses(client_fd, buffer, sizeof(buffer),
+            1, "\r\n\r\nGET");
+    FT_ASSERT_EQ(1, http_event_count_responses(buffer, received_size));
+    FT_ASSERT(ft_strnstr(buffer, "Connection: close", received_size) != ft_nullptr);
+    trailing_result = nw_recv(client_fd, buffer, sizeof(buffer), 0);
+    (void)nw_close(client_fd);
+    FT_ASSERT_EQ(0, trailing_result);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.stop());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.destroy());
+    return (1);
+}
+
+FT_TEST(test_networking_http_server_event_driven_accept_survives_descriptor_exhaustion)
+{
+    if (networking_test_local_ipv4_available() == FT_FALSE)
+        return (1);
+    ft_http_server server;
+    struct rlimit original_limit;
+    struct rlimit exhausted_limit;
+    const char *request;
+    char buffer[1024];
+    ft_size_t received_size;
+    ssize_t send_result;
+    int32_t warm_client_fd;
+    int32_t client_fd;
+    int32_t lowest_free_fd;
+    int32_t connect_result;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.start_event_driven("127.0.0.1", 0, 1));
+    request = "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    warm_client_fd = http_event_connect_client(server.get_port());
+    FT_ASSERT(warm_client_fd >= 0);
+    FT_ASSERT_EQ(static_cast<ssize_t>(ft_strlen(request)),
+        nw_send(warm_client_fd, request, ft_strlen_size_t(request), 0));
+    received_size = http_event_receive_responses(warm_client_fd, buffer,
+            sizeof(buffer), 1, "\r\n\r\nGET");
+    FT_ASSERT_EQ(1, http_event_count_responses(buffer, received_size));
+    client_fd = http_event_open_client();
+    FT_ASSERT(client_fd >= 0);
+    FT_ASSERT_EQ(0, getrlimit(RLIMIT_NOFILE, &original_limit));
+    lowest_free_fd = dup(0);
+    FT_ASSERT(lowest_free_fd >= 0);
+    (void)close(lowest_free_fd);
+    send_result = -1;
+    exhausted_limit = original_limit;
+    exhausted_limit.rlim_cur = static_cast<rlim_t>(lowest_free_fd);
+    FT_ASSERT_EQ(0, setrlimit(RLIMIT_NOFILE, &exhausted_limit));
+    connect_result = http_event_connect_socket(client_fd, server.get_port());
+    if (connect_result == 0)
+        send_result = nw_send(client_fd, request, ft_strlen_size_t(request), 0);
+    time_sleep_ms(300);
+    FT_ASSERT_EQ(0, setrlimit(RLIMIT_NOFILE, &original_limit));
+    FT_ASSERT_EQ(0, connect_result);
+    FT_ASSERT_EQ(static_cast<ssize_t>(ft_strlen(request)), send_result);
+    received_size = http_event_receive_responses(client_fd, buffer, sizeof(buffer),
+            1, "\r\n\r\nGET");
+    (void)nw_close(client_fd);
+    (void)nw_close(warm_client_fd);
+    FT_ASSERT_EQ(1, http_event_count_responses(buffer, received_size));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.destroy());
+    return (1);
+}
+
+FT_TEST(test_networking_http_server_event_driven_bounds_output_for_slow_reader)
+{
+    if (networking_test_local_ipv4_available() == FT_FALSE)
+        return (1);
+    ft_http_server server;
+    const int32_t request_count = 4096;
+    const ft_size_t body_length = 4096;
+    const char *request_head;
+    const char *response_head;
+    char *requests;
+    char buffer[16384];
+    ft_size_t request_length;
+    ft_size_t requests_size;
+    ft_size_t sent_size;
+    ft_size_t expected_size;
+    ft_size_t received_size;
+    ssize_t io_result;
+    uint64_t stalled_count;
+    int32_t receive_buffer_size;
+    int32_t client_fd;
+    int32_t request_index;
+    int32_t attempt_index;
+
+    request_head = "POST / HTTP/1.1\r\nHost: localhost\r\nContent-Length: 4096\r\n\r\n";
+    response_head = "HTTP/1.1 200 OK\r\nContent-Length: 4096\r\n"
+        "Connection: keep-alive\r\n\r\n";
+    request_length = ft_strlen_size_t(request_head) + body_length;
+    requests_size = request_length * static_cast<ft_size_t>(request_count);
+    requests = static_cast<char *>(cma_malloc(requests_size));
+    FT_ASSERT(requests != ft_nullptr);
+    request_index = 0;
+    while (request_index < request_count)
+    {
+        char *request;
+
+        request = requests + request_length * static_cast<ft_size_t>(request_index);
+        ft_memcpy(request, request_head, ft_strlen_size_t(request_head));
+        ft_memset(request + ft_strlen_size_t(request_head), 'x', body_length);
+        request_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.start_event_driven("127.0.0.1", 0, 1));
+    client_fd = http_event_open_client();
+    FT_ASSERT(client_fd >= 0);
+    receive_buffer_size = 4096;
+    (void)setsockopt(client_fd, SOL_SOCKET, SO_RCVBUF, &receive_buffer_size,
+        sizeof(receive_buffer_size));
+    FT_ASSERT_EQ(0, http_event_connect_socket(client_fd, server.get_port()));
+    sent_size = 0;
+    attempt_index = 0;
+    while (sent_size < requests_size && attempt_index < 500)
+    {
+        io_result = nw_send(client_fd, requests + sent_size, requests_size - sent_size,
+                MSG_DONTWAIT);
+        if (io_result > 0)
+            sent_size += static_cast<ft_size_t>(io_result);
+        else
+            time_sleep_ms(1);
+        attempt_index++;
+    }
+    time_sleep_ms(200);
+    stalled_count = server.get_request_count();
+    expected_size = (ft_strlen_size_t(response_head) + body_length)
+        * static_cast<ft_size_t>(request_count);
+    received_size = 0;
+    while (received_size < expected_size)
+    {
+        if (sent_size < requests_size)
+        {
+            io_result = nw_send(client_fd, requests + sent_size,
+                    requests_size - sent_size, MSG_DONTWAIT);
+            if (io_result > 0)
+                sent_size += static_cast<ft_size_t>(io_result);
+        }
+        io_result = nw_recv(client_fd, buffer, sizeof(buffer), 0);
+        if (io_result <= 0)
+            break ;
+        received_size += static_cast<ft_size_t>(io_result);
+    }
+    (void)nw_close(client_fd);
+    cma_free(requests);
+    FT_ASSERT(stalled_count < static_cast<uint64_t>(request_count));
+    FT_ASSERT_EQ(expected_size, received_size);
+    FT_ASSERT_EQ(static_cast<uint64_t>(request_count), server.get_request_count());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, server.destroy());
+    return (1);
+}
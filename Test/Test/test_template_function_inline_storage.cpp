@@ -0,0 +1,172 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Template/function.hpp"
+#include "../../Modules/Template/move_only_function.hpp"
+#include "../../Modules/Template/move.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#include "../../Modules/Basic/class_nullptr.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static int g_tracked_callable_live = 0;
+
+struct tracked_callable
+{
+    int _value;
+
+    tracked_callable(int value) noexcept
+        : _value(value)
+    {
+        g_tracked_callable_live += 1;
+        return ;
+    }
+
+    tracked_callable(const tracked_callable &other) noexcept
+        : _value(other._value)
+    {
+        g_tracked_callable_live += 1;
+        return ;
+    }
+
+    tracked_callable(tracked_callable &&other) noexcept
+        : _value(other._value)
+    {
+        g_tracked_callable_live += 1;
+        return ;
+    }
+
+    ~tracked_callable()
+    {
+        g_tracked_callable_live -= 1;
+        return ;
+    }
+
+    int operator()(int argument) const
+    {
+        return (this->_value + argument);
+    }
+};
+
+struct move_only_callable
+{
+    int *_target;
+
+    move_only_callable(int *target) noexcept
+        : _target(target)
+    {
+        return ;
+    }
+
+    move_only_callable(const move_only_callable &other) = delete;
+
+    move_only_callable(move_only_callable &&other) noexcept
+        : _target(other._target)
+    {
+        other._target = ft_nullptr;
+        return ;
+    }
+
+    void operator()()
+    {
+        if (this->_target != ft_nullptr)
+            *this->_target += 1;
+        return ;
+    }
+};
+
+FT_TEST(test_ft_function_small_capture_is_allocation_free)
+{
+    int first_value;
+    int second_value;
+    int third_value;
+
+    first_value = 1;
+    second_value = 2;
+    third_value = 3;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(1));
+    ft_function<int()> function([&first_value, &second_value, &third_value]()
+    {
+        return (first_value + second_value + third_value);
+    });
+    ft_function<int()> copied(function);
+    ft_function<int()> moved(ft_move(function));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(0));
+    FT_ASSERT(moved.is_inline());
+    FT_ASSERT(copied.is_inline());
+    FT_ASSERT_EQ(false, static_cast<bool>(function));
+    FT_ASSERT_EQ(6, moved());
+    second_value = 10;
+    FT_ASSERT_EQ(14, copied());
+    return (1);
+}
+
+FT_TEST(test_ft_function_large_capture_falls_back_to_heap)
+{
+    char payload[FT_FUNCTION_INLINE_SIZE + 16];
+    ft_size_t index;
+
+    index = 0;
+    while (index < sizeof(payload))
+    {
+        payload[index] = static_cast<char>(index);
+        index++;
+    }
+    ft_function<int()> function([payload]()
+    {
+        return (static_cast<int>(payload[FT_FUNCTION_INLINE_SIZE + 15]));
+    });
+    FT_ASSERT(static_cast<bool>(function));
+    FT_ASSERT_EQ(false, static_cast<bool>(function.is_inline()));
+    ft_function<int()> copied(function);
+    ft_function<int()> moved(ft_move(function));
+    FT_ASSERT_EQ(FT_FUNCTION_INLINE_SIZE + 15, copied());
+    FT_ASSERT_EQ(FT_FUNCTION_INLINE_SIZE + 15, moved());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(1));
+    ft_function<int()> failed_copy(moved);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(0));
+    FT_ASSERT_EQ(false, static_cast<bool>(failed_copy));
+    return (1);
+}
+
+FT_TEST(test_ft_function_inline_storage_destroys_each_callable_once)
+{
+    g_tracked_callable_live = 0;
+    {
+        ft_function<int(int)> first(tracked_callable(5));
+        ft_function<int(int)> second(tracked_callable(7));
+        ft_function<int(int)> third;
+
+        FT_ASSERT_EQ(2, g_tracked_callable_live);
+        FT_ASSERT(first.is_inline());
+        third = first;
+        FT_ASSERT_EQ(3, g_tracked_callable_live);
+        second = ft_move(first);
+        FT_ASSERT_EQ(2, g_tracked_callable_live);
+        FT_ASSERT_EQ(6, second(1));
+        FT_ASSERT_EQ(7, third(2));
+    }
+    FT_ASSERT_EQ(0, g_tracked_callable_live);
+    return (1);
+}
+
+FT_TEST(test_ft_move_only_function_accepts_move_only_callables)
+{
+    int counter;
+    move_only_callable callable(&counter);
+
+    counter = 0;
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(1));
+    ft_move_only_function<void()> function(ft_move(callable));
+    ft_move_only_function<void()> moved(ft_move(function));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(0));
+    FT_ASSERT_EQ(false, static_cast<bool>(function));
+    FT_ASSERT(moved.is_inline());
+    moved();
+    moved();
+    function = ft_move(moved);
+    function();
+    FT_ASSERT_EQ(3, counter);
+    FT_ASSERT_EQ(false, static_cast<bool>(moved));
+    return (1);
+}
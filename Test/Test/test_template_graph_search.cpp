@@ -0,0 +1,192 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Template/graph.hpp"
+#include "../../Modules/Template/graph_search.hpp"
+#include "../../Modules/Template/vector.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static uint32_t graph_search_value_weight(const int32_t &from, const int32_t &to)
+{
+    if (to > from)
+        return (static_cast<uint32_t>(to - from));
+    return (static_cast<uint32_t>(from - to));
+}
+
+static int graph_search_build_diamond(ft_graph<int32_t> &graph)
+{
+    // Weights are value differences: 0 -> 1 -> 3 and 0 -> 2 -> 3 both cost 10.
+    if (graph.initialize() != FT_ERR_SUCCESS)
+        return (0);
+    graph.add_vertex(0);
+    graph.add_vertex(1);
+    graph.add_vertex(4);
+    graph.add_vertex(10);
+    graph.add_vertex(100);
+    graph.add_edge(0, 1);
+    graph.add_edge(1, 3);
+    graph.add_edge(0, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(2, 1);
+    return (graph.get_error() == FT_ERR_SUCCESS);
+}
+
+FT_TEST(test_graph_snapshot_builds_csr_layout)
+{
+    ft_graph<int32_t> graph;
+    ft_graph_csr<uint32_t> csr;
+
+    FT_ASSERT_EQ(1, graph_search_build_diamond(graph));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, csr.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, graph.snapshot(csr, graph_search_value_weight));
+    FT_ASSERT_EQ(5, csr.vertex_count());
+    FT_ASSERT_EQ(5, csr.edge_count());
+    FT_ASSERT_EQ(0, csr.edge_begin(0));
+    FT_ASSERT_EQ(2, csr.edge_end(0));
+    FT_ASSERT_EQ(1, csr.edge_target(0));
+    FT_ASSERT_EQ(2, csr.edge_target(1));
+    FT_ASSERT_EQ(4, csr.edge_weight(1));
+    FT_ASSERT_EQ(csr.edge_end(3), csr.edge_begin(3));
+    FT_ASSERT_EQ(csr.edge_end(4), csr.edge_begin(4));
+    FT_ASSERT_EQ(5, csr.edge_end(4));
+    csr.edge_begin(5);
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, csr.get_error());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, graph.snapshot(csr));
+    FT_ASSERT_EQ(1, csr.edge_weight(1));
+    return (1);
+}
+
+FT_TEST(test_graph_search_dijkstra_uses_edge_weights)
+{
+    ft_graph<int32_t> graph;
+    ft_graph_csr<uint32_t> csr;
+    ft_graph_search<uint32_t> search;
+    ft_vector<ft_size_t> path;
+
+    FT_ASSERT_EQ(1, graph_search_build_diamond(graph));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, csr.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, graph.snapshot(csr, graph_search_value_weight));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.dijkstra(csr, 0, 3, path));
+    FT_ASSERT_EQ(10, search.distance_to(3));
+    FT_ASSERT_EQ(3, path.size());
+    FT_ASSERT_EQ(0, path[0]);
+    FT_ASSERT_EQ(3, path[2]);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.bfs(csr, 0, 3, path));
+    FT_ASSERT_EQ(2, search.distance_to(3));
+    FT_ASSERT_EQ(3, path.size());
+    return (1);
+}
+
+FT_TEST(test_graph_search_astar_matches_dijkstra)
+{
+    ft_graph<int32_t> graph;
+    ft_graph_csr<uint32_t> csr;
+    ft_graph_search<uint32_t> search;
+    ft_vector<ft_size_t> dijkstra_path;
+    ft_vector<ft_size_t> astar_path;
+    ft_size_t row;
+    ft_size_t column;
+    ft_size_t vertex;
+    uint32_t dijkstra_distance;
+    const ft_size_t side = 12;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, graph.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, csr.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, dijkstra_path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, astar_path.initialize());
+    vertex = 0;
+    while (vertex < side * side)
+    {
+        graph.add_vertex(static_cast<int32_t>(vertex));
+        vertex++;
+    }
+    row = 0;
+    while (row < side)
+    {
+        column = 0;
+        while (column < side)
+        {
+            vertex = row * side + column;
+            if (column + 1 < side && (row % 4) != 3)
+            {
+                graph.add_edge(vertex, vertex + 1);
+                graph.add_edge(vertex + 1, vertex);
+            }
+            if (row + 1 < side)
+            {
+                graph.add_edge(vertex, vertex + side);
+                graph.add_edge(vertex + side, vertex);
+            }
+            column++;
+        }
+        row++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, graph.snapshot(csr));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.dijkstra(csr, 0, side * side - 1, dijkstra_path));
+    dijkstra_distance = search.distance_to(side * side - 1);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.astar(csr, 0, side * side - 1,
+        [side](ft_size_t from, ft_size_t to)
+        {
+            ft_size_t from_row = from / side;
+            ft_size_t to_row = to / side;
+            ft_size_t from_column = from % side;
+            ft_size_t to_column = to % side;
+
+            return ((to_row - from_row) + (to_column > from_column
+                ? to_column - from_column : from_column - to_column));
+        }, astar_path));
+    FT_ASSERT_EQ(dijkstra_distance, search.distance_to(side * side - 1));
+    FT_ASSERT_EQ(dijkstra_path.size(), astar_path.size());
+    FT_ASSERT_EQ(2 * (side - 1), dijkstra_distance);
+    return (1);
+}
+
+FT_TEST(test_graph_search_reports_unreachable_and_out_of_range)
+{
+    ft_graph<int32_t> graph;
+    ft_graph_csr<uint32_t> csr;
+    ft_graph_search<uint32_t> search;
+    ft_vector<ft_size_t> path;
+
+    FT_ASSERT_EQ(1, graph_search_build_diamond(graph));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, csr.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, graph.snapshot(csr));
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, search.dijkstra(csr, 0, 4, path));
+    FT_ASSERT_EQ(0, path.size());
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, search.bfs(csr, 3, 0, path));
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, search.dijkstra(csr, 0, 9, path));
+    FT_ASSERT_EQ(FT_FALSE, search.reached(0));
+    return (1);
+}
+
+FT_TEST(test_graph_search_shortest_path_tree_answers_every_vertex)
+{
+    ft_graph<int32_t> graph;
+    ft_graph_csr<uint32_t> csr;
+    ft_graph_search<uint32_t> search;
+    ft_vector<ft_size_t> path;
+
+    FT_ASSERT_EQ(1, graph_search_build_diamond(graph));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, csr.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, path.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, graph.snapshot(csr, graph_search_value_weight));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.shortest_path_tree(csr, 0));
+    FT_ASSERT_EQ(1, search.distance_to(1));
+    FT_ASSERT_EQ(4, search.distance_to(2));
+    FT_ASSERT_EQ(10, search.distance_to(3));
+    FT_ASSERT_EQ(FT_FALSE, search.reached(4));
+    search.distance_to(4);
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, search.get_error());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, search.extract_path(1, path));
+    FT_ASSERT_EQ(2, path.size());
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, search.extract_path(4, path));
+    return (1);
+}
@@ -0,0 +1,94 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Template/indexed_heap.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/Basic/class_nullptr.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_indexed_heap_pops_in_key_order)
+{
+    ft_indexed_heap<uint32_t> heap;
+    const uint32_t keys[8] = {40, 7, 19, 3, 25, 11, 30, 1};
+    ft_size_t item;
+    uint32_t key;
+    uint32_t previous;
+    ft_size_t index;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.reserve(8));
+    index = 0;
+    while (index < 8)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(index, keys[index]));
+        index++;
+    }
+    FT_ASSERT_EQ(8, heap.size());
+    previous = 0;
+    index = 0;
+    while (index < 8)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.pop(&item, &key));
+        FT_ASSERT_EQ(keys[item], key);
+        FT_ASSERT(previous <= key);
+        previous = key;
+        index++;
+    }
+    FT_ASSERT_EQ(FT_TRUE, heap.empty());
+    FT_ASSERT_EQ(FT_ERR_EMPTY, heap.pop(&item, &key));
+    return (1);
+}
+
+FT_TEST(test_indexed_heap_decrease_key_keeps_one_entry)
+{
+    ft_indexed_heap<uint32_t, 2> heap;
+    ft_size_t item;
+    uint32_t key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.reserve(4));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(0, 10));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(1, 20));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(2, 30));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(2, 5));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(1, 50));
+    FT_ASSERT_EQ(3, heap.size());
+    FT_ASSERT_EQ(20, heap.key_of(1));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.pop(&item, &key));
+    FT_ASSERT_EQ(2, item);
+    FT_ASSERT_EQ(5, key);
+    FT_ASSERT_EQ(FT_FALSE, heap.contains(2));
+    FT_ASSERT_EQ(FT_TRUE, heap.contains(0));
+    return (1);
+}
+
+FT_TEST(test_indexed_heap_rejects_items_outside_capacity)
+{
+    ft_indexed_heap<uint32_t> heap;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.reserve(2));
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, heap.push_or_decrease(2, 1));
+    FT_ASSERT_EQ(0, heap.key_of(3));
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, heap.get_error());
+    return (1);
+}
+
+FT_TEST(test_indexed_heap_clear_allows_reuse)
+{
+    ft_indexed_heap<uint32_t> heap;
+    ft_size_t item;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.reserve(3));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(0, 3));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(1, 2));
+    heap.clear();
+    FT_ASSERT_EQ(0, heap.size());
+    FT_ASSERT_EQ(FT_FALSE, heap.contains(1));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.push_or_decrease(1, 9));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.pop(&item, ft_nullptr));
+    FT_ASSERT_EQ(1, item);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, heap.destroy());
+    return (1);
+}
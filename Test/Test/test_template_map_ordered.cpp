@@ -0,0 +1,148 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Template/map.hpp"
+#include "../../Modules/CPP_class/class_string.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Errno/errno.hpp"
+
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Template/pair.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_ft_map_iterates_in_key_order)
+{
+    ft_map<int, int> map_instance;
+    Pair<int, int> *iterator;
+    int previous_key;
+    ft_size_t visited;
+    int key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    key = 0;
+    while (key < 1000)
+    {
+        map_instance.insert((key * 7919) % 1000, key);
+        key++;
+    }
+    map_instance.insert(500, -1);
+    FT_ASSERT_EQ(static_cast<ft_size_t>(1000), map_instance.size());
+    FT_ASSERT_EQ(-1, map_instance.at(500));
+    iterator = map_instance.begin();
+    previous_key = -1;
+    visited = 0;
+    while (iterator != map_instance.end())
+    {
+        FT_ASSERT(previous_key < iterator->key);
+        previous_key = iterator->key;
+        visited++;
+        iterator++;
+    }
+    FT_ASSERT_EQ(static_cast<ft_size_t>(1000), visited);
+    key = 0;
+    while (key < 1000)
+    {
+        map_instance.remove(key);
+        key += 2;
+    }
+    FT_ASSERT_EQ(static_cast<ft_size_t>(500), map_instance.size());
+    FT_ASSERT(map_instance.find(10) == map_instance.end());
+    FT_ASSERT_EQ(11, map_instance.find(11)->key);
+    FT_ASSERT_EQ(1, map_instance.begin()->key);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_ft_map_lower_and_upper_bound)
+{
+    ft_map<int, int> map_instance;
+    int key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    key = 10;
+    while (key <= 100)
+    {
+        map_instance.insert(key, key * 2);
+        key += 10;
+    }
+    FT_ASSERT_EQ(30, map_instance.lower_bound(30)->key);
+    FT_ASSERT_EQ(40, map_instance.upper_bound(30)->key);
+    FT_ASSERT_EQ(40, map_instance.lower_bound(31)->key);
+    FT_ASSERT_EQ(10, map_instance.lower_bound(-5)->key);
+    FT_ASSERT(map_instance.lower_bound(101) == map_instance.end());
+    FT_ASSERT(map_instance.upper_bound(100) == map_instance.end());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.get_error());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_ft_map_range_is_inclusive)
+{
+    ft_map<int, int> map_instance;
+    Pair<int, int> *range_begin;
+    Pair<int, int> *range_end;
+    int key_sum;
+    int key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    key = 0;
+    while (key < 50)
+    {
+        map_instance.insert(key * 3, key);
+        key++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.range(10, 30, &range_begin, &range_end));
+    key_sum = 0;
+    while (range_begin != range_end)
+    {
+        key_sum += range_begin->key;
+        range_begin++;
+    }
+    FT_ASSERT_EQ(12 + 15 + 18 + 21 + 24 + 27 + 30, key_sum);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.range(40, 20, &range_begin, &range_end));
+    FT_ASSERT(range_begin == range_end);
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, map_instance.range(0, 1, ft_nullptr, &range_end));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_ft_map_string_keys_stay_sorted_through_shifts)
+{
+    ft_map<ft_string, ft_string> map_instance;
+    const char *keys[6] = {"delta", "alpha", "foxtrot", "charlie", "echo", "bravo"};
+    const char *sorted_keys[5] = {"alpha", "bravo", "delta", "echo", "foxtrot"};
+    ft_string key_string;
+    ft_string value_string;
+    const Pair<ft_string, ft_string> *iterator;
+    ft_size_t index;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    index = 0;
+    while (index < 6)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, key_string.initialize(keys[index]));
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, value_string.initialize(keys[index]));
+        value_string.append("_value");
+        map_instance.insert(key_string, value_string);
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.get_error());
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, value_string.destroy());
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, key_string.destroy());
+        index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, key_string.initialize("charlie"));
+    map_instance.remove(key_string);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, key_string.destroy());
+    FT_ASSERT_EQ(static_cast<ft_size_t>(5), map_instance.size());
+    iterator = map_instance.begin();
+    index = 0;
+    while (iterator != map_instance.end())
+    {
+        FT_ASSERT(iterator->key == sorted_keys[index]);
+        FT_ASSERT_EQ(0, ft_strncmp(iterator->value.c_str(), sorted_keys[index],
+                ft_strlen_size_t(sorted_keys[index])));
+        index++;
+        iterator++;
+    }
+    FT_ASSERT_EQ(static_cast<ft_size_t>(5), index);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
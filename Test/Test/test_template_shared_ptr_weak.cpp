@@ -0,0 +1,155 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Template/shared_ptr.hpp"
+#include "../../Modules/Template/move.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include <atomic>
+#include <thread>
+
+#include "../../Modules/Basic/class_nullptr.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+static std::atomic<int> g_shared_tracked_destroyed(0);
+
+struct shared_tracked_value
+{
+    int _first;
+    int _second;
+
+    shared_tracked_value() noexcept
+        : _first(0), _second(0)
+    {
+        return ;
+    }
+
+    shared_tracked_value(int first, int second) noexcept
+        : _first(first), _second(second)
+    {
+        return ;
+    }
+
+    ~shared_tracked_value()
+    {
+        g_shared_tracked_destroyed.fetch_add(1);
+        return ;
+    }
+};
+
+FT_TEST(test_ft_make_shared_uses_single_allocation)
+{
+    ft_size_t allocations_before;
+    ft_size_t allocations_after;
+    ft_size_t frees_before;
+    ft_size_t frees_after;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_before, &frees_before));
+    {
+        ft_sharedptr<shared_tracked_value> pointer
+            = ft_make_shared<shared_tracked_value>(3, 4);
+
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_after, &frees_after));
+        FT_ASSERT_EQ(allocations_before + 1, allocations_after);
+        FT_ASSERT_EQ(3, pointer->_first);
+        FT_ASSERT_EQ(4, pointer->_second);
+        FT_ASSERT_EQ(1, pointer.use_count());
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_after, &frees_after));
+    FT_ASSERT_EQ(frees_before + 1, frees_after);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_before, &frees_before));
+    {
+        ft_sharedptr<int> pointer(new int(5));
+
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_after, &frees_after));
+        FT_ASSERT_EQ(allocations_before + 2, allocations_after);
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(1));
+    ft_sharedptr<shared_tracked_value> failed = ft_make_shared<shared_tracked_value>();
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_set_alloc_limit(0));
+    FT_ASSERT_EQ(FT_FALSE, static_cast<ft_bool>(failed));
+    return (1);
+}
+
+FT_TEST(test_ft_weakptr_lock_and_expire)
+{
+    ft_weakptr<shared_tracked_value> weak_pointer;
+    ft_sharedptr<shared_tracked_value> locked;
+    ft_size_t allocations_before;
+    ft_size_t frees_before;
+    ft_size_t allocations_after;
+    ft_size_t frees_after;
+
+    g_shared_tracked_destroyed.store(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, weak_pointer.initialize());
+    FT_ASSERT_EQ(FT_TRUE, weak_pointer.expired());
+    {
+        ft_sharedptr<shared_tracked_value> owner
+            = ft_make_shared<shared_tracked_value>(7, 8);
+
+        weak_pointer = owner;
+        FT_ASSERT_EQ(FT_FALSE, weak_pointer.expired());
+        FT_ASSERT_EQ(1, weak_pointer.use_count());
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, weak_pointer.lock(locked));
+        FT_ASSERT_EQ(2, owner.use_count());
+        FT_ASSERT_EQ(8, locked->_second);
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, locked.destroy());
+        FT_ASSERT_EQ(1, owner.use_count());
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_before, &frees_before));
+    }
+    FT_ASSERT_EQ(1, g_shared_tracked_destroyed.load());
+    FT_ASSERT_EQ(FT_TRUE, weak_pointer.expired());
+    FT_ASSERT_EQ(0, weak_pointer.use_count());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_after, &frees_after));
+    FT_ASSERT_EQ(frees_before, frees_after);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, weak_pointer.lock(locked));
+    FT_ASSERT_EQ(FT_FALSE, static_cast<ft_bool>(locked));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, weak_pointer.destroy());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocations_after, &frees_after));
+    FT_ASSERT_EQ(frees_before + 1, frees_after);
+    FT_ASSERT_EQ(1, g_shared_tracked_destroyed.load());
+    return (1);
+}
+
+FT_TEST(test_ft_sharedptr_cross_thread_copies_keep_count_exact)
+{
+    ft_sharedptr<shared_tracked_value> source
+        = ft_make_shared<shared_tracked_value>(1, 2);
+    ft_weakptr<shared_tracked_value> observer;
+    std::atomic<int> failures;
+
+    g_shared_tracked_destroyed.store(0);
+    failures.store(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, observer.initialize(source));
+    auto worker = [&source, &observer, &failures]()
+    {
+        int iteration;
+
+        iteration = 0;
+        while (iteration < 20000)
+        {
+            ft_sharedptr<shared_tracked_value> copy;
+            ft_sharedptr<shared_tracked_value> locked;
+
+            if (copy.initialize(source) != FT_ERR_SUCCESS)
+                failures.fetch_add(1);
+            if (observer.lock(locked) != FT_ERR_SUCCESS || !locked)
+                failures.fetch_add(1);
+            iteration++;
+        }
+        return ;
+    };
+    std::thread first_thread(worker);
+    std::thread second_thread(worker);
+    std::thread third_thread(worker);
+    first_thread.join();
+    second_thread.join();
+    third_thread.join();
+    FT_ASSERT_EQ(0, failures.load());
+    FT_ASSERT_EQ(1, source.use_count());
+    FT_ASSERT_EQ(0, g_shared_tracked_destroyed.load());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, source.destroy());
+    FT_ASSERT_EQ(1, g_shared_tracked_destroyed.load());
+    FT_ASSERT_EQ(FT_TRUE, observer.expired());
+    return (1);
+}
@@ -31,22 +31,35 @@ static ft_size_t unordered_map_current_allocated_bytes(void)
     return (current_bytes);
 }
 
+static ft_size_t unordered_map_fill_to_growth_limit(unordered_map_int_int& map_instance,
+    int first_key)
+{
+    ft_size_t growth_limit;
+    int key;
+
+    growth_limit = map_instance.bucket_count() - map_instance.bucket_count() / 8;
+    key = first_key;
+    while (map_instance.size() < growth_limit)
+    {
+        map_instance.insert(key, key * 10);
+        key++;
+    }
+    return (growth_limit);
+}
+
 FT_TEST(test_unordered_map_late_resize_failure_preserves_entries_and_state)
 {
     unordered_map_int_int map_instance;
+    ft_size_t filled_size;
 
     FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
-    map_instance.insert(1, 10);
-    map_instance.insert(2, 20);
-    map_instance.insert(3, 30);
-    map_instance.insert(4, 40);
-    map_instance.insert(5, 50);
-    FT_ASSERT_EQ(static_cast<size_t>(5), map_instance.size());
+    filled_size = unordered_map_fill_to_growth_limit(map_instance, 1);
+    FT_ASSERT_EQ(filled_size, map_instance.size());
     cma_set_alloc_limit(64);
-    map_instance.insert(6, 60);
+    map_instance.insert(1000, 60);
     cma_set_alloc_limit(0);
     FT_ASSERT_EQ(FT_ERR_NO_MEMORY, map_instance.get_error());
-    FT_ASSERT_EQ(static_cast<size_t>(5), map_instance.size());
+    FT_ASSERT_EQ(filled_size, map_instance.size());
     FT_ASSERT_EQ(10, map_instance.at(1));
     FT_ASSERT_EQ(20, map_instance.at(2));
     FT_ASSERT_EQ(30, map_instance.at(3));
@@ -62,13 +75,9 @@ FT_TEST(test_unordered_map_late_resize_failure_keeps_mutex_unlocked)
     ft_bool lock_acquired;
 
     FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
-    map_instance.insert(11, 110);
-    map_instance.insert(12, 120);
-    map_instance.insert(13, 130);
-    map_instance.insert(14, 140);
-    map_instance.insert(15, 150);
+    (void)unordered_map_fill_to_growth_limit(map_instance, 11);
     cma_set_alloc_limit(64);
-    map_instance.insert(16, 160);
+    map_instance.insert(1000, 160);
     cma_set_alloc_limit(0);
     FT_ASSERT_EQ(FT_ERR_NO_MEMORY, map_instance.get_error());
     lock_acquired = FT_FALSE;
@@ -86,13 +95,9 @@ FT_TEST(test_unordered_map_operator_index_late_failure_returns_invalid_proxy)
     unordered_map_int_int::mapped_proxy failed_proxy;
 
     FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
-    map_instance.insert(21, 210);
-    map_instance.insert(22, 220);
-    map_instance.insert(23, 230);
-    map_instance.insert(24, 240);
-    map_instance.insert(25, 250);
+    (void)unordered_map_fill_to_growth_limit(map_instance, 21);
     cma_set_alloc_limit(64);
-    failed_proxy = map_instance[26];
+    failed_proxy = map_instance[1000];
     cma_set_alloc_limit(0);
     FT_ASSERT_EQ(FT_ERR_NO_MEMORY, map_instance.get_error());
     FT_ASSERT_EQ(FT_ERR_NO_MEMORY, failed_proxy.get_error());
@@ -114,13 +119,9 @@ FT_TEST(test_unordered_map_late_resize_failure_releases_memory_after_scope)
         unordered_map_int_int map_instance;
 
         FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
-        map_instance.insert(31, 310);
-        map_instance.insert(32, 320);
-        map_instance.insert(33, 330);
-        map_instance.insert(34, 340);
-        map_instance.insert(35, 350);
+        (void)unordered_map_fill_to_growth_limit(map_instance, 31);
         cma_set_alloc_limit(64);
-        map_instance.insert(36, 360);
+        map_instance.insert(1000, 360);
         cma_set_alloc_limit(0);
         FT_ASSERT_EQ(FT_ERR_NO_MEMORY, map_instance.get_error());
         FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
@@ -0,0 +1,134 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Template/unordered_map.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Errno/errno.hpp"
+
+#include "../../Modules/Basic/class_nullptr.hpp"
+#include "../../Modules/Basic/limits.hpp"
+#include "../../Modules/PThread/mutex.hpp"
+#include "../../Modules/PThread/recursive_mutex.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_ft_unordered_map_capacity_is_power_of_two)
+{
+    ft_unordered_map<int, int> map_instance(10);
+    ft_size_t bucket_total;
+    int key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    FT_ASSERT_EQ(static_cast<ft_size_t>(16), map_instance.bucket_count());
+    key = 0;
+    while (key < 1000)
+    {
+        map_instance.insert(key, key);
+        key++;
+    }
+    bucket_total = map_instance.bucket_count();
+    FT_ASSERT_EQ(static_cast<ft_size_t>(0), bucket_total & (bucket_total - 1));
+    FT_ASSERT(map_instance.size() <= bucket_total - bucket_total / 8);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_ft_unordered_map_erase_keeps_probe_chains_intact)
+{
+    ft_unordered_map<int, int> map_instance;
+    int key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    key = 0;
+    while (key < 4096)
+    {
+        map_instance.insert(key * 1024, key);
+        key++;
+    }
+    key = 0;
+    while (key < 4096)
+    {
+        map_instance.erase(key * 1024);
+        key += 2;
+    }
+    FT_ASSERT_EQ(static_cast<ft_size_t>(2048), map_instance.size());
+    key = 0;
+    while (key < 4096)
+    {
+        if ((key % 2) == 0)
+            FT_ASSERT(map_instance.find(key * 1024) == map_instance.end());
+        else
+            FT_ASSERT_EQ(key, map_instance.at(key * 1024));
+        key++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_ft_unordered_map_tombstones_are_reclaimed)
+{
+    ft_unordered_map<int, int> map_instance;
+    ft_size_t initial_buckets;
+    int round;
+    int key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    initial_buckets = map_instance.bucket_count();
+    round = 0;
+    while (round < 200)
+    {
+        key = 0;
+        while (key < 6)
+        {
+            map_instance.insert(round * 6 + key, key);
+            key++;
+        }
+        key = 0;
+        while (key < 6)
+        {
+            map_instance.erase(round * 6 + key);
+            key++;
+        }
+        round++;
+    }
+    FT_ASSERT_EQ(FT_TRUE, map_instance.empty());
+    FT_ASSERT_EQ(initial_buckets, map_instance.bucket_count());
+    map_instance.insert(7, 70);
+    FT_ASSERT_EQ(70, map_instance.at(7));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_ft_unordered_map_iteration_visits_each_entry_once)
+{
+    ft_unordered_map<int, int> map_instance;
+    long long key_sum;
+    ft_size_t visited;
+    int key;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.initialize());
+    key = 1;
+    while (key <= 500)
+    {
+        map_instance.insert(key, key);
+        key++;
+    }
+    key = 1;
+    while (key <= 500)
+    {
+        if ((key % 5) == 0)
+            map_instance.erase(key);
+        key++;
+    }
+    key_sum = 0;
+    visited = 0;
+    ft_unordered_map<int, int>::iterator iterator = map_instance.begin();
+    while (iterator != map_instance.end())
+    {
+        key_sum += iterator->first;
+        visited++;
+        ++iterator;
+    }
+    FT_ASSERT_EQ(static_cast<ft_size_t>(400), visited);
+    FT_ASSERT_EQ(100000LL, key_sum);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, map_instance.destroy());
+    return (1);
+}
@@ -0,0 +1,250 @@
+#include "../test_internal.hpp"
+#include "../../Modules/Threading/thread_pool.hpp"
+#include "../../Modules/Threading/work_stealing_queue.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+#include "../../Modules/Errno/errno.hpp"
+#include "../../Modules/CMA/CMA.hpp"
+#include <atomic>
+#include <thread>
+
+#include "../../Modules/Basic/class_nullptr.hpp"
+#ifndef LIBFT_TEST_BUILD
+#endif
+
+FT_TEST(test_work_stealing_deque_owner_lifo_thief_fifo)
+{
+    ft_work_stealing_deque<int> deque_instance;
+    int values[200];
+    int index;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, deque_instance.initialize());
+    index = 0;
+    while (index < 200)
+    {
+        values[index] = index;
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, deque_instance.push(&values[index]));
+        index++;
+    }
+    FT_ASSERT_EQ(200, deque_instance.size());
+    FT_ASSERT_EQ(&values[199], deque_instance.pop());
+    FT_ASSERT_EQ(&values[0], deque_instance.steal());
+    FT_ASSERT_EQ(&values[1], deque_instance.steal());
+    FT_ASSERT_EQ(&values[198], deque_instance.pop());
+    FT_ASSERT_EQ(196, deque_instance.size());
+    index = 0;
+    while (deque_instance.pop() != ft_nullptr)
+        index++;
+    FT_ASSERT_EQ(196, index);
+    FT_ASSERT(deque_instance.steal() == ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, deque_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_work_stealing_deque_concurrent_steal_takes_each_task_once)
+{
+    ft_work_stealing_deque<int> deque_instance;
+    std::atomic<long long> taken_sum;
+    std::atomic<int> taken_count;
+    std::atomic<bool> producer_done;
+    int values[4096];
+    int index;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, deque_instance.initialize());
+    taken_sum.store(0);
+    taken_count.store(0);
+    producer_done.store(false);
+    index = 0;
+    while (index < 4096)
+    {
+        values[index] = index;
+        index++;
+    }
+    auto thief = [&deque_instance, &taken_sum, &taken_count, &producer_done]()
+    {
+        int *task;
+
+        while (true)
+        {
+            task = deque_instance.steal();
+            if (task != ft_nullptr)
+            {
+                taken_sum.fetch_add(*task);
+                taken_count.fetch_add(1);
+            }
+            else if (producer_done.load() && deque_instance.size() == 0)
+                return ;
+        }
+    };
+    std::thread first_thief(thief);
+    std::thread second_thief(thief);
+    index = 0;
+    while (index < 4096)
+    {
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, deque_instance.push(&values[index]));
+        if ((index % 3) == 0)
+        {
+            int *task;
+
+            task = deque_instance.pop();
+            if (task != ft_nullptr)
+            {
+                taken_sum.fetch_add(*task);
+                taken_count.fetch_add(1);
+            }
+        }
+        index++;
+    }
+    producer_done.store(true);
+    first_thief.join();
+    second_thief.join();
+    FT_ASSERT_EQ(4096, taken_count.load());
+    FT_ASSERT_EQ(4096LL * 4095LL / 2LL, taken_sum.load());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, deque_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_thread_pool_nested_submits_from_workers)
+{
+    ft_thread_pool pool_instance(4, 0);
+    std::atomic<int> execution_count;
+    int root_index;
+
+    execution_count.store(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.initialize());
+    root_index = 0;
+    while (root_index < 8)
+    {
+        pool_instance.submit([&pool_instance, &execution_count]()
+        {
+            int child_index;
+
+            child_index = 0;
+            while (child_index < 100)
+            {
+                pool_instance.submit([&execution_count]()
+                {
+                    execution_count.fetch_add(1);
+                    return ;
+                });
+                child_index++;
+            }
+            execution_count.fetch_add(1);
+            return ;
+        });
+        FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.get_error());
+        root_index++;
+    }
+    pool_instance.wait();
+    FT_ASSERT_EQ(808, execution_count.load());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_thread_pool_runs_many_fine_grained_tasks)
+{
+    ft_thread_pool pool_instance(4, 0);
+    std::atomic<long long> task_sum;
+    int task_index;
+
+    task_sum.store(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.initialize());
+    task_index = 0;
+    while (task_index < 20000)
+    {
+        pool_instance.submit([&task_sum, task_index]()
+        {
+            task_sum.fetch_add(task_index);
+            return ;
+        });
+        task_index++;
+    }
+    pool_instance.wait();
+    FT_ASSERT_EQ(20000LL * 19999LL / 2LL, task_sum.load());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.destroy());
+    return (1);
+}
+
+FT_TEST(test_thread_pool_max_tasks_counts_queued_work)
+{
+    ft_thread_pool pool_instance(0, 2);
+    std::atomic<int> execution_count;
+
+    execution_count.store(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.initialize());
+    pool_instance.submit([&execution_count]()
+    {
+        execution_count.fetch_add(1);
+        return ;
+    });
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.get_error());
+    pool_instance.submit([&execution_count]()
+    {
+        execution_count.fetch_add(1);
+        return ;
+    });
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.get_error());
+    pool_instance.submit([&execution_count]()
+    {
+        execution_count.fetch_add(1);
+        return ;
+    });
+    FT_ASSERT_EQ(FT_ERR_FULL, pool_instance.get_error());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.destroy());
+    FT_ASSERT_EQ(0, execution_count.load());
+    return (1);
+}
+
+static void thread_pool_submit_counting_batch(ft_thread_pool &pool_instance,
+    std::atomic<int> *execution_count, int task_count)
+{
+    int task_index;
+
+    task_index = 0;
+    while (task_index < task_count)
+    {
+        pool_instance.submit([execution_count, &pool_instance]()
+        {
+            execution_count->fetch_add(1);
+            pool_instance.submit([execution_count]()
+            {
+                execution_count->fetch_add(1);
+                return ;
+            });
+            return ;
+        });
+        task_index++;
+    }
+    pool_instance.wait();
+    return ;
+}
+
+FT_TEST(test_thread_pool_small_tasks_reuse_storage_without_allocating)
+{
+    ft_thread_pool pool_instance(2, 0);
+    std::atomic<int> execution_count;
+    ft_size_t allocation_count_before;
+    ft_size_t free_count_before;
+    ft_size_t allocation_count_after;
+    ft_size_t free_count_after;
+    int round_index;
+
+    execution_count.store(0);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.initialize());
+    thread_pool_submit_counting_batch(pool_instance, &execution_count, 16);
+    FT_ASSERT_EQ(32, execution_count.load());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocation_count_before,
+            &free_count_before));
+    round_index = 0;
+    while (round_index < 64)
+    {
+        thread_pool_submit_counting_batch(pool_instance, &execution_count, 16);
+        round_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, cma_get_stats(&allocation_count_after,
+            &free_count_after));
+    FT_ASSERT_EQ(32 * 65, execution_count.load());
+    FT_ASSERT_EQ(allocation_count_before, allocation_count_after);
+    FT_ASSERT_EQ(free_count_before, free_count_after);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool_instance.destroy());
+    return (1);
+}
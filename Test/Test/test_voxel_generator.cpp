@@ -1076,4 +1076,58 @@ FT_TEST(test_terrain_generation_config_controls_tree_and_water_density)
     return (1);
 }
 
+FT_TEST(test_terrain_staged_generation_matches_single_pass)
+{
+    game_voxel_chunk single_chunk;
+    game_voxel_chunk staged_chunk;
+    terrain_generation_config config;
+    terrain_generation_context context;
+    int32_t local_x;
+    int32_t local_y;
+    int32_t local_z;
+    uint32_t single_block;
+    uint32_t staged_block;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_default_generation_config(config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generation_context_initialize(
+        context, config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, single_chunk.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, staged_chunk.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generate_chunk_with_context(
+        single_chunk, 48, -32, "staged-seed", context));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generate_chunk_base_with_context(
+        staged_chunk, 48, -32, "staged-seed", context));
+    FT_ASSERT_EQ(TERRAIN_STAGE_BASE_TERRAIN | TERRAIN_STAGE_CAVES
+        | TERRAIN_STAGE_FLUIDS,
+        staged_chunk.get_generation_metadata().completed_stage_mask);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_decorate_chunk_with_context(
+        staged_chunk, 48, -32, "staged-seed", context, ft_nullptr,
+        ft_nullptr));
+    FT_ASSERT_EQ(TERRAIN_STAGE_ALL,
+        staged_chunk.get_generation_metadata().completed_stage_mask);
+    local_x = 0;
+    while (local_x < GAME_VOXEL_CHUNK_WIDTH)
+    {
+        local_z = 0;
+        while (local_z < GAME_VOXEL_CHUNK_DEPTH)
+        {
+            local_y = 0;
+            while (local_y < GAME_VOXEL_CHUNK_HEIGHT)
+            {
+                FT_ASSERT_EQ(FT_ERR_SUCCESS, single_chunk.read_block(local_x,
+                    local_y, local_z, &single_block));
+                FT_ASSERT_EQ(FT_ERR_SUCCESS, staged_chunk.read_block(local_x,
+                    local_y, local_z, &staged_block));
+                FT_ASSERT_EQ(single_block, staged_block);
+                local_y++;
+            }
+            local_z++;
+        }
+        local_x++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, staged_chunk.destroy());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, single_chunk.destroy());
+    return (1);
+}
+
 #endif
@@ -0,0 +1,202 @@
+#include "../test_internal.hpp"
+#include "../../Modules/System_utils/test_system_utils_runner.hpp"
+
+#ifdef GAME_USE_VOXEL_REGION_BACKEND
+
+#include "../../Modules/Voxel/voxel_pipeline.hpp"
+#include "../../Modules/Threading/thread_pool.hpp"
+
+static int32_t test_chunk_pipeline_copy_chunk(const chunk_pipeline &pipeline,
+    int32_t chunk_x, int32_t chunk_z, uint32_t *blocks)
+{
+    int32_t local_x;
+    int32_t local_y;
+    int32_t local_z;
+    int32_t error_code;
+
+    local_z = 0;
+    while (local_z < GAME_VOXEL_CHUNK_DEPTH)
+    {
+        local_x = 0;
+        while (local_x < GAME_VOXEL_CHUNK_WIDTH)
+        {
+            local_y = 0;
+            while (local_y < GAME_VOXEL_CHUNK_HEIGHT)
+            {
+                error_code = pipeline.read_block(
+                        chunk_x * GAME_VOXEL_CHUNK_WIDTH + local_x, local_y,
+                        chunk_z * GAME_VOXEL_CHUNK_DEPTH + local_z, blocks);
+                if (error_code != FT_ERR_SUCCESS)
+                    return (error_code);
+                blocks++;
+                local_y++;
+            }
+            local_x++;
+        }
+        local_z++;
+    }
+    return (FT_ERR_SUCCESS);
+}
+
+FT_TEST(test_chunk_pipeline_rejects_empty_seed)
+{
+    chunk_pipeline pipeline;
+    terrain_generation_config config;
+    terrain_generation_context context;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_default_generation_config(config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generation_context_initialize(
+        context, config));
+    FT_ASSERT_EQ(FT_ERR_INVALID_ARGUMENT, pipeline.initialize(context, "",
+        ft_nullptr, 1U, 1U));
+    FT_ASSERT_EQ(FT_ERR_OUT_OF_RANGE, pipeline.initialize(context, "seed",
+        ft_nullptr, CHUNK_PIPELINE_MAX_VIEW_RADIUS + 1U, 1U));
+    return (1);
+}
+
+FT_TEST(test_chunk_pipeline_stages_rings_around_center)
+{
+    chunk_pipeline pipeline;
+    terrain_generation_config config;
+    terrain_generation_context context;
+    chunk_pipeline_metrics metrics;
+    const chunk_mesh *mesh;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_default_generation_config(config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generation_context_initialize(
+        context, config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.initialize(context, "pipeline-seed",
+        ft_nullptr, 1U, 1U));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.set_center(0, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.wait_idle());
+    FT_ASSERT_EQ(0U, pipeline.get_pending_count());
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_MESHED, pipeline.get_stage(0, 0));
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_MESHED, pipeline.get_stage(-1, 1));
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_DECORATED, pipeline.get_stage(3, 0));
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_GENERATED, pipeline.get_stage(0, -4));
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_NONE, pipeline.get_stage(5, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.get_metrics(&metrics));
+    FT_ASSERT_EQ(81U, metrics.stages[0].completed);
+    FT_ASSERT_EQ(49U, metrics.stages[1].completed);
+    FT_ASSERT_EQ(9U, metrics.stages[2].completed);
+    FT_ASSERT_EQ(0U, metrics.stages[2].failed);
+    FT_ASSERT(metrics.stages[0].total_ns >= metrics.stages[0].max_ns);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.acquire_mesh(1, 1, &mesh));
+    FT_ASSERT(mesh->vertices.size() > 0);
+    FT_ASSERT_EQ(FT_ERR_NOT_FOUND, pipeline.acquire_mesh(2, 0, &mesh));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.release_mesh(1, 1));
+    FT_ASSERT_EQ(FT_ERR_INVALID_STATE, pipeline.release_mesh(1, 1));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.destroy());
+    return (1);
+}
+
+FT_TEST(test_chunk_pipeline_thread_pool_meshes_view)
+{
+    chunk_pipeline pipeline;
+    ft_thread_pool pool(3, 0);
+    terrain_generation_config config;
+    terrain_generation_context context;
+    chunk_pipeline_metrics metrics;
+    int32_t chunk_x;
+    int32_t chunk_z;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.initialize());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_default_generation_config(config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generation_context_initialize(
+        context, config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.initialize(context, "pipeline-seed",
+        &pool, 1U, 3U));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.set_center(10, -10));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.wait_idle());
+    chunk_z = -11;
+    while (chunk_z <= -9)
+    {
+        chunk_x = 9;
+        while (chunk_x <= 11)
+        {
+            FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_MESHED,
+                pipeline.get_stage(chunk_x, chunk_z));
+            chunk_x++;
+        }
+        chunk_z++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.get_metrics(&metrics));
+    FT_ASSERT_EQ(81U, metrics.stages[0].completed);
+    FT_ASSERT_EQ(49U, metrics.stages[1].completed);
+    FT_ASSERT_EQ(9U, metrics.stages[2].completed);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.destroy());
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pool.destroy());
+    return (1);
+}
+
+FT_TEST(test_chunk_pipeline_move_cancels_unfinished_chunks)
+{
+    chunk_pipeline pipeline;
+    terrain_generation_config config;
+    terrain_generation_context context;
+    chunk_pipeline_metrics metrics;
+
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_default_generation_config(config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generation_context_initialize(
+        context, config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.initialize(context, "pipeline-seed",
+        ft_nullptr, 0U, 1U));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.set_center(0, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.pump(5U));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.set_center(100, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.get_metrics(&metrics));
+    FT_ASSERT_EQ(49U, metrics.cancelled);
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_NONE, pipeline.get_stage(0, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.wait_idle());
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_MESHED, pipeline.get_stage(100, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.destroy());
+    return (1);
+}
+
+FT_TEST(test_chunk_pipeline_restores_neighbour_writes_on_return)
+{
+    chunk_pipeline pipeline;
+    terrain_generation_config config;
+    terrain_generation_context context;
+    ft_size_t block_count;
+    ft_size_t block_index;
+    uint32_t *before;
+    uint32_t *after;
+
+    block_count = static_cast<ft_size_t>(GAME_VOXEL_CHUNK_WIDTH)
+        * GAME_VOXEL_CHUNK_DEPTH * GAME_VOXEL_CHUNK_HEIGHT;
+    before = static_cast<uint32_t *>(cma_malloc(block_count * sizeof(uint32_t)));
+    after = static_cast<uint32_t *>(cma_malloc(block_count * sizeof(uint32_t)));
+    FT_ASSERT(before != ft_nullptr);
+    FT_ASSERT(after != ft_nullptr);
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_default_generation_config(config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, terrain_generation_context_initialize(
+        context, config));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.initialize(context, "pipeline-seed",
+        ft_nullptr, 1U, 1U));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.set_center(0, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.wait_idle());
+    // With this seed, trees from the x = -3 ring reach into chunk (-4, -1).
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, test_chunk_pipeline_copy_chunk(pipeline,
+        -4, -1, before));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.set_center(1, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.wait_idle());
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_NONE, pipeline.get_stage(-4, -1));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.set_center(0, 0));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.wait_idle());
+    FT_ASSERT_EQ(CHUNK_PIPELINE_STAGE_GENERATED, pipeline.get_stage(-4, -1));
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, test_chunk_pipeline_copy_chunk(pipeline,
+        -4, -1, after));
+    block_index = 0;
+    while (block_index < block_count)
+    {
+        FT_ASSERT_EQ(before[block_index], after[block_index]);
+        block_index++;
+    }
+    FT_ASSERT_EQ(FT_ERR_SUCCESS, pipeline.destroy());
+    cma_free(before);
+    cma_free(after);
+    return (1);
+}
+
+#endif
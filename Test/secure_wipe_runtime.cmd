@@ -0,0 +1,2 @@
+@echo off
+"g++" -x c++ -O3 -Wall -Wextra -Werror -std=c++17 -pthread -Wno-missing-declarations -DLIBFT_TEST_BUILD -DLIBFT_INTERNAL_HEADERS -I"/root/repo" -I"/root/repo/Modules" "/root/repo/Test/secure_wipe_runtime_child.cpp" -x none "/root/repo/Test/Full_Libft_test.a" -pthread -Wl,--allow-multiple-definition -rdynamic -lz -ldl -o "/root/repo/Test/secure_wipe_runtime_child.exe"
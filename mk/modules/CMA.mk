@@ -3,6 +3,8 @@ DEBUG_TARGET   := CustomMemoryAllocator_debug.a
 
 SRCS := cma_backend.cpp \
         cma_arena.cpp \
+        cma_thread_cache.cpp \
+        cma_arena_scope.cpp \
         cma_malloc.cpp \
         cma_free.cpp \
         cma_bzero_and_free.cpp \
@@ -16,11 +18,15 @@ SRCS := cma_backend.cpp \
         cma_metadata.cpp \
         cma_debug.cpp \
         cma_utils.cpp \
+        cma_free_bins.cpp \
+        cma_block_index.cpp \
+        cma_huge.cpp \
         cma_global_overloads.cpp \
         cma_set_alloc_limit.cpp \
         cma_set_thread_safety.cpp
 
 HEADERS := CMA.hpp \
+           cma_arena_scope.hpp \
            cma_internal.hpp
 
 include $(dir $(lastword $(MAKEFILE_LIST)))common/module_defaults.mk
@@ -31,6 +31,10 @@ SRCS := game_map3d.cpp \
 	game_experience_table.cpp \
         game_resistance.cpp \
         game_pathfinding.cpp \
+        game_pathfinding_astar.cpp \
+        game_path_hierarchy.cpp \
+        game_path_batch.cpp \
+        game_flow_field.cpp \
         game_crafting.cpp \
         game_data_catalog.cpp \
         game_dialogue_line.cpp \
@@ -77,6 +81,10 @@ HEADERS := game_map3d.hpp \
         game_experience_table.hpp \
         game_resistance.hpp \
         game_pathfinding.hpp \
+        game_pathfinding_internal.hpp \
+        game_path_hierarchy.hpp \
+        game_path_batch.hpp \
+        game_flow_field.hpp \
         game_crafting.hpp \
         game_data_catalog.hpp \
         game_dialogue_line.hpp \
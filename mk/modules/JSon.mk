@@ -12,9 +12,15 @@ SRCS :=         json_parsing.cpp \
                 json_schema.cpp \
                 json_schema_evolution.cpp \
                 json_dom_bridge.cpp \
+                json_arena_document.cpp \
+                json_arena_value.cpp \
+                json_structural_index.cpp \
+                json_structural_events.cpp \
+                json_cursor.cpp \
+                json_cursor_document.cpp \
                 json_serializer.cpp \
                 json_thread_safety.cpp
 
-HEADERS := json.hpp document.hpp json_schema.hpp json_schema_evolution.hpp json_stream_reader.hpp json_stream_writer.hpp json_stream_events.hpp json_dom_bridge.hpp
+HEADERS := json.hpp document.hpp json_schema.hpp json_schema_evolution.hpp json_stream_reader.hpp json_stream_writer.hpp json_stream_events.hpp json_dom_bridge.hpp json_arena.hpp json_structural_index.hpp json_cursor.hpp
 
 include $(dir $(lastword $(MAKEFILE_LIST)))common/module_defaults.mk
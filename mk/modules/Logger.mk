@@ -34,6 +34,9 @@ SRCS := \
     logger_log_context_guard.cpp \
     logger_log_structured.cpp \
     logger_log_async.cpp \
+    logger_log_batch.cpp \
+    logger_log_binary.cpp \
+    logger_log_binary_decoder.cpp \
     logger.cpp \
     logger_syslog.cpp \
     logger_network.cpp
@@ -16,6 +16,7 @@ SRCS := networking_socket_class.cpp \
         networking_quic_experimental.cpp \
         networking_nonblocking.cpp \
         networking_event_loop.cpp \
+        networking_http_parser.cpp \
         networking_http_client.cpp \
         networking_http2_client.cpp \
         networking_http_server.cpp \
@@ -44,10 +45,12 @@ endif
 
 HEADERS := socket_class.hpp \
            networking.hpp \
+           networking_event_backend.hpp \
            udp_socket.hpp \
            ssl_wrapper.hpp \
            networking_tls_aead.hpp \
            networking_quic_experimental.hpp \
+           http_parser.hpp \
            http_client.hpp \
            http2_client.hpp \
            http_server.hpp \
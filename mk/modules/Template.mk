@@ -9,9 +9,12 @@ SRCS := template_basic_types.cpp \
         template_compile_function.cpp \
         template_compile_future.cpp \
         template_compile_graph.cpp \
+        template_compile_graph_search.cpp \
+        template_compile_indexed_heap.cpp \
         template_compile_iterator.cpp \
         template_compile_map.cpp \
         template_compile_math.cpp \
+        template_compile_move_only_function.cpp \
         template_compile_matrix.cpp \
         template_compile_optional.cpp \
         template_compile_pool.cpp \
@@ -10,6 +10,6 @@ SRCS := threading_thread.cpp \
         threading_task_scheduler.cpp \
         threading_task_scheduler_tracing.cpp
 
-HEADERS := thread.hpp cancellation.hpp thread_pool.hpp concurrency.hpp task_scheduler.hpp task_scheduler_tracing.hpp lock_guard.hpp unique_lock.hpp errno_guard.hpp
+HEADERS := thread.hpp cancellation.hpp thread_pool.hpp concurrency.hpp task_scheduler.hpp task_scheduler_tracing.hpp lock_guard.hpp unique_lock.hpp errno_guard.hpp work_stealing_queue.hpp task_slab.hpp
 
 include $(dir $(lastword $(MAKEFILE_LIST)))common/module_defaults.mk
@@ -44,6 +44,7 @@ BASIC_TEST_FILES := \
 CMA_TEST_FILES := \
 	Test/test_cma_alloc.cpp \
 	Test/test_cma_arena.cpp \
+	Test/test_cma_arena_scope.cpp \
 	Test/test_cma_backend.cpp \
 	Test/test_cma_block_size.cpp \
 	Test/test_cma_global_new.cpp \
@@ -52,6 +53,9 @@ CMA_TEST_FILES := \
 	Test/test_cma_stats.cpp \
 	Test/test_cma_strings.cpp \
 	Test/test_cma_scma_secure_wipe.cpp \
+	Test/test_cma_size_classes.cpp \
+	Test/test_cma_thread_cache.cpp \
+	Test/test_cma_huge.cpp \
 	Test/test_scma_accessor.cpp \
 	Test/test_scma_accessor_lifecycle.cpp \
 	Test/test_scma_accessor_proxy_chain_errors.cpp \